@@ -0,0 +1,89 @@
+"""Driver for the end-to-end coupled-model latency benchmark.
+
+This runs the manager with the latency_ping_test and latency_pong_test C++
+actors (see libmuscle/cpp/src/libmuscle/tests), which ping/pong messages
+over a pair of conduits with a configurable payload size, message rate and
+slot count. The ping side prints round-trip latency percentiles and
+throughput, which this driver relays to standard output.
+
+Build the C++ tests first (make tests in libmuscle/cpp), then run e.g.
+
+    python3 -m integration_test.benchmark_latency \\
+            --payload-bytes 1048576 --num-messages 1000 --slots 4
+
+from the repository root. A small configuration of this benchmark is also
+run as a smoke test by test_cpp_latency_benchmark.py.
+"""
+import argparse
+import tempfile
+from pathlib import Path
+
+
+def benchmark_config(
+        payload_bytes: int, num_messages: int, message_rate: float,
+        slots: int) -> str:
+    """Returns a ymmsl config for the benchmark with the given settings."""
+    return (
+            'ymmsl_version: v0.1\n'
+            'model:\n'
+            '  name: latency_benchmark\n'
+            '  components:\n'
+            '    ping: ping_implementation\n'
+            '    pong:\n'
+            '      implementation: pong_implementation\n'
+            '      multiplicity: [{}]\n'
+            '  conduits:\n'
+            '    ping.out: pong.in\n'
+            '    pong.out: ping.in\n'
+            'settings:\n'
+            '  num_messages: {}\n'
+            '  payload_bytes: {}\n'
+            '  message_rate: {}\n'
+            'implementations:\n'
+            '  ping_implementation: latency_ping_test\n'
+            '  pong_implementation: latency_pong_test\n'
+            ).format(slots, num_messages, payload_bytes, float(message_rate))
+
+
+def run_benchmark(
+        tmpdir: Path, payload_bytes: int, num_messages: int,
+        message_rate: float, slots: int) -> str:
+    """Runs the benchmark and returns the ping side's report."""
+    from .conftest import run_manager_with_actors
+
+    run_manager_with_actors(
+            benchmark_config(payload_bytes, num_messages, message_rate, slots),
+            tmpdir,
+            {
+                'ping': Path('libmuscle') / 'tests' / 'latency_ping_test',
+                'pong': Path('libmuscle') / 'tests' / 'latency_pong_test'})
+
+    return (tmpdir / 'ping_stdout.txt').read_text()
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+            description='Coupled-model latency benchmark')
+    parser.add_argument(
+            '--payload-bytes', type=int, default=1024,
+            help='Size of the message payload in bytes')
+    parser.add_argument(
+            '--num-messages', type=int, default=1000,
+            help='Number of messages to send per slot')
+    parser.add_argument(
+            '--message-rate', type=float, default=0.0,
+            help='Send rate in messages per second, 0 for unthrottled')
+    parser.add_argument(
+            '--slots', type=int, default=1,
+            help='Number of slots (pong instances) to send over')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        report = run_benchmark(
+                Path(tmpdir), args.payload_bytes, args.num_messages,
+                args.message_rate, args.slots)
+    print(report, end='')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,17 @@
+from .benchmark_latency import run_benchmark
+from .conftest import skip_if_python_only
+
+
+@skip_if_python_only
+def test_cpp_latency_benchmark(yatiml_log_warning, tmp_path):
+    # smoke test for the latency benchmark
+    # see integration_test/benchmark_latency.py for running it for real
+    report = run_benchmark(
+            tmp_path, payload_bytes=1024, num_messages=10,
+            message_rate=0.0, slots=2)
+
+    values = dict(line.split(': ') for line in report.splitlines())
+    assert int(values['num_messages']) == 10
+    assert int(values['num_slots']) == 2
+    assert float(values['messages_per_sec']) > 0.0
+    assert float(values['latency_us_p50']) <= float(values['latency_us_p99'])
@@ -89,6 +89,12 @@ def do_mmp_client_test(tmpdir, caplog):
     assert ports[1].name == 'in'
     assert ports[1].operator == Operator.F_INIT
 
+    # check register_instances
+    assert (manager._instance_registry.get_locations('micro[4]') ==
+            ['tcp:test5'])
+    assert (manager._instance_registry.get_locations('micro[5]') ==
+            ['tcp:test6'])
+
     # check deregister_instance
     assert removed_instance == 'micro[3]'
 
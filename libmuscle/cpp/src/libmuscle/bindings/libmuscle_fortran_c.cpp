@@ -4,7 +4,9 @@
 
 #include <libmuscle/libmuscle.hpp>
 #include <libmuscle/bindings/cmdlineargs.hpp>
+#include <libmuscle/bindings/port_names.hpp>
 #include <ymmsl/ymmsl.hpp>
+#include <cstring>
 #include <stdexcept>
 #include <typeinfo>
 
@@ -304,6 +306,231 @@ std::intptr_t LIBMUSCLE_DataConstRef_create_grid_real8_n_(
     return reinterpret_cast<std::intptr_t>(result);
 }
 
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_logical_a_(bool * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<bool const * const>(data_array);
+    DataConstRef * result = new DataConstRef(DataConstRef::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_int4_a_(int32_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int32_t const * const>(data_array);
+    DataConstRef * result = new DataConstRef(DataConstRef::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_int8_a_(int64_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int64_t const * const>(data_array);
+    DataConstRef * result = new DataConstRef(DataConstRef::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_real4_a_(float * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<float const * const>(data_array);
+    DataConstRef * result = new DataConstRef(DataConstRef::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_real8_a_(double * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<double const * const>(data_array);
+    DataConstRef * result = new DataConstRef(DataConstRef::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_logical_n_(
+        bool * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<bool const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_int4_n_(
+        int32_t * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int32_t const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid_view(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_int8_n_(
+        int64_t * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int64_t const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid_view(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_real4_n_(
+        float * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<float const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid_view(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_DataConstRef_create_grid_view_real8_n_(
+        double * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<double const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid_view(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
 void LIBMUSCLE_DataConstRef_free_(std::intptr_t self) {
     DataConstRef * self_p = reinterpret_cast<DataConstRef *>(self);
     delete self_p;
@@ -1026,24 +1253,50 @@ void LIBMUSCLE_DataConstRef_shape_(std::intptr_t self, std::size_t ** shp, std::
 
 void LIBMUSCLE_DataConstRef_elements_logical_(
         std::intptr_t self,
-        std::size_t ndims,
-        bool ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        bool * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     DataConstRef * self_p = reinterpret_cast<DataConstRef *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        bool const * result = self_p->elements<bool>();
-        *elements = const_cast<bool *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        bool const * source = self_p->elements<bool>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(bool));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -1057,24 +1310,50 @@ void LIBMUSCLE_DataConstRef_elements_logical_(
 
 void LIBMUSCLE_DataConstRef_elements_int4_(
         std::intptr_t self,
-        std::size_t ndims,
-        int32_t ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        int32_t * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     DataConstRef * self_p = reinterpret_cast<DataConstRef *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        int32_t const * result = self_p->elements<int32_t>();
-        *elements = const_cast<int32_t *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        int32_t const * source = self_p->elements<int32_t>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(int32_t));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -1088,24 +1367,50 @@ void LIBMUSCLE_DataConstRef_elements_int4_(
 
 void LIBMUSCLE_DataConstRef_elements_int8_(
         std::intptr_t self,
-        std::size_t ndims,
-        int64_t ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        int64_t * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     DataConstRef * self_p = reinterpret_cast<DataConstRef *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        int64_t const * result = self_p->elements<int64_t>();
-        *elements = const_cast<int64_t *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        int64_t const * source = self_p->elements<int64_t>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(int64_t));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -1119,24 +1424,50 @@ void LIBMUSCLE_DataConstRef_elements_int8_(
 
 void LIBMUSCLE_DataConstRef_elements_real4_(
         std::intptr_t self,
-        std::size_t ndims,
-        float ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        float * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     DataConstRef * self_p = reinterpret_cast<DataConstRef *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        float const * result = self_p->elements<float>();
-        *elements = const_cast<float *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        float const * source = self_p->elements<float>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(float));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -1150,24 +1481,50 @@ void LIBMUSCLE_DataConstRef_elements_real4_(
 
 void LIBMUSCLE_DataConstRef_elements_real8_(
         std::intptr_t self,
-        std::size_t ndims,
-        double ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        double * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     DataConstRef * self_p = reinterpret_cast<DataConstRef *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        double const * result = self_p->elements<double>();
-        *elements = const_cast<double *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        double const * source = self_p->elements<double>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(double));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -1317,19 +1674,244 @@ std::intptr_t LIBMUSCLE_Data_create_real8_(double value) {
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_settings_(std::intptr_t value) {
-    Settings * value_p = reinterpret_cast<Settings *>(value);
-    Data * result = new Data(*value_p);
-    return reinterpret_cast<std::intptr_t>(result);
-}
+std::intptr_t LIBMUSCLE_Data_create_settings_(std::intptr_t value) {
+    Settings * value_p = reinterpret_cast<Settings *>(value);
+    Data * result = new Data(*value_p);
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_copy_(std::intptr_t value) {
+    Data * value_p = reinterpret_cast<Data *>(value);
+    Data * result = new Data(*value_p);
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_logical_a_(bool * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<bool const * const>(data_array);
+    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_int4_a_(int32_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int32_t const * const>(data_array);
+    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_int8_a_(int64_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int64_t const * const>(data_array);
+    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_real4_a_(float * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<float const * const>(data_array);
+    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_real8_a_(double * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<double const * const>(data_array);
+    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_logical_n_(
+        bool * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<bool const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_int4_n_(
+        int32_t * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int32_t const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_int8_n_(
+        int64_t * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<int64_t const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_real4_n_(
+        float * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<float const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
+
+    Data * result = new Data(Data::grid(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
+std::intptr_t LIBMUSCLE_Data_create_grid_real8_n_(
+        double * data_array,
+        std::size_t * data_array_shape,
+        std::size_t data_array_ndims,
+        char * index_name_1, std::size_t index_name_1_size,
+        char * index_name_2, std::size_t index_name_2_size,
+        char * index_name_3, std::size_t index_name_3_size,
+        char * index_name_4, std::size_t index_name_4_size,
+        char * index_name_5, std::size_t index_name_5_size,
+        char * index_name_6, std::size_t index_name_6_size,
+        char * index_name_7, std::size_t index_name_7_size
+) {
+    std::vector<std::size_t> data_array_shape_v(
+            data_array_shape, data_array_shape + data_array_ndims);
+    auto data_array_p = const_cast<double const * const>(data_array);
+
+    std::vector<std::string> names_v;
+    names_v.push_back(std::string(index_name_1, index_name_1_size));
+    if (data_array_ndims >= 2u)
+        names_v.push_back(std::string(index_name_2, index_name_2_size));
+    if (data_array_ndims >= 3u)
+        names_v.push_back(std::string(index_name_3, index_name_3_size));
+    if (data_array_ndims >= 4u)
+        names_v.push_back(std::string(index_name_4, index_name_4_size));
+    if (data_array_ndims >= 5u)
+        names_v.push_back(std::string(index_name_5, index_name_5_size));
+    if (data_array_ndims >= 6u)
+        names_v.push_back(std::string(index_name_6, index_name_6_size));
+    if (data_array_ndims >= 7u)
+        names_v.push_back(std::string(index_name_7, index_name_7_size));
 
-std::intptr_t LIBMUSCLE_Data_create_copy_(std::intptr_t value) {
-    Data * value_p = reinterpret_cast<Data *>(value);
-    Data * result = new Data(*value_p);
+    Data * result = new Data(Data::grid(
+            data_array_p, data_array_shape_v,
+            names_v, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_logical_a_(bool * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+std::intptr_t LIBMUSCLE_Data_create_grid_view_logical_a_(bool * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
     std::vector<std::size_t> data_array_shape_v(
             data_array_shape, data_array_shape + data_array_ndims);
     auto data_array_p = const_cast<bool const * const>(data_array);
@@ -1337,39 +1919,39 @@ std::intptr_t LIBMUSCLE_Data_create_grid_logical_a_(bool * data_array, std::size
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_int4_a_(int32_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+std::intptr_t LIBMUSCLE_Data_create_grid_view_int4_a_(int32_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
     std::vector<std::size_t> data_array_shape_v(
             data_array_shape, data_array_shape + data_array_ndims);
     auto data_array_p = const_cast<int32_t const * const>(data_array);
-    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    Data * result = new Data(Data::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_int8_a_(int64_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+std::intptr_t LIBMUSCLE_Data_create_grid_view_int8_a_(int64_t * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
     std::vector<std::size_t> data_array_shape_v(
             data_array_shape, data_array_shape + data_array_ndims);
     auto data_array_p = const_cast<int64_t const * const>(data_array);
-    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    Data * result = new Data(Data::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_real4_a_(float * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+std::intptr_t LIBMUSCLE_Data_create_grid_view_real4_a_(float * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
     std::vector<std::size_t> data_array_shape_v(
             data_array_shape, data_array_shape + data_array_ndims);
     auto data_array_p = const_cast<float const * const>(data_array);
-    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    Data * result = new Data(Data::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_real8_a_(double * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
+std::intptr_t LIBMUSCLE_Data_create_grid_view_real8_a_(double * data_array, std::size_t * data_array_shape, std::size_t data_array_ndims) {
     std::vector<std::size_t> data_array_shape_v(
             data_array_shape, data_array_shape + data_array_ndims);
     auto data_array_p = const_cast<double const * const>(data_array);
-    Data * result = new Data(Data::grid(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
+    Data * result = new Data(Data::grid_view(data_array_p, data_array_shape_v, {}, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_logical_n_(
+std::intptr_t LIBMUSCLE_Data_create_grid_view_logical_n_(
         bool * data_array,
         std::size_t * data_array_shape,
         std::size_t data_array_ndims,
@@ -1406,7 +1988,7 @@ std::intptr_t LIBMUSCLE_Data_create_grid_logical_n_(
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_int4_n_(
+std::intptr_t LIBMUSCLE_Data_create_grid_view_int4_n_(
         int32_t * data_array,
         std::size_t * data_array_shape,
         std::size_t data_array_ndims,
@@ -1437,13 +2019,13 @@ std::intptr_t LIBMUSCLE_Data_create_grid_int4_n_(
     if (data_array_ndims >= 7u)
         names_v.push_back(std::string(index_name_7, index_name_7_size));
 
-    Data * result = new Data(Data::grid(
+    Data * result = new Data(Data::grid_view(
             data_array_p, data_array_shape_v,
             names_v, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_int8_n_(
+std::intptr_t LIBMUSCLE_Data_create_grid_view_int8_n_(
         int64_t * data_array,
         std::size_t * data_array_shape,
         std::size_t data_array_ndims,
@@ -1474,13 +2056,13 @@ std::intptr_t LIBMUSCLE_Data_create_grid_int8_n_(
     if (data_array_ndims >= 7u)
         names_v.push_back(std::string(index_name_7, index_name_7_size));
 
-    Data * result = new Data(Data::grid(
+    Data * result = new Data(Data::grid_view(
             data_array_p, data_array_shape_v,
             names_v, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_real4_n_(
+std::intptr_t LIBMUSCLE_Data_create_grid_view_real4_n_(
         float * data_array,
         std::size_t * data_array_shape,
         std::size_t data_array_ndims,
@@ -1511,13 +2093,13 @@ std::intptr_t LIBMUSCLE_Data_create_grid_real4_n_(
     if (data_array_ndims >= 7u)
         names_v.push_back(std::string(index_name_7, index_name_7_size));
 
-    Data * result = new Data(Data::grid(
+    Data * result = new Data(Data::grid_view(
             data_array_p, data_array_shape_v,
             names_v, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
 }
 
-std::intptr_t LIBMUSCLE_Data_create_grid_real8_n_(
+std::intptr_t LIBMUSCLE_Data_create_grid_view_real8_n_(
         double * data_array,
         std::size_t * data_array_shape,
         std::size_t data_array_ndims,
@@ -1548,7 +2130,7 @@ std::intptr_t LIBMUSCLE_Data_create_grid_real8_n_(
     if (data_array_ndims >= 7u)
         names_v.push_back(std::string(index_name_7, index_name_7_size));
 
-    Data * result = new Data(Data::grid(
+    Data * result = new Data(Data::grid_view(
             data_array_p, data_array_shape_v,
             names_v, libmuscle::StorageOrder::first_adjacent));
     return reinterpret_cast<std::intptr_t>(result);
@@ -2276,24 +2858,50 @@ void LIBMUSCLE_Data_shape_(std::intptr_t self, std::size_t ** shp, std::size_t *
 
 void LIBMUSCLE_Data_elements_logical_(
         std::intptr_t self,
-        std::size_t ndims,
-        bool ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        bool * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     Data * self_p = reinterpret_cast<Data *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        bool const * result = self_p->elements<bool>();
-        *elements = const_cast<bool *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        bool const * source = self_p->elements<bool>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(bool));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -2307,24 +2915,50 @@ void LIBMUSCLE_Data_elements_logical_(
 
 void LIBMUSCLE_Data_elements_int4_(
         std::intptr_t self,
-        std::size_t ndims,
-        int32_t ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        int32_t * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     Data * self_p = reinterpret_cast<Data *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        int32_t const * result = self_p->elements<int32_t>();
-        *elements = const_cast<int32_t *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        int32_t const * source = self_p->elements<int32_t>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(int32_t));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -2338,24 +2972,50 @@ void LIBMUSCLE_Data_elements_int4_(
 
 void LIBMUSCLE_Data_elements_int8_(
         std::intptr_t self,
-        std::size_t ndims,
-        int64_t ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        int64_t * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     Data * self_p = reinterpret_cast<Data *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        int64_t const * result = self_p->elements<int64_t>();
-        *elements = const_cast<int64_t *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        int64_t const * source = self_p->elements<int64_t>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(int64_t));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -2369,24 +3029,50 @@ void LIBMUSCLE_Data_elements_int8_(
 
 void LIBMUSCLE_Data_elements_real4_(
         std::intptr_t self,
-        std::size_t ndims,
-        float ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        float * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     Data * self_p = reinterpret_cast<Data *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        float const * result = self_p->elements<float>();
-        *elements = const_cast<float *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        float const * source = self_p->elements<float>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(float));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -2400,24 +3086,50 @@ void LIBMUSCLE_Data_elements_real4_(
 
 void LIBMUSCLE_Data_elements_real8_(
         std::intptr_t self,
-        std::size_t ndims,
-        double ** elements,
-        std::size_t * elements_shape,
-        int * elements_format,
+        double * target,
+        std::size_t * target_shape,
+        std::size_t target_ndims,
         int * err_code, char ** err_msg, std::size_t * err_msg_len
 ) {
     Data * self_p = reinterpret_cast<Data *>(self);
     try {
         *err_code = 0;
-        if (self_p->shape().size() != ndims)
+        std::vector<std::size_t> shape = self_p->shape();
+        if (shape.size() != target_ndims)
             throw std::runtime_error("Grid does not have a matching number of dimensions.");
-        double const * result = self_p->elements<double>();
-        *elements = const_cast<double *>(result);
-
-        for (std::size_t i = 0u; i < ndims; ++i)
-            elements_shape[i] = self_p->shape()[i];
-
-        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            if (shape[i] != target_shape[i])
+                throw std::runtime_error("Grid does not have a matching shape.");
+        double const * source = self_p->elements<double>();
+        std::size_t num_elems = 1u;
+        for (std::size_t i = 0u; i < target_ndims; ++i)
+            num_elems *= shape[i];
+
+        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {
+            memcpy(target, source, num_elems * sizeof(double));
+        }
+        else {
+            // Transpose the row-major source into the column-major
+            // target, writing each element straight into place.
+            std::vector<std::size_t> strides(target_ndims);
+            std::size_t stride = 1u;
+            for (std::size_t i = 0u; i < target_ndims; ++i) {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+            std::vector<std::size_t> idx(target_ndims, 0u);
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_elems; ++i) {
+                target[offset] = source[i];
+                for (std::size_t d = target_ndims; d-- > 0u; ) {
+                    offset += strides[d];
+                    if (++idx[d] < shape[d])
+                        break;
+                    offset -= strides[d] * shape[d];
+                    idx[d] = 0u;
+                }
+            }
+        }
         return;
     }
     catch (std::runtime_error const & e) {
@@ -3986,6 +4698,12 @@ bool LIBMUSCLE_Instance_is_setting_a_real8array2_(std::intptr_t self, char * nam
     return false;
 }
 
+std::intptr_t LIBMUSCLE_Instance_get_settings_(std::intptr_t self) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    Settings * result = new Settings(self_p->get_settings());
+    return reinterpret_cast<std::intptr_t>(result);
+}
+
 void LIBMUSCLE_Instance_get_setting_as_character_(std::intptr_t self, char * name, std::size_t name_size, char ** ret_val, std::size_t * ret_val_size, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
     Instance * self_p = reinterpret_cast<Instance *>(self);
     std::string name_s(name, name_size);
@@ -4319,6 +5037,13 @@ void LIBMUSCLE_Instance_set_port_length_(std::intptr_t self, char * port, std::s
     return;
 }
 
+int LIBMUSCLE_Instance_port_handle_(std::intptr_t self, char * port_name, std::size_t port_name_size) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    std::string port_name_s(port_name, port_name_size);
+    int result = (static_cast<void>(self_p), libmuscle::impl::bindings::intern_port_name(port_name_s));
+    return result;
+}
+
 void LIBMUSCLE_Instance_send_pm_(std::intptr_t self, char * port_name, std::size_t port_name_size, std::intptr_t message) {
     Instance * self_p = reinterpret_cast<Instance *>(self);
     std::string port_name_s(port_name, port_name_size);
@@ -4335,6 +5060,20 @@ void LIBMUSCLE_Instance_send_pms_(std::intptr_t self, char * port_name, std::siz
     return;
 }
 
+void LIBMUSCLE_Instance_send_hm_(std::intptr_t self, int port_handle, std::intptr_t message) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    Message * message_p = reinterpret_cast<Message *>(message);
+    self_p->send(libmuscle::impl::bindings::port_name_for_handle(port_handle), *message_p);
+    return;
+}
+
+void LIBMUSCLE_Instance_send_hms_(std::intptr_t self, int port_handle, std::intptr_t message, int slot) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    Message * message_p = reinterpret_cast<Message *>(message);
+    self_p->send(libmuscle::impl::bindings::port_name_for_handle(port_handle), *message_p, slot);
+    return;
+}
+
 std::intptr_t LIBMUSCLE_Instance_receive_p_(std::intptr_t self, char * port_name, std::size_t port_name_size, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
     Instance * self_p = reinterpret_cast<Instance *>(self);
     std::string port_name_s(port_name, port_name_size);
@@ -4428,6 +5167,97 @@ std::intptr_t LIBMUSCLE_Instance_receive_pd_(std::intptr_t self, char * port_nam
     return 0;
 }
 
+std::intptr_t LIBMUSCLE_Instance_receive_h_(std::intptr_t self, int port_handle, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    try {
+        *err_code = 0;
+        Message * result = new Message(self_p->receive(libmuscle::impl::bindings::port_name_for_handle(port_handle)));
+        return reinterpret_cast<std::intptr_t>(result);
+    }
+    catch (std::domain_error const & e) {
+        *err_code = 1;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::out_of_range const & e) {
+        *err_code = 2;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::logic_error const & e) {
+        *err_code = 3;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::runtime_error const & e) {
+        *err_code = 4;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::bad_cast const & e) {
+        *err_code = 5;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    return 0;
+}
+
+std::intptr_t LIBMUSCLE_Instance_receive_hd_(std::intptr_t self, int port_handle, std::intptr_t default_msg, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    Message * default_msg_p = reinterpret_cast<Message *>(default_msg);
+    try {
+        *err_code = 0;
+        Message * result = new Message(self_p->receive(libmuscle::impl::bindings::port_name_for_handle(port_handle), *default_msg_p));
+        return reinterpret_cast<std::intptr_t>(result);
+    }
+    catch (std::domain_error const & e) {
+        *err_code = 1;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::out_of_range const & e) {
+        *err_code = 2;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::logic_error const & e) {
+        *err_code = 3;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::runtime_error const & e) {
+        *err_code = 4;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::bad_cast const & e) {
+        *err_code = 5;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    return 0;
+}
+
 std::intptr_t LIBMUSCLE_Instance_receive_ps_(std::intptr_t self, char * port_name, std::size_t port_name_size, int slot, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
     Instance * self_p = reinterpret_cast<Instance *>(self);
     std::string port_name_s(port_name, port_name_size);
@@ -4521,6 +5351,97 @@ std::intptr_t LIBMUSCLE_Instance_receive_psd_(std::intptr_t self, char * port_na
     return 0;
 }
 
+std::intptr_t LIBMUSCLE_Instance_receive_hs_(std::intptr_t self, int port_handle, int slot, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    try {
+        *err_code = 0;
+        Message * result = new Message(self_p->receive(libmuscle::impl::bindings::port_name_for_handle(port_handle), slot));
+        return reinterpret_cast<std::intptr_t>(result);
+    }
+    catch (std::domain_error const & e) {
+        *err_code = 1;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::out_of_range const & e) {
+        *err_code = 2;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::logic_error const & e) {
+        *err_code = 3;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::runtime_error const & e) {
+        *err_code = 4;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::bad_cast const & e) {
+        *err_code = 5;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    return 0;
+}
+
+std::intptr_t LIBMUSCLE_Instance_receive_hsd_(std::intptr_t self, int port_handle, int slot, std::intptr_t default_message, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
+    Instance * self_p = reinterpret_cast<Instance *>(self);
+    Message * default_message_p = reinterpret_cast<Message *>(default_message);
+    try {
+        *err_code = 0;
+        Message * result = new Message(self_p->receive(libmuscle::impl::bindings::port_name_for_handle(port_handle), slot, *default_message_p));
+        return reinterpret_cast<std::intptr_t>(result);
+    }
+    catch (std::domain_error const & e) {
+        *err_code = 1;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::out_of_range const & e) {
+        *err_code = 2;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::logic_error const & e) {
+        *err_code = 3;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::runtime_error const & e) {
+        *err_code = 4;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    catch (std::bad_cast const & e) {
+        *err_code = 5;
+        static std::string msg;
+        msg = e.what();
+        *err_msg = const_cast<char*>(msg.data());
+        *err_msg_len = msg.size();
+    }
+    return 0;
+}
+
 std::intptr_t LIBMUSCLE_Instance_receive_with_settings_p_(std::intptr_t self, char * port_name, std::size_t port_name_size, int * err_code, char ** err_msg, std::size_t * err_msg_len) {
     Instance * self_p = reinterpret_cast<Instance *>(self);
     std::string port_name_s(port_name, port_name_size);
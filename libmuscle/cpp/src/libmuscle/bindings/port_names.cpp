@@ -0,0 +1,36 @@
+#include <libmuscle/bindings/port_names.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+
+namespace libmuscle { namespace impl { namespace bindings {
+
+namespace {
+
+// Leaked intentionally, so that handles remain valid during shutdown.
+std::vector<std::string> & port_names_() {
+    static std::vector<std::string> * names = new std::vector<std::string>();
+    return *names;
+}
+
+}
+
+int intern_port_name(std::string const & port_name) {
+    auto & names = port_names_();
+    for (std::size_t i = 0u; i < names.size(); ++i)
+        if (names[i] == port_name)
+            return static_cast<int>(i);
+    names.push_back(port_name);
+    return static_cast<int>(names.size() - 1u);
+}
+
+std::string const & port_name_for_handle(int handle) {
+    auto & names = port_names_();
+    if (handle < 0 || static_cast<std::size_t>(handle) >= names.size())
+        throw std::runtime_error("Invalid port name handle. Did you get it"
+                " from LIBMUSCLE_Instance_port_handle()?");
+    return names[static_cast<std::size_t>(handle)];
+}
+
+} } }
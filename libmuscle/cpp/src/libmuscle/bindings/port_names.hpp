@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+
+namespace libmuscle { namespace impl { namespace bindings {
+
+// Helpers for interning port names passed from Fortran.
+//
+// Converting a Fortran string to a std::string allocates, which adds up
+// when it happens on every send and receive. These functions let the
+// Fortran API resolve a port name to an integer handle once, and then
+// pass the handle instead of the name on every call.
+
+/** Intern a port name and return a handle for it.
+ *
+ * Interning the same name again returns the same handle. Handles stay
+ * valid for the lifetime of the process.
+ *
+ * @param port_name The name of the port.
+ * @return A handle identifying this port name.
+ */
+int intern_port_name(std::string const & port_name);
+
+/** Return the port name for the given handle.
+ *
+ * @param handle A handle returned by intern_port_name().
+ * @return The corresponding port name.
+ */
+std::string const & port_name_for_handle(int handle);
+
+} } }
@@ -0,0 +1,86 @@
+#include <libmuscle/block_pool.hpp>
+
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+namespace {
+
+// maximum number of recycled blocks kept per block size
+std::size_t const max_pooled_blocks_ = 256u;
+
+/* A pool of recycled fixed-size memory blocks.
+ *
+ * See pooled_block_alloc() in the header. Each distinct size gets its
+ * own freelist; there is one size per call site, so scanning the list
+ * of sizes linearly is cheaper than hashing.
+ */
+class BlockPool_ {
+    public:
+        void * get(std::size_t num_bytes) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (auto & freelist : freelists_) {
+                    if (freelist.first == num_bytes) {
+                        if (freelist.second.empty())
+                            break;
+                        void * block = freelist.second.back();
+                        freelist.second.pop_back();
+                        return block;
+                    }
+                }
+            }
+            return ::operator new(num_bytes);
+        }
+
+        void put(void * block, std::size_t num_bytes) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (auto & freelist : freelists_) {
+                    if (freelist.first == num_bytes) {
+                        if (freelist.second.size() >= max_pooled_blocks_)
+                            break;
+                        freelist.second.push_back(block);
+                        return;
+                    }
+                }
+                if (freelists_.size() < max_sizes_) {
+                    freelists_.emplace_back(
+                            num_bytes, std::vector<void *>({block}));
+                    return;
+                }
+            }
+            ::operator delete(block);
+        }
+
+    private:
+        // more distinct sizes than this stop being pooled, in case a
+        // caller passes through varying sizes after all
+        static std::size_t const max_sizes_ = 16u;
+
+        std::mutex mutex_;
+        std::vector<std::pair<std::size_t, std::vector<void *>>> freelists_;
+};
+
+BlockPool_ & block_pool_() {
+    // deliberately leaked, see the class comment in the header
+    static BlockPool_ * pool = new BlockPool_();
+    return *pool;
+}
+
+}
+
+
+namespace libmuscle { namespace impl {
+
+void * pooled_block_alloc(std::size_t num_bytes) {
+    return block_pool_().get(num_bytes);
+}
+
+void pooled_block_free(void * block, std::size_t num_bytes) {
+    block_pool_().put(block, num_bytes);
+}
+
+} }
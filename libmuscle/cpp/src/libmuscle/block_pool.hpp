@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+
+
+namespace libmuscle { namespace impl {
+
+/** Gets a block of memory, reusing a recycled one if available.
+ *
+ * This serves the small fixed-size blocks behind the message envelopes:
+ * the storage of a nil or scalar DataConstRef, and the shared
+ * DataConstRef members of MPPMessage. Those are allocated and freed at
+ * the message rate, and with zones and dict keys already recycled they
+ * were the last remaining envelope allocations on the steady-state
+ * send/receive path.
+ *
+ * Blocks handed back via pooled_block_free() are kept on a freelist
+ * per block size and handed out again here. Only a handful of distinct
+ * sizes occur, one per call site, and the number of blocks kept per
+ * size is capped. Blocks may be freed from any thread, and possibly
+ * after static destruction has run, so the pool is synchronised and
+ * deliberately leaked, as with the zone pool in data.cpp.
+ *
+ * @param num_bytes Size of the block to get.
+ * @return A block of at least num_bytes bytes.
+ */
+void * pooled_block_alloc(std::size_t num_bytes);
+
+/** Returns a block obtained from pooled_block_alloc() for reuse.
+ *
+ * @param block The block to return.
+ * @param num_bytes The size it was requested with.
+ */
+void pooled_block_free(void * block, std::size_t num_bytes);
+
+
+/** An allocator that draws from the block pool.
+ *
+ * Use with std::allocate_shared to make a shared object whose combined
+ * object-and-control block is recycled, so that creating it does not
+ * touch the allocator in steady state. The object itself is still
+ * constructed and destroyed on every use, which resets it in place.
+ */
+template <typename T>
+class BlockPoolAllocator {
+    public:
+        using value_type = T;
+
+        BlockPoolAllocator() = default;
+
+        template <typename U>
+        BlockPoolAllocator(BlockPoolAllocator<U> const &) {}
+
+        T * allocate(std::size_t n) {
+            return static_cast<T *>(pooled_block_alloc(n * sizeof(T)));
+        }
+
+        void deallocate(T * p, std::size_t n) {
+            pooled_block_free(p, n * sizeof(T));
+        }
+};
+
+template <typename T, typename U>
+bool operator==(
+        BlockPoolAllocator<T> const &, BlockPoolAllocator<U> const &) {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(
+        BlockPoolAllocator<T> const &, BlockPoolAllocator<U> const &) {
+    return false;
+}
+
+} }
@@ -0,0 +1,216 @@
+#include <libmuscle/checkpoint_triggers.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+
+namespace libmuscle { namespace impl {
+
+AtCheckpointTrigger::AtCheckpointTrigger(std::vector<double> const & at)
+    : at_(at)
+{
+    std::sort(at_.begin(), at_.end());
+}
+
+Optional<double> AtCheckpointTrigger::next_checkpoint(double cur_time) const {
+    auto it = std::upper_bound(at_.begin(), at_.end(), cur_time);
+    if (it == at_.end())
+        return {};
+    return *it;
+}
+
+Optional<double> AtCheckpointTrigger::previous_checkpoint(double cur_time) const {
+    auto it = std::upper_bound(at_.begin(), at_.end(), cur_time);
+    if (it == at_.begin())
+        return {};
+    return *std::prev(it);
+}
+
+RangeCheckpointTrigger::RangeCheckpointTrigger(CheckpointRule const & rule)
+    : start_(rule.start)
+    , stop_(rule.stop)
+    , every_(rule.every)
+{
+    if (stop_.is_set()) {
+        double start = start_.is_set() ? start_.get() : 0.0;
+        double diff = stop_.get() - start;
+        last_ = start + std::floor(diff / every_) * every_;
+    }
+}
+
+Optional<double> RangeCheckpointTrigger::next_checkpoint(double cur_time) const {
+    if (start_.is_set() && cur_time < start_.get())
+        return start_.get();
+    if (last_.is_set() && cur_time >= last_.get())
+        return {};
+    double start = start_.is_set() ? start_.get() : 0.0;
+    double diff = cur_time - start;
+    return start + (std::floor(diff / every_) + 1.0) * every_;
+}
+
+Optional<double> RangeCheckpointTrigger::previous_checkpoint(double cur_time) const {
+    if (start_.is_set() && cur_time < start_.get())
+        return {};
+    if (last_.is_set() && cur_time >= last_.get())
+        return last_.get();
+    double start = start_.is_set() ? start_.get() : 0.0;
+    double diff = cur_time - start;
+    return start + std::floor(diff / every_) * every_;
+}
+
+CombinedCheckpointTriggers::CombinedCheckpointTriggers(
+        std::vector<CheckpointRule> const & rules)
+{
+    for (auto const & rule : rules) {
+        if (!rule.at.empty())
+            triggers_.emplace_back(new AtCheckpointTrigger(rule.at));
+        else
+            triggers_.emplace_back(new RangeCheckpointTrigger(rule));
+    }
+}
+
+Optional<double> CombinedCheckpointTriggers::next_checkpoint(double cur_time) const {
+    Optional<double> result;
+    for (auto const & trigger : triggers_) {
+        auto checkpoint = trigger->next_checkpoint(cur_time);
+        if (checkpoint.is_set())
+            if (!result.is_set() || checkpoint.get() < result.get())
+                result = checkpoint;
+    }
+    return result;
+}
+
+Optional<double> CombinedCheckpointTriggers::previous_checkpoint(double cur_time) const {
+    Optional<double> result;
+    for (auto const & trigger : triggers_) {
+        auto checkpoint = trigger->previous_checkpoint(cur_time);
+        if (checkpoint.is_set())
+            if (!result.is_set() || checkpoint.get() > result.get())
+                result = checkpoint;
+    }
+    return result;
+}
+
+TriggerManager::TriggerManager()
+    : has_checkpoints_(false)
+    , reference_(std::chrono::steady_clock::now())
+    , checkpoint_at_end_(false)
+    , prevwall_(0.0)
+    , cpts_considered_until_(-std::numeric_limits<double>::infinity())
+{}
+
+void TriggerManager::set_checkpoint_info(
+        double elapsed, Checkpoints const & checkpoints)
+{
+    reference_ = std::chrono::steady_clock::now() -
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(elapsed));
+
+    has_checkpoints_ = !checkpoints.empty();
+    checkpoint_at_end_ = checkpoints.at_end;
+
+    wall_.reset(new CombinedCheckpointTriggers(checkpoints.wallclock_time));
+    prevwall_ = 0.0;
+    nextwall_ = wall_->next_checkpoint(0.0);
+
+    sim_.reset(new CombinedCheckpointTriggers(checkpoints.simulation_time));
+    prevsim_ = {};
+    nextsim_ = {};
+}
+
+double TriggerManager::elapsed_walltime() {
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - reference_;
+    return elapsed.count();
+}
+
+double TriggerManager::checkpoints_considered_until() const {
+    return cpts_considered_until_;
+}
+
+void TriggerManager::harmonise_wall_time(double at_least) {
+    double cur = elapsed_walltime();
+    if (cur < at_least)
+        reference_ -= std::chrono::duration_cast<
+            std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(at_least - cur));
+}
+
+bool TriggerManager::should_save_snapshot(double timestamp) {
+    if (!has_checkpoints_)
+        return false;
+    return should_save_(timestamp);
+}
+
+bool TriggerManager::should_save_final_snapshot(
+        bool do_reuse, Optional<double> f_init_max_timestamp)
+{
+    if (!has_checkpoints_)
+        return false;
+
+    bool result = false;
+    if (!do_reuse) {
+        if (checkpoint_at_end_) {
+            result = true;
+            last_triggers_.push_back("at_end");
+        }
+    }
+    else if (f_init_max_timestamp.is_set()) {
+        // The F_INIT messages just received will be processed by the
+        // user code, so treat the last timestamp in them as the current
+        // simulation time.
+        result = should_save_(f_init_max_timestamp.get());
+    }
+    return result;
+}
+
+void TriggerManager::update_checkpoints(double timestamp) {
+    prevwall_ = elapsed_walltime();
+    nextwall_ = wall_->next_checkpoint(prevwall_);
+    prevsim_ = timestamp;
+    nextsim_ = sim_->next_checkpoint(timestamp);
+}
+
+std::vector<std::string> TriggerManager::get_triggers() {
+    std::vector<std::string> triggers;
+    triggers.swap(last_triggers_);
+    return triggers;
+}
+
+bool TriggerManager::should_save_(double simulation_time) {
+    if (!nextsim_.is_set() && !prevsim_.is_set()) {
+        // On the first call, initialise the simulation time checkpoints.
+        // If this simulation was started at a simulation time beyond some
+        // of the checkpoint moments, those should not trigger.
+        auto previous = sim_->previous_checkpoint(simulation_time);
+        if (previous.is_set())
+            // Set nextsim_ to the last passed checkpoint, which triggers
+            // should_save_ to return true immediately.
+            nextsim_ = previous;
+        else
+            nextsim_ = sim_->next_checkpoint(simulation_time);
+    }
+
+    double walltime = elapsed_walltime();
+    // This method is called by the instance every time it passes a point
+    // where a checkpoint may be taken, so we have considered saving at
+    // this walltime.
+    cpts_considered_until_ = walltime;
+
+    if (nextwall_.is_set() && walltime >= nextwall_.get()) {
+        std::ostringstream oss;
+        oss << "wallclock_time >= " << nextwall_.get();
+        last_triggers_.push_back(oss.str());
+    }
+    if (nextsim_.is_set() && simulation_time >= nextsim_.get()) {
+        std::ostringstream oss;
+        oss << "simulation_time >= " << nextsim_.get();
+        last_triggers_.push_back(oss.str());
+    }
+    return !last_triggers_.empty();
+}
+
+} }
+
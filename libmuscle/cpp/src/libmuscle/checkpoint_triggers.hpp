@@ -0,0 +1,207 @@
+#pragma once
+
+#include <libmuscle/util.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace libmuscle { namespace impl {
+
+/** A checkpoint rule, as configured in the workflow.
+ *
+ * A rule is either an "at" rule, which lists moments at which a checkpoint
+ * should be taken, or a "range" rule, which describes a series of checkpoints
+ * at regular intervals. If \c at is non-empty then this is an "at" rule,
+ * otherwise it is a "range" rule described by \c start, \c stop and \c every.
+ *
+ * This mirrors the checkpoint rules in the Python yMMSL library; the C++
+ * yMMSL API does not have them, so they are defined here.
+ */
+struct CheckpointRule {
+    std::vector<double> at;
+    Optional<double> start;
+    Optional<double> stop;
+    double every = 0.0;
+};
+
+
+/** The checkpoint configuration of a workflow.
+ */
+struct Checkpoints {
+    bool at_end = false;
+    std::vector<CheckpointRule> wallclock_time;
+    std::vector<CheckpointRule> simulation_time;
+
+    /** Return whether no checkpoints are defined at all. */
+    bool empty() const {
+        return !at_end && wallclock_time.empty() && simulation_time.empty();
+    }
+};
+
+
+/** Defines when checkpoints should be saved.
+ */
+class CheckpointTrigger {
+    public:
+        virtual ~CheckpointTrigger() = default;
+
+        /** Calculate the next checkpoint time.
+         *
+         * @param cur_time The current time.
+         * @return The time when a next checkpoint should be taken, or nothing
+         *      if this trigger has no next checkpoint.
+         */
+        virtual Optional<double> next_checkpoint(double cur_time) const = 0;
+
+        /** Calculate the previous checkpoint time.
+         *
+         * @param cur_time The current time.
+         * @return The time when a previous checkpoint should have been taken,
+         *      or nothing if this trigger has no previous checkpoint.
+         */
+        virtual Optional<double> previous_checkpoint(double cur_time) const = 0;
+};
+
+
+/** Checkpoint trigger based on an "at" rule.
+ */
+class AtCheckpointTrigger : public CheckpointTrigger {
+    public:
+        /** Create an at checkpoint trigger.
+         *
+         * @param at The moments at which a checkpoint should be taken.
+         */
+        explicit AtCheckpointTrigger(std::vector<double> const & at);
+
+        Optional<double> next_checkpoint(double cur_time) const override;
+        Optional<double> previous_checkpoint(double cur_time) const override;
+
+    private:
+        std::vector<double> at_;    // sorted ascending
+};
+
+
+/** Checkpoint trigger based on a "range" rule.
+ */
+class RangeCheckpointTrigger : public CheckpointTrigger {
+    public:
+        /** Create a range checkpoint trigger.
+         *
+         * @param rule The range rule to create a trigger for.
+         */
+        explicit RangeCheckpointTrigger(CheckpointRule const & rule);
+
+        Optional<double> next_checkpoint(double cur_time) const override;
+        Optional<double> previous_checkpoint(double cur_time) const override;
+
+    private:
+        Optional<double> start_;
+        Optional<double> stop_;
+        double every_;
+        Optional<double> last_;
+};
+
+
+/** Checkpoint trigger that combines several other triggers.
+ */
+class CombinedCheckpointTriggers : public CheckpointTrigger {
+    public:
+        /** Create a combined checkpoint trigger from a set of rules.
+         *
+         * @param rules The rules to create triggers for.
+         */
+        explicit CombinedCheckpointTriggers(
+                std::vector<CheckpointRule> const & rules);
+
+        Optional<double> next_checkpoint(double cur_time) const override;
+        Optional<double> previous_checkpoint(double cur_time) const override;
+
+    private:
+        std::vector<std::unique_ptr<CheckpointTrigger>> triggers_;
+};
+
+
+/** Manages all checkpoint triggers of an instance.
+ *
+ * This keeps track of elapsed wallclock time, of which checkpoints have
+ * already been taken, and of which checkpoints should be taken next, and
+ * decides on that basis whether a snapshot should be saved now.
+ */
+class TriggerManager {
+    public:
+        TriggerManager();
+
+        /** Set the checkpoint configuration.
+         *
+         * @param elapsed Wallclock time elapsed in previous runs, in case we
+         *      are resuming.
+         * @param checkpoints The checkpoint configuration of the workflow.
+         */
+        void set_checkpoint_info(double elapsed, Checkpoints const & checkpoints);
+
+        /** Return elapsed wallclock time since the start of the workflow.
+         */
+        double elapsed_walltime();
+
+        /** Return the wallclock time up to which checkpoints were considered.
+         */
+        double checkpoints_considered_until() const;
+
+        /** Ensure our elapsed walltime is at least the given value.
+         *
+         * Elapsed time as tracked by different instances may drift apart;
+         * this re-synchronises us with a peer, so that all instances pass a
+         * wallclock checkpoint at approximately the same moment.
+         *
+         * @param at_least Elapsed walltime as reported by a peer.
+         */
+        void harmonise_wall_time(double at_least);
+
+        /** Return whether a snapshot should be saved now.
+         *
+         * @param timestamp The current simulation time.
+         */
+        bool should_save_snapshot(double timestamp);
+
+        /** Return whether a final snapshot should be saved now.
+         *
+         * @param do_reuse Whether the reuse loop will be entered again.
+         * @param f_init_max_timestamp Maximum timestamp of pre-received
+         *      F_INIT messages, if any were received.
+         */
+        bool should_save_final_snapshot(
+                bool do_reuse, Optional<double> f_init_max_timestamp);
+
+        /** Update the trigger state after a snapshot was taken.
+         *
+         * @param timestamp The simulation time of the snapshot.
+         */
+        void update_checkpoints(double timestamp);
+
+        /** Return the description of the triggers of the latest snapshot.
+         *
+         * This clears the stored triggers.
+         */
+        std::vector<std::string> get_triggers();
+
+    private:
+        bool should_save_(double simulation_time);
+
+        bool has_checkpoints_;
+        std::chrono::steady_clock::time_point reference_;
+        bool checkpoint_at_end_;
+        std::unique_ptr<CombinedCheckpointTriggers> wall_;
+        double prevwall_;
+        Optional<double> nextwall_;
+        std::unique_ptr<CombinedCheckpointTriggers> sim_;
+        Optional<double> prevsim_;
+        Optional<double> nextsim_;
+        std::vector<std::string> last_triggers_;
+        double cpts_considered_until_;
+};
+
+} }
+
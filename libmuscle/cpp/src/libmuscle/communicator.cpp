@@ -2,12 +2,24 @@
 
 #include <libmuscle/close_port.hpp>
 #include <libmuscle/data.hpp>
+#include <libmuscle/instrumentation.hpp>
 #include <libmuscle/mcp/ext_types.hpp>
 #include <libmuscle/mpp_message.hpp>
+#include <libmuscle/mcp/direct_transport_server.hpp>
+#include <libmuscle/mcp/mpi_transport_server.hpp>
+#include <libmuscle/mcp/shm_transport_server.hpp>
 #include <libmuscle/mcp/tcp_transport_server.hpp>
+#include <libmuscle/mcp/uds_transport_server.hpp>
 #include <libmuscle/mpp_client.hpp>
+#include <libmuscle/receive_timeout_error.hpp>
 
+#include <algorithm>
+#include <cstdlib>
 #include <limits>
+#include <memory>
+#include <mutex>
+
+#include <poll.h>
 
 
 using libmuscle::impl::ClosePort;
@@ -15,7 +27,13 @@ using libmuscle::impl::Data;
 using libmuscle::impl::DataConstRef;
 using libmuscle::impl::mcp::ExtTypeId;
 using libmuscle::impl::MPPClient;
+#ifdef MUSCLE_ENABLE_MPI
+using libmuscle::impl::mcp::MpiTransportServer;
+#endif
+using libmuscle::impl::mcp::DirectTransportServer;
+using libmuscle::impl::mcp::ShmTransportServer;
 using libmuscle::impl::mcp::TcpTransportServer;
+using libmuscle::impl::mcp::UdsTransportServer;
 
 using ymmsl::Conduit;
 using ymmsl::Identifier;
@@ -30,7 +48,8 @@ Communicator::Communicator(
         ymmsl::Reference const & kernel,
         std::vector<int> const & index,
         Optional<PortsDescription> const & declared_ports,
-        Logger & logger, int profiler)
+        Logger & logger, Profiler & profiler,
+        int preferred_tcp_port)
     : kernel_(kernel)
     , index_(index)
     , declared_ports_(declared_ports)
@@ -39,8 +58,54 @@ Communicator::Communicator(
     , servers_()
     , clients_()
     , ports_()
+    , decode_stop_(false)
+    , checkpoints_considered_until_(-std::numeric_limits<double>::infinity())
+    , received_saved_until_(-std::numeric_limits<double>::infinity())
 {
-    servers_.emplace_back(new TcpTransportServer(post_office_));
+    // A parked prefetched message is otherwise decoded on the model's
+    // thread, inside the receive that finally asks for it. Decode
+    // workers decompress and decode parked messages in the background
+    // instead, while the model computes, so that the receive finds the
+    // message ready. Off by default; this only pays off when payloads
+    // are large or compressed.
+    char const * num_decode_str = getenv("MUSCLE_DECODE_THREADS");
+    if (num_decode_str != nullptr) {
+        int num_decode_threads = atoi(num_decode_str);
+        for (int i = 0; i < num_decode_threads; ++i)
+            decode_threads_.emplace_back(&Communicator::decode_loop_, this);
+    }
+
+    // The same-process and same-host servers go first, in order of
+    // preference, so that get_locations() lists them ahead of TCP and
+    // co-located peers pick the cheapest transport they can use.
+    servers_.emplace_back(new DirectTransportServer(post_office_));
+    try {
+        servers_.emplace_back(new ShmTransportServer(post_office_));
+    }
+    catch (std::runtime_error const & e) {
+        // no usable shared memory on this system, the others will do
+    }
+    try {
+        servers_.emplace_back(new UdsTransportServer(post_office_));
+    }
+    catch (std::runtime_error const & e) {
+        // no usable socket directory on this system, TCP will do
+    }
+#ifdef MUSCLE_ENABLE_MPI
+    try {
+        servers_.emplace_back(new MpiTransportServer(post_office_));
+    }
+    catch (std::runtime_error const & e) {
+        // no MPI ports or not enough thread support, TCP will do
+    }
+#endif
+    servers_.emplace_back(
+            new TcpTransportServer(post_office_, preferred_tcp_port));
+}
+
+Communicator::~Communicator() {
+    join_warmup_threads_();
+    stop_decode_threads_();
 }
 
 std::vector<std::string> Communicator::get_locations() const {
@@ -55,8 +120,17 @@ void Communicator::connect(
         PeerDims const & peer_dims,
         PeerLocations const & peer_locations)
 {
-    peer_manager_ = std::make_unique<PeerManager>(
-            kernel_, index_, conduits, peer_dims, peer_locations);
+    join_warmup_threads_();
+
+    // The peer information is published as an immutable snapshot, so
+    // that sends and receives on several threads can query it without
+    // synchronising with each other. Reconnecting swaps in a fresh
+    // snapshot atomically; readers that still hold the old one finish
+    // against it undisturbed.
+    std::atomic_store(
+            &peer_manager_,
+            std::shared_ptr<PeerManager const>(std::make_shared<PeerManager>(
+                    kernel_, index_, conduits, peer_dims, peer_locations)));
 
     if (declared_ports_.is_set())
         ports_ = ports_from_declared_();
@@ -64,6 +138,39 @@ void Communicator::connect(
         ports_ = ports_from_conduits_(conduits);
 
     muscle_settings_in_ = settings_in_port_(conduits);
+
+    warm_up_connections_(conduits, peer_locations);
+}
+
+bool Communicator::try_connect_cached(
+        std::vector<Conduit> const & conduits,
+        PeerDims const & peer_dims,
+        PeerLocations const & peer_locations)
+{
+    connect(conduits, peer_dims, peer_locations);
+
+    // The cached locations may be stale, so dial every peer now rather
+    // than on first use, and report failure while the caller can still
+    // fall back to the manager. On a warm restart with identical
+    // placement this does no extra work, the connections are all needed
+    // anyway and are kept for use.
+    for (auto const & peer : peer_locations) {
+        try {
+            get_client_(peer.first);
+        }
+        catch (std::runtime_error const & e) {
+            logger_.info(
+                    "Could not reach cached peer ", peer.first,
+                    ", falling back to the manager");
+            // the warm-up may still be dialling other stale peers,
+            // let it finish before throwing its work away
+            join_warmup_threads_();
+            std::lock_guard<std::mutex> lock(clients_mutex_);
+            clients_.clear();
+            return false;
+        }
+    }
+    return true;
 }
 
 bool Communicator::settings_in_connected() const {
@@ -77,6 +184,47 @@ PortsDescription Communicator::list_ports() const {
     return result;
 }
 
+std::unordered_map<std::string, std::vector<int>>
+Communicator::get_message_counts() const {
+    std::unordered_map<std::string, std::vector<int>> port_message_counts;
+    for (auto const & port : ports_)
+        port_message_counts[port.first] = port.second.get_message_counts();
+    if (muscle_settings_in_.is_set())
+        port_message_counts["muscle_settings_in"] =
+            muscle_settings_in_.get().get_message_counts();
+    return port_message_counts;
+}
+
+void Communicator::restore_message_counts(
+        std::unordered_map<std::string, std::vector<int>> const &
+            port_message_counts)
+{
+    for (auto const & port_counts : port_message_counts) {
+        if (port_counts.first == "muscle_settings_in") {
+            if (muscle_settings_in_.is_set())
+                muscle_settings_in_.get().restore_message_counts(
+                        port_counts.second);
+        }
+        else if (ports_.count(port_counts.first) != 0)
+            ports_.at(port_counts.first).restore_message_counts(
+                    port_counts.second);
+        else
+            throw std::runtime_error(
+                    "Unknown port " + port_counts.first + " in snapshot."
+                    " Have the ports changed since the snapshot was taken?");
+    }
+}
+
+void Communicator::set_checkpoints_considered_until(
+        double checkpoints_considered_until)
+{
+    checkpoints_considered_until_ = checkpoints_considered_until;
+}
+
+double Communicator::received_saved_until() const {
+    return received_saved_until_;
+}
+
 bool Communicator::port_exists(std::string const & port_name) const {
     return ports_.count(port_name) > 0;
 }
@@ -89,10 +237,175 @@ Port & Communicator::get_port(std::string const & port_name) {
     return ports_.at(port_name);
 }
 
+PortHandle Communicator::get_port_handle(std::string const & port_name) {
+    Identifier port_id(port_name);
+    auto state = std::make_shared<PortHandle::State_>(
+            port_name, port_id, &ports_.at(port_name));
+    state->connected = peer_manager_->is_connected(port_id);
+    if (state->connected) {
+        state->self_endpoint = Endpoint(kernel_, index_, port_id, {});
+        // Slots go into the endpoints, so for vector ports these have
+        // to be built per call and there's nothing to cache here.
+        if (!state->port->is_vector())
+            state->peer_endpoints = peer_manager_->get_peer_endpoints(
+                    port_id, {});
+    }
+    return PortHandle(state);
+}
+
 void Communicator::send_message(
         std::string const & port_name,
         Message const & message,
-        Optional<int> slot)
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    encode_and_deposit_(
+            make_mpp_messages_(
+                port_name, Message(message), slot, delta_interval), codec,
+            instrumentation::port_counters(port_name));
+}
+
+void Communicator::send_message(
+        std::string const & port_name,
+        Message && message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    encode_and_deposit_(
+            make_mpp_messages_(
+                port_name, std::move(message), slot, delta_interval), codec,
+            instrumentation::port_counters(port_name));
+}
+
+std::future<void> Communicator::send_message_async(
+        std::string const & port_name,
+        Message const & message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    return send_message_async(
+            port_name, Message(message), slot, codec, delta_interval);
+}
+
+std::future<void> Communicator::send_message_async(
+        std::string const & port_name,
+        Message && message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    // Building the messages is cheap and touches the ports, so it's done
+    // here on the calling thread; only the encoding and the deposit,
+    // which don't, are pushed to the background.
+    auto messages = make_mpp_messages_(
+            port_name, std::move(message), slot, delta_interval);
+    auto & port_ctrs = instrumentation::port_counters(port_name);
+    return std::async(std::launch::async,
+            [this, codec, &port_ctrs](
+                    std::vector<std::pair<Reference, MPPMessage>> && msgs) {
+                encode_and_deposit_(std::move(msgs), codec, port_ctrs);
+            }, std::move(messages));
+}
+
+void Communicator::send_range(
+        std::string const & port_name,
+        int first_slot, int last_slot,
+        std::function<Message(int)> const & make_message,
+        Codec codec,
+        int delta_interval)
+{
+    auto & port_ctrs = instrumentation::port_counters(port_name);
+
+    std::vector<std::pair<Reference, std::unique_ptr<DataConstRef>>> batch;
+    if (last_slot > first_slot)
+        batch.reserve(last_slot - first_slot);
+
+    // The payloads differ per slot, so the receiver-splicing fast path
+    // of encode_and_deposit_() does not apply here; the win is keeping
+    // the endpoint lookups and encodes in one warm loop and handing
+    // the lot to the post office in a single batch.
+    for (int slot = first_slot; slot < last_slot; ++slot) {
+        auto messages = make_mpp_messages_(
+                port_name, make_message(slot), slot, delta_interval);
+        for (auto & message : messages) {
+            auto message_bytes = std::make_unique<DataConstRef>(
+                    message.second.encoded(codec));
+            instrumentation::count(
+                    instrumentation::counters().bytes_sent,
+                    message_bytes->size());
+            instrumentation::count(
+                    port_ctrs.bytes_sent, message_bytes->size());
+            instrumentation::count(
+                    instrumentation::counters().messages_sent);
+            batch.emplace_back(message.first, std::move(message_bytes));
+        }
+    }
+
+    post_office_.deposit_batch(std::move(batch));
+}
+
+void Communicator::send_message(
+        PortHandle const & port_handle,
+        Message const & message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    encode_and_deposit_(
+            make_mpp_messages_(
+                port_handle, Message(message), slot, delta_interval), codec,
+            instrumentation::port_counters(port_handle.state_->name));
+}
+
+void Communicator::send_message(
+        PortHandle const & port_handle,
+        Message && message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    encode_and_deposit_(
+            make_mpp_messages_(
+                port_handle, std::move(message), slot, delta_interval), codec,
+            instrumentation::port_counters(port_handle.state_->name));
+}
+
+std::future<void> Communicator::send_message_async(
+        PortHandle const & port_handle,
+        Message const & message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    return send_message_async(
+            port_handle, Message(message), slot, codec, delta_interval);
+}
+
+std::future<void> Communicator::send_message_async(
+        PortHandle const & port_handle,
+        Message && message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    auto messages = make_mpp_messages_(
+            port_handle, std::move(message), slot, delta_interval);
+    auto & port_ctrs = instrumentation::port_counters(port_handle.state_->name);
+    return std::async(std::launch::async,
+            [this, codec, &port_ctrs](
+                    std::vector<std::pair<Reference, MPPMessage>> && msgs) {
+                encode_and_deposit_(std::move(msgs), codec, port_ctrs);
+            }, std::move(messages));
+}
+
+std::vector<std::pair<Reference, MPPMessage>> Communicator::make_mpp_messages_(
+        std::string const & port_name,
+        Message && message,
+        Optional<int> slot,
+        int delta_interval)
 {
     if (slot.is_set())
         logger_.debug("Sending message on ", port_name, "[", slot.get(), "]");
@@ -112,46 +425,257 @@ void Communicator::send_message(
     }
 
     Endpoint snd_endpoint = get_endpoint_(port_name, slot_list);
-    if (!peer_manager_->is_connected(snd_endpoint.port))
+    if (!peer_manager_->is_connected(snd_endpoint.port()))
         // log sending on disconnected port
-        return;
+        return {};
 
     Port & port = ports_.at(port_name);
 
-    // TODO start profile event
-
     auto recv_endpoints = peer_manager_->get_peer_endpoints(
-            snd_endpoint.port, slot_list);
+            snd_endpoint.port(), slot_list);
 
-    Data settings_overlay(message.settings());
+    auto messages = build_mpp_messages_(
+            port, snd_endpoint, recv_endpoints, std::move(message), slot,
+            delta_interval);
+    instrumentation::count(
+            instrumentation::port_counters(port_name).messages_sent,
+            messages.size());
+    return messages;
+}
+
+std::vector<std::pair<Reference, MPPMessage>> Communicator::make_mpp_messages_(
+        PortHandle const & port_handle,
+        Message && message,
+        Optional<int> slot,
+        int delta_interval)
+{
+    auto const & state = *port_handle.state_;
+    if (slot.is_set())
+        logger_.debug("Sending message on ", state.name, "[", slot.get(), "]");
+    else
+        logger_.debug("Sending message on ", state.name);
+
+    if (!state.connected)
+        // log sending on disconnected port
+        return {};
+
+    Port & port = *state.port;
+
+    std::vector<int> slot_list;
+    if (slot.is_set()) {
+        slot_list.push_back(slot.get());
+        int slot_length = port.get_length();
+        if (slot_length <= slot.get()) {
+            std::ostringstream oss;
+            oss << "Slot out of bounds. You are sending on slot " << slot;
+            oss << " of port '" << state.name << "', which is of length";
+            oss << " " << slot_length << ", so that slot does not exist.";
+            throw std::runtime_error(oss.str());
+        }
+    }
+    std::vector<std::pair<Reference, MPPMessage>> messages;
+    if (!slot.is_set() && !state.peer_endpoints.empty())
+        messages = build_mpp_messages_(
+                port, state.self_endpoint.get(), state.peer_endpoints,
+                std::move(message), slot, delta_interval);
+    else {
+        Endpoint snd_endpoint(kernel_, index_, state.port_id, slot_list);
+        auto recv_endpoints = peer_manager_->get_peer_endpoints(
+                state.port_id, slot_list);
+
+        messages = build_mpp_messages_(
+                port, snd_endpoint, recv_endpoints, std::move(message), slot,
+                delta_interval);
+    }
+    instrumentation::count(
+            instrumentation::port_counters(state.name).messages_sent,
+            messages.size());
+    return messages;
+}
+
+/* Builds the on-the-wire messages for the given resolved port.
+ *
+ * This is the part of sending that is shared between the by-name and
+ * by-handle paths; the caller has already resolved the port and the
+ * endpoints involved.
+ */
+std::vector<std::pair<Reference, MPPMessage>> Communicator::build_mpp_messages_(
+        Port & port,
+        Endpoint const & snd_endpoint,
+        std::vector<Endpoint> const & recv_endpoints,
+        Message && message,
+        Optional<int> slot,
+        int delta_interval)
+{
+    ProfileEvent profile_event(ProfileEventType::send, port, slot);
+
+    // Converting the overlay to its wire form is expensive and it
+    // rarely changes, so reuse the previous conversion if it is current.
+    // The copy taken out of the cache is shallow and shares the wire
+    // form with it.
+    Data settings_overlay = [&]() {
+        std::lock_guard<std::mutex> lock(overlay_mutex_);
+        if (
+                !overlay_cache_ ||
+                overlay_generation_ != message.settings().generation()) {
+            overlay_cache_.reset(new Data(message.settings()));
+            overlay_generation_ = message.settings().generation();
+        }
+        return *overlay_cache_;
+    }();
 
     Optional<int> port_length;
     if (port.is_resizable())
         port_length = port.get_length();
+    profile_event.port_length = port_length;
+    profile_event.message_number = port.get_num_messages(slot);
 
+    std::vector<std::pair<Reference, MPPMessage>> messages;
+    messages.reserve(recv_endpoints.size());
+    std::size_t num_left = recv_endpoints.size();
     for (auto recv_endpoint : recv_endpoints) {
-        MPPMessage mpp_message(
-                snd_endpoint.ref(), recv_endpoint.ref(),
-                port_length, message.timestamp(), Optional<double>(),
-                settings_overlay, port.get_num_messages(slot), -1.0,
-                message.data());
+        // the payload can be moved into the last on-the-wire message,
+        // and there's usually only one receiver
+        --num_left;
+        DataConstRef payload = (num_left > 0u)
+            ? DataConstRef(message.data()) : message.take_data();
 
+        Delta delta = Delta::none;
+        DataConstRef wire_payload = (delta_interval > 0)
+            ? apply_delta_(
+                    recv_endpoint.ref(), payload, delta_interval,
+                    port.get_num_messages(slot), delta)
+            : std::move(payload);
+
+        Optional<double> next_timestamp;
         if (message.has_next_timestamp())
-            mpp_message.next_timestamp = message.next_timestamp();
+            next_timestamp = message.next_timestamp();
 
-        auto message_bytes = std::make_unique<DataConstRef>(mpp_message.encoded());
-        post_office_.deposit(recv_endpoint.ref(), std::move(message_bytes));
+        MPPMessage mpp_message(
+                snd_endpoint.ref(), recv_endpoint.ref(),
+                port_length, message.timestamp(), next_timestamp,
+                settings_overlay, port.get_num_messages(slot),
+                checkpoints_considered_until_, std::move(wire_payload));
+        mpp_message.set_delta(delta);
+
+        messages.emplace_back(recv_endpoint.ref(), std::move(mpp_message));
     }
 
     port.increment_num_messages(slot);
 
-    // TODO: stop and complete profile event
+    profile_event.stop();
+    profiler_.record_event(std::move(profile_event));
+    return messages;
+}
+
+/* Delta-encodes a payload against the last one sent to this receiver.
+ *
+ * On a delta-enabled conduit, a slowly evolving grid differs from its
+ * predecessor in only a fraction of its bits. XORing the two leaves
+ * zeroes everywhere else, which the compression stage then shrinks
+ * dramatically. XOR is bit-exact and its own inverse, so the receiver
+ * reconstructs the grid exactly by XORing again; see finish_receive_().
+ *
+ * A keyframe, carrying the complete payload, is sent whenever there is
+ * no retained state to encode against (including when the grid changed
+ * type or shape), and periodically so that the retained copies cannot
+ * drift apart silently. Non-grid payloads, such as the close-port
+ * signal, pass through unencoded.
+ *
+ * The retained state is keyed by receiver, so each slot of a vector
+ * port has its own delta stream.
+ */
+DataConstRef Communicator::apply_delta_(
+        ymmsl::Reference const & receiver,
+        DataConstRef const & payload,
+        int delta_interval, int message_number,
+        Delta & delta)
+{
+    if (!payload.is_a_grid()) {
+        delta = Delta::none;
+        return payload;
+    }
+
+    instrumentation::TimedLockGuard lock(delta_mutex_);
+    auto it = delta_sent_.find(receiver);
+    if (it != delta_sent_.end() && message_number % delta_interval != 0) {
+        try {
+            DataConstRef encoded = payload.grid_xor(it->second);
+            delta_sent_.erase(it);
+            delta_sent_.emplace(receiver, payload);
+            delta = Delta::delta;
+            return encoded;
+        }
+        catch (std::runtime_error const &) {
+            // type or shape changed, fall through to a keyframe
+        }
+    }
+
+    if (it != delta_sent_.end())
+        delta_sent_.erase(it);
+    delta_sent_.emplace(receiver, payload);
+    delta = Delta::keyframe;
+    return payload;
+}
+
+/* Encodes the given messages and deposits them in the post office.
+ *
+ * This is where the msgpack encoding happens, which for large state
+ * messages is by far the most expensive part of sending. It only
+ * touches the messages and the post office, which is thread-safe, so
+ * send_message_async() can run it on a background thread.
+ */
+void Communicator::encode_and_deposit_(
+        std::vector<std::pair<Reference, MPPMessage>> && messages,
+        Codec codec,
+        instrumentation::PortCounters & port_ctrs)
+{
+    std::vector<std::pair<Reference, std::unique_ptr<DataConstRef>>> batch;
+    batch.reserve(messages.size());
+
+    // Fan-out fast path: the messages of a multi-receiver send are
+    // built from the same payload and header and differ only in the
+    // receiver field, so encode the first one and derive the others
+    // by splicing each receiver into those bytes, rather than packing
+    // the whole message once per receiver. Delta encoding keeps state
+    // per receiver, so delta-encoded sends take the general path.
+    bool fan_out = messages.size() > 1u;
+    for (auto const & message : messages)
+        fan_out = fan_out && (message.second.delta() == Delta::none);
+
+    std::unique_ptr<DataConstRef> template_bytes;
+    for (auto & message : messages) {
+        std::unique_ptr<DataConstRef> message_bytes;
+        if (template_bytes) {
+            auto spliced = MPPMessage::encoded_with_receiver(
+                    *template_bytes, message.first);
+            if (spliced.is_set())
+                message_bytes = std::make_unique<DataConstRef>(
+                        std::move(spliced.get()));
+        }
+        if (!message_bytes) {
+            message_bytes = std::make_unique<DataConstRef>(
+                    message.second.encoded(codec));
+            if (fan_out)
+                template_bytes = std::make_unique<DataConstRef>(
+                        *message_bytes);
+        }
+        instrumentation::count(
+                instrumentation::counters().bytes_sent, message_bytes->size());
+        instrumentation::count(port_ctrs.bytes_sent, message_bytes->size());
+        batch.emplace_back(message.first, std::move(message_bytes));
+    }
+    instrumentation::count(
+            instrumentation::counters().messages_sent, messages.size());
+    post_office_.deposit_batch(std::move(batch));
 }
 
 Message Communicator::receive_message(
         std::string const & port_name,
         Optional<int> slot,
-        Optional<Message> const & default_msg)
+        Optional<Message> const & default_msg,
+        Optional<double> timeout,
+        int prefetch_depth)
 {
     if (slot.is_set())
         logger_.debug("Waiting for message on ", port_name, "[", slot.get(), "]");
@@ -163,7 +687,7 @@ Message Communicator::receive_message(
 
     Endpoint recv_endpoint(get_endpoint_(port_name, slot_list));
 
-    if (!peer_manager_->is_connected(recv_endpoint.port)) {
+    if (!peer_manager_->is_connected(recv_endpoint.port())) {
         if (!default_msg.is_set()) {
             std::ostringstream oss;
             oss << "Tried to receive on port '" << port_name << "', which is";
@@ -180,42 +704,538 @@ Message Communicator::receive_message(
 
     Port & port = (ports_.count(port_name)) ? (ports_.at(port_name)) : muscle_settings_in_.get();
 
-    // TODO start profile event
-
     // peer_manager already checks that there is at most one snd_endpoint
     // connected to the port we receive on
     Endpoint snd_endpoint = peer_manager_->get_peer_endpoints(
-            recv_endpoint.port, slot_list).at(0);
+            recv_endpoint.port(), slot_list).at(0);
+
+    return finish_receive_(
+            port_name, port, recv_endpoint, snd_endpoint, slot, default_msg,
+            timeout, prefetch_depth);
+}
+
+Message Communicator::receive_message(
+        PortHandle const & port_handle,
+        Optional<int> slot,
+        Optional<Message> const & default_msg,
+        int prefetch_depth)
+{
+    auto const & state = *port_handle.state_;
+    if (slot.is_set())
+        logger_.debug("Waiting for message on ", state.name, "[", slot.get(), "]");
+    else
+        logger_.debug("Waiting for message on ", state.name);
+
+    if (!state.connected) {
+        if (!default_msg.is_set()) {
+            std::ostringstream oss;
+            oss << "Tried to receive on port '" << state.name << "', which is";
+            oss << " disconnected, and no default value was given. Either";
+            oss << " specify a default, or connect a sending component to";
+            oss << " this port.";
+            throw std::runtime_error(oss.str());
+        }
+        else {
+            logger_.debug("No message received on ", state.name, " as it is not connected");
+            return default_msg.get();
+        }
+    }
+
+    Port & port = *state.port;
+
+    if (!slot.is_set() && !state.peer_endpoints.empty())
+        return finish_receive_(
+                state.name, port, state.self_endpoint.get(),
+                state.peer_endpoints.at(0), slot, default_msg, {},
+                prefetch_depth);
+
+    std::vector<int> slot_list;
+    if (slot.is_set())
+        slot_list.emplace_back(slot.get());
+
+    Endpoint recv_endpoint(kernel_, index_, state.port_id, slot_list);
+    Endpoint snd_endpoint = peer_manager_->get_peer_endpoints(
+            state.port_id, slot_list).at(0);
+
+    return finish_receive_(
+            state.name, port, recv_endpoint, snd_endpoint, slot, default_msg,
+            {}, prefetch_depth);
+}
+
+double Communicator::forward_message(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        Optional<int> slot)
+{
+    if (slot.is_set())
+        logger_.debug(
+                "Forwarding message from ", receiving_port_name, "[",
+                slot.get(), "] to ", sending_port_name, "[", slot.get(), "]");
+    else
+        logger_.debug(
+                "Forwarding message from ", receiving_port_name, " to ",
+                sending_port_name);
+
+    std::vector<int> slot_list;
+    if (slot.is_set())
+        slot_list.emplace_back(slot.get());
+
+    Endpoint recv_endpoint(get_endpoint_(receiving_port_name, slot_list));
+
+    if (!peer_manager_->is_connected(recv_endpoint.port())) {
+        std::ostringstream oss;
+        oss << "Tried to forward from port '" << receiving_port_name << "',";
+        oss << " which is disconnected. Connect a sending component to";
+        oss << " this port.";
+        throw std::runtime_error(oss.str());
+    }
+
+    Port & in_port = ports_.at(receiving_port_name);
+
+    Endpoint snd_endpoint = peer_manager_->get_peer_endpoints(
+            recv_endpoint.port(), slot_list).at(0);
+
+    ProfileEvent receive_event(ProfileEventType::receive, in_port, slot);
+
     MPPClient & client = get_client_(snd_endpoint.instance());
-    auto mpp_message = MPPMessage::from_bytes(
-            client.receive(recv_endpoint.ref()));
 
-    Settings overlay_settings(mpp_message.settings_overlay.as<Settings>());
+    ProfileEvent wait_event(ProfileEventType::receive_wait, in_port, slot);
+    MPPMessage mpp_message = fetch_message_(
+            client, snd_endpoint.instance(), recv_endpoint.ref());
+    wait_event.stop();
+
+    instrumentation::count(instrumentation::counters().messages_received);
+    auto & recv_port_ctrs = instrumentation::port_counters(
+            receiving_port_name);
+    instrumentation::count(recv_port_ctrs.messages_received);
+    instrumentation::count(
+            recv_port_ctrs.bytes_received, mpp_message.encoded_size());
+    instrumentation::record_wait(recv_port_ctrs, static_cast<std::uint64_t>(
+            wait_event.stop_time.nanoseconds
+            - wait_event.start_time.nanoseconds));
+
+    // the codec the payload came in with; data() below changes the
+    // payload state, so look it up first
+    Codec wire_codec = mpp_message.codec();
+
+    if (mpp_message.port_length().is_set())
+        if (in_port.is_resizable())
+            in_port.set_length(mpp_message.port_length().get());
+
+    bool closing = mpp_message.is_close_port();
+
+    if (closing) {
+        if (slot.is_set())
+            in_port.set_closed(slot.get());
+        else
+            in_port.set_closed();
+    }
+    else {
+        instrumentation::TimedLockGuard peer_lock(
+                peer_mutex_(snd_endpoint.instance()));
+        client.start_receive(recv_endpoint.ref());
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        prefetching_[snd_endpoint.instance()].push_back(recv_endpoint.ref());
+    }
+
+    receive_event.stop();
+    profiler_.record_event(std::move(wait_event));
+    profiler_.record_event(std::move(receive_event));
+
+    int expected_message_number = in_port.get_num_messages(slot);
+    if (expected_message_number != mpp_message.message_number()) {
+        std::ostringstream oss;
+        oss << "Received message on " << receiving_port_name;
+        if (slot.is_set())
+            oss << "[" << slot.get() << "]";
+        oss << " with unexpected message number " << mpp_message.message_number();
+        oss << ". Was expecting " << expected_message_number;
+        oss << ". Are you resuming from an inconsistent snapshot?";
+        throw std::runtime_error(oss.str());
+    }
+    in_port.increment_num_messages(slot);
+
+    if (closing) {
+        if (slot.is_set())
+            logger_.debug(
+                    "Port ", receiving_port_name, "[", slot.get(),
+                    "] is now closed");
+        else
+            logger_.debug("Port ", receiving_port_name, " is now closed");
+    }
+
+    // now send it on; only the envelope header changes, the payload and
+    // settings overlay are passed along as they were received
+    Endpoint fwd_endpoint = get_endpoint_(sending_port_name, slot_list);
+    if (!peer_manager_->is_connected(fwd_endpoint.port()))
+        // log sending on disconnected port
+        return mpp_message.timestamp();
 
-    if (mpp_message.port_length.is_set())
+    Port & out_port = ports_.at(sending_port_name);
+
+    ProfileEvent send_event(ProfileEventType::send, out_port, slot);
+
+    Optional<int> port_length;
+    if (out_port.is_resizable())
+        port_length = out_port.get_length();
+    send_event.port_length = port_length;
+
+    auto fwd_endpoints = peer_manager_->get_peer_endpoints(
+            fwd_endpoint.port(), slot_list);
+
+    std::vector<std::pair<Reference, MPPMessage>> messages;
+    messages.reserve(fwd_endpoints.size());
+    for (auto const & peer_endpoint : fwd_endpoints) {
+        // copying is cheap, the payload is shared between the copies
+        MPPMessage fwd_message(mpp_message);
+        fwd_message.set_sender(fwd_endpoint.ref());
+        fwd_message.set_receiver(peer_endpoint.ref());
+        fwd_message.set_port_length(port_length);
+        fwd_message.set_message_number(out_port.get_num_messages(slot));
+        messages.emplace_back(peer_endpoint.ref(), std::move(fwd_message));
+    }
+
+    out_port.increment_num_messages(slot);
+
+    send_event.stop();
+    profiler_.record_event(std::move(send_event));
+
+    instrumentation::count(
+            instrumentation::port_counters(sending_port_name).messages_sent,
+            messages.size());
+
+    // encoding with the codec the payload is already in sends the
+    // payload bytes on as they are, without recompressing them
+    encode_and_deposit_(
+            std::move(messages), wire_codec,
+            instrumentation::port_counters(sending_port_name));
+
+    return mpp_message.timestamp();
+}
+
+std::vector<double> Communicator::forward_batch(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        int max_messages)
+{
+    logger_.debug(
+            "Forwarding up to ", max_messages, " messages from ",
+            receiving_port_name, " to ", sending_port_name);
+    if (max_messages < 1)
+        max_messages = 1;
+    std::size_t max_n = static_cast<std::size_t>(max_messages);
+
+    Endpoint recv_endpoint(get_endpoint_(receiving_port_name, {}));
+
+    if (!peer_manager_->is_connected(recv_endpoint.port())) {
+        std::ostringstream oss;
+        oss << "Tried to forward from port '" << receiving_port_name << "',";
+        oss << " which is disconnected. Connect a sending component to";
+        oss << " this port.";
+        throw std::runtime_error(oss.str());
+    }
+
+    Port & in_port = ports_.at(receiving_port_name);
+
+    Reference receiver = recv_endpoint.ref();
+    Endpoint snd_endpoint = peer_manager_->get_peer_endpoints(
+            recv_endpoint.port(), {}).at(0);
+    Reference const & instance = snd_endpoint.instance();
+    MPPClient & client = get_client_(instance);
+
+    ProfileEvent receive_event(ProfileEventType::receive, in_port, {});
+    ProfileEvent wait_event(ProfileEventType::receive_wait, in_port, {});
+
+    std::vector<MPPMessage> fetched = fetch_batch_(
+            client, instance, receiver, max_n);
+    wait_event.stop();
+    receive_event.stop();
+
+    auto & recv_port_ctrs = instrumentation::port_counters(
+            receiving_port_name);
+    // one wait covered the whole fetch, see receive_batch()
+    instrumentation::record_wait(recv_port_ctrs, static_cast<std::uint64_t>(
+            wait_event.stop_time.nanoseconds
+            - wait_event.start_time.nanoseconds));
+    profiler_.record_event(std::move(wait_event));
+    profiler_.record_event(std::move(receive_event));
+
+    // the sending side is the same for every message in the batch
+    Endpoint fwd_endpoint = get_endpoint_(sending_port_name, {});
+    bool out_connected = peer_manager_->is_connected(fwd_endpoint.port());
+
+    std::vector<double> timestamps;
+    timestamps.reserve(fetched.size());
+
+    for (auto & mpp_message : fetched) {
+        instrumentation::count(
+                instrumentation::counters().messages_received);
+        instrumentation::count(recv_port_ctrs.messages_received);
+        instrumentation::count(
+                recv_port_ctrs.bytes_received, mpp_message.encoded_size());
+
+        // the codec the payload came in with; encoding with it below
+        // sends the payload bytes on as they are
+        Codec wire_codec = mpp_message.codec();
+
+        if (mpp_message.port_length().is_set())
+            if (in_port.is_resizable())
+                in_port.set_length(mpp_message.port_length().get());
+
+        bool closing = mpp_message.is_close_port();
+        if (closing) {
+            in_port.set_closed();
+            logger_.debug("Port ", receiving_port_name, " is now closed");
+        }
+
+        int expected_message_number = in_port.get_num_messages({});
+        if (expected_message_number != mpp_message.message_number()) {
+            std::ostringstream oss;
+            oss << "Received message on " << receiving_port_name;
+            oss << " with unexpected message number "
+                << mpp_message.message_number();
+            oss << ". Was expecting " << expected_message_number;
+            oss << ". Are you resuming from an inconsistent snapshot?";
+            throw std::runtime_error(oss.str());
+        }
+        in_port.increment_num_messages({});
+
+        timestamps.push_back(mpp_message.timestamp());
+
+        if (!out_connected)
+            continue;
+
+        Port & out_port = ports_.at(sending_port_name);
+
+        ProfileEvent send_event(ProfileEventType::send, out_port, {});
+
+        Optional<int> port_length;
+        if (out_port.is_resizable())
+            port_length = out_port.get_length();
+        send_event.port_length = port_length;
+
+        auto const & fwd_endpoints = peer_manager_->get_peer_endpoints(
+                fwd_endpoint.port(), {});
+
+        std::vector<std::pair<Reference, MPPMessage>> messages;
+        messages.reserve(fwd_endpoints.size());
+        for (auto const & peer_endpoint : fwd_endpoints) {
+            // copying is cheap, the payload is shared between the copies
+            MPPMessage fwd_message(mpp_message);
+            fwd_message.set_sender(fwd_endpoint.ref());
+            fwd_message.set_receiver(peer_endpoint.ref());
+            fwd_message.set_port_length(port_length);
+            fwd_message.set_message_number(out_port.get_num_messages({}));
+            messages.emplace_back(peer_endpoint.ref(), std::move(fwd_message));
+        }
+
+        out_port.increment_num_messages({});
+
+        send_event.stop();
+        profiler_.record_event(std::move(send_event));
+
+        instrumentation::count(
+                instrumentation::port_counters(sending_port_name).messages_sent,
+                messages.size());
+
+        encode_and_deposit_(
+                std::move(messages), wire_codec,
+                instrumentation::port_counters(sending_port_name));
+    }
+
+    // prefetching was suppressed during the fetch, a request issued
+    // mid-batch could end up past a close; request the next message
+    // now instead, if the port is still open
+    if (in_port.is_open())
+        start_receive(receiving_port_name);
+
+    return timestamps;
+}
+
+/* Fetches and checks a message for the given resolved port.
+ *
+ * This is the part of receiving that is shared between the by-name and
+ * by-handle paths; the caller has already resolved the port and the
+ * endpoints involved and has checked that the port is connected.
+ */
+Message Communicator::finish_receive_(
+        std::string const & port_name,
+        Port & port,
+        Endpoint const & recv_endpoint,
+        Endpoint const & snd_endpoint,
+        Optional<int> slot,
+        Optional<Message> const & default_msg,
+        Optional<double> timeout,
+        int prefetch_depth)
+{
+    ProfileEvent receive_event(ProfileEventType::receive, port, slot);
+
+    MPPClient & client = get_client_(snd_endpoint.instance());
+
+    ProfileEvent wait_event(ProfileEventType::receive_wait, port, slot);
+    // The timeout applies to the connection, which is shared, so set it
+    // only for the duration of this receive.
+    if (timeout.is_set())
+        client.set_receive_timeout(timeout);
+    MPPMessage mpp_message = [&]() {
+        try {
+            return fetch_message_(
+                    client, snd_endpoint.instance(), recv_endpoint.ref());
+        }
+        catch (ReceiveTimeoutError const &) {
+            client.set_receive_timeout({});
+            logger_.warning(
+                    "Receiving on port '", port_name, "' timed out after ",
+                    timeout.get(), " seconds");
+            throw;
+        }
+    }();
+    if (timeout.is_set())
+        client.set_receive_timeout({});
+    wait_event.stop();
+
+    instrumentation::count(instrumentation::counters().messages_received);
+    auto & port_ctrs = instrumentation::port_counters(port_name);
+    instrumentation::count(port_ctrs.messages_received);
+    instrumentation::count(
+            port_ctrs.bytes_received, mpp_message.encoded_size());
+    instrumentation::record_wait(port_ctrs, static_cast<std::uint64_t>(
+            wait_event.stop_time.nanoseconds
+            - wait_event.start_time.nanoseconds));
+
+    return process_message_(
+            port_name, port, recv_endpoint, snd_endpoint, slot, default_msg,
+            std::move(mpp_message), client, prefetch_depth, true,
+            receive_event, wait_event);
+}
+
+/* Turns a fetched MPP message into a Message for the given port.
+ *
+ * This is the half of receiving that comes after the message is in:
+ * settings overlay and delta decoding, port resizing, prefetching the
+ * next message, message number checks, and close-port handling. It is
+ * shared between finish_receive_(), which fetches one message, and
+ * receive_batch(), which fetches several and processes them in turn.
+ * The latter passes false for prefetch, suppressing the top-up of
+ * standing requests; a request issued halfway through a batch that
+ * ends in a close-port message would never be answered. The profile
+ * events are recorded here, at the same point in the receive as
+ * before the split.
+ */
+Message Communicator::process_message_(
+        std::string const & port_name,
+        Port & port,
+        Endpoint const & recv_endpoint,
+        Endpoint const & snd_endpoint,
+        Optional<int> slot,
+        Optional<Message> const & default_msg,
+        MPPMessage && mpp_message,
+        MPPClient & client,
+        int prefetch_depth,
+        bool prefetch,
+        ProfileEvent & receive_event,
+        ProfileEvent & wait_event)
+{
+    double saved_until = mpp_message.saved_until();
+    double prev_saved = received_saved_until_.load();
+    while (
+            saved_until > prev_saved &&
+            !received_saved_until_.compare_exchange_weak(
+                prev_saved, saved_until)) {}
+    // the peer never needs messages from before its checkpoint again,
+    // so an advancing watermark releases them from the retransmission
+    // window, if one is configured
+    if (saved_until > prev_saved)
+        post_office_.discard_retransmits_until(saved_until);
+
+    Settings overlay_settings(mpp_message.settings_overlay().as<Settings>());
+
+    if (mpp_message.port_length().is_set())
         if (port.is_resizable())
-            port.set_length(mpp_message.port_length.get());
+            port.set_length(mpp_message.port_length().get());
+
+    // take_data() below empties the message, so determine this first
+    bool closing = mpp_message.is_close_port();
+
+    // on a delta-enabled conduit, reconstruct the payload against the
+    // retained previous state, see apply_delta_()
+    DataConstRef payload([&]() -> DataConstRef {
+            DataConstRef raw = mpp_message.take_data();
+            if (mpp_message.delta() == Delta::none)
+                return raw;
+            instrumentation::TimedLockGuard lock(delta_mutex_);
+            if (mpp_message.delta() == Delta::delta) {
+                auto it = delta_received_.find(recv_endpoint.ref());
+                if (it == delta_received_.end())
+                    throw std::runtime_error(
+                            "Received a delta-encoded message without a"
+                            " preceding keyframe. Are you resuming from a"
+                            " snapshot with delta sending enabled? That is"
+                            " not supported, disable muscle_delta_interval"
+                            " when checkpointing.");
+                DataConstRef reconstructed = raw.grid_xor(it->second);
+                delta_received_.erase(it);
+                delta_received_.emplace(recv_endpoint.ref(), reconstructed);
+                return reconstructed;
+            }
+            if (mpp_message.delta() == Delta::keyframe) {
+                delta_received_.erase(recv_endpoint.ref());
+                delta_received_.emplace(recv_endpoint.ref(), raw);
+            }
+            return raw;
+            }());
 
     Message message(
-            mpp_message.timestamp, mpp_message.data, overlay_settings);
+            mpp_message.timestamp(), std::move(payload),
+            overlay_settings);
 
-    if (mpp_message.next_timestamp.is_set())
-        message.set_next_timestamp(mpp_message.next_timestamp.get());
+    if (mpp_message.next_timestamp().is_set())
+        message.set_next_timestamp(mpp_message.next_timestamp().get());
 
-    if (is_close_port(message.data())) {
+    if (closing) {
         if (slot.is_set())
             port.set_closed(slot.get());
         else
             port.set_closed();
     }
+    else if (prefetch) {
+        // Couplings tend to be repetitive: having received on this port,
+        // we'll almost certainly receive on it again. Request the next
+        // message now, so that it travels while the model computes and
+        // is (mostly) here by the time it is asked for. fetch_message_
+        // picks the response up on the next receive. A prefetch depth
+        // beyond one leaves several requests standing, so that a fast
+        // conduit delivers continuously, at more than one message per
+        // round trip. After a close there is no next message, so don't
+        // ask for any then.
+        instrumentation::TimedLockGuard peer_lock(
+                peer_mutex_(snd_endpoint.instance()));
+        std::unique_lock<std::mutex> prefetch_lock(prefetch_mutex_);
+        auto & in_flight = prefetching_[snd_endpoint.instance()];
+        auto parked_it = prefetched_.find(recv_endpoint.ref());
+        std::size_t have = std::count(
+                in_flight.begin(), in_flight.end(), recv_endpoint.ref());
+        if (parked_it != prefetched_.end())
+            have += parked_it->second.size();
+        prefetch_lock.unlock();
+        std::size_t want = (prefetch_depth > 0)
+            ? static_cast<std::size_t>(prefetch_depth) : 1u;
+        for (; have < want; ++have) {
+            client.start_receive(recv_endpoint.ref());
+            in_flight.push_back(recv_endpoint.ref());
+        }
+    }
 
-    // TODO stop and finalise profile event
+    receive_event.message_number = mpp_message.message_number();
+    receive_event.stop();
+    profiler_.record_event(std::move(wait_event));
+    profiler_.record_event(std::move(receive_event));
 
     int expected_message_number = port.get_num_messages(slot);
     // TODO: handle f_init port counts for STATELESS and WEAKLY_STATEFUL
     // components which didn't load a snapshot
-    if (expected_message_number != mpp_message.message_number) {
-        if (expected_message_number - 1 == mpp_message.message_number and
+    if (expected_message_number != mpp_message.message_number()) {
+        if (expected_message_number - 1 == mpp_message.message_number() and
                 port.is_resuming(slot)) {
             if (slot.is_set())
                 logger_.debug("Discarding received message on ", port_name,
@@ -231,7 +1251,7 @@ Message Communicator::receive_message(
         oss << "Received message on " << port_name;
         if (slot.is_set())
             oss << "[" << slot.get() << "]";
-        oss << " with unexpected message number " << mpp_message.message_number;
+        oss << " with unexpected message number " << mpp_message.message_number();
         oss << ". Was expecting " << expected_message_number;
         oss << ". Are you resuming from an inconsistent snapshot?";
         throw std::runtime_error(oss.str());
@@ -243,7 +1263,7 @@ Message Communicator::receive_message(
     else
         logger_.debug("Received message on ", port_name);
 
-    if (is_close_port(message.data())) {
+    if (closing) {
         if (slot.is_set())
             logger_.debug("Port ", port_name, "[", slot.get(), "] is now closed");
         else
@@ -252,6 +1272,319 @@ Message Communicator::receive_message(
     return message;
 }
 
+void Communicator::start_receive(
+        std::string const & port_name, Optional<int> slot) {
+    std::vector<int> slot_list;
+    if (slot.is_set())
+        slot_list.emplace_back(slot.get());
+
+    Endpoint recv_endpoint(get_endpoint_(port_name, slot_list));
+
+    if (!peer_manager_->is_connected(recv_endpoint.port())) {
+        std::ostringstream oss;
+        oss << "Tried to start a receive on port '" << port_name << "',";
+        oss << " which is disconnected.";
+        throw std::runtime_error(oss.str());
+    }
+
+    Reference receiver = recv_endpoint.ref();
+    Endpoint snd_endpoint = peer_manager_->get_peer_endpoints(
+            recv_endpoint.port(), slot_list).at(0);
+    MPPClient & client = get_client_(snd_endpoint.instance());
+
+    instrumentation::TimedLockGuard peer_lock(
+            peer_mutex_(snd_endpoint.instance()));
+    std::unique_lock<std::mutex> prefetch_lock(prefetch_mutex_);
+    auto parked_it = prefetched_.find(receiver);
+    if (parked_it != prefetched_.end() && !parked_it->second.empty())
+        return;
+    auto & in_flight = prefetching_[snd_endpoint.instance()];
+    prefetch_lock.unlock();
+    if (std::find(in_flight.begin(), in_flight.end(), receiver)
+            != in_flight.end())
+        return;
+    client.start_receive(receiver);
+    in_flight.push_back(receiver);
+}
+
+std::vector<Message> Communicator::receive_all(std::string const & port_name) {
+    Port & port = get_port(port_name);
+    if (!port.is_vector()) {
+        std::ostringstream oss;
+        oss << "Tried to receive_all on port '" << port_name << "', which is";
+        oss << " not a vector port. Use receive_message() instead.";
+        throw std::runtime_error(oss.str());
+    }
+    int length = port.get_length();
+
+    // Ask every sender for its slot's message up front, so that the
+    // messages travel concurrently; receive_message() below then picks
+    // the replies up as they come in. Slots for which a message is
+    // already on its way (or parked) are skipped, requesting them again
+    // would desynchronise the pipeline.
+    for (int slot = 0; slot < length; ++slot) {
+        std::vector<int> slot_list({slot});
+        Endpoint recv_endpoint(get_endpoint_(port_name, slot_list));
+        if (!peer_manager_->is_connected(recv_endpoint.port()))
+            continue;
+        start_receive(port_name, slot);
+    }
+
+    std::vector<Message> messages;
+    messages.reserve(length);
+    for (int slot = 0; slot < length; ++slot)
+        messages.push_back(receive_message(port_name, slot));
+    return messages;
+}
+
+/* Fetches up to max_n queued messages for the given receiver.
+ *
+ * This takes any messages that earlier receives parked for the
+ * receiver first, and only if there are none sends a batch request,
+ * finishing any standing prefetch requests ahead of its response as
+ * fetch_message_() does. At least one message is returned; shared
+ * between receive_batch() and forward_batch().
+ */
+std::vector<MPPMessage> Communicator::fetch_batch_(
+        MPPClient & client,
+        Reference const & instance,
+        Reference const & receiver,
+        std::size_t max_n)
+{
+    std::vector<MPPMessage> fetched;
+    fetched.reserve(max_n);
+
+    // see fetch_message_() for why the peer's mutex is held across
+    // the whole fetch
+    instrumentation::TimedLockGuard peer_lock(peer_mutex_(instance));
+
+    // messages that earlier receives parked for us are already
+    // here, take those first
+    std::unique_lock<std::mutex> prefetch_lock(prefetch_mutex_);
+    auto parked_it = prefetched_.find(receiver);
+    if (parked_it != prefetched_.end()) {
+        while (!parked_it->second.empty() && fetched.size() < max_n) {
+            auto parked = std::move(parked_it->second.front());
+            parked_it->second.pop_front();
+            fetched.push_back(take_parked_(parked));
+        }
+    }
+    auto & in_flight = prefetching_[instance];
+    std::size_t standing = std::count(
+            in_flight.begin(), in_flight.end(), receiver);
+    prefetch_lock.unlock();
+
+    if (fetched.empty()) {
+        // Standing prefetch requests are answered before anything
+        // we send now, so only ask the batch for what they won't
+        // deliver. The batch response comes after all of them, so
+        // finish every request ahead of it, keeping our messages
+        // and parking the others as fetch_message_() does.
+        std::size_t from_batch =
+            (max_n > standing) ? max_n - standing : 0u;
+        if (from_batch > 0u)
+            client.start_receive_batch(
+                    receiver, static_cast<int>(from_batch));
+
+        while (!in_flight.empty()) {
+            Reference head(in_flight.front());
+            in_flight.pop_front();
+            DataConstRef message_bytes(client.finish_receive());
+            instrumentation::count(
+                    instrumentation::counters().bytes_received,
+                    message_bytes.size());
+            MPPMessage message = MPPMessage::from_bytes(message_bytes);
+            if (head == receiver && fetched.size() < max_n) {
+                fetched.push_back(std::move(message));
+            }
+            else {
+                park_message_(head, std::move(message));
+            }
+        }
+
+        if (from_batch > 0u) {
+            for (auto & message_bytes : client.finish_receive_batch()) {
+                instrumentation::count(
+                        instrumentation::counters().bytes_received,
+                        message_bytes.size());
+                fetched.push_back(MPPMessage::from_bytes(message_bytes));
+            }
+        }
+    }
+    return fetched;
+}
+
+std::vector<Message> Communicator::receive_batch(
+        std::string const & port_name, int max_messages)
+{
+    logger_.debug(
+            "Waiting for up to ", max_messages, " messages on ", port_name);
+    if (max_messages < 1)
+        max_messages = 1;
+    std::size_t max_n = static_cast<std::size_t>(max_messages);
+
+    Endpoint recv_endpoint(get_endpoint_(port_name, {}));
+
+    if (!peer_manager_->is_connected(recv_endpoint.port())) {
+        std::ostringstream oss;
+        oss << "Tried to receive a batch on port '" << port_name << "',";
+        oss << " which is disconnected.";
+        throw std::runtime_error(oss.str());
+    }
+
+    Port & port = (ports_.count(port_name))
+        ? (ports_.at(port_name)) : muscle_settings_in_.get();
+
+    Reference receiver = recv_endpoint.ref();
+    Endpoint snd_endpoint = peer_manager_->get_peer_endpoints(
+            recv_endpoint.port(), {}).at(0);
+    Reference const & instance = snd_endpoint.instance();
+    MPPClient & client = get_client_(instance);
+
+    ProfileEvent receive_event(ProfileEventType::receive, port, {});
+    ProfileEvent wait_event(ProfileEventType::receive_wait, port, {});
+
+    std::vector<MPPMessage> fetched = fetch_batch_(
+            client, instance, receiver, max_n);
+    wait_event.stop();
+
+    std::vector<Message> messages;
+    messages.reserve(fetched.size());
+    auto & port_ctrs = instrumentation::port_counters(port_name);
+    // one wait covered the whole fetch; the per-message events made
+    // below have zero duration, so don't put those in the histogram
+    instrumentation::record_wait(port_ctrs, static_cast<std::uint64_t>(
+            wait_event.stop_time.nanoseconds
+            - wait_event.start_time.nanoseconds));
+    for (auto & mpp_message : fetched) {
+        instrumentation::count(
+                instrumentation::counters().messages_received);
+        instrumentation::count(port_ctrs.messages_received);
+        instrumentation::count(
+                port_ctrs.bytes_received, mpp_message.encoded_size());
+
+        // when resuming from a weakly consistent snapshot, a port may
+        // discard one already-seen message, see finish_receive_(); in a
+        // batch its replacement is simply the next message
+        if (
+                port.is_resuming({}) &&
+                port.get_num_messages({}) - 1 == mpp_message.message_number())
+        {
+            logger_.debug(
+                    "Discarding received message on ", port_name,
+                    ": resuming from weakly consistent snapshot");
+            port.set_resumed({});
+            continue;
+        }
+
+        if (messages.empty()) {
+            // the first message gets the events covering the fetch
+            messages.push_back(process_message_(
+                    port_name, port, recv_endpoint, snd_endpoint, {}, {},
+                    std::move(mpp_message), client, 1, false,
+                    receive_event, wait_event));
+        }
+        else {
+            // the rest were received along with it, so their wait was
+            // (nearly) free; give them their own events so that there
+            // is still one receive event per message
+            ProfileEvent msg_receive_event(
+                    ProfileEventType::receive, port, {});
+            ProfileEvent msg_wait_event(
+                    ProfileEventType::receive_wait, port, {});
+            msg_wait_event.stop();
+            messages.push_back(process_message_(
+                    port_name, port, recv_endpoint, snd_endpoint, {}, {},
+                    std::move(mpp_message), client, 1, false,
+                    msg_receive_event, msg_wait_event));
+        }
+    }
+
+    // prefetching was suppressed above, a request issued mid-batch
+    // could end up past a close; request the next message now instead,
+    // if the port is still open
+    if (port.is_open())
+        start_receive(port_name);
+
+    return messages;
+}
+
+std::string Communicator::wait_any(
+        std::vector<std::string> const & port_names)
+{
+    logger_.debug(
+            "Waiting for a message on any of ", port_names.size(), " ports");
+
+    struct Candidate_ {
+        std::string const * port_name;
+        ymmsl::Reference receiver;
+        ymmsl::Reference instance;
+        MPPClient * client;
+    };
+
+    std::vector<Candidate_> candidates;
+    candidates.reserve(port_names.size());
+    for (auto const & port_name : port_names) {
+        Endpoint recv_endpoint(get_endpoint_(port_name, {}));
+        if (!peer_manager_->is_connected(recv_endpoint.port())) {
+            std::ostringstream oss;
+            oss << "Tried to wait for a message on port '" << port_name;
+            oss << "', which is disconnected.";
+            throw std::runtime_error(oss.str());
+        }
+        Endpoint snd_endpoint = peer_manager_->get_peer_endpoints(
+                recv_endpoint.port(), {}).at(0);
+        candidates.push_back(Candidate_{
+                &port_name, recv_endpoint.ref(), snd_endpoint.instance(),
+                &get_client_(snd_endpoint.instance())});
+        // make sure each sender has a request to answer; ports whose
+        // message is already parked or on its way are not asked again
+        start_receive(port_name);
+    }
+
+    ProfileEvent wait_event(ProfileEventType::receive_wait);
+
+    while (true) {
+        bool all_pollable = true;
+        for (auto const & candidate : candidates) {
+            if (message_available_(
+                    *candidate.client, candidate.instance,
+                    candidate.receiver))
+            {
+                std::string const & port_name = *candidate.port_name;
+                wait_event.stop();
+                if (ports_.count(port_name))
+                    wait_event.port = ports_.at(port_name);
+                profiler_.record_event(std::move(wait_event));
+                logger_.debug("Message available on ", port_name);
+                return port_name;
+            }
+            if (candidate.client->poll_fd() == -1)
+                all_pollable = false;
+        }
+
+        // Nothing has arrived yet; sleep on all the connections at
+        // once rather than spinning. Clients without a pollable fd are
+        // covered by waking up every millisecond and checking them the
+        // slow way above.
+        std::vector<pollfd> pollfds;
+        pollfds.reserve(candidates.size());
+        for (auto const & candidate : candidates) {
+            int fd = candidate.client->poll_fd();
+            if (fd != -1) {
+                pollfd pfd;
+                pfd.fd = fd;
+                pfd.events = POLLIN;
+                pfd.revents = 0;
+                pollfds.push_back(pfd);
+            }
+        }
+        poll(
+                pollfds.empty() ? nullptr : pollfds.data(), pollfds.size(),
+                all_pollable ? 100 : 1);
+    }
+}
+
 void Communicator::close_port(
         std::string const & port_name, Optional<int> slot) {
     Message message(
@@ -261,12 +1594,28 @@ void Communicator::close_port(
         logger_.debug("Closing port ", port_name, "[", slot.get(), "]");
     else
         logger_.debug("Closing port ", port_name);
-    send_message(port_name, message, slot);
+    send_message(port_name, std::move(message), slot);
+}
+
+void Communicator::close_vector_port(std::string const & port_name) {
+    int length = ports_.at(port_name).get_length();
+    logger_.debug("Closing all ", length, " slots of port ", port_name);
+    send_range(port_name, 0, length,
+            [](int) {
+                return Message(
+                        std::numeric_limits<double>::infinity(),
+                        ClosePort(), Settings());
+            });
 }
 
 void Communicator::shutdown() {
-    for (auto & client : clients_)
-        client.second->close();
+    join_warmup_threads_();
+    stop_decode_threads_();
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex_);
+        for (auto & client : clients_)
+            client.second->close();
+    }
 
     post_office_.wait_for_receivers();
 
@@ -375,8 +1724,29 @@ Port Communicator::settings_in_port_(std::vector<Conduit> const & conduits) cons
     return Port("muscle_settings_in", Operator::F_INIT, false, false, index_.size(), {});
 }
 
+/* Returns the client connected to the given peer, dialling if needed.
+ *
+ * Dialling happens outside the lock, so that connections to different
+ * peers can be set up concurrently; warm_up_connections_() relies on
+ * this. A second thread asking for a peer that is being dialled waits
+ * for the dial to finish rather than making its own connection.
+ */
 MPPClient & Communicator::get_client_(Reference const & instance) {
-    if (clients_.count(instance) == 0) {
+    std::unique_lock<std::mutex> lock(clients_mutex_);
+    for (;;) {
+        auto it = clients_.find(instance);
+        if (it != clients_.end())
+            return *it->second;
+        if (connecting_.count(instance) == 0u)
+            break;
+        clients_changed_.wait(lock);
+    }
+
+    connecting_.insert(instance);
+    lock.unlock();
+
+    std::unique_ptr<MPPClient> client;
+    try {
         auto const & locations = peer_manager_->get_peer_locations(instance);
         std::ostringstream oss;
         oss << "Connecting to peer " << instance << " at [";
@@ -387,13 +1757,290 @@ MPPClient & Communicator::get_client_(Reference const & instance) {
         }
         oss << "]";
         logger_.info(oss.str());
-        clients_[instance] = std::make_unique<MPPClient>(locations);
+        client = std::make_unique<MPPClient>(locations);
+    }
+    catch (...) {
+        lock.lock();
+        connecting_.erase(instance);
+        clients_changed_.notify_all();
+        throw;
+    }
+
+    lock.lock();
+    auto & entry = clients_[instance];
+    entry = std::move(client);
+    connecting_.erase(instance);
+    clients_changed_.notify_all();
+    return *entry;
+}
+
+/* Dials the peers that will send to us, ahead of the first receive.
+ *
+ * Without this, connections are made on first use, and the first
+ * coupling step of a run with many peers absorbs all the handshakes
+ * one after the other. Dialling them here, on a few background
+ * threads, overlaps the handshakes with each other and with the
+ * model's F_INIT compute. The threads go through get_client_(), so a
+ * receive that needs a connection before the warm-up gets to it
+ * simply dials it first, or waits for a dial in progress.
+ *
+ * Only peers on the sending side of our receiving conduits are
+ * dialled; for the conduits we send on, the peer connects to us.
+ */
+void Communicator::warm_up_connections_(
+        std::vector<Conduit> const & conduits,
+        PeerLocations const & peer_locations)
+{
+    std::unordered_set<Reference> sending_kernels;
+    for (auto const & conduit : conduits)
+        if (conduit.receiving_component() == kernel_)
+            sending_kernels.insert(conduit.sending_component());
+
+    auto peers = std::make_shared<std::vector<Reference>>();
+    for (auto const & peer : peer_locations) {
+        auto it = peer.first.cbegin();
+        while (it != peer.first.cend() && it->is_identifier())
+            ++it;
+        if (sending_kernels.count(Reference(peer.first.cbegin(), it)) > 0u)
+            peers->push_back(peer.first);
+    }
+    if (peers->empty())
+        return;
+
+    std::size_t num_threads = std::min<std::size_t>(peers->size(), 8u);
+    auto next_peer = std::make_shared<std::atomic<std::size_t>>(0u);
+    for (std::size_t i = 0u; i < num_threads; ++i)
+        warmup_threads_.emplace_back([this, peers, next_peer]() {
+                for (;;) {
+                    std::size_t cur = next_peer->fetch_add(1u);
+                    if (cur >= peers->size())
+                        break;
+                    try {
+                        get_client_((*peers)[cur]);
+                    }
+                    catch (std::exception const & e) {
+                        // the first receive will retry and report this
+                        // properly if it persists
+                        logger_.debug(
+                                "Warming up the connection to ",
+                                (*peers)[cur], " failed: ", e.what());
+                    }
+                }
+        });
+}
+
+void Communicator::join_warmup_threads_() {
+    for (auto & thread : warmup_threads_)
+        thread.join();
+    warmup_threads_.clear();
+}
+
+/* Returns the mutex serialising traffic to the given peer.
+ *
+ * Created on first use; the map holds its mutexes by pointer, so the
+ * returned reference stays valid as the map grows.
+ */
+std::mutex & Communicator::peer_mutex_(Reference const & instance) {
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    auto & mutex = peer_mutexes_[instance];
+    if (!mutex)
+        mutex.reset(new std::mutex());
+    return *mutex;
+}
+
+/* Obtains the next message for the given receiver from the given peer.
+ *
+ * If receive_message() prefetched this message on the previous receive,
+ * then it is picked up (or, if it arrived while we were receiving for
+ * another port, taken from the cache) rather than requested anew. The
+ * peer answers requests in the order in which they were sent, so any
+ * prefetched messages for other receivers encountered along the way are
+ * parked for when those receivers are next received on.
+ */
+MPPMessage Communicator::fetch_message_(
+        MPPClient & client, Reference const & instance,
+        Reference const & receiver)
+{
+    // Hold the peer's mutex across the whole fetch: in_flight below
+    // pairs responses with receivers by their order on the connection,
+    // and a second thread fetching from the same peer halfway through
+    // would break that pairing. It also keeps calls on the client from
+    // overlapping, which they must not, see MPPClient.
+    instrumentation::TimedLockGuard peer_lock(peer_mutex_(instance));
+
+    std::unique_lock<std::mutex> prefetch_lock(prefetch_mutex_);
+    auto it = prefetched_.find(receiver);
+    if (it != prefetched_.end() && !it->second.empty()) {
+        auto parked = std::move(it->second.front());
+        it->second.pop_front();
+        prefetch_lock.unlock();
+        return take_parked_(parked);
     }
-    return *clients_.at(instance);
+
+    // the reference remains valid if the map grows, and the deque is
+    // only modified under the peer's mutex, which we hold
+    auto & in_flight = prefetching_[instance];
+    prefetch_lock.unlock();
+
+    while (!in_flight.empty()) {
+        Reference head(in_flight.front());
+        in_flight.pop_front();
+        DataConstRef message_bytes(client.finish_receive());
+        instrumentation::count(
+                instrumentation::counters().bytes_received,
+                message_bytes.size());
+        MPPMessage message = MPPMessage::from_bytes(message_bytes);
+        if (head == receiver)
+            return message;
+        park_message_(head, std::move(message));
+    }
+
+    DataConstRef message_bytes(client.receive(receiver));
+    instrumentation::count(
+            instrumentation::counters().bytes_received, message_bytes.size());
+    return MPPMessage::from_bytes(message_bytes);
+}
+
+/* Returns whether a message for the given receiver has arrived.
+ *
+ * A request for the message must be in flight, or the message already
+ * parked; see wait_any(). Responses that have arrived ahead of it for
+ * other receivers on the same connection are read and parked along the
+ * way, as is the receiver's own message when it is in, so this does not
+ * block and a subsequent fetch_message_() finds the message in the
+ * cache. A transport that cannot check for incoming data reports every
+ * response as started, in which case this blocks until the message is
+ * in after all.
+ */
+bool Communicator::message_available_(
+        MPPClient & client, Reference const & instance,
+        Reference const & receiver)
+{
+    // see fetch_message_() for why the peer's mutex is held across the
+    // whole check
+    instrumentation::TimedLockGuard peer_lock(peer_mutex_(instance));
+
+    std::unique_lock<std::mutex> prefetch_lock(prefetch_mutex_);
+    auto it = prefetched_.find(receiver);
+    if (it != prefetched_.end() && !it->second.empty())
+        return true;
+
+    auto & in_flight = prefetching_[instance];
+    prefetch_lock.unlock();
+
+    while (!in_flight.empty() && client.poll_receive()) {
+        Reference head(in_flight.front());
+        in_flight.pop_front();
+        DataConstRef message_bytes(client.finish_receive());
+        instrumentation::count(
+                instrumentation::counters().bytes_received,
+                message_bytes.size());
+        MPPMessage message = MPPMessage::from_bytes(message_bytes);
+        park_message_(head, std::move(message));
+        if (head == receiver)
+            return true;
+    }
+    return false;
+}
+
+/* Parks a prefetched message until its receiver asks for it.
+ *
+ * If decode workers are running, the message is also handed to them,
+ * so that it is decoded in the background while the model computes
+ * rather than on the model's thread inside the eventual receive.
+ */
+void Communicator::park_message_(
+        Reference const & receiver, MPPMessage && message)
+{
+    auto parked = std::make_shared<ParkedMessage_>(std::move(message));
+    {
+        std::lock_guard<std::mutex> prefetch_lock(prefetch_mutex_);
+        prefetched_[receiver].push_back(parked);
+    }
+    if (!decode_threads_.empty()) {
+        std::lock_guard<std::mutex> decode_lock(decode_mutex_);
+        decode_queue_.push_back(std::move(parked));
+        decode_available_.notify_one();
+    }
+}
+
+/* Takes a message that park_message_() parked earlier.
+ *
+ * The entry's mutex is only ever contended by the decode worker that
+ * is pre-decoding this message, so at worst this waits for that one
+ * decode to finish; marking the entry taken tells a worker that has
+ * not started yet to leave it alone.
+ */
+MPPMessage Communicator::take_parked_(
+        std::shared_ptr<ParkedMessage_> const & parked)
+{
+    std::lock_guard<std::mutex> lock(parked->mutex);
+    parked->taken = true;
+    return std::move(parked->message);
+}
+
+/* Runs a decode worker, see the constructor.
+ *
+ * Parked messages are stored in wire form, and decoded only when their
+ * receiver finally asks for them. Each worker takes parked messages
+ * off the queue and touches their lazily decoded parts, so that the
+ * envelope decode and any decompression happen here, overlapped with
+ * the model's computation. Messages are parked per receiver in arrival
+ * order and stay in place while being decoded, so the order in which
+ * receives see them does not change. A decode error is swallowed: the
+ * receiving thread runs into the same error when it reads the message,
+ * and is the one that can report it.
+ */
+void Communicator::decode_loop_() {
+    for (;;) {
+        std::shared_ptr<ParkedMessage_> parked;
+        {
+            std::unique_lock<std::mutex> decode_lock(decode_mutex_);
+            decode_available_.wait(decode_lock, [this]() {
+                    return decode_stop_ || !decode_queue_.empty(); });
+            if (decode_stop_)
+                return;
+            parked = std::move(decode_queue_.front());
+            decode_queue_.pop_front();
+        }
+
+        std::lock_guard<std::mutex> lock(parked->mutex);
+        if (parked->taken)
+            continue;
+        try {
+            parked->message.data();
+            parked->message.settings_overlay();
+            parked->message.is_close_port();
+        }
+        catch (...) {}
+    }
+}
+
+/* Stops the decode workers, if any, and waits for them to exit. */
+void Communicator::stop_decode_threads_() {
+    if (decode_threads_.empty())
+        return;
+    {
+        std::lock_guard<std::mutex> decode_lock(decode_mutex_);
+        decode_stop_ = true;
+    }
+    decode_available_.notify_all();
+    for (auto & decode_thread : decode_threads_)
+        decode_thread.join();
+    decode_threads_.clear();
 }
 
 Endpoint Communicator::get_endpoint_(
         std::string const & port_name, std::vector<int> const & slot) const {
+    // A declared port's name was validated when the port was set up,
+    // so the Identifier stored with it can be reused; re-validating
+    // the name character by character on every send and receive is
+    // wasted work. Only names not found there, like
+    // muscle_settings_in, take the validating path below.
+    auto it = ports_.find(port_name);
+    if (it != ports_.end())
+        return Endpoint(kernel_, index_, it->second.name, slot);
+
     try {
         Identifier port(port_name);
         return Endpoint(kernel_, index_, port, slot);
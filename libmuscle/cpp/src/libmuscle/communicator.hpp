@@ -5,20 +5,33 @@
 #else
 
 #include <libmuscle/data.hpp>
+#include <libmuscle/instrumentation.hpp>
 #include <libmuscle/logger.hpp>
 #include <libmuscle/mcp/transport_server.hpp>
 #include <libmuscle/message.hpp>
 #include <libmuscle/mpp_client.hpp>
+#include <libmuscle/mpp_message.hpp>
 #include <libmuscle/peer_manager.hpp>
 #include <libmuscle/port.hpp>
+#include <libmuscle/port_handle.hpp>
 #include <libmuscle/ports_description.hpp>
 #include <libmuscle/post_office.hpp>
+#include <libmuscle/profiler.hpp>
 #include <libmuscle/util.hpp>
 
 #include <ymmsl/ymmsl.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 
@@ -29,6 +42,13 @@ namespace libmuscle { namespace impl {
  * This class is the mailroom for an instance that uses MUSCLE3. It manages
  * the sending and receiving of messages, although it leaves the actual data
  * transmission to various protocol-specific servers and clients.
+ *
+ * Once set up, messages may be sent and received from different threads
+ * concurrently, as long as each port (or each slot of a vector port) is
+ * driven by one thread at a time; the shared bookkeeping is synchronised
+ * internally. Traffic to a given peer instance is serialised, since
+ * responses on a connection are paired with requests by their order; see
+ * fetch_message_(). Setting up and shutting down are not thread-safe.
  */
 class Communicator {
     public:
@@ -43,14 +63,22 @@ class Communicator {
          * @param declared_ports The declared ports for this instance.
          * @param logger The logger for this instance.
          * @param profiler The profiler to use for recording sends and receives.
+         * @param preferred_tcp_port TCP port to try to listen on, or 0 for
+         *      an ephemeral port; see TcpTransportServer.
          */
-        // TODO: use actual Profiler
         Communicator(
                 ymmsl::Reference const & kernel,
                 std::vector<int> const & index,
                 Optional<PortsDescription> const & declared_ports,
-                Logger & logger, int profiler);
+                Logger & logger, Profiler & profiler,
+                int preferred_tcp_port = 0);
 
+        /** Destruct a Communicator.
+         *
+         * Waits for any connection warm-up still in progress, see
+         * connect().
+         */
+        ~Communicator();
 
         /** Returns a list of locations that we can be reached at.
          *
@@ -82,6 +110,26 @@ class Communicator {
                 PeerDims const & peer_dims,
                 PeerLocations const & peer_locations);
 
+        /** Connect this Communicator using cached peer information.
+         *
+         * As connect(), but for peer information saved by a previous
+         * run rather than freshly obtained from the manager, so it may
+         * be stale. All peers are dialled immediately to check that
+         * they are actually there; if any of them cannot be reached,
+         * this returns false, and the caller must obtain current peer
+         * information and call connect() with it. See Instance for the
+         * cache itself.
+         *
+         * @param conduits As connect().
+         * @param peer_dims As connect().
+         * @param peer_locations As connect().
+         * @return true iff all peers could be reached.
+         */
+        bool try_connect_cached(
+                std::vector<ymmsl::Conduit> const & conduits,
+                PeerDims const & peer_dims,
+                PeerLocations const & peer_locations);
+
         /** Returns true iff muscle_settings_in is connected.
          */
         bool settings_in_connected() const;
@@ -93,6 +141,42 @@ class Communicator {
          */
         PortsDescription list_ports() const;
 
+        /** Get message counts for all ports on the communicator.
+         *
+         * @return A map indexed by port name containing the number of
+         *      messages sent or received on each slot of that port.
+         */
+        std::unordered_map<std::string, std::vector<int>>
+        get_message_counts() const;
+
+        /** Restore message counts on all ports.
+         *
+         * This is used when resuming from a snapshot.
+         *
+         * @param port_message_counts Message counts as returned previously
+         *      by get_message_counts().
+         * @throws std::runtime_error if the counts refer to an unknown port.
+         */
+        void restore_message_counts(
+                std::unordered_map<std::string, std::vector<int>> const &
+                    port_message_counts);
+
+        /** Set the wallclock time until which checkpoints were considered.
+         *
+         * This is attached to outgoing messages, so that the receiver can
+         * keep its elapsed walltime in step with ours for the purpose of
+         * wallclock time checkpoints.
+         *
+         * @param checkpoints_considered_until Elapsed walltime up to which
+         *      checkpoints were considered.
+         */
+        void set_checkpoints_considered_until(
+                double checkpoints_considered_until);
+
+        /** Return the highest saved_until received from a peer so far.
+         */
+        double received_saved_until() const;
+
         /** Returns whether a port with the given name exists.
          *
          * @param port_name Port name to check.
@@ -111,6 +195,20 @@ class Communicator {
          */
         Port & get_port(std::string const & port_name);
 
+        /** Returns a handle for the port with the given name.
+         *
+         * The handle pre-resolves the port and its peer endpoints, so
+         * that the send_message() and receive_message() overloads that
+         * take one skip those lookups on every call. Only call this
+         * after connect().
+         *
+         * @param port_name The name of the port.
+         *
+         * @return A handle for the port, valid for the lifetime of this
+         *      Communicator.
+         */
+        PortHandle get_port_handle(std::string const & port_name);
+
         /** Send a message and settings to the outside world.
          *
          * Sending is non-blocking, a copy of the message will be made and
@@ -121,11 +219,188 @@ class Communicator {
          * @param port_name The port on which this message is to be sent.
          * @param message The message to send.
          * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
          */
         void send_message(
                 std::string const & port_name,
                 Message const & message,
-                Optional<int> slot = {});
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message and settings to the outside world.
+         *
+         * As send_message(), but taking ownership of the message, so
+         * that its payload is moved into the on-the-wire message rather
+         * than copied.
+         *
+         * @param port_name The port on which this message is to be sent.
+         * @param message The message to send.
+         * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         */
+        void send_message(
+                std::string const & port_name,
+                Message && message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message and settings to the outside world, asynchronously.
+         *
+         * As send_message(), but the encoding of the message, which for
+         * large messages dominates the cost of sending, is done on a
+         * background thread. The returned future becomes ready once the
+         * message has been handed to the post office; the message's data
+         * must not be modified until then.
+         *
+         * @param port_name The port on which this message is to be sent.
+         * @param message The message to send.
+         * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         *
+         * @return A future that completes when the message has been sent.
+         */
+        std::future<void> send_message_async(
+                std::string const & port_name,
+                Message const & message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message and settings to the outside world, asynchronously.
+         *
+         * As send_message_async(), but taking ownership of the message,
+         * so that its payload is moved into the on-the-wire message
+         * rather than copied.
+         *
+         * @param port_name The port on which this message is to be sent.
+         * @param message The message to send.
+         * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         *
+         * @return A future that completes when the message has been sent.
+         */
+        std::future<void> send_message_async(
+                std::string const & port_name,
+                Message && message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message on each slot in a contiguous range.
+         *
+         * This is equivalent to calling send_message() once per slot
+         * in [first_slot, last_slot), with the message for each slot
+         * produced by make_message, but the whole fan-out is done in
+         * one loop over the precomputed endpoint table and the encoded
+         * messages are deposited as a single batch.
+         *
+         * @param port_name The port on which to send.
+         * @param first_slot The first slot to send on.
+         * @param last_slot One past the last slot to send on.
+         * @param make_message Called once per slot, in order, to
+         *      produce the message for that slot.
+         * @param codec Codec to compress the messages' data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         */
+        void send_range(
+                std::string const & port_name,
+                int first_slot, int last_slot,
+                std::function<Message(int)> const & make_message,
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message and settings to the outside world.
+         *
+         * As send_message(), but taking a handle obtained from
+         * get_port_handle() instead of a port name.
+         *
+         * @param port_handle The port on which this message is to be sent.
+         * @param message The message to send.
+         * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         */
+        void send_message(
+                PortHandle const & port_handle,
+                Message const & message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message and settings to the outside world.
+         *
+         * As the above, but taking ownership of the message, so that
+         * its payload is moved into the on-the-wire message rather than
+         * copied.
+         *
+         * @param port_handle The port on which this message is to be sent.
+         * @param message The message to send.
+         * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         */
+        void send_message(
+                PortHandle const & port_handle,
+                Message && message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message and settings to the outside world, asynchronously.
+         *
+         * As send_message_async(), but taking a handle obtained from
+         * get_port_handle() instead of a port name.
+         *
+         * @param port_handle The port on which this message is to be sent.
+         * @param message The message to send.
+         * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         *
+         * @return A future that completes when the message has been sent.
+         */
+        std::future<void> send_message_async(
+                PortHandle const & port_handle,
+                Message const & message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        /** Send a message and settings to the outside world, asynchronously.
+         *
+         * As the above, but taking ownership of the message, so that
+         * its payload is moved into the on-the-wire message rather than
+         * copied.
+         *
+         * @param port_handle The port on which this message is to be sent.
+         * @param message The message to send.
+         * @param slot The slot to send the message on.
+         * @param codec Codec to compress the message's data with.
+         * @param delta_interval Delta-encode grid payloads, sending a
+         *      keyframe every this many messages; 0 to disable.
+         *
+         * @return A future that completes when the message has been sent.
+         */
+        std::future<void> send_message_async(
+                PortHandle const & port_handle,
+                Message && message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
 
         /** Receive a message and attached settings overlay.
          *
@@ -143,19 +418,204 @@ class Communicator {
          * @param port_name The endpoint on which a message is to be received.
          * @param slot The slot to receive the message on, if any.
          * @param default_msg A message to return if the port is not connected.
+         * @param timeout Seconds to wait for the message before giving up,
+         *      if any. Ignored by transports that cannot poll, see
+         *      MPPClient::set_receive_timeout().
+         * @param prefetch_depth Number of requests for future messages
+         *      to leave standing on this port after this receive. With
+         *      the default of one, the next message is requested as
+         *      soon as this one is in, hiding the round trip behind the
+         *      model's compute time; a deeper pipeline lets a fast
+         *      conduit deliver continuously, at more than one message
+         *      per round trip, with the extra messages buffered on this
+         *      side until they are received.
          *
          * @return The received message, with message.settings holding the
          *      settings overlay. The setings attribute is guaranteed to be set.
          *
          * @throws std::runtime_error if no default was given and the port is
          *      not connected.
+         * @throws ReceiveTimeoutError if a timeout was given and no message
+         *      arrived within it.
          */
         Message receive_message(
                 std::string const & port_name,
                 Optional<int> slot = {},
-                Optional<Message> const & default_msg = {}
+                Optional<Message> const & default_msg = {},
+                Optional<double> timeout = {},
+                int prefetch_depth = 1
+                );
+
+        /** Receive a message and attached settings overlay.
+         *
+         * As receive_message(), but taking a handle obtained from
+         * get_port_handle() instead of a port name.
+         *
+         * @param port_handle The endpoint on which a message is to be
+         *      received.
+         * @param slot The slot to receive the message on, if any.
+         * @param default_msg A message to return if the port is not connected.
+         *
+         * @return The received message, with message.settings holding the
+         *      settings overlay. The setings attribute is guaranteed to be set.
+         *
+         * @throws std::runtime_error if no default was given and the port is
+         *      not connected.
+         */
+        Message receive_message(
+                PortHandle const & port_handle,
+                Optional<int> slot = {},
+                Optional<Message> const & default_msg = {},
+                int prefetch_depth = 1
                 );
 
+        /** Receive a message on one port and send it on another.
+         *
+         * This is for relay components that pass payloads through
+         * unchanged. The message is not decoded: only the envelope
+         * header is read (and rewritten for the new receivers), while
+         * the data payload and the settings overlay are passed along as
+         * the received bytes, without being unpacked, decompressed or
+         * re-encoded.
+         *
+         * A received ClosePort message is forwarded too, and closes the
+         * receiving port as in receive_message().
+         *
+         * @param receiving_port_name The port to receive the message on.
+         * @param sending_port_name The port to send the message on.
+         * @param slot The slot to receive and send on, if any.
+         *
+         * @return The timestamp of the forwarded message.
+         *
+         * @throws std::runtime_error if the receiving port is not
+         *      connected.
+         */
+        double forward_message(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                Optional<int> slot = {}
+                );
+
+        /** Forwards all queued messages on a port in one round trip.
+         *
+         * This blocks until at least one message is available, like
+         * forward_message(), but asks the sender for any further
+         * messages it already has queued for the receiving port as
+         * well, up to max_messages in total, and sends them all on as
+         * forward_message() would, without decoding them. A relay in a
+         * deep fan-in tree drains a burst of messages at one round
+         * trip per hop this way, rather than one per message, so the
+         * burst traverses the tree that much sooner.
+         *
+         * A received ClosePort message is forwarded and closes the
+         * receiving port; the Python implementation does not understand
+         * batch requests, so use this only if the sending peer is known
+         * to run libmuscle C++.
+         *
+         * @param receiving_port_name The port to receive messages on.
+         *      Must be a connected scalar port.
+         * @param sending_port_name The port to send the messages on.
+         * @param max_messages Maximum number of messages to forward.
+         *
+         * @return The timestamps of the forwarded messages, at least
+         *      one, in send order.
+         *
+         * @throws std::runtime_error if the receiving port is not
+         *      connected.
+         */
+        std::vector<double> forward_batch(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                int max_messages);
+
+        /** Requests a message on the given port without waiting for it.
+         *
+         * This sends the request for the message to the sender and
+         * returns immediately; a subsequent receive on the same port
+         * and slot picks the response up. Starting the receives for
+         * many ports or slots up front overlaps their transfers,
+         * without needing a thread for each pending receive. If a
+         * request for this port and slot is already in flight, e.g.
+         * because the previous receive prefetched the next message,
+         * then this does nothing.
+         *
+         * @param port_name The port on which a message is expected.
+         * @param slot The slot to receive on, if any.
+         *
+         * @throws std::runtime_error if the port is not connected.
+         */
+        void start_receive(
+                std::string const & port_name, Optional<int> slot = {});
+
+        /** Receives a message on every slot of a vector port.
+         *
+         * This requests the messages for all slots from their senders up
+         * front, so that they are transferred concurrently rather than
+         * one blocking round trip at a time, then receives them in slot
+         * order.
+         *
+         * @param port_name The name of the vector port on which to receive.
+         *
+         * @return The received messages, indexed by slot.
+         *
+         * @throws std::runtime_error if the port is not a vector port, or
+         *      if a slot's peer is disconnected.
+         */
+        std::vector<Message> receive_all(std::string const & port_name);
+
+        /** Receives all queued messages on a port in one round trip.
+         *
+         * This blocks until at least one message is available, like
+         * receive_message(), but asks the sender for any further
+         * messages it already has queued for this port as well, up to
+         * max_messages in total, and returns them all. A consumer that
+         * has fallen behind a fast producer catches up at one round
+         * trip per batch this way, rather than one per message.
+         *
+         * The messages are returned in the order in which they were
+         * sent, each processed exactly as receive_message() would have:
+         * message numbers are checked and counted, and a close-port
+         * message closes the port, after which no further messages are
+         * returned. The Python implementation does not understand batch
+         * requests, so use this only if the peer is known to run
+         * libmuscle C++.
+         *
+         * @param port_name The port on which to receive. Must be a
+         *      connected scalar port.
+         * @param max_messages Maximum number of messages to return.
+         *
+         * @return The received messages, at least one, in send order.
+         *
+         * @throws std::runtime_error if the port is not connected.
+         */
+        std::vector<Message> receive_batch(
+                std::string const & port_name, int max_messages);
+
+        /** Waits until a message is available on any of the given ports.
+         *
+         * This requests the next message on each of the ports from its
+         * sender, unless a request is already in flight, then waits on
+         * all of the underlying connections at once and returns the
+         * name of a port whose message has arrived. The message itself
+         * is parked, so the subsequent receive on that port picks it up
+         * without waiting. A component coupled to several peers can
+         * thus process messages in the order in which they arrive,
+         * instead of stalling on the slowest peer in a fixed receive
+         * order.
+         *
+         * All ports must be connected scalar ports. Peers reached
+         * through a transport that cannot be polled (e.g. MPI) are
+         * waited on in turn, so with such a peer in the set this may
+         * block on it while another port's message is already in.
+         *
+         * @param port_names The names of the ports to wait on.
+         *
+         * @return The name of a port on which a message is available.
+         *
+         * @throws std::runtime_error if a port is disconnected.
+         */
+        std::string wait_any(std::vector<std::string> const & port_names);
+
         /** Closes the given port.
          *
          * This signals to any connected instance that no more messages will
@@ -166,6 +626,17 @@ class Communicator {
          */
         void close_port(std::string const & port_name, Optional<int> slot = {});
 
+        /** Closes all slots of the given vector port.
+         *
+         * As close_port(), but closing every slot at once. The close
+         * messages are encoded in one loop and handed to the post office
+         * as a single batch, rather than one deposit per slot, which
+         * matters at teardown for wide ports.
+         *
+         * @param port_name The name of the vector port to close.
+         */
+        void close_vector_port(std::string const & port_name);
+
         /** Shuts down the Communicator, closing connections.
          */
         void shutdown();
@@ -173,12 +644,111 @@ class Communicator {
     private:
         using Ports_ = std::unordered_map<std::string, Port>;
 
+        // A prefetched message parked for a later receive. A decode
+        // worker pre-decodes it in the background, holding the entry's
+        // mutex while it does; the receiver takes the message under the
+        // same mutex, see decode_loop_() and take_parked_().
+        struct ParkedMessage_ {
+            explicit ParkedMessage_(MPPMessage && message_)
+                : message(std::move(message_))
+            {}
+
+            MPPMessage message;
+            std::mutex mutex;
+            bool taken = false;     // set once the receiver took it
+        };
+
         ymmsl::Reference instance_id_() const;
         Ports_ ports_from_declared_();
         Ports_ ports_from_conduits_(
                 std::vector<ymmsl::Conduit> const & conduits) const;
         Port settings_in_port_(std::vector<ymmsl::Conduit> const & conduits) const;
         MPPClient & get_client_(ymmsl::Reference const & instance);
+        std::mutex & peer_mutex_(ymmsl::Reference const & instance);
+        void warm_up_connections_(
+                std::vector<ymmsl::Conduit> const & conduits,
+                PeerLocations const & peer_locations);
+        void join_warmup_threads_();
+
+        MPPMessage fetch_message_(
+                MPPClient & client,
+                ymmsl::Reference const & instance,
+                ymmsl::Reference const & receiver);
+
+        bool message_available_(
+                MPPClient & client,
+                ymmsl::Reference const & instance,
+                ymmsl::Reference const & receiver);
+
+        std::vector<MPPMessage> fetch_batch_(
+                MPPClient & client,
+                ymmsl::Reference const & instance,
+                ymmsl::Reference const & receiver,
+                std::size_t max_n);
+
+        void park_message_(
+                ymmsl::Reference const & receiver, MPPMessage && message);
+
+        MPPMessage take_parked_(
+                std::shared_ptr<ParkedMessage_> const & parked);
+
+        void decode_loop_();
+        void stop_decode_threads_();
+
+        std::vector<std::pair<ymmsl::Reference, MPPMessage>> make_mpp_messages_(
+                std::string const & port_name,
+                Message && message,
+                Optional<int> slot,
+                int delta_interval);
+
+        std::vector<std::pair<ymmsl::Reference, MPPMessage>> make_mpp_messages_(
+                PortHandle const & port_handle,
+                Message && message,
+                Optional<int> slot,
+                int delta_interval);
+
+        std::vector<std::pair<ymmsl::Reference, MPPMessage>> build_mpp_messages_(
+                Port & port,
+                Endpoint const & snd_endpoint,
+                std::vector<Endpoint> const & recv_endpoints,
+                Message && message,
+                Optional<int> slot,
+                int delta_interval);
+
+        DataConstRef apply_delta_(
+                ymmsl::Reference const & receiver,
+                DataConstRef const & payload,
+                int delta_interval, int message_number,
+                Delta & delta);
+
+        Message finish_receive_(
+                std::string const & port_name,
+                Port & port,
+                Endpoint const & recv_endpoint,
+                Endpoint const & snd_endpoint,
+                Optional<int> slot,
+                Optional<Message> const & default_msg,
+                Optional<double> timeout = {},
+                int prefetch_depth = 1);
+
+        Message process_message_(
+                std::string const & port_name,
+                Port & port,
+                Endpoint const & recv_endpoint,
+                Endpoint const & snd_endpoint,
+                Optional<int> slot,
+                Optional<Message> const & default_msg,
+                MPPMessage && mpp_message,
+                MPPClient & client,
+                int prefetch_depth,
+                bool prefetch,
+                ProfileEvent & receive_event,
+                ProfileEvent & wait_event);
+
+        void encode_and_deposit_(
+                std::vector<std::pair<ymmsl::Reference, MPPMessage>> && messages,
+                Codec codec,
+                instrumentation::PortCounters & port_ctrs);
 
         Endpoint get_endpoint_(
                 std::string const & port_name,
@@ -193,13 +763,72 @@ class Communicator {
         Optional<PortsDescription> declared_ports_;
         PostOffice post_office_;
         Logger & logger_;
-        int profiler_;
+        Profiler & profiler_;
         std::vector<std::unique_ptr<mcp::TransportServer>> servers_;
         std::unordered_map<ymmsl::Reference, std::unique_ptr<MPPClient>> clients_;
+        // protects clients_, connecting_ and peer_mutexes_
+        mutable std::mutex clients_mutex_;
+        // peers a connection is being dialled for right now; dialling
+        // happens outside the lock so that connections to different
+        // peers are set up in parallel, see get_client_()
+        std::unordered_set<ymmsl::Reference> connecting_;
+        // signals changes to clients_ and connecting_
+        std::condition_variable clients_changed_;
+        // background threads dialling peers ahead of first use, see
+        // warm_up_connections_()
+        std::vector<std::thread> warmup_threads_;
+        // per peer instance, the mutex serialising traffic to it, held
+        // by pointer so that references stay valid as the map grows
+        std::unordered_map<ymmsl::Reference, std::unique_ptr<std::mutex>>
+                peer_mutexes_;
         Ports_ ports_;
-        std::unique_ptr<PeerManager> peer_manager_;
+        // the current peer information, as an immutable snapshot;
+        // queries on it are plain reads, and reconnecting publishes a
+        // new snapshot instead of modifying it, see connect()
+        std::shared_ptr<PeerManager const> peer_manager_;
         Optional<Port> muscle_settings_in_;
 
+        // receivers with a prefetch request in flight, per peer
+        // instance, in the order in which the requests were sent
+        std::unordered_map<ymmsl::Reference, std::deque<ymmsl::Reference>>
+                prefetching_;
+        // prefetched messages that arrived for another receiver, parked
+        // until that receiver is next received on; a deep prefetch can
+        // park several per receiver, in arrival order
+        std::unordered_map<
+                ymmsl::Reference,
+                std::deque<std::shared_ptr<ParkedMessage_>>>
+                prefetched_;
+        // protects the two maps above; their deques are only modified
+        // under the owning peer's mutex, see fetch_message_()
+        std::mutex prefetch_mutex_;
+
+        // decode workers that pre-decode parked messages in the
+        // background, and the queue feeding them, see decode_loop_();
+        // there are no workers unless MUSCLE_DECODE_THREADS is set
+        std::vector<std::thread> decode_threads_;
+        std::deque<std::shared_ptr<ParkedMessage_>> decode_queue_;
+        std::condition_variable decode_available_;
+        bool decode_stop_;
+        std::mutex decode_mutex_;   // protects the queue and flag above
+
+        // cached wire form of the settings overlay, reused as long as
+        // the overlay's generation does not change
+        std::unique_ptr<Data> overlay_cache_;
+        std::size_t overlay_generation_;
+        std::mutex overlay_mutex_;      // protects the two members above
+
+        // per receiver, the last complete grid payload sent or received
+        // on a delta-encoded conduit, see apply_delta_()
+        std::unordered_map<ymmsl::Reference, DataConstRef> delta_sent_;
+        std::unordered_map<ymmsl::Reference, DataConstRef> delta_received_;
+        std::mutex delta_mutex_;        // protects the two maps above
+
+        // walltime checkpoint bookkeeping, see the setter above; atomic
+        // so that concurrent sends and receives can update them
+        std::atomic<double> checkpoints_considered_until_;
+        std::atomic<double> received_saved_until_;
+
         friend class TestCommunicator;
 };
 
@@ -0,0 +1,99 @@
+#include <libmuscle/compression.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#ifdef MUSCLE_ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+
+namespace {
+
+#ifdef MUSCLE_ENABLE_ZSTD
+
+libmuscle::impl::Data compress_zstd_(char const * data, std::size_t length) {
+    std::size_t max_size = ZSTD_compressBound(length);
+    std::vector<char> buf(max_size);
+    std::size_t size = ZSTD_compress(buf.data(), max_size, data, length, 3);
+    if (ZSTD_isError(size))
+        throw std::runtime_error(
+                std::string("Zstd compression failed: ")
+                + ZSTD_getErrorName(size));
+    // byte_array(ptr, size) is a non-owning view, so copy out of the
+    // temporary buffer into an owned one
+    auto result = libmuscle::impl::Data::byte_array(size);
+    memcpy(result.as_byte_array(), buf.data(), size);
+    return result;
+}
+
+libmuscle::impl::Data decompress_zstd_(char const * data, std::size_t length) {
+    unsigned long long content_size = ZSTD_getFrameContentLength(data, length);
+    if (
+            (content_size == ZSTD_CONTENTSIZE_UNKNOWN) ||
+            (content_size == ZSTD_CONTENTSIZE_ERROR))
+        throw std::runtime_error(
+                "Zstd decompression failed: invalid compressed data");
+    auto result = libmuscle::impl::Data::byte_array(content_size);
+    std::size_t size = ZSTD_decompress(
+            result.as_byte_array(), content_size, data, length);
+    if (ZSTD_isError(size))
+        throw std::runtime_error(
+                std::string("Zstd decompression failed: ")
+                + ZSTD_getErrorName(size));
+    return result;
+}
+
+#else
+
+[[noreturn]] void zstd_unavailable_() {
+    throw std::runtime_error(
+            "The zstd codec was requested, but MUSCLE3 was built without"
+            " Zstd support. Rebuild with MUSCLE_ENABLE_ZSTD defined and"
+            " libzstd available to use it.");
+}
+
+libmuscle::impl::Data compress_zstd_(char const *, std::size_t) {
+    zstd_unavailable_();
+}
+
+libmuscle::impl::Data decompress_zstd_(char const *, std::size_t) {
+    zstd_unavailable_();
+}
+
+#endif
+
+}
+
+
+namespace libmuscle { namespace impl {
+
+Codec codec_from_string(std::string const & name) {
+    if (name == "none")
+        return Codec::none;
+    if (name == "zstd")
+        return Codec::zstd;
+    throw std::runtime_error(
+            "Unknown codec '" + name + "', expected 'none' or 'zstd'");
+}
+
+Data compress(char const * data, std::size_t length, Codec codec) {
+    switch (codec) {
+        case Codec::zstd:
+            return compress_zstd_(data, length);
+        default:
+            throw std::runtime_error("Cannot compress with codec 'none'");
+    }
+}
+
+Data decompress(char const * data, std::size_t length, Codec codec) {
+    switch (codec) {
+        case Codec::zstd:
+            return decompress_zstd_(data, length);
+        default:
+            throw std::runtime_error("Cannot decompress with codec 'none'");
+    }
+}
+
+} }
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <libmuscle/data.hpp>
+
+#include <string>
+
+
+namespace libmuscle { namespace impl {
+
+/** Compression codecs for the data payload of MPP messages.
+ *
+ * The numerical values are carried inside encoded messages, so they
+ * must never be changed or reused.
+ */
+enum class Codec {
+    none = 0,
+    zstd = 1
+};
+
+/** Converts a codec name, as used in settings, to a Codec.
+ *
+ * @param name The name of the codec, either "none" or "zstd".
+ *
+ * @return The corresponding codec.
+ *
+ * @throws std::runtime_error if the name does not name a known codec.
+ */
+Codec codec_from_string(std::string const & name);
+
+/** Compresses a buffer using the given codec.
+ *
+ * @param data Pointer to the data to compress.
+ * @param length Length of the data in bytes.
+ * @param codec The codec to compress with, must not be Codec::none.
+ *
+ * @return A Data object holding a byte array with the compressed data.
+ *
+ * @throws std::runtime_error if the codec is not available in this
+ *      build, or if compression fails.
+ */
+Data compress(char const * data, std::size_t length, Codec codec);
+
+/** Decompresses a buffer that was compressed with the given codec.
+ *
+ * @param data Pointer to the compressed data.
+ * @param length Length of the compressed data in bytes.
+ * @param codec The codec the data was compressed with, must not be
+ *      Codec::none.
+ *
+ * @return A Data object holding a byte array with the decompressed data.
+ *
+ * @throws std::runtime_error if the codec is not available in this
+ *      build, or if decompression fails.
+ */
+Data decompress(char const * data, std::size_t length, Codec codec);
+
+} }
@@ -1,14 +1,27 @@
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <numeric>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
+
+#include <sys/mman.h>
 
 #include <msgpack.hpp>
 
+#include "libmuscle/block_pool.hpp"
 #include "libmuscle/data.hpp"
+#include "libmuscle/grid_template.hpp"
+#include "libmuscle/instrumentation.hpp"
 #include "libmuscle/mcp/data_pack.hpp"
 #include "libmuscle/mcp/ext_types.hpp"
 #include "ymmsl/identity.hpp"
@@ -22,6 +35,227 @@ using ymmsl::Settings;
 
 namespace libmuscle { namespace impl {
 
+namespace {
+
+/* Helper stream that determines the size of the packed data.
+ *
+ * Pack to this first to see how much memory is needed, so that a
+ * correctly-sized buffer can be allocated to pack into.
+ */
+struct PackedSizeBuffer {
+    void write(char const *, std::size_t len) {
+        size += len;
+    }
+
+    std::size_t size = 0u;
+};
+
+/* Helper stream that packs into preallocated memory.
+ *
+ * The buffer must be large enough to hold the packed data, see
+ * PackedSizeBuffer.
+ */
+struct ZoneBuffer {
+    ZoneBuffer(char * buf) : ptr(buf) {}
+
+    void write(char const * data, std::size_t len) {
+        memcpy(ptr, data, len);
+        ptr += len;
+    }
+
+    char * ptr;
+};
+
+// byte arrays at least this big get their own mapping rather than zone
+// chunks, so they can be backed by 2 MB huge pages
+std::size_t const huge_buffer_threshold_ = 2u * 1024u * 1024u;
+
+struct MappedBuffer_ {
+    void * addr;
+    std::size_t length;
+};
+
+/* Allocates a large buffer outside of the zone's chunks.
+ *
+ * The buffer is mapped page-aligned, and the kernel is advised to back
+ * it with transparent huge pages if it can. Multi-GB grid payloads on
+ * 4 kB pages thrash the TLB, which slows down both the serialisation
+ * memcpy and the model's reads of the data.
+ *
+ * The mapping is released by a zone finalizer, so it lives exactly as
+ * long as a zone allocation would have.
+ */
+char * map_large_buffer_(msgpack::zone & zone, std::size_t size) {
+    void * addr = mmap(
+            nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED)
+        throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+    madvise(addr, size, MADV_HUGEPAGE);
+#endif
+    libmuscle::impl::instrumentation::count(
+            libmuscle::impl::instrumentation::counters().mapped_buffer_bytes,
+            size);
+
+    auto mapping = new MappedBuffer_{addr, size};
+    zone.push_finalizer(
+            [](void * ptr) {
+                auto mapping = static_cast<MappedBuffer_ *>(ptr);
+                libmuscle::impl::instrumentation::uncount(
+                        libmuscle::impl::instrumentation::counters(
+                            ).mapped_buffer_bytes,
+                        mapping->length);
+                munmap(mapping->addr, mapping->length);
+                delete mapping;
+            },
+            mapping);
+    return static_cast<char *>(addr);
+}
+
+/* Checks that a byte array size fits the MessagePack bin32 format.
+ *
+ * Sizes used to be silently truncated to 32 bits, making a too-large
+ * byte array corrupt rather than fail.
+ */
+uint32_t checked_bin_size_(std::size_t size) {
+    if (size > std::numeric_limits<uint32_t>::max())
+        throw std::runtime_error(
+                "Tried to create a byte array of " + std::to_string(size)
+                + " bytes, but the MessagePack wire format limits byte"
+                " arrays to 4 GB. Consider splitting the data over"
+                " several messages.");
+    return static_cast<uint32_t>(size);
+}
+
+// maximum number of recycled zones kept around for reuse
+std::size_t const max_pooled_zones_ = 64u;
+
+// smallest dict for which a key index is built on subscript; scanning
+// a handful of keys linearly is faster than hashing
+uint32_t const min_indexed_dict_size_ = 16u;
+
+// initial chunk size of pooled zones; a compromise between not wasting
+// memory on objects holding a single small value, and not making many
+// small allocations when unpacking a large message
+std::size_t const pooled_zone_chunk_size_ = 2048u;
+
+/* A pool of recycled msgpack zones.
+ *
+ * Every Data and DataConstRef holding a value needs a zone, and models
+ * that send many small messages create and destroy thousands of them per
+ * second, which makes the allocator a bottleneck. Zones handed out by
+ * this pool carry a deleter that clears them and puts them back when the
+ * last object referring to them is released; for an outgoing message
+ * that happens once the PostOffice has sent the encoded bytes and
+ * dropped the message. In steady state, messages are then built without
+ * touching the allocator.
+ *
+ * Zones may be released from any thread, so the pool is protected by a
+ * mutex. The pool object itself is deliberately leaked, because zones
+ * held by objects with static storage duration may be released after
+ * normal static destruction has run.
+ */
+class ZonePool_ {
+    public:
+        std::shared_ptr<msgpack::zone> get() {
+            msgpack::zone * zone = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!zones_.empty()) {
+                    zone = zones_.back();
+                    zones_.pop_back();
+                }
+            }
+            if (!zone)
+                zone = new msgpack::zone(pooled_zone_chunk_size_);
+            return std::shared_ptr<msgpack::zone>(
+                    zone, [this](msgpack::zone * z) { put_(z); });
+        }
+
+    private:
+        void put_(msgpack::zone * zone) {
+            // runs any finalizers and frees all but the first chunk
+            zone->clear();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (zones_.size() < max_pooled_zones_) {
+                    zones_.push_back(zone);
+                    return;
+                }
+            }
+            delete zone;
+        }
+
+        std::mutex mutex_;
+        std::vector<msgpack::zone *> zones_;
+};
+
+ZonePool_ & zone_pool_() {
+    // deliberately leaked, see the class comment
+    static ZonePool_ * pool = new ZonePool_();
+    return *pool;
+}
+
+// maximum number of interned dict keys, see KeyInternPool_
+std::size_t const max_interned_keys_ = 1024u;
+
+/* A pool of interned dict key strings.
+ *
+ * The dicts a model sends tend to use the same small set of keys over
+ * and over, and each message copied every key into its zone anew. Keys
+ * interned here are stored once, and map keys refer to that storage
+ * directly, so that building a dict does not allocate or copy for its
+ * keys.
+ *
+ * Interned keys are kept for the life of the process, so the pool is
+ * capped in case a model generates keys dynamically; once it is full,
+ * new keys are copied into the zone as before. Keys may be interned
+ * from any thread, so the pool is protected by a mutex. The pool object
+ * is deliberately leaked, because objects with static storage duration
+ * may refer to interned keys after normal static destruction has run.
+ */
+class KeyInternPool_ {
+    public:
+        /* Returns a pointer to an interned copy of the given key, or
+         * nullptr if the pool is full and the key is not in it.
+         */
+        char const * intern(std::string const & key) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = keys_.find(key);
+            if (it != keys_.end())
+                return it->data();
+            if (keys_.size() >= max_interned_keys_)
+                return nullptr;
+            return keys_.insert(key).first->data();
+        }
+
+    private:
+        std::mutex mutex_;
+        std::unordered_set<std::string> keys_;
+};
+
+KeyInternPool_ & key_intern_pool_() {
+    // deliberately leaked, see the class comment
+    static KeyInternPool_ * pool = new KeyInternPool_();
+    return *pool;
+}
+
+/* Converts grid elements to another type.
+ *
+ * This is a plain loop over contiguous memory, which the compiler turns
+ * into vectorised code at the optimisation levels we build with.
+ */
+template <typename To, typename From>
+std::vector<To> convert_elements_(From const * src, std::size_t num_elems) {
+    std::vector<To> result(num_elems);
+    for (std::size_t i = 0u; i < num_elems; ++i)
+        result[i] = static_cast<To>(src[i]);
+    return result;
+}
+
+}
+
 // helper functions
 
 template <typename Element>
@@ -52,6 +286,34 @@ ExtTypeId grid_type_id_<bool>() {
     return ExtTypeId::grid_bool;
 }
 
+template <typename Element>
+ExtTypeId grid_block_type_id_();
+
+template <>
+ExtTypeId grid_block_type_id_<std::int32_t>() {
+    return ExtTypeId::grid_block_int32;
+}
+
+template <>
+ExtTypeId grid_block_type_id_<std::int64_t>() {
+    return ExtTypeId::grid_block_int64;
+}
+
+template <>
+ExtTypeId grid_block_type_id_<float>() {
+    return ExtTypeId::grid_block_float32;
+}
+
+template <>
+ExtTypeId grid_block_type_id_<double>() {
+    return ExtTypeId::grid_block_float64;
+}
+
+template <>
+ExtTypeId grid_block_type_id_<bool>() {
+    return ExtTypeId::grid_block_bool;
+}
+
 template <typename Element>
 std::string grid_type_name_();
 
@@ -80,6 +342,39 @@ std::string grid_type_name_<bool>() {
     return "bool";
 }
 
+/* Maps a grid's type name to the size of an element on the wire.
+ */
+std::size_t grid_elem_size_(std::string const & type_name) {
+    if (type_name == "float64") return 8u;
+    if (type_name == "float32") return 4u;
+    if (type_name == "int64") return 8u;
+    if (type_name == "int32") return 4u;
+    if (type_name == "bool") return 1u;
+    throw std::runtime_error("Invalid grid type. Bug in MUSCLE3?");
+}
+
+/* Maps a grid's type name to its ext type id.
+ */
+ExtTypeId grid_type_id_for_(std::string const & type_name) {
+    if (type_name == "float64") return ExtTypeId::grid_float64;
+    if (type_name == "float32") return ExtTypeId::grid_float32;
+    if (type_name == "int64") return ExtTypeId::grid_int64;
+    if (type_name == "int32") return ExtTypeId::grid_int32;
+    if (type_name == "bool") return ExtTypeId::grid_bool;
+    throw std::runtime_error("Invalid grid type. Bug in MUSCLE3?");
+}
+
+/* Maps a grid's type name to the ext type id of a block of it.
+ */
+ExtTypeId grid_block_type_id_for_(std::string const & type_name) {
+    if (type_name == "float64") return ExtTypeId::grid_block_float64;
+    if (type_name == "float32") return ExtTypeId::grid_block_float32;
+    if (type_name == "int64") return ExtTypeId::grid_block_int64;
+    if (type_name == "int32") return ExtTypeId::grid_block_int32;
+    if (type_name == "bool") return ExtTypeId::grid_block_bool;
+    throw std::runtime_error("Invalid grid type. Bug in MUSCLE3?");
+}
+
 template <typename Element>
 DataConstRef DataConstRef::grid_data_(
         Element const * const data, std::size_t num_elems
@@ -94,10 +389,50 @@ DataConstRef DataConstRef::grid_data_<bool>(
 
 // implementation
 
-DataConstRef::DataConstRef()
-    : mp_zones_(new std::vector<std::shared_ptr<msgpack::zone>>())
-{
-    mp_obj_ = zone_alloc_<msgpack::object>();
+std::shared_ptr<msgpack::zone> DataConstRef::zone_from_pool_() {
+    return zone_pool_().get();
+}
+
+msgpack::zone & DataConstRef::first_zone_() const {
+    if (mp_zones_->empty())
+        mp_zones_->push_back(zone_from_pool_());
+    return *mp_zones_->front();
+}
+
+void DataConstRef::track_zone_alloc_(std::size_t num_bytes) const {
+    if (!instrumentation::memory_accounting_enabled())
+        return;
+    instrumentation::count(
+            instrumentation::counters().zone_bytes, num_bytes);
+    // The gauge is decremented when the zone is cleared or destroyed,
+    // which is when the allocation actually goes away. The amount is
+    // smuggled through the finalizer's context pointer, so tracking
+    // an allocation doesn't have to allocate.
+    (*mp_zones_)[0]->push_finalizer(
+            [](void * ptr) {
+                instrumentation::uncount(
+                        instrumentation::counters().zone_bytes,
+                        reinterpret_cast<std::uintptr_t>(ptr));
+            },
+            reinterpret_cast<char *>(num_bytes));
+}
+
+DataConstRef::DataConstRef() {
+    // A nil or scalar value lives in the msgpack object itself, so no
+    // zone memory is needed for it. A single block holds the object
+    // and the zones vector, which starts out empty; zone_alloc_ adds a
+    // zone if one turns out to be needed after all. The block comes
+    // from the block pool, so that a message payload that is a single
+    // number, as sent on control conduits at high rates, allocates
+    // nothing at all in steady state.
+    struct ScalarStorage_ {
+        std::vector<std::shared_ptr<msgpack::zone>> zones;
+        msgpack::object obj;
+    };
+    auto storage = std::allocate_shared<ScalarStorage_>(
+            BlockPoolAllocator<ScalarStorage_>());
+    mp_zones_ = Zones_(storage, &storage->zones);
+    mp_obj_ = &storage->obj;
     mp_obj_->type = msgpack::type::NIL;
 }
 
@@ -201,7 +536,7 @@ DataConstRef DataConstRef::grid(
         grid_dict["order"] = "la";
 
     std::size_t num_elems = std::accumulate(
-        shape.cbegin(), shape.cend(), 1u,
+        shape.cbegin(), shape.cend(), std::size_t(1u),
         std::multiplies<std::size_t>());
     grid_dict["data"] = Data::byte_array(
         reinterpret_cast<char const *>(data), num_elems * sizeof(Element));
@@ -253,6 +588,405 @@ template DataConstRef DataConstRef::grid<bool>(
 
 #endif
 
+/* Like grid(), this is here and instantiated explicitly because it requires
+ * the ExtTypeId.
+ */
+template <typename Element>
+DataConstRef DataConstRef::grid_view(
+        Element const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner
+) {
+    if (shape.size() != indexes.size() && !indexes.empty())
+        throw std::runtime_error("Shape and indexes must have the same length");
+
+    auto grid_dict = Data::dict();
+    // type member is redundant, but useful metadata
+    grid_dict["type"] = grid_type_name_<Element>();
+
+    Data shape_list = Data::nils(shape.size());
+    for (std::size_t i = 0u; i < shape.size(); ++i)
+        shape_list[i] = shape[i];
+    grid_dict["shape"] = shape_list;
+
+    if (storage_order == StorageOrder::first_adjacent)
+        grid_dict["order"] = "fa";
+    else
+        grid_dict["order"] = "la";
+
+    std::size_t num_elems = std::accumulate(
+        shape.cbegin(), shape.cend(), std::size_t(1u),
+        std::multiplies<std::size_t>());
+    // refers to the caller's buffer, no copy is made here
+    grid_dict["data"] = Data::byte_array(
+        reinterpret_cast<char const *>(data), num_elems * sizeof(Element));
+
+    if (!indexes.empty()) {
+        Data indexes_list = Data::nils(indexes.size());
+        for (std::size_t i = 0u; i < indexes.size(); ++i)
+            indexes_list[i] = indexes[i];
+        grid_dict["indexes"] = indexes_list;
+    }
+    else {
+        grid_dict["indexes"] = Data();
+    }
+
+    DataConstRef result(grid_dict);
+    result.lazy_grid_type_ = static_cast<char>(grid_type_id_<Element>());
+
+    if (owner) {
+        // Keep the caller's buffer alive for as long as our zones, which is
+        // at least as long as anything may refer to it.
+        auto keepalive = new std::shared_ptr<const void>(owner);
+        result.mp_zones_->front()->push_finalizer(
+                [](void * ptr) {
+                    delete static_cast<std::shared_ptr<const void> *>(ptr);
+                },
+                keepalive);
+    }
+
+    return result;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template DataConstRef DataConstRef::grid_view<std::int32_t>(
+        std::int32_t const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_view<std::int64_t>(
+        std::int64_t const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_view<float>(
+        float const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_view<double>(
+        double const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_view<bool>(
+        bool const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+#endif
+
+/* Like grid_view(), but with the block's position in the global grid
+ * added to the dict.
+ */
+template <typename Element>
+DataConstRef DataConstRef::grid_block_view(
+        Element const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner
+) {
+    if (shape.size() != indexes.size() && !indexes.empty())
+        throw std::runtime_error("Shape and indexes must have the same length");
+    if (shape.size() != offsets.size() || shape.size() != global_shape.size())
+        throw std::runtime_error(
+                "Shape, offsets and global shape must have the same length");
+
+    auto grid_dict = Data::dict();
+    // type member is redundant, but useful metadata
+    grid_dict["type"] = grid_type_name_<Element>();
+
+    Data shape_list = Data::nils(shape.size());
+    for (std::size_t i = 0u; i < shape.size(); ++i)
+        shape_list[i] = shape[i];
+    grid_dict["shape"] = shape_list;
+
+    Data offsets_list = Data::nils(offsets.size());
+    for (std::size_t i = 0u; i < offsets.size(); ++i)
+        offsets_list[i] = offsets[i];
+    grid_dict["offsets"] = offsets_list;
+
+    Data global_shape_list = Data::nils(global_shape.size());
+    for (std::size_t i = 0u; i < global_shape.size(); ++i)
+        global_shape_list[i] = global_shape[i];
+    grid_dict["global_shape"] = global_shape_list;
+
+    if (storage_order == StorageOrder::first_adjacent)
+        grid_dict["order"] = "fa";
+    else
+        grid_dict["order"] = "la";
+
+    std::size_t num_elems = std::accumulate(
+        shape.cbegin(), shape.cend(), std::size_t(1u),
+        std::multiplies<std::size_t>());
+    // refers to the caller's buffer, no copy is made here
+    grid_dict["data"] = Data::byte_array(
+        reinterpret_cast<char const *>(data), num_elems * sizeof(Element));
+
+    if (!indexes.empty()) {
+        Data indexes_list = Data::nils(indexes.size());
+        for (std::size_t i = 0u; i < indexes.size(); ++i)
+            indexes_list[i] = indexes[i];
+        grid_dict["indexes"] = indexes_list;
+    }
+    else {
+        grid_dict["indexes"] = Data();
+    }
+
+    DataConstRef result(grid_dict);
+    result.lazy_grid_type_ = static_cast<char>(grid_block_type_id_<Element>());
+
+    if (owner) {
+        // Keep the caller's buffer alive for as long as our zones, which is
+        // at least as long as anything may refer to it.
+        auto keepalive = new std::shared_ptr<const void>(owner);
+        result.mp_zones_->front()->push_finalizer(
+                [](void * ptr) {
+                    delete static_cast<std::shared_ptr<const void> *>(ptr);
+                },
+                keepalive);
+    }
+
+    return result;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template DataConstRef DataConstRef::grid_block_view<std::int32_t>(
+        std::int32_t const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_block_view<std::int64_t>(
+        std::int64_t const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_block_view<float>(
+        float const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_block_view<double>(
+        double const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template DataConstRef DataConstRef::grid_block_view<bool>(
+        bool const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+#endif
+
+/* Like grid(), GridTemplate's members are defined here and instantiated
+ * explicitly because they require the ExtTypeId.
+ */
+template <typename Element>
+GridTemplate GridTemplate::for_type(
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order)
+{
+    if (shape.size() != indexes.size() && !indexes.empty())
+        throw std::runtime_error("Shape and indexes must have the same length");
+
+    auto grid_dict = Data::dict();
+    // type member is redundant, but useful metadata
+    grid_dict["type"] = grid_type_name_<Element>();
+
+    Data shape_list = Data::nils(shape.size());
+    for (std::size_t i = 0u; i < shape.size(); ++i)
+        shape_list[i] = shape[i];
+    grid_dict["shape"] = shape_list;
+
+    if (storage_order == StorageOrder::first_adjacent)
+        grid_dict["order"] = "fa";
+    else
+        grid_dict["order"] = "la";
+
+    // placeholder, with_elements() fills this in
+    grid_dict["data"] = Data();
+
+    if (!indexes.empty()) {
+        Data indexes_list = Data::nils(indexes.size());
+        for (std::size_t i = 0u; i < indexes.size(); ++i)
+            indexes_list[i] = indexes[i];
+        grid_dict["indexes"] = indexes_list;
+    }
+    else {
+        grid_dict["indexes"] = Data();
+    }
+
+    std::size_t num_elems = std::accumulate(
+        shape.cbegin(), shape.cend(), std::size_t(1u),
+        std::multiplies<std::size_t>());
+
+    return GridTemplate(
+            grid_dict, static_cast<char>(grid_type_id_<Element>()),
+            num_elems, grid_type_name_<Element>());
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template GridTemplate GridTemplate::for_type<std::int32_t>(
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order);
+
+template GridTemplate GridTemplate::for_type<std::int64_t>(
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order);
+
+template GridTemplate GridTemplate::for_type<float>(
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order);
+
+template GridTemplate GridTemplate::for_type<double>(
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order);
+
+template GridTemplate GridTemplate::for_type<bool>(
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order);
+
+#endif
+
+template <typename Element>
+DataConstRef GridTemplate::with_elements(
+        Element const * data,
+        std::shared_ptr<const void> const & owner) const
+{
+    if (static_cast<char>(grid_type_id_<Element>()) != grid_type_) {
+        std::ostringstream oss;
+        oss << "Tried to make a grid of " << grid_type_name_<Element>();
+        oss << " elements from a GridTemplate for " << type_name_;
+        oss << " elements.";
+        throw std::runtime_error(oss.str());
+    }
+
+    // The metadata is shared with the template: the new grid gets a
+    // shallow copy of the template's dict, whose keys and values point
+    // into the template's zone, which is kept alive alongside. Only the
+    // data member of the copy is written, so the template itself stays
+    // untouched, and stays usable from several threads at once.
+    DataConstRef result(DataConstRef::zone_from_pool_());
+    result.mp_zones_->insert(
+            result.mp_zones_->end(),
+            grid_dict_.mp_zones_->cbegin(), grid_dict_.mp_zones_->cend());
+
+    msgpack::object const & tmpl_obj = *grid_dict_.mp_obj_;
+    uint32_t num_entries = tmpl_obj.via.map.size;
+    auto entries = result.zone_alloc_<msgpack::object_kv>(num_entries);
+    std::copy(
+            tmpl_obj.via.map.ptr, tmpl_obj.via.map.ptr + num_entries,
+            entries);
+    result.mp_obj_->type = msgpack::type::MAP;
+    result.mp_obj_->via.map.size = num_entries;
+    result.mp_obj_->via.map.ptr = entries;
+
+    // refers to the caller's buffer, no copy is made here
+    Data elements = Data::byte_array(
+            reinterpret_cast<char const *>(data),
+            num_elems_ * sizeof(Element));
+    for (uint32_t i = 0u; i < num_entries; ++i) {
+        auto const & key = entries[i].key;
+        if (key.type == msgpack::type::STR &&
+                std::string(key.via.str.ptr, key.via.str.size) == "data") {
+            entries[i].val = *elements.mp_obj_;
+            break;
+        }
+    }
+
+    result.lazy_grid_type_ = grid_type_;
+
+    if (owner) {
+        // Keep the caller's buffer alive for as long as our zones, which is
+        // at least as long as anything may refer to it.
+        auto keepalive = new std::shared_ptr<const void>(owner);
+        result.mp_zones_->front()->push_finalizer(
+                [](void * ptr) {
+                    delete static_cast<std::shared_ptr<const void> *>(ptr);
+                },
+                keepalive);
+    }
+
+    return result;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template DataConstRef GridTemplate::with_elements<std::int32_t>(
+        std::int32_t const * data,
+        std::shared_ptr<const void> const & owner) const;
+
+template DataConstRef GridTemplate::with_elements<std::int64_t>(
+        std::int64_t const * data,
+        std::shared_ptr<const void> const & owner) const;
+
+template DataConstRef GridTemplate::with_elements<float>(
+        float const * data,
+        std::shared_ptr<const void> const & owner) const;
+
+template DataConstRef GridTemplate::with_elements<double>(
+        double const * data,
+        std::shared_ptr<const void> const & owner) const;
+
+template DataConstRef GridTemplate::with_elements<bool>(
+        bool const * data,
+        std::shared_ptr<const void> const & owner) const;
+
+#endif
+
+GridTemplate::GridTemplate(
+        DataConstRef const & grid_dict, char grid_type,
+        std::size_t num_elems, std::string const & type_name)
+    : grid_dict_(grid_dict)
+    , grid_type_(grid_type)
+    , num_elems_(num_elems)
+    , type_name_(type_name)
+{}
+
 DataConstRef::DataConstRef(SettingValue const & value)
     : DataConstRef()
 {
@@ -297,19 +1031,28 @@ DataConstRef::DataConstRef(Settings const & settings)
     for (auto const & kv_pair: settings)
         settings_dict[static_cast<std::string>(kv_pair.first)] = kv_pair.second;
 
-    msgpack::sbuffer buf;
-    msgpack::pack(buf, settings_dict);
+    PackedSizeBuffer sizer;
+    mcp::pack_data(sizer, settings_dict);
 
-    char * zoned_mem = zone_alloc_<char>(buf.size() + 1);
+    char * zoned_mem = zone_alloc_<char>(sizer.size + 1);
     zoned_mem[0] = static_cast<char>(ExtTypeId::settings);
-    memcpy(zoned_mem + 1, buf.data(), buf.size());
-    *mp_obj_ << msgpack::type::ext_ref(zoned_mem, buf.size() + 1);
+    ZoneBuffer buf(zoned_mem + 1);
+    mcp::pack_data(buf, settings_dict);
+    *mp_obj_ << msgpack::type::ext_ref(zoned_mem, sizer.size + 1);
 }
 
 void DataConstRef::reseat(DataConstRef const & target) {
     mp_zones_ = target.mp_zones_;
     mp_obj_ = target.mp_obj_;
     obj_cache_ = target.obj_cache_;
+    lazy_grid_type_ = target.lazy_grid_type_;
+}
+
+void DataConstRef::reseat(DataConstRef && target) {
+    mp_zones_ = std::move(target.mp_zones_);
+    mp_obj_ = target.mp_obj_;
+    obj_cache_ = std::move(target.obj_cache_);
+    lazy_grid_type_ = target.lazy_grid_type_;
 }
 
 template <>
@@ -398,7 +1141,8 @@ bool DataConstRef::is_nil() const {
 }
 
 bool DataConstRef::is_a_dict() const {
-    return mp_obj_->type == msgpack::type::MAP;
+    // a lazy grid view is stored as a dict, but models a grid
+    return mp_obj_->type == msgpack::type::MAP && !lazy_grid_type_;
 }
 
 bool DataConstRef::is_a_list() const {
@@ -407,6 +1151,9 @@ bool DataConstRef::is_a_list() const {
 
 template <typename Element>
 bool DataConstRef::is_a_grid_of() const {
+    if (lazy_grid_type_)
+        return lazy_grid_type_ == static_cast<char>(grid_type_id_<Element>());
+
     if (mp_obj_->type != msgpack::type::EXT)
         return false;
 
@@ -428,6 +1175,49 @@ template bool DataConstRef::is_a_grid_of<bool>() const;
 
 #endif
 
+template <typename Element>
+bool DataConstRef::is_a_grid_block_of() const {
+    if (lazy_grid_type_)
+        return lazy_grid_type_ ==
+            static_cast<char>(grid_block_type_id_<Element>());
+
+    if (mp_obj_->type != msgpack::type::EXT)
+        return false;
+
+    auto ext_type = static_cast<mcp::ExtTypeId>(mp_obj_->via.ext.type());
+    return ext_type == grid_block_type_id_<Element>();
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template bool DataConstRef::is_a_grid_block_of<std::int32_t>() const;
+
+template bool DataConstRef::is_a_grid_block_of<std::int64_t>() const;
+
+template bool DataConstRef::is_a_grid_block_of<float>() const;
+
+template bool DataConstRef::is_a_grid_block_of<double>() const;
+
+template bool DataConstRef::is_a_grid_block_of<bool>() const;
+
+#endif
+
+bool DataConstRef::is_a_grid() const {
+    return is_a_grid_();
+}
+
+bool DataConstRef::is_a_record_batch() const {
+    if (lazy_grid_type_)
+        return static_cast<mcp::ExtTypeId>(lazy_grid_type_)
+                == mcp::ExtTypeId::record_batch;
+
+    if (mp_obj_->type != msgpack::type::EXT)
+        return false;
+
+    auto ext_type = static_cast<mcp::ExtTypeId>(mp_obj_->via.ext.type());
+    return ext_type == mcp::ExtTypeId::record_batch;
+}
+
 bool DataConstRef::is_a_byte_array() const {
     return mp_obj_->type == msgpack::type::BIN;
 }
@@ -503,8 +1293,9 @@ Settings DataConstRef::as<Settings>() const {
         throw std::runtime_error("Invalid Settings format. Bug in MUSCLE3?");
 
     Settings settings;
-    auto zone = std::make_shared<msgpack::zone>();
-    Data settings_dict(mcp::unpack_data(zone, ext.data(), ext.size()));
+    auto zone = zone_from_pool_();
+    // the ext data lives in our zone, which outlives settings_dict
+    Data settings_dict(mcp::unpack_data_view(zone, ext.data(), ext.size()));
 
     for (std::size_t i = 0u; i < settings_dict.size(); ++i) {
         Reference key(settings_dict.key(i));
@@ -522,14 +1313,17 @@ std::size_t DataConstRef::size() const {
     else if (is_a_grid_()) {
         auto shape_vec = shape();
         return std::accumulate(
-            shape_vec.cbegin(), shape_vec.cend(), 1u,
+            shape_vec.cbegin(), shape_vec.cend(), std::size_t(1u),
             std::multiplies<std::size_t>());
     }
+    else if (is_a_record_batch())
+        return num_records();
     else if (is_a_byte_array())
         return mp_obj_->via.bin.size;
     else
         throw std::runtime_error("DataConstRef::size() called for an object that does"
-                                 " not represent a list, dict, grid or byte array");
+                                 " not represent a list, dict, grid, record batch or"
+                                 " byte array");
 }
 
 char const * DataConstRef::as_byte_array() const {
@@ -539,14 +1333,38 @@ char const * DataConstRef::as_byte_array() const {
     return mp_obj_->via.bin.ptr;
 }
 
-DataConstRef DataConstRef::operator[](std::string const & key) const {
-    if (mp_obj_->type == msgpack::type::MAP) {
-        for (uint32_t i = 0; i < mp_obj_->via.map.size; ++i) {
-            auto const & mkey = mp_obj_->via.map.ptr[i].key;
-            if (mkey.type == msgpack::type::STR)
-                if (mkey.via.str.size == key.size())
-                    if (strncmp(mkey.via.str.ptr, key.data(), mkey.via.str.size) == 0)
-                        return DataConstRef(&(mp_obj_->via.map.ptr[i].val), mp_zones_);
+DataConstRef DataConstRef::operator[](std::string const & key) const {
+    if (is_a_dict()) {
+        // For a larger dict, scanning the keys on every subscript makes
+        // reading all the values quadratic, so build an index once and
+        // look keys up in that instead.
+        if (!key_index_ && mp_obj_->via.map.size >= min_indexed_dict_size_) {
+            key_index_ = std::make_shared<
+                    std::unordered_map<std::string, uint32_t>>();
+            key_index_->reserve(mp_obj_->via.map.size);
+            for (uint32_t i = 0; i < mp_obj_->via.map.size; ++i) {
+                auto const & mkey = mp_obj_->via.map.ptr[i].key;
+                if (mkey.type == msgpack::type::STR)
+                    key_index_->emplace(
+                            std::string(mkey.via.str.ptr, mkey.via.str.size),
+                            i);
+            }
+        }
+
+        if (key_index_) {
+            auto it = key_index_->find(key);
+            if (it != key_index_->end())
+                return DataConstRef(
+                        &(mp_obj_->via.map.ptr[it->second].val), mp_zones_);
+        }
+        else {
+            for (uint32_t i = 0; i < mp_obj_->via.map.size; ++i) {
+                auto const & mkey = mp_obj_->via.map.ptr[i].key;
+                if (mkey.type == msgpack::type::STR)
+                    if (mkey.via.str.size == key.size())
+                        if (strncmp(mkey.via.str.ptr, key.data(), mkey.via.str.size) == 0)
+                            return DataConstRef(&(mp_obj_->via.map.ptr[i].val), mp_zones_);
+            }
         }
         throw std::out_of_range("Key " + key + " not found in map.");
     }
@@ -554,7 +1372,7 @@ DataConstRef DataConstRef::operator[](std::string const & key) const {
 }
 
 std::string DataConstRef::key(std::size_t i) const {
-    if (mp_obj_->type == msgpack::type::MAP) {
+    if (is_a_dict()) {
         if (i < size())
             return DataConstRef(&(mp_obj_->via.map.ptr[i].key), mp_zones_).as<std::string>();
         else
@@ -564,7 +1382,7 @@ std::string DataConstRef::key(std::size_t i) const {
 }
 
 DataConstRef DataConstRef::value(std::size_t i) const {
-    if (mp_obj_->type == msgpack::type::MAP) {
+    if (is_a_dict()) {
         if (i < size())
             return DataConstRef(&(mp_obj_->via.map.ptr[i].val), mp_zones_);
         else
@@ -573,6 +1391,48 @@ DataConstRef DataConstRef::value(std::size_t i) const {
     throw std::runtime_error("Tried to look up a value, but this object is not a map.");
 }
 
+DataConstRef::KeyIterator::KeyIterator(msgpack::object const * obj, uint32_t i)
+    : obj_(obj), i_(i)
+{}
+
+DataConstRef::KeyIterator::value_type
+DataConstRef::KeyIterator::operator*() const {
+    auto const & mkey = obj_->via.map.ptr[i_].key;
+    return value_type(mkey.via.str.ptr, mkey.via.str.size);
+}
+
+DataConstRef::KeyIterator & DataConstRef::KeyIterator::operator++() {
+    ++i_;
+    return *this;
+}
+
+bool DataConstRef::KeyIterator::operator==(KeyIterator const & rhs) const {
+    return (obj_ == rhs.obj_) && (i_ == rhs.i_);
+}
+
+bool DataConstRef::KeyIterator::operator!=(KeyIterator const & rhs) const {
+    return !(*this == rhs);
+}
+
+DataConstRef::Keys::Keys(msgpack::object const * obj)
+    : obj_(obj)
+{}
+
+DataConstRef::KeyIterator DataConstRef::Keys::begin() const {
+    return KeyIterator(obj_, 0u);
+}
+
+DataConstRef::KeyIterator DataConstRef::Keys::end() const {
+    return KeyIterator(obj_, obj_->via.map.size);
+}
+
+DataConstRef::Keys DataConstRef::keys() const {
+    if (!is_a_dict())
+        throw std::runtime_error("Tried to get the keys, but this object is"
+                                 " not a map.");
+    return Keys(mp_obj_);
+}
+
 DataConstRef DataConstRef::operator[](std::size_t index) const {
     if (mp_obj_->type == msgpack::type::ARRAY)
         if (index < mp_obj_->via.array.size)
@@ -585,7 +1445,7 @@ DataConstRef DataConstRef::operator[](std::size_t index) const {
 
 template <typename Element>
 Element const * DataConstRef::elements() const {
-    if (!is_a_grid_of<Element>())
+    if (!is_a_grid_of<Element>() && !is_a_grid_block_of<Element>())
         throw std::runtime_error(
                 "Tried to get grid data, but this object is not a grid or"
                 " not of the correct type.");
@@ -607,6 +1467,121 @@ template long const * DataConstRef::elements<long>() const;
 
 #endif
 
+template <typename Element>
+std::vector<Element> DataConstRef::elements_as() const {
+    if (!is_a_grid_())
+        throw std::runtime_error(
+                "Tried to get grid data, but this object is not a grid.");
+    char const * data_bytes = grid_dict_()["data"].as_byte_array();
+    std::size_t num_elems = size();
+
+    if (is_a_grid_of<std::int32_t>() || is_a_grid_block_of<std::int32_t>())
+        return convert_elements_<Element>(
+                reinterpret_cast<std::int32_t const *>(data_bytes), num_elems);
+    if (is_a_grid_of<std::int64_t>() || is_a_grid_block_of<std::int64_t>())
+        return convert_elements_<Element>(
+                reinterpret_cast<std::int64_t const *>(data_bytes), num_elems);
+    if (is_a_grid_of<float>() || is_a_grid_block_of<float>())
+        return convert_elements_<Element>(
+                reinterpret_cast<float const *>(data_bytes), num_elems);
+    if (is_a_grid_of<double>() || is_a_grid_block_of<double>())
+        return convert_elements_<Element>(
+                reinterpret_cast<double const *>(data_bytes), num_elems);
+    return convert_elements_<Element>(
+            reinterpret_cast<bool const *>(data_bytes), num_elems);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template std::vector<bool> DataConstRef::elements_as<bool>() const;
+
+template std::vector<double> DataConstRef::elements_as<double>() const;
+
+template std::vector<float> DataConstRef::elements_as<float>() const;
+
+template std::vector<std::int32_t> DataConstRef::elements_as<std::int32_t>() const;
+
+template std::vector<std::int64_t> DataConstRef::elements_as<std::int64_t>() const;
+
+#endif
+
+std::size_t DataConstRef::num_records() const {
+    if (!is_a_record_batch())
+        throw std::runtime_error(
+                "Tried to get the number of records, but this object is not"
+                " a record batch.");
+    return grid_dict_()["len"].as<std::size_t>();
+}
+
+std::vector<std::string> DataConstRef::column_names() const {
+    if (!is_a_record_batch())
+        throw std::runtime_error(
+                "Tried to get the column names, but this object is not a"
+                " record batch.");
+    DataConstRef columns = grid_dict_()["columns"];
+    std::vector<std::string> result(columns.size());
+    for (std::size_t i = 0u; i < columns.size(); ++i)
+        result[i] = columns.key(i);
+    return result;
+}
+
+bool DataConstRef::has_column(std::string const & name) const {
+    if (!is_a_record_batch())
+        throw std::runtime_error(
+                "Tried to check for a column, but this object is not a"
+                " record batch.");
+    DataConstRef columns = grid_dict_()["columns"];
+    for (std::size_t i = 0u; i < columns.size(); ++i)
+        if (columns.key(i) == name)
+            return true;
+    return false;
+}
+
+template <typename Element>
+Element const * DataConstRef::column(std::string const & name) const {
+    if (!is_a_record_batch())
+        throw std::runtime_error(
+                "Tried to get a column, but this object is not a record"
+                " batch.");
+    DataConstRef batch = grid_dict_();
+
+    std::string type_name;
+    try {
+        type_name = batch["types"][name].as<std::string>();
+    }
+    catch (std::out_of_range const &) {
+        throw std::out_of_range(
+                "This record batch has no column named '" + name + "'.");
+    }
+    if (type_name != grid_type_name_<Element>())
+        throw std::runtime_error(
+                "Tried to get column '" + name + "' as " +
+                grid_type_name_<Element>() + ", but it holds " + type_name +
+                " values.");
+
+    char const * data_bytes = batch["columns"][name].as_byte_array();
+    return reinterpret_cast<Element const *>(data_bytes);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template bool const * DataConstRef::column<bool>(
+        std::string const & name) const;
+
+template double const * DataConstRef::column<double>(
+        std::string const & name) const;
+
+template float const * DataConstRef::column<float>(
+        std::string const & name) const;
+
+template std::int32_t const * DataConstRef::column<std::int32_t>(
+        std::string const & name) const;
+
+template std::int64_t const * DataConstRef::column<std::int64_t>(
+        std::string const & name) const;
+
+#endif
+
 std::vector<std::size_t> DataConstRef::shape() const {
     if (is_a_grid_()) {
         DataConstRef shape_list = grid_dict_()["shape"];
@@ -651,6 +1626,255 @@ std::vector<std::string> DataConstRef::indexes() const {
         throw std::runtime_error("Tried to get indexes, but this grid does not have any.");
 }
 
+std::vector<std::size_t> DataConstRef::offsets() const {
+    if (is_a_grid_block_()) {
+        DataConstRef offsets_list = grid_dict_()["offsets"];
+        std::vector<std::size_t> result(offsets_list.size());
+        for (std::size_t i = 0u; i < offsets_list.size(); ++i)
+            result[i] = offsets_list[i].as<std::size_t>();
+        return result;
+    }
+    else
+        throw std::runtime_error("Tried to get the offsets, but this object is not a grid block.");
+}
+
+std::vector<std::size_t> DataConstRef::global_shape() const {
+    if (is_a_grid_block_()) {
+        DataConstRef shape_list = grid_dict_()["global_shape"];
+        std::vector<std::size_t> result(shape_list.size());
+        for (std::size_t i = 0u; i < shape_list.size(); ++i)
+            result[i] = shape_list[i].as<std::size_t>();
+        return result;
+    }
+    else
+        throw std::runtime_error("Tried to get the global shape, but this object is not a grid block.");
+}
+
+DataConstRef DataConstRef::grid_xor(DataConstRef const & other) const {
+    if (!is_a_grid_() || !other.is_a_grid_())
+        throw std::runtime_error(
+                "Tried to XOR grids, but one of the objects is not a grid.");
+
+    DataConstRef grid_dict = grid_dict_();
+    DataConstRef other_dict = other.grid_dict_();
+    std::string type_name = grid_dict["type"].as<std::string>();
+    if (
+            type_name != other_dict["type"].as<std::string>() ||
+            shape() != other.shape())
+        throw std::runtime_error(
+                "Tried to XOR grids of different element type or shape.");
+
+    DataConstRef data = grid_dict["data"];
+    char const * a = data.as_byte_array();
+    char const * b = other_dict["data"].as_byte_array();
+    std::size_t num_bytes = data.size();
+
+    auto xor_dict = Data::dict();
+    xor_dict["type"] = type_name;
+
+    std::vector<std::size_t> cur_shape = shape();
+    Data shape_list = Data::nils(cur_shape.size());
+    for (std::size_t i = 0u; i < cur_shape.size(); ++i)
+        shape_list[i] = cur_shape[i];
+    xor_dict["shape"] = shape_list;
+
+    // a block keeps its position in the global grid
+    bool is_block = is_a_grid_block_();
+    if (is_block) {
+        std::vector<std::size_t> offs = offsets();
+        Data offsets_list = Data::nils(offs.size());
+        for (std::size_t i = 0u; i < offs.size(); ++i)
+            offsets_list[i] = offs[i];
+        xor_dict["offsets"] = offsets_list;
+
+        std::vector<std::size_t> glob_shape = global_shape();
+        Data global_shape_list = Data::nils(glob_shape.size());
+        for (std::size_t i = 0u; i < glob_shape.size(); ++i)
+            global_shape_list[i] = glob_shape[i];
+        xor_dict["global_shape"] = global_shape_list;
+    }
+
+    xor_dict["order"] = grid_dict["order"].as<std::string>();
+
+    if (has_indexes()) {
+        std::vector<std::string> idx = indexes();
+        Data indexes_list = Data::nils(idx.size());
+        for (std::size_t i = 0u; i < idx.size(); ++i)
+            indexes_list[i] = idx[i];
+        xor_dict["indexes"] = indexes_list;
+    }
+    else {
+        xor_dict["indexes"] = Data();
+    }
+
+    Data bytes = Data::byte_array(num_bytes);
+    char * dst = bytes.as_byte_array();
+    // a plain loop over contiguous memory, which the compiler
+    // vectorises at the optimisation levels we build with
+    for (std::size_t i = 0u; i < num_bytes; ++i)
+        dst[i] = a[i] ^ b[i];
+    xor_dict["data"] = bytes;
+
+    DataConstRef result(xor_dict);
+    result.lazy_grid_type_ = static_cast<char>(
+            is_block ? grid_block_type_id_for_(type_name)
+                     : grid_type_id_for_(type_name));
+    return result;
+}
+
+DataConstRef DataConstRef::sub_grid(
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & extents) const
+{
+    if (!is_a_grid_())
+        throw std::runtime_error(
+                "Tried to take a sub-grid, but this object is not a grid.");
+
+    std::vector<std::size_t> cur_shape = shape();
+    std::size_t ndims = cur_shape.size();
+    if (offsets.size() != ndims || extents.size() != ndims)
+        throw std::runtime_error(
+                "Offsets and extents must have one entry per grid"
+                " dimension.");
+    for (std::size_t i = 0u; i < ndims; ++i)
+        if (extents[i] == 0u || offsets[i] + extents[i] > cur_shape[i])
+            throw std::out_of_range(
+                    "The requested region does not fit inside the grid.");
+
+    DataConstRef grid_dict = grid_dict_();
+    std::string type_name = grid_dict["type"].as<std::string>();
+    std::size_t elem_size = grid_elem_size_(type_name);
+    StorageOrder order = storage_order();
+
+    // element stride of each dimension of this grid
+    std::vector<std::size_t> strides(ndims);
+    std::size_t stride = 1u;
+    for (std::size_t k = 0u; k < ndims; ++k) {
+        std::size_t d = (order == StorageOrder::last_adjacent)
+                ? ndims - 1u - k : k;
+        strides[d] = stride;
+        stride *= cur_shape[d];
+    }
+
+    std::size_t start = 0u;
+    for (std::size_t i = 0u; i < ndims; ++i)
+        start += offsets[i] * strides[i];
+
+    std::size_t num_elems = std::accumulate(
+            extents.cbegin(), extents.cend(), std::size_t(1u),
+            std::multiplies<std::size_t>());
+
+    // The region is one contiguous stretch of memory if, going from the
+    // fastest-varying dimension to the slowest, some prefix of the
+    // dimensions is taken in full, the next one is any range, and the
+    // remaining ones have extent one.
+    bool contiguous = true;
+    bool full_so_far = true;
+    for (std::size_t k = 0u; k < ndims; ++k) {
+        std::size_t d = (order == StorageOrder::last_adjacent)
+                ? ndims - 1u - k : k;
+        if (full_so_far) {
+            if (offsets[d] != 0u || extents[d] != cur_shape[d])
+                full_so_far = false;
+        }
+        else if (extents[d] != 1u) {
+            contiguous = false;
+            break;
+        }
+    }
+
+    char const * src = grid_dict["data"].as_byte_array();
+
+    auto sub_dict = Data::dict();
+    sub_dict["type"] = type_name;
+
+    Data shape_list = Data::nils(ndims);
+    for (std::size_t i = 0u; i < ndims; ++i)
+        shape_list[i] = extents[i];
+    sub_dict["shape"] = shape_list;
+
+    // describe the result's position relative to the global grid, so
+    // that slicing a block composes
+    std::vector<std::size_t> global_offs(offsets);
+    std::vector<std::size_t> glob_shape(cur_shape);
+    if (is_a_grid_block_()) {
+        std::vector<std::size_t> block_offs = this->offsets();
+        for (std::size_t i = 0u; i < ndims; ++i)
+            global_offs[i] += block_offs[i];
+        glob_shape = global_shape();
+    }
+
+    Data offsets_list = Data::nils(ndims);
+    for (std::size_t i = 0u; i < ndims; ++i)
+        offsets_list[i] = global_offs[i];
+    sub_dict["offsets"] = offsets_list;
+
+    Data global_shape_list = Data::nils(ndims);
+    for (std::size_t i = 0u; i < ndims; ++i)
+        global_shape_list[i] = glob_shape[i];
+    sub_dict["global_shape"] = global_shape_list;
+
+    if (order == StorageOrder::first_adjacent)
+        sub_dict["order"] = "fa";
+    else
+        sub_dict["order"] = "la";
+
+    if (has_indexes()) {
+        std::vector<std::string> idx = indexes();
+        Data indexes_list = Data::nils(idx.size());
+        for (std::size_t i = 0u; i < idx.size(); ++i)
+            indexes_list[i] = idx[i];
+        sub_dict["indexes"] = indexes_list;
+    }
+    else {
+        sub_dict["indexes"] = Data();
+    }
+
+    if (contiguous) {
+        // refers to the region in place, no copy is made
+        sub_dict["data"] = Data::byte_array(
+                src + start * elem_size, num_elems * elem_size);
+    }
+    else {
+        // gather the region run by run, a run being a contiguous
+        // stretch along the fastest-varying dimension
+        std::size_t fastest = (order == StorageOrder::last_adjacent)
+                ? ndims - 1u : 0u;
+        std::size_t run_elems = extents[fastest];
+        Data bytes = Data::byte_array(num_elems * elem_size);
+        char * dst = bytes.as_byte_array();
+
+        std::vector<std::size_t> index(ndims, 0u);
+        std::size_t num_runs = num_elems / run_elems;
+        for (std::size_t run = 0u; run < num_runs; ++run) {
+            std::size_t src_off = start;
+            for (std::size_t i = 0u; i < ndims; ++i)
+                src_off += index[i] * strides[i];
+            memcpy(dst + run * run_elems * elem_size,
+                    src + src_off * elem_size, run_elems * elem_size);
+
+            for (std::size_t k = 1u; k < ndims; ++k) {
+                std::size_t d = (order == StorageOrder::last_adjacent)
+                        ? ndims - 1u - k : k;
+                if (++index[d] < extents[d]) break;
+                index[d] = 0u;
+            }
+        }
+        sub_dict["data"] = bytes;
+    }
+
+    DataConstRef result(sub_dict);
+    result.lazy_grid_type_ = static_cast<char>(
+            grid_block_type_id_for_(type_name));
+    if (contiguous)
+        // the view refers into our buffer, so keep our zones (and via
+        // them, the buffer and any registered owner) alive with it
+        result.mp_zones_->insert(
+                result.mp_zones_->end(),
+                mp_zones_->cbegin(), mp_zones_->cend());
+    return result;
+}
+
 DataConstRef::DataConstRef(
         msgpack::object * obj,
         std::shared_ptr<msgpack::zone> const & zone)
@@ -677,13 +1901,17 @@ DataConstRef::DataConstRef(std::shared_ptr<msgpack::zone> const & zone)
 DataConstRef::DataConstRef(char ext_type_id, DataConstRef const & data)
     : DataConstRef()
 {
-    msgpack::sbuffer buf;
-    msgpack::pack(buf, data);
+    // Determine the packed size first, then pack directly into our zone.
+    // This avoids staging the packed data in a temporary buffer, which
+    // would double peak memory use for large grids.
+    PackedSizeBuffer sizer;
+    mcp::pack_data(sizer, data);
 
-    char * zoned_mem = zone_alloc_<char>(buf.size() + 1);
+    char * zoned_mem = zone_alloc_<char>(sizer.size + 1);
     zoned_mem[0] = ext_type_id;
-    memcpy(zoned_mem + 1, buf.data(), buf.size());
-    *mp_obj_ << msgpack::type::ext_ref(zoned_mem, buf.size() + 1);
+    ZoneBuffer buf(zoned_mem + 1);
+    mcp::pack_data(buf, data);
+    *mp_obj_ << msgpack::type::ext_ref(zoned_mem, sizer.size + 1);
 }
 
 std::vector<double> DataConstRef::as_vec_double_() const {
@@ -700,6 +1928,11 @@ std::vector<double> DataConstRef::as_vec_double_() const {
 }
 
 bool DataConstRef::is_a_grid_() const {
+    if (lazy_grid_type_)
+        // record batches share the lazy mechanism, but are not grids
+        return static_cast<mcp::ExtTypeId>(lazy_grid_type_)
+                != mcp::ExtTypeId::record_batch;
+
     if (mp_obj_->type != msgpack::type::EXT)
         return false;
 
@@ -708,10 +1941,33 @@ bool DataConstRef::is_a_grid_() const {
         || (ext_type == mcp::ExtTypeId::grid_int64)
         || (ext_type == mcp::ExtTypeId::grid_float32)
         || (ext_type == mcp::ExtTypeId::grid_float64)
-        || (ext_type == mcp::ExtTypeId::grid_bool);
+        || (ext_type == mcp::ExtTypeId::grid_bool)
+        || is_a_grid_block_();
+}
+
+bool DataConstRef::is_a_grid_block_() const {
+    if (lazy_grid_type_) {
+        auto lazy_type = static_cast<mcp::ExtTypeId>(lazy_grid_type_);
+        return lazy_type >= mcp::ExtTypeId::grid_block_int32
+            && lazy_type <= mcp::ExtTypeId::grid_block_bool;
+    }
+
+    if (mp_obj_->type != msgpack::type::EXT)
+        return false;
+
+    auto ext_type = static_cast<mcp::ExtTypeId>(mp_obj_->via.ext.type());
+    return (ext_type == mcp::ExtTypeId::grid_block_int32)
+        || (ext_type == mcp::ExtTypeId::grid_block_int64)
+        || (ext_type == mcp::ExtTypeId::grid_block_float32)
+        || (ext_type == mcp::ExtTypeId::grid_block_float64)
+        || (ext_type == mcp::ExtTypeId::grid_block_bool);
 }
 
 DataConstRef DataConstRef::grid_dict_() const {
+    if (lazy_grid_type_)
+        // not packed yet, mp_obj_ still refers to the dict itself
+        return DataConstRef(mp_obj_, mp_zones_);
+
     auto ext = mp_obj_->as<msgpack::type::ext>();
     auto oh = msgpack::unpack(ext.data(), ext.size());
 
@@ -719,11 +1975,37 @@ DataConstRef DataConstRef::grid_dict_() const {
         throw std::runtime_error("Invalid grid format. Bug in MUSCLE3?");
 
     if (!obj_cache_)
+        // the ext data lives in our zone, so a view is safe here and
+        // avoids copying the grid data into the zone again
         obj_cache_ = std::make_shared<DataConstRef>(
-                mcp::unpack_data(mp_zones_->at(0), ext.data(), ext.size()));
+                mcp::unpack_data_view(mp_zones_->at(0), ext.data(), ext.size()));
     return *obj_cache_;
 }
 
+void DataConstRef::materialise_() const {
+    if (!lazy_grid_type_)
+        return;
+
+    DataConstRef grid_dict(mp_obj_, mp_zones_);
+
+    // Determine the packed size first, then pack directly into our zone.
+    // This stages nothing, so the element data is copied exactly once,
+    // straight out of the caller's buffer.
+    PackedSizeBuffer sizer;
+    msgpack::pack(sizer, grid_dict);
+
+    char * zoned_mem = zone_alloc_<char>(sizer.size + 1);
+    zoned_mem[0] = lazy_grid_type_;
+    ZoneBuffer buf(zoned_mem + 1);
+    msgpack::pack(buf, grid_dict);
+
+    // Overwrite in place, so that any copies sharing this object are
+    // materialised along with us.
+    *mp_obj_ << msgpack::type::ext_ref(zoned_mem, sizer.size + 1);
+    lazy_grid_type_ = 0;
+    obj_cache_.reset();
+}
+
 /* This is here in the .cpp and instantiated explicitly, because it requires the
  * ExtTypeId, and we don't want to have that in a public header since it's a
  * detail of an internal format.
@@ -754,7 +2036,7 @@ Data Data::grid(
         grid_dict["order"] = "la";
 
     std::size_t num_elems = std::accumulate(
-        shape.cbegin(), shape.cend(), 1u,
+        shape.cbegin(), shape.cend(), std::size_t(1u),
         std::multiplies<std::size_t>());
     grid_dict["data"] = Data::byte_array(
         reinterpret_cast<char const *>(data), num_elems * sizeof(Element));
@@ -806,12 +2088,219 @@ template Data Data::grid<bool>(
 
 #endif
 
+/* Data is a friend of DataConstRef, so we can build the view there and
+ * then wrap its object and zones, rather than duplicating the builder.
+ */
+template <typename Element>
+Data Data::grid_view(
+        Element const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner
+) {
+    DataConstRef view = DataConstRef::grid_view(
+            data, shape, indexes, storage_order, owner);
+    Data result(view.mp_obj_, view.mp_zones_);
+    result.lazy_grid_type_ = view.lazy_grid_type_;
+    return result;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template Data Data::grid_view<std::int32_t>(
+        std::int32_t const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_view<std::int64_t>(
+        std::int64_t const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_view<float>(
+        float const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_view<double>(
+        double const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_view<bool>(
+        bool const * const data,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+#endif
+
+template <typename Element>
+Data Data::grid_block_view(
+        Element const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner
+) {
+    DataConstRef view = DataConstRef::grid_block_view(
+            data, offsets, shape, global_shape, indexes, storage_order, owner);
+    Data result(view.mp_obj_, view.mp_zones_);
+    result.lazy_grid_type_ = view.lazy_grid_type_;
+    return result;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template Data Data::grid_block_view<std::int32_t>(
+        std::int32_t const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_block_view<std::int64_t>(
+        std::int64_t const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_block_view<float>(
+        float const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_block_view<double>(
+        double const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+template Data Data::grid_block_view<bool>(
+        bool const * const data,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & shape,
+        std::vector<std::size_t> const & global_shape,
+        std::vector<std::string> const & indexes,
+        StorageOrder storage_order,
+        std::shared_ptr<const void> const & owner);
+
+#endif
+
+Data Data::record_batch(std::size_t num_records) {
+    auto batch_dict = Data::dict();
+    batch_dict["len"] = num_records;
+    batch_dict["types"] = Data::dict();
+    batch_dict["columns"] = Data::dict();
+
+    // Like a grid view, the batch stays a dict until it is added to a
+    // message, dict or list, at which point materialise_() packs it as
+    // an ext object; that copies each column's bytes in one go.
+    batch_dict.lazy_grid_type_ = static_cast<char>(
+            mcp::ExtTypeId::record_batch);
+    return batch_dict;
+}
+
+template <typename Element>
+void Data::add_column(std::string const & name, Element const * data) {
+    if (static_cast<mcp::ExtTypeId>(lazy_grid_type_)
+            != mcp::ExtTypeId::record_batch)
+        throw std::runtime_error(
+                "Tried to add a column to something that is not a record"
+                " batch, or to a record batch that has already been added"
+                " to a message, dict or list.");
+
+    // underneath we're still the dict made by record_batch(), make it
+    // accessible again while we modify it
+    lazy_grid_type_ = 0;
+    std::size_t num_records = (*this)["len"].as<std::size_t>();
+
+    Data bytes = Data::byte_array(num_records * sizeof(Element));
+    memcpy(bytes.as_byte_array(), data, num_records * sizeof(Element));
+
+    (*this)["types"][name] = grid_type_name_<Element>();
+    (*this)["columns"][name] = bytes;
+    lazy_grid_type_ = static_cast<char>(mcp::ExtTypeId::record_batch);
+}
+
+/* Bool columns are converted to single bytes, matching the on-the-wire
+ * format of bool grids.
+ */
+template <>
+void Data::add_column<bool>(std::string const & name, bool const * data) {
+    if (static_cast<mcp::ExtTypeId>(lazy_grid_type_)
+            != mcp::ExtTypeId::record_batch)
+        throw std::runtime_error(
+                "Tried to add a column to something that is not a record"
+                " batch, or to a record batch that has already been added"
+                " to a message, dict or list.");
+
+    lazy_grid_type_ = 0;
+    std::size_t num_records = (*this)["len"].as<std::size_t>();
+
+    Data bytes = Data::byte_array(num_records);
+    char * data_copy = bytes.as_byte_array();
+    std::copy(data, data + num_records, data_copy);
+
+    (*this)["types"][name] = grid_type_name_<bool>();
+    (*this)["columns"][name] = bytes;
+    lazy_grid_type_ = static_cast<char>(mcp::ExtTypeId::record_batch);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+template void Data::add_column<double>(
+        std::string const & name, double const * data);
+
+template void Data::add_column<float>(
+        std::string const & name, float const * data);
+
+template void Data::add_column<std::int32_t>(
+        std::string const & name, std::int32_t const * data);
+
+template void Data::add_column<std::int64_t>(
+        std::string const & name, std::int64_t const * data);
+
+#endif
+
 Data Data::dict() {
     Data dict;
     dict.init_dict_(0u);
     return dict;
 }
 
+Data Data::dict_reserve(std::size_t size) {
+    Data dict;
+    dict.init_dict_(size);
+    dict.mp_obj_->via.map.size = 0u;
+    dict.dict_capacity_ = size;
+    return dict;
+}
+
 Data Data::list() {
     Data list;
     list.init_list_(0u);
@@ -826,26 +2315,52 @@ Data Data::nils(std::size_t size) {
     return list;
 }
 
-Data Data::byte_array(uint32_t size) {
+Data Data::byte_array(std::size_t size) {
     Data bytes;
     bytes.mp_obj_->type = msgpack::type::BIN;
-    bytes.mp_obj_->via.bin.size = size;
-    bytes.mp_obj_->via.bin.ptr = bytes.zone_alloc_<char>(size);
+    bytes.mp_obj_->via.bin.size = checked_bin_size_(size);
+    if (size >= huge_buffer_threshold_)
+        bytes.mp_obj_->via.bin.ptr = map_large_buffer_(
+                bytes.first_zone_(), size);
+    else
+        bytes.mp_obj_->via.bin.ptr = bytes.zone_alloc_<char>(size);
     return bytes;
 }
 
-Data Data::byte_array(char const * buf, uint32_t size) {
+Data Data::byte_array(char const * buf, std::size_t size) {
     Data bytes;
     bytes.mp_obj_->type = msgpack::type::BIN;
-    bytes.mp_obj_->via.bin.size = size;
+    bytes.mp_obj_->via.bin.size = checked_bin_size_(size);
     bytes.mp_obj_->via.bin.ptr = buf;
     return bytes;
 }
 
+Data Data::byte_array(
+        char const * buf, std::size_t size,
+        std::shared_ptr<const void> const & owner
+) {
+    Data bytes = byte_array(buf, size);
+    if (owner) {
+        // Keep the owner's buffer alive for as long as our zones, which is
+        // at least as long as anything may refer to it.
+        auto keepalive = new std::shared_ptr<const void>(owner);
+        bytes.first_zone_().push_finalizer(
+                [](void * ptr) {
+                    delete static_cast<std::shared_ptr<const void> *>(ptr);
+                },
+                keepalive);
+    }
+    return bytes;
+}
+
 Data & Data::operator=(Data const & rhs) {
     if (mp_obj_ != rhs.mp_obj_) {
+        rhs.materialise_();
         *mp_obj_ = *rhs.mp_obj_;
         obj_cache_ = rhs.obj_cache_;
+        // we no longer know how much space the dict's storage has, if it
+        // is one, so be conservative
+        dict_capacity_ = 0u;
 
         if (
                 rhs.mp_obj_->type == msgpack::type::STR ||
@@ -867,7 +2382,7 @@ Data & Data::operator=(Data const & rhs) {
 }
 
 Data Data::operator[](std::string const & key) {
-    if (mp_obj_->type == msgpack::type::MAP) {
+    if (is_a_dict()) {
         for (uint32_t i = 0; i < mp_obj_->via.map.size; ++i) {
             auto const & mkey = mp_obj_->via.map.ptr[i].key;
             if (mkey.type == msgpack::type::STR)
@@ -876,16 +2391,24 @@ Data Data::operator[](std::string const & key) {
                         return Data(&(mp_obj_->via.map.ptr[i].val), mp_zones_);
         }
 
-        // key is not in here, reallocate and add
-        msgpack::object_kv * new_ptr = zone_alloc_<msgpack::object_kv>(mp_obj_->via.map.size + 1);
-        for (uint32_t i = 0u; i < mp_obj_->via.map.size; ++i)
-            new_ptr[i] = mp_obj_->via.map.ptr[i];
-        mp_obj_->via.map.ptr = new_ptr;
+        // key is not in here, add it, making space first if needed
+        if (mp_obj_->via.map.size >= dict_capacity_) {
+            uint32_t new_capacity = (mp_obj_->via.map.size > 0u)
+                ? 2u * mp_obj_->via.map.size : 1u;
+            msgpack::object_kv * new_ptr = zone_alloc_<msgpack::object_kv>(new_capacity);
+            for (uint32_t i = 0u; i < mp_obj_->via.map.size; ++i)
+                new_ptr[i] = mp_obj_->via.map.ptr[i];
+            mp_obj_->via.map.ptr = new_ptr;
+            dict_capacity_ = new_capacity;
+        }
         ++mp_obj_->via.map.size;
 
+        // a key index built earlier doesn't have the new key, so drop it
+        key_index_.reset();
+
         // add new key
         auto & new_kv = mp_obj_->via.map.ptr[mp_obj_->via.map.size - 1];
-        new_kv.key = msgpack::object(key, *mp_zones_->front());
+        new_kv.key = interned_key_(key, *mp_zones_->front());
         new_kv.val = msgpack::object();
         return Data(&new_kv.val, mp_zones_);
     }
@@ -893,7 +2416,7 @@ Data Data::operator[](std::string const & key) {
 }
 
 Data Data::value(std::size_t i) const {
-    if (mp_obj_->type == msgpack::type::MAP) {
+    if (is_a_dict()) {
         if (i < size())
             return Data(&(mp_obj_->via.map.ptr[i].val), mp_zones_);
         else
@@ -923,10 +2446,31 @@ char * Data::as_byte_array() {
     return const_cast<char *>(mp_obj_->via.bin.ptr);
 }
 
+/* Creates a msgpack string object to use as a dict key.
+ *
+ * If the key can be interned, then the returned object refers to the
+ * interned storage, which outlives any zone; otherwise the key is
+ * copied into the given zone as usual.
+ */
+msgpack::object Data::interned_key_(
+        std::string const & key, msgpack::zone & zone)
+{
+    char const * interned = key_intern_pool_().intern(key);
+    if (interned) {
+        msgpack::object obj;
+        obj.type = msgpack::type::STR;
+        obj.via.str.ptr = interned;
+        obj.via.str.size = static_cast<uint32_t>(key.size());
+        return obj;
+    }
+    return msgpack::object(key, zone);
+}
+
 void Data::set_dict_item_(
         uint32_t offset, std::string const & key, DataConstRef const & value
 ) {
-    mp_obj_->via.map.ptr[offset].key = msgpack::object(key, *mp_zones_->front());
+    value.materialise_();
+    mp_obj_->via.map.ptr[offset].key = interned_key_(key, *mp_zones_->front());
     mp_obj_->via.map.ptr[offset].val = msgpack::object(value, *mp_zones_->front());
     mp_zones_->insert(mp_zones_->end(), value.mp_zones_->cbegin(), value.mp_zones_->cend());
 }
@@ -934,7 +2478,8 @@ void Data::set_dict_item_(
 void Data::set_dict_item_(
         uint32_t offset, std::string const & key, Data const & value
 ) {
-    mp_obj_->via.map.ptr[offset].key = msgpack::object(key, *mp_zones_->front());
+    value.materialise_();
+    mp_obj_->via.map.ptr[offset].key = interned_key_(key, *mp_zones_->front());
     mp_obj_->via.map.ptr[offset].val = msgpack::object(value, *mp_zones_->front());
     mp_zones_->insert(mp_zones_->end(), value.mp_zones_->cbegin(), value.mp_zones_->cend());
 }
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -23,13 +25,26 @@ class DataConstRef;
 
 class Data;
 
+class GridTemplate;
+
 bool is_close_port(DataConstRef const &);
 
 namespace mcp {
-    // forward-declare this so it can be a friend
+    // forward-declare these so they can be friends
     Data unpack_data(
             std::shared_ptr<msgpack::zone> const & zone,
             char const * begin, std::size_t length);
+
+    Data unpack_data(char const * begin, std::size_t length);
+
+    Data unpack_data_view(
+            std::shared_ptr<msgpack::zone> const & zone,
+            char const * begin, std::size_t length);
+
+    Data unpack_data_view(DataConstRef const & bytes);
+
+    template <typename Stream>
+    void pack_data(Stream & stream, DataConstRef const & data);
 }
 
 /** A const reference to some kind of data.
@@ -167,6 +182,76 @@ class DataConstRef {
                 std::vector<std::string> const & indexes = {},
                 StorageOrder storage_order = StorageOrder::last_adjacent);
 
+        /** Create a DataConstRef object referring to a grid's data.
+         *
+         * This is a zero-copy alternative to grid(). Where grid() copies the
+         * element data into the object when it is created, grid_view() only
+         * stores a reference to your buffer. The data is then serialised
+         * directly from your buffer when the object is sent, or when it is
+         * added to a dict or list. So where grid() requires memory for two
+         * copies of the data, grid_view() requires only one, and it does not
+         * spend any time copying the data when it is created.
+         *
+         * The price for this is that you need to guarantee that the buffer
+         * stays valid for long enough. If you pass an owner, then libmuscle
+         * will hold on to it for as long as it may access the buffer, and
+         * you don't have to do anything. Pass a ``shared_ptr`` that owns the
+         * buffer, or one with a custom deleter if your buffer needs special
+         * clean-up. If you pass nullptr for the owner, then you must keep the
+         * buffer valid and unchanged until this object and all copies of it
+         * (including any messages it was added to) have been destroyed.
+         *
+         * Types, shapes, storage orders and indexes are as for grid(), see
+         * there for a description.
+         *
+         * @tparam Element The type of the elements.
+         * @param data Pointer to the array data.
+         * @param shape The shape of the array.
+         * @param indexes Names of the array's indexes.
+         * @param storage_order The storage order of the array data.
+         * @param owner Shared ownership of the buffer, or nullptr.
+         */
+        template <typename Element>
+        static DataConstRef grid_view(
+                Element const * const data,
+                std::vector<std::size_t> const & shape,
+                std::vector<std::string> const & indexes = {},
+                StorageOrder storage_order = StorageOrder::last_adjacent,
+                std::shared_ptr<const void> const & owner = nullptr);
+
+        /** Create a DataConstRef object referring to a block of a grid.
+         *
+         * A grid block is a rectangular piece of a larger grid, as
+         * produced by a domain decomposition. It carries its own shape
+         * and data, like a grid, plus the shape of the global grid it
+         * is part of and the offsets at which it starts within it. A
+         * decomposed grid can then be sent as a list of blocks, one per
+         * rank, without ever assembling the global array in one
+         * process's memory.
+         *
+         * Like grid_view(), this does not copy the element data; see
+         * there for the ownership contract. Types, shapes, storage
+         * orders and indexes are as for grid().
+         *
+         * @tparam Element The type of the elements.
+         * @param data Pointer to the block's array data.
+         * @param offsets Position of the block within the global grid.
+         * @param shape The shape of the block.
+         * @param global_shape The shape of the global grid.
+         * @param indexes Names of the array's indexes.
+         * @param storage_order The storage order of the array data.
+         * @param owner Shared ownership of the buffer, or nullptr.
+         */
+        template <typename Element>
+        static DataConstRef grid_block_view(
+                Element const * const data,
+                std::vector<std::size_t> const & offsets,
+                std::vector<std::size_t> const & shape,
+                std::vector<std::size_t> const & global_shape,
+                std::vector<std::string> const & indexes = {},
+                StorageOrder storage_order = StorageOrder::last_adjacent,
+                std::shared_ptr<const void> const & owner = nullptr);
+
         /** Create a DataConstRef object from a SettingValue's value.
          *
          * Note that this will decode to whichever type is stored in the
@@ -207,6 +292,15 @@ class DataConstRef {
          */
         void reseat(DataConstRef const & target);
 
+        /** Reseat the reference, taking over the target.
+         *
+         * As reseat(), but moving the target's internals over rather
+         * than copying them, which is cheaper.
+         *
+         * @param target The object to refer to.
+         */
+        void reseat(DataConstRef && target);
+
         /** Determine the type of the referenced data.
          *
          * This works for the following types:
@@ -271,6 +365,41 @@ class DataConstRef {
         template <typename Element>
         bool is_a_grid_of() const;
 
+        /** Return whether this references a grid block of the given
+         * element type.
+         *
+         * Supported element types are as for is_a_grid_of(). If this
+         * returns true, then the grid accessors shape(),
+         * storage_order(), indexes() and elements() apply to the block,
+         * and offsets() and global_shape() describe where it sits in
+         * the decomposed grid it is part of.
+         *
+         * @tparam Element The type of the elements of the array.
+         */
+        template <typename Element>
+        bool is_a_grid_block_of() const;
+
+        /** Return whether this references a grid or grid block of any
+         * element type.
+         *
+         * Use this where the element type does not matter, e.g. in
+         * infrastructure code that passes grids along; use
+         * is_a_grid_of() before accessing the elements.
+         *
+         * @return True iff this references a grid or grid block.
+         */
+        bool is_a_grid() const;
+
+        /** Return whether this references a record batch.
+         *
+         * If so, num_records(), column_names(), has_column() and
+         * column() can be used to access the columns. See
+         * Data::record_batch() for a description of record batches.
+         *
+         * @return True iff this references a record batch.
+         */
+        bool is_a_record_batch() const;
+
         /** Return whether this references a byte array.
          *
          * If so, as_byte_array() can be used to obtain values, and size()
@@ -280,11 +409,12 @@ class DataConstRef {
          */
         bool is_a_byte_array() const;
 
-        /** Returns the size of a list, dict, grid or byte array.
+        /** Returns the size of a list, dict, grid, record batch or byte
+         * array.
          *
          * @return The number of items in a referenced list or dict value, the
-         *         number of elements in a grid, or the number of bytes in a
-         *         byte array.
+         *         number of elements in a grid, the number of records in a
+         *         record batch, or the number of bytes in a byte array.
          */
         std::size_t size() const;
 
@@ -370,6 +500,66 @@ class DataConstRef {
          */
         DataConstRef value(std::size_t i) const;
 
+        /** An iterator over the keys of a dictionary, see keys().
+         *
+         * Dereferencing yields the key as a pointer to its first
+         * character and its length. Unlike key(), this refers directly
+         * into the encoded message, so iterating over the keys does not
+         * allocate or copy strings. The referenced characters are not
+         * null-terminated, and remain valid for as long as the
+         * DataConstRef the iterator came from exists.
+         */
+        class KeyIterator {
+            public:
+                using value_type = std::pair<char const *, std::size_t>;
+                using reference = value_type;
+                using pointer = void;
+                using difference_type = std::ptrdiff_t;
+                using iterator_category = std::input_iterator_tag;
+
+                value_type operator*() const;
+                KeyIterator & operator++();
+                bool operator==(KeyIterator const & rhs) const;
+                bool operator!=(KeyIterator const & rhs) const;
+
+            private:
+                friend class DataConstRef;
+                KeyIterator(msgpack::object const * obj, uint32_t i);
+
+                msgpack::object const * obj_;
+                uint32_t i_;
+        };
+
+        /** A range over the keys of a dictionary, see keys(). */
+        class Keys {
+            public:
+                KeyIterator begin() const;
+                KeyIterator end() const;
+
+            private:
+                friend class DataConstRef;
+                explicit Keys(msgpack::object const * obj);
+
+                msgpack::object const * obj_;
+        };
+
+        /** Get the keys of this dictionary.
+         *
+         * Use only if is_a_dict() returns true.
+         *
+         * The returned range can be iterated over with a range-based
+         * for loop. See KeyIterator for what it yields; unlike calling
+         * key() for each index in turn, this does not create a string
+         * object per key.
+         *
+         * The range and its iterators refer into this object, so they
+         * must not outlive it.
+         *
+         * @return A range over the keys of this dictionary.
+         * @throws std::runtime_error if the object is not a map.
+         */
+        Keys keys() const;
+
         /** Access an item in a list.
          *
          * Use only if is_a_list() returns true.
@@ -440,6 +630,78 @@ class DataConstRef {
          */
         std::vector<std::string> indexes() const;
 
+        /** Get the offsets of a grid block within the global grid.
+         *
+         * Use only if is_a_grid_block_of() returns true.
+         *
+         * The offsets give, for each dimension, the index in the global
+         * grid at which this block starts.
+         *
+         * @return The offsets of the block.
+         * @throws std::runtime_error if the object is not a grid block.
+         */
+        std::vector<std::size_t> offsets() const;
+
+        /** Get the shape of the global grid a block is part of.
+         *
+         * Use only if is_a_grid_block_of() returns true.
+         *
+         * @return The shape of the global grid.
+         * @throws std::runtime_error if the object is not a grid block.
+         */
+        std::vector<std::size_t> global_shape() const;
+
+        /** XOR the elements of this grid with those of another grid.
+         *
+         * Use only if both objects are grids of the same element type
+         * and shape.
+         *
+         * The result is a grid with this grid's metadata whose element
+         * bytes are the XOR of the two grids' element bytes. XOR is its
+         * own inverse, so this both computes the difference between two
+         * successive states and reconstructs a state from such a
+         * difference; where the grids agree the result is zero bytes,
+         * which compress very well. See Communicator for the delta
+         * sending mode built on this.
+         *
+         * @param other The grid to XOR with.
+         * @return A grid holding the combined elements.
+         * @throws std::runtime_error if either object is not a grid, or
+         *      if the element types or shapes differ.
+         */
+        DataConstRef grid_xor(DataConstRef const & other) const;
+
+        /** Get a rectangular region of a grid.
+         *
+         * Use only if is_a_grid_of() returns true.
+         *
+         * This returns the region of this grid that starts at the given
+         * offsets and is of the given extents, as a grid block (see
+         * grid_block_view()), so that offsets() and global_shape() on
+         * the result describe where the region sits in this grid. The
+         * element type, storage order and any index names carry over.
+         * Slicing a grid block gives a block of the same global grid,
+         * with the offsets added up.
+         *
+         * If the region is contiguous in memory, e.g. a slab of
+         * complete rows of a last-adjacent grid, then no element data
+         * is copied: the result refers to this grid's buffer, which is
+         * kept alive for as long as the result is in use. Any other
+         * region is gathered into a new buffer row by row.
+         *
+         * @param offsets For each dimension, the index at which the
+         *      region starts.
+         * @param extents For each dimension, the size of the region.
+         * @return A grid block holding the given region.
+         * @throws std::runtime_error if the object is not a grid, or if
+         *      offsets or extents don't have one entry per dimension.
+         * @throws std::out_of_range if the region does not fit inside
+         *      the grid.
+         */
+        DataConstRef sub_grid(
+                std::vector<std::size_t> const & offsets,
+                std::vector<std::size_t> const & extents) const;
+
         /** Get the elements (data values) of a grid.
          *
          * Use only if is_a_grid_of<Element>() returns true.
@@ -457,6 +719,78 @@ class DataConstRef {
         template <typename Element>
         Element const * elements() const;
 
+        /** Get the elements of a grid, converted to the given type.
+         *
+         * Use only if this is a grid; the elements may be of any type.
+         *
+         * Unlike elements(), which returns a pointer to the values as
+         * stored and requires the exact type, this widens or narrows
+         * each value to the requested type, e.g. reading a float64 grid
+         * as float32. Narrowing follows the usual C++ conversion rules,
+         * so values may lose precision or overflow.
+         *
+         * The conversion is a plain loop over contiguous memory that
+         * the compiler vectorises, so it runs at close to memory
+         * bandwidth even for very large grids.
+         *
+         * @tparam Element The type to convert the elements to.
+         * @return A vector with the converted values, in the grid's
+         *      storage order.
+         * @throws std::runtime_error if the object is not a grid.
+         */
+        template <typename Element>
+        std::vector<Element> elements_as() const;
+
+        /** Get the number of records in a record batch.
+         *
+         * Use only if is_a_record_batch() returns true. Each column of
+         * the batch holds this many values.
+         *
+         * @return The number of records.
+         * @throws std::runtime_error if the object is not a record batch.
+         */
+        std::size_t num_records() const;
+
+        /** Get the names of the columns of a record batch.
+         *
+         * Use only if is_a_record_batch() returns true. The names are
+         * returned in the order in which the columns were added.
+         *
+         * @return The column names.
+         * @throws std::runtime_error if the object is not a record batch.
+         */
+        std::vector<std::string> column_names() const;
+
+        /** Return whether a record batch has a column with the given name.
+         *
+         * Use only if is_a_record_batch() returns true.
+         *
+         * @param name The column name to look for.
+         * @return True iff the batch has a column with this name.
+         * @throws std::runtime_error if the object is not a record batch.
+         */
+        bool has_column(std::string const & name) const;
+
+        /** Get the values of a column of a record batch.
+         *
+         * Use only if is_a_record_batch() returns true. The element
+         * type must match the one the column was added with; supported
+         * types are as for grid(). Use num_records() for the number of
+         * values.
+         *
+         * The returned pointer refers to the values contiguously in
+         * memory, and is valid at least as long as this object exists.
+         *
+         * @tparam Element The type of the values stored in the column.
+         * @param name The name of the column to access.
+         * @return A pointer to the column's values.
+         * @throws std::runtime_error if the object is not a record
+         *      batch, or if the column is of a different type.
+         * @throws std::out_of_range if there is no column with this name.
+         */
+        template <typename Element>
+        Element const * column(std::string const & name) const;
+
     protected:
         using Zones_ = std::shared_ptr<std::vector<std::shared_ptr<msgpack::zone>>>;
         Zones_ mp_zones_;
@@ -465,6 +799,17 @@ class DataConstRef {
         // cache for extracted complex object, e.g. Settings, Grid
         mutable std::shared_ptr<DataConstRef> obj_cache_;
 
+        // key lookup index for larger dicts, built lazily on first
+        // subscript. See operator[](std::string const &).
+        mutable std::shared_ptr<std::unordered_map<std::string, uint32_t>>
+            key_index_;
+
+        // ext type id of a not-yet-packed grid view, 0 if this is not one.
+        // If set, then mp_obj_ refers to the grid dict rather than to a
+        // packed ext object, and the dict's data member refers to a
+        // caller-owned buffer. See materialise_().
+        mutable char lazy_grid_type_ = 0;
+
         // create DCR pointing to the given object and sharing the given zone
         DataConstRef(
                 msgpack::object * data,
@@ -483,7 +828,19 @@ class DataConstRef {
 
         // allocate an object on this object's zone
         template <typename T>
-        T * zone_alloc_(uint32_t size = 1u);
+        T * zone_alloc_(std::size_t size = 1u) const;
+
+        // record a zone allocation in the live memory gauge, if
+        // accounting is enabled; see instrumentation
+        void track_zone_alloc_(std::size_t num_bytes) const;
+
+        // get a zone for a new object, reusing a recycled one if available
+        static std::shared_ptr<msgpack::zone> zone_from_pool_();
+
+        // get this object's first zone, creating one if there is none
+        // yet; nil and scalar objects don't have one, see the default
+        // constructor
+        msgpack::zone & first_zone_() const;
 
         std::vector<double> as_vec_double_() const;
 
@@ -492,12 +849,32 @@ class DataConstRef {
 
         // see comment at Data::init_dict_'s implementation
         friend class Data;
+        friend class GridTemplate;
         friend bool ::libmuscle::impl::is_close_port(DataConstRef const &);
+        friend Data libmuscle::impl::mcp::unpack_data_view(
+                DataConstRef const & bytes);
+        friend Data libmuscle::impl::mcp::unpack_data(
+                char const * begin, std::size_t length);
+        template <typename Stream>
+        friend void libmuscle::impl::mcp::pack_data(
+                Stream & stream, DataConstRef const & data);
 
         bool is_a_grid_() const;
 
+        bool is_a_grid_block_() const;
+
         DataConstRef grid_dict_() const;
 
+        /* Pack a lazy grid view into this object's zone.
+         *
+         * This turns a grid view created by grid_view() into a regular
+         * packed grid ext object, copying the element data out of the
+         * caller's buffer in the process. Does nothing if this is not a
+         * lazy grid view. Called before this object is packed or embedded
+         * into a dict or list.
+         */
+        void materialise_() const;
+
         template <typename Element>
         DataConstRef grid_data_(Element const * const data, std::size_t num_elems) const;
 };
@@ -572,6 +949,105 @@ class Data : public DataConstRef {
                 std::vector<std::string> const & indexes = {},
                 StorageOrder storage_order = StorageOrder::last_adjacent);
 
+        /** Create a Data object referring to a grid's data.
+         *
+         * This is a zero-copy alternative to grid(). Where grid() copies the
+         * element data into the object when it is created, grid_view() only
+         * stores a reference to your buffer. The data is then serialised
+         * directly from your buffer when the object is sent, or when it is
+         * added to a dict or list. So where grid() requires memory for two
+         * copies of the data, grid_view() requires only one, and it does not
+         * spend any time copying the data when it is created.
+         *
+         * The price for this is that you need to guarantee that the buffer
+         * stays valid for long enough. If you pass an owner, then libmuscle
+         * will hold on to it for as long as it may access the buffer, and
+         * you don't have to do anything. Pass a ``shared_ptr`` that owns the
+         * buffer, or one with a custom deleter if your buffer needs special
+         * clean-up. If you pass nullptr for the owner, then you must keep the
+         * buffer valid and unchanged until this object and all copies of it
+         * (including any messages it was added to) have been destroyed.
+         *
+         * Types, shapes, storage orders and indexes are as for grid(), see
+         * there for a description.
+         *
+         * @tparam Element The type of the elements.
+         * @param data Pointer to the array data.
+         * @param shape The shape of the array.
+         * @param indexes Names of the array's indexes.
+         * @param storage_order The storage order of the array data.
+         * @param owner Shared ownership of the buffer, or nullptr.
+         */
+        template <typename Element>
+        static Data grid_view(
+                Element const * const data,
+                std::vector<std::size_t> const & shape,
+                std::vector<std::string> const & indexes = {},
+                StorageOrder storage_order = StorageOrder::last_adjacent,
+                std::shared_ptr<const void> const & owner = nullptr);
+
+        /** Create a Data object containing a block of a decomposed grid.
+         *
+         * This is grid_block_view() returning a Data object; see
+         * DataConstRef::grid_block_view() for a description.
+         *
+         * @tparam Element The type of the elements.
+         * @param data Pointer to the block's array data.
+         * @param offsets Position of the block within the global grid.
+         * @param shape The shape of the block.
+         * @param global_shape The shape of the global grid.
+         * @param indexes Names of the array's indexes.
+         * @param storage_order The storage order of the array data.
+         * @param owner Shared ownership of the buffer, or nullptr.
+         */
+        template <typename Element>
+        static Data grid_block_view(
+                Element const * const data,
+                std::vector<std::size_t> const & offsets,
+                std::vector<std::size_t> const & shape,
+                std::vector<std::size_t> const & global_shape,
+                std::vector<std::string> const & indexes = {},
+                StorageOrder storage_order = StorageOrder::last_adjacent,
+                std::shared_ptr<const void> const & owner = nullptr);
+
+        /** Create a Data object containing an empty record batch.
+         *
+         * A record batch holds a set of records that all have the same
+         * fields, stored as one named column of values per field. Use
+         * this instead of a list of dicts when sending many records,
+         * e.g. the particles of a particle model: a column's values are
+         * copied into the message in one go, where a list of a million
+         * dicts is packed value by value, with the field names repeated
+         * in every record. Encoding and decoding a batch runs at memcpy
+         * speed as a result.
+         *
+         * The batch is created empty; use add_column() to add a column
+         * of values for each field. On the receiving side, use
+         * is_a_record_batch(), num_records(), column_names() and
+         * column() to access the data.
+         *
+         * @param num_records The number of records in the batch, i.e.
+         *      the length of each column.
+         * @return A Data containing a record batch without any columns.
+         */
+        static Data record_batch(std::size_t num_records);
+
+        /** Add a column to a record batch.
+         *
+         * Use only on an object created by record_batch(). The values
+         * are copied in, so the pointer only needs to be valid during
+         * this call. Supported element types are as for grid().
+         *
+         * @tparam Element The type of the values in the column.
+         * @param name The name of the field this column holds.
+         * @param data Pointer to num_records values for this column.
+         * @throws std::runtime_error if this object is not a record
+         *      batch, or if it has already been added to a message,
+         *      dict or list.
+         */
+        template <typename Element>
+        void add_column(std::string const & name, Element const * data);
+
         /** Create a Data containing an empty dictionary.
          *
          * @returns A Data containing an empty dictionary.
@@ -600,6 +1076,22 @@ class Data : public DataConstRef {
          */
         static Data dict(Args const &... args);
 
+        /** Create a Data containing an empty dictionary with reserved space.
+         *
+         * The dictionary starts out empty, but space for size entries is
+         * preallocated. Adding a new key via operator[] normally reallocates
+         * the dictionary's storage and copies all existing entries over, for
+         * every key added. With the space reserved up front, each new key is
+         * instead written into the next free slot, and nothing is
+         * reallocated or copied until the reserved space runs out. Use this
+         * if you're building a dictionary with many keys one at a time, in
+         * particular if you're doing so repeatedly, e.g. once per time step.
+         *
+         * @param size The number of entries to reserve space for.
+         * @returns A Data containing an empty dictionary.
+         */
+        static Data dict_reserve(std::size_t size);
+
         /** Create a Data containing an empty list.
          *
          * @returns A Data containing an empty list.
@@ -627,8 +1119,16 @@ class Data : public DataConstRef {
          *
          * The buffer will be owned by this Data object. Use as_byte_array() to
          * get a pointer to put data into it.
+         *
+         * Large buffers (2 MB and up) are mapped separately and backed
+         * by transparent huge pages where the kernel supports it, which
+         * speeds up both serialisation and access to the data.
+         *
+         * @param size The size of the buffer, at most 2^32 - 1 bytes.
+         * @throws std::runtime_error if size exceeds what the MessagePack
+         *      wire format can represent.
          */
-        static Data byte_array(uint32_t size);
+        static Data byte_array(std::size_t size);
 
         /** Create a Data referencing a byte array.
          *
@@ -638,9 +1138,28 @@ class Data : public DataConstRef {
          * it) is used.
          *
          * @param buffer A pointer to the beginning of the buffer.
-         * @param size The size of the buffer.
+         * @param size The size of the buffer, at most 2^32 - 1 bytes.
+         * @throws std::runtime_error if size exceeds what the MessagePack
+         *      wire format can represent.
+         */
+        static Data byte_array(char const * buffer, std::size_t size);
+
+        /** Create a byte array object that shares ownership of its buffer.
+         *
+         * As byte_array(char const *, std::size_t), but the returned object
+         * participates in ownership of the buffer through the given
+         * shared pointer, and keeps it alive for as long as the data may
+         * be referred to. See grid() for the same mechanism.
+         *
+         * @param buffer A pointer to the beginning of the buffer.
+         * @param size The size of the buffer, at most 2^32 - 1 bytes.
+         * @param owner A shared pointer through which the buffer is owned.
+         * @throws std::runtime_error if size exceeds what the MessagePack
+         *      wire format can represent.
          */
-        static Data byte_array(char const * buffer, uint32_t size);
+        static Data byte_array(
+                char const * buffer, std::size_t size,
+                std::shared_ptr<const void> const & owner);
 
         /** Copy-assign the given value to this Data object.
          *
@@ -717,6 +1236,11 @@ class Data : public DataConstRef {
         char * as_byte_array();
 
     private:
+        // create a msgpack string object for a dict key, referring to
+        // interned key storage where possible. See data.cpp.
+        static msgpack::object interned_key_(
+                std::string const & key, msgpack::zone & zone);
+
         // this requires packing, so needs to be non-template
         void set_dict_item_(
                 uint32_t offset,
@@ -763,11 +1287,20 @@ class Data : public DataConstRef {
                 uint32_t offset, Arg const & value,
                 Args const &...args);
 
+        // number of entries for which storage is known to be available, if
+        // this object is a dictionary. See dict_reserve() and operator[].
+        uint32_t dict_capacity_ = 0u;
+
         friend struct msgpack::adaptor::pack<Data>;
         friend struct msgpack::adaptor::object_with_zone<Data>;
         friend Data libmuscle::impl::mcp::unpack_data(
                 std::shared_ptr<msgpack::zone> const & zone,
                 char const * begin, std::size_t length);
+        friend Data libmuscle::impl::mcp::unpack_data_view(
+                std::shared_ptr<msgpack::zone> const & zone,
+                char const * begin, std::size_t length);
+        friend Data libmuscle::impl::mcp::unpack_data_view(
+                DataConstRef const & bytes);
 };
 
 } }   // namespace libmuscle::impl
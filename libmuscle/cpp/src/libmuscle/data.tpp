@@ -29,11 +29,11 @@ T DataConstRef::as() const {
 }
 
 template <typename T>
-T * DataConstRef::zone_alloc_(uint32_t size) {
-    if (mp_zones_->empty())
-        mp_zones_->push_back(std::make_shared<msgpack::zone>(24));
+T * DataConstRef::zone_alloc_(std::size_t size) const {
+    auto & zone = first_zone_();
     auto num_bytes = sizeof(T) * size;
-    return static_cast<T*>((*mp_zones_)[0]->allocate_align(
+    track_zone_alloc_(num_bytes);
+    return static_cast<T*>(zone.allocate_align(
                 num_bytes, MSGPACK_ZONE_ALIGNOF(T)));
 }
 
@@ -81,7 +81,7 @@ void Data::init_dict_(uint32_t offset, std::string const & key, Arg const & valu
                 Args const & ... args)
 {
     init_dict_(offset + 1, args...);
-    mp_obj_->via.map.ptr[offset].key = msgpack::object(key, *mp_zones_->front());
+    mp_obj_->via.map.ptr[offset].key = interned_key_(key, *mp_zones_->front());
     mp_obj_->via.map.ptr[offset].val = msgpack::object(value, *mp_zones_->front());
 }
 
@@ -89,6 +89,7 @@ template <typename... Args>
 void Data::init_list_(uint32_t offset, DataConstRef const & value,
                       Args const &...args) {
     init_list_(offset + 1, args...);
+    value.materialise_();
     mp_obj_->via.array.ptr[offset] = msgpack::object(value, *mp_zones_->front());
     mp_zones_->insert(mp_zones_->end(), value.mp_zones_->cbegin(), value.mp_zones_->cend());
 }
@@ -97,6 +98,7 @@ template <typename... Args>
 void Data::init_list_(uint32_t offset, Data const & value,
                       Args const &...args) {
     init_list_(offset + 1, args...);
+    value.materialise_();
     mp_obj_->via.array.ptr[offset] = msgpack::object(value, *mp_zones_->front());
     mp_zones_->insert(mp_zones_->end(), value.mp_zones_->cbegin(), value.mp_zones_->cend());
 }
@@ -3,6 +3,7 @@
 
 using ymmsl::Identifier;
 using ymmsl::Reference;
+using ymmsl::ReferencePart;
 
 
 namespace libmuscle { namespace impl {
@@ -12,32 +13,64 @@ Endpoint::Endpoint(
         std::vector<int> const & index,
         Identifier const & port,
         std::vector<int> const & slot)
-    : kernel(kernel)
-    , index(index)
-    , port(port)
-    , slot(slot)
+    : kernel_(kernel)
+    , index_(index)
+    , port_(port)
+    , slot_(slot)
 {}
 
-Reference Endpoint::ref() const {
-    Reference ret(kernel);
-    if (!index.empty())
-        ret += index;
-    ret += port;
-    if (!slot.empty())
-        ret += slot;
-    return ret;
+Reference const & Endpoint::ref() const {
+    if (!ref_cache_.is_set()) {
+        // build the parts in one go; concatenating onto a Reference
+        // would reallocate and rehash it at every step
+        std::vector<ReferencePart> parts;
+        parts.reserve(kernel_.length() + index_.size() + 1u + slot_.size());
+        parts.insert(parts.end(), kernel_.cbegin(), kernel_.cend());
+        for (int i : index_)
+            parts.push_back(i);
+        parts.push_back(port_);
+        for (int s : slot_)
+            parts.push_back(s);
+        ref_cache_ = Reference(std::move(parts));
+    }
+    return ref_cache_.get();
 }
 
 Endpoint::operator std::string() const {
     return static_cast<std::string>(ref());
 }
 
-Reference Endpoint::instance() const {
-    Reference ret(kernel);
-    if (!index.empty())
-        ret += index;
-    return ret;
+Reference const & Endpoint::instance() const {
+    if (!instance_cache_.is_set()) {
+        std::vector<ReferencePart> parts;
+        parts.reserve(kernel_.length() + index_.size());
+        parts.insert(parts.end(), kernel_.cbegin(), kernel_.cend());
+        for (int i : index_)
+            parts.push_back(i);
+        instance_cache_ = Reference(std::move(parts));
+    }
+    return instance_cache_.get();
 }
 
-} }
+void Endpoint::set_slot(std::vector<int> const & slot) {
+    slot_ = slot;
+    ref_cache_ = {};
+}
+
+Reference const & Endpoint::kernel() const {
+    return kernel_;
+}
+
+std::vector<int> const & Endpoint::index() const {
+    return index_;
+}
 
+Identifier const & Endpoint::port() const {
+    return port_;
+}
+
+std::vector<int> const & Endpoint::slot() const {
+    return slot_;
+}
+
+} }
@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 
+#include <libmuscle/util.hpp>
+
 #include <ymmsl/ymmsl.hpp>
 
 
@@ -65,9 +67,13 @@ class Endpoint {
          * This yields a valid Reference of the form kernel[index].port[slot],
          * with index and port omitted if they are zero-length.
          *
+         * The Reference is built on first use and cached; endpoints are
+         * reused across messages (see PeerManager::get_peer_endpoints())
+         * and this is asked for several times per message.
+         *
          * @return A Reference to this Endpoint.
          */
-        ymmsl::Reference ref() const;
+        ymmsl::Reference const & ref() const;
 
         /** Convert to string.
          *
@@ -79,20 +85,43 @@ class Endpoint {
         explicit operator std::string() const;
 
         /** Get a Reference to the instance this endpoint is on.
+         *
+         * Cached like ref() is.
+         */
+        ymmsl::Reference const & instance() const;
+
+        /** Replace the slot of this endpoint.
+         *
+         * This invalidates the cached ref(); the instance does not
+         * depend on the slot, so its cache is kept.
+         *
+         * @param slot The new slot.
+         */
+        void set_slot(std::vector<int> const & slot);
+
+        /** Name of the instance's kernel.
          */
-        ymmsl::Reference instance() const;
+        ymmsl::Reference const & kernel() const;
 
-        /// Name of the instance's kernel.
-        ymmsl::Reference kernel;
+        /** Index of the kernel instance.
+         */
+        std::vector<int> const & index() const;
 
-        /// Index of the kernel instance.
-        std::vector<int> index;
+        /** Name of the port used.
+         */
+        ymmsl::Identifier const & port() const;
 
-        /// Name of the port used.
-        ymmsl::Identifier port;
+        /** Slot on which to send or receive.
+         */
+        std::vector<int> const & slot() const;
 
-        /// Slot on which to send or receive.
-        std::vector<int> slot;
+    private:
+        ymmsl::Reference kernel_;
+        std::vector<int> index_;
+        ymmsl::Identifier port_;
+        std::vector<int> slot_;
+        mutable Optional<ymmsl::Reference> ref_cache_;
+        mutable Optional<ymmsl::Reference> instance_cache_;
 };
 
 } }
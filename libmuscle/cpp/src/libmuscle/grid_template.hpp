@@ -0,0 +1,82 @@
+#pragma once
+
+#include <libmuscle/data.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace libmuscle { namespace impl {
+
+/** Reusable metadata for grids that share a shape and element type.
+ *
+ * A model that sends the same field on every iteration rebuilds the
+ * grid's metadata dict, with its shape list, index names and storage
+ * order, on every grid() or grid_view() call, even though none of it
+ * changes between iterations. A GridTemplate builds that metadata
+ * once; with_elements() then produces a send-ready grid that shares
+ * it, so per-iteration grid construction no longer depends on the
+ * number of dimensions or the length of the index names.
+ *
+ * Grids made by with_elements() refer to your buffer without copying
+ * it, exactly as grid_view() does; see there for the rules on how
+ * long the buffer must stay valid and what passing an owner does.
+ *
+ * A GridTemplate is immutable once created, so a single template may
+ * be used from several threads at the same time.
+ */
+class GridTemplate {
+    public:
+        /** Create a GridTemplate for grids of the given shape.
+         *
+         * Types, shapes, storage orders and indexes are as for
+         * DataConstRef::grid(), see there for a description.
+         *
+         * @tparam Element The type of the elements.
+         * @param shape The shape of the grids to be made.
+         * @param indexes Names of the grids' indexes.
+         * @param storage_order The storage order of the element data.
+         */
+        template <typename Element>
+        static GridTemplate for_type(
+                std::vector<std::size_t> const & shape,
+                std::vector<std::string> const & indexes = {},
+                StorageOrder storage_order = StorageOrder::last_adjacent);
+
+        /** Create a grid of this template's shape from the given buffer.
+         *
+         * The result is equivalent to a grid_view() of the buffer with
+         * this template's shape, indexes and storage order, but is made
+         * without re-encoding any of that metadata.
+         *
+         * @tparam Element The type of the elements, which must match
+         *      the type the template was created for.
+         * @param data Pointer to the array data.
+         * @param owner Shared ownership of the buffer, or nullptr.
+         * @return A DataConstRef referring to the buffer.
+         * @throws std::runtime_error if Element does not match the
+         *      template's element type.
+         */
+        template <typename Element>
+        DataConstRef with_elements(
+                Element const * data,
+                std::shared_ptr<const void> const & owner = nullptr) const;
+
+    private:
+        GridTemplate(
+                DataConstRef const & grid_dict, char grid_type,
+                std::size_t num_elems, std::string const & type_name);
+
+        // the grid dict, with everything but the element data filled in
+        DataConstRef grid_dict_;
+        // ext type id of the element type, see data.cpp
+        char grid_type_;
+        // number of elements in a grid of this template's shape
+        std::size_t num_elems_;
+        // name of the element type, for error messages
+        std::string type_name_;
+};
+
+} }
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <libmuscle/data.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace libmuscle { namespace impl {
+
+/** A typed view on a grid held by a DataConstRef.
+ *
+ * DataConstRef checks the type of the grid against the msgpack payload
+ * on every elements() call, and shape() builds a new vector each time,
+ * which makes them too slow to call from inner loops. A GridView does
+ * that work once, at construction: it validates the element type and
+ * the number of dimensions, and derives the strides from the shape and
+ * storage order. After that, operator() is plain array indexing that
+ * the compiler can vectorise, since the number of dimensions is a
+ * compile time constant.
+ *
+ * The view refers to memory owned by the DataConstRef it was made
+ * from, and keeps that object alive for as long as it exists.
+ *
+ * @tparam Element The type of the elements of the grid, one of the
+ *      types supported by DataConstRef::is_a_grid_of().
+ * @tparam num_dims The number of dimensions of the grid.
+ */
+template <typename Element, std::size_t num_dims>
+class GridView {
+    public:
+        /** Create a GridView of the given grid.
+         *
+         * @param data A DataConstRef holding a grid of the right type
+         *      and dimensionality.
+         *
+         * @throws std::runtime_error if the data is not a grid, if the
+         *      elements are not of type Element, or if the grid does
+         *      not have num_dims dimensions.
+         */
+        explicit GridView(DataConstRef const & data)
+            : data_(data)
+        {
+            if (!data_.is_a_grid_of<Element>())
+                throw std::runtime_error(
+                        "Tried to create a GridView of an object that is"
+                        " not a grid of the requested element type.");
+
+            auto shape = data_.shape();
+            if (shape.size() != num_dims) {
+                std::ostringstream oss;
+                oss << "Tried to create a " << num_dims << "-dimensional";
+                oss << " GridView of a grid with " << shape.size();
+                oss << " dimensions.";
+                throw std::runtime_error(oss.str());
+            }
+
+            for (std::size_t i = 0u; i < num_dims; ++i)
+                shape_[i] = shape[i];
+
+            if (data_.storage_order() == StorageOrder::last_adjacent) {
+                std::size_t stride = 1u;
+                for (std::size_t i = num_dims; i > 0u; --i) {
+                    strides_[i - 1u] = stride;
+                    stride *= shape_[i - 1u];
+                }
+            }
+            else {
+                std::size_t stride = 1u;
+                for (std::size_t i = 0u; i < num_dims; ++i) {
+                    strides_[i] = stride;
+                    stride *= shape_[i];
+                }
+            }
+
+            elements_ = data_.elements<Element>();
+        }
+
+        /** Access an element of the grid.
+         *
+         * One index per dimension must be given, and each must be in
+         * range for its dimension; indices are not bounds-checked.
+         *
+         * @param indices The indices of the element to access.
+         *
+         * @return The value of the element at the given indices.
+         */
+        template <typename... Indices>
+        Element const & operator()(Indices... indices) const {
+            static_assert(
+                    sizeof...(indices) == num_dims,
+                    "Number of indices does not match the GridView's"
+                    " number of dimensions");
+            std::size_t const idx[num_dims] = {
+                    static_cast<std::size_t>(indices)...};
+            std::size_t offset = 0u;
+            for (std::size_t i = 0u; i < num_dims; ++i)
+                offset += idx[i] * strides_[i];
+            return elements_[offset];
+        }
+
+        /** Get the size of the given dimension.
+         *
+         * @param dim The dimension to get the size of.
+         *
+         * @return The number of elements along that dimension.
+         */
+        std::size_t shape(std::size_t dim) const {
+            return shape_[dim];
+        }
+
+        /** Get the total number of elements in the grid.
+         */
+        std::size_t size() const {
+            std::size_t result = 1u;
+            for (std::size_t i = 0u; i < num_dims; ++i)
+                result *= shape_[i];
+            return result;
+        }
+
+        /** Get a raw pointer to the elements of the grid.
+         *
+         * The elements are stored contiguously, in the grid's storage
+         * order; see DataConstRef::storage_order().
+         */
+        Element const * data() const {
+            return elements_;
+        }
+
+    private:
+        DataConstRef data_;
+        Element const * elements_;
+        std::size_t shape_[num_dims];
+        std::size_t strides_[num_dims];
+};
+
+} }
@@ -1,18 +1,39 @@
 #include <libmuscle/instance.hpp>
 
+#include <libmuscle/checkpoint_triggers.hpp>
 #include <libmuscle/communicator.hpp>
+#include <libmuscle/compression.hpp>
 #include <libmuscle/data.hpp>
+#include <libmuscle/instrumentation.hpp>
 #include <libmuscle/mcp/data_pack.hpp>
+#include <libmuscle/mcp/tcp_util.hpp>
+#include <libmuscle/mcp/transfer_scheduler.hpp>
 #include <libmuscle/logger.hpp>
 #include <libmuscle/mmp_client.hpp>
 #include <libmuscle/peer_manager.hpp>
+#include <libmuscle/profiler.hpp>
+#include <libmuscle/profiling.hpp>
 #include <libmuscle/settings_manager.hpp>
+#include <libmuscle/snapshot_manager.hpp>
+#include <libmuscle/trace.hpp>
+#include <libmuscle/tuning.hpp>
 
 #include <ymmsl/ymmsl.hpp>
 
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
 #include <stdexcept>
+#include <typeinfo>
+#include <unordered_set>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #ifdef MUSCLE_ENABLE_MPI
 #include <libmuscle/mpi_tcp_barrier.hpp>
@@ -23,11 +44,16 @@ using ymmsl::Operator;
 using ymmsl::Reference;
 using ymmsl::Settings;
 
+using libmuscle::impl::DataConstRef;
 using libmuscle::impl::LogLevel;
 
 
 namespace {
 
+// format version of the peer cache file, see Instance::Impl; version 2
+// added the CRC32C trailer and is loaded by mapping the file
+int const peer_cache_version_ = 2;
+
 /* Converts a user-input string to a log level.
  *
  * The input is case-insensitive.
@@ -53,6 +79,65 @@ LogLevel string_to_level(std::string const & log_level_str) {
     return level;
 }
 
+/* Locates the payload bytes of a grid of the given element type.
+ *
+ * Returns false if the object is not a grid of this type.
+ */
+template <typename Element>
+bool grid_payload_(
+        DataConstRef const & data,
+        char const * & src, std::size_t & num_bytes)
+{
+    if (!data.is_a_grid_of<Element>())
+        return false;
+    src = reinterpret_cast<char const *>(data.elements<Element>());
+    num_bytes = data.size() * sizeof(Element);
+    return true;
+}
+
+/* Locates the payload bytes of a grid or byte array.
+ *
+ * Returns false if the object is neither.
+ */
+bool payload_bytes_(
+        DataConstRef const & data,
+        char const * & src, std::size_t & num_bytes)
+{
+    if (data.is_a_byte_array()) {
+        src = data.as_byte_array();
+        num_bytes = data.size();
+        return true;
+    }
+    return grid_payload_<double>(data, src, num_bytes)
+        || grid_payload_<float>(data, src, num_bytes)
+        || grid_payload_<std::int64_t>(data, src, num_bytes)
+        || grid_payload_<std::int32_t>(data, src, num_bytes)
+        || grid_payload_<bool>(data, src, num_bytes);
+}
+
+/* Locates the payload bytes of a record batch column, probing the
+ * element type.
+ *
+ * Returns false if there is no such column or it is of another type.
+ */
+template <typename Element>
+bool column_payload_(
+        DataConstRef const & batch, std::string const & name,
+        char const * & src, std::size_t & num_bytes)
+{
+    try {
+        src = reinterpret_cast<char const *>(batch.column<Element>(name));
+    }
+    catch (std::runtime_error const &) {
+        return false;
+    }
+    catch (std::out_of_range const &) {
+        return false;
+    }
+    num_bytes = batch.num_records() * sizeof(Element);
+    return true;
+}
+
 }
 
 
@@ -62,7 +147,8 @@ class Instance::Impl {
     public:
         Impl(
                 int argc, char const * const argv[],
-                PortsDescription const & ports
+                PortsDescription const & ports,
+                InstanceFlags flags
 #ifdef MUSCLE_ENABLE_MPI
                 , MPI_Comm const & communicator
                 , int root
@@ -75,6 +161,7 @@ class Instance::Impl {
         ::ymmsl::SettingValue get_setting(std::string const & name) const;
         template <typename ValueType>
         ValueType get_setting_as(std::string const & name) const;
+        ::ymmsl::Settings get_settings() const;
         std::unordered_map<::ymmsl::Operator, std::vector<std::string>>
         list_ports() const;
         bool is_connected(std::string const & port) const;
@@ -82,34 +169,140 @@ class Instance::Impl {
         bool is_resizable(std::string const & port) const;
         int get_port_length(std::string const & port) const;
         void set_port_length(std::string const & port, int length);
+        PortHandle port(std::string const & port_name);
         void send(std::string const & port_name, Message const & message);
         void send(std::string const & port_name, Message const & message,
                 int slot);
+        void send(std::string const & port_name, Message && message);
+        void send(std::string const & port_name, Message && message,
+                int slot);
+        void send(PortHandle const & port_handle, Message const & message);
+        void send(PortHandle const & port_handle, Message const & message,
+                int slot);
+        void send(PortHandle const & port_handle, Message && message);
+        void send(PortHandle const & port_handle, Message && message,
+                int slot);
+        std::future<void> send_async(
+                std::string const & port_name, Message const & message,
+                Optional<int> slot = {});
+        void send_range(
+                std::string const & port_name, int first_slot, int last_slot,
+                std::function<Message(int)> const & make_message);
+        void send_sample(
+                std::string const & port_name, double timestamp,
+                double value);
+        void flush_samples(std::string const & port_name);
+        SampleWindow receive_samples(std::string const & port_name);
         Message receive_message(
                 std::string const & port_name,
                 Optional<int> slot,
-                Optional<Message> default_msg,
+                Optional<Message> const & default_msg,
+                bool with_settings,
+                Optional<double> timeout = {});
+        Message receive_message(
+                PortHandle const & port_handle,
+                Optional<int> slot,
+                Optional<Message> const & default_msg,
                 bool with_settings);
+        void register_receive_target(
+                std::string const & port_name,
+                Optional<std::string> const & key,
+                void * dest, std::size_t num_bytes);
+        void register_receive_callback(
+                std::string const & port_name,
+                Optional<std::string> const & key,
+                std::function<void(char const *, std::size_t)> callback);
+        void start_receive(
+                std::string const & port_name, Optional<int> slot = {});
+        std::vector<Message> receive_all(std::string const & port_name);
+        std::vector<Message> receive_batch(
+                std::string const & port_name, int max_messages);
+        std::string wait_any(std::vector<std::string> const & port_names);
+        std::vector<double> forward_batch(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                int max_messages);
+        double forward_message(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                Optional<int> slot);
+        bool resuming();
+        bool should_init();
+        Message load_snapshot();
+        bool should_save_snapshot(double timestamp);
+        void save_snapshot(Message const & message);
+        bool should_save_final_snapshot();
+        void save_final_snapshot(Message const & message);
+        std::string memory_report() const;
 
     private:
         ::ymmsl::Reference instance_name_;
         std::unique_ptr<MMPClient> manager_;
         std::unique_ptr<Logger> logger_;
+        std::unique_ptr<Profiler> profiler_;
         std::unique_ptr<Communicator> communicator_;
 #ifdef MUSCLE_ENABLE_MPI
         int mpi_root_;
         MPI_Comm mpi_comm_;
         MPITcpBarrier mpi_barrier_;
+        // port description received from the root at start-up, so that
+        // the non-root processes can answer port queries locally
+        std::unordered_map<::ymmsl::Operator, std::vector<std::string>>
+                mpi_port_ops_;
+        std::unordered_map<std::string, bool> mpi_port_connected_;
+        std::unordered_map<std::string, bool> mpi_port_is_vector_;
+        // overlay generation last broadcast to the non-root processes
+        Optional<std::size_t> overlay_bcast_generation_;
 #endif
         PortsDescription declared_ports_;
         SettingsManager settings_manager_;
-        bool first_run_;
+        std::future<::ymmsl::Settings> base_settings_future_;
+        InstanceFlags flags_;
+        TriggerManager trigger_manager_;
+        std::unique_ptr<SnapshotManager> snapshot_manager_;
+        Optional<bool> first_run_;
+        Optional<bool> do_reuse_;
+        bool do_resume_;
+        bool do_init_;
         std::unordered_map<::ymmsl::Reference, Message> f_init_cache_;
+        // samples accumulated per streaming port, waiting for their
+        // window to fill up; see send_sample()
+        struct SampleBuffer_ {
+            std::vector<double> timestamps;
+            std::vector<double> values;
+            std::size_t window = 0u;    // 0 until resolved on first use
+        };
+        std::unordered_map<std::string, SampleBuffer_> sample_buffers_;
+        // ports that were unconnected when we connected to our peers,
+        // mapped to whether they are F_INIT ports; a receive with a
+        // default on one of them returns the default without any port
+        // lookups, see receive_message()
+        std::unordered_map<std::string, bool> unconnected_ports_;
+        // model-owned buffers that received payloads are copied into
+        // directly, per port; see register_receive_target(). If
+        // callback is set instead of dest, then the payload is handed
+        // to it in place of the copy, see register_receive_callback()
+        struct ReceiveTarget_ {
+            Optional<std::string> key;
+            void * dest;
+            std::size_t num_bytes;
+            std::function<void(char const *, std::size_t)> callback;
+        };
+        std::unordered_map<std::string, std::vector<ReceiveTarget_>>
+                receive_targets_;
         bool is_shut_down_;
+        // memoised port topology, which is fixed once we're connected;
+        // see have_f_init_connections_() and pre_receive_f_init_()
+        Optional<bool> have_f_init_connections_cache_;
+        Optional<std::vector<std::string>> f_init_ports_cache_;
+        // overlay generation the log levels were last derived from, so
+        // an unchanged overlay doesn't re-derive them every reuse
+        Optional<std::size_t> log_levels_generation_;
 
         void register_();
         void connect_();
         void deregister_();
+        void setup_checkpointing_();
 
         ::ymmsl::Reference make_full_name_(int argc, char const * const argv[]) const;
         std::string extract_manager_location_(int argc, char const * const argv[]) const;
@@ -117,13 +310,46 @@ class Instance::Impl {
         std::vector<int> index_() const;
         std::vector<::ymmsl::Port> list_declared_ports_() const;
         void check_port_(std::string const & port_name);
+        Codec codec_for_port_(std::string const & port_name) const;
+        int delta_interval_for_port_(std::string const & port_name) const;
+        int prefetch_depth_for_port_(std::string const & port_name) const;
+        std::size_t stream_window_for_port_(
+                std::string const & port_name) const;
+        void send_sample_window_(
+                std::string const & port_name, SampleBuffer_ & buffer);
+        std::string peer_cache_file_() const;
+        Data read_peer_cache_() const;
+        int cached_tcp_port_() const;
+        bool connect_from_cache_();
+        void write_peer_cache_(
+                std::vector<::ymmsl::Conduit> const & conduits,
+                PeerDims const & peer_dims,
+                PeerLocations const & peer_locations) const;
+        Message receive_message_(
+                std::string const & port_name,
+                PortHandle const * port_handle,
+                Optional<int> slot,
+                Optional<Message> const & default_msg,
+                bool with_settings,
+                Optional<double> timeout = {});
+        void scatter_to_targets_(
+                std::string const & port_name, Message const & message);
         bool receive_settings_();
+        bool decide_reuse_instance_(bool apply_overlay);
+        bool have_f_init_connections_();
+        bool pre_receive_all_(bool apply_overlay);
         void pre_receive_(
                 std::string const & port_name,
                 Optional<int> slot, bool apply_overlay);
         void pre_receive_f_init_(bool apply_overlay);
+        void check_checkpointing_support_() const;
+        void save_snapshot_(
+                Optional<Message> const & message, bool final,
+                Optional<double> f_init_max_timestamp);
+        Optional<double> f_init_max_timestamp_() const;
         void set_local_log_level_();
         void set_remote_log_level_();
+        void set_transfer_shaping_();
         void apply_overlay_(Message const & message);
         void check_compatibility_(
                 std::string const & port_name,
@@ -140,7 +366,8 @@ class Instance::Impl {
 
 Instance::Impl::Impl(
         int argc, char const * const argv[],
-        PortsDescription const & ports
+        PortsDescription const & ports,
+        InstanceFlags flags
 #ifdef MUSCLE_ENABLE_MPI
         , MPI_Comm const & communicator
         , int root
@@ -153,10 +380,18 @@ Instance::Impl::Impl(
 #endif
     , declared_ports_(ports)
     , settings_manager_()
-    , first_run_(true)
+    , flags_(flags)
+    , first_run_()
+    , do_reuse_()
+    , do_resume_(false)
+    , do_init_(false)
     , f_init_cache_()
     , is_shut_down_(false)
 {
+    if (getenv("MUSCLE_INSTRUMENTATION") != nullptr)
+        instrumentation::enable_signal_dump();
+    if (instrumentation::tracing_enabled())
+        instrumentation::enable_trace_dump();
 #ifdef MUSCLE_ENABLE_MPI
     MPI_Comm_dup(communicator, &mpi_comm_);
     if (mpi_barrier_.is_root()) {
@@ -167,16 +402,51 @@ Instance::Impl::Impl(
         std::string default_logfile = "muscle_" + instance_id + ".log";
         std::string log_file = extract_log_file_location(argc, argv, default_logfile);
         logger_.reset(new Logger(instance_id, log_file, *manager_));
+        profiler_.reset(new Profiler(instance_id, *manager_));
 
-        communicator_.reset(new Communicator(name_(), index_(), ports, *logger_, 0));
+        // must run before the Communicator exists, which is when the
+        // transport tunables are first read
+        if (tuning::autotune_enabled())
+            tuning::apply_tuned_defaults(*logger_);
+
+        communicator_.reset(new Communicator(
+                name_(), index_(), ports, *logger_, *profiler_,
+                cached_tcp_port_()));
         register_();
         connect_();
         set_local_log_level_();
         set_remote_log_level_();
+        set_transfer_shaping_();
+        snapshot_manager_.reset(new SnapshotManager(
+                instance_name_, *manager_, *communicator_, *logger_));
+        setup_checkpointing_();
 #ifdef MUSCLE_ENABLE_MPI
-        auto sbase_data = Data(settings_manager_.base);
+        // Pack the base settings and the port description into a single
+        // buffer, so that the non-root processes get everything they can
+        // answer locally in one broadcast.
+        auto ports_by_op = communicator_->list_ports();
+        std::size_t num_ports = 0u;
+        for (auto const & op_ports : ports_by_op)
+            num_ports += op_ports.second.size();
+        Data port_names = Data::nils(num_ports);
+        Data port_opers = Data::nils(num_ports);
+        Data port_conn = Data::nils(num_ports);
+        Data port_vec = Data::nils(num_ports);
+        std::size_t i = 0u;
+        for (auto const & op_ports : ports_by_op)
+            for (auto const & port_name : op_ports.second) {
+                auto const & port = communicator_->get_port(port_name);
+                port_names[i] = port_name;
+                port_opers[i] = static_cast<int>(op_ports.first);
+                port_conn[i] = port.is_connected();
+                port_vec[i] = port.is_vector();
+                ++i;
+            }
+        Data startup_data = Data::list(
+                Data(settings_manager_.base), port_names, port_opers,
+                port_conn, port_vec);
         msgpack::sbuffer sbuf;
-        msgpack::pack(sbuf, sbase_data);
+        mcp::pack_data(sbuf, startup_data);
         int size = sbuf.size();
         MPI_Bcast(&size, 1, MPI_INT, mpi_root_, mpi_comm_);
         MPI_Bcast(sbuf.data(), size, MPI_CHAR, mpi_root_, mpi_comm_);
@@ -186,9 +456,16 @@ Instance::Impl::Impl(
         MPI_Bcast(&size, 1, MPI_INT, mpi_root_, mpi_comm_);
         std::vector<char> buf(size);
         MPI_Bcast(&buf[0], size, MPI_CHAR, mpi_root_, mpi_comm_);
-        auto zone = std::make_shared<msgpack::zone>();
-        DataConstRef sbase_data = mcp::unpack_data(zone, &buf[0], size);
-        settings_manager_.base = sbase_data.as<Settings>();
+        DataConstRef startup_data = mcp::unpack_data(&buf[0], size);
+        settings_manager_.base = startup_data[0].as<Settings>();
+        settings_manager_.prefetch(instance_name_);
+        for (std::size_t i = 0u; i < startup_data[1].size(); ++i) {
+            std::string port_name = startup_data[1][i].as<std::string>();
+            auto oper = static_cast<Operator>(startup_data[2][i].as<int>());
+            mpi_port_ops_[oper].push_back(port_name);
+            mpi_port_connected_[port_name] = startup_data[3][i].as<bool>();
+            mpi_port_is_vector_[port_name] = startup_data[4][i].as<bool>();
+        }
     }
 #endif
 }
@@ -205,67 +482,81 @@ bool Instance::Impl::reuse_instance(bool apply_overlay) {
 #ifdef MUSCLE_ENABLE_MPI
     if (mpi_barrier_.is_root()) {
 #endif
-        do_reuse = receive_settings_();
-
-        // TODO: f_init_cache_ should be empty here, or the user didn't receive
-        // something that was sent on the last go-around. At least emit a warning.
-        pre_receive_f_init_(apply_overlay);
-
-        set_local_log_level_();
-        set_remote_log_level_();
-
-        auto ports = communicator_->list_ports();
-
-        bool f_init_not_connected = true;
-        if (ports.count(Operator::F_INIT) != 0)
-            for (auto const & port : ports.at(Operator::F_INIT))
-                if (communicator_->get_port(port).is_connected()) {
-                    f_init_not_connected = false;
-                    break;
-                }
-
-        bool no_settings_in = !communicator_->settings_in_connected();
-
-        if (f_init_not_connected && no_settings_in) {
-            do_reuse = first_run_;
-            first_run_ = false;
+        if (do_reuse_.is_set()) {
+            // should_save_final_snapshot() already made the decision
+            do_reuse = do_reuse_.get();
+            do_reuse_ = {};
         }
-        else {
-            for (auto const & ref_msg : f_init_cache_)
-                if (is_close_port(ref_msg.second.data()))
-                        do_reuse = false;
+        else
+            do_reuse = decide_reuse_instance_(apply_overlay);
+
+        // An instance without checkpointing API support does not save
+        // snapshots itself, so save one implicitly if needed
+        bool do_implicit_checkpoint =
+                first_run_.is_set() && !first_run_.get() &&
+                !(flags_ & InstanceFlags::USES_CHECKPOINT_API) &&
+                !!(flags_ & (InstanceFlags::KEEPS_NO_STATE_FOR_NEXT_USE |
+                             InstanceFlags::STATE_NOT_REQUIRED_FOR_NEXT_USE));
+        if (do_implicit_checkpoint) {
+            auto f_init_max_timestamp = f_init_max_timestamp_();
+            if (trigger_manager_.should_save_final_snapshot(
+                        do_reuse, f_init_max_timestamp))
+                save_snapshot_({}, true, f_init_max_timestamp);
+            communicator_->set_checkpoints_considered_until(
+                    trigger_manager_.checkpoints_considered_until());
         }
 
-#ifdef MUSCLE_ENABLE_MPI
-        mpi_barrier_.signal();
-        int do_reuse_mpi = do_reuse;
-        MPI_Bcast(&do_reuse_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
-    }
-    else {
-        mpi_barrier_.wait();
-        int do_reuse_mpi;
-        MPI_Bcast(&do_reuse_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
-        do_reuse = do_reuse_mpi;
-    }
-#endif
+        // The log levels and the transfer shaping derive from the
+        // settings, so they only need re-deriving when the overlay
+        // actually changed; receive_settings_
+        // keeps the overlay (and its generation) if the received settings
+        // are equal, so in steady state this is a single comparison. In
+        // particular it avoids the exceptions thrown and caught for each
+        // level that isn't set, on every pass around the reuse loop.
+        std::size_t overlay_generation =
+            settings_manager_.overlay.generation();
+        if (
+                !log_levels_generation_.is_set() ||
+                log_levels_generation_.get() != overlay_generation) {
+            set_local_log_level_();
+            set_remote_log_level_();
+            set_transfer_shaping_();
+            log_levels_generation_ = overlay_generation;
+        }
 
 #ifdef MUSCLE_ENABLE_MPI
-    if (mpi_barrier_.is_root()) {
-        auto soverlay_data = Data(settings_manager_.overlay);
+        mpi_barrier_.signal();
+        // The reuse decision and the overlay size go into one broadcast,
+        // and the overlay itself is only sent when it changed since the
+        // last one. In steady state, receive_settings_ keeps the overlay
+        // (see above), so each pass sends a single small broadcast.
+        bool send_overlay =
+                !overlay_bcast_generation_.is_set() ||
+                overlay_bcast_generation_.get() != overlay_generation;
         msgpack::sbuffer sbuf;
-        msgpack::pack(sbuf, soverlay_data);
-        int size = sbuf.size();
-        MPI_Bcast(&size, 1, MPI_INT, mpi_root_, mpi_comm_);
-        MPI_Bcast(sbuf.data(), size, MPI_CHAR, mpi_root_, mpi_comm_);
+        if (send_overlay) {
+            auto soverlay_data = Data(settings_manager_.overlay);
+            mcp::pack_data(sbuf, soverlay_data);
+            overlay_bcast_generation_ = overlay_generation;
+        }
+        int header[2] = {
+                do_reuse ? 1 : 0,
+                send_overlay ? static_cast<int>(sbuf.size()) : -1};
+        MPI_Bcast(header, 2, MPI_INT, mpi_root_, mpi_comm_);
+        if (header[1] > 0)
+            MPI_Bcast(sbuf.data(), header[1], MPI_CHAR, mpi_root_, mpi_comm_);
     }
     else {
-        int size;
-        MPI_Bcast(&size, 1, MPI_INT, mpi_root_, mpi_comm_);
-        std::vector<char> buf(size);
-        MPI_Bcast(&buf[0], size, MPI_CHAR, mpi_root_, mpi_comm_);
-        auto zone = std::make_shared<msgpack::zone>();
-        DataConstRef soverlay_data = mcp::unpack_data(zone, &buf[0], size);
-        settings_manager_.overlay = soverlay_data.as<Settings>();
+        mpi_barrier_.wait();
+        int header[2];
+        MPI_Bcast(header, 2, MPI_INT, mpi_root_, mpi_comm_);
+        do_reuse = header[0];
+        if (header[1] > 0) {
+            std::vector<char> buf(header[1]);
+            MPI_Bcast(&buf[0], header[1], MPI_CHAR, mpi_root_, mpi_comm_);
+            DataConstRef soverlay_data = mcp::unpack_data(&buf[0], header[1]);
+            settings_manager_.overlay = soverlay_data.as<Settings>();
+        }
     }
 #endif
 
@@ -299,6 +590,10 @@ ValueType Instance::Impl::get_setting_as(std::string const & name) const {
     return settings_manager_.get_setting(instance_name_, name).as<ValueType>();
 }
 
+::ymmsl::Settings Instance::Impl::get_settings() const {
+    return settings_manager_.snapshot(instance_name_);
+}
+
 std::unordered_map<::ymmsl::Operator, std::vector<std::string>>
 Instance::Impl::list_ports() const {
 #ifdef MUSCLE_ENABLE_MPI
@@ -308,7 +603,7 @@ Instance::Impl::list_ports() const {
 #ifdef MUSCLE_ENABLE_MPI
     }
     else
-        throw std::runtime_error("list_ports can only be called from the MPI root process");
+        return mpi_port_ops_;
 #endif
 }
 
@@ -320,7 +615,7 @@ bool Instance::Impl::is_connected(std::string const & port) const {
 #ifdef MUSCLE_ENABLE_MPI
     }
     else
-        throw std::runtime_error("is_connected can only be called from the MPI root process");
+        return mpi_port_connected_.at(port);
 #endif
 }
 
@@ -332,7 +627,7 @@ bool Instance::Impl::is_vector_port(std::string const & port) const {
 #ifdef MUSCLE_ENABLE_MPI
     }
     else
-        throw std::runtime_error("is_vector_port can only be called from the MPI root process");
+        return mpi_port_is_vector_.at(port);
 #endif
 }
 
@@ -372,158 +667,1321 @@ void Instance::Impl::set_port_length(std::string const & port, int length) {
 #endif
 }
 
+PortHandle Instance::Impl::port(std::string const & port_name) {
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+    check_port_(port_name);
+    PortHandle port_handle(communicator_->get_port_handle(port_name));
+    port_handle.state_->codec = codec_for_port_(port_name);
+    port_handle.state_->delta_interval = delta_interval_for_port_(port_name);
+    port_handle.state_->prefetch_depth = prefetch_depth_for_port_(port_name);
+    return port_handle;
+#ifdef MUSCLE_ENABLE_MPI
+    }
+    else
+        throw std::runtime_error("port can only be called from the MPI root process");
+#endif
+}
+
 void Instance::Impl::send(std::string const & port_name, Message const & message) {
+    send(port_name, Message(message));
+}
+
+void Instance::Impl::send(
+        std::string const & port_name, Message const & message, int slot)
+{
+    send(port_name, Message(message), slot);
+}
+
+void Instance::Impl::send(std::string const & port_name, Message && message) {
 #ifdef MUSCLE_ENABLE_MPI
     if (mpi_barrier_.is_root()) {
 #endif
         check_port_(port_name);
-        if (!message.has_settings()) {
-            Message msg(message);
-            msg.set_settings(settings_manager_.overlay);
-            communicator_->send_message(port_name, msg);
-        }
-        else
-            communicator_->send_message(port_name, message);
+        Codec codec = codec_for_port_(port_name);
+        int delta_interval = delta_interval_for_port_(port_name);
+        if (!message.has_settings())
+            message.set_settings(settings_manager_.overlay);
+        communicator_->send_message(
+                port_name, std::move(message), {}, codec, delta_interval);
 #ifdef MUSCLE_ENABLE_MPI
     }
 #endif
 }
 
 void Instance::Impl::send(
-        std::string const & port_name, Message const & message, int slot)
+        std::string const & port_name, Message && message, int slot)
 {
 #ifdef MUSCLE_ENABLE_MPI
     if (mpi_barrier_.is_root()) {
 #endif
         check_port_(port_name);
-        if (!message.has_settings()) {
-            Message msg(message);
-            msg.set_settings(settings_manager_.overlay);
-            communicator_->send_message(port_name, msg, slot);
-        }
-        else
-            communicator_->send_message(port_name, message, slot);
+        Codec codec = codec_for_port_(port_name);
+        int delta_interval = delta_interval_for_port_(port_name);
+        if (!message.has_settings())
+            message.set_settings(settings_manager_.overlay);
+        communicator_->send_message(
+                port_name, std::move(message), slot, codec, delta_interval);
 #ifdef MUSCLE_ENABLE_MPI
     }
 #endif
 }
 
-/* Register this instance with the manager.
+void Instance::Impl::send(
+        PortHandle const & port_handle, Message const & message)
+{
+    send(port_handle, Message(message));
+}
+
+void Instance::Impl::send(
+        PortHandle const & port_handle, Message const & message, int slot)
+{
+    send(port_handle, Message(message), slot);
+}
+
+void Instance::Impl::send(
+        PortHandle const & port_handle, Message && message)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        Codec codec = port_handle.state_->codec;
+        int delta_interval = port_handle.state_->delta_interval;
+        if (!message.has_settings())
+            message.set_settings(settings_manager_.overlay);
+        communicator_->send_message(
+                port_handle, std::move(message), {}, codec, delta_interval);
+#ifdef MUSCLE_ENABLE_MPI
+    }
+#endif
+}
+
+void Instance::Impl::send(
+        PortHandle const & port_handle, Message && message, int slot)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        Codec codec = port_handle.state_->codec;
+        int delta_interval = port_handle.state_->delta_interval;
+        if (!message.has_settings())
+            message.set_settings(settings_manager_.overlay);
+        communicator_->send_message(
+                port_handle, std::move(message), slot, codec, delta_interval);
+#ifdef MUSCLE_ENABLE_MPI
+    }
+#endif
+}
+
+std::future<void> Instance::Impl::send_async(
+        std::string const & port_name, Message const & message,
+        Optional<int> slot)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    if (!mpi_barrier_.is_root()) {
+        // nothing to send here, return a future that's already done
+        std::promise<void> done;
+        done.set_value();
+        return done.get_future();
+    }
+#endif
+    check_port_(port_name);
+    Codec codec = codec_for_port_(port_name);
+    int delta_interval = delta_interval_for_port_(port_name);
+    if (!message.has_settings()) {
+        Message msg(message);
+        msg.set_settings(settings_manager_.overlay);
+        return communicator_->send_message_async(
+                port_name, msg, slot, codec, delta_interval);
+    }
+    return communicator_->send_message_async(
+            port_name, message, slot, codec, delta_interval);
+}
+
+void Instance::Impl::send_range(
+        std::string const & port_name, int first_slot, int last_slot,
+        std::function<Message(int)> const & make_message)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        check_port_(port_name);
+        Codec codec = codec_for_port_(port_name);
+        int delta_interval = delta_interval_for_port_(port_name);
+        communicator_->send_range(
+                port_name, first_slot, last_slot,
+                [this, &make_message](int slot) {
+                    Message message = make_message(slot);
+                    if (!message.has_settings())
+                        message.set_settings(settings_manager_.overlay);
+                    return message;
+                },
+                codec, delta_interval);
+#ifdef MUSCLE_ENABLE_MPI
+    }
+#endif
+}
+
+void Instance::Impl::send_sample(
+        std::string const & port_name, double timestamp, double value)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    if (!mpi_barrier_.is_root())
+        return;
+#endif
+    auto & buffer = sample_buffers_[port_name];
+    if (buffer.window == 0u) {
+        check_port_(port_name);
+        buffer.window = stream_window_for_port_(port_name);
+        buffer.timestamps.reserve(buffer.window);
+        buffer.values.reserve(buffer.window);
+    }
+    buffer.timestamps.push_back(timestamp);
+    buffer.values.push_back(value);
+    if (buffer.timestamps.size() >= buffer.window)
+        send_sample_window_(port_name, buffer);
+}
+
+void Instance::Impl::flush_samples(std::string const & port_name) {
+#ifdef MUSCLE_ENABLE_MPI
+    if (!mpi_barrier_.is_root())
+        return;
+#endif
+    auto it = sample_buffers_.find(port_name);
+    if (it != sample_buffers_.end())
+        send_sample_window_(port_name, it->second);
+}
+
+SampleWindow Instance::Impl::receive_samples(std::string const & port_name) {
+    SampleWindow window;
+    Message msg = receive_message(port_name, {}, {}, false);
+#ifdef MUSCLE_ENABLE_MPI
+    if (!mpi_barrier_.is_root())
+        return window;
+#endif
+    std::string err(
+            "Expected a window of samples on port '" + port_name +
+            "', but received something else. Is the sender using"
+            " send_sample()?");
+    try {
+        auto const & data = msg.data();
+        DataConstRef timestamps = data["timestamps"];
+        DataConstRef values = data["values"];
+        std::size_t size = timestamps.shape().at(0);
+        window.timestamps.assign(
+                timestamps.elements<double>(),
+                timestamps.elements<double>() + size);
+        window.values.assign(
+                values.elements<double>(),
+                values.elements<double>() + size);
+    }
+    catch (std::domain_error const &) {
+        throw std::runtime_error(err);
+    }
+    catch (std::runtime_error const &) {
+        throw std::runtime_error(err);
+    }
+    return window;
+}
+
+/* Sends out the window of samples buffered for the given port.
+ *
+ * The window goes out as a single message, timestamped with its first
+ * sample's timestamp, holding the samples as two grids named
+ * timestamps and values; see receive_samples() for the decoding side.
+ * A no-op if the buffer is empty. The buffer keeps its capacity for
+ * the next window.
  */
-void Instance::Impl::register_() {
-    // TODO: profile this
-    auto locations = communicator_->get_locations();
-    auto port_list = list_declared_ports_();
-    manager_->register_instance(instance_name_, locations, port_list);
-    // TODO: stop profile
-    logger_->info("Registered with the manager");
+void Instance::Impl::send_sample_window_(
+        std::string const & port_name, SampleBuffer_ & buffer)
+{
+    if (buffer.timestamps.empty())
+        return;
+
+    Data data = Data::dict(
+            "timestamps", Data::grid(
+                buffer.timestamps.data(), {buffer.timestamps.size()},
+                {"sample"}),
+            "values", Data::grid(
+                buffer.values.data(), {buffer.values.size()},
+                {"sample"}));
+    send(port_name, Message(buffer.timestamps.front(), data));
+    buffer.timestamps.clear();
+    buffer.values.clear();
 }
 
-/* Connect this instance to the given peers / conduits.
+/* Looks up the codec to compress messages sent on the given port with.
+ *
+ * This is selected per conduit by setting muscle_data_codec.<port> for
+ * the sending port, or for all of an instance's ports at once with
+ * muscle_data_codec. The default is not to compress. Note that the
+ * receiving side has to support the codec, and that the Python
+ * implementation does not support compression.
  */
-void Instance::Impl::connect_() {
-    // TODO: profile this
-    auto peer_info = manager_->request_peers(instance_name_);
-    communicator_->connect(std::get<0>(peer_info), std::get<1>(peer_info), std::get<2>(peer_info));
-    settings_manager_.base = manager_->get_settings();
-    // TODO: stop profile
-    logger_->info("Received peer locations and base settings");
+Codec Instance::Impl::codec_for_port_(std::string const & port_name) const {
+    try {
+        return codec_from_string(
+                settings_manager_.get_setting_as<std::string>(
+                    instance_name_,
+                    Reference("muscle_data_codec." + port_name)));
+    }
+    catch (std::out_of_range const &) {}
+    try {
+        return codec_from_string(
+                settings_manager_.get_setting_as<std::string>(
+                    instance_name_, "muscle_data_codec"));
+    }
+    catch (std::out_of_range const &) {}
+    return Codec::none;
+}
+
+/* Looks up the delta interval for messages sent on the given port.
+ *
+ * This enables delta sending per conduit, by setting
+ * muscle_delta_interval.<port> for the sending port, or for all of an
+ * instance's ports at once with muscle_delta_interval. Grid payloads
+ * are then XOR-encoded against the previously sent one, with a complete
+ * keyframe every this many messages; see Communicator::apply_delta_().
+ * The default of 0 disables delta sending. Both ends of the conduit
+ * must be C++ instances; the Python implementation does not support
+ * delta sending.
+ */
+int Instance::Impl::delta_interval_for_port_(
+        std::string const & port_name) const {
+    try {
+        return static_cast<int>(settings_manager_.get_setting_as<int64_t>(
+                    instance_name_,
+                    Reference("muscle_delta_interval." + port_name)));
+    }
+    catch (std::out_of_range const &) {}
+    try {
+        return static_cast<int>(settings_manager_.get_setting_as<int64_t>(
+                    instance_name_, "muscle_delta_interval"));
+    }
+    catch (std::out_of_range const &) {}
+    return 0;
+}
+
+/* Returns the prefetch depth to use for receives on the given port.
+ *
+ * This is taken from the muscle_prefetch_depth setting, which may be
+ * set for a specific port as muscle_prefetch_depth.<port>. The default
+ * of one requests the next message as soon as one is received; see
+ * Communicator::receive_message().
+ */
+int Instance::Impl::prefetch_depth_for_port_(
+        std::string const & port_name) const {
+    try {
+        return static_cast<int>(settings_manager_.get_setting_as<int64_t>(
+                    instance_name_,
+                    Reference("muscle_prefetch_depth." + port_name)));
+    }
+    catch (std::out_of_range const &) {}
+    try {
+        return static_cast<int>(settings_manager_.get_setting_as<int64_t>(
+                    instance_name_, "muscle_prefetch_depth"));
+    }
+    catch (std::out_of_range const &) {}
+    return 1;
+}
+
+/* Returns the number of samples per window for the given port.
+ *
+ * This is taken from the muscle_stream_window setting, which may be
+ * set for a specific port as muscle_stream_window.<port>. The default
+ * is 1000 samples per window; see send_sample().
+ */
+std::size_t Instance::Impl::stream_window_for_port_(
+        std::string const & port_name) const {
+    int64_t window = 1000;
+    try {
+        window = settings_manager_.get_setting_as<int64_t>(
+                    instance_name_,
+                    Reference("muscle_stream_window." + port_name));
+    }
+    catch (std::out_of_range const &) {
+        try {
+            window = settings_manager_.get_setting_as<int64_t>(
+                        instance_name_, "muscle_stream_window");
+        }
+        catch (std::out_of_range const &) {}
+    }
+    if (window < 1) {
+        logger_->error(
+                "muscle_stream_window must be at least 1, using 1 instead");
+        window = 1;
+    }
+    return static_cast<std::size_t>(window);
+}
+
+
+/* Returns the path of this instance's peer cache file.
+ *
+ * The peer cache is enabled by setting MUSCLE_PEER_CACHE_DIR to a
+ * directory to keep the cache files in, one per instance. If it is not
+ * set, then this returns an empty string and the cache is disabled.
+ */
+std::string Instance::Impl::peer_cache_file_() const {
+    char const * cache_dir = getenv("MUSCLE_PEER_CACHE_DIR");
+    if (cache_dir == nullptr)
+        return std::string();
+
+    // square brackets are awkward in shells and file managers
+    std::string safe_id = static_cast<std::string>(instance_name_);
+    std::size_t pos;
+    while ((pos = safe_id.find('[')) != std::string::npos)
+        safe_id[pos] = '-';
+    while ((pos = safe_id.find(']')) != std::string::npos)
+        safe_id.erase(pos, 1u);
+    return std::string(cache_dir) + "/" + safe_id + ".peers";
+}
+
+/* Reads and checks the peer cache file.
+ *
+ * The file is mapped into memory and decoded as a view over the
+ * mapping, so loading the wiring tables does not copy them; the
+ * mapping is released when the last object referring to the decoded
+ * dict is. The file ends in a CRC32C of its content, which is checked
+ * before anything is decoded, so a corrupt or truncated cache is
+ * rejected up front.
+ *
+ * @return The decoded cache dict, or a nil object if the cache is
+ *      disabled, missing, or not usable.
+ */
+Data Instance::Impl::read_peer_cache_() const {
+    std::string path = peer_cache_file_();
+    if (path.empty())
+        return Data();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return Data();
+    struct stat statbuf;
+    if ((fstat(fd, &statbuf) != 0) ||
+            (statbuf.st_size <= static_cast<off_t>(sizeof(std::uint32_t)))) {
+        ::close(fd);
+        return Data();
+    }
+    std::size_t size = static_cast<std::size_t>(statbuf.st_size);
+    void * addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED)
+        return Data();
+
+    char const * bytes = static_cast<char const *>(addr);
+    std::size_t content_size = size - sizeof(std::uint32_t);
+    std::uint32_t crc;
+    memcpy(&crc, bytes + content_size, sizeof(crc));
+    if (crc != mcp::crc32c(0u, bytes, content_size)) {
+        munmap(addr, size);
+        return Data();
+    }
+
+    try {
+        struct Mapping_ { void * addr; std::size_t size; };
+        auto zone = std::make_shared<msgpack::zone>();
+        zone->push_finalizer(
+                [](void * ptr) {
+                    auto mapping = static_cast<Mapping_ *>(ptr);
+                    munmap(mapping->addr, mapping->size);
+                    delete mapping;
+                },
+                new Mapping_{addr, size});
+        Data cache = mcp::unpack_data_view(zone, bytes, content_size);
+        if (cache["version"].as<int>() != peer_cache_version_)
+            return Data();
+        if (cache["instance"].as<std::string>() !=
+                static_cast<std::string>(instance_name_))
+            return Data();
+        return cache;
+    }
+    catch (std::exception const & e) {
+        // a corrupt or outdated cache is as good as no cache; the zone
+        // finalizer has unmapped the file
+        return Data();
+    }
+}
+
+/* Returns the TCP port we listened on last run, or 0 if unknown.
+ *
+ * With the peer cache enabled, the server tries to come back up on the
+ * same port after a restart, so that the peer locations our peers
+ * cached for us remain valid.
+ */
+int Instance::Impl::cached_tcp_port_() const {
+    Data cache = read_peer_cache_();
+    if (cache.is_nil())
+        return 0;
+    return cache["tcp_port"].as<int>();
+}
+
+/* Connects to our peers using cached peer information, if possible.
+ *
+ * On every start, connect_() normally registers and then polls the
+ * manager until all peers have appeared, which for large simulations
+ * takes far longer than the dialling itself. With the peer cache
+ * enabled, a restarted instance reuses the locations of the previous
+ * run and skips that wait. The cached locations are verified by
+ * dialling the peers, so a run with different placement falls back to
+ * the manager below.
+ *
+ * @return true iff we are now connected.
+ */
+bool Instance::Impl::connect_from_cache_() {
+    Data cache = read_peer_cache_();
+    if (cache.is_nil())
+        return false;
+
+    try {
+        auto cached_conduits = cache["conduits"];
+        std::vector<::ymmsl::Conduit> conduits;
+        conduits.reserve(cached_conduits.size());
+        for (std::size_t i = 0u; i < cached_conduits.size(); ++i)
+            conduits.emplace_back(
+                    cached_conduits[i][0].as<std::string>(),
+                    cached_conduits[i][1].as<std::string>());
+
+        auto cached_dims = cache["peer_dims"];
+        PeerDims peer_dims;
+        peer_dims.reserve(cached_dims.size());
+        for (std::size_t i = 0u; i < cached_dims.size(); ++i) {
+            auto dim_list = cached_dims.value(i);
+            std::vector<int> dims(dim_list.size());
+            for (std::size_t j = 0u; j < dim_list.size(); ++j)
+                dims[j] = dim_list[j].as<int>();
+            peer_dims[cached_dims.key(i)] = std::move(dims);
+        }
+
+        auto cached_locs = cache["peer_locations"];
+        PeerLocations peer_locations;
+        peer_locations.reserve(cached_locs.size());
+        for (std::size_t i = 0u; i < cached_locs.size(); ++i) {
+            auto loc_list = cached_locs.value(i);
+            std::vector<std::string> locs(loc_list.size());
+            for (std::size_t j = 0u; j < loc_list.size(); ++j)
+                locs[j] = loc_list[j].as<std::string>();
+            peer_locations[cached_locs.key(i)] = std::move(locs);
+        }
+
+        if (!communicator_->try_connect_cached(
+                conduits, peer_dims, peer_locations))
+            return false;
+
+        logger_->info("Reusing peer locations from ", peer_cache_file_());
+        return true;
+    }
+    catch (std::exception const & e) {
+        return false;
+    }
+}
+
+/* Writes the peer cache file, for the next run to reuse.
+ *
+ * Failing to write the cache only costs the next run its fast start,
+ * so problems are logged rather than raised.
+ */
+void Instance::Impl::write_peer_cache_(
+        std::vector<::ymmsl::Conduit> const & conduits,
+        PeerDims const & peer_dims,
+        PeerLocations const & peer_locations) const
+{
+    std::string path = peer_cache_file_();
+    if (path.empty())
+        return;
+
+    // our own TCP port, so that the next run can listen on it again;
+    // each address in the location carries the same port
+    int tcp_port = 0;
+    for (auto const & location : communicator_->get_locations())
+        if (location.compare(0u, 4u, "tcp:") == 0) {
+            std::size_t pos = location.rfind(':');
+            tcp_port = atoi(location.c_str() + pos + 1u);
+        }
+
+    auto conduit_list = Data::nils(conduits.size());
+    for (std::size_t i = 0u; i < conduits.size(); ++i)
+        conduit_list[i] = Data::list(
+                std::string(conduits[i].sender),
+                std::string(conduits[i].receiver));
+
+    auto dims_dict = Data::dict_reserve(peer_dims.size());
+    for (auto const & peer : peer_dims) {
+        auto dims = Data::nils(peer.second.size());
+        for (std::size_t i = 0u; i < peer.second.size(); ++i)
+            dims[i] = peer.second[i];
+        dims_dict[std::string(peer.first)] = dims;
+    }
+
+    auto locations_dict = Data::dict_reserve(peer_locations.size());
+    for (auto const & peer : peer_locations) {
+        auto locs = Data::nils(peer.second.size());
+        for (std::size_t i = 0u; i < peer.second.size(); ++i)
+            locs[i] = peer.second[i];
+        locations_dict[std::string(peer.first)] = locs;
+    }
+
+    auto cache = Data::dict(
+            "version", peer_cache_version_,
+            "instance", static_cast<std::string>(instance_name_),
+            "tcp_port", tcp_port,
+            "conduits", conduit_list,
+            "peer_dims", dims_dict,
+            "peer_locations", locations_dict);
+
+    msgpack::sbuffer sbuf;
+    mcp::pack_data(sbuf, cache);
+    // content fingerprint, checked by read_peer_cache_()
+    std::uint32_t crc = mcp::crc32c(0u, sbuf.data(), sbuf.size());
+
+    // write-then-rename, so a concurrent reader never sees a partial file
+    std::string tmp_path = path + ".tmp";
+    std::ofstream cache_file(tmp_path, std::ios::binary | std::ios::trunc);
+    cache_file.write(sbuf.data(), sbuf.size());
+    cache_file.write(reinterpret_cast<char const *>(&crc), sizeof(crc));
+    cache_file.close();
+    if (!cache_file) {
+        logger_->warning("Could not write peer cache file ", tmp_path);
+        return;
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        logger_->warning("Could not write peer cache file ", path);
+}
+
+/* Register this instance with the manager.
+ */
+void Instance::Impl::register_() {
+    ProfileEvent register_event(ProfileEventType::register_);
+    // Fetch the base settings in the background while we register and
+    // wait for our peers; the manager serves them independently, and
+    // MMPClient serialises the requests on the connection.
+    base_settings_future_ = std::async(std::launch::async, [this]() {
+            return manager_->get_settings(); });
+    auto locations = communicator_->get_locations();
+    auto port_list = list_declared_ports_();
+    manager_->register_instance(instance_name_, locations, port_list);
+    register_event.stop();
+    profiler_->record_event(std::move(register_event));
+    logger_->info("Registered with the manager");
+}
+
+/* Connect this instance to the given peers / conduits.
+ */
+void Instance::Impl::connect_() {
+    ProfileEvent connect_event(ProfileEventType::connect);
+    if (!connect_from_cache_()) {
+        auto peer_info = manager_->request_peers(instance_name_);
+        communicator_->connect(std::get<0>(peer_info), std::get<1>(peer_info), std::get<2>(peer_info));
+        write_peer_cache_(
+                std::get<0>(peer_info), std::get<1>(peer_info),
+                std::get<2>(peer_info));
+    }
+    // Optional diagnostics ports are often left unconnected, and a
+    // receive with a default on one of them should not do lookups just
+    // to find that out, so the verdicts are cached here; connectivity
+    // is fixed from this point on. See receive_message().
+    for (auto const & op_ports : communicator_->list_ports())
+        for (auto const & port_name : op_ports.second)
+            if (!communicator_->get_port(port_name).is_connected())
+                unconnected_ports_.emplace(
+                        port_name, op_ports.first == Operator::F_INIT);
+    settings_manager_.base = base_settings_future_.get();
+    settings_manager_.prefetch(instance_name_);
+    connect_event.stop();
+    profiler_->record_event(std::move(connect_event));
+    logger_->info("Received peer locations and base settings");
+}
+
+/* Deregister this instance from the manager.
+ */
+void Instance::Impl::deregister_() {
+    ProfileEvent deregister_event(ProfileEventType::deregister);
+    manager_->deregister_instance(instance_name_);
+    deregister_event.stop();
+    profiler_->record_event(std::move(deregister_event));
+    // This is the last thing we'll profile, so send what we have
+    profiler_->shutdown();
+    logger_->info("Deregistered from the manager");
+}
+
+Message Instance::Impl::receive_message(
+                std::string const & port_name,
+                Optional<int> slot,
+                Optional<Message> const & default_msg,
+                bool with_settings,
+                Optional<double> timeout)
+{
+    Message result(-1.0, Data());
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        auto unconn = default_msg.is_set()
+            ? unconnected_ports_.find(port_name) : unconnected_ports_.end();
+        if (unconn != unconnected_ports_.end()) {
+            // The port was unconnected when we connected, so the
+            // default is the answer; the copy shares the payload. An
+            // F_INIT receive keeps the default's settings, just as the
+            // slow path does.
+            result = default_msg.get();
+            if (!with_settings && !unconn->second)
+                result.unset_settings();
+        }
+        else {
+            check_port_(port_name);
+            result = receive_message_(
+                    port_name, nullptr, slot, default_msg, with_settings,
+                    timeout);
+        }
+        scatter_to_targets_(port_name, result);
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+Message Instance::Impl::receive_message(
+                PortHandle const & port_handle,
+                Optional<int> slot,
+                Optional<Message> const & default_msg,
+                bool with_settings)
+{
+    Message result(-1.0, Data());
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        if (default_msg.is_set() && !port_handle.state_->connected) {
+            // as in the by-name overload above
+            result = default_msg.get();
+            if (
+                    !with_settings &&
+                    port_handle.state_->port->oper != Operator::F_INIT)
+                result.unset_settings();
+        }
+        else
+            result = receive_message_(
+                    port_handle.name(), &port_handle, slot, default_msg,
+                    with_settings);
+        scatter_to_targets_(port_handle.name(), result);
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+/* Common implementation of receiving a message.
+ *
+ * If a handle is given, then the port and the Communicator-side
+ * endpoints come pre-resolved from it; otherwise they are looked up by
+ * name. The caller has already checked that the port exists, and
+ * handles the MPI barrier.
+ */
+Message Instance::Impl::receive_message_(
+                std::string const & port_name,
+                PortHandle const * port_handle,
+                Optional<int> slot,
+                Optional<Message> const & default_msg,
+                bool with_settings,
+                Optional<double> timeout)
+{
+    Message result(-1.0, Data());
+    auto const & port = port_handle
+        ? *port_handle->state_->port
+        : communicator_->get_port(port_name);
+    if (port.oper == Operator::F_INIT) {
+        Reference port_ref(port_name);
+        if (slot.is_set())
+            port_ref += slot.get();
+
+        if (f_init_cache_.count(port_ref) == 1) {
+            result = std::move(f_init_cache_.at(port_ref));
+            f_init_cache_.erase(port_ref);
+
+            if (with_settings && !result.has_settings()) {
+                std::string msg(
+                        "If you use receive_with_settings() on an F_INIT"
+                        " port, then you have to pass false to"
+                        " reuse_instance(), otherwise the settings will"
+                        " already have been applied by MUSCLE.");
+                logger_->critical(msg);
+                shutdown_();
+                throw std::logic_error(msg);
+            }
+        }
+        else {
+            if (port.is_connected()) {
+                std::ostringstream oss;
+                oss << "Tried to receive twice on the same port '";
+                oss << port_ref << "' in a single F_INIT, that's not possible.";
+                oss << " Did you forget to call reuse_instance() in your reuse";
+                oss << " loop?";
+                logger_->critical(oss.str());
+                shutdown_();
+                throw std::logic_error(oss.str());
+            }
+            else {
+                if (default_msg.is_set())
+                    result = default_msg.get();
+                else {
+                    std::ostringstream oss;
+                    oss << "Tried to receive on port '" << port_ref << "', which";
+                    oss << " is not connected, and no default value was given.";
+                    oss << " Please connect this port!";
+                    logger_->critical(oss.str());
+                    shutdown_();
+                    throw std::logic_error(oss.str());
+                }
+            }
+        }
+    }
+    else {
+        result = port_handle
+            ? communicator_->receive_message(
+                    *port_handle, slot, default_msg,
+                    port_handle->state_->prefetch_depth)
+            : communicator_->receive_message(
+                    port_name, slot, default_msg, timeout,
+                    prefetch_depth_for_port_(port_name));
+        if (port.is_connected() && !port.is_open(slot)) {
+            std::ostringstream oss;
+            oss << "Port '" << port_name << "' is closed, but we're trying to";
+            oss << " receive on it. Did the peer crash?";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::runtime_error(oss.str());
+        }
+        if (port.is_connected() && !with_settings)
+            check_compatibility_(port_name, result.settings());
+        if (!with_settings)
+            result.unset_settings();
+    }
+    trigger_manager_.harmonise_wall_time(communicator_->received_saved_until());
+    return result;
+}
+
+void Instance::Impl::register_receive_target(
+        std::string const & port_name, Optional<std::string> const & key,
+        void * dest, std::size_t num_bytes)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    // only the root process receives, see receive_message()
+    if (!mpi_barrier_.is_root())
+        return;
+#endif
+    check_port_(port_name);
+    auto & targets = receive_targets_[port_name];
+    for (auto & target : targets) {
+        if (target.key.is_set() != key.is_set())
+            continue;
+        if (key.is_set() && target.key.get() != key.get())
+            continue;
+        // re-registering the same target just updates the buffer
+        target.dest = dest;
+        target.num_bytes = num_bytes;
+        target.callback = nullptr;
+        return;
+    }
+    targets.push_back(ReceiveTarget_{key, dest, num_bytes, nullptr});
+}
+
+void Instance::Impl::register_receive_callback(
+        std::string const & port_name, Optional<std::string> const & key,
+        std::function<void(char const *, std::size_t)> callback)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    // only the root process receives, see receive_message()
+    if (!mpi_barrier_.is_root())
+        return;
+#endif
+    check_port_(port_name);
+    auto & targets = receive_targets_[port_name];
+    for (auto & target : targets) {
+        if (target.key.is_set() != key.is_set())
+            continue;
+        if (key.is_set() && target.key.get() != key.get())
+            continue;
+        // re-registering on the same key replaces the registration,
+        // whether it was a buffer or a callback
+        target.dest = nullptr;
+        target.num_bytes = 0u;
+        target.callback = std::move(callback);
+        return;
+    }
+    targets.push_back(ReceiveTarget_{key, nullptr, 0u, std::move(callback)});
+}
+
+/* Copies received payloads into any registered target buffers.
+ *
+ * Called whenever a message has been received on a port. The received
+ * data is a view into the receive buffer, so the payload bytes move
+ * straight from there into the model's own arrays, without an
+ * intermediate copy. A target registered with a callback gets the
+ * payload handed to it in place instead, so that converting or
+ * scattering it is fused into this same pass over the data.
+ */
+void Instance::Impl::scatter_to_targets_(
+        std::string const & port_name, Message const & message)
+{
+    auto targets_it = receive_targets_.find(port_name);
+    if (targets_it == receive_targets_.end())
+        return;
+
+    DataConstRef const & data = message.data();
+    for (auto const & target : targets_it->second) {
+        char const * src = nullptr;
+        std::size_t payload_bytes = 0u;
+        bool found = false;
+
+        if (!target.key.is_set())
+            found = payload_bytes_(data, src, payload_bytes);
+        else if (data.is_a_record_batch()) {
+            std::string const & key = target.key.get();
+            found = column_payload_<double>(data, key, src, payload_bytes)
+                || column_payload_<float>(data, key, src, payload_bytes)
+                || column_payload_<std::int64_t>(data, key, src, payload_bytes)
+                || column_payload_<std::int32_t>(data, key, src, payload_bytes)
+                || column_payload_<bool>(data, key, src, payload_bytes);
+        }
+        else if (data.is_a_dict()) {
+            try {
+                found = payload_bytes_(
+                        data[target.key.get()], src, payload_bytes);
+            }
+            catch (std::out_of_range const &) {}
+        }
+
+        if (!found) {
+            std::ostringstream oss;
+            oss << "Received a message on port '" << port_name << "' that"
+                << " does not contain the ";
+            if (target.key.is_set())
+                oss << "column or entry '" << target.key.get() << "'";
+            else
+                oss << "grid or byte array";
+            oss << " that a receive target was registered for.";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::runtime_error(oss.str());
+        }
+        if (target.callback) {
+            target.callback(src, payload_bytes);
+            continue;
+        }
+        if (payload_bytes != target.num_bytes) {
+            std::ostringstream oss;
+            oss << "Received a payload of " << payload_bytes << " bytes on"
+                << " port '" << port_name << "', but the receive target"
+                << " registered for it is " << target.num_bytes << " bytes.";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::runtime_error(oss.str());
+        }
+        memcpy(target.dest, src, payload_bytes);
+    }
+}
+
+void Instance::Impl::start_receive(
+        std::string const & port_name, Optional<int> slot)
+{
+#ifdef MUSCLE_ENABLE_MPI
+    if (!mpi_barrier_.is_root())
+        return;
+#endif
+    check_port_(port_name);
+    auto const & port = communicator_->get_port(port_name);
+    if (port.oper == Operator::F_INIT)
+        // these messages were already received into the cache by
+        // reuse_instance(), so there is nothing left to request
+        return;
+    if (!port.is_connected())
+        // a receive on a disconnected port returns the default message,
+        // so there is nothing to request here either
+        return;
+    communicator_->start_receive(port_name, slot);
+}
+
+std::vector<Message> Instance::Impl::receive_all(
+        std::string const & port_name)
+{
+    std::vector<Message> result;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        check_port_(port_name);
+        auto const & port = communicator_->get_port(port_name);
+        if (!port.is_vector()) {
+            std::ostringstream oss;
+            oss << "Tried to receive_all on port '" << port_name << "',";
+            oss << " which is not a vector port. Use receive() instead.";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::logic_error(oss.str());
+        }
+        if (port.oper == Operator::F_INIT) {
+            // these messages were already received into the cache by
+            // reuse_instance(), so there's no latency left to hide here
+            for (int slot = 0; slot < port.get_length(); ++slot) {
+                Reference port_ref(port_name);
+                port_ref += slot;
+                if (f_init_cache_.count(port_ref) != 1) {
+                    std::ostringstream oss;
+                    oss << "Tried to receive twice on the same port '";
+                    oss << port_ref << "' in a single F_INIT, that's not";
+                    oss << " possible. Did you forget to call";
+                    oss << " reuse_instance() in your reuse loop?";
+                    logger_->critical(oss.str());
+                    shutdown_();
+                    throw std::logic_error(oss.str());
+                }
+                result.push_back(f_init_cache_.at(port_ref));
+                f_init_cache_.erase(port_ref);
+            }
+        }
+        else {
+            result = communicator_->receive_all(port_name);
+            int num_slots = static_cast<int>(result.size());
+            for (int slot = 0; slot < num_slots; ++slot) {
+                if (!port.is_open(slot)) {
+                    std::ostringstream oss;
+                    oss << "Port '" << port_name << "[" << slot << "]' is";
+                    oss << " closed, but we're trying to receive on it. Did";
+                    oss << " the peer crash?";
+                    logger_->critical(oss.str());
+                    shutdown_();
+                    throw std::runtime_error(oss.str());
+                }
+                check_compatibility_(port_name, result[slot].settings());
+                result[slot].unset_settings();
+            }
+        }
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+std::vector<Message> Instance::Impl::receive_batch(
+        std::string const & port_name, int max_messages)
+{
+    std::vector<Message> result;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        check_port_(port_name);
+        auto const & port = communicator_->get_port(port_name);
+        if (port.is_vector()) {
+            std::ostringstream oss;
+            oss << "Tried to receive_batch on port '" << port_name << "',";
+            oss << " which is a vector port. Use receive_all() or per-slot";
+            oss << " receives instead.";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::logic_error(oss.str());
+        }
+        if (port.oper == Operator::F_INIT) {
+            std::ostringstream oss;
+            oss << "Tried to receive_batch on port '" << port_name << "',";
+            oss << " which is an F_INIT port. F_INIT ports receive only one";
+            oss << " message per reuse, use receive() instead.";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::logic_error(oss.str());
+        }
+
+        result = communicator_->receive_batch(port_name, max_messages);
+        if (port.is_connected() && !port.is_open()) {
+            std::ostringstream oss;
+            oss << "Port '" << port_name << "' is closed, but we're trying";
+            oss << " to receive on it. Did the peer crash?";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::runtime_error(oss.str());
+        }
+        for (auto & message : result) {
+            if (port.is_connected())
+                check_compatibility_(port_name, message.settings());
+            message.unset_settings();
+        }
+        trigger_manager_.harmonise_wall_time(
+                communicator_->received_saved_until());
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+std::string Instance::Impl::wait_any(
+        std::vector<std::string> const & port_names)
+{
+    std::string result;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        for (auto const & port_name : port_names) {
+            check_port_(port_name);
+            auto const & port = communicator_->get_port(port_name);
+            if (port.is_vector()) {
+                std::ostringstream oss;
+                oss << "Tried to wait_any on port '" << port_name << "',";
+                oss << " which is a vector port. Waiting on vector ports is";
+                oss << " not supported, use receive_all() instead.";
+                logger_->critical(oss.str());
+                shutdown_();
+                throw std::logic_error(oss.str());
+            }
+            if (port.oper == Operator::F_INIT) {
+                std::ostringstream oss;
+                oss << "Tried to wait_any on port '" << port_name << "',";
+                oss << " which is an F_INIT port. Its message was already";
+                oss << " received by reuse_instance(), use receive()";
+                oss << " instead.";
+                logger_->critical(oss.str());
+                shutdown_();
+                throw std::logic_error(oss.str());
+            }
+            if (!port.is_connected()) {
+                std::ostringstream oss;
+                oss << "Tried to wait_any on port '" << port_name << "',";
+                oss << " which is disconnected. No message will ever";
+                oss << " arrive on it.";
+                logger_->critical(oss.str());
+                shutdown_();
+                throw std::runtime_error(oss.str());
+            }
+            if (!port.is_open()) {
+                std::ostringstream oss;
+                oss << "Port '" << port_name << "' is closed, but we're";
+                oss << " trying to wait for a message on it. Did the peer";
+                oss << " crash?";
+                logger_->critical(oss.str());
+                shutdown_();
+                throw std::runtime_error(oss.str());
+            }
+        }
+        result = communicator_->wait_any(port_names);
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+double Instance::Impl::forward_message(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        Optional<int> slot)
+{
+    double result = -1.0;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        check_port_(receiving_port_name);
+        check_port_(sending_port_name);
+        result = communicator_->forward_message(
+                receiving_port_name, sending_port_name, slot);
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+std::vector<double> Instance::Impl::forward_batch(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        int max_messages)
+{
+    std::vector<double> result;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        check_port_(receiving_port_name);
+        check_port_(sending_port_name);
+        auto const & port = communicator_->get_port(receiving_port_name);
+        if (port.is_vector()) {
+            std::ostringstream oss;
+            oss << "Tried to forward_batch from port '" << receiving_port_name;
+            oss << "', which is a vector port. Use per-slot forwards instead.";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::logic_error(oss.str());
+        }
+        if (port.oper == Operator::F_INIT) {
+            std::ostringstream oss;
+            oss << "Tried to forward_batch from port '" << receiving_port_name;
+            oss << "', which is an F_INIT port. F_INIT ports receive only one";
+            oss << " message per reuse, use forward() instead.";
+            logger_->critical(oss.str());
+            shutdown_();
+            throw std::logic_error(oss.str());
+        }
+
+        result = communicator_->forward_batch(
+                receiving_port_name, sending_port_name, max_messages);
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+bool Instance::Impl::resuming() {
+    check_checkpointing_support_();
+    bool result = false;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        result = do_resume_;
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+        int result_mpi = result;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
+    }
+    else {
+        mpi_barrier_.wait();
+        int result_mpi;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
+        result = result_mpi;
+    }
+#endif
+    return result;
+}
+
+bool Instance::Impl::should_init() {
+    check_checkpointing_support_();
+    bool result = false;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        result = do_init_;
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+        int result_mpi = result;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
+    }
+    else {
+        mpi_barrier_.wait();
+        int result_mpi;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
+        result = result_mpi;
+    }
+#endif
+    return result;
+}
+
+Message Instance::Impl::load_snapshot() {
+    check_checkpointing_support_();
+    Message result(-1.0, Data());
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        result = snapshot_manager_->load_snapshot();
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+    }
+    else
+        mpi_barrier_.wait();
+#endif
+    return result;
+}
+
+bool Instance::Impl::should_save_snapshot(double timestamp) {
+    check_checkpointing_support_();
+    bool result = false;
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        result = trigger_manager_.should_save_snapshot(timestamp);
+        communicator_->set_checkpoints_considered_until(
+                trigger_manager_.checkpoints_considered_until());
+#ifdef MUSCLE_ENABLE_MPI
+        mpi_barrier_.signal();
+        int result_mpi = result;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
+    }
+    else {
+        mpi_barrier_.wait();
+        int result_mpi;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
+        result = result_mpi;
+    }
+#endif
+    return result;
 }
 
-/* Deregister this instance from the manager.
- */
-void Instance::Impl::deregister_() {
-    // TODO: profile this
-    manager_->deregister_instance(instance_name_);
-    // TODO: stop profile
-    // This is the last thing we'll profile, so flush messages
-    // TODO: shut down profiler
-    logger_->info("Deregistered from the manager");
+void Instance::Impl::save_snapshot(Message const & message) {
+    check_checkpointing_support_();
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        save_snapshot_(message, false, {});
+#ifdef MUSCLE_ENABLE_MPI
+    }
+#endif
 }
 
-Message Instance::Impl::receive_message(
-                std::string const & port_name,
-                Optional<int> slot,
-                Optional<Message> default_msg,
-                bool with_settings)
-{
-    Message result(-1.0, Data());
+bool Instance::Impl::should_save_final_snapshot() {
+    check_checkpointing_support_();
+    bool result = false;
 #ifdef MUSCLE_ENABLE_MPI
     if (mpi_barrier_.is_root()) {
 #endif
-        check_port_(port_name);
-
-        Reference port_ref(port_name);
-        auto const & port = communicator_->get_port(port_name);
-        if (port.oper == Operator::F_INIT) {
-            if (slot.is_set())
-                port_ref += slot.get();
-
-            if (f_init_cache_.count(port_ref) == 1) {
-                result = f_init_cache_.at(port_ref);
-                f_init_cache_.erase(port_ref);
-
-                if (with_settings && !result.has_settings()) {
-                    std::string msg(
-                            "If you use receive_with_settings() on an F_INIT"
-                            " port, then you have to pass false to"
-                            " reuse_instance(), otherwise the settings will"
-                            " already have been applied by MUSCLE.");
-                    logger_->critical(msg);
-                    shutdown_();
-                    throw std::logic_error(msg);
-                }
-            }
-            else {
-                if (port.is_connected()) {
-                    std::ostringstream oss;
-                    oss << "Tried to receive twice on the same port '";
-                    oss << port_ref << "' in a single F_INIT, that's not possible.";
-                    oss << " Did you forget to call reuse_instance() in your reuse";
-                    oss << " loop?";
-                    logger_->critical(oss.str());
-                    shutdown_();
-                    throw std::logic_error(oss.str());
-                }
-                else {
-                    if (default_msg.is_set())
-                        result = default_msg.get();
-                    else {
-                        std::ostringstream oss;
-                        oss << "Tried to receive on port '" << port_ref << "', which";
-                        oss << " is not connected, and no default value was given.";
-                        oss << " Please connect this port!";
-                        logger_->critical(oss.str());
-                        shutdown_();
-                        throw std::logic_error(oss.str());
-                    }
-                }
-            }
-        }
-        else {
-            result = communicator_->receive_message(port_name, slot, default_msg);
-            if (port.is_connected() && !port.is_open(slot)) {
-                std::ostringstream oss;
-                oss << "Port '" << port_ref << "' is closed, but we're trying to";
-                oss << " receive on it. Did the peer crash?";
-                logger_->critical(oss.str());
-                shutdown_();
-                throw std::runtime_error(oss.str());
-            }
-            if (port.is_connected() && !with_settings)
-                check_compatibility_(port_name, result.settings());
-            if (!with_settings)
-                result.unset_settings();
-        }
+        // This decides whether the instance will be reused, because that
+        // determines whether a final snapshot is needed. The result is
+        // cached for the next reuse_instance() call.
+        do_reuse_ = decide_reuse_instance_(
+                !(flags_ & InstanceFlags::DONT_APPLY_OVERLAY));
+        result = trigger_manager_.should_save_final_snapshot(
+                do_reuse_.get(), f_init_max_timestamp_());
+        communicator_->set_checkpoints_considered_until(
+                trigger_manager_.checkpoints_considered_until());
 #ifdef MUSCLE_ENABLE_MPI
         mpi_barrier_.signal();
+        int result_mpi = result;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
     }
-    else
+    else {
         mpi_barrier_.wait();
+        int result_mpi;
+        MPI_Bcast(&result_mpi, 1, MPI_INT, mpi_root_, mpi_comm_);
+        result = result_mpi;
+    }
 #endif
     return result;
 }
 
+void Instance::Impl::save_final_snapshot(Message const & message) {
+    check_checkpointing_support_();
+#ifdef MUSCLE_ENABLE_MPI
+    if (mpi_barrier_.is_root()) {
+#endif
+        save_snapshot_(message, true, f_init_max_timestamp_());
+#ifdef MUSCLE_ENABLE_MPI
+    }
+#endif
+}
+
+std::string Instance::Impl::memory_report() const {
+    return instrumentation::memory_report();
+}
+
 
 /* Returns instance name.
  *
@@ -633,6 +2091,127 @@ void Instance::Impl::check_port_(std::string const & port_name) {
  *
  * @return false iff the port is connected and ClosePort was received.
  */
+/* Gets the checkpoint configuration from the manager and resumes from a
+ * snapshot, if we have been given one to resume from.
+ */
+void Instance::Impl::setup_checkpointing_() {
+    double elapsed_time;
+    Checkpoints checkpoints;
+    Optional<std::string> resume_snapshot, snapshot_directory;
+    std::tie(elapsed_time, checkpoints, resume_snapshot, snapshot_directory) =
+            manager_->get_checkpoint_info(instance_name_);
+
+    trigger_manager_.set_checkpoint_info(elapsed_time, checkpoints);
+
+    if (!checkpoints.empty() &&
+            !(flags_ & (InstanceFlags::USES_CHECKPOINT_API |
+                        InstanceFlags::KEEPS_NO_STATE_FOR_NEXT_USE |
+                        InstanceFlags::STATE_NOT_REQUIRED_FOR_NEXT_USE))) {
+        std::string msg(
+                "The workflow has requested checkpoints, but this instance"
+                " does not support checkpointing. Please consult the"
+                " MUSCLE3 checkpointing documentation on how to add"
+                " checkpointing support.");
+        logger_->critical(msg);
+        shutdown_();
+        throw std::runtime_error(msg);
+    }
+
+    auto saved_at = snapshot_manager_->prepare_resume(
+            resume_snapshot, snapshot_directory);
+    if (resume_snapshot.is_set())
+        settings_manager_.overlay = snapshot_manager_->resume_overlay();
+    if (saved_at.is_set())
+        trigger_manager_.update_checkpoints(saved_at.get());
+}
+
+/* Decides whether and how to reuse the instance.
+ *
+ * This is called either by reuse_instance(), or earlier by
+ * should_save_final_snapshot(), which needs the decision to determine
+ * whether a final snapshot must be saved. It also decides whether we
+ * should resume from a snapshot and whether we should initialise from
+ * F_INIT this iteration, for the checkpointing API to report.
+ */
+bool Instance::Impl::decide_reuse_instance_(bool apply_overlay) {
+    if (!first_run_.is_set())
+        first_run_ = true;
+    else if (first_run_.get())
+        first_run_ = false;
+
+    if (first_run_.get() && snapshot_manager_->resuming_from_intermediate()) {
+        // resume from intermediate snapshot, no F_INIT messages expected
+        do_resume_ = true;
+        do_init_ = false;
+        return true;
+    }
+
+    bool f_init_connected = have_f_init_connections_();
+    if (first_run_.get() && snapshot_manager_->resuming_from_final()) {
+        if (f_init_connected) {
+            // this run completed, but there may be a new iteration of
+            // the workflow with new F_INIT messages for us
+            bool got_f_init_messages = pre_receive_all_(apply_overlay);
+            do_resume_ = true;
+            do_init_ = true;
+            return got_f_init_messages;
+        }
+        // this run already completed, there is nothing new to do
+        return false;
+    }
+
+    do_resume_ = false;
+    if (!f_init_connected) {
+        // fresh run without F_INIT connections: run exactly once
+        do_init_ = first_run_.get();
+        return first_run_.get();
+    }
+
+    bool got_f_init_messages = pre_receive_all_(apply_overlay);
+    do_init_ = got_f_init_messages;
+    return got_f_init_messages;
+}
+
+/* Returns whether any F_INIT port, or muscle_settings_in, is connected.
+ *
+ * Connectivity is fixed once we're connected, so the answer is
+ * memoised; rebuilding the port map here every reuse adds up for
+ * micro models that go around the loop millions of times.
+ */
+bool Instance::Impl::have_f_init_connections_() {
+    if (!have_f_init_connections_cache_.is_set()) {
+        bool connected = communicator_->settings_in_connected();
+        auto ports = communicator_->list_ports();
+        if (!connected && ports.count(Operator::F_INIT) != 0)
+            for (auto const & port : ports.at(Operator::F_INIT))
+                if (communicator_->get_port(port).is_connected()) {
+                    connected = true;
+                    break;
+                }
+        have_f_init_connections_cache_ = connected;
+    }
+    return have_f_init_connections_cache_.get();
+}
+
+/* Pre-receives the settings overlay and all F_INIT messages.
+ *
+ * @return true iff no ClosePort messages were received.
+ */
+bool Instance::Impl::pre_receive_all_(bool apply_overlay) {
+    bool all_ports_open = receive_settings_();
+
+    // TODO: f_init_cache_ should be empty here, or the user didn't receive
+    // something that was sent on the last go-around. At least emit a warning.
+    pre_receive_f_init_(apply_overlay);
+
+    trigger_manager_.harmonise_wall_time(communicator_->received_saved_until());
+
+    for (auto const & ref_msg : f_init_cache_)
+        if (is_close_port(ref_msg.second.data()))
+            all_ports_open = false;
+    return all_ports_open;
+}
+
 bool Instance::Impl::receive_settings_() {
     Message default_message(0.0, Settings(), Settings());
     auto msg = communicator_->receive_message("muscle_settings_in", {}, default_message);
@@ -652,7 +2231,10 @@ bool Instance::Impl::receive_settings_() {
     Settings settings(msg.settings());
     for (auto const & key_val : msg.data().as<Settings>())
         settings[key_val.first] = key_val.second;
-    settings_manager_.overlay = settings;
+    // keep the current overlay (and its generation) if nothing changed,
+    // so that cached encodings of it remain valid
+    if (settings != settings_manager_.overlay)
+        settings_manager_.overlay = settings;
     return true;
 }
 
@@ -681,22 +2263,30 @@ void Instance::Impl::pre_receive_(
  */
 void Instance::Impl::pre_receive_f_init_(bool apply_overlay) {
     f_init_cache_.clear();
-    auto ports = communicator_->list_ports();
-    if (ports.count(Operator::F_INIT) == 1) {
-        for (auto const & port_name : ports.at(Operator::F_INIT)) {
-            logger_->debug("Pre-receiving on port ", port_name);
-            auto const & port = communicator_->get_port(port_name);
-            if (!port.is_connected())
-                continue;
-            if (!port.is_vector())
-                pre_receive_(port_name, {}, apply_overlay);
-            else {
-                pre_receive_(port_name, 0, apply_overlay);
-                // The above receives the length, if needed, so now we can get
-                // the rest.
-                for (int slot = 1; slot < port.get_length(); ++slot)
-                    pre_receive_(port_name, slot, apply_overlay);
-            }
+
+    // the set of connected F_INIT ports is fixed once we're connected,
+    // so it's determined once rather than rebuilt every reuse
+    if (!f_init_ports_cache_.is_set()) {
+        std::vector<std::string> port_names;
+        auto ports = communicator_->list_ports();
+        if (ports.count(Operator::F_INIT) == 1)
+            for (auto const & port_name : ports.at(Operator::F_INIT))
+                if (communicator_->get_port(port_name).is_connected())
+                    port_names.push_back(port_name);
+        f_init_ports_cache_ = std::move(port_names);
+    }
+
+    for (auto const & port_name : f_init_ports_cache_.get()) {
+        logger_->debug("Pre-receiving on port ", port_name);
+        auto const & port = communicator_->get_port(port_name);
+        if (!port.is_vector())
+            pre_receive_(port_name, {}, apply_overlay);
+        else {
+            pre_receive_(port_name, 0, apply_overlay);
+            // The above receives the length, if needed, so now we can get
+            // the rest.
+            for (int slot = 1; slot < port.get_length(); ++slot)
+                pre_receive_(port_name, slot, apply_overlay);
         }
     }
 }
@@ -741,6 +2331,49 @@ void Instance::Impl::set_remote_log_level_() {
     }
 }
 
+/* Configures outgoing transfer shaping from the settings.
+ *
+ * It gets the rate cap, in MB/s, from the muscle_transfer_rate
+ * setting, and the length of the staggering window, in seconds, from
+ * muscle_transfer_stagger; see TransferScheduler. The instance's
+ * offset within the window is derived from its name, so that the
+ * instances of a large set spread themselves out evenly without any
+ * further coordination.
+ */
+void Instance::Impl::set_transfer_shaping_() {
+    double rate = 0.0;
+    double stagger = 0.0;
+    try {
+        rate = settings_manager_.get_setting(
+                instance_name_, "muscle_transfer_rate").as<double>();
+    }
+    catch (std::bad_cast const &) {
+        logger_->error("muscle_transfer_rate is not a number");
+    }
+    catch (std::out_of_range const &) {
+        // muscle_transfer_rate not set, leave the cap off
+    }
+    try {
+        stagger = settings_manager_.get_setting(
+                instance_name_, "muscle_transfer_stagger").as<double>();
+    }
+    catch (std::bad_cast const &) {
+        logger_->error("muscle_transfer_stagger is not a number");
+    }
+    catch (std::out_of_range const &) {
+        // muscle_transfer_stagger not set, leave staggering off
+    }
+
+    double offset_fraction = 0.0;
+    if (stagger > 0.0) {
+        std::size_t name_hash = std::hash<std::string>()(
+                static_cast<std::string>(instance_name_));
+        offset_fraction = static_cast<double>(name_hash % 1024u) / 1024.0;
+    }
+    mcp::TransferScheduler::get().configure(
+            rate * 1e6, stagger, offset_fraction);
+}
+
 /* Sets local overlay if we don't already have one.
  *
  * @param message The message to apply the overlay from.
@@ -784,10 +2417,8 @@ void Instance::Impl::close_outgoing_ports_() {
         if (allows_sending(oper_ports.first)) {
             for (auto const & port_name : oper_ports.second) {
                 auto const & port = communicator_->get_port(port_name);
-                if (port.is_vector()) {
-                    for (int slot = 0; slot < port.get_length(); ++slot)
-                        communicator_->close_port(port_name, slot);
-                }
+                if (port.is_vector())
+                    communicator_->close_vector_port(port_name);
                 else
                     communicator_->close_port(port_name);
             }
@@ -822,6 +2453,13 @@ void Instance::Impl::drain_incoming_vector_port_(std::string const & port_name)
             all_closed = false;
 
     while (!all_closed) {
+        // start all the receives before waiting on any of them, so that
+        // the close handshakes with the peers overlap rather than
+        // completing one slot at a time
+        for (int slot = 0; slot < port.get_length(); ++slot)
+            if (port.is_open(slot))
+                communicator_->start_receive(port_name, slot);
+
         all_closed = true;
         for (int slot = 0; slot < port.get_length(); ++slot) {
             if (port.is_open(slot))
@@ -866,11 +2504,49 @@ void Instance::Impl::close_ports_() {
 
 /* Shuts down communication with the outside world and deregisters.
  */
+/* Checks that the checkpointing API may be used.
+ */
+void Instance::Impl::check_checkpointing_support_() const {
+    if (!(flags_ & InstanceFlags::USES_CHECKPOINT_API))
+        throw std::runtime_error(
+                "Please add the flag InstanceFlags::USES_CHECKPOINT_API"
+                " when creating the Instance to use the MUSCLE3"
+                " checkpointing API.");
+}
+
+/* Saves a snapshot and updates the trigger state.
+ */
+void Instance::Impl::save_snapshot_(
+        Optional<Message> const & message, bool final,
+        Optional<double> f_init_max_timestamp)
+{
+    double timestamp = snapshot_manager_->save_snapshot(
+            message, final, trigger_manager_.get_triggers(),
+            trigger_manager_.elapsed_walltime(), f_init_max_timestamp,
+            settings_manager_.overlay);
+    trigger_manager_.update_checkpoints(timestamp);
+}
+
+/* Returns the maximum timestamp of the pre-received F_INIT messages.
+ */
+Optional<double> Instance::Impl::f_init_max_timestamp_() const {
+    Optional<double> result;
+    for (auto const & ref_msg : f_init_cache_) {
+        double timestamp = ref_msg.second.timestamp();
+        if (!result.is_set() || result.get() < timestamp)
+            result = timestamp;
+    }
+    return result;
+}
+
 void Instance::Impl::shutdown_() {
     if (!is_shut_down_) {
 #ifdef MUSCLE_ENABLE_MPI
         if (mpi_barrier_.is_root()) {
 #endif
+            // send out any samples still buffered for streaming ports
+            for (auto & buffer : sample_buffers_)
+                send_sample_window_(buffer.first, buffer.second);
             close_ports_();
             communicator_->shutdown();
             deregister_();
@@ -891,14 +2567,15 @@ void Instance::Impl::shutdown_() {
  */
 
 Instance::Instance(
-        int argc, char const * const argv[]
+        int argc, char const * const argv[],
+        InstanceFlags flags
 #ifdef MUSCLE_ENABLE_MPI
         , MPI_Comm const & communicator
         , int root
 #endif
         )
     : pimpl_(new Impl(
-                argc, argv, {{}}
+                argc, argv, {{}}, flags
 #ifdef MUSCLE_ENABLE_MPI
                 , communicator, root
 #endif
@@ -907,14 +2584,15 @@ Instance::Instance(
 
 Instance::Instance(
         int argc, char const * const argv[],
-        PortsDescription const & ports
+        PortsDescription const & ports,
+        InstanceFlags flags
 #ifdef MUSCLE_ENABLE_MPI
         , MPI_Comm const & communicator
         , int root
 #endif
         )
     : pimpl_(new Impl(
-                argc, argv, ports
+                argc, argv, ports, flags
 #ifdef MUSCLE_ENABLE_MPI
                 , communicator, root
 #endif
@@ -958,6 +2636,10 @@ template std::vector<std::vector<double>> Instance::get_setting_as<std::vector<s
 /** \endcond
  */
 
+::ymmsl::Settings Instance::get_settings() const {
+    return impl_()->get_settings();
+}
+
 std::unordered_map<::ymmsl::Operator, std::vector<std::string>>
 Instance::list_ports() const {
     return impl_()->list_ports();
@@ -983,6 +2665,10 @@ void Instance::set_port_length(std::string const & port, int length) {
     impl_()->set_port_length(port, length);
 }
 
+PortHandle Instance::port(std::string const & port_name) {
+    return impl_()->port(port_name);
+}
+
 void Instance::send(std::string const & port_name, Message const & message) {
     impl_()->send(port_name, message);
 }
@@ -993,6 +2679,69 @@ void Instance::send(
     impl_()->send(port_name, message, slot);
 }
 
+void Instance::send(std::string const & port_name, Message && message) {
+    impl_()->send(port_name, std::move(message));
+}
+
+void Instance::send(
+        std::string const & port_name, Message && message, int slot)
+{
+    impl_()->send(port_name, std::move(message), slot);
+}
+
+std::future<void> Instance::send_async(
+        std::string const & port_name, Message const & message)
+{
+    return impl_()->send_async(port_name, message);
+}
+
+std::future<void> Instance::send_async(
+        std::string const & port_name, Message const & message, int slot)
+{
+    return impl_()->send_async(port_name, message, slot);
+}
+
+void Instance::send_range(
+        std::string const & port_name, int first_slot, int last_slot,
+        std::function<Message(int)> const & make_message)
+{
+    impl_()->send_range(port_name, first_slot, last_slot, make_message);
+}
+
+void Instance::send_sample(
+        std::string const & port_name, double timestamp, double value)
+{
+    impl_()->send_sample(port_name, timestamp, value);
+}
+
+void Instance::flush_samples(std::string const & port_name) {
+    impl_()->flush_samples(port_name);
+}
+
+SampleWindow Instance::receive_samples(std::string const & port_name) {
+    return impl_()->receive_samples(port_name);
+}
+
+void Instance::send(PortHandle const & port_handle, Message const & message) {
+    impl_()->send(port_handle, message);
+}
+
+void Instance::send(
+        PortHandle const & port_handle, Message const & message, int slot)
+{
+    impl_()->send(port_handle, message, slot);
+}
+
+void Instance::send(PortHandle const & port_handle, Message && message) {
+    impl_()->send(port_handle, std::move(message));
+}
+
+void Instance::send(
+        PortHandle const & port_handle, Message && message, int slot)
+{
+    impl_()->send(port_handle, std::move(message), slot);
+}
+
 Message Instance::receive(std::string const & port_name) {
     return impl_()->receive_message(port_name, {}, {}, false);
 }
@@ -1018,6 +2767,129 @@ Message Instance::receive(
     return impl_()->receive_message(port_name, slot, default_msg, false);
 }
 
+Message Instance::receive(PortHandle const & port_handle) {
+    return impl_()->receive_message(port_handle, {}, {}, false);
+}
+
+Message Instance::receive(
+        PortHandle const & port_handle, Message const & default_msg)
+{
+    return impl_()->receive_message(port_handle, {}, default_msg, false);
+}
+
+Message Instance::receive(PortHandle const & port_handle, int slot) {
+    return impl_()->receive_message(port_handle, slot, {}, false);
+}
+
+Message Instance::receive(
+        PortHandle const & port_handle,
+        int slot,
+        Message const & default_msg)
+{
+    return impl_()->receive_message(port_handle, slot, default_msg, false);
+}
+
+Message Instance::receive_with_timeout(
+        std::string const & port_name, double timeout)
+{
+    return impl_()->receive_message(port_name, {}, {}, false, timeout);
+}
+
+Message Instance::receive_with_timeout(
+        std::string const & port_name, double timeout,
+        Message const & default_msg)
+{
+    return impl_()->receive_message(port_name, {}, default_msg, false, timeout);
+}
+
+Message Instance::receive_with_timeout(
+        std::string const & port_name, double timeout, int slot)
+{
+    return impl_()->receive_message(port_name, slot, {}, false, timeout);
+}
+
+Message Instance::receive_with_timeout(
+        std::string const & port_name, double timeout, int slot,
+        Message const & default_msg)
+{
+    return impl_()->receive_message(
+            port_name, slot, default_msg, false, timeout);
+}
+
+double Instance::forward(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name)
+{
+    return impl_()->forward_message(receiving_port_name, sending_port_name, {});
+}
+
+double Instance::forward(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        int slot)
+{
+    return impl_()->forward_message(
+            receiving_port_name, sending_port_name, slot);
+}
+
+std::vector<double> Instance::forward_batch(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        int max_messages)
+{
+    return impl_()->forward_batch(
+            receiving_port_name, sending_port_name, max_messages);
+}
+
+void Instance::register_receive_target(
+        std::string const & port_name, void * dest, std::size_t num_bytes)
+{
+    impl_()->register_receive_target(port_name, {}, dest, num_bytes);
+}
+
+void Instance::register_receive_target(
+        std::string const & port_name, std::string const & key,
+        void * dest, std::size_t num_bytes)
+{
+    impl_()->register_receive_target(port_name, key, dest, num_bytes);
+}
+
+void Instance::register_receive_callback(
+        std::string const & port_name,
+        std::function<void(char const *, std::size_t)> callback)
+{
+    impl_()->register_receive_callback(port_name, {}, std::move(callback));
+}
+
+void Instance::register_receive_callback(
+        std::string const & port_name, std::string const & key,
+        std::function<void(char const *, std::size_t)> callback)
+{
+    impl_()->register_receive_callback(port_name, key, std::move(callback));
+}
+
+void Instance::start_receive(std::string const & port_name) {
+    impl_()->start_receive(port_name);
+}
+
+void Instance::start_receive(std::string const & port_name, int slot) {
+    impl_()->start_receive(port_name, slot);
+}
+
+std::vector<Message> Instance::receive_all(std::string const & port_name) {
+    return impl_()->receive_all(port_name);
+}
+
+std::vector<Message> Instance::receive_batch(
+        std::string const & port_name, int max_messages)
+{
+    return impl_()->receive_batch(port_name, max_messages);
+}
+
+std::string Instance::wait_any(std::vector<std::string> const & port_names) {
+    return impl_()->wait_any(port_names);
+}
+
 Message Instance::receive_with_settings(std::string const & port_name) {
     return impl_()->receive_message(port_name, {}, {}, true);
 }
@@ -1044,6 +2916,38 @@ Message Instance::receive_with_settings(
     return impl_()->receive_message(port_name, slot, default_msg, true);
 }
 
+bool Instance::resuming() {
+    return impl_()->resuming();
+}
+
+bool Instance::should_init() {
+    return impl_()->should_init();
+}
+
+Message Instance::load_snapshot() {
+    return impl_()->load_snapshot();
+}
+
+bool Instance::should_save_snapshot(double timestamp) {
+    return impl_()->should_save_snapshot(timestamp);
+}
+
+void Instance::save_snapshot(Message const & message) {
+    impl_()->save_snapshot(message);
+}
+
+bool Instance::should_save_final_snapshot() {
+    return impl_()->should_save_final_snapshot();
+}
+
+void Instance::save_final_snapshot(Message const & message) {
+    impl_()->save_final_snapshot(message);
+}
+
+std::string Instance::memory_report() const {
+    return impl_()->memory_report();
+}
+
 Instance::Impl const * Instance::impl_() const {
     return pimpl_.get();
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <libmuscle/message.hpp>
+#include <libmuscle/port_handle.hpp>
 #include <libmuscle/ports_description.hpp>
+#include <libmuscle/receive_timeout_error.hpp>
 
 #ifdef MUSCLE_ENABLE_MPI
 #include <mpi.h>
@@ -9,14 +11,106 @@
 
 #include <ymmsl/ymmsl.hpp>
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace libmuscle { namespace impl {
 
+/** Enumeration of properties that an instance may have.
+ *
+ * You may combine multiple flags using the bitwise OR operator, e.g.
+ *
+ * \code{.cpp}
+ * auto flags = InstanceFlags::DONT_APPLY_OVERLAY |
+ *              InstanceFlags::USES_CHECKPOINT_API;
+ * Instance instance(argc, argv, flags);
+ * \endcode
+ */
+enum class InstanceFlags : int {
+    none = 0,
+
+    /** Do not apply the received settings overlay during prereceive of
+     * F_INIT messages.
+     *
+     * If you're going to use receive_with_settings() on your F_INIT
+     * ports, you must set this flag when creating an Instance.
+     *
+     * If you don't know what that means, do not specify this flag and
+     * everything will be fine. If it turns out that you did need to
+     * specify the flag, MUSCLE3 will tell you about it in an error
+     * message and you can add it still.
+     */
+    DONT_APPLY_OVERLAY = 1,
+
+    /** Indicate that this instance supports checkpointing.
+     *
+     * You may not use any checkpointing API calls when this flag is not
+     * supplied.
+     */
+    USES_CHECKPOINT_API = 2,
+
+    /** Indicate this instance does not carry state between iterations of
+     * the reuse loop.
+     *
+     * Specifying this flag is equivalent to
+     * USES_CHECKPOINT_API, and:
+     *
+     * \code{.cpp}
+     * if (instance.resuming())
+     *     instance.load_snapshot();     // no-op for this instance
+     * if (instance.should_save_final_snapshot())
+     *     instance.save_final_snapshot(Message(0.0));
+     * \endcode
+     */
+    KEEPS_NO_STATE_FOR_NEXT_USE = 4,
+
+    /** Indicate this instance carries state between iterations of the
+     * reuse loop, but that this state does not need to be stored in
+     * snapshots.
+     */
+    STATE_NOT_REQUIRED_FOR_NEXT_USE = 8,
+};
+
+inline InstanceFlags operator|(InstanceFlags lhs, InstanceFlags rhs) {
+    return static_cast<InstanceFlags>(
+            static_cast<int>(lhs) | static_cast<int>(rhs));
+}
+
+inline InstanceFlags operator&(InstanceFlags lhs, InstanceFlags rhs) {
+    return static_cast<InstanceFlags>(
+            static_cast<int>(lhs) & static_cast<int>(rhs));
+}
+
+inline bool operator!(InstanceFlags flags) {
+    return flags == InstanceFlags::none;
+}
+
+
+/** A window of time-series samples received from a streaming port.
+ *
+ * The samples are in sending order, with timestamps[i] the simulated
+ * time of values[i]; see Instance::send_sample() and
+ * Instance::receive_samples().
+ */
+struct SampleWindow {
+    std::vector<double> timestamps;
+    std::vector<double> values;
+};
+
+
 /** Represents a component instance in a MUSCLE3 simulation.
  *
  * This class provides a low-level send/receive API for the instance to use.
+ *
+ * A multi-threaded model may send and receive from different threads
+ * concurrently, as long as each port (or each slot of a vector port) is
+ * driven by one thread at a time; the shared bookkeeping underneath is
+ * synchronised internally. Everything else, in particular
+ * reuse_instance() and the other reuse-loop and checkpointing methods,
+ * must be called by one thread at a time.
  */
 class Instance {
     public:
@@ -28,12 +122,14 @@ class Instance {
          *
          * @param argc The number of command-line arguments.
          * @param argv Command line arguments.
+         * @param flags Properties of this instance, if any.
          * @param communicator MPI communicator containing all processes in
          *      this instance (MPI only).
          * @param root The designated root process (MPI only).
          */
         Instance(
-                int argc, char const * const argv[]
+                int argc, char const * const argv[],
+                InstanceFlags flags = InstanceFlags::none
 #ifdef MUSCLE_ENABLE_MPI
                 , MPI_Comm const & communicator = MPI_COMM_WORLD
                 , int root = 0
@@ -56,13 +152,15 @@ class Instance {
          * @param argc The number of command-line arguments.
          * @param argv Command line arguments.
          * @param ports A description of the ports that this instance has.
+         * @param flags Properties of this instance, if any.
          * @param communicator MPI communicator containing all processes in
          *      this instance (MPI only).
          * @param root The designated root process (MPI only).
          */
         Instance(
                 int argc, char const * const argv[],
-                PortsDescription const & ports
+                PortsDescription const & ports,
+                InstanceFlags flags = InstanceFlags::none
 #ifdef MUSCLE_ENABLE_MPI
                 , MPI_Comm const & communicator = MPI_COMM_WORLD
                 , int root = 0
@@ -163,6 +261,22 @@ class Instance {
         template <typename ValueType>
         ValueType get_setting_as(std::string const & name) const;
 
+        /** Returns all settings for this instance at once.
+         *
+         * The returned Settings object holds, under its bare name, the
+         * value that get_setting() would return for each setting. It
+         * is a snapshot, and does not change if new settings are
+         * received later in the reuse loop.
+         *
+         * If you read many settings, getting them from the returned
+         * object is faster than calling get_setting() for each,
+         * especially from Fortran, where each get_setting() call
+         * crosses the language boundary.
+         *
+         * @return A Settings object holding all settings.
+         */
+        ::ymmsl::Settings get_settings() const;
+
         /** Returns a description of the ports that this CE has.
          *
          * Note that the result has almost the same format as the port
@@ -170,8 +284,9 @@ class Instance {
          * difference is that the port names never have `[]` at the end, even
          * if the port is a vector port.
          *
-         * MPI-based components may call this function only in the
-         * root process.
+         * MPI-based components may call this function in any process;
+         * the non-root processes answer from a description that the
+         * root broadcasts at start-up.
          *
          * @return A map, indexed by operator, containing lists of port names.
          *      Operators with no associated ports are not included.
@@ -181,8 +296,7 @@ class Instance {
 
         /** Returns whether the given port is connected.
          *
-         * MPI-based components may call this function only in the
-         * root process.
+         * MPI-based components may call this function in any process.
          *
          * @param port The name of the port to inspect.
          * @return true if there is a conduit attached to this port, false if
@@ -197,8 +311,7 @@ class Instance {
          * can pass a 'slot' argument when sending or receiving. It's like the
          * port is a vector of slots on which you can send or receive messages.
          *
-         * MPI-based components may call this function only in the
-         * root process.
+         * MPI-based components may call this function in any process.
          *
          * This function returns True if the given port is a vector port, and
          * False if it is a scalar port.
@@ -248,6 +361,28 @@ class Instance {
          */
         void set_port_length(std::string const & port, int length);
 
+        /** Returns a handle for one of this instance's ports.
+         *
+         * Sending or receiving by name looks the port up on every call,
+         * which for tightly coupled models that exchange many small
+         * messages is measurable overhead. A handle resolves the port
+         * once, and the send() and receive() overloads that take one
+         * skip the lookup on every message after that. The compression
+         * codec for the port is also resolved when the handle is
+         * created.
+         *
+         * MPI-based components may call this function only in the
+         * root process.
+         *
+         * @param port_name The name of the port.
+         *
+         * @return A handle for the port, valid until this Instance is
+         *      destroyed.
+         *
+         * @throws std::logic_error if the port does not exist.
+         */
+        PortHandle port(std::string const & port_name);
+
         /** Send a message to the outside world.
          *
          * Sending is non-blocking, a copy of the message will be made and
@@ -280,6 +415,220 @@ class Instance {
         void send(std::string const & port_name, Message const & message,
                 int slot);
 
+        /** Send a message to the outside world.
+         *
+         * As send(), but taking ownership of the message, so that its
+         * payload is moved into the on-the-wire message rather than
+         * copied. Use this, with std::move(), if you don't need the
+         * message any more after sending.
+         *
+         * @param port_name The port on which this message is to be sent.
+         * @param message The message to be sent.
+         */
+        void send(std::string const & port_name, Message && message);
+
+        /** Send a message to the outside world.
+         *
+         * As send(), but taking ownership of the message, so that its
+         * payload is moved into the on-the-wire message rather than
+         * copied. Use this, with std::move(), if you don't need the
+         * message any more after sending.
+         *
+         * @param port_name The port on which this message is to be sent.
+         * @param message The message to be sent.
+         * @param slot The slot to send the message on.
+         */
+        void send(std::string const & port_name, Message && message,
+                int slot);
+
+        /** Send a message to the outside world, asynchronously.
+         *
+         * As send(), but the message is encoded for transmission on a
+         * background thread, so that for large messages the model can
+         * overlap this with its next compute step rather than wait for
+         * it. The returned future becomes ready once the message has
+         * been encoded and stored for sending; the data in the message
+         * must not be modified before that.
+         *
+         * MPI-based components may call this function either in all
+         * processes, or only in the root process. In both cases, the message
+         * given by the root process will be sent, the others ignored.
+         *
+         * @param port_name The port on which this message is to be sent.
+         * @param message The message to be sent.
+         *
+         * @return A future that completes when the message has been sent.
+         */
+        std::future<void> send_async(
+                std::string const & port_name, Message const & message);
+
+        /** Send a message to the outside world, asynchronously.
+         *
+         * As send(), but the message is encoded for transmission on a
+         * background thread, see the one-argument send_async(). The
+         * returned future becomes ready once the message has been
+         * encoded and stored for sending; the data in the message must
+         * not be modified before that.
+         *
+         * MPI-based components may call this function either in all
+         * processes, or only in the root process. In both cases, the message
+         * given by the root process will be sent, the others ignored.
+         *
+         * @param port_name The port on which this message is to be sent.
+         * @param message The message to be sent.
+         * @param slot The slot to send the message on.
+         *
+         * @return A future that completes when the message has been sent.
+         */
+        std::future<void> send_async(
+                std::string const & port_name, Message const & message,
+                int slot);
+
+        /** Send a message on each slot in a contiguous range.
+         *
+         * This is equivalent to calling send() once for each slot in
+         * [first_slot, last_slot), with the message for each slot
+         * produced by make_message, but noticeably faster for wide
+         * fan-outs: the whole range is sent in one tight loop over
+         * precomputed connection information.
+         *
+         * Use this if you send to many slots at once, e.g. a boundary
+         * per instance of a large set of micromodels:
+         *
+         * \code{.cpp}
+         * instance.send_range("boundary_out", 0, num_micros,
+         *         [&](int slot) -> Message {
+         *             return Message(t_cur, boundary_for(slot));
+         *         });
+         * \endcode
+         *
+         * MPI-based components may call this function either in all
+         * processes, or only in the root process; the messages produced
+         * in the root process will be sent, the others ignored.
+         *
+         * @param port_name The vector port on which to send.
+         * @param first_slot The first slot to send on.
+         * @param last_slot One past the last slot to send on.
+         * @param make_message Called once per slot, in order, to produce
+         *      the message for that slot.
+         */
+        void send_range(
+                std::string const & port_name, int first_slot, int last_slot,
+                std::function<Message(int)> const & make_message);
+
+        /** Send a time-series sample on a streaming port.
+         *
+         * A model that produces samples at a much higher rate than its
+         * consumer runs at should not send each sample as its own
+         * message, with its own envelope and round trip. This call
+         * instead accumulates samples into a window, and sends the
+         * whole window as a single message once it holds
+         * muscle_stream_window samples (which may be set per port as
+         * muscle_stream_window.<port>; the default is 1000). The
+         * consumer receives one window per step with
+         * receive_samples().
+         *
+         * The window is sent with the timestamp of its first sample,
+         * and holds the samples as two grids, named timestamps and
+         * values. A partial window is sent by flush_samples(), and any
+         * remaining samples are flushed when the instance shuts down.
+         *
+         * MPI-based components may call this function either in all
+         * processes, or only in the root process. In both cases, the
+         * sample given by the root process will be used, the others
+         * ignored.
+         *
+         * @param port_name The port on which to send.
+         * @param timestamp The simulated time the sample is for.
+         * @param value The sample itself.
+         */
+        void send_sample(
+                std::string const & port_name, double timestamp,
+                double value);
+
+        /** Send out any samples still buffered for a streaming port.
+         *
+         * This sends the current window of samples accumulated by
+         * send_sample(), even if it is not full yet, and is a no-op if
+         * there are none. Call it when the producer is done, or when
+         * the consumer needs what is there so far, e.g. at the end of
+         * an outer loop iteration.
+         *
+         * MPI-based components may call this function either in all
+         * processes, or only in the root process.
+         *
+         * @param port_name The port whose samples to send out.
+         */
+        void flush_samples(std::string const & port_name);
+
+        /** Receive a window of time-series samples.
+         *
+         * This receives one message, as receive() does, and unpacks
+         * the window of samples that send_sample() on the peer put
+         * into it.
+         *
+         * MPI-based components must call this function in all
+         * processes simultaneously; the window is returned in the
+         * root process, and the others get an empty one.
+         *
+         * @param port_name The port on which to receive.
+         *
+         * @return The received window of samples.
+         *
+         * @throws std::logic_error if the port is not connected.
+         * @throws std::runtime_error if the received message does not
+         *      hold a window of samples.
+         */
+        SampleWindow receive_samples(std::string const & port_name);
+
+        /** Send a message to the outside world.
+         *
+         * As send(), but taking a handle obtained from port() instead
+         * of a port name, which avoids looking the port up.
+         *
+         * @param port_handle A handle for the port to send on.
+         * @param message The message to be sent.
+         */
+        void send(PortHandle const & port_handle, Message const & message);
+
+        /** Send a message to the outside world.
+         *
+         * As send(), but taking a handle obtained from port() instead
+         * of a port name, which avoids looking the port up.
+         *
+         * @param port_handle A handle for the port to send on.
+         * @param message The message to be sent.
+         * @param slot The slot to send the message on.
+         */
+        void send(PortHandle const & port_handle, Message const & message,
+                int slot);
+
+        /** Send a message to the outside world.
+         *
+         * As send(), but taking ownership of the message, so that its
+         * payload is moved into the on-the-wire message rather than
+         * copied. Use this, with std::move(), if you don't need the
+         * message any more after sending.
+         *
+         * @param port_handle A handle for the port to send on.
+         * @param message The message to be sent.
+         */
+        void send(PortHandle const & port_handle, Message && message);
+
+        /** Send a message to the outside world.
+         *
+         * As send(), but taking ownership of the message, so that its
+         * payload is moved into the on-the-wire message rather than
+         * copied. Use this, with std::move(), if you don't need the
+         * message any more after sending.
+         *
+         * @param port_handle A handle for the port to send on.
+         * @param message The message to be sent.
+         * @param slot The slot to send the message on.
+         */
+        void send(PortHandle const & port_handle, Message && message,
+                int slot);
+
         /** Receive a message from the outside world.
          *
          * Receiving is a blocking operation. This function will contact the
@@ -391,6 +740,487 @@ class Instance {
                 std::string const & port_name, int slot,
                 Message const & default_msg);
 
+        /** Receive a message from the outside world.
+         *
+         * As receive(), but taking a handle obtained from port() instead
+         * of a port name, which avoids looking the port up.
+         *
+         * @param port_handle A handle for the port to receive on.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         *
+         * @throw std::runtime_error if the given port is not connected.
+         */
+        Message receive(PortHandle const & port_handle);
+
+        /** Receive a message from the outside world.
+         *
+         * As receive(), but taking a handle obtained from port() instead
+         * of a port name, which avoids looking the port up.
+         *
+         * @param port_handle A handle for the port to receive on.
+         * @param default_msg A default value to return if this port is not
+         *      connected.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         */
+        Message receive(
+                PortHandle const & port_handle, Message const & default_msg);
+
+        /** Receive a message from the outside world.
+         *
+         * As receive(), but taking a handle obtained from port() instead
+         * of a port name, which avoids looking the port up.
+         *
+         * @param port_handle A handle for the port to receive on.
+         * @param slot The slot to receive the message, on, if any.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         *
+         * @throw std::runtime_error if the given port is not connected.
+         */
+        Message receive(PortHandle const & port_handle, int slot);
+
+        /** Receive a message from the outside world.
+         *
+         * As receive(), but taking a handle obtained from port() instead
+         * of a port name, which avoids looking the port up.
+         *
+         * @param port_handle A handle for the port to receive on.
+         * @param slot The slot to receive the message, on, if any.
+         * @param default_msg A default value to return if this port is not
+         *      connected.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         */
+        Message receive(
+                PortHandle const & port_handle, int slot,
+                Message const & default_msg);
+
+        /** Receive a message, giving up after a timeout.
+         *
+         * As receive(), but if no message has started arriving within
+         * timeout seconds, a ReceiveTimeoutError is thrown. This lets a
+         * driver or other coupling component detect a hung or crashed
+         * peer rather than blocking forever, log the failure, and shut
+         * down so that the simulation can be resubmitted.
+         *
+         * After a timeout, the request for the message is still
+         * outstanding towards the peer, so no further messages can be
+         * received from it; the instance should shut down.
+         *
+         * The timeout is only applied when receiving over a socket
+         * (TCP or UNIX domain); messages from peers connected via
+         * shared memory or MPI are waited for indefinitely as usual.
+         *
+         * @param port_name The endpoint on which a message is to be received.
+         * @param timeout Seconds to wait for the message.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         *
+         * @throw std::runtime_error if the given port is not connected.
+         * @throw ReceiveTimeoutError if no message arrived within the
+         *      timeout.
+         */
+        Message receive_with_timeout(
+                std::string const & port_name, double timeout);
+
+        /** Receive a message, giving up after a timeout.
+         *
+         * As receive_with_timeout(), but with a default value to return
+         * if the port is not connected. Note that the timeout still
+         * applies if the port is connected; see above.
+         *
+         * @param port_name The endpoint on which a message is to be received.
+         * @param timeout Seconds to wait for the message.
+         * @param default_msg A default value to return if this port is not
+         *      connected.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         *
+         * @throw ReceiveTimeoutError if no message arrived within the
+         *      timeout.
+         */
+        Message receive_with_timeout(
+                std::string const & port_name, double timeout,
+                Message const & default_msg);
+
+        /** Receive a message, giving up after a timeout.
+         *
+         * As receive_with_timeout(), but receiving on a slot of a
+         * vector port.
+         *
+         * @param port_name The endpoint on which a message is to be received.
+         * @param timeout Seconds to wait for the message.
+         * @param slot The slot to receive the message on.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         *
+         * @throw std::runtime_error if the given port is not connected.
+         * @throw ReceiveTimeoutError if no message arrived within the
+         *      timeout.
+         */
+        Message receive_with_timeout(
+                std::string const & port_name, double timeout, int slot);
+
+        /** Receive a message, giving up after a timeout.
+         *
+         * As receive_with_timeout(), but receiving on a slot of a
+         * vector port, with a default value to return if the port is
+         * not connected.
+         *
+         * @param port_name The endpoint on which a message is to be received.
+         * @param timeout Seconds to wait for the message.
+         * @param slot The slot to receive the message on.
+         * @param default_msg A default value to return if this port is not
+         *      connected.
+         *
+         * @return The received message. The settings attribute of the received
+         *      message will not be set.
+         *
+         * @throw ReceiveTimeoutError if no message arrived within the
+         *      timeout.
+         */
+        Message receive_with_timeout(
+                std::string const & port_name, double timeout, int slot,
+                Message const & default_msg);
+
+        /** Receive a message on every slot of a vector port.
+         *
+         * Receiving is a blocking operation. This function requests the
+         * messages for all of the port's slots from their senders up
+         * front, so that they are transferred concurrently, then waits
+         * until they have all arrived and returns them in slot order.
+         * For a vector port with many slots, this is much faster than
+         * receiving on each slot in turn.
+         *
+         * If the port you are receiving on is not a vector port, or one
+         * of its slots is not connected, an exception will be thrown.
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously. The received messages will be returned in the
+         * root process, all other processes will receive dummy messages.
+         * It is therefore up to the model code to scatter or broadcast
+         * the received messages to the non-root processes, if necessary.
+         *
+         * @param port_name The vector port on which to receive.
+         *
+         * @return The received messages, indexed by slot. The settings
+         *      attribute of the received messages will not be set.
+         *
+         * @throw std::runtime_error if the given port is not a vector
+         *      port or is not connected.
+         */
+        std::vector<Message> receive_all(std::string const & port_name);
+
+        /** Receives all queued messages on a port in one round trip.
+         *
+         * This blocks until at least one message is available, like
+         * receive(), but also returns any further messages the sender
+         * already had queued for this port, up to max_messages in
+         * total, in the order in which they were sent. A consumer that
+         * has fallen behind a fast producer, e.g. a logger or analysis
+         * component attached to a model running at full speed, catches
+         * up at one round trip per batch this way, rather than one
+         * per message.
+         *
+         * The peer must run libmuscle C++; the Python implementation
+         * does not understand batch requests. Use this on scalar ports
+         * only; for a vector port, use receive_all() or per-slot
+         * receives instead, and on F_INIT ports use receive(), as
+         * those receive only one message per reuse.
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously. The received messages will be returned in the
+         * root process, all other processes will receive an empty
+         * vector.
+         *
+         * @param port_name The port on which to receive.
+         * @param max_messages Maximum number of messages to return.
+         *
+         * @return The received messages, at least one, in send order.
+         *      The settings attribute of the received messages will
+         *      not be set.
+         *
+         * @throw std::logic_error if the given port is a vector port
+         *      or an F_INIT port.
+         * @throw std::runtime_error if the port is not connected, or
+         *      if it was closed by the peer.
+         */
+        std::vector<Message> receive_batch(
+                std::string const & port_name, int max_messages);
+
+        /** Waits until a message is available on any of the given ports.
+         *
+         * This asks each port's sender for its next message, then
+         * waits until at least one of the messages has arrived, and
+         * returns the name of its port. The message itself is kept,
+         * and returned by a following receive() on that port without
+         * further waiting. Calling wait_any() in a loop thus processes
+         * messages from several peers in the order in which they
+         * arrive, e.g. in an ensemble driver collecting results, where
+         * receiving from each peer in a fixed order would block on the
+         * slowest one while results from the others sit waiting.
+         *
+         * The ports must be connected scalar ports, and not F_INIT
+         * ports; messages on those were already received by
+         * reuse_instance(), so there is nothing to wait for. If
+         * several ports have a message available, then one of them is
+         * returned; which one is unspecified.
+         *
+         * MPI-based components must call this function in all
+         * processes simultaneously. The port name is returned in the
+         * root process, all other processes get an empty string.
+         *
+         * @param port_names The names of the ports to wait on.
+         *
+         * @return The name of a port on which a message is available.
+         *
+         * @throw std::logic_error if a port is a vector port or an
+         *      F_INIT port.
+         * @throw std::runtime_error if a port does not exist, is
+         *      disconnected, or was closed by the peer.
+         */
+        std::string wait_any(std::vector<std::string> const & port_names);
+
+        /** Register a buffer that received payloads are copied into.
+         *
+         * In an iteration loop that receives the same-shaped field
+         * every step, the remaining per-step cost of a receive is
+         * copying the payload out of the received message into the
+         * model's own array. Registering the array as a receive target
+         * moves that copy into libmuscle: whenever a message is
+         * received on the port, the payload bytes of its data are
+         * copied straight out of the receive buffer into the given
+         * buffer, and the message that receive() returns can be used
+         * for its metadata alone. Registration is done once, before
+         * the loop; the buffer must stay valid until the port is no
+         * longer received on.
+         *
+         * The message data must be a grid or a byte array, and its
+         * payload must be exactly num_bytes long, so the shape of the
+         * received field may not change between steps. Use the
+         * key-based overload if the data is a dict or record batch
+         * instead.
+         *
+         * MPI-based components may call this only in the root process;
+         * other processes do not receive data, and registration is
+         * ignored there.
+         *
+         * @param port_name The port to register the target for.
+         * @param dest The buffer to copy received payloads into.
+         * @param num_bytes The size of the buffer in bytes.
+         *
+         * @throw std::logic_error if the port does not exist.
+         */
+        void register_receive_target(
+                std::string const & port_name,
+                void * dest, std::size_t num_bytes);
+
+        /** Register a buffer for one entry of received payloads.
+         *
+         * As the two-argument register_receive_target(), but for
+         * messages whose data is a dict or a record batch: the payload
+         * copied into the buffer is that of the grid or byte array
+         * under the given dict key, or of the record batch column with
+         * the given name. Several targets may be registered on one
+         * port, one per key.
+         *
+         * @param port_name The port to register the target for.
+         * @param key The dict key or column name to take the payload
+         *      from.
+         * @param dest The buffer to copy received payloads into.
+         * @param num_bytes The size of the buffer in bytes.
+         *
+         * @throw std::logic_error if the port does not exist.
+         */
+        void register_receive_target(
+                std::string const & port_name, std::string const & key,
+                void * dest, std::size_t num_bytes);
+
+        /** Register a callback that processes received payloads in place.
+         *
+         * As register_receive_target(), but instead of copying the
+         * payload into a buffer, the given callback is called with a
+         * pointer to the payload bytes and their number, while they
+         * are still in the receive buffer. Use this when the payload
+         * needs more than a straight copy, e.g. converting it to
+         * another element type, or scattering halo blocks to the other
+         * processes of an MPI component: the work is then fused into
+         * the one pass the receive makes over the data, rather than
+         * done as a separate traversal of a large payload afterwards.
+         *
+         * The callback runs on the thread that calls receive(), before
+         * receive() returns, and must not call back into this
+         * Instance. The pointer it is given is only valid during the
+         * call; the payload size may differ between messages.
+         *
+         * Callbacks and buffer targets may be mixed on one port, one
+         * per key; registering again for the same port and key
+         * replaces the earlier registration, of either kind.
+         *
+         * MPI-based components may call this only in the root process;
+         * other processes do not receive data, and registration is
+         * ignored there.
+         *
+         * @param port_name The port to register the callback for.
+         * @param callback Called with the payload bytes of each
+         *      message received on the port.
+         *
+         * @throw std::logic_error if the port does not exist.
+         */
+        void register_receive_callback(
+                std::string const & port_name,
+                std::function<void(char const *, std::size_t)> callback);
+
+        /** Register a callback for one entry of received payloads.
+         *
+         * As the two-argument register_receive_callback(), but for
+         * messages whose data is a dict or a record batch: the
+         * callback is called with the payload of the grid or byte
+         * array under the given dict key, or of the record batch
+         * column with the given name.
+         *
+         * @param port_name The port to register the callback for.
+         * @param key The dict key or column name to take the payload
+         *      from.
+         * @param callback Called with the payload bytes of each
+         *      message received on the port.
+         *
+         * @throw std::logic_error if the port does not exist.
+         */
+        void register_receive_callback(
+                std::string const & port_name, std::string const & key,
+                std::function<void(char const *, std::size_t)> callback);
+
+        /** Requests a message on the given port without waiting for it.
+         *
+         * This sends the request for the message to the sender and
+         * returns immediately; a subsequent receive() on the same port
+         * picks the response up. Starting the receives for many ports
+         * up front overlaps their transfers, rather than paying one
+         * blocking round trip at a time, and does so without needing a
+         * thread for each pending receive. An ensemble driver can
+         * start the receives for thousands of outstanding samples this
+         * way, then collect them with ordinary receives.
+         *
+         * Receives on a port are answered in order, so after starting
+         * a receive, the next receive on that port gets the requested
+         * message; don't start a receive you do not intend to finish.
+         * Starting one when a request is already in flight, e.g.
+         * because the previous receive prefetched the next message,
+         * does nothing. On F_INIT ports the messages have already been
+         * received by reuse_instance(), so this is a no-op there too.
+         *
+         * MPI-based components may call this only in the root process.
+         *
+         * @param port_name The port on which a message is expected.
+         *
+         * @throw std::runtime_error if the port does not exist.
+         */
+        void start_receive(std::string const & port_name);
+
+        /** Requests a message on a vector port without waiting for it.
+         *
+         * As the one-argument start_receive(), for a slot of a vector
+         * port.
+         *
+         * @param port_name The port on which a message is expected.
+         * @param slot The slot to receive on.
+         *
+         * @throw std::runtime_error if the port does not exist.
+         */
+        void start_receive(std::string const & port_name, int slot);
+
+        /** Receive a message on one port and send it on via another.
+         *
+         * This is intended for relay components that pass messages on
+         * unchanged, for instance fan-in or fan-out components. It is
+         * much faster than a receive() followed by a send(), because
+         * the message's payload and settings overlay are passed along
+         * as the bytes they were received as, without being decoded and
+         * re-encoded; only the message header is rewritten.
+         *
+         * If a close-port message is received, then it is passed on and
+         * the receiving port is closed, just as with receive().
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously. The message is forwarded by the root process,
+         * the other processes do not see it.
+         *
+         * @param receiving_port_name The port to receive the message on.
+         * @param sending_port_name The port to send the message on.
+         *
+         * @return The simulation timestamp of the forwarded message.
+         *
+         * @throw std::runtime_error if the receiving port is not
+         *      connected.
+         */
+        double forward(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name);
+
+        /** Receive a message on one port and send it on via another.
+         *
+         * As forward(), but receiving and sending on a slot of a vector
+         * port. The same slot is used on both ports.
+         *
+         * @param receiving_port_name The port to receive the message on.
+         * @param sending_port_name The port to send the message on.
+         * @param slot The slot to receive and send the message on.
+         *
+         * @return The simulation timestamp of the forwarded message.
+         *
+         * @throw std::runtime_error if the receiving port is not
+         *      connected.
+         */
+        double forward(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                int slot);
+
+        /** Forward all queued messages on a port in one round trip.
+         *
+         * As forward(), but asking the sender for any further messages
+         * it already has queued for the receiving port as well, up to
+         * max_messages in total, and sending them all on. A relay in a
+         * deep fan-in tree drains a burst of messages at one round trip
+         * per hop this way, rather than one per message. This blocks
+         * until at least one message is available, like forward().
+         *
+         * The receiving port must be a connected scalar port. The
+         * Python implementation does not understand batch requests, so
+         * use this only if the sending peer is known to run libmuscle
+         * C++; forward() works with any peer.
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously. The messages are forwarded by the root
+         * process; the other processes get an empty list.
+         *
+         * @param receiving_port_name The port to receive messages on.
+         * @param sending_port_name The port to send the messages on.
+         * @param max_messages Maximum number of messages to forward.
+         *
+         * @return The simulation timestamps of the forwarded messages,
+         *      at least one, in send order.
+         *
+         * @throw std::logic_error if the receiving port is a vector
+         *      port or an F_INIT port.
+         * @throw std::runtime_error if the receiving port does not
+         *      exist or is not connected.
+         */
+        std::vector<double> forward_batch(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                int max_messages);
+
         /** Receive a message with attached settings overlay.
          *
          * This function should not be used in submodels. It is intended for
@@ -520,6 +1350,137 @@ class Instance {
                 std::string const & port_name, int slot,
                 Message const & default_msg);
 
+        /** Check if this instance is resuming from a snapshot.
+         *
+         * Must be used by components that implement the checkpointing API.
+         * You'll get a std::runtime_error when not calling this method in
+         * an instance that uses the checkpointing API.
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously.
+         *
+         * This method returns True for the first reuse loop iteration after
+         * resuming from a previously taken snapshot.
+         *
+         * @return true iff the instance is resuming from a snapshot.
+         */
+        bool resuming();
+
+        /** Check if this instance should initialize.
+         *
+         * Must be used by components that implement the checkpointing API.
+         *
+         * When resuming from a previous snapshot, instances need not
+         * initialize again and this method returns false. Otherwise, it
+         * returns true and the instance should process F_INIT messages as
+         * usual.
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously.
+         *
+         * @return true if the instance should initialize.
+         */
+        bool should_init();
+
+        /** Load a snapshot.
+         *
+         * Must only be called when resuming() returns true.
+         *
+         * MPI-based components may only call this function in the root
+         * process. The snapshot must be scattered or broadcast to the
+         * non-root processes by the model code, if necessary.
+         *
+         * @return Message containing the state as saved in a previous run
+         *      through save_snapshot() or save_final_snapshot().
+         * @throws std::runtime_error if not resuming from a snapshot.
+         */
+        Message load_snapshot();
+
+        /** Check if a snapshot should be saved after the S operator.
+         *
+         * This method checks if a snapshot should be saved right now, based
+         * on the provided timestamp and the checkpoints defined in the
+         * workflow configuration.
+         *
+         * If this method returns true, then the model should save a snapshot
+         * through save_snapshot().
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously.
+         *
+         * @param timestamp The current simulation time.
+         * @return true iff a snapshot should be saved.
+         */
+        bool should_save_snapshot(double timestamp);
+
+        /** Save a snapshot after the S operator.
+         *
+         * Before saving a snapshot, you should check using
+         * should_save_snapshot() if a snapshot should be saved according to
+         * the checkpoint rules specified in the workflow configuration.
+         *
+         * MPI-based components may only call this function in the root
+         * process, with the global state of the model gathered there.
+         *
+         * @param message Message object containing the state of the model.
+         *      The data attribute of this message is saved, and its
+         *      timestamp should be the current simulation time.
+         */
+        void save_snapshot(Message const & message);
+
+        /** Check if a snapshot should be saved at the end of the reuse loop.
+         *
+         * This method checks if a final snapshot should be saved. If so, the
+         * model should save a snapshot through save_final_snapshot().
+         *
+         * This method must be called exactly once in the reuse loop, at the
+         * end of it, as it also decides whether the instance will be reused
+         * again, and a subsequent call to reuse_instance() returns the
+         * cached result of that decision.
+         *
+         * MPI-based components must call this function in all processes
+         * simultaneously.
+         *
+         * @return true iff a final snapshot should be saved.
+         */
+        bool should_save_final_snapshot();
+
+        /** Save a snapshot at the end of the reuse loop.
+         *
+         * Before saving a final snapshot, you should check using
+         * should_save_final_snapshot() if a snapshot should be saved.
+         *
+         * MPI-based components may only call this function in the root
+         * process, with the global state of the model gathered there.
+         *
+         * @param message Message object containing the state of the model.
+         *      The data attribute of this message is saved, and its
+         *      timestamp should be the current simulation time.
+         */
+        void save_final_snapshot(Message const & message);
+
+        /** Returns a report of this process's memory use.
+         *
+         * This combines the kernel's resident set size (and its peak)
+         * with libmuscle's own accounting, which attributes live bytes
+         * between payload buffers, serialisation zones and queued
+         * outgoing messages, and lists the bytes sent and received per
+         * port. Log it periodically in long ensemble runs to size
+         * nodes and to catch a component whose memory use grows
+         * without bound, without attaching external tooling.
+         *
+         * Payload buffers and outbox backlog are always tracked.
+         * Tracking the many small zone allocations costs a little per
+         * allocation, so it is off by default; set
+         * MUSCLE_MEMORY_ACCOUNTING in the environment to enable it.
+         *
+         * MPI-based components may call this in any process; each
+         * process reports its own memory use.
+         *
+         * @return A human-readable, multi-line report.
+         */
+        std::string memory_report() const;
+
     private:
         class Impl;
         std::unique_ptr<Impl> pimpl_;
@@ -0,0 +1,201 @@
+#include <libmuscle/instrumentation.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <signal.h>
+#include <unistd.h>
+
+
+namespace {
+
+using libmuscle::impl::instrumentation::PortCounters;
+
+// head of the list of per-port counters; entries are added under
+// port_mutex_, but may be read without locking
+std::atomic<PortCounters *> port_list_(nullptr);
+std::mutex port_mutex_;
+
+
+void write_str_(int fd, char const * str) {
+    std::size_t length = 0u;
+    while (str[length] != '\0')
+        ++length;
+    ::write(fd, str, length);
+}
+
+void write_uint_(int fd, std::uint64_t value) {
+    char buf[20];
+    int i = 20;
+    do {
+        buf[--i] = '0' + static_cast<char>(value % 10u);
+        value /= 10u;
+    } while (value > 0u);
+    ::write(fd, buf + i, 20 - i);
+}
+
+void write_counter_(int fd, char const * name, std::uint64_t value) {
+    write_str_(fd, name);
+    write_str_(fd, ": ");
+    write_uint_(fd, value);
+    write_str_(fd, "\n");
+}
+
+void handle_signal_(int) {
+    libmuscle::impl::instrumentation::write_report(STDERR_FILENO);
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace instrumentation {
+
+Counters & counters() {
+    static Counters counters;
+    return counters;
+}
+
+PortCounters & port_counters(std::string const & port_name) {
+    for (
+            PortCounters * entry = port_list_.load(std::memory_order_acquire);
+            entry != nullptr; entry = entry->next)
+        if (port_name == entry->name)
+            return *entry;
+
+    std::lock_guard<std::mutex> lock(port_mutex_);
+    // someone may have registered it while we waited for the lock
+    for (
+            PortCounters * entry = port_list_.load(std::memory_order_acquire);
+            entry != nullptr; entry = entry->next)
+        if (port_name == entry->name)
+            return *entry;
+
+    // deliberately leaked, so that the list stays walkable until the
+    // process exits, even from the signal handler
+    PortCounters * entry = new PortCounters;
+    std::strncpy(entry->name, port_name.c_str(), sizeof(entry->name) - 1u);
+    entry->next = port_list_.load(std::memory_order_relaxed);
+    port_list_.store(entry, std::memory_order_release);
+    return *entry;
+}
+
+std::uint64_t wait_percentile(PortCounters const & port, int percentile) {
+    std::uint64_t total = 0u;
+    for (auto const & bucket : port.wait_histogram)
+        total += bucket.load(std::memory_order_relaxed);
+    if (total == 0u)
+        return 0u;
+
+    std::uint64_t rank = (total * percentile + 99u) / 100u;
+    std::uint64_t seen = 0u;
+    for (std::size_t i = 0u; i < PortCounters::num_wait_buckets; ++i) {
+        seen += port.wait_histogram[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+            return std::uint64_t(1u) << (i + 1u);
+    }
+    return std::uint64_t(1u) << PortCounters::num_wait_buckets;
+}
+
+void write_report(int fd) {
+    Counters const & c = counters();
+    write_str_(fd, "libmuscle instrumentation counters:\n");
+    write_counter_(fd, "  messages_sent",
+            c.messages_sent.load(std::memory_order_relaxed));
+    write_counter_(fd, "  bytes_sent",
+            c.bytes_sent.load(std::memory_order_relaxed));
+    write_counter_(fd, "  messages_received",
+            c.messages_received.load(std::memory_order_relaxed));
+    write_counter_(fd, "  bytes_received",
+            c.bytes_received.load(std::memory_order_relaxed));
+    write_counter_(fd, "  outbox_depth_high_water",
+            c.outbox_depth_high_water.load(std::memory_order_relaxed));
+    write_counter_(fd, "  lock_wait_ns",
+            c.lock_wait_ns.load(std::memory_order_relaxed));
+    write_counter_(fd, "  peer_rtt_us",
+            c.peer_rtt_us.load(std::memory_order_relaxed));
+    write_counter_(fd, "  mapped_buffer_bytes",
+            c.mapped_buffer_bytes.load(std::memory_order_relaxed));
+    write_counter_(fd, "  zone_bytes",
+            c.zone_bytes.load(std::memory_order_relaxed));
+    write_counter_(fd, "  outbox_bytes",
+            c.outbox_bytes.load(std::memory_order_relaxed));
+
+    for (
+            PortCounters * entry = port_list_.load(std::memory_order_acquire);
+            entry != nullptr; entry = entry->next) {
+        write_str_(fd, "  port ");
+        write_str_(fd, entry->name);
+        write_str_(fd, " sent: ");
+        write_uint_(fd, entry->messages_sent.load(std::memory_order_relaxed));
+        write_str_(fd, " received: ");
+        write_uint_(fd,
+                entry->messages_received.load(std::memory_order_relaxed));
+        if (entry->wait_ns.load(std::memory_order_relaxed) > 0u) {
+            write_str_(fd, " wait_ns p50: ");
+            write_uint_(fd, wait_percentile(*entry, 50));
+            write_str_(fd, " p90: ");
+            write_uint_(fd, wait_percentile(*entry, 90));
+            write_str_(fd, " p99: ");
+            write_uint_(fd, wait_percentile(*entry, 99));
+        }
+        write_str_(fd, "\n");
+    }
+}
+
+bool memory_accounting_enabled() {
+    static bool enabled = (std::getenv("MUSCLE_MEMORY_ACCOUNTING") != nullptr);
+    return enabled;
+}
+
+std::string memory_report() {
+    std::ostringstream report;
+
+    // the kernel's view: resident set size and its peak
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+        if (
+                line.compare(0u, 6u, "VmRSS:") == 0 ||
+                line.compare(0u, 6u, "VmHWM:") == 0)
+            report << line << "\n";
+
+    Counters const & c = counters();
+    report << "mapped_buffer_bytes: "
+        << c.mapped_buffer_bytes.load(std::memory_order_relaxed) << "\n";
+    if (memory_accounting_enabled())
+        report << "zone_bytes: "
+            << c.zone_bytes.load(std::memory_order_relaxed) << "\n";
+    else
+        report << "zone_bytes: not tracked, set MUSCLE_MEMORY_ACCOUNTING"
+            " to enable\n";
+    report << "outbox_bytes: "
+        << c.outbox_bytes.load(std::memory_order_relaxed) << "\n";
+
+    for (
+            PortCounters * entry = port_list_.load(std::memory_order_acquire);
+            entry != nullptr; entry = entry->next)
+        report << "port " << entry->name
+            << " bytes_sent: "
+            << entry->bytes_sent.load(std::memory_order_relaxed)
+            << " bytes_received: "
+            << entry->bytes_received.load(std::memory_order_relaxed)
+            << "\n";
+
+    return report.str();
+}
+
+void enable_signal_dump() {
+    // make sure the counters exist before the handler can run
+    counters();
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = handle_signal_;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &action, nullptr);
+}
+
+} } }   // namespace libmuscle::impl::instrumentation
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+
+namespace libmuscle { namespace impl { namespace instrumentation {
+
+/** Always-on counters for diagnosing a running coupling.
+ *
+ * Unlike the profiler, which records timestamped events and sends them
+ * to the manager, these are plain counters that are always maintained.
+ * They are updated with relaxed atomic operations, at most a few times
+ * per message, so the overhead is negligible and they can stay enabled
+ * in production.
+ *
+ * The counters can be dumped to stderr on demand by sending the process
+ * SIGUSR1, if the handler is enabled by setting MUSCLE_INSTRUMENTATION
+ * in the environment. That way a slow coupling can be diagnosed without
+ * attaching a profiler to a production run.
+ */
+struct Counters {
+    /// On-the-wire messages deposited for sending
+    std::atomic<std::uint64_t> messages_sent{0u};
+    /// Total encoded size of the messages sent
+    std::atomic<std::uint64_t> bytes_sent{0u};
+    /// Messages received
+    std::atomic<std::uint64_t> messages_received{0u};
+    /// Total encoded size of the messages received
+    std::atomic<std::uint64_t> bytes_received{0u};
+    /// Largest number of messages queued in any outbox so far
+    std::atomic<std::uint64_t> outbox_depth_high_water{0u};
+    /// Total time spent waiting for contended locks, see TimedLockGuard
+    std::atomic<std::uint64_t> lock_wait_ns{0u};
+    /// Last sampled TCP round-trip time to a peer, in microseconds
+    std::atomic<std::uint64_t> peer_rtt_us{0u};
+    /// Live bytes in large mapped payload buffers, see data.cpp
+    std::atomic<std::uint64_t> mapped_buffer_bytes{0u};
+    /// Live bytes allocated from msgpack zones; only maintained if
+    /// memory accounting is enabled, see memory_accounting_enabled()
+    std::atomic<std::uint64_t> zone_bytes{0u};
+    /// Live encoded bytes queued in outboxes, in memory
+    std::atomic<std::uint64_t> outbox_bytes{0u};
+};
+
+/** Returns the global counters. */
+Counters & counters();
+
+/** Per-port message counters.
+ *
+ * These form a linked list that only ever grows, so that it can be
+ * walked without locking, in particular from the signal handler.
+ */
+struct PortCounters {
+    /// Name of the port, truncated if it is very long
+    char name[64] = {};
+    /// Messages sent on this port
+    std::atomic<std::uint64_t> messages_sent{0u};
+    /// Messages received on this port
+    std::atomic<std::uint64_t> messages_received{0u};
+    /// Encoded bytes sent on this port
+    std::atomic<std::uint64_t> bytes_sent{0u};
+    /// Encoded bytes received on this port
+    std::atomic<std::uint64_t> bytes_received{0u};
+    /// Number of buckets in the receive wait histogram
+    static std::size_t const num_wait_buckets = 32u;
+    /// Histogram of blocked receive durations on this port; bucket i
+    /// counts waits of at least 2^i and less than 2^(i+1) nanoseconds,
+    /// with the final bucket taking everything beyond
+    std::atomic<std::uint64_t> wait_histogram[32] = {};
+    /// Total time spent blocked receiving on this port, in nanoseconds
+    std::atomic<std::uint64_t> wait_ns{0u};
+    /// Next entry in the list, nullptr at the end
+    PortCounters * next = nullptr;
+};
+
+/** Returns the counters for the given port, registering it if needed.
+ *
+ * Registration takes a lock, but subsequent calls only walk the list,
+ * so this may be called on the hot path if the number of ports is
+ * reasonable.
+ *
+ * @param port_name The name of the port.
+ * @return The counters for that port.
+ */
+PortCounters & port_counters(std::string const & port_name);
+
+/** Adds the given amount to a counter. */
+inline void count(
+        std::atomic<std::uint64_t> & counter, std::uint64_t amount = 1u) {
+    counter.fetch_add(amount, std::memory_order_relaxed);
+}
+
+/** Subtracts the given amount from a counter.
+ *
+ * Used for gauges tracking live amounts, like memory in use, where
+ * count() records an acquisition and this records the release.
+ */
+inline void uncount(
+        std::atomic<std::uint64_t> & counter, std::uint64_t amount = 1u) {
+    counter.fetch_sub(amount, std::memory_order_relaxed);
+}
+
+/** Raises a high-water mark counter to the given value, if it is higher. */
+inline void record_high_water(
+        std::atomic<std::uint64_t> & counter, std::uint64_t value) {
+    std::uint64_t current = counter.load(std::memory_order_relaxed);
+    while (value > current)
+        if (counter.compare_exchange_weak(
+                    current, value, std::memory_order_relaxed))
+            break;
+}
+
+/** Records a blocked receive wait on a port.
+ *
+ * Adds the duration to the port's wait histogram. The buckets are
+ * log-spaced powers of two, which distinguishes a microsecond hand-off
+ * from a second-long stall in a fixed small number of counters, and
+ * costs only two relaxed increments per receive, so this stays always
+ * on. Percentiles can be read back with wait_percentile().
+ *
+ * @param port The counters of the port that was received on.
+ * @param ns The blocked duration, in nanoseconds.
+ */
+inline void record_wait(PortCounters & port, std::uint64_t ns) {
+    count(port.wait_ns, ns);
+    std::size_t bucket = 0u;
+    while (ns >> 1u != 0u && bucket + 1u < PortCounters::num_wait_buckets) {
+        ns >>= 1u;
+        ++bucket;
+    }
+    count(port.wait_histogram[bucket]);
+}
+
+/** Estimates a percentile of a port's blocked receive durations.
+ *
+ * The estimate is the upper bound of the histogram bucket containing
+ * the requested percentile, so it is accurate to within a factor of
+ * two, which is plenty to tell a straggling conduit from a fast one.
+ *
+ * @param port The counters of the port.
+ * @param percentile The percentile to estimate, between 1 and 100.
+ * @return The estimated duration in nanoseconds, or 0 if no waits
+ *         were recorded.
+ */
+std::uint64_t wait_percentile(PortCounters const & port, int percentile);
+
+/** As std::lock_guard, but records time spent waiting for the lock.
+ *
+ * If the lock is free, this doesn't read the clock at all, so it can
+ * replace std::lock_guard in hot code at no cost. If the lock is
+ * contended, then the time spent waiting for it is added to the
+ * lock_wait_ns counter.
+ */
+class TimedLockGuard {
+    public:
+        explicit TimedLockGuard(std::mutex & mutex)
+            : mutex_(mutex)
+        {
+            if (!mutex_.try_lock()) {
+                auto start = std::chrono::steady_clock::now();
+                mutex_.lock();
+                count(counters().lock_wait_ns,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - start).count());
+            }
+        }
+
+        TimedLockGuard(TimedLockGuard const &) = delete;
+        TimedLockGuard & operator=(TimedLockGuard const &) = delete;
+
+        ~TimedLockGuard() {
+            mutex_.unlock();
+        }
+
+    private:
+        std::mutex & mutex_;
+};
+
+/** Writes all the counters to the given file descriptor.
+ *
+ * This is async-signal-safe: it uses only write() and does not
+ * allocate, so it may be called from a signal handler.
+ *
+ * @param fd The file descriptor to write to.
+ */
+void write_report(int fd);
+
+/** Installs a SIGUSR1 handler that dumps the counters to stderr. */
+void enable_signal_dump();
+
+/** Returns whether per-allocation memory accounting is enabled.
+ *
+ * Tracking live zone allocations costs a counter update and a zone
+ * finalizer per allocation, which is too much to leave on for the many
+ * small allocations of dict-heavy workloads, so it is opt-in: set
+ * MUSCLE_MEMORY_ACCOUNTING in the environment to enable it. The
+ * cheaper gauges (mapped buffers, outbox backlog) are always on.
+ */
+bool memory_accounting_enabled();
+
+/** Returns a report of this process's memory use.
+ *
+ * This combines the kernel's view of the process (resident set size
+ * and its peak) with libmuscle's live gauges, which attribute memory
+ * between payload buffers, serialisation zones and queued outgoing
+ * messages, and with the per-port traffic counters. See
+ * Instance::memory_report().
+ *
+ * Unlike write_report(), this allocates and is not signal-safe.
+ *
+ * @return A human-readable, multi-line report.
+ */
+std::string memory_report();
+
+} } }   // namespace libmuscle::impl::instrumentation
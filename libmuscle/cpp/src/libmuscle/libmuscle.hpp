@@ -1,16 +1,23 @@
 #include <libmuscle/data.hpp>
+#include <libmuscle/grid_template.hpp>
+#include <libmuscle/grid_view.hpp>
 #include <libmuscle/instance.hpp>
 #include <libmuscle/mcp/data_pack.hpp>
 #include <libmuscle/message.hpp>
+#include <libmuscle/port_handle.hpp>
 #include <libmuscle/ports_description.hpp>
+#include <libmuscle/receive_timeout_error.hpp>
 
 
 namespace libmuscle {
     using impl::Data;
     using impl::DataConstRef;
+    using impl::GridTemplate;
     using impl::Instance;
     using impl::Message;
+    using impl::PortHandle;
     using impl::PortsDescription;
+    using impl::ReceiveTimeoutError;
     using impl::StorageOrder;
 }
 
@@ -1,6 +1,43 @@
 #include "libmuscle/logger.hpp"
 #include "libmuscle/util.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+
+namespace {
+
+/* The binary local log format.
+ *
+ * The file starts with the magic, a version byte identifying the
+ * record schema, and the instance id, stored once rather than per
+ * record. Each record is then a level byte, the timestamp as a raw
+ * double, and the length-prefixed message text. Multi-byte values are
+ * little-endian host format, the same choice made for the wire
+ * format; see tcp_util.hpp.
+ */
+char const binary_log_magic_[8] = {
+        'M', 'U', 'S', 'C', 'L', 'E', '3', 'L'};
+char const binary_log_version_ = 1;
+
+void append_bytes_(
+        std::vector<char> & buffer, void const * data, std::size_t length) {
+    char const * bytes = static_cast<char const *>(data);
+    buffer.insert(buffer.end(), bytes, bytes + length);
+}
+
+void append_uint32_(std::vector<char> & buffer, std::uint32_t value) {
+    append_bytes_(buffer, &value, sizeof(value));
+}
+
+}
+
 
 namespace libmuscle { namespace impl {
 
@@ -9,33 +46,247 @@ Logger::Logger(std::string const & instance_id, std::string const & log_file, MM
     , manager_(manager)
     , remote_level_(LogLevel::WARNING)
     , local_level_(LogLevel::INFO)
+    , min_level_(LogLevel::INFO)
+    , writing_(false)
+    , shutting_down_(false)
 {
+    remote_rate_limit_ = 0.0;
+    char const * rate_limit = std::getenv("MUSCLE_LOG_RATE_LIMIT");
+    if (rate_limit != nullptr)
+        remote_rate_limit_ = std::atof(rate_limit);
+    remote_tokens_ = remote_rate_limit_;
+    last_refill_ = std::chrono::steady_clock::now();
+    num_suppressed_ = 0u;
+
+    binary_log_ = false;
     if (log_file.empty())
         local_log_stream_ = &std::cerr;
     else {
-        local_log_file_.open(log_file, std::ios_base::app);
+        binary_log_ = (std::getenv("MUSCLE_LOG_BINARY") != nullptr);
+        auto mode = std::ios_base::app;
+        if (binary_log_)
+            mode |= std::ios_base::binary;
+        local_log_file_.open(log_file, mode);
         local_log_stream_ = &local_log_file_;
+        // write the header, unless we're appending to an existing log
+        if (binary_log_ && local_log_file_.tellp() == std::streampos(0)) {
+            std::vector<char> header;
+            append_bytes_(header, binary_log_magic_, sizeof(binary_log_magic_));
+            header.push_back(binary_log_version_);
+            append_uint32_(header, instance_id.size());
+            append_bytes_(header, instance_id.data(), instance_id.size());
+            local_log_file_.write(header.data(), header.size());
+        }
     }
+    writer_thread_ = std::thread(&Logger::write_messages_, this);
 }
 
 Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutting_down_ = true;
+    }
+    queue_changed_.notify_one();
+    writer_thread_.join();
     if (local_log_file_.is_open())
         local_log_file_.close();
 }
 
+void Logger::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queue_drained_.wait(lock, [this]() {
+            return queue_.empty() && !writing_; });
+}
+
 void Logger::set_remote_level(LogLevel level) {
     if (level == LogLevel::LOCAL) {
         log(LogLevel::WARNING, "LOCAL is not a valid remote log level, using DEBUG");
         level = LogLevel::DEBUG;
     }
     remote_level_ = level;
+    update_min_level_();
 }
 
 void Logger::set_local_level(LogLevel level) {
     local_level_ = level;
+    update_min_level_();
+}
+
+void Logger::update_min_level_() {
+    LogLevel local = local_level_.load(std::memory_order_relaxed);
+    LogLevel remote = remote_level_.load(std::memory_order_relaxed);
+    min_level_.store(
+            (local < remote) ? local : remote, std::memory_order_relaxed);
 }
 
 void Logger::append_args_(std::ostringstream & s) {}
 
+void Logger::convert_binary_log(std::istream & in, std::ostream & out) {
+    char magic[sizeof(binary_log_magic_)];
+    in.read(magic, sizeof(magic));
+    if (!in || memcmp(magic, binary_log_magic_, sizeof(magic)) != 0)
+        throw std::runtime_error("This is not a MUSCLE3 binary log file.");
+
+    int version = in.get();
+    if (version != binary_log_version_)
+        throw std::runtime_error(
+                "This binary log has version " + std::to_string(version)
+                + ", which this version of MUSCLE3 does not understand.");
+
+    std::uint32_t id_length = 0u;
+    in.read(reinterpret_cast<char *>(&id_length), sizeof(id_length));
+    std::string instance_id(id_length, '\0');
+    in.read(&instance_id[0], id_length);
+    if (!in)
+        throw std::runtime_error("This binary log has a truncated header.");
+
+    for (;;) {
+        int level = in.get();
+        if (level == std::istream::traits_type::eof())
+            break;
+        double seconds;
+        in.read(reinterpret_cast<char *>(&seconds), sizeof(seconds));
+        std::uint32_t text_length = 0u;
+        in.read(reinterpret_cast<char *>(&text_length), sizeof(text_length));
+        std::string text(text_length, '\0');
+        if (text_length > 0u)
+            in.read(&text[0], text_length);
+        if (!in)
+            throw std::runtime_error(
+                    "This binary log ends in a truncated record.");
+
+        out << instance_id << " " << Timestamp(seconds) << " ";
+        out << static_cast<LogLevel>(level) << ": " << text << "\n";
+    }
+}
+
+/* Appends a record to the write buffer in the binary format.
+ *
+ * See the format description at the top of this file. The buffer is
+ * written out once per batch, see write_messages_().
+ */
+void Logger::append_binary_record_(Record_ const & record) {
+    write_buffer_.push_back(static_cast<char>(record.level));
+    append_bytes_(
+            write_buffer_, &record.timestamp.seconds, sizeof(double));
+    append_uint32_(write_buffer_, record.text.size());
+    append_bytes_(write_buffer_, record.text.data(), record.text.size());
+}
+
+/* Takes a token from the remote rate limiter, if there is one.
+ *
+ * This is a token bucket: tokens accrue with time at the configured
+ * rate, up to a second's worth, and each submission to the manager
+ * takes one. Always succeeds when no limit is configured. Only called
+ * from the writer thread.
+ */
+bool Logger::take_remote_token_() {
+    if (remote_rate_limit_ <= 0.0)
+        return true;
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(
+            now - last_refill_).count();
+    last_refill_ = now;
+    remote_tokens_ = std::min(
+            remote_tokens_ + elapsed * remote_rate_limit_,
+            std::max(remote_rate_limit_, 1.0));
+    if (remote_tokens_ < 1.0)
+        return false;
+    remote_tokens_ -= 1.0;
+    return true;
+}
+
+void Logger::enqueue_(
+        LogLevel level, std::string && text, bool to_local, bool to_remote)
+{
+    Record_ record{Timestamp::now(), level, std::move(text),
+            to_local, to_remote};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(record));
+    }
+    queue_changed_.notify_one();
+}
+
+/* Main function of the writer thread.
+ *
+ * Takes messages off the queue and writes them to the local log and to
+ * the manager. Batching happens naturally: while a manager round-trip
+ * is in progress, new messages pile up on the queue, and the next
+ * iteration takes them all at once and submits them as one request.
+ */
+void Logger::write_messages_() {
+    std::vector<Record_> batch;
+    std::vector<LogMessage> remote_messages;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!shutting_down_ || !queue_.empty()) {
+        queue_changed_.wait(lock, [this]() {
+                return shutting_down_ || !queue_.empty(); });
+        std::swap(batch, queue_);
+        writing_ = true;
+        lock.unlock();
+
+        for (auto & record : batch) {
+            if (record.to_remote && !take_remote_token_()) {
+                // over the rate limit; keep it local only, and count
+                // it for the summary sent when the rate drops
+                record.to_remote = false;
+                ++num_suppressed_;
+            }
+            if (record.to_local) {
+                if (binary_log_)
+                    append_binary_record_(record);
+                else {
+                    (*local_log_stream_) << instance_id_ << " ";
+                    (*local_log_stream_) << record.timestamp << " " << record.level;
+                    (*local_log_stream_) << ": " << record.text << std::endl;
+                }
+            }
+            if (record.to_remote)
+                remote_messages.emplace_back(
+                        instance_id_, record.timestamp, record.level,
+                        record.text);
+        }
+
+        if (!write_buffer_.empty()) {
+            local_log_file_.write(write_buffer_.data(), write_buffer_.size());
+            local_log_file_.flush();
+            write_buffer_.clear();
+        }
+
+        if ((num_suppressed_ > 0u) && take_remote_token_()) {
+            std::ostringstream oss;
+            oss << num_suppressed_ << " log messages were held back by"
+                    " the rate limit (MUSCLE_LOG_RATE_LIMIT) and are in"
+                    " the local log only";
+            remote_messages.emplace_back(
+                    instance_id_, Timestamp::now(), LogLevel::WARNING,
+                    oss.str());
+            num_suppressed_ = 0u;
+        }
+
+        if (!remote_messages.empty()) {
+            try {
+                if (remote_messages.size() == 1u)
+                    manager_.submit_log_message(remote_messages.front());
+                else
+                    manager_.submit_log_messages(remote_messages);
+            }
+            catch (std::exception const & e) {
+                (*local_log_stream_) << instance_id_ << " failed to submit";
+                (*local_log_stream_) << " log messages to the manager: ";
+                (*local_log_stream_) << e.what() << std::endl;
+            }
+            remote_messages.clear();
+        }
+        batch.clear();
+
+        lock.lock();
+        writing_ = false;
+        if (queue_.empty())
+            queue_drained_.notify_all();
+    }
+}
+
 } }
 
@@ -7,14 +7,60 @@
 #include <libmuscle/mmp_client.hpp>
 #include <libmuscle/logging.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
+#include <istream>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
+#include <vector>
+
+
+/* Compile-time log level floor.
+ *
+ * Log statements below this level are removed entirely at compile
+ * time: the level is a constant, so the compiler folds the check in
+ * log() and deletes the dead branch, formatting arguments and all.
+ * That makes it safe to leave debug logging in per-element loops
+ * without #ifdef-ing it out for production builds.
+ *
+ * Define MUSCLE_MIN_LOG_LEVEL to one of DEBUG, INFO, WARNING, ERROR,
+ * CRITICAL or DISABLE when compiling to raise the floor; the default
+ * of LOCAL keeps every statement, and run-time filtering applies as
+ * usual above the floor.
+ */
+#ifndef MUSCLE_MIN_LOG_LEVEL
+#define MUSCLE_MIN_LOG_LEVEL LOCAL
+#endif
 
 
 namespace libmuscle { namespace impl {
 
 /** A component that lets you log things to an MMPClient.
+ *
+ * Messages are written and submitted from a background thread, so that
+ * the model does not stall on the manager round-trip or on disk writes.
+ * Messages that pile up while the thread is busy are submitted to the
+ * manager as a single batch.
+ *
+ * The local log file is formatted text by default. With
+ * MUSCLE_LOG_BINARY set in the environment, it is written as compact
+ * binary records instead: the timestamp stays a raw double rather
+ * than being formatted per record, and the records are appended
+ * through a single buffered write per batch. For always-on verbose
+ * logging across many instances that cuts both the CPU spent in the
+ * writer thread and the file volume considerably. Use
+ * convert_binary_log() to turn such a file back into the text form.
+ *
+ * With MUSCLE_LOG_RATE_LIMIT set to a number of messages per second,
+ * submissions to the manager are limited to that rate per instance.
+ * Messages over the limit are still written to the local log, but not
+ * shipped; a summary saying how many were held back is sent in their
+ * place once the rate drops. At ensemble scale this keeps a
+ * misbehaving or overly chatty instance from flooding the manager.
  */
 class Logger {
     public:
@@ -26,10 +72,14 @@ class Logger {
 
         /** Destruct the logger.
          *
-         * Closes the log file.
+         * Writes out any pending messages and closes the log file.
          */
         ~Logger();
 
+        /** Wait until all messages logged so far have been written.
+         */
+        void flush();
+
         /** Set the minimum log level for a message to be sent to the manager.
          */
         void set_remote_level(LogLevel level);
@@ -89,18 +139,75 @@ class Logger {
         template <typename... Args>
         void debug(Args... args);
 
+        /** Converts a binary local log to the text format.
+         *
+         * This reads the records written by a Logger in binary mode
+         * (see MUSCLE_LOG_BINARY) from in, and writes the lines the
+         * text sink would have produced to out.
+         *
+         * @param in The binary log file to read.
+         * @param out The stream to write the text form to.
+         *
+         * @throw std::runtime_error if in does not contain a binary
+         *      MUSCLE3 log, or holds a truncated record.
+         */
+        static void convert_binary_log(std::istream & in, std::ostream & out);
+
     private:
+        // a message on its way to the local log and/or the manager
+        struct Record_ {
+            Timestamp timestamp;
+            LogLevel level;
+            std::string text;
+            bool to_local, to_remote;
+        };
+
+        // updates the cached minimum level, see log()
+        void update_min_level_();
+
         std::string instance_id_;
         MMPClient & manager_;
-        LogLevel remote_level_;
+        std::atomic<LogLevel> remote_level_;
         std::ofstream local_log_file_;
         std::ostream * local_log_stream_;
-        LogLevel local_level_;
+        std::atomic<LogLevel> local_level_;
+        // minimum of the local and remote levels, cached so that the
+        // filter at the top of log() is a single relaxed load
+        std::atomic<LogLevel> min_level_;
+
+        // returns whether the rate limit allows sending to the manager
+        bool take_remote_token_();
+
+        // whether the local log is written as binary records
+        bool binary_log_;
+
+        // remote submission rate limit, see MUSCLE_LOG_RATE_LIMIT;
+        // all of these are touched only by the writer thread
+        double remote_rate_limit_;
+        double remote_tokens_;
+        std::chrono::steady_clock::time_point last_refill_;
+        std::size_t num_suppressed_;
+        // pending binary records, appended in one write per batch
+        std::vector<char> write_buffer_;
+
+        std::vector<Record_> queue_;
+        std::mutex mutex_;
+        std::condition_variable queue_changed_, queue_drained_;
+        bool writing_, shutting_down_;
+        std::thread writer_thread_;
 
         template <typename Arg, typename... Args>
         void append_args_(std::ostringstream & s, Arg arg, Args... args);
 
         void append_args_(std::ostringstream & s);
+
+        void enqueue_(
+                LogLevel level, std::string && text,
+                bool to_local, bool to_remote);
+
+        void append_binary_record_(Record_ const & record);
+
+        void write_messages_();
 };
 
 } }
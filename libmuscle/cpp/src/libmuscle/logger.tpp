@@ -6,20 +6,21 @@ namespace libmuscle { namespace impl {
 
 template <typename... Args>
 void Logger::log(LogLevel level, Args... args) {
-    if ((level >= local_level_) || (level >= remote_level_)) {
-        auto ts = Timestamp::now();
+    // the floor is a compile-time constant, so statements below it
+    // disappear entirely; see MUSCLE_MIN_LOG_LEVEL in logger.hpp
+    if (level < LogLevel::MUSCLE_MIN_LOG_LEVEL)
+        return;
+
+    // one predictable branch on a cached level before any formatting
+    if (level < min_level_.load(std::memory_order_relaxed))
+        return;
+
+    bool to_local = level >= local_level_.load(std::memory_order_relaxed);
+    bool to_remote = level >= remote_level_.load(std::memory_order_relaxed);
+    if (to_local || to_remote) {
         std::ostringstream oss;
         append_args_(oss, args...);
-
-        if (level >= local_level_) {
-            (*local_log_stream_) << instance_id_ << " " << ts << " " << level;
-            (*local_log_stream_) << ": " << oss.str() << std::endl;
-        }
-
-        if (level >= remote_level_) {
-            LogMessage msg(instance_id_, Timestamp::now(), level, oss.str());
-            manager_.submit_log_message(msg);
-        }
+        enqueue_(level, oss.str(), to_local, to_remote);
     }
 }
 
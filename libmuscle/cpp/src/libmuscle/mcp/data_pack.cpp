@@ -1,5 +1,7 @@
 #include "libmuscle/mcp/data_pack.hpp"
 
+#include <cstring>
+
 #include <msgpack.hpp>
 
 
@@ -7,6 +9,62 @@ namespace libmuscle { namespace impl {
 
 namespace mcp {
 
+namespace {
+
+/* Tells msgpack to reference the input buffer rather than copy it. */
+bool reference_all_(msgpack::type::object_type, std::size_t, void *) {
+    return true;
+}
+
+/* Helper stream that packs into a fixed-size buffer.
+ *
+ * Most conduit traffic is tiny messages, which fit into a buffer on the
+ * stack. This stream copies packed data into such a buffer as long as it
+ * fits, and keeps counting bytes after that. If everything fit, then the
+ * buffer holds the complete packed message; if not, then size holds the
+ * exact amount of memory to allocate for a second attempt.
+ */
+struct FixedBuffer {
+    FixedBuffer(char * buf, std::size_t capacity)
+        : buf(buf), capacity(capacity)
+    {}
+
+    void write(char const * data, std::size_t len) {
+        if (size + len <= capacity)
+            memcpy(buf + size, data, len);
+        size += len;
+    }
+
+    bool fits() const {
+        return size <= capacity;
+    }
+
+    char * buf;
+    std::size_t capacity;
+    std::size_t size = 0u;
+};
+
+/* Helper stream that packs into preallocated memory.
+ *
+ * The buffer must be large enough to hold the packed data, see
+ * FixedBuffer.
+ */
+struct RawBuffer {
+    RawBuffer(char * buf) : ptr(buf) {}
+
+    void write(char const * data, std::size_t len) {
+        memcpy(ptr, data, len);
+        ptr += len;
+    }
+
+    char * ptr;
+};
+
+// size of the stack buffer used to pack small data in one pass
+std::size_t const small_data_size_ = 256u;
+
+}
+
 Data unpack_data(std::shared_ptr<msgpack::zone> const & zone, char const * begin, std::size_t length) {
     auto zoned_obj = static_cast<msgpack::object *>(zone->allocate_align(
             sizeof(msgpack::object), MSGPACK_ZONE_ALIGNOF(msgpack::object)));
@@ -14,6 +72,46 @@ Data unpack_data(std::shared_ptr<msgpack::zone> const & zone, char const * begin
     return Data(zoned_obj, zone);
 }
 
+Data unpack_data(char const * begin, std::size_t length) {
+    return unpack_data(DataConstRef::zone_from_pool_(), begin, length);
+}
+
+Data unpack_data_view(
+        std::shared_ptr<msgpack::zone> const & zone,
+        char const * begin, std::size_t length) {
+    auto zoned_obj = static_cast<msgpack::object *>(zone->allocate_align(
+            sizeof(msgpack::object), MSGPACK_ZONE_ALIGNOF(msgpack::object)));
+    *zoned_obj = msgpack::unpack(*zone, begin, length, reference_all_);
+    return Data(zoned_obj, zone);
+}
+
+Data unpack_data_view(DataConstRef const & bytes) {
+    auto zone = DataConstRef::zone_from_pool_();
+    Data result = unpack_data_view(zone, bytes.as_byte_array(), bytes.size());
+    // the result refers into the byte array, so keep its memory alive
+    result.mp_zones_->insert(
+            result.mp_zones_->end(),
+            bytes.mp_zones_->cbegin(), bytes.mp_zones_->cend());
+    return result;
+}
+
+Data pack_data_exact(DataConstRef const & data) {
+    char stack_buf[small_data_size_];
+    FixedBuffer fixed(stack_buf, small_data_size_);
+    pack_data(fixed, data);
+
+    auto bytes = Data::byte_array(fixed.size);
+    if (fixed.fits())
+        // byte_array(ptr, size) is a non-owning view, so copy out of
+        // the stack buffer into the owned one
+        memcpy(bytes.as_byte_array(), stack_buf, fixed.size);
+    else {
+        RawBuffer buf(bytes.as_byte_array());
+        pack_data(buf, data);
+    }
+    return bytes;
+}
+
 }   // namespace mcp
 
 } }   // namespace libmuscle::impl
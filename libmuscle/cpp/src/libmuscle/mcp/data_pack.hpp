@@ -2,6 +2,9 @@
 
 #include "libmuscle/data.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 
 #include <msgpack.hpp>
@@ -26,6 +29,81 @@ Data unpack_data(
         std::shared_ptr<msgpack::zone> const & zone,
         char const * begin, std::size_t length);
 
+/* Helper function that unpacks data using a pooled zone.
+ *
+ * As above, but draws a zone from the shared zone pool instead of
+ * requiring the caller to create one. The pool retains zones across
+ * messages, so decoding a message does not set up allocator bookkeeping
+ * from scratch; zones are cleared and reused when their last user goes
+ * away. Prefer this overload when decoding per-message data.
+ *
+ * @param begin Pointer to beginning of buffer to read from.
+ * @param length Length of the buffer to read from.
+ * @return A Data object with the unpacked data.
+ */
+Data unpack_data(char const * begin, std::size_t length);
+
+/* Helper function that unpacks data without copying it.
+ *
+ * Like unpack_data, but any strings, byte arrays and grid data in the
+ * result refer directly into the given buffer instead of being copied
+ * into the zone. This saves a copy of the payload, which matters for
+ * large grids.
+ *
+ * @param zone Zone to allocate on
+ * @param begin Pointer to beginning of buffer to read from. The buffer
+ *              must stay valid for as long as the result is in use.
+ * @param length Length of the buffer to read from.
+ * @return A Data object with the unpacked data.
+ */
+Data unpack_data_view(
+        std::shared_ptr<msgpack::zone> const & zone,
+        char const * begin, std::size_t length);
+
+/* Helper function that unpacks an encoded byte array without copying.
+ *
+ * As above, but reads from a byte array held by a DataConstRef, and
+ * keeps that object's memory alive for as long as the result exists.
+ * This is the safe variant to use when the buffer is not otherwise
+ * guaranteed to outlive the result.
+ *
+ * @param bytes A DataConstRef holding a byte array with encoded data.
+ * @return A Data object with the unpacked data.
+ */
+Data unpack_data_view(DataConstRef const & bytes);
+
+/* Helper function that packs data into a stream.
+ *
+ * This produces the same bytes as msgpack::pack(), but has a fast path
+ * for lists that consist entirely of doubles: their element records are
+ * staged in a contiguous buffer by a loop that the compiler can
+ * vectorise, and written to the stream in bulk, instead of going through
+ * the packer element by element. Boundary exchanges with list payloads
+ * of a million doubles are an order of magnitude faster this way.
+ *
+ * @param stream The stream to write to; anything with a
+ *               write(char const *, std::size_t) member.
+ * @param data The data to pack.
+ */
+template <typename Stream>
+void pack_data(Stream & stream, DataConstRef const & data);
+
+/* Helper function that packs data into an exactly-sized byte array.
+ *
+ * A growable output buffer reallocates and re-copies the data already
+ * packed several times over while packing a large message. This
+ * instead makes a cheap counting pass over the data first (the grids
+ * and byte arrays that dominate large messages know their sizes),
+ * allocates a byte array of exactly the counted size, and packs into
+ * that, so packing performs one allocation and writes the bulk data
+ * once. Small data packs into a buffer on the stack during the
+ * counting pass and is copied from there.
+ *
+ * @param data The data to pack.
+ * @return A Data holding a byte array with the packed data.
+ */
+Data pack_data_exact(DataConstRef const & data);
+
 }   // namespace mcp
 
 } }   // namespace libmuscle::impl
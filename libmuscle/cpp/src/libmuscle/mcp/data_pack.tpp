@@ -1,6 +1,104 @@
 // Template implementation, do not include directly!
 
 
+namespace libmuscle { namespace impl {
+
+namespace mcp {
+
+// minimum list length for the bulk double packing fast path; shorter
+// lists are not worth the homogeneity scan
+std::size_t const min_bulk_list_size_ = 32u;
+
+// number of elements staged on the stack at a time when bulk packing
+std::size_t const bulk_chunk_elems_ = 1024u;
+
+/* Writes the element records of an all-double list in bulk.
+ *
+ * Each record is a FLOAT64 marker byte followed by the value in
+ * big-endian order. Records are staged contiguously in chunks on the
+ * stack, with a byte-reversal loop that the compiler vectorises, and
+ * each chunk is written to the stream in one call.
+ */
+template <typename Stream>
+void pack_double_list_(Stream & stream, msgpack::object_array const & list) {
+    char staging[9u * bulk_chunk_elems_];
+    std::size_t todo = list.size;
+    std::size_t done = 0u;
+    while (done < todo) {
+        std::size_t n = std::min(bulk_chunk_elems_, todo - done);
+        char * out = staging;
+        for (std::size_t i = 0u; i < n; ++i) {
+            std::uint64_t bits;
+            std::memcpy(
+                    &bits, &list.ptr[done + i].via.f64, sizeof(bits));
+            out[0] = static_cast<char>(0xcbu);
+            for (int b = 0; b < 8; ++b)
+                out[1 + b] = static_cast<char>(bits >> (56 - 8 * b));
+            out += 9;
+        }
+        stream.write(staging, 9u * n);
+        done += n;
+    }
+}
+
+/* Packs a msgpack object, using the bulk fast path where it applies.
+ *
+ * Arrays and maps are recursed into here rather than left to the
+ * packer, so that nested numeric lists are found as well; everything
+ * else is packed by the packer as usual.
+ */
+template <typename Stream>
+void pack_object_(
+        msgpack::packer<Stream> & packer, Stream & stream,
+        msgpack::object const & obj)
+{
+    if (obj.type == msgpack::type::ARRAY) {
+        auto const & list = obj.via.array;
+        packer.pack_array(list.size);
+
+        if (list.size >= min_bulk_list_size_) {
+            bool all_doubles = true;
+            for (std::uint32_t i = 0u; i < list.size; ++i)
+                if (list.ptr[i].type != msgpack::type::FLOAT64) {
+                    all_doubles = false;
+                    break;
+                }
+            if (all_doubles) {
+                pack_double_list_(stream, list);
+                return;
+            }
+        }
+
+        for (std::uint32_t i = 0u; i < list.size; ++i)
+            pack_object_(packer, stream, list.ptr[i]);
+        return;
+    }
+
+    if (obj.type == msgpack::type::MAP) {
+        auto const & map = obj.via.map;
+        packer.pack_map(map.size);
+        for (std::uint32_t i = 0u; i < map.size; ++i) {
+            pack_object_(packer, stream, map.ptr[i].key);
+            pack_object_(packer, stream, map.ptr[i].val);
+        }
+        return;
+    }
+
+    packer.pack(obj);
+}
+
+template <typename Stream>
+void pack_data(Stream & stream, DataConstRef const & data) {
+    data.materialise_();
+    msgpack::packer<Stream> packer(stream);
+    pack_object_(packer, stream, *data.mp_obj_);
+}
+
+}   // namespace mcp
+
+} }   // namespace libmuscle::impl
+
+
 namespace msgpack {
 
 MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS) {
@@ -14,6 +112,7 @@ struct pack<::libmuscle::impl::DataConstRef> {
             msgpack::packer<Stream>& o,
             ::libmuscle::impl::DataConstRef const& v) const
     {
+        v.materialise_();
         o.pack(*v.mp_obj_);
         return o;
     }
@@ -26,6 +125,7 @@ struct pack<::libmuscle::impl::Data> {
             msgpack::packer<Stream>& o,
             ::libmuscle::impl::Data const& v) const
     {
+        v.materialise_();
         o.pack(*v.mp_obj_);
         return o;
     }
@@ -37,6 +137,7 @@ struct object_with_zone<::libmuscle::impl::DataConstRef> {
             msgpack::object::with_zone & obj,
             ::libmuscle::impl::DataConstRef const & d) const
     {
+        d.materialise_();
         obj.type = d.mp_obj_->type;
         obj.via = d.mp_obj_->via;
     }
@@ -48,6 +149,7 @@ struct object_with_zone<::libmuscle::impl::Data> {
             msgpack::object::with_zone & obj,
             ::libmuscle::impl::Data const & d) const
     {
+        d.materialise_();
         obj.type = d.mp_obj_->type;
         obj.via = d.mp_obj_->via;
     }
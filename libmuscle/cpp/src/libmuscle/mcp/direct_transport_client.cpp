@@ -0,0 +1,107 @@
+#include "libmuscle/mcp/direct_transport_client.hpp"
+
+#include "libmuscle/data.hpp"
+#include "libmuscle/mcp/direct_transport_server.hpp"
+#include "libmuscle/mcp/tcp_util.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <poll.h>
+#include <unistd.h>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+bool DirectTransportClient::can_connect_to(std::string const & location) {
+    if (location.compare(0u, 7u, "direct:") != 0)
+        return false;
+    std::size_t split = location.rfind('/');
+    if (split == std::string::npos)
+        return false;
+    return location.substr(7u, split - 7u) == std::to_string(getpid());
+}
+
+DirectTransportClient::DirectTransportClient(std::string const & location)
+    : handler_(&DirectTransportServer::attach_client(location))
+    , location_(location)
+{}
+
+DirectTransportClient::~DirectTransportClient() {
+    if (handler_)
+        close();
+}
+
+bool DirectTransportClient::returns_shared_buffers() const {
+    return true;
+}
+
+DataConstRef DirectTransportClient::call(
+        char const * req_buf, std::size_t req_len
+) const {
+    std::unique_ptr<DataConstRef> res_buf;
+    int fd = handler_->handle_request(req_buf, req_len, res_buf);
+    if (fd < 0)
+        return *res_buf;
+    return await_response_(fd);
+}
+
+void DirectTransportClient::send_request(
+        char const * req_buf, std::size_t req_len
+) const {
+    std::unique_ptr<DataConstRef> res_buf;
+    int fd = handler_->handle_request(req_buf, req_len, res_buf);
+    pending_.push_back(PendingResponse_{std::move(res_buf), fd});
+}
+
+DataConstRef DirectTransportClient::get_response() const {
+    PendingResponse_ pending = std::move(pending_.front());
+    pending_.pop_front();
+    if (pending.fd < 0)
+        return *pending.response;
+    return await_response_(pending.fd);
+}
+
+DataConstRef DirectTransportClient::get_response(
+        RecvBufferAllocator const & recv_buf
+) const {
+    DataConstRef response = get_response();
+    char * buf = recv_buf(response.size());
+    memcpy(buf, response.as_byte_array(), response.size());
+    return Data::byte_array(buf, response.size());
+}
+
+bool DirectTransportClient::response_started() const {
+    if (pending_.empty())
+        return true;
+    PendingResponse_ const & pending = pending_.front();
+    if (pending.fd < 0)
+        // the response came back with the request
+        return true;
+    pollfd pfd;
+    pfd.fd = pending.fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1u, 0) > 0;
+}
+
+void DirectTransportClient::close() {
+    DirectTransportServer::detach_client(location_);
+    handler_ = nullptr;
+}
+
+/* Waits for a deferred response and picks it up.
+ *
+ * The fd is the eventfd returned by handle_request(), see
+ * RequestHandler; it is pollable, so the receive timeout is honoured.
+ */
+DataConstRef DirectTransportClient::await_response_(int fd) const {
+    if (receive_timeout_.is_set())
+        wait_for_data(fd, receive_timeout_.get());
+    std::uint64_t count;
+    read(fd, &count, sizeof(count));
+    return *handler_->get_response(fd);
+}
+
+} } }
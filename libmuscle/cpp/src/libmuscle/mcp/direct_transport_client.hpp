@@ -0,0 +1,133 @@
+#pragma once
+
+#ifdef LIBMUSCLE_MOCK_MCP_DIRECT_TRANSPORT_CLIENT
+#include LIBMUSCLE_MOCK_MCP_DIRECT_TRANSPORT_CLIENT
+#else
+
+#include "libmuscle/mcp/transport_client.hpp"
+#include "libmuscle/mcp/transport_server.hpp"
+#include "libmuscle/data.hpp"
+
+#include <deque>
+#include <memory>
+#include <string>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A client that connects to a DirectTransport server.
+ *
+ * This only works if the server is in the same process; can_connect_to()
+ * checks that, and the MPPClient will try us before any other transport.
+ * Requests are handed to the server's request handler by function call,
+ * and responses come back as a reference to the handler's own encoded
+ * buffer, so receiving a message over an intra-process conduit is a
+ * pointer swap rather than a socket round trip.
+ */
+class DirectTransportClient : public TransportClient {
+    public:
+        /** Whether this client class can connect to the given location.
+         *
+         * @param location The location to potentially connect to.
+         *
+         * @return true iff this class can connect to this location.
+         */
+        static bool can_connect_to(std::string const & location);
+
+        /** Create an MCP Transport Client for a given location.
+         *
+         * Throws a std::runtime_error if the location does not refer to
+         * a live server in this process, in which case the caller
+         * should fall back to another transport.
+         *
+         * @param location A location string to connect to.
+         */
+        DirectTransportClient(std::string const & location);
+
+        /** Destruct the DirectTransportClient.
+         */
+        virtual ~DirectTransportClient() override;
+
+        /** Whether responses are returned as shared buffers.
+         *
+         * They are; see TransportClient::returns_shared_buffers.
+         *
+         * @return true
+         */
+        virtual bool returns_shared_buffers() const override;
+
+        /** Send a request to the server and receive the response.
+         *
+         * This is a blocking call.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Send a request without waiting for the response.
+         *
+         * Requests may be pipelined; see TransportClient::send_request.
+         * For this transport there is no latency to overlap, but this
+         * keeps the standing-request bookkeeping uniform across
+         * transports.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         */
+        virtual void send_request(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Receive the response to the oldest outstanding request.
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef get_response() const override;
+
+        /** Receive the oldest outstanding response into a given buffer.
+         *
+         * The response is copied from the handler's buffer into the
+         * provided one, see TransportClient::call for the contract.
+         *
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef get_response(
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Returns whether the oldest outstanding response is
+         * available, without blocking.
+         */
+        virtual bool response_started() const override;
+
+        /** Closes this client.
+         *
+         * This detaches from the server, allowing it to close.
+         */
+        virtual void close() override;
+
+    private:
+        // a request whose response hasn't been picked up yet; either
+        // the response itself, or the fd it was deferred behind
+        struct PendingResponse_ {
+            std::unique_ptr<DataConstRef> response;
+            int fd;
+        };
+
+        DataConstRef await_response_(int fd) const;
+
+        RequestHandler * handler_;
+        std::string location_;
+        mutable std::deque<PendingResponse_> pending_;
+};
+
+} } }
+
+#endif
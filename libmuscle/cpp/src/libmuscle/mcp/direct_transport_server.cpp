@@ -0,0 +1,113 @@
+#include "libmuscle/mcp/direct_transport_server.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <unistd.h>
+
+
+namespace {
+
+// a registered server, with the number of clients attached to it
+struct Registration_ {
+    libmuscle::impl::mcp::RequestHandler * handler;
+    int num_clients;
+};
+
+/* The process-local registry of direct transport servers.
+ *
+ * The registry and its mutex are deliberately leaked, so that they
+ * outlive any static objects holding a server or client. Signals on
+ * client_left_() wake a closing server waiting for its clients.
+ */
+std::mutex & registry_mutex_() {
+    static std::mutex & mutex = *new std::mutex();
+    return mutex;
+}
+
+std::condition_variable & client_left_() {
+    static std::condition_variable & cv = *new std::condition_variable();
+    return cv;
+}
+
+std::unordered_map<int, Registration_> & registry_() {
+    static auto & registry = *new std::unordered_map<int, Registration_>();
+    return registry;
+}
+
+/* Extracts the server id from a direct:<pid>/<id> location string.
+ *
+ * Throws a std::runtime_error if the location is not ours.
+ */
+int id_from_location_(std::string const & location) {
+    if (location.compare(0u, 7u, "direct:") != 0)
+        throw std::runtime_error("Not a direct location: " + location);
+    std::size_t split = location.rfind('/');
+    if (split == std::string::npos)
+        throw std::runtime_error("Invalid direct location: " + location);
+    if (std::stoi(location.substr(7u, split - 7u)) != getpid())
+        throw std::runtime_error(
+                "Direct location " + location + " is in another process");
+    return std::stoi(location.substr(split + 1u));
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+DirectTransportServer::DirectTransportServer(RequestHandler & handler)
+    : TransportServer(handler)
+    , closed_(false)
+{
+    static std::atomic<int> next_id(0);
+    id_ = next_id++;
+    location_ = "direct:" + std::to_string(getpid())
+            + "/" + std::to_string(id_);
+
+    std::lock_guard<std::mutex> lock(registry_mutex_());
+    registry_().emplace(id_, Registration_{&handler_, 0});
+}
+
+DirectTransportServer::~DirectTransportServer() {
+    if (!closed_)
+        close();
+}
+
+std::string DirectTransportServer::get_location() const {
+    return location_;
+}
+
+void DirectTransportServer::close() {
+    std::unique_lock<std::mutex> lock(registry_mutex_());
+    auto it = registry_().find(id_);
+    while (it->second.num_clients > 0)
+        client_left_().wait(lock);
+    registry_().erase(it);
+    closed_ = true;
+}
+
+RequestHandler & DirectTransportServer::attach_client(
+        std::string const & location
+) {
+    int id = id_from_location_(location);
+    std::lock_guard<std::mutex> lock(registry_mutex_());
+    auto it = registry_().find(id);
+    if (it == registry_().end())
+        throw std::runtime_error(
+                "Direct server at " + location + " has closed");
+    ++it->second.num_clients;
+    return *it->second.handler;
+}
+
+void DirectTransportServer::detach_client(std::string const & location) {
+    int id = id_from_location_(location);
+    std::lock_guard<std::mutex> lock(registry_mutex_());
+    --registry_().at(id).num_clients;
+    client_left_().notify_all();
+}
+
+} } }
@@ -0,0 +1,80 @@
+#pragma once
+
+#ifdef LIBMUSCLE_MOCK_MCP_DIRECT_TRANSPORT_SERVER
+#include LIBMUSCLE_MOCK_MCP_DIRECT_TRANSPORT_SERVER
+#else
+
+#include <libmuscle/mcp/transport_server.hpp>
+
+#include <string>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A server that accepts connections from within the same process.
+ *
+ * With several instances running in one process, a message between two
+ * of them would otherwise go through a socket and back, copying it
+ * twice for no reason. This server registers its request handler in a
+ * process-local registry instead; a DirectTransportClient in the same
+ * process looks it up there and calls it directly, so that receiving a
+ * message hands over a reference to the sender's encoded buffer rather
+ * than a copy. Clients in other processes fall back to another
+ * transport.
+ */
+class DirectTransportServer : public TransportServer {
+    public:
+        /** Create a DirectTransportServer.
+         *
+         * @param handler A handler to handle requests
+         */
+        DirectTransportServer(RequestHandler & handler);
+
+        /** Closes the server if it wasn't already closed.
+         */
+        ~DirectTransportServer();
+
+        /** Returns the location this server listens on.
+         *
+         * @return A string of the form direct:<pid>/<id>.
+         */
+        virtual std::string get_location() const;
+
+        /** Closes this server.
+         *
+         * Waits for existing clients to disconnect, then removes the
+         * registry entry.
+         */
+        virtual void close();
+
+        /** Attaches a client to the server at the given location.
+         *
+         * Called by DirectTransportClient. The handler stays valid
+         * until the client detaches; the server's close() waits for
+         * that. Throws a std::runtime_error if the location does not
+         * refer to a live server in this process, in which case the
+         * caller should fall back to another transport.
+         *
+         * @param location The location to attach to.
+         *
+         * @return The server's request handler.
+         */
+        static RequestHandler & attach_client(std::string const & location);
+
+        /** Detaches a client from the server at the given location.
+         *
+         * Called by DirectTransportClient when it closes.
+         *
+         * @param location The location the client was attached to.
+         */
+        static void detach_client(std::string const & location);
+
+    private:
+        int id_;
+        bool closed_;
+        std::string location_;
+};
+
+} } }
+
+#endif
@@ -12,7 +12,13 @@ enum class ExtTypeId : int8_t {
     grid_int64 = 3,
     grid_float32 = 4,
     grid_float64 = 5,
-    grid_bool = 6
+    grid_bool = 6,
+    grid_block_int32 = 7,
+    grid_block_int64 = 8,
+    grid_block_float32 = 9,
+    grid_block_float64 = 10,
+    grid_block_bool = 11,
+    record_batch = 12
 };
 
 } } }
@@ -0,0 +1,78 @@
+#include <libmuscle/mcp/frame_reader.hpp>
+
+#include <libmuscle/mcp/tcp_util.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <sys/socket.h>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+FrameReader::FrameReader(std::size_t capacity)
+    : buffer_(capacity)
+    , begin_(0u)
+    , end_(0u)
+{}
+
+bool FrameReader::has_buffered_data() const {
+    return begin_ != end_;
+}
+
+ssize_t FrameReader::fill_nonblocking(int fd) {
+    if (begin_ == end_)
+        begin_ = end_ = 0u;
+
+    ssize_t received = recv(
+            fd, buffer_.data() + end_, buffer_.size() - end_, MSG_DONTWAIT);
+    if (received > 0)
+        end_ += received;
+    return received;
+}
+
+int64_t FrameReader::read_int64(int fd) {
+    buffer_at_least_(fd, 8u);
+    int64_t result;
+    memcpy(&result, buffer_.data() + begin_, 8u);
+    begin_ += 8u;
+    return result;
+}
+
+void FrameReader::read_all(int fd, char * data, std::size_t length) {
+    std::size_t buffered = end_ - begin_;
+    std::size_t from_buffer = (buffered < length) ? buffered : length;
+    memcpy(data, buffer_.data() + begin_, from_buffer);
+    begin_ += from_buffer;
+
+    // receive the rest, if any, directly into the destination, so
+    // large payloads don't pass through the buffer
+    if (from_buffer < length)
+        if (recv_all(fd, data + from_buffer, length - from_buffer) == -1)
+            throw std::runtime_error("Error receiving data on socket");
+}
+
+void FrameReader::buffer_at_least_(int fd, std::size_t length) {
+    // compact, so there's room to receive the requested amount
+    if (begin_ > 0u) {
+        memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0u;
+    }
+
+    while (end_ - begin_ < length) {
+        ssize_t received = recv(
+                fd, buffer_.data() + end_, buffer_.size() - end_, 0);
+        if (received == 0)
+            throw std::runtime_error("Socket closed while receiving");
+        if (received == -1) {
+            if (errno == EINTR)
+                continue;
+            throw std::runtime_error("Error receiving data on socket");
+        }
+        end_ += received;
+    }
+}
+
+} } }
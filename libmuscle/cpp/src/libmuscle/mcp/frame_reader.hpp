@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <sys/types.h>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** Reads length-prefixed frames from a socket with read-ahead.
+ *
+ * Reading a frame as recv_int64() plus recv_all() costs at least two
+ * system calls per frame, which dominates for high rates of small
+ * messages. A FrameReader instead receives as much as the socket has
+ * available into an internal buffer, up to its capacity, and serves
+ * headers and payloads from that, so a burst of small pipelined frames
+ * is picked up with a single recv(). Payload bytes beyond what is
+ * buffered are received straight into the caller's buffer, so large
+ * messages are not copied twice.
+ *
+ * A FrameReader holds the read state of one connection, so use one per
+ * socket, and only from one thread at a time. Data buffered here has
+ * been consumed from the socket, so the socket being quiet does not
+ * mean there is nothing to read; check has_buffered_data() before
+ * waiting on the socket.
+ */
+class FrameReader {
+    public:
+        /** Create a FrameReader.
+         *
+         * @param capacity Size of the read-ahead buffer in bytes.
+         */
+        explicit FrameReader(std::size_t capacity = 65536u);
+
+        /** Returns true iff buffered data is waiting to be read.
+         */
+        bool has_buffered_data() const;
+
+        /** Tries to receive more data without blocking.
+         *
+         * This does a single non-blocking recv() into the buffer, and
+         * returns its result: the number of bytes received, 0 if the
+         * peer closed the connection, or -1 if nothing was waiting or
+         * an error occurred.
+         *
+         * @param fd The socket to receive on.
+         *
+         * @return The number of bytes received, 0 on EOF, or -1.
+         */
+        ssize_t fill_nonblocking(int fd);
+
+        /** Reads a frame's length header.
+         *
+         * This blocks until the header is available, receiving into
+         * the buffer, so it usually picks up (some of) the frame's
+         * payload, and possibly further frames, along with it.
+         *
+         * @param fd The socket to receive on.
+         *
+         * @return The length read, in little-endian format as sent by
+         *         send_frame().
+         *
+         * @throws std::runtime_error if the connection was closed or
+         *         an error occurred.
+         */
+        int64_t read_int64(int fd);
+
+        /** Reads length bytes into the given buffer.
+         *
+         * Buffered data is copied first; any remainder is received
+         * directly into the destination.
+         *
+         * @param fd The socket to receive on.
+         * @param data The buffer to write the data into.
+         * @param length The number of bytes to read.
+         *
+         * @throws std::runtime_error if the connection was closed or
+         *         an error occurred.
+         */
+        void read_all(int fd, char * data, std::size_t length);
+
+    private:
+        // receives until at least length bytes are buffered
+        void buffer_at_least_(int fd, std::size_t length);
+
+        std::vector<char> buffer_;
+        // buffered data lives at [begin_, end_) in buffer_
+        std::size_t begin_;
+        std::size_t end_;
+};
+
+} } }
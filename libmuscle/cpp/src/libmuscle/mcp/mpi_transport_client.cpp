@@ -0,0 +1,101 @@
+#ifdef MUSCLE_ENABLE_MPI
+
+#include "libmuscle/mcp/mpi_transport_client.hpp"
+
+#include "libmuscle/data.hpp"
+#include "libmuscle/mcp/mpi_util.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+bool MpiTransportClient::can_connect_to(std::string const & location) {
+    if (location.compare(0u, 4u, "mpi:") != 0)
+        return false;
+
+    // we can only connect if the model initialised MPI with full
+    // thread support, since the server side serves us from a thread
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (!initialized)
+        return false;
+
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    return provided >= MPI_THREAD_MULTIPLE;
+}
+
+MpiTransportClient::MpiTransportClient(std::string const & location)
+    : comm_(MPI_COMM_NULL)
+{
+    std::string port_name = location.substr(4u);
+
+    // have connection failures reported to us, so that we can fall
+    // back to TCP rather than abort
+    MPI_Comm_set_errhandler(MPI_COMM_SELF, MPI_ERRORS_RETURN);
+
+    if (MPI_Comm_connect(
+                port_name.c_str(), MPI_INFO_NULL, 0, MPI_COMM_SELF,
+                &comm_) != MPI_SUCCESS)
+        throw std::runtime_error(
+                "Could not connect to MPI port " + port_name);
+
+    MPI_Comm_set_errhandler(comm_, MPI_ERRORS_RETURN);
+}
+
+MpiTransportClient::~MpiTransportClient() {
+    if (comm_ != MPI_COMM_NULL)
+        close();
+}
+
+DataConstRef MpiTransportClient::call(
+        char const * req_buf, std::size_t req_len
+) const {
+    send_request(req_buf, req_len);
+    return get_response();
+}
+
+DataConstRef MpiTransportClient::call(
+        char const * req_buf, std::size_t req_len,
+        RecvBufferAllocator const & recv_buf
+) const {
+    send_request(req_buf, req_len);
+    return get_response(recv_buf);
+}
+
+void MpiTransportClient::send_request(
+        char const * req_buf, std::size_t req_len
+) const {
+    mpi_send_frame(
+            comm_, mpi_request_tag, req_buf,
+            static_cast<std::int64_t>(req_len));
+}
+
+DataConstRef MpiTransportClient::get_response() const {
+    std::int64_t length = mpi_recv_length(comm_, mpi_response_tag);
+    auto result = Data::byte_array(length);
+    mpi_recv_data(comm_, mpi_response_tag, result.as_byte_array(), length);
+    return result;
+}
+
+DataConstRef MpiTransportClient::get_response(
+        RecvBufferAllocator const & recv_buf
+) const {
+    std::int64_t length = mpi_recv_length(comm_, mpi_response_tag);
+    char * buf = recv_buf(length);
+    mpi_recv_data(comm_, mpi_response_tag, buf, length);
+    return Data::byte_array(buf, length);
+}
+
+void MpiTransportClient::close() {
+    // a zero-length request tells the server that we're leaving
+    mpi_send_frame(comm_, mpi_request_tag, nullptr, 0);
+    MPI_Comm_disconnect(&comm_);
+    comm_ = MPI_COMM_NULL;
+}
+
+} } }
+
+#endif
@@ -0,0 +1,123 @@
+#pragma once
+
+#ifdef MUSCLE_ENABLE_MPI
+
+#ifdef LIBMUSCLE_MOCK_MCP_MPI_TRANSPORT_CLIENT
+#include LIBMUSCLE_MOCK_MCP_MPI_TRANSPORT_CLIENT
+#else
+
+#include "libmuscle/mcp/transport_client.hpp"
+#include "libmuscle/data.hpp"
+
+#include <mpi.h>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A client that connects to an MpiTransportServer.
+ *
+ * This connects to a peer's MPI port and moves messages over the MPI
+ * fabric with native point-to-point communication, rather than through
+ * TCP. The MPPClient tries us before TCP, so that when both peers are
+ * MPI programs whose runtimes can connect, coupling data goes over the
+ * interconnect.
+ */
+class MpiTransportClient : public TransportClient {
+    public:
+        /** Whether this client class can connect to the given location.
+         *
+         * @param location The location to potentially connect to.
+         *
+         * @return true iff this class can connect to this location.
+         */
+        static bool can_connect_to(std::string const & location);
+
+        /** Create an MCP Transport Client for a given location.
+         *
+         * Throws a std::runtime_error if the MPI runtime cannot connect
+         * to the peer's port, in which case the caller should fall back
+         * to another transport.
+         *
+         * @param location A location string of the form
+         *      mpi:<MPI port name>.
+         */
+        MpiTransportClient(std::string const & location);
+
+        /** Destruct the MpiTransportClient.
+         */
+        virtual ~MpiTransportClient() override;
+
+        /** Send a request to the server and receive the response.
+         *
+         * This is a blocking call.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Send a request and receive the response into a given buffer.
+         *
+         * This is a blocking call. The response is received directly
+         * into the buffer provided by recv_buf, see
+         * TransportClient::call for the contract.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len,
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Send a request without waiting for the response.
+         *
+         * Requests may be pipelined; see TransportClient::send_request.
+         * MPI guarantees ordered delivery per tag, so responses arrive
+         * in request order.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         */
+        virtual void send_request(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Receive the response to the oldest outstanding request.
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef get_response() const override;
+
+        /** Receive the oldest outstanding response into a given buffer.
+         *
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef get_response(
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Closes this client.
+         *
+         * This tells the server we're leaving and disconnects.
+         */
+        virtual void close() override;
+
+    private:
+        MPI_Comm comm_;
+};
+
+} } }
+
+#endif
+
+#endif
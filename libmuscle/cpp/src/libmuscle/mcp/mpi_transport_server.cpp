@@ -0,0 +1,132 @@
+#ifdef MUSCLE_ENABLE_MPI
+
+#include "libmuscle/mcp/mpi_transport_server.hpp"
+
+#include "libmuscle/mcp/mpi_util.hpp"
+
+#include <stdexcept>
+#include <unistd.h>
+#include <vector>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+MpiTransportServer::MpiTransportServer(RequestHandler & handler)
+    : TransportServer(handler)
+    , shutting_down_(false)
+{
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE)
+        throw std::runtime_error(
+                "MPI transport requires MPI_THREAD_MULTIPLE");
+
+    char port_name[MPI_MAX_PORT_NAME];
+    if (MPI_Open_port(MPI_INFO_NULL, port_name) != MPI_SUCCESS)
+        throw std::runtime_error("Could not open an MPI port");
+
+    port_name_ = port_name;
+    location_ = "mpi:" + port_name_;
+    thread_ = std::thread(server_thread_, this);
+}
+
+MpiTransportServer::~MpiTransportServer() {
+    if (thread_.joinable())
+        close();
+}
+
+std::string MpiTransportServer::get_location() const {
+    return location_;
+}
+
+void MpiTransportServer::close() {
+    shutting_down_.store(true);
+
+    // MPI_Comm_accept has no timeout, so we unblock the server thread
+    // by making a dummy connection to ourselves
+    MPI_Comm_set_errhandler(MPI_COMM_SELF, MPI_ERRORS_RETURN);
+    MPI_Comm dummy;
+    if (MPI_Comm_connect(
+                port_name_.c_str(), MPI_INFO_NULL, 0, MPI_COMM_SELF,
+                &dummy) == MPI_SUCCESS)
+        MPI_Comm_disconnect(&dummy);
+
+    thread_.join();
+
+    std::vector<std::thread> client_threads;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client_threads.swap(client_threads_);
+    }
+    for (auto & client_thread : client_threads)
+        client_thread.join();
+
+    MPI_Close_port(const_cast<char *>(port_name_.c_str()));
+}
+
+void MpiTransportServer::server_thread_(MpiTransportServer * self) {
+    while (true) {
+        MPI_Comm client_comm;
+        if (MPI_Comm_accept(
+                    const_cast<char *>(self->port_name_.c_str()),
+                    MPI_INFO_NULL, 0, MPI_COMM_SELF, &client_comm)
+                != MPI_SUCCESS)
+            break;
+
+        if (self->shutting_down_.load()) {
+            MPI_Comm_disconnect(&client_comm);
+            break;
+        }
+
+        MPI_Comm_set_errhandler(client_comm, MPI_ERRORS_RETURN);
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        self->client_threads_.emplace_back(
+                client_thread_, self, client_comm);
+    }
+}
+
+void MpiTransportServer::client_thread_(
+        MpiTransportServer * self, MPI_Comm comm)
+{
+    while (true) {
+        std::int64_t length;
+        try {
+            length = mpi_recv_length(comm, mpi_request_tag);
+        }
+        catch (std::runtime_error const & e) {
+            // client went away without saying goodbye
+            break;
+        }
+
+        if (length == 0) {
+            // client is disconnecting
+            MPI_Comm_disconnect(&comm);
+            return;
+        }
+
+        std::vector<char> req_buf(length);
+        mpi_recv_data(comm, mpi_request_tag, req_buf.data(), length);
+
+        std::unique_ptr<DataConstRef> res_buf;
+        int res_fd = self->handler_.handle_request(
+                req_buf.data(), req_buf.size(), res_buf);
+        if (res_fd >= 0) {
+            // response isn't ready yet; we only serve this one client,
+            // so we just wait for it
+            uint64_t count;
+            read(res_fd, &count, sizeof(count));
+            res_buf = self->handler_.get_response(res_fd);
+        }
+
+        mpi_send_frame(
+                comm, mpi_response_tag, res_buf->as_byte_array(),
+                static_cast<std::int64_t>(res_buf->size()));
+    }
+
+    MPI_Comm free_comm = comm;
+    MPI_Comm_free(&free_comm);
+}
+
+} } }
+
+#endif
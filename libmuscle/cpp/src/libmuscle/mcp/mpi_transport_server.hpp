@@ -0,0 +1,75 @@
+#pragma once
+
+#ifdef MUSCLE_ENABLE_MPI
+
+#ifdef LIBMUSCLE_MOCK_MCP_MPI_TRANSPORT_SERVER
+#include LIBMUSCLE_MOCK_MCP_MPI_TRANSPORT_SERVER
+#else
+
+#include <libmuscle/mcp/transport_server.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <mpi.h>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A server that accepts connections over MPI.
+ *
+ * This opens an MPI port that peers whose MPI runtimes can reach us
+ * connect to, moving coupling data over the MPI fabric with native
+ * point-to-point communication rather than through TCP. Peers whose
+ * runtimes cannot connect fall back to another transport.
+ *
+ * This requires the model to have initialised MPI with full thread
+ * support, since connections are accepted and served from threads;
+ * if it didn't, then the constructor throws and the Communicator
+ * continues with the other transports.
+ */
+class MpiTransportServer : public TransportServer {
+    public:
+        /** Create an MpiTransportServer.
+         *
+         * @param handler A handler to handle requests
+         */
+        MpiTransportServer(RequestHandler & handler);
+
+        /** Closes the server if it wasn't already closed.
+         */
+        ~MpiTransportServer();
+
+        /** Returns the location this server listens on.
+         *
+         * @return A string of the form mpi:<MPI port name>.
+         */
+        virtual std::string get_location() const;
+
+        /** Closes this server.
+         *
+         * Waits for existing clients to disconnect, then closes the
+         * MPI port.
+         */
+        virtual void close();
+
+    private:
+        static void server_thread_(MpiTransportServer * self);
+        static void client_thread_(MpiTransportServer * self, MPI_Comm comm);
+
+        std::string port_name_;
+        std::string location_;
+        std::atomic<bool> shutting_down_;
+        std::thread thread_;
+        std::mutex mutex_;
+        std::vector<std::thread> client_threads_;
+};
+
+} } }
+
+#endif
+
+#endif
@@ -0,0 +1,55 @@
+#ifdef MUSCLE_ENABLE_MPI
+
+#include "libmuscle/mcp/mpi_util.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace {
+
+// maximum payload bytes per MPI message; MPI counts in ints
+std::int64_t const max_chunk_size = 1 << 30;
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+void mpi_send_frame(
+        MPI_Comm comm, int tag, char const * buf, std::int64_t len)
+{
+    if (MPI_Send(&len, 1, MPI_INT64_T, 0, tag, comm) != MPI_SUCCESS)
+        throw std::runtime_error("Error sending a frame over MPI");
+
+    for (std::int64_t sent = 0; sent < len; sent += max_chunk_size) {
+        int chunk = static_cast<int>(std::min(len - sent, max_chunk_size));
+        if (MPI_Send(buf + sent, chunk, MPI_BYTE, 0, tag, comm)
+                != MPI_SUCCESS)
+            throw std::runtime_error("Error sending a frame over MPI");
+    }
+}
+
+std::int64_t mpi_recv_length(MPI_Comm comm, int tag) {
+    std::int64_t length;
+    if (MPI_Recv(&length, 1, MPI_INT64_T, 0, tag, comm, MPI_STATUS_IGNORE)
+            != MPI_SUCCESS)
+        throw std::runtime_error("Error receiving a frame over MPI");
+    return length;
+}
+
+void mpi_recv_data(MPI_Comm comm, int tag, char * buf, std::int64_t len) {
+    for (std::int64_t received = 0; received < len;
+            received += max_chunk_size) {
+        int chunk = static_cast<int>(
+                std::min(len - received, max_chunk_size));
+        if (MPI_Recv(
+                    buf + received, chunk, MPI_BYTE, 0, tag, comm,
+                    MPI_STATUS_IGNORE) != MPI_SUCCESS)
+            throw std::runtime_error("Error receiving a frame over MPI");
+    }
+}
+
+} } }
+
+#endif
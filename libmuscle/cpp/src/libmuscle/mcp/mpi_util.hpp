@@ -0,0 +1,58 @@
+#pragma once
+
+#ifdef MUSCLE_ENABLE_MPI
+
+#include <cstdint>
+
+#include <mpi.h>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+// tags used for MCP frames on an MPI connection
+int const mpi_request_tag = 1;
+int const mpi_response_tag = 2;
+
+/** Send a length-prefixed frame over an MPI connection.
+ *
+ * The length is sent as a separate message first, then the payload
+ * follows in chunks, since MPI counts messages in ints and frames may
+ * be larger than that. A zero-length frame is just the length, and
+ * signals that the sender is disconnecting.
+ *
+ * @param comm The connection to send on.
+ * @param tag The tag to send with.
+ * @param buf The bytes to send.
+ * @param len The number of bytes to send.
+ */
+void mpi_send_frame(
+        MPI_Comm comm, int tag, char const * buf, std::int64_t len);
+
+/** Receive the length prefix of the next frame.
+ *
+ * This blocks until a frame arrives, then returns its length in bytes;
+ * the payload must then be received using mpi_recv_data(). A zero
+ * length means that the peer has disconnected, and no payload follows.
+ *
+ * @param comm The connection to receive on.
+ * @param tag The tag to receive with.
+ *
+ * @return The length of the frame in bytes.
+ */
+std::int64_t mpi_recv_length(MPI_Comm comm, int tag);
+
+/** Receive the payload of a frame into the given buffer.
+ *
+ * The buffer must be at least len bytes, with len the value returned
+ * by mpi_recv_length() for this frame.
+ *
+ * @param comm The connection to receive on.
+ * @param tag The tag to receive with.
+ * @param buf The buffer to receive into.
+ * @param len The length of the frame in bytes.
+ */
+void mpi_recv_data(MPI_Comm comm, int tag, char * buf, std::int64_t len);
+
+} } }
+
+#endif
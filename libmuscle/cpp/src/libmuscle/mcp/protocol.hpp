@@ -15,6 +15,11 @@ enum class RequestType {
     get_settings = 4,
     submit_log_message = 5,
     submit_profile_events = 6,
+    submit_snapshot = 7,
+    get_checkpoint_info = 8,
+    submit_log_messages = 9,
+    register_instances = 10,
+    deregister_instances = 11,
 
     // MUSCLE Peer Protocol
     get_next_message = 21
@@ -0,0 +1,178 @@
+#include "libmuscle/mcp/shm_transport_client.hpp"
+
+#include "libmuscle/data.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+using namespace libmuscle::impl::mcp::shm;
+
+
+namespace {
+
+/* Splits a location string of the form shm:<hostname>/<segment name>
+ * into its hostname and segment name (including the leading slash).
+ */
+void split_location(
+        std::string const & location,
+        std::string & hostname, std::string & segment_name)
+{
+    // start at 4 to skip the initial shm: bit
+    std::size_t slash = location.find('/', 4u);
+    if (slash == std::string::npos)
+        throw std::runtime_error("Invalid shm location " + location);
+    hostname = location.substr(4u, slash - 4u);
+    segment_name = location.substr(slash);
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+bool ShmTransportClient::can_connect_to(std::string const & location) {
+    if (location.compare(0u, 4u, "shm:") != 0)
+        return false;
+
+    // shared memory only reaches peers on the same host
+    char buf[256];
+    if (gethostname(buf, sizeof(buf)) != 0)
+        return false;
+    buf[sizeof(buf) - 1] = '\0';
+
+    std::string hostname, segment_name;
+    try {
+        split_location(location, hostname, segment_name);
+    }
+    catch (std::runtime_error const &) {
+        return false;
+    }
+    return hostname == buf;
+}
+
+ShmTransportClient::ShmTransportClient(std::string const & location)
+    : segment_(nullptr)
+    , slot_(nullptr)
+{
+    std::string hostname, segment_name;
+    split_location(location, hostname, segment_name);
+
+    int fd = shm_open(segment_name.c_str(), O_RDWR, 0);
+    if (fd == -1)
+        throw std::runtime_error(
+                "Could not open shared memory segment " + segment_name);
+
+    void * mem = mmap(
+            nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED,
+            fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED)
+        throw std::runtime_error(
+                "Could not map shared memory segment " + segment_name);
+
+    segment_ = static_cast<Segment *>(mem);
+    if (segment_->magic.load(std::memory_order_acquire) != segment_magic) {
+        munmap(segment_, sizeof(Segment));
+        throw std::runtime_error(
+                "Shared memory segment " + segment_name
+                + " is not initialised");
+    }
+
+    for (std::size_t i = 0u; i < max_connections; ++i) {
+        uint32_t expected = Slot::free;
+        if (segment_->slots[i].state.compare_exchange_strong(
+                expected, Slot::active, std::memory_order_acq_rel))
+        {
+            slot_ = &segment_->slots[i];
+            break;
+        }
+    }
+
+    if (!slot_) {
+        munmap(segment_, sizeof(Segment));
+        throw std::runtime_error(
+                "No free connection slots in shared memory segment "
+                + segment_name);
+    }
+}
+
+ShmTransportClient::~ShmTransportClient() {
+    if (segment_)
+        close();
+}
+
+DataConstRef ShmTransportClient::call(
+        char const * req_buf, std::size_t req_len
+) const {
+    send_request(req_buf, req_len);
+    return get_response();
+}
+
+DataConstRef ShmTransportClient::call(
+        char const * req_buf, std::size_t req_len,
+        RecvBufferAllocator const & recv_buf
+) const {
+    send_request(req_buf, req_len);
+    return get_response(recv_buf);
+}
+
+bool ShmTransportClient::response_started() const {
+    return slot_->response.available() > 0u;
+}
+
+DataConstRef ShmTransportClient::get_response() const {
+    int64_t length;
+    slot_->response.read(reinterpret_cast<char *>(&length), 8);
+    auto result = Data::byte_array(length);
+    slot_->response.read(result.as_byte_array(), length);
+    return result;
+}
+
+DataConstRef ShmTransportClient::get_response(
+        RecvBufferAllocator const & recv_buf
+) const {
+    int64_t length;
+    slot_->response.read(reinterpret_cast<char *>(&length), 8);
+    char * buf = recv_buf(length);
+    slot_->response.read(buf, length);
+    return Data::byte_array(buf, length);
+}
+
+void ShmTransportClient::close() {
+    slot_->state.store(Slot::closed, std::memory_order_release);
+    segment_->doorbell.fetch_add(1u, std::memory_order_release);
+    futex_wake(&segment_->doorbell);
+
+    munmap(segment_, sizeof(Segment));
+    segment_ = nullptr;
+    slot_ = nullptr;
+}
+
+/* Writes a request frame and rings the doorbell.
+ *
+ * The frame format matches the TCP transport: a raw native-endian
+ * int64 length followed by the payload.
+ */
+void ShmTransportClient::send_request(
+        char const * req_buf, std::size_t req_len
+) const {
+    int64_t length64 = req_len;
+    slot_->request.write(reinterpret_cast<char const *>(&length64), 8);
+
+    // Ring the doorbell before writing the payload; a request larger
+    // than the ring can only go through if the server is already
+    // draining it while we write.
+    segment_->doorbell.fetch_add(1u, std::memory_order_release);
+    futex_wake(&segment_->doorbell);
+
+    slot_->request.write(req_buf, req_len);
+}
+
+} } }
+
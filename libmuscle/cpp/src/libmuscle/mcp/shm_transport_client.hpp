@@ -0,0 +1,122 @@
+#pragma once
+
+#ifdef LIBMUSCLE_MOCK_MCP_SHM_TRANSPORT_CLIENT
+#include LIBMUSCLE_MOCK_MCP_SHM_TRANSPORT_CLIENT
+#else
+
+#include "libmuscle/mcp/shm_util.hpp"
+#include "libmuscle/mcp/transport_client.hpp"
+#include "libmuscle/data.hpp"
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A client that connects to a ShmTransport server.
+ *
+ * This only works if the server is on the same host; can_connect_to()
+ * checks that, and the MPPClient will try us before TCP so that
+ * co-located instances communicate through shared memory.
+ */
+class ShmTransportClient : public TransportClient {
+    public:
+        /** Whether this client class can connect to the given location.
+         *
+         * @param location The location to potentially connect to.
+         *
+         * @return true iff this class can connect to this location.
+         */
+        static bool can_connect_to(std::string const & location);
+
+        /** Create an MCP Transport Client for a given location.
+         *
+         * The client will map the server's shared memory segment and
+         * claim a connection slot in it. Throws a std::runtime_error if
+         * the segment cannot be mapped or all slots are taken, in which
+         * case the caller should fall back to another transport.
+         *
+         * @param location A location string to connect to.
+         */
+        ShmTransportClient(std::string const & location);
+
+        /** Destruct the ShmTransportClient.
+         */
+        virtual ~ShmTransportClient() override;
+
+        /** Send a request to the server and receive the response.
+         *
+         * This is a blocking call.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Send a request and receive the response into a given buffer.
+         *
+         * This is a blocking call. The response is copied from the ring
+         * directly into the buffer provided by recv_buf, see
+         * TransportClient::call for the contract.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len,
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Send a request without waiting for the response.
+         *
+         * Requests may be pipelined; see TransportClient::send_request.
+         * Pipelined request frames queue up in the ring.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         */
+        virtual void send_request(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Receive the response to the oldest outstanding request.
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef get_response() const override;
+
+        /** Receive the oldest outstanding response into a given buffer.
+         *
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef get_response(
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Returns whether the oldest outstanding response has started
+         * to arrive, without blocking.
+         */
+        virtual bool response_started() const override;
+
+        /** Closes this client.
+         *
+         * This releases the connection slot and unmaps the segment.
+         */
+        virtual void close() override;
+
+    private:
+        shm::Segment * segment_;
+        shm::Slot * slot_;
+};
+
+} } }
+
+#endif
+
@@ -0,0 +1,243 @@
+#include "libmuscle/mcp/shm_transport_server.hpp"
+
+#include "libmuscle/data.hpp"
+#include "libmuscle/mcp/transport_server.hpp"
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+using libmuscle::impl::DataConstRef;
+using namespace libmuscle::impl::mcp::shm;
+
+
+namespace {
+
+/* Server-side bookkeeping for a slot, kept in private memory. */
+struct SlotState_ {
+    std::vector<char> req_buf;
+    std::size_t received = 0u;
+    bool have_length = false;
+    int response_fd = -1;
+};
+
+/* Writes a frame onto a ring, blocking until it fits.
+ *
+ * The frame format matches the TCP transport: a raw native-endian
+ * int64 length followed by the payload. Both sides are on the same
+ * host here, so endianness is not an issue.
+ */
+void write_frame_(Ring & ring, char const * data, std::size_t length) {
+    int64_t length64 = length;
+    ring.write(reinterpret_cast<char const *>(&length64), 8);
+    ring.write(data, length);
+}
+
+std::string get_hostname_() {
+    char buf[256];
+    if (gethostname(buf, sizeof(buf)) != 0)
+        throw std::runtime_error("Could not get hostname");
+    buf[sizeof(buf) - 1] = '\0';
+    return std::string(buf);
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+ShmTransportServer::ShmTransportServer(RequestHandler & handler)
+    : TransportServer(handler)
+    , segment_(nullptr)
+    , shutting_down_(false)
+{
+    create_segment_();
+    location_ = "shm:" + get_hostname_() + segment_name_;
+    thread_ = std::thread(worker_thread_, this);
+}
+
+ShmTransportServer::~ShmTransportServer() {
+    if (thread_.joinable())
+        close();
+}
+
+std::string ShmTransportServer::get_location() const {
+    return location_;
+}
+
+void ShmTransportServer::close() {
+    shutting_down_.store(true);
+    segment_->doorbell.fetch_add(1u, std::memory_order_release);
+    futex_wake(&segment_->doorbell);
+    thread_.join();
+
+    munmap(segment_, sizeof(Segment));
+    segment_ = nullptr;
+    shm_unlink(segment_name_.c_str());
+}
+
+void ShmTransportServer::create_segment_() {
+    // Unlike a TCP port number, shm names are not handed out by the OS,
+    // so we pick a unique one ourselves from the pid and a sequence
+    // number for the servers within this process.
+    static std::atomic<int> next_seq(0);
+
+    segment_name_ = "/muscle3-" + std::to_string(getpid())
+            + "-" + std::to_string(next_seq++);
+
+    int fd = shm_open(
+            segment_name_.c_str(), O_CREAT | O_EXCL | O_RDWR,
+            S_IRUSR | S_IWUSR);
+    if (fd == -1)
+        throw std::runtime_error(
+                "Could not create shared memory segment " + segment_name_);
+
+    if (ftruncate(fd, sizeof(Segment)) == -1) {
+        ::close(fd);
+        shm_unlink(segment_name_.c_str());
+        throw std::runtime_error(
+                "Could not size shared memory segment " + segment_name_);
+    }
+
+    void * mem = mmap(
+            nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED,
+            fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        shm_unlink(segment_name_.c_str());
+        throw std::runtime_error(
+                "Could not map shared memory segment " + segment_name_);
+    }
+
+    // ftruncate zeroed the segment, which is a valid initial state for
+    // the rings and slots; setting the magic last publishes it.
+    segment_ = static_cast<Segment *>(mem);
+    segment_->magic.store(segment_magic, std::memory_order_release);
+}
+
+void ShmTransportServer::worker_thread_(ShmTransportServer * self) {
+    Segment * segment = self->segment_;
+    SlotState_ slot_states[max_connections];
+
+    while (true) {
+        uint32_t doorbell = segment->doorbell.load(std::memory_order_acquire);
+        bool activity = false;
+        bool have_clients = false;
+
+        for (std::size_t i = 0u; i < max_connections; ++i) {
+            Slot & slot = segment->slots[i];
+            SlotState_ & state = slot_states[i];
+
+            uint32_t slot_state = slot.state.load(std::memory_order_acquire);
+            if (slot_state == Slot::closed) {
+                // client disconnected, recycle the slot
+                state = SlotState_();
+                slot.request.head.store(0u, std::memory_order_relaxed);
+                slot.request.tail.store(0u, std::memory_order_relaxed);
+                slot.response.head.store(0u, std::memory_order_relaxed);
+                slot.response.tail.store(0u, std::memory_order_relaxed);
+                slot.state.store(Slot::free, std::memory_order_release);
+                activity = true;
+                continue;
+            }
+            if (slot_state != Slot::active)
+                continue;
+            have_clients = true;
+
+            // Like the TCP worker, we handle one request at a time per
+            // connection; while a response is pending we leave any
+            // further request bytes in the ring.
+            if (state.response_fd != -1)
+                continue;
+
+            if (!state.have_length) {
+                if (slot.request.available() < 8u)
+                    continue;
+                int64_t length;
+                slot.request.read_some(reinterpret_cast<char *>(&length), 8u);
+                state.req_buf.resize(length);
+                state.received = 0u;
+                state.have_length = true;
+                activity = true;
+            }
+
+            std::size_t num_read = slot.request.read_some(
+                    state.req_buf.data() + state.received,
+                    state.req_buf.size() - state.received);
+            state.received += num_read;
+            // keep going while the client is streaming a large request
+            // through the ring, don't go to sleep below
+            activity = activity || (num_read > 0u);
+
+            if (state.received < state.req_buf.size())
+                continue;
+
+            state.have_length = false;
+
+            std::unique_ptr<DataConstRef> res_buf;
+            int res_fd = self->handler_.handle_request(
+                    state.req_buf.data(), state.req_buf.size(), res_buf);
+            if (res_fd < 0)
+                write_frame_(
+                        slot.response, res_buf->as_byte_array(),
+                        res_buf->size());
+            else
+                state.response_fd = res_fd;
+        }
+
+        // check for responses that have become available
+        std::vector<pollfd> polled_fds;
+        std::vector<std::size_t> polled_slots;
+        for (std::size_t i = 0u; i < max_connections; ++i)
+            if (slot_states[i].response_fd != -1) {
+                pollfd pfd;
+                pfd.fd = slot_states[i].response_fd;
+                pfd.events = POLLIN;
+                pfd.revents = 0;
+                polled_fds.push_back(pfd);
+                polled_slots.push_back(i);
+            }
+
+        if (!polled_fds.empty()) {
+            poll(polled_fds.data(), polled_fds.size(), 0);
+            for (std::size_t j = 0u; j < polled_fds.size(); ++j)
+                if (polled_fds[j].revents & POLLIN) {
+                    uint64_t count;
+                    read(polled_fds[j].fd, &count, sizeof(count));
+
+                    std::size_t i = polled_slots[j];
+                    auto res_buf = self->handler_.get_response(
+                            slot_states[i].response_fd);
+                    slot_states[i].response_fd = -1;
+                    write_frame_(
+                            segment->slots[i].response,
+                            res_buf->as_byte_array(), res_buf->size());
+                    activity = true;
+                }
+        }
+
+        if (self->shutting_down_.load() && !have_clients)
+            break;
+
+        if (!activity) {
+            if (!polled_fds.empty())
+                // A short poll, so that new requests on the rings don't
+                // have to wait for a slow deferred response.
+                poll(polled_fds.data(), polled_fds.size(), 10);
+            else
+                futex_wait(&segment->doorbell, doorbell, 100);
+        }
+    }
+}
+
+} } }
+
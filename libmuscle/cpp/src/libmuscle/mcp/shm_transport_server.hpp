@@ -0,0 +1,65 @@
+#pragma once
+
+#ifdef LIBMUSCLE_MOCK_MCP_SHM_TRANSPORT_SERVER
+#include LIBMUSCLE_MOCK_MCP_SHM_TRANSPORT_SERVER
+#else
+
+#include <libmuscle/mcp/shm_util.hpp>
+#include <libmuscle/mcp/transport_server.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A server that accepts connections over shared memory.
+ *
+ * This creates a POSIX shared memory segment that clients on the same
+ * host can map and exchange request/response frames through, avoiding
+ * the kernel networking stack for co-located instances. Clients that
+ * are on a different host, or that find all slots taken, fall back to
+ * another transport.
+ */
+class ShmTransportServer : public TransportServer {
+    public:
+        /** Create a ShmTransportServer.
+         *
+         * @param handler A handler to handle requests
+         */
+        ShmTransportServer(RequestHandler & handler);
+
+        /** Closes the server if it wasn't already closed.
+         */
+        ~ShmTransportServer();
+
+        /** Returns the location this server listens on.
+         *
+         * @return A string of the form shm:<hostname>/<segment name>.
+         */
+        virtual std::string get_location() const;
+
+        /** Closes this server.
+         *
+         * Waits for existing clients to disconnect, then removes the
+         * shared memory segment.
+         */
+        virtual void close();
+
+    private:
+        void create_segment_();
+
+        static void worker_thread_(ShmTransportServer * self);
+
+        std::string segment_name_;
+        shm::Segment * segment_;
+        std::atomic<bool> shutting_down_;
+        std::thread thread_;
+        std::string location_;
+};
+
+} } }
+
+#endif
+
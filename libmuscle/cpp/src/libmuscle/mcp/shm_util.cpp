@@ -0,0 +1,100 @@
+#include "libmuscle/mcp/shm_util.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+namespace shm {
+
+void futex_wait(
+        std::atomic<uint32_t> * addr, uint32_t expected, int timeout_ms)
+{
+    struct timespec timeout;
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_nsec = (timeout_ms % 1000) * 1000000L;
+
+    // FUTEX_WAIT rather than FUTEX_WAIT_PRIVATE, because the other side
+    // is in a different process.
+    syscall(
+            SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAIT,
+            expected, &timeout, nullptr, 0);
+}
+
+void futex_wake(std::atomic<uint32_t> * addr) {
+    syscall(
+            SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAKE,
+            INT32_MAX, nullptr, nullptr, 0);
+}
+
+
+std::size_t Ring::available() const {
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    return static_cast<uint32_t>(h - t);
+}
+
+void Ring::write(char const * buf, std::size_t length) {
+    std::size_t written = 0u;
+    while (written < length) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        std::size_t space = ring_size - static_cast<uint32_t>(h - t);
+        if (space == 0u) {
+            futex_wait(&tail, t, 100);
+            continue;
+        }
+
+        std::size_t to_write = std::min(space, length - written);
+        std::size_t pos = h % ring_size;
+        std::size_t contiguous = std::min(to_write, ring_size - pos);
+        memcpy(data + pos, buf + written, contiguous);
+        memcpy(data, buf + written + contiguous, to_write - contiguous);
+
+        head.store(h + to_write, std::memory_order_release);
+        futex_wake(&head);
+        written += to_write;
+    }
+}
+
+void Ring::read(char * buf, std::size_t length) {
+    std::size_t num_read = 0u;
+    while (num_read < length) {
+        uint32_t h = head.load(std::memory_order_acquire);
+        if (static_cast<uint32_t>(
+                h - tail.load(std::memory_order_relaxed)) == 0u)
+        {
+            futex_wait(&head, h, 100);
+            continue;
+        }
+        num_read += read_some(buf + num_read, length - num_read);
+    }
+}
+
+std::size_t Ring::read_some(char * buf, std::size_t length) {
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    std::size_t to_read = std::min(
+            static_cast<std::size_t>(static_cast<uint32_t>(h - t)), length);
+    if (to_read == 0u)
+        return 0u;
+
+    std::size_t pos = t % ring_size;
+    std::size_t contiguous = std::min(to_read, ring_size - pos);
+    memcpy(buf, data + pos, contiguous);
+    memcpy(buf + contiguous, data, to_read - contiguous);
+
+    tail.store(t + to_read, std::memory_order_release);
+    futex_wake(&tail);
+    return to_read;
+}
+
+}   // namespace shm
+
+} } }
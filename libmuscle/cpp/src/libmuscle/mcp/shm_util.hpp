@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+namespace shm {
+
+/* Size of the data area of a ring, per direction. Larger messages are
+ * streamed through in chunks.
+ */
+constexpr std::size_t ring_size = 1u << 18;
+
+/* Maximum number of simultaneous clients per server. If all slots are
+ * taken, additional clients fail to connect and fall back to TCP.
+ */
+constexpr std::size_t max_connections = 16u;
+
+/* Marks an initialised segment, "M3SH" in little-endian. */
+constexpr uint32_t segment_magic = 0x4853334du;
+
+/* Wait until the value at addr is no longer expected.
+ *
+ * This may also return spuriously, or after the given timeout; callers
+ * must recheck their condition in a loop.
+ *
+ * @param addr Address to wait on, must be in shared memory.
+ * @param expected The value we saw there, which made us want to wait.
+ * @param timeout_ms Maximum time to wait, in milliseconds.
+ */
+void futex_wait(
+        std::atomic<uint32_t> * addr, uint32_t expected, int timeout_ms);
+
+/* Wake up any processes waiting on the value at addr.
+ *
+ * @param addr Address waited on, must be in shared memory.
+ */
+void futex_wake(std::atomic<uint32_t> * addr);
+
+
+/* A single-producer single-consumer byte ring in shared memory.
+ *
+ * The head and tail are free-running counters of bytes written and read
+ * respectively; the difference between them is the number of unread
+ * bytes in the ring. This works as long as ring_size is well below 2^31,
+ * and saves a slot compared to the classic full/empty disambiguation.
+ *
+ * Waiting is done via futexes on the head (reader waiting for data) and
+ * tail (writer waiting for space), so an idle connection uses no CPU and
+ * no kernel socket machinery is involved.
+ */
+struct Ring {
+    alignas(64) std::atomic<uint32_t> head;     // bytes written
+    alignas(64) std::atomic<uint32_t> tail;     // bytes read
+    alignas(64) char data[ring_size];
+
+    /* Number of unread bytes available to the reader. */
+    std::size_t available() const;
+
+    /* Write length bytes, blocking while the ring is full. */
+    void write(char const * buf, std::size_t length);
+
+    /* Read length bytes, blocking while the ring is empty. */
+    void read(char * buf, std::size_t length);
+
+    /* Read up to length bytes without blocking.
+     *
+     * @return The number of bytes read, may be zero.
+     */
+    std::size_t read_some(char * buf, std::size_t length);
+};
+
+
+/* A connection slot in a shared memory segment.
+ *
+ * Clients claim a free slot by changing its state from free to active,
+ * then exchange request/response frames over the rings. Frames are an
+ * 8-byte little-endian length followed by that many payload bytes, as
+ * on the TCP transport.
+ */
+struct Slot {
+    enum State : uint32_t {
+        free = 0u,
+        active = 1u,
+        closed = 2u
+    };
+
+    std::atomic<uint32_t> state;
+    Ring request;       // written by the client, read by the server
+    Ring response;      // written by the server, read by the client
+};
+
+
+/* The layout of a shared memory segment, as created by the server.
+ *
+ * The doorbell is bumped and woken by clients whenever there is
+ * something new for the server to look at, so that the server thread
+ * can sleep when all connections are idle.
+ */
+struct Segment {
+    std::atomic<uint32_t> magic;
+    std::atomic<uint32_t> doorbell;
+    Slot slots[max_connections];
+};
+
+}   // namespace shm
+
+} } }
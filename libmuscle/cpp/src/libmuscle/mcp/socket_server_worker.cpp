@@ -0,0 +1,706 @@
+#include "libmuscle/mcp/socket_server_worker.hpp"
+
+#include "libmuscle/data.hpp"
+#include "libmuscle/instrumentation.hpp"
+#include "libmuscle/mcp/tcp_util.hpp"
+#include "libmuscle/mcp/transfer_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+namespace {
+
+// chunk size for sending large responses, and the size above which a
+// response is sent in chunks rather than in one go
+std::size_t const bulk_send_chunk_ = 1024u * 1024u;
+
+/* Returns the size above which a response is striped, in bytes.
+ *
+ * A single TCP connection caps out at single-stream throughput, which
+ * on fast networks is well below line rate. Responses at least this
+ * large are striped over a client's extra stripe connections, if it
+ * attached any; see TcpTransportClient. MUSCLE_TCP_STRIPE_THRESHOLD
+ * overrides the default of 16 MiB.
+ */
+std::size_t stripe_threshold_() {
+    static std::size_t const threshold = []() {
+            char const * env = getenv("MUSCLE_TCP_STRIPE_THRESHOLD");
+            if (env != nullptr) {
+                std::size_t size = strtoul(env, nullptr, 10);
+                if (size > 0u)
+                    return size;
+            }
+            return std::size_t(16u) * 1024u * 1024u;
+            }();
+    return threshold;
+}
+
+/* Registry of striping channels, shared by all workers.
+ *
+ * A client that wants striped transfers announces a channel id on its
+ * main connection and attaches extra connections to it, each with a
+ * stripe index; see the control frame description in tcp_util.hpp.
+ * The pool may place those connections on different workers, so the
+ * registry is process-wide. Leaked deliberately, like the pool, so
+ * that it outlives any server held in a static by user code.
+ */
+struct StripeChannel_ {
+    int main_fd = -1;
+    std::map<int, int> stripes;     // stripe index -> fd
+};
+
+std::mutex & stripe_mutex_() {
+    static std::mutex & mutex = *new std::mutex();
+    return mutex;
+}
+
+std::unordered_map<int64_t, StripeChannel_> & stripe_channels_() {
+    static auto & channels = *new std::unordered_map<int64_t, StripeChannel_>();
+    return channels;
+}
+
+// any registered fd -> its channel, for response lookup and cleanup
+std::unordered_map<int, int64_t> & stripe_members_() {
+    static auto & members = *new std::unordered_map<int, int64_t>();
+    return members;
+}
+
+/* Registers a connection with a striping channel.
+ */
+void register_stripe_(int fd, int64_t channel_id, int64_t stripe_index) {
+    std::lock_guard<std::mutex> lock(stripe_mutex_());
+    StripeChannel_ & channel = stripe_channels_()[channel_id];
+    if (stripe_index < 0)
+        channel.main_fd = fd;
+    else
+        channel.stripes[static_cast<int>(stripe_index)] = fd;
+    stripe_members_()[fd] = channel_id;
+}
+
+/* Removes a closed connection from its channel, if it has one.
+ */
+void unregister_stripe_(int fd) {
+    std::lock_guard<std::mutex> lock(stripe_mutex_());
+    auto it = stripe_members_().find(fd);
+    if (it == stripe_members_().end())
+        return;
+    auto channel_it = stripe_channels_().find(it->second);
+    if (channel_it != stripe_channels_().end()) {
+        StripeChannel_ & channel = channel_it->second;
+        if (channel.main_fd == fd)
+            channel.main_fd = -1;
+        for (auto stripe_it = channel.stripes.begin();
+                stripe_it != channel.stripes.end(); ++stripe_it)
+            if (stripe_it->second == fd) {
+                channel.stripes.erase(stripe_it);
+                break;
+            }
+        if (channel.main_fd == -1 && channel.stripes.empty())
+            stripe_channels_().erase(channel_it);
+    }
+    stripe_members_().erase(it);
+}
+
+/* Returns the stripe fds usable for a response on the given main fd.
+ *
+ * Only a contiguous run of stripe indices from zero is used, so that
+ * the client, which is told only how many stripes the response uses,
+ * reads from the same sockets the server wrote to.
+ */
+std::vector<int> stripe_fds_for_(int fd) {
+    std::lock_guard<std::mutex> lock(stripe_mutex_());
+    std::vector<int> fds;
+    auto it = stripe_members_().find(fd);
+    if (it == stripe_members_().end())
+        return fds;
+    auto channel_it = stripe_channels_().find(it->second);
+    if (channel_it == stripe_channels_().end() ||
+            channel_it->second.main_fd != fd)
+        return fds;
+    for (auto const & index_fd : channel_it->second.stripes) {
+        if (index_fd.first != static_cast<int>(fds.size()))
+            break;
+        fds.push_back(index_fd.second);
+    }
+    return fds;
+}
+
+
+/* Returns the number of worker threads to serve connections with.
+ *
+ * A single worker is plenty for small couplings, but caps the aggregate
+ * serving bandwidth of a macro instance feeding many micros on a big
+ * node, so we start several by default. MUSCLE_TCP_SERVER_WORKERS
+ * overrides; it is the budget for the whole process, shared by all of
+ * its transport servers.
+ */
+std::size_t num_workers_() {
+    char const * env = getenv("MUSCLE_TCP_SERVER_WORKERS");
+    if (env != nullptr) {
+        std::size_t num = strtoul(env, nullptr, 10);
+        if (num > 0u)
+            return num;
+    }
+
+    std::size_t num_cores = std::thread::hardware_concurrency();
+    if (num_cores == 0u)
+        num_cores = 1u;
+    return std::min<std::size_t>(4u, num_cores);
+}
+
+/* Returns the CPUs to pin worker threads to, empty for no pinning.
+ *
+ * On multi-socket nodes, a worker thread that wanders between NUMA
+ * nodes leaves socket buffers scattered across both, and models then
+ * read grid payloads cross-socket at half bandwidth. Setting
+ * MUSCLE_TCP_SERVER_CPUS to a comma-separated list of CPU ids (e.g.
+ * from the node the model threads run on) pins workers to those CPUs,
+ * round robin. Unset means no pinning.
+ */
+std::vector<int> worker_cpus_() {
+    std::vector<int> cpus;
+    char const * env = getenv("MUSCLE_TCP_SERVER_CPUS");
+    if (env != nullptr) {
+        char const * p = env;
+        while (*p != '\0') {
+            char * end;
+            long cpu = strtol(p, &end, 10);
+            if (end == p)
+                break;
+            if (cpu >= 0l)
+                cpus.push_back(static_cast<int>(cpu));
+            p = (*end == ',') ? end + 1 : end;
+        }
+    }
+    return cpus;
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+SocketServerWorker::SocketServerWorker(int cpu)
+    : shutting_down_(false)
+    , epoll_fd_(epoll_create1(0))
+    , utilization_(0.0)
+    , bytes_served_(0u)
+    , connections_()
+    , pending_responses_()
+    , bulk_throttled_(false)
+    , mutex_()
+    , thread_(worker_thread_, this)
+{
+    if (cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        // best effort, an invalid CPU id just leaves the thread unpinned
+        pthread_setaffinity_np(thread_.native_handle(), sizeof(cpus), &cpus);
+    }
+}
+
+int SocketServerWorker::count_active_connections() const {
+    instrumentation::TimedLockGuard lock(mutex_);
+    return connections_.size();
+}
+
+double SocketServerWorker::utilization() const {
+    return utilization_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SocketServerWorker::bytes_served() const {
+    return bytes_served_.load(std::memory_order_relaxed);
+}
+
+void SocketServerWorker::add_connection(int fd, RequestHandler & handler) {
+    {
+        instrumentation::TimedLockGuard lock(mutex_);
+        connections_.emplace(fd, -1);
+        handlers_.emplace(fd, &handler);
+    }
+    // epoll_ctl is safe to call while the worker thread is waiting
+    epoll_event event;
+    event.events = EPOLLIN | EPOLLET;
+    event.data.fd = fd;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event);
+}
+
+void SocketServerWorker::shutdown() {
+    {
+        instrumentation::TimedLockGuard lock(mutex_);
+        shutting_down_ = true;
+    }
+    thread_.join();
+    ::close(epoll_fd_);
+}
+
+/* Handles a readiness event on the given connection.
+ *
+ * Clients may pipeline requests, so an edge-triggered readiness event
+ * may cover several request frames. While a deferred response is
+ * outstanding we must not answer any further requests though, since
+ * responses are matched to requests by their order on the connection;
+ * any pipelined frames then stay in the socket buffer until the
+ * deferred response has been sent, and are drained from
+ * handle_response_fd_.
+ *
+ * Called by the worker thread.
+ */
+void SocketServerWorker::handle_request_fd_(int fd) {
+    // likewise while a bulk response is still going out on this
+    // connection, see send_response_()
+    if (bulk_sends_.count(fd))
+        return;
+    bool response_pending;
+    {
+        instrumentation::TimedLockGuard lock(mutex_);
+        response_pending = connections_[fd] != -1;
+    }
+    if (!response_pending)
+        process_requests_(fd);
+}
+
+/* Receives and handles request frames until the connection runs dry.
+ *
+ * This answers requests in the order in which they arrived, and stops
+ * when no more data is waiting, when a request's response is deferred,
+ * or when the client disconnects. Frames are read with (briefly)
+ * blocking reads through a per-connection FrameReader, so a burst of
+ * pipelined requests is picked up with a single recv(); a non-blocking
+ * fill first ensures that a frame has at least started to arrive.
+ *
+ * Called by the worker thread.
+ */
+void SocketServerWorker::process_requests_(int fd) {
+    FrameReader & reader = readers_[fd];
+
+    RequestHandler * handler;
+    {
+        instrumentation::TimedLockGuard lock(mutex_);
+        handler = handlers_.at(fd);
+    }
+
+    // Cork the socket while we answer the burst, so that the responses
+    // to pipelined small requests share packets rather than each going
+    // out as their own; uncorking below flushes the remainder. This is
+    // a no-op on UNIX domain sockets.
+    set_cork(fd, true);
+
+    while (true) {
+        if (!reader.has_buffered_data()) {
+            ssize_t received = reader.fill_nonblocking(fd);
+            if (received == 0) {
+                // EOF; port was closed, remove the connection
+                remove_connection_(fd);
+                return;
+            }
+            if (received == -1) {
+                // no more requests waiting
+                set_cork(fd, false);
+                return;
+            }
+        }
+
+        try {
+            int64_t length = reader.read_int64(fd);
+            if (length == control_frame_magic) {
+                // the client is attaching this connection to a striping
+                // channel; it carries no requests beyond this
+                int64_t channel_id = reader.read_int64(fd);
+                int64_t stripe_index = reader.read_int64(fd);
+                register_stripe_(fd, channel_id, stripe_index);
+                continue;
+            }
+            if (length == integrity_frame_magic) {
+                // the client wants checksummed frames on this
+                // connection, in both directions
+                integrity_fds_.insert(fd);
+                continue;
+            }
+            req_buf_.resize(length);
+            reader.read_all(fd, req_buf_.data(), length);
+            if (integrity_fds_.count(fd)) {
+                std::uint32_t crc = static_cast<std::uint32_t>(
+                        reader.read_int64(fd));
+                if (crc != crc32c(0u, req_buf_.data(), length))
+                    // drop the connection, so that the client fails
+                    // loudly rather than us acting on corrupt data
+                    throw std::runtime_error(
+                            "Request checksum mismatch");
+            }
+            bytes_served_.fetch_add(length, std::memory_order_relaxed);
+
+            std::unique_ptr<DataConstRef> res_buf;
+            int res_fd = handler->handle_request(
+                    req_buf_.data(), length, res_buf);
+            if (res_fd < 0) {
+                // got a response immediately, send it; if it's large
+                // then it goes out in chunks, and further requests wait
+                // until it's done
+                if (!send_response_(fd, std::move(res_buf)))
+                    return;
+            }
+            else {
+                // response not yet available, watch for it
+                set_cork(fd, false);
+                pending_responses_.emplace(res_fd, fd);
+                {
+                    instrumentation::TimedLockGuard lock(mutex_);
+                    connections_[fd] = res_fd;
+                }
+                epoll_event event;
+                event.events = EPOLLIN | EPOLLET;
+                event.data.fd = res_fd;
+                epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, res_fd, &event);
+                return;
+            }
+        }
+        catch (std::runtime_error const & e) {
+            remove_connection_(fd);
+            return;
+        }
+    }
+}
+
+/* Sends a deferred response that has become available.
+ *
+ * Called by the worker thread.
+ */
+void SocketServerWorker::handle_response_fd_(int fd) {
+    uint64_t count;
+    read(fd, &count, sizeof(count));
+
+    int req_fd = pending_responses_[fd];
+    RequestHandler * handler;
+    {
+        instrumentation::TimedLockGuard lock(mutex_);
+        handler = handlers_.at(req_fd);
+    }
+
+    std::unique_ptr<DataConstRef> res_buf;
+    res_buf = handler->get_response(fd);
+
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    pending_responses_.erase(fd);
+    {
+        instrumentation::TimedLockGuard lock(mutex_);
+        connections_[req_fd] = -1;
+    }
+    // if the response is large, then it goes out in chunks, and the
+    // pipelined requests are drained once it has been fully sent
+    if (send_response_(req_fd, std::move(res_buf)))
+        process_requests_(req_fd);
+}
+
+/* Send contents of response buffer to the given fd.
+ *
+ * Small responses are sent in one go. A large response would keep the
+ * worker thread inside send() until the receiver has taken most of it,
+ * during which every other connection on this worker waits; a small
+ * control message stuck behind a multi-gigabyte state transfer shows
+ * up as seconds of latency. So large responses are only started here:
+ * the frame header goes out, and the payload follows in chunks from
+ * advance_bulk_sends_(), with other connections served in between.
+ * While a bulk send is in progress, no further requests are answered
+ * on its connection, since that would corrupt the byte stream; they
+ * stay in the socket buffer, like behind a deferred response.
+ *
+ * Takes ownership of res_buf and discards it after sending.
+ *
+ * @param fd The fd to send the data on
+ * @return true if the response was fully sent, false if a bulk send
+ *      was started
+ */
+bool SocketServerWorker::send_response_(
+        int fd, std::unique_ptr<DataConstRef> res_buf)
+{
+    bytes_served_.fetch_add(res_buf->size(), std::memory_order_relaxed);
+
+    if (res_buf->size() > bulk_send_chunk_) {
+        // the chunks are packet-sized multiples, so corking would only
+        // delay the tail of the frame
+        set_cork(fd, false);
+
+        // a response this large is striped over the client's stripe
+        // connections, if it attached any; each connection has its own
+        // congestion window, so together they exceed what one TCP
+        // stream can carry
+        std::vector<int> stripe_fds;
+        if (res_buf->size() >= stripe_threshold_())
+            stripe_fds = stripe_fds_for_(fd);
+
+        if (!stripe_fds.empty()) {
+            send_int64(fd, striped_frame_magic);
+            send_int64(fd, res_buf->size());
+            send_int64(fd, bulk_send_chunk_);
+            send_int64(fd, stripe_fds.size());
+        }
+        else
+            send_int64(fd, res_buf->size());
+        bulk_sends_[fd] = BulkSend_{
+                std::move(res_buf), 0u, std::move(stripe_fds), 0u,
+                TransferScheduler::get().bulk_start_time(),
+                integrity_fds_.count(fd) != 0u, 0u};
+        return false;
+    }
+
+    if (integrity_fds_.count(fd))
+        send_frame_crc(fd, res_buf->as_byte_array(), res_buf->size());
+    else
+        send_frame(fd, res_buf->as_byte_array(), res_buf->size());
+    return true;
+}
+
+/* Sends the next chunk of each bulk response in progress.
+ *
+ * Called by the worker thread after each round of events, so that large
+ * transfers make progress without monopolising the thread; the loop
+ * polls rather than waits while any are in progress. Connections whose
+ * response completes get their pipelined requests drained, as after a
+ * deferred response.
+ */
+void SocketServerWorker::advance_bulk_sends_() {
+    bulk_throttled_ = false;
+    auto now = std::chrono::steady_clock::now();
+    std::vector<int> completed;
+    for (auto & bulk_send : bulk_sends_) {
+        int fd = bulk_send.first;
+        BulkSend_ & bulk = bulk_send.second;
+        if (bulk.not_before > now) {
+            bulk_throttled_ = true;
+            continue;
+        }
+        if (!bulk.stripe_fds.empty()) {
+            if (!advance_striped_send_(fd, bulk))
+                completed.push_back(fd);
+            continue;
+        }
+        std::size_t todo = std::min(
+                bulk_send_chunk_, bulk.buffer->size() - bulk.sent);
+        if (!TransferScheduler::get().try_acquire(todo)) {
+            bulk_throttled_ = true;
+            continue;
+        }
+        ssize_t err = send_all(
+                fd, bulk.buffer->as_byte_array() + bulk.sent, todo);
+        if (err == -1) {
+            // client went away, clean up below
+            completed.push_back(fd);
+            continue;
+        }
+        if (bulk.integrity)
+            bulk.crc = crc32c(
+                    bulk.crc, bulk.buffer->as_byte_array() + bulk.sent,
+                    todo);
+        bulk.sent += todo;
+        if (bulk.sent == bulk.buffer->size())
+            completed.push_back(fd);
+    }
+
+    // erasing and draining below may add new entries to bulk_sends_,
+    // so this is done outside of the loop above
+    for (int fd : completed) {
+        BulkSend_ const & bulk = bulk_sends_[fd];
+        if (bulk.integrity && bulk.sent == bulk.buffer->size()) {
+            // the trailing checksum of the complete payload; if the
+            // client went away in the meantime this fails, and the
+            // disconnect is picked up when its fd signals
+            int64_t crc = bulk.crc;
+            send_all(fd, reinterpret_cast<char *>(&crc), 8);
+        }
+        bulk_sends_.erase(fd);
+        TransferScheduler::get().bulk_done();
+        process_requests_(fd);
+    }
+}
+
+/* Sends the next round of chunks of a striped response.
+ *
+ * One chunk goes out on each connection: chunk i goes to connection
+ * i modulo the number of connections, with the main connection first,
+ * and is prefixed with its sequence number so the client can verify
+ * reassembly. The client reads the chunks in the same order, see
+ * TcpTransportClient.
+ *
+ * @return true if chunks remain, false when the response is fully
+ *      sent or the client went away.
+ */
+bool SocketServerWorker::advance_striped_send_(int fd, BulkSend_ & bulk) {
+    std::size_t num_fds = bulk.stripe_fds.size() + 1u;
+    for (std::size_t i = 0u; i < num_fds; ++i) {
+        if (bulk.sent == bulk.buffer->size())
+            return false;
+        std::size_t chunk = bulk.next_chunk;
+        int chunk_fd = (chunk % num_fds == 0u)
+            ? fd : bulk.stripe_fds[chunk % num_fds - 1u];
+        std::size_t todo = std::min(
+                bulk_send_chunk_, bulk.buffer->size() - bulk.sent);
+        if (!TransferScheduler::get().try_acquire(todo)) {
+            bulk_throttled_ = true;
+            return true;
+        }
+        int64_t seq = chunk;
+        if (send_all(chunk_fd, reinterpret_cast<char *>(&seq), 8) == -1)
+            return false;
+        if (send_all(
+                chunk_fd, bulk.buffer->as_byte_array() + bulk.sent,
+                todo) == -1)
+            return false;
+        if (bulk.integrity)
+            bulk.crc = crc32c(
+                    bulk.crc, bulk.buffer->as_byte_array() + bulk.sent,
+                    todo);
+        bulk.sent += todo;
+        ++bulk.next_chunk;
+    }
+    return bulk.sent < bulk.buffer->size();
+}
+
+/* Deregisters and closes a connection whose client disconnected.
+ *
+ * Called by the worker thread.
+ */
+void SocketServerWorker::remove_connection_(int fd) {
+    unregister_stripe_(fd);
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    readers_.erase(fd);
+    bulk_sends_.erase(fd);
+    integrity_fds_.erase(fd);
+    instrumentation::TimedLockGuard lock(mutex_);
+    connections_.erase(fd);
+    handlers_.erase(fd);
+}
+
+/* The main function for the worker thread.
+ *
+ * This is static since I'm not sure if std::thread works with a
+ * thiscall. Probably with some adaptor, but this works too.
+ *
+ * This runs in a loop until shutdown() is called by the server
+ * thread.
+ *
+ * @param self The SocketServerWorker this thread belongs to.
+ */
+void SocketServerWorker::worker_thread_(SocketServerWorker * self) {
+    const int max_events = 64;
+    epoll_event events[max_events];
+
+    while (true) {
+        // While bulk sends are in progress, poll instead of waiting, so
+        // that they progress even when no other connection is active.
+        // When the TransferScheduler held them all back, back off a
+        // little rather than spinning on the bucket.
+        int timeout = self->bulk_sends_.empty()
+            ? 100 : (self->bulk_throttled_ ? 1 : 0);
+
+        auto wait_start = std::chrono::steady_clock::now();
+        int num_ready = epoll_wait(
+                self->epoll_fd_, events, max_events, timeout);
+        auto busy_start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < num_ready; ++i) {
+            int fd = events[i].data.fd;
+            if (self->pending_responses_.count(fd))
+                self->handle_response_fd_(fd);
+            else
+                self->handle_request_fd_(fd);
+        }
+
+        self->advance_bulk_sends_();
+
+        // update the busy fraction for utilization(); each cycle waits
+        // at most 100 ms, so this tracks load with about a second of
+        // memory
+        auto busy_end = std::chrono::steady_clock::now();
+        double wait_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                busy_start - wait_start).count();
+        double busy_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                busy_end - busy_start).count();
+        double busy_frac = busy_ns / (busy_ns + wait_ns + 1.0);
+        double prev = self->utilization_.load(std::memory_order_relaxed);
+        self->utilization_.store(
+                prev + 0.1 * (busy_frac - prev), std::memory_order_relaxed);
+
+        {
+            instrumentation::TimedLockGuard lock(self->mutex_);
+            if (self->connections_.empty() && self->shutting_down_)
+                break;
+        }
+    }
+}
+
+
+SocketWorkerPool & SocketWorkerPool::get() {
+    // deliberately leaked, so that it outlives any static objects that
+    // hold a server; the workers themselves are stopped by release()
+    static SocketWorkerPool & pool = *new SocketWorkerPool();
+    return pool;
+}
+
+void SocketWorkerPool::acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (num_users_++ == 0) {
+        std::size_t num_workers = num_workers_();
+        std::vector<int> cpus = worker_cpus_();
+        for (std::size_t i = 0u; i < num_workers; ++i) {
+            int cpu = cpus.empty() ? -1 : cpus[i % cpus.size()];
+            workers_.emplace_back(new SocketServerWorker(cpu));
+        }
+    }
+}
+
+void SocketWorkerPool::release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--num_users_ == 0) {
+        for (auto & worker: workers_)
+            worker->shutdown();
+        workers_.clear();
+    }
+}
+
+void SocketWorkerPool::add_connection(int fd, RequestHandler & handler) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Place the connection on the least loaded worker. Recent busy
+    // fraction is what actually predicts whether a worker can absorb
+    // more traffic; the connection count breaks ties between idle
+    // workers so that connections spread out before there's any load
+    // to measure.
+    double min_score = std::numeric_limits<double>::infinity();
+    std::size_t selected_worker = 0u;
+    for (std::size_t j = 0u; j < workers_.size(); ++j) {
+        double score = workers_[j]->utilization()
+                + 0.01 * workers_[j]->count_active_connections();
+        if (score < min_score) {
+            min_score = score;
+            selected_worker = j;
+        }
+    }
+
+    workers_[selected_worker]->add_connection(fd, handler);
+}
+
+SocketWorkerPool::SocketWorkerPool()
+    : mutex_()
+    , num_users_(0)
+    , workers_()
+{}
+
+} } }
+
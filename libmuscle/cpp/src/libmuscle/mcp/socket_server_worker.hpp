@@ -0,0 +1,246 @@
+#pragma once
+
+#include <libmuscle/mcp/frame_reader.hpp>
+#include <libmuscle/mcp/transport_server.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A worker that handles MCP connections on stream sockets.
+ *
+ * This class contains a set of connections and a thread that handles them
+ * (the worker thread). Operations are synchronised internally, so it's
+ * thread-safe. It forwards the requests on each connection to the
+ * RequestHandler that was registered with that connection, so a single
+ * worker can serve connections belonging to different servers; see
+ * SocketWorkerPool.
+ *
+ * The connections are identified by their file descriptor, and anything
+ * that send() and recv() work on will do, so this serves both the TCP
+ * and the UNIX domain socket transport servers.
+ *
+ * Connections are watched through an edge-triggered epoll instance, so
+ * the cost of a wakeup scales with the number of ready connections, not
+ * with the total number of connections. That matters for macro
+ * instances serving thousands of micro instances. New fds are
+ * registered incrementally; there is no per-wakeup rebuild of an fd
+ * array.
+ */
+class SocketServerWorker {
+    public:
+        /** Create a SocketServerWorker.
+         *
+         * Pinning the worker thread keeps it, and therefore the kernel
+         * socket buffers it touches, on a fixed core. On multi-socket
+         * machines that avoids payloads bouncing between NUMA nodes.
+         *
+         * @param cpu CPU to pin the worker thread to, or -1 to let the
+         *      scheduler place it
+         */
+        explicit SocketServerWorker(int cpu = -1);
+
+        /** Return the number of connections handled by this worker.
+         *
+         * Called by the server thread to get information for load balancing.
+         *
+         * @returns The number of active connections.
+         */
+        int count_active_connections() const;
+
+        /** Returns how busy this worker has been recently.
+         *
+         * This is the fraction of time the worker thread spent handling
+         * requests rather than waiting, exponentially averaged over its
+         * recent wakeups, so a worker stuck streaming large messages
+         * scores near 1 while one with many idle connections scores
+         * near 0. Used for placing new connections, see
+         * TcpTransportServer.
+         *
+         * @return The recent busy fraction, between 0.0 and 1.0.
+         */
+        double utilization() const;
+
+        /** Returns the number of payload bytes served by this worker.
+         *
+         * This counts request and response payloads alike, over the
+         * worker's whole lifetime.
+         *
+         * @return The number of bytes received and sent.
+         */
+        std::uint64_t bytes_served() const;
+
+        /** Add a new active connection to handle.
+         *
+         * Called by the server thread when a client connects. The
+         * handler must remain valid until the connection is closed.
+         *
+         * @param fd The file descriptor of the socket to communicate on.
+         * @param handler The RequestHandler to delegate this
+         *      connection's requests to.
+         */
+        void add_connection(int fd, RequestHandler & handler);
+
+        /** Shut down this worker.
+         *
+         * This will cause the worker to wait for all clients to disconnect,
+         * then shut down. This call will block until the worker has shut
+         * down.
+         *
+         * Called by the server thread on shut down.
+         */
+        void shutdown();
+
+    private:
+        void handle_request_fd_(int fd);
+
+        void process_requests_(int fd);
+
+        void handle_response_fd_(int fd);
+
+        bool send_response_(int fd, std::unique_ptr<DataConstRef> res_buf);
+
+        void advance_bulk_sends_();
+
+        void remove_connection_(int fd);
+
+        struct BulkSend_;
+        bool advance_striped_send_(int fd, BulkSend_ & bulk);
+
+        static void worker_thread_(SocketServerWorker * self);
+
+        bool shutting_down_;
+        int epoll_fd_;
+
+        // recent busy fraction of the worker thread, see utilization();
+        // written only by the worker thread
+        std::atomic<double> utilization_;
+        // request and response payload bytes handled, see bytes_served()
+        std::atomic<std::uint64_t> bytes_served_;
+
+        // request fd -> response fd of the deferred response we're
+        // waiting for, or -1 if there isn't one
+        std::unordered_map<int, int> connections_;
+
+        // request fd -> the handler serving that connection
+        std::unordered_map<int, RequestHandler *> handlers_;
+
+        // response fd -> request fd, for deferred responses; only
+        // touched by the worker thread
+        std::unordered_map<int, int> pending_responses_;
+
+        // per-connection read-ahead, so a burst of pipelined requests
+        // is picked up with a single recv(); only touched by the
+        // worker thread
+        std::unordered_map<int, FrameReader> readers_;
+
+        // a large response being sent in chunks, so that other
+        // connections are served in between; see send_response_(). If
+        // the client attached stripe connections, then the chunks go
+        // out round robin over the main connection and the stripes,
+        // each prefixed with its sequence number.
+        struct BulkSend_ {
+            std::unique_ptr<DataConstRef> buffer;
+            std::size_t sent;
+            std::vector<int> stripe_fds;
+            std::size_t next_chunk;
+            // earliest time the payload may start going out, see
+            // TransferScheduler
+            std::chrono::steady_clock::time_point not_before;
+            // whether the connection is in integrity mode, and the
+            // running checksum of the chunks sent so far
+            bool integrity;
+            std::uint32_t crc;
+        };
+
+        // request fd -> bulk response in progress on it; only touched
+        // by the worker thread
+        std::unordered_map<int, BulkSend_> bulk_sends_;
+
+        // whether the last round of bulk sends was held back by the
+        // TransferScheduler; only touched by the worker thread
+        bool bulk_throttled_;
+
+        // connections in integrity mode; their frames carry checksums
+        // in both directions, see integrity_frame_magic in
+        // tcp_util.hpp. Only touched by the worker thread.
+        std::unordered_set<int> integrity_fds_;
+
+        mutable std::vector<char> req_buf_;
+
+        // mutex before thread, it needs to be initialised before the thread
+        // is started.
+        mutable std::mutex mutex_;
+        std::thread thread_;
+};
+
+
+/** A process-wide pool of SocketServerWorkers shared by all servers.
+ *
+ * With many instances in one process, or an instance with several
+ * transport servers, giving each server its own worker threads
+ * oversubscribes the node: 64 instances each starting four workers
+ * makes 256 threads that the model code then competes with. Instead,
+ * the transport servers share this single pool, so the number of
+ * serving threads in the process is bounded by the thread budget
+ * regardless of how many servers there are.
+ *
+ * The budget is set with MUSCLE_TCP_SERVER_WORKERS, which applies to
+ * the process as a whole; unset, it defaults to the number of cores,
+ * capped at four. MUSCLE_TCP_SERVER_CPUS pins the pool's threads, see
+ * SocketServerWorker. The workers are started when the first server
+ * acquires the pool and stopped when the last one releases it, so no
+ * threads linger after the servers have closed.
+ *
+ * Operations are synchronised internally, so it's thread-safe.
+ */
+class SocketWorkerPool {
+    public:
+        /** Returns the pool for this process.
+         */
+        static SocketWorkerPool & get();
+
+        /** Registers a server as a user of the pool.
+         *
+         * This starts the worker threads if this is the first user.
+         * Each acquire() must be matched by a release().
+         */
+        void acquire();
+
+        /** Deregisters a server from the pool.
+         *
+         * If this was the last user, then this shuts the workers down,
+         * waiting for their remaining clients to disconnect.
+         */
+        void release();
+
+        /** Places a new connection onto one of the pool's workers.
+         *
+         * The connection goes to the least loaded worker. The handler
+         * must remain valid until the connection is closed.
+         *
+         * @param fd The file descriptor of the socket to communicate on.
+         * @param handler The RequestHandler to delegate this
+         *      connection's requests to.
+         */
+        void add_connection(int fd, RequestHandler & handler);
+
+    private:
+        SocketWorkerPool();
+
+        std::mutex mutex_;
+        int num_users_;
+        std::vector<std::unique_ptr<SocketServerWorker>> workers_;
+};
+
+} } }
+
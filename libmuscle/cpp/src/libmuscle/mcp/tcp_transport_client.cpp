@@ -1,18 +1,25 @@
 #include "libmuscle/mcp/tcp_transport_client.hpp"
 
 #include "libmuscle/data.hpp"
+#include "libmuscle/instrumentation.hpp"
 #include "libmuscle/mcp/tcp_util.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <poll.h>
 #include <unistd.h>
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <arpa/inet.h>
+#include <ifaddrs.h>
 #include <netdb.h>
-#include <netinet/tcp.h>
+#include <netinet/in.h>
 
 
 namespace {
@@ -37,6 +44,115 @@ std::vector<std::string> split_location(std::string const & location) {
 }
 
 
+/* The addresses and netmasks of this host's network interfaces.
+ *
+ * Collected once per process; the interface configuration does not
+ * change over the life of a simulation.
+ */
+struct LocalInterface {
+    int family;
+    unsigned char addr[16];
+    unsigned char mask[16];
+};
+
+std::vector<LocalInterface> const & local_interfaces() {
+    static std::vector<LocalInterface> const interfaces = []() {
+            std::vector<LocalInterface> result;
+            ifaddrs * ifa_list;
+            if (getifaddrs(&ifa_list) != 0)
+                return result;
+            for (ifaddrs * ifa = ifa_list; ifa != nullptr; ifa = ifa->ifa_next) {
+                if (!ifa->ifa_addr || !ifa->ifa_netmask)
+                    continue;
+                LocalInterface iface;
+                iface.family = ifa->ifa_addr->sa_family;
+                if (iface.family == AF_INET) {
+                    memcpy(iface.addr, &reinterpret_cast<sockaddr_in*>(
+                                ifa->ifa_addr)->sin_addr, 4u);
+                    memcpy(iface.mask, &reinterpret_cast<sockaddr_in*>(
+                                ifa->ifa_netmask)->sin_addr, 4u);
+                }
+                else if (iface.family == AF_INET6) {
+                    memcpy(iface.addr, &reinterpret_cast<sockaddr_in6*>(
+                                ifa->ifa_addr)->sin6_addr, 16u);
+                    memcpy(iface.mask, &reinterpret_cast<sockaddr_in6*>(
+                                ifa->ifa_netmask)->sin6_addr, 16u);
+                }
+                else
+                    continue;
+                result.push_back(iface);
+            }
+            freeifaddrs(ifa_list);
+            return result;
+            }();
+    return interfaces;
+}
+
+/* Estimates how close the given address is to this host.
+ *
+ * Returns 0 if the address belongs to one of our own interfaces, so
+ * that the server is on this host and the kernel short-circuits the
+ * connection, 1 if it is on the same subnet as one of our interfaces,
+ * so that it is a link away at most, and 2 for everything else,
+ * including host names, which we'd have to resolve to classify.
+ */
+int address_proximity(std::string const & address) {
+    std::size_t split = address.rfind(':');
+    std::string host = address.substr(0u, split);
+    if (!host.empty() && host.front() == '[' && host.back() == ']')
+        host = host.substr(1u, host.size() - 2u);
+
+    unsigned char addr[16];
+    int family;
+    std::size_t len;
+    if (inet_pton(AF_INET, host.c_str(), addr) == 1) {
+        family = AF_INET;
+        len = 4u;
+    }
+    else if (inet_pton(AF_INET6, host.c_str(), addr) == 1) {
+        family = AF_INET6;
+        len = 16u;
+    }
+    else
+        return 2;
+
+    int proximity = 2;
+    for (auto const & iface : local_interfaces()) {
+        if (iface.family != family)
+            continue;
+        if (memcmp(iface.addr, addr, len) == 0)
+            return 0;
+        bool same_subnet = true;
+        for (std::size_t i = 0u; i < len; ++i)
+            if ((iface.addr[i] & iface.mask[i]) != (addr[i] & iface.mask[i])) {
+                same_subnet = false;
+                break;
+            }
+        if (same_subnet)
+            proximity = 1;
+    }
+    return proximity;
+}
+
+/* Sorts candidate addresses by inferred network proximity.
+ *
+ * A server on a multi-homed node lists an address per interface, in
+ * whatever order the server enumerated them. Trying them in that order
+ * can route same-node or same-rack traffic over a management network,
+ * or stall on an address we cannot reach at all until the connection
+ * attempt times out. Sorting closest first makes peers take the
+ * shortest viable path without per-deployment configuration. The sort
+ * is stable, so the server's order still breaks ties.
+ */
+void sort_by_proximity(std::vector<std::string> & addresses) {
+    std::stable_sort(
+            addresses.begin(), addresses.end(),
+            [](std::string const & lhs, std::string const & rhs) {
+                return address_proximity(lhs) < address_proximity(rhs);
+            });
+}
+
+
 int connect(std::string const & address) {
     std::size_t split = address.rfind(':');
     std::string host = address.substr(0, split);
@@ -69,6 +185,10 @@ int connect(std::string const & address) {
         int socket_fd = socket(p->ai_family, p->ai_socktype, p->ai_protocol);
         if (socket_fd == -1) continue;
 
+        // before connect(), so that the window scale is negotiated to
+        // match
+        libmuscle::impl::mcp::size_tcp_buffers(socket_fd);
+
         err_code = connect(socket_fd, p->ai_addr, p->ai_addrlen);
         if (err_code == -1) {
             ::close(socket_fd);
@@ -81,6 +201,46 @@ int connect(std::string const & address) {
             + port);
 }
 
+
+/* Returns the maximum number of stripe connections to attach.
+ *
+ * Read from MUSCLE_TCP_STRIPES; unset or 0 disables striping, and
+ * values above 8 are clamped, since the win flattens out well before
+ * that. See the TcpTransportClient class documentation.
+ */
+int stripe_limit() {
+    static int limit = []() {
+            char const * env = getenv("MUSCLE_TCP_STRIPES");
+            int value = env ? atoi(env) : 0;
+            return std::min(std::max(value, 0), 8);
+            }();
+    return limit;
+}
+
+
+/* Returns whether to put connections in integrity mode.
+ *
+ * Set with MUSCLE_TCP_INTEGRITY, see the TcpTransportClient class
+ * documentation. Read per connection, which is rare enough not to need
+ * caching.
+ */
+bool integrity_enabled() {
+    char const * env = getenv("MUSCLE_TCP_INTEGRITY");
+    return (env != nullptr) && (strcmp(env, "0") != 0);
+}
+
+
+/* Returns a channel id that no other client of the same server uses.
+ *
+ * The server keys its stripe registry on these, so clients in
+ * different processes must not collide; combining the pid with a
+ * per-process counter takes care of that.
+ */
+int64_t make_channel_id() {
+    static std::atomic<std::uint32_t> count(0u);
+    return (static_cast<int64_t>(getpid()) << 32) | count++;
+}
+
 }
 
 
@@ -95,10 +255,12 @@ TcpTransportClient::TcpTransportClient(std::string const & location)
 {
     std::string errors;
     auto addresses = split_location(location);
+    sort_by_proximity(addresses);
 
     for (auto const & address: addresses)
         try {
             socket_fd_ = connect(address);
+            address_ = address;
             break;
         }
         catch (std::runtime_error const & e) {
@@ -111,9 +273,29 @@ TcpTransportClient::TcpTransportClient(std::string const & location)
                 "Could not connect to any server at locations " + location
                 + ": " + errors);
 
-    int flags = 0;
-    setsockopt(socket_fd_, SOL_TCP, TCP_NODELAY, &flags, sizeof(flags));
-    setsockopt(socket_fd_, SOL_TCP, TCP_QUICKACK, &flags, sizeof(flags));
+    tune_tcp_socket(socket_fd_);
+    enable_keepalive(socket_fd_);
+
+    integrity_ = integrity_enabled();
+    if (integrity_)
+        send_int64(socket_fd_, integrity_frame_magic);
+
+    max_stripes_ = stripe_limit();
+    if (max_stripes_ > 0) {
+        channel_id_ = make_channel_id();
+        int64_t ctrl[3] = {control_frame_magic, channel_id_, -1};
+        send_all(socket_fd_, reinterpret_cast<char const *>(ctrl),
+                sizeof ctrl);
+        try {
+            while (static_cast<int>(stripe_fds_.size())
+                    < std::min(2, max_stripes_))
+                open_stripe_();
+        }
+        catch (std::runtime_error const &) {
+            // the main connection works, so run with what we have
+            stripes_saturated_ = true;
+        }
+    }
 }
 
 TcpTransportClient::~TcpTransportClient() {
@@ -124,15 +306,223 @@ TcpTransportClient::~TcpTransportClient() {
 DataConstRef TcpTransportClient::call(
         char const * req_buf, std::size_t req_len
 ) const {
-    send_frame(socket_fd_, req_buf, req_len);
+    send_request(req_buf, req_len);
+    return get_response();
+}
+
+DataConstRef TcpTransportClient::call(
+        char const * req_buf, std::size_t req_len,
+        RecvBufferAllocator const & recv_buf
+) const {
+    send_request(req_buf, req_len);
+    return get_response(recv_buf);
+}
 
-    int64_t length = recv_int64(socket_fd_);
+void TcpTransportClient::send_request(
+        char const * req_buf, std::size_t req_len
+) const {
+    if (integrity_)
+        send_frame_crc(socket_fd_, req_buf, req_len);
+    else
+        send_frame(socket_fd_, req_buf, req_len);
+}
+
+DataConstRef TcpTransportClient::get_response() const {
+    if (receive_timeout_.is_set() && !reader_.has_buffered_data())
+        wait_for_data(socket_fd_, receive_timeout_.get());
+    int64_t length = reader_.read_int64(socket_fd_);
+    if (length == striped_frame_magic) {
+        int64_t total = reader_.read_int64(socket_fd_);
+        auto result = Data::byte_array(total);
+        read_striped_(result.as_byte_array(), total);
+        if (integrity_)
+            verify_integrity_(result.as_byte_array(), total);
+        sample_rtt_();
+        return result;
+    }
     auto result = Data::byte_array(length);
-    recv_all(socket_fd_, result.as_byte_array(), result.size());
+    reader_.read_all(socket_fd_, result.as_byte_array(), result.size());
+    if (integrity_)
+        verify_integrity_(result.as_byte_array(), length);
+    sample_rtt_();
     return result;
 }
 
+DataConstRef TcpTransportClient::get_response(
+        RecvBufferAllocator const & recv_buf
+) const {
+    if (receive_timeout_.is_set() && !reader_.has_buffered_data())
+        wait_for_data(socket_fd_, receive_timeout_.get());
+    int64_t length = reader_.read_int64(socket_fd_);
+    if (length == striped_frame_magic) {
+        int64_t total = reader_.read_int64(socket_fd_);
+        char * buf = recv_buf(total);
+        read_striped_(buf, total);
+        if (integrity_)
+            verify_integrity_(buf, total);
+        sample_rtt_();
+        return Data::byte_array(buf, total);
+    }
+    char * buf = recv_buf(length);
+    reader_.read_all(socket_fd_, buf, length);
+    if (integrity_)
+        verify_integrity_(buf, length);
+    sample_rtt_();
+    return Data::byte_array(buf, length);
+}
+
+bool TcpTransportClient::response_started() const {
+    if (reader_.has_buffered_data())
+        return true;
+    pollfd pfd;
+    pfd.fd = socket_fd_;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1u, 0) > 0;
+}
+
+int TcpTransportClient::poll_fd() const {
+    return socket_fd_;
+}
+
+/* Occasionally samples the connection's round-trip time estimate.
+ *
+ * This publishes the kernel's smoothed RTT for this connection through
+ * the instrumentation counters, so that a slow or congested link shows
+ * up in a counter dump. Sampled once every 64 responses to keep the
+ * getsockopt() off the per-message path.
+ */
+void TcpTransportClient::sample_rtt_() const {
+    if ((++responses_received_ & 63u) != 0u)
+        return;
+    std::uint64_t rtt = tcp_rtt_us(socket_fd_);
+    if (rtt > 0u)
+        instrumentation::counters().peer_rtt_us.store(
+                rtt, std::memory_order_relaxed);
+}
+
+/* Reads a response's trailing checksum and verifies the payload.
+ *
+ * The checksum trails the complete payload on the main connection,
+ * also for striped responses. Only called in integrity mode.
+ *
+ * @param buf The received payload.
+ * @param length The length of the payload in bytes.
+ */
+void TcpTransportClient::verify_integrity_(
+        char const * buf, int64_t length) const {
+    std::uint32_t crc = static_cast<std::uint32_t>(
+            reader_.read_int64(socket_fd_));
+    if (crc != crc32c(0u, buf, length))
+        throw std::runtime_error(
+                "Received a message whose checksum does not match its"
+                " contents. The data was corrupted in transit; check"
+                " your network hardware.");
+}
+
+/* Attaches one more stripe connection to the server.
+ *
+ * This connects to the same address as the main connection and sends
+ * a control frame associating the new connection with our channel, at
+ * the next free stripe index. The server starts using it for the next
+ * striped response it sends us.
+ */
+void TcpTransportClient::open_stripe_() const {
+    int fd = connect(address_);
+    tune_tcp_socket(fd);
+    enable_keepalive(fd);
+    int64_t ctrl[3] = {
+            control_frame_magic, channel_id_,
+            static_cast<int64_t>(stripe_fds_.size())};
+    send_all(fd, reinterpret_cast<char const *>(ctrl), sizeof ctrl);
+    stripe_fds_.push_back(fd);
+    stripe_readers_.emplace_back();
+}
+
+/* Receives a striped response into buf.
+ *
+ * The striped frame header has been read up to and including the
+ * total length; this reads the rest, see tcp_util.hpp for the layout.
+ * Chunks arrive round robin over the main connection and the stripes,
+ * each prefixed with its sequence number, which we verify. Note that
+ * chunks for the main connection must go through reader_, which may
+ * have buffered ahead of us; each stripe likewise has its own reader,
+ * which saves the separate recv() for the sequence number.
+ *
+ * @param buf The buffer to receive into, total bytes in size.
+ * @param total The length of the response in bytes.
+ */
+void TcpTransportClient::read_striped_(char * buf, int64_t total) const {
+    int64_t chunk_size = reader_.read_int64(socket_fd_);
+    int64_t num_stripes = reader_.read_int64(socket_fd_);
+
+    auto start = std::chrono::steady_clock::now();
+
+    int64_t num_fds = num_stripes + 1;
+    int64_t offset = 0;
+    for (int64_t seq = 0; offset < total; ++seq) {
+        int64_t todo = std::min(chunk_size, total - offset);
+        int64_t seq_recvd;
+        if (seq % num_fds == 0) {
+            seq_recvd = reader_.read_int64(socket_fd_);
+            reader_.read_all(socket_fd_, buf + offset, todo);
+        }
+        else {
+            int stripe_fd = stripe_fds_.at(seq % num_fds - 1);
+            FrameReader & stripe_reader =
+                    stripe_readers_.at(seq % num_fds - 1);
+            seq_recvd = stripe_reader.read_int64(stripe_fd);
+            stripe_reader.read_all(stripe_fd, buf + offset, todo);
+        }
+        if (seq_recvd != seq)
+            throw std::runtime_error(
+                    "Striped receive out of sequence. This is a bug in"
+                    " MUSCLE3, please report it.");
+        offset += todo;
+    }
+
+    double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    adapt_stripes_(total, elapsed);
+}
+
+/* Adjusts the number of stripe connections after a striped receive.
+ *
+ * Throughput is measured over each striped response; as long as the
+ * last stripe added kept improving it, another one is opened, up to
+ * the configured maximum. Once a response comes in no faster than the
+ * best seen so far, the count is frozen, since stripes beyond the
+ * saturation point only add overhead.
+ *
+ * @param total The length of the response received, in bytes.
+ * @param elapsed The time the receive took, in seconds.
+ */
+void TcpTransportClient::adapt_stripes_(int64_t total, double elapsed) const {
+    if (stripes_saturated_)
+        return;
+    if (static_cast<int>(stripe_fds_.size()) >= max_stripes_) {
+        stripes_saturated_ = true;
+        return;
+    }
+
+    double throughput = static_cast<double>(total) / (elapsed + 1e-9);
+    if (throughput > best_striped_bps_ * 1.05) {
+        best_striped_bps_ = throughput;
+        try {
+            open_stripe_();
+        }
+        catch (std::runtime_error const &) {
+            stripes_saturated_ = true;
+        }
+    }
+    else
+        stripes_saturated_ = true;
+}
+
 void TcpTransportClient::close() {
+    for (int stripe_fd: stripe_fds_)
+        ::close(stripe_fd);
+    stripe_fds_.clear();
     ::close(socket_fd_);
     socket_fd_ = -1;
 }
@@ -4,13 +4,51 @@
 #include LIBMUSCLE_MOCK_MCP_TCP_TRANSPORT_CLIENT
 #else
 
+#include "libmuscle/mcp/frame_reader.hpp"
 #include "libmuscle/mcp/transport_client.hpp"
 #include "libmuscle/data.hpp"
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 
 namespace libmuscle { namespace impl { namespace mcp {
 
 /** A client that connects to a TCPTransport server.
+ *
+ * A server on a multi-homed node lists an address per interface; the
+ * client sorts these by proximity, preferring addresses of this host's
+ * own interfaces, then addresses on a subnet this host is on, so that
+ * co-located peers connect over the fastest viable path rather than in
+ * whatever order the server enumerated its interfaces.
+ *
+ * A single TCP connection is limited to single-stream throughput,
+ * which on fast networks falls well short of line rate. If
+ * MUSCLE_TCP_STRIPES is set to 2 or more, then the client attaches
+ * that many extra connections to the same server as stripes, and the
+ * server sends large responses in sequence-numbered chunks round
+ * robin over all of them; each connection has its own congestion
+ * window, so together they carry more. Stripes are opened as they
+ * prove useful: two at first, then one more after each striped
+ * response that improved throughput, up to the configured maximum
+ * (capped at 8). The server stripes responses above
+ * MUSCLE_TCP_STRIPE_THRESHOLD bytes (default 16 MiB), see
+ * SocketServerWorker.
+ *
+ * If MUSCLE_TCP_INTEGRITY is set (to anything but 0), then the client
+ * puts its connections in integrity mode: every frame in either
+ * direction carries a CRC32C of its payload, which the receiving side
+ * verifies. A flaky link or NIC that corrupts a payload then fails the
+ * run immediately instead of feeding the model bad data, and doing the
+ * checksumming here, with the SSE4.2 crc32 instruction where
+ * available, is far cheaper than doing it in model code. See
+ * integrity_frame_magic in tcp_util.hpp for the wire format.
+ *
+ * The Python implementation does not understand the stripe and
+ * integrity control frames, so set MUSCLE_TCP_STRIPES and
+ * MUSCLE_TCP_INTEGRITY only if the peers are known to run libmuscle
+ * C++.
  */
 class TcpTransportClient : public TransportClient {
     public:
@@ -48,6 +86,59 @@ class TcpTransportClient : public TransportClient {
         virtual DataConstRef call(
                 char const * req_buf, std::size_t req_len) const override;
 
+        /** Send a request and receive the response into a given buffer.
+         *
+         * This is a blocking call. The response is received from the
+         * socket directly into the buffer provided by recv_buf, see
+         * TransportClient::call for the contract.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len,
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Send a request without waiting for the response.
+         *
+         * Requests may be pipelined; see TransportClient::send_request.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         */
+        virtual void send_request(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Receive the response to the oldest outstanding request.
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef get_response() const override;
+
+        /** Receive the oldest outstanding response into a given buffer.
+         *
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef get_response(
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Returns whether the oldest outstanding response has started
+         * to arrive, without blocking.
+         */
+        virtual bool response_started() const override;
+
+        /** Returns the main connection's socket, which is pollable.
+         */
+        virtual int poll_fd() const override;
+
         /** Closes this client.
          *
          * This closes any connections this client has and/or performs other
@@ -56,7 +147,41 @@ class TcpTransportClient : public TransportClient {
         virtual void close() override;
 
     private:
+        void sample_rtt_() const;
+
+        void verify_integrity_(char const * buf, int64_t length) const;
+
+        void open_stripe_() const;
+
+        void read_striped_(char * buf, int64_t total) const;
+
+        void adapt_stripes_(int64_t total, double elapsed) const;
+
         int socket_fd_;
+        // the address the main connection connected to; stripe
+        // connections go to the same one
+        std::string address_;
+        // striping channel id shared with the server, see tcp_util.hpp
+        std::int64_t channel_id_ = 0;
+        // maximum number of stripe connections, from MUSCLE_TCP_STRIPES
+        int max_stripes_ = 0;
+        // whether frames carry checksums, from MUSCLE_TCP_INTEGRITY
+        bool integrity_ = false;
+        // stripe connections, in stripe index order; mutable because
+        // they are opened lazily as receives prove that they help
+        mutable std::vector<int> stripe_fds_;
+        // read-ahead per stripe connection, so that a chunk's sequence
+        // header doesn't cost a separate recv(), see read_striped_()
+        mutable std::vector<FrameReader> stripe_readers_;
+        // best throughput seen over a striped receive, in bytes/s
+        mutable double best_striped_bps_ = 0.0;
+        // whether to stop opening further stripes, see adapt_stripes_()
+        mutable bool stripes_saturated_ = false;
+        // read-ahead for responses; mutable because receiving doesn't
+        // change the client's observable state
+        mutable FrameReader reader_;
+        // responses received, for sampling the RTT now and then
+        mutable std::uint64_t responses_received_ = 0u;
 };
 
 } } }
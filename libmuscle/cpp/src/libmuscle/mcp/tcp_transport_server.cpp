@@ -2,289 +2,34 @@
 
 #include "libmuscle/data.hpp"
 #include "libmuscle/mcp/transport_server.hpp"
+#include "libmuscle/mcp/socket_server_worker.hpp"
 #include "libmuscle/mcp/tcp_util.hpp"
 
+#include <algorithm>
 #include <arpa/inet.h>
 #include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <ifaddrs.h>
-#include <netinet/tcp.h>
 #include <poll.h>
 #include <thread>
 #include <unistd.h>
-#include <unordered_map>
 #include <sys/types.h>
 #include <sys/socket.h>
 
 
 using namespace std::string_literals;
 
-using libmuscle::impl::DataConstRef;
-using libmuscle::impl::mcp::recv_all;
-using libmuscle::impl::mcp::send_frame;
-using libmuscle::impl::mcp::recv_int64;
 using libmuscle::impl::mcp::RequestHandler;
-
-
-namespace {
-
-/** A worker that handles MCP-over-TCP connections.
- *
- * This class contains a list of connections and a thread that handles them
- * (the worker thread). Operations are synchronised internally, so it's
- * thread-safe. It forwards the requests to a RequestHandler.
- */
-class TcpTransportServerWorker {
-    public:
-        /** Create a TcpTransportServerWorker.
-         *
-         * @param handler The RequestHandler to delegate requests to
-         */
-        explicit TcpTransportServerWorker(RequestHandler & handler)
-            : handler_(handler)
-            , shutting_down_(false)
-            , connections_()
-            , connections_changed_(false)
-            , polled_fds_()
-            , polled_fd_types_()
-            , mutex_()
-            , thread_(worker_thread_, this)
-        {}
-
-        /** Return the number of connections handled by this worker.
-         *
-         * Called by the server thread to get information for load balancing.
-         *
-         * @returns The number of active connections.
-         */
-        int count_active_connections() const {
-            std::lock_guard<std::mutex> lock(mutex_);
-            return connections_.size();
-        }
-
-        /** Add a new active connection to handle.
-         *
-         * Called by the server thread when a client connects.
-         *
-         * @param fd The file descriptor of the socket to communicate on.
-         */
-        void add_connection(int fd) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            connections_.push_back(fd);
-            connections_changed_ = true;
-        }
-
-        /** Shut down this worker.
-         *
-         * This will cause the worker to wait for all clients to disconnect,
-         * then shut down. This call will block until the worker has shut
-         * down.
-         *
-         * Called by the server thread on shut down.
-         */
-        void shutdown() {
-            {
-                std::lock_guard<std::mutex> lock(mutex_);
-                shutting_down_ = true;
-            }
-            thread_.join();
-        }
-
-    private:
-        /* Copies the list of managed connections into a poll_fd structure.
-         *
-         * Having a copy allows the server thread to add connections while the
-         * worker is handling requests.
-         *
-         * This readies the polled_fds_ member for calling poll(), and the
-         * polled_fd_types_ member for subsequent handling. After this is
-         * called, polled_fds_ and polled_fd_types_ correspond index-wise to
-         * connections_.
-         *
-         * Called by the worker thread.
-         */
-        void update_polled_fds_() {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (connections_changed_) {
-                polled_fds_.resize(connections_.size());
-                polled_fd_types_.resize(connections_.size());
-                std::size_t i = 0;
-                for (auto & conn: connections_) {
-                    if (conn.response_fd != -1) {
-                        polled_fds_[i].fd = conn.response_fd;
-                        polled_fd_types_[i] = FdType_::response;
-                    }
-                    else {
-                        polled_fds_[i].fd = conn.request_fd;
-                        polled_fd_types_[i] = FdType_::request;
-                    }
-                    polled_fds_[i].events = POLLIN;
-                    polled_fds_[i].revents = 0;
-                    ++i;
-                }
-                connections_changed_ = false;
-            }
-        }
-
-        /* Checks which fds are ready, and handles requests and responses.
-         *
-         * This takes the results from calling poll(), answers any requests
-         * that can be answered immediately, waits for the responses on the
-         * rest, and when responses are available, gets them and sends them
-         * to the requester.
-         *
-         * Called by the worker thread.
-         */
-        void handle_ready_fds_() {
-            for (std::size_t i = 0; i < polled_fds_.size(); ++i) {
-                auto & polled_fd = polled_fds_[i];
-                if (polled_fd.revents & POLLIN) {
-                    if (polled_fd_types_[i] == FdType_::request) {
-                        try {
-                            int64_t length = recv_int64(polled_fd.fd);
-                            req_buf_.resize(length);
-                            recv_all(polled_fd.fd, req_buf_.data(), length);
-
-                            std::unique_ptr<DataConstRef> res_buf;
-                            int res_fd = handler_.handle_request(req_buf_.data(), length, res_buf);
-                            if (res_fd < 0) {
-                                // got a response immediately, send it
-                                send_response_(polled_fd.fd, std::move(res_buf));
-                            }
-                            else {
-                                // response not yet available, wait for it
-                                std::lock_guard<std::mutex> lock(mutex_);
-                                connections_[i].response_fd = res_fd;
-                                connections_changed_ = true;
-                            }
-                        }
-                        catch (std::runtime_error const & e) {
-                            // EOF; port was closed, mark as such
-                            polled_fd.revents |= POLLHUP;
-                        }
-                    }
-                    else {  // response ready
-                        char dummy;
-                        read(polled_fd.fd, &dummy, 1);
-
-                        std::unique_ptr<DataConstRef> res_buf;
-                        res_buf = handler_.get_response(polled_fd.fd);
-
-                        int fd;
-                        {
-                            std::lock_guard<std::mutex> lock(mutex_);
-                            fd = connections_[i].request_fd;
-                            connections_[i].response_fd = -1;
-                            connections_changed_ = true;
-                        }
-                        send_response_(fd, std::move(res_buf));
-                    }
-                }
-            }
-        }
-
-        /* Send contents of response buffer to the given fd.
-         *
-         * This saves some duplication in the code above. Takes ownership of
-         * res_buf and discards it after sending.
-         *
-         * @param fd The fd to send the data on
-         */
-        void send_response_(int fd, std::unique_ptr<DataConstRef> res_buf) {
-            send_frame(fd, res_buf->as_byte_array(), res_buf->size());
-        }
-
-        /* Detects ports that have closed and removes those connections.
-         *
-         * This cleans up the internal administration when clients disconnect.
-         * After this procedure has been called, connections_ and polled_fds_
-         * no longer correspond one-on-one to each other.
-         *
-         * Called by the worker thread.
-         */
-        void remove_closed_ports_() {
-            for (std::size_t i = polled_fds_.size(); i > 0u; --i) {
-                std::size_t j = i - 1;
-                if (polled_fd_types_[j] == FdType_::request) {
-                    auto const & polled_fd = polled_fds_[j];
-                    if (polled_fd.revents & POLLHUP) {
-                        ::close(polled_fd.fd);
-                        std::lock_guard<std::mutex> lock(mutex_);
-                        connections_.erase(connections_.begin() + j);
-                        connections_changed_ = true;
-                    }
-                }
-            }
-        }
-
-        /* The main function for the worker thread.
-         *
-         * This is static since I'm not sure if std::thread works with a
-         * thiscall. Probably with some adaptor, but this works too.
-         *
-         * This runs in a loop until shutdown() is called by the server
-         * thread.
-         *
-         * @param self The TcpTransportServerWorker this thread belongs to.
-         */
-        static void worker_thread_(TcpTransportServerWorker * self) {
-            while (true) {
-                self->update_polled_fds_();
-                if (!self->polled_fds_.empty()) {
-                    poll(self->polled_fds_.data(), self->polled_fds_.size(), 100);
-                    self->handle_ready_fds_();
-                    self->remove_closed_ports_();
-                }
-                else {
-                    // Avoid blocking the CPU while waiting for clients to
-                    // connect.
-                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                }
-                {
-                    std::lock_guard<std::mutex> lock(self->mutex_);
-                    if (self->connections_.empty() && self->shutting_down_)
-                        break;
-                }
-            }
-        }
-
-        struct Connection_ {
-            int request_fd, response_fd;
-
-            Connection_(int request_fd)
-                : request_fd(request_fd)
-                , response_fd(-1)
-            {}
-        };
-
-        enum class FdType_ {
-            request,
-            response
-        };
-
-        RequestHandler & handler_;
-        bool shutting_down_;
-        std::vector<Connection_> connections_;
-        bool connections_changed_;
-
-        std::vector<pollfd> polled_fds_;
-        std::vector<FdType_> polled_fd_types_;
-
-        mutable std::vector<char> req_buf_;
-
-        // mutex before thread, it needs to be initialised before the thread
-        // is started.
-        mutable std::mutex mutex_;
-        std::thread thread_;
-};
-
-}
+using libmuscle::impl::mcp::SocketWorkerPool;
 
 
 namespace libmuscle { namespace impl { namespace mcp {
 
-TcpTransportServer::TcpTransportServer(RequestHandler & handler)
+TcpTransportServer::TcpTransportServer(
+        RequestHandler & handler, int preferred_port)
     : TransportServer(handler)
+    , preferred_port_(preferred_port)
 {
     pipe(control_pipe_);
     thread_ = std::thread(server_thread_, this);
@@ -350,14 +95,22 @@ int TcpTransportServer::create_socket_() const {
         memset(&addr, 0, sizeof(addr));
         addr.sin6_family = AF_INET6;
         addr.sin6_addr = in6addr_any;
-        addr.sin6_port = htons(0);
+        addr.sin6_port = htons(preferred_port_);
 
         int err = 0;
         if ((err = bind(sockfd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr))) == -1) {
+            // the preferred port may be taken, an ephemeral one will do
+            addr.sin6_port = htons(0);
+            err = bind(sockfd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        }
+        if (err == -1) {
             ::close(sockfd);
             throw std::runtime_error("Failed to bind TCP6 socket");
         }
 
+        // accepted sockets inherit the listening socket's buffer sizes
+        size_tcp_buffers(sockfd);
+
         if ((err = listen(sockfd, backlog)) == -1)
             throw std::runtime_error("Failed to listen on TCP6 socket");
     }
@@ -374,14 +127,21 @@ int TcpTransportServer::create_socket_() const {
         memset(&addr, 0, sizeof(addr));
         addr.sin_family = AF_INET;
         addr.sin_addr.s_addr = INADDR_ANY;
-        addr.sin_port = htons(0);
+        addr.sin_port = htons(preferred_port_);
 
         int err = 0;
         if ((err = bind(sockfd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr))) == -1) {
+            // the preferred port may be taken, an ephemeral one will do
+            addr.sin_port = htons(0);
+            err = bind(sockfd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        }
+        if (err == -1) {
             ::close(sockfd);
             throw std::runtime_error("Failed to bind TCP4 socket");
         }
 
+        size_tcp_buffers(sockfd);
+
         if ((err = listen(sockfd, backlog)) == -1)
             throw std::runtime_error("Failed to listen on TCP4 socket");
     }
@@ -433,8 +193,8 @@ int TcpTransportServer::set_up_socket_() {
 }
 
 void TcpTransportServer::server_thread_(TcpTransportServer * self) {
-    std::vector<std::unique_ptr<TcpTransportServerWorker>> workers;
-    workers.emplace_back(new TcpTransportServerWorker(self->handler_));
+    SocketWorkerPool & pool = SocketWorkerPool::get();
+    pool.acquire();
     int socket_fd = self->set_up_socket_();
 
     while (true) {
@@ -456,29 +216,14 @@ void TcpTransportServer::server_thread_(TcpTransportServer * self) {
         // TODO: get peer info and log it
         if (poll_fds[1].revents & POLLIN) {
             int new_fd = accept(poll_fds[1].fd, nullptr, nullptr);
-            int flags = 0;
-            setsockopt(new_fd, SOL_TCP, TCP_NODELAY, &flags, sizeof(flags));
-            setsockopt(new_fd, SOL_TCP, TCP_QUICKACK, &flags, sizeof(flags));
-
-            // TODO: there's a trait<size_t>::max, isn't there?
-            std::size_t min_size = static_cast<std::size_t>(-1);
-            std::size_t selected_worker = 0u;
-            for (std::size_t j = 0u; j < workers.size(); ++j) {
-                std::size_t cur_size = workers[j]->count_active_connections();
-                if (cur_size < min_size) {
-                    min_size = cur_size;
-                    selected_worker = j;
-                }
-            }
-
-            workers[selected_worker]->add_connection(new_fd);
+            tune_tcp_socket(new_fd);
+            enable_keepalive(new_fd);
+            pool.add_connection(new_fd, self->handler_);
         }
     }
 
     ::close(socket_fd);
-
-    for (auto & worker: workers)
-        worker->shutdown();
+    pool.release();
 }
 
 } } }
@@ -14,14 +14,27 @@
 namespace libmuscle { namespace impl { namespace mcp {
 
 /** A server that accepts TCP connections.
+ *
+ * Connections are served by the process-wide SocketWorkerPool, which
+ * all transport servers in the process share, so the number of serving
+ * threads is bounded by the pool's budget however many servers there
+ * are.
  */
 class TcpTransportServer : public TransportServer {
     public:
         /** Create a TcpTransportServer.
+         *
+         * If a preferred port is given, then the server tries to listen
+         * on that port, and falls back to an ephemeral port if it is
+         * taken. This is used to come back up on the same location
+         * after a restart, so that cached peer locations remain valid;
+         * see Instance.
          *
          * @param handler A handler to handler requests
+         * @param preferred_port Port to try to listen on, or 0 for an
+         *      ephemeral port
          */
-        TcpTransportServer(RequestHandler & handler);
+        TcpTransportServer(RequestHandler & handler, int preferred_port = 0);
 
         /** Closes the server if it wasn't already closed.
          */
@@ -56,6 +69,7 @@ class TcpTransportServer : public TransportServer {
         mutable std::mutex mutex_;
         mutable std::condition_variable location_set_;
         int control_pipe_[2];
+        int preferred_port_;
         std::thread thread_;
         std::string location_;
 };
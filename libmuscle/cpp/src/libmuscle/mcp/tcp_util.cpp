@@ -1,10 +1,18 @@
 #include <libmuscle/mcp/tcp_util.hpp>
 
-#include <algorithm>
+#include <libmuscle/receive_timeout_error.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
 #include <stdexcept>
-#include <vector>
 
+#include <netinet/tcp.h>
+#include <poll.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 
 
 namespace libmuscle { namespace impl { namespace mcp {
@@ -45,22 +53,234 @@ int64_t recv_int64(int fd) {
     return data;
 }
 
-ssize_t send_frame(int fd, char const * data, ssize_t length) {
-    static_assert(sizeof(ssize_t) == 8, "MUSCLE3 needs a 64-bit machine/OS to compile");
-    char * len_data = reinterpret_cast<char*>(&length);
+namespace {
 
-    std::vector<char> buf(length + 8);
-    std::copy(len_data, len_data + 8, buf.data());
-    std::copy(data, data + length, buf.data() + 8);
+/* Sends the given iovecs in full, handling partial sends.
+ */
+ssize_t send_iovs_(int fd, iovec * iov, std::size_t num_iovs, ssize_t total) {
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = num_iovs;
 
-    for (ssize_t sent = 0; sent < length + 8; ) {
-        ssize_t sent_now = send(fd, buf.data() + sent, length + 8 - sent, MSG_NOSIGNAL);
+    for (ssize_t sent = 0; sent < total; ) {
+        ssize_t sent_now = sendmsg(fd, &msg, MSG_NOSIGNAL);
         if (sent_now == -1)
             return -1;
         sent += sent_now;
+
+        // skip past what was sent, in case of a partial send
+        std::size_t n = sent_now;
+        while ((n > 0u) && (msg.msg_iovlen > 0u)) {
+            if (n >= msg.msg_iov[0].iov_len) {
+                n -= msg.msg_iov[0].iov_len;
+                ++msg.msg_iov;
+                --msg.msg_iovlen;
+            }
+            else {
+                msg.msg_iov[0].iov_base =
+                        static_cast<char *>(msg.msg_iov[0].iov_base) + n;
+                msg.msg_iov[0].iov_len -= n;
+                n = 0u;
+            }
+        }
     }
+    return total;
+}
+
+}
+
+ssize_t send_frame(int fd, char const * data, ssize_t length) {
+    static_assert(sizeof(ssize_t) == 8, "MUSCLE3 needs a 64-bit machine/OS to compile");
+
+    // Scatter-gather send of the length header and the payload, so we
+    // don't have to assemble them into a contiguous buffer first. That
+    // copy is significant for large payloads, e.g. grids.
+    iovec iov[2];
+    iov[0].iov_base = &length;
+    iov[0].iov_len = 8u;
+    iov[1].iov_base = const_cast<char *>(data);
+    iov[1].iov_len = length;
+
+    if (send_iovs_(fd, iov, 2u, length + 8) == -1)
+        return -1;
+    return length;
+}
+
+ssize_t send_frame_crc(int fd, char const * data, ssize_t length) {
+    int64_t crc = crc32c(0u, data, length);
+
+    iovec iov[3];
+    iov[0].iov_base = &length;
+    iov[0].iov_len = 8u;
+    iov[1].iov_base = const_cast<char *>(data);
+    iov[1].iov_len = length;
+    iov[2].iov_base = &crc;
+    iov[2].iov_len = 8u;
+
+    if (send_iovs_(fd, iov, 3u, length + 16) == -1)
+        return -1;
     return length;
 }
 
+void tune_tcp_socket(int fd) {
+    static int const no_delay = []() {
+            char const * env = getenv("MUSCLE_TCP_NODELAY");
+            return ((env == nullptr) || (strcmp(env, "0") != 0)) ? 1 : 0;
+            }();
+
+    int flags = no_delay;
+    setsockopt(fd, SOL_TCP, TCP_NODELAY, &flags, sizeof(flags));
+    setsockopt(fd, SOL_TCP, TCP_QUICKACK, &flags, sizeof(flags));
+}
+
+void size_tcp_buffers(int fd) {
+    static int const bufsize = []() {
+            char const * env = getenv("MUSCLE_TCP_BUFSIZE");
+            return (env != nullptr) ? atoi(env) : 0;
+            }();
+    if (bufsize <= 0)
+        return;
+
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &bufsize, sizeof(bufsize));
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bufsize, sizeof(bufsize));
+}
+
+void enable_keepalive(int fd) {
+    static int const enabled = []() {
+            char const * env = getenv("MUSCLE_TCP_KEEPALIVE");
+            return ((env == nullptr) || (strcmp(env, "0") != 0)) ? 1 : 0;
+            }();
+    if (!enabled)
+        return;
+
+    // probe after 30 s of idleness, every 10 s, give up after 3 misses
+    int flag = 1;
+    int idle = 30;
+    int interval = 10;
+    int max_probes = 3;
+    setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &flag, sizeof(flag));
+    setsockopt(fd, SOL_TCP, TCP_KEEPIDLE, &idle, sizeof(idle));
+    setsockopt(fd, SOL_TCP, TCP_KEEPINTVL, &interval, sizeof(interval));
+    setsockopt(fd, SOL_TCP, TCP_KEEPCNT, &max_probes, sizeof(max_probes));
+
+    // give up on unacknowledged outgoing data on the same deadline
+    unsigned int user_timeout = (idle + interval * max_probes) * 1000u;
+    setsockopt(
+            fd, SOL_TCP, TCP_USER_TIMEOUT,
+            &user_timeout, sizeof(user_timeout));
+}
+
+std::uint64_t tcp_rtt_us(int fd) {
+    tcp_info info;
+    socklen_t info_len = sizeof(info);
+    if (getsockopt(fd, SOL_TCP, TCP_INFO, &info, &info_len) != 0)
+        return 0u;
+    return info.tcpi_rtt;
+}
+
+void set_cork(int fd, bool cork) {
+    int flags = cork ? 1 : 0;
+    setsockopt(fd, SOL_TCP, TCP_CORK, &flags, sizeof(flags));
+}
+
+namespace {
+
+#ifdef __x86_64__
+
+/* CRC32C over the buffer using the SSE4.2 crc32 instruction.
+ *
+ * Compiled for SSE4.2 regardless of the build flags; only called when
+ * the CPU supports it, see crc32c() below.
+ */
+__attribute__((target("sse4.2")))
+std::uint32_t crc32c_hw_(
+        std::uint32_t crc, char const * data, std::size_t length) {
+    std::uint64_t crc64 = crc;
+    while (length >= 8u) {
+        std::uint64_t word;
+        memcpy(&word, data, 8u);
+        crc64 = __builtin_ia32_crc32di(crc64, word);
+        data += 8u;
+        length -= 8u;
+    }
+    std::uint32_t crc32 = static_cast<std::uint32_t>(crc64);
+    while (length > 0u) {
+        crc32 = __builtin_ia32_crc32qi(
+                crc32, static_cast<unsigned char>(*data));
+        ++data;
+        --length;
+    }
+    return crc32;
+}
+
+#endif
+
+/* Table-driven CRC32C fallback for CPUs without the instruction.
+ */
+std::uint32_t crc32c_sw_(
+        std::uint32_t crc, char const * data, std::size_t length) {
+    static std::uint32_t const * const table = []() {
+            static std::uint32_t entries[256];
+            for (std::uint32_t i = 0u; i < 256u; ++i) {
+                std::uint32_t entry = i;
+                for (int bit = 0; bit < 8; ++bit)
+                    entry = (entry & 1u)
+                        ? (entry >> 1) ^ 0x82F63B78u : entry >> 1;
+                entries[i] = entry;
+            }
+            return entries;
+            }();
+
+    for (std::size_t i = 0u; i < length; ++i)
+        crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xFFu]
+                ^ (crc >> 8);
+    return crc;
+}
+
+}
+
+std::uint32_t crc32c(std::uint32_t crc, char const * data, std::size_t length) {
+    // inverting on the way in and out makes chained calls compose, so
+    // that checksumming a payload chunk by chunk gives the same result
+    // as checksumming it whole
+    crc = ~crc;
+#ifdef __x86_64__
+    static bool const have_sse42 = __builtin_cpu_supports("sse4.2");
+    if (have_sse42)
+        return ~crc32c_hw_(crc, data, length);
+#endif
+    return ~crc32c_sw_(crc, data, length);
+}
+
+void wait_for_data(int fd, double timeout) {
+    auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration<double>(timeout);
+
+    while (true) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+
+        pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        int remaining_ms =
+                (remaining.count() > 0) ? static_cast<int>(remaining.count()) : 0;
+        int err = poll(&pfd, 1u, remaining_ms);
+        if (err > 0)
+            return;
+        if (err == 0) {
+            std::ostringstream oss;
+            oss << "No data received within " << timeout << " seconds";
+            throw ReceiveTimeoutError(oss.str());
+        }
+        if (errno != EINTR)
+            throw std::runtime_error("Error polling a socket");
+        // interrupted by a signal, poll again for the remaining time
+    }
+}
+
 } } }
 
@@ -1,10 +1,42 @@
 #pragma once
 
+#include <cstdint>
+
 #include <sys/types.h>
 
 
 namespace libmuscle { namespace impl { namespace mcp {
 
+/* Frame-length magic values for the striped transfer extension.
+ *
+ * Frame lengths are never negative, so negative values in the length
+ * position are free to carry in-band signals. A control frame
+ * (client to server) announces a striping channel: the magic is
+ * followed by an int64 channel id and an int64 stripe index, -1 on a
+ * channel's main connection. A striped frame header (server to
+ * client) replaces a response's length prefix: the magic is followed
+ * by the total length, the chunk size and the number of stripe
+ * connections used, and the payload follows in sequence-numbered
+ * chunks round robin over the main connection and the stripes. See
+ * TcpTransportClient and SocketServerWorker.
+ */
+int64_t const control_frame_magic = -1;
+int64_t const striped_frame_magic = -2;
+
+/* Frame-length magic value for the integrity extension.
+ *
+ * A client that wants checksummed frames sends a single int64 with
+ * this magic right after connecting. From then on, every request and
+ * response frame on the connection is followed by an int64 holding the
+ * CRC32C of its payload; for a striped response it covers the
+ * reassembled payload and follows the final chunk on the main
+ * connection. Control frames are not checksummed. The receiving side
+ * verifies each checksum: the client throws on a mismatch, the server
+ * drops the connection, so corruption fails the run instead of
+ * silently feeding the model bad data. See TcpTransportClient.
+ */
+int64_t const integrity_frame_magic = -3;
+
 /* Send a message on a socket.
  *
  * This calls send() as often as needed to send the whole message.
@@ -39,8 +71,119 @@ void send_int64(int fd, int64_t data);
 int64_t recv_int64(int fd);
 
 /* Send a message on a socket, prefixed by its length.
+ *
+ * This uses a scatter-gather send, so the length and the payload go
+ * out together without being copied into a contiguous buffer first.
  */
 ssize_t send_frame(int fd, char const * data, ssize_t length);
 
+/* Send a length-prefixed message followed by its CRC32C.
+ *
+ * Like send_frame(), but with an int64 holding the payload's CRC32C
+ * appended, still in a single scatter-gather send. Used on connections
+ * in integrity mode, see integrity_frame_magic above.
+ */
+ssize_t send_frame_crc(int fd, char const * data, ssize_t length);
+
+/* Computes the CRC32C (Castagnoli) checksum of a buffer.
+ *
+ * Uses the SSE4.2 crc32 instruction where the CPU has it, which makes
+ * checksumming far cheaper than a scalar implementation in model code;
+ * elsewhere a table-driven fallback is used.
+ *
+ * The checksum of a buffer processed in pieces equals that of the
+ * whole, so large payloads can be checksummed incrementally as their
+ * chunks go out.
+ *
+ * @param crc The checksum so far, 0 to start a new one.
+ * @param data The buffer to checksum.
+ * @param length The length of the buffer in bytes.
+ * @return The updated checksum.
+ */
+std::uint32_t crc32c(std::uint32_t crc, char const * data, std::size_t length);
+
+/* Applies the latency policy to a connected TCP socket.
+ *
+ * This enables TCP_NODELAY and TCP_QUICKACK, so that small messages go
+ * out (and get acknowledged) immediately rather than being held back by
+ * Nagle's algorithm, whose interaction with delayed ACKs causes tens of
+ * milliseconds of latency per message. Since each frame is sent with a
+ * single scatter-gather call, there are no partial writes for Nagle to
+ * usefully coalesce; bursts of frames are coalesced explicitly, see
+ * set_cork(). Set MUSCLE_TCP_NODELAY=0 in the environment to get the
+ * kernel's default behaviour back.
+ *
+ * @param fd The socket to tune.
+ */
+void tune_tcp_socket(int fd);
+
+/* Enables keepalive probing on a connected TCP socket.
+ *
+ * Without this, a peer that dies without closing its connection is only
+ * discovered when TCP retransmission gives up, which can take hours on
+ * an idle connection. With it, the kernel probes an idle connection and
+ * resets it after about a minute of silence from a dead peer, so a
+ * blocked receive fails quickly and the instance can report the problem
+ * instead of wasting node-hours. Unacknowledged outgoing data is
+ * bounded by the same deadline (TCP_USER_TIMEOUT), so sends to a dead
+ * peer fail quickly too. Set MUSCLE_TCP_KEEPALIVE=0 in the environment
+ * to get the kernel's default behaviour back.
+ *
+ * @param fd The socket to enable keepalive on.
+ */
+void enable_keepalive(int fd);
+
+/* Sizes a socket's buffers for bulk transfer on a fast fabric.
+ *
+ * Sustained single-stream TCP throughput is limited to the socket
+ * buffer size divided by the round-trip time. The kernel autotunes the
+ * buffers, but its ceiling is often far below the bandwidth-delay
+ * product of a fast fabric such as TCP over IPoIB, which caps
+ * multi-gigabyte state transfers at a fraction of link rate. Set
+ * MUSCLE_TCP_BUFSIZE to a number of bytes to request that much send
+ * and receive buffer instead; unset, the kernel's autotuning is left
+ * alone. Call this before connect() or listen(), since the window
+ * scale is negotiated when the connection is set up; accepted sockets
+ * inherit the listening socket's sizes.
+ *
+ * @param fd The socket to size the buffers of.
+ */
+void size_tcp_buffers(int fd);
+
+/* Returns the kernel's smoothed round-trip time estimate for a socket.
+ *
+ * This is TCP's own RTT estimator, maintained for free as data and
+ * ACKs flow, so sampling it costs one getsockopt() and no traffic.
+ *
+ * @param fd The socket to sample.
+ * @return The estimated round-trip time in microseconds, or 0 if it
+ *      could not be obtained (e.g. on a UNIX domain socket).
+ */
+std::uint64_t tcp_rtt_us(int fd);
+
+/* Sets or clears TCP_CORK on a socket.
+ *
+ * While corked, the kernel combines successive sends into full-sized
+ * segments rather than sending each one as its own packet; clearing the
+ * cork flushes whatever is left. Use this around a burst of small
+ * frames to the same destination. Corking does nothing if the transfer
+ * is not over TCP (e.g. a UNIX domain socket); such calls are silently
+ * ignored.
+ *
+ * @param fd The socket to (un)cork.
+ * @param cork Whether to cork (true) or uncork (false).
+ */
+void set_cork(int fd, bool cork);
+
+/* Wait until there is data to read on a socket.
+ *
+ * This polls the socket until data arrives, or throws a
+ * ReceiveTimeoutError if nothing has arrived after timeout seconds.
+ *
+ * @param fd The socket to wait on.
+ * @param timeout Time to wait in seconds.
+ */
+void wait_for_data(int fd, double timeout);
+
 } } }
 
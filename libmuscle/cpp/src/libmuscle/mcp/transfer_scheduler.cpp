@@ -0,0 +1,80 @@
+#include "libmuscle/mcp/transfer_scheduler.hpp"
+
+#include <algorithm>
+
+
+namespace {
+
+using std::chrono::steady_clock;
+
+double seconds_since(
+        steady_clock::time_point from, steady_clock::time_point to)
+{
+    return std::chrono::duration<double>(to - from).count();
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+TransferScheduler & TransferScheduler::get() {
+    // Deliberately leaked, like the worker pool, so that it outlives
+    // any server held in a static variable by user code.
+    static TransferScheduler & scheduler = *new TransferScheduler();
+    return scheduler;
+}
+
+void TransferScheduler::configure(
+        double bytes_per_sec, double stagger, double offset_fraction)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    rate_ = bytes_per_sec;
+    stagger_ = stagger;
+    offset_ = std::max(stagger, 0.0) * offset_fraction;
+    // start with a burst allowance, so that a short transfer is not
+    // held up by an empty bucket
+    tokens_ = std::max(rate_, 0.0) * 0.1;
+    last_refill_ = steady_clock::now();
+}
+
+bool TransferScheduler::try_acquire(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (rate_ <= 0.0)
+        return true;
+
+    auto now = steady_clock::now();
+    tokens_ += rate_ * seconds_since(last_refill_, now);
+    last_refill_ = now;
+    // Allow a burst of up to a tenth of a second, so that the cap
+    // holds on average without slowing short transfers down. A chunk
+    // larger than that allowance must still be able to accumulate
+    // enough tokens, or it would wait forever.
+    tokens_ = std::min(
+            tokens_,
+            std::max(rate_ * 0.1, static_cast<double>(bytes)));
+
+    if (tokens_ < static_cast<double>(bytes))
+        return false;
+    tokens_ -= static_cast<double>(bytes);
+    return true;
+}
+
+std::chrono::steady_clock::time_point TransferScheduler::bulk_start_time() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = steady_clock::now();
+    if (stagger_ <= 0.0)
+        return now;
+    if (seconds_since(last_bulk_done_, now) < stagger_)
+        // we're mid-stream, follow on immediately
+        return now;
+    return now + std::chrono::duration_cast<steady_clock::duration>(
+            std::chrono::duration<double>(offset_));
+}
+
+void TransferScheduler::bulk_done() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_bulk_done_ = steady_clock::now();
+}
+
+} } }
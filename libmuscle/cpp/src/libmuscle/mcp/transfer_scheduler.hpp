@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** Paces outgoing bulk transfers, smoothing incast bursts.
+ *
+ * When many instances finish at the same time and their peers all pull
+ * the results at once, the flows collide in the receivers' switch
+ * ports and effective throughput drops well below what the links could
+ * carry. This scheduler shapes the server side of the transfers: a
+ * token bucket caps the rate at which bulk response chunks go out, and
+ * a bulk transfer that starts a new burst, rather than following on
+ * from a previous one, is delayed by a per-instance offset, spreading
+ * the first wave of transfers out over a window.
+ *
+ * Both mechanisms are off by default and are switched on with the
+ * muscle_transfer_rate and muscle_transfer_stagger settings, which the
+ * manager distributes to every instance; see Instance. There is one
+ * scheduler per process, shared by all the workers serving its
+ * connections, see SocketServerWorker.
+ *
+ * Operations are synchronised internally, so it's thread-safe.
+ */
+class TransferScheduler {
+    public:
+        /** Returns the scheduler for this process.
+         */
+        static TransferScheduler & get();
+
+        /** Configures the scheduler.
+         *
+         * @param bytes_per_sec Cap on the rate at which bulk chunks are
+         *      sent, in bytes per second; 0 or less disables the cap.
+         * @param stagger Length of the window over which the starts of
+         *      a burst of transfers are spread, in seconds; 0 or less
+         *      disables staggering.
+         * @param offset_fraction This instance's position within the
+         *      window, between 0 and 1.
+         */
+        void configure(
+                double bytes_per_sec, double stagger,
+                double offset_fraction);
+
+        /** Takes the given number of bytes from the token bucket.
+         *
+         * @param bytes The size of the chunk about to be sent.
+         * @return true if the send may go ahead now, false if it must
+         *      wait for the bucket to refill.
+         */
+        bool try_acquire(std::size_t bytes);
+
+        /** Returns the time before which a new bulk transfer may not
+         * start.
+         *
+         * A transfer that follows within the window of a previous one
+         * is part of an ongoing stream and may start immediately; only
+         * a transfer that starts a new burst is staggered.
+         */
+        std::chrono::steady_clock::time_point bulk_start_time();
+
+        /** Notes that a bulk transfer completed, see bulk_start_time().
+         */
+        void bulk_done();
+
+    private:
+        TransferScheduler() = default;
+
+        std::mutex mutex_;
+        double rate_ = 0.0;             // bytes per second, 0 is off
+        double stagger_ = 0.0;          // window length in seconds
+        double offset_ = 0.0;           // our offset into the window
+        double tokens_ = 0.0;
+        std::chrono::steady_clock::time_point last_refill_;
+        std::chrono::steady_clock::time_point last_bulk_done_;
+};
+
+} } }
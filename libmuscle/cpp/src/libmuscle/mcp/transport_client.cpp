@@ -1,5 +1,8 @@
 #include <libmuscle/mcp/transport_client.hpp>
 
+#include <cstring>
+#include <stdexcept>
+
 
 namespace libmuscle { namespace impl {
 
@@ -11,6 +14,48 @@ bool TransportClient::can_connect_to(std::string const & location) {
 
 TransportClient::~TransportClient() {}
 
+bool TransportClient::returns_shared_buffers() const {
+    return false;
+}
+
+DataConstRef TransportClient::call(
+        char const * req_buf, std::size_t req_len,
+        RecvBufferAllocator const & recv_buf) const {
+    DataConstRef response = call(req_buf, req_len);
+    char * buf = recv_buf(response.size());
+    memcpy(buf, response.as_byte_array(), response.size());
+    return Data::byte_array(buf, response.size());
+}
+
+void TransportClient::send_request(
+        char const * req_buf, std::size_t req_len) const {
+    throw std::runtime_error(
+            "This transport does not support pipelined requests");
+}
+
+DataConstRef TransportClient::get_response() const {
+    throw std::runtime_error(
+            "This transport does not support pipelined requests");
+}
+
+DataConstRef TransportClient::get_response(
+        RecvBufferAllocator const & recv_buf) const {
+    throw std::runtime_error(
+            "This transport does not support pipelined requests");
+}
+
+bool TransportClient::response_started() const {
+    return true;
+}
+
+int TransportClient::poll_fd() const {
+    return -1;
+}
+
+void TransportClient::set_receive_timeout(Optional<double> const & timeout) {
+    receive_timeout_ = timeout;
+}
+
 }   // namespace mcp
 
 } }   // namespace libmuscle::impl
@@ -1,13 +1,22 @@
 #pragma once
 
 #include "libmuscle/data.hpp"
+#include "libmuscle/util.hpp"
 
+#include <functional>
 #include <string>
 #include <vector>
 
 
 namespace libmuscle { namespace impl { namespace mcp {
 
+/** Provides a buffer to receive a response into.
+ *
+ * Called with the length of the response in bytes, and must return a
+ * pointer to a buffer of at least that size. See TransportClient::call.
+ */
+using RecvBufferAllocator = std::function<char * (std::size_t length)>;
+
 /** A client that connects to an MCP transport server.
  *
  * This is a base class for MCP Transport Clients. An MCP Transport Client
@@ -48,6 +57,18 @@ class TransportClient {
          */
         virtual ~TransportClient() = 0;
 
+        /** Whether responses are returned as shared buffers.
+         *
+         * If true, then the plain call() and get_response() overloads
+         * return responses that refer to a buffer shared with the
+         * sender, without any copy having been made; receiving into a
+         * caller-supplied buffer then only adds a copy. The MPPClient
+         * skips its receive buffer pool for such transports.
+         *
+         * @return true iff responses refer to shared buffers.
+         */
+        virtual bool returns_shared_buffers() const;
+
         /** Send a request to the server and receive the response.
          *
          * This is a blocking call.
@@ -61,12 +82,123 @@ class TransportClient {
         virtual DataConstRef call(
                 char const * req_buf, std::size_t req_len) const = 0;
 
+        /** Send a request and receive the response into a given buffer.
+         *
+         * This is a blocking call. Once the length of the response is
+         * known, recv_buf is called with it, and the response is then
+         * received directly into the buffer it returns, without any
+         * further copies inside libmuscle. The caller must keep the
+         * buffer valid and unchanged for as long as the returned object
+         * or any copy of it is in use, and is responsible for freeing it.
+         *
+         * The default implementation receives as call() does and then
+         * copies; transports should override it if they can do better.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len,
+                RecvBufferAllocator const & recv_buf) const;
+
+        /** Send a request without waiting for the response.
+         *
+         * This may be called several times in a row to pipeline multiple
+         * outstanding requests onto the connection, overlapping their
+         * round-trip latencies. The server answers the requests on a
+         * connection in the order in which they were sent, so responses
+         * are matched to requests positionally: each get_response() call
+         * returns the response to the oldest outstanding request.
+         *
+         * The default implementation throws; transports that support
+         * pipelining override it together with get_response().
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         */
+        virtual void send_request(
+                char const * req_buf, std::size_t req_len) const;
+
+        /** Receive the response to the oldest outstanding request.
+         *
+         * This is a blocking call. There must be an outstanding request,
+         * sent via send_request().
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef get_response() const;
+
+        /** Receive the oldest outstanding response into a given buffer.
+         *
+         * As get_response(), but the response is received directly into
+         * the buffer provided by recv_buf, see call() for the contract.
+         *
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef get_response(
+                RecvBufferAllocator const & recv_buf) const;
+
+        /** Returns whether the oldest outstanding response has started
+         * to arrive.
+         *
+         * This does not block. If it returns true, then get_response()
+         * completes after at most the time it takes the rest of the
+         * response to come in, rather than waiting for the peer to
+         * send one. Transports that cannot check report true, so that
+         * a caller polling several connections falls back to blocking
+         * on them; the socket and shared memory transports implement a
+         * real check.
+         *
+         * There must be an outstanding request, sent via send_request().
+         *
+         * @return true if the response has started to arrive, or if
+         *      this transport cannot tell.
+         */
+        virtual bool response_started() const;
+
+        /** Returns a file descriptor that signals incoming responses.
+         *
+         * The returned fd becomes readable when a response (or part of
+         * one) arrives, so a caller waiting on several connections can
+         * put the fds of all of them in one poll set. A readable fd
+         * does not guarantee that response_started() is true for any
+         * particular request; re-check after waking up. Transports
+         * without a pollable fd return -1.
+         *
+         * @return A pollable file descriptor, or -1 if there is none.
+         */
+        virtual int poll_fd() const;
+
+        /** Sets a timeout on receiving responses.
+         *
+         * If set, then get_response() (and so call()) throws a
+         * ReceiveTimeoutError if the response has not started arriving
+         * within the given number of seconds. Transports that cannot
+         * poll for incoming data ignore the timeout and block as
+         * before; the socket-based transports honour it.
+         *
+         * @param timeout Timeout in seconds, or unset for no timeout.
+         */
+        void set_receive_timeout(Optional<double> const & timeout);
+
         /** Closes this client.
          *
          * This closes any connections this client has and/or performs other
          * shutdown activities.
          */
         virtual void close() = 0;
+
+    protected:
+        // timeout on receiving responses, see set_receive_timeout()
+        Optional<double> receive_timeout_;
 };
 
 } } }
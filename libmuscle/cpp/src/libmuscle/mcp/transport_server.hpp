@@ -29,9 +29,10 @@ class RequestHandler {
          * and return -1.
          *
          * In the second case, res_buf is unmodified, and a file descriptor is
-         * returned. When the response is available, a single byte can and must
-         * be read from this file descriptor, and get_response must be called to
-         * pick up the response.
+         * returned. When the response is available, the file descriptor
+         * becomes readable; it is an eventfd, so an 8-byte count can and
+         * must be read from it, and get_response must be called to pick
+         * up the response.
          *
          * @param req_buf Pointer to request bytes
          * @param req_len Number of bytes in request
@@ -45,8 +46,9 @@ class RequestHandler {
          *
          * This function must be called only when a previous call to
          * handle_request returned a file descriptor. When this file descriptor
-         * becomes ready, read a byte from it and call this function, passing the
-         * file descriptor. The response will then be written into res_buf.
+         * becomes ready, read the 8-byte eventfd count from it and call this
+         * function, passing the file descriptor. The response will then be
+         * written into res_buf.
          *
          * @param fd File descriptor to return
          * @return A byte array wrapped in a DataConstRef with the response
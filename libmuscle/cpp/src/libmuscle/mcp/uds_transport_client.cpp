@@ -0,0 +1,151 @@
+#include "libmuscle/mcp/uds_transport_client.hpp"
+
+#include "libmuscle/data.hpp"
+#include "libmuscle/mcp/tcp_util.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+
+namespace {
+
+/* Splits a location string of the form uds:<hostname><socket path>
+ * into its hostname and socket path.
+ */
+void split_location(
+        std::string const & location,
+        std::string & hostname, std::string & socket_path)
+{
+    // start at 4 to skip the initial uds: bit
+    std::size_t slash = location.find('/', 4u);
+    if (slash == std::string::npos)
+        throw std::runtime_error("Invalid uds location " + location);
+    hostname = location.substr(4u, slash - 4u);
+    socket_path = location.substr(slash);
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+bool UdsTransportClient::can_connect_to(std::string const & location) {
+    if (location.compare(0u, 4u, "uds:") != 0)
+        return false;
+
+    // UNIX domain sockets only reach peers on the same host
+    char buf[256];
+    if (gethostname(buf, sizeof(buf)) != 0)
+        return false;
+    buf[sizeof(buf) - 1] = '\0';
+
+    std::string hostname, socket_path;
+    try {
+        split_location(location, hostname, socket_path);
+    }
+    catch (std::runtime_error const &) {
+        return false;
+    }
+    return hostname == buf;
+}
+
+UdsTransportClient::UdsTransportClient(std::string const & location)
+    : socket_fd_(-1)
+{
+    std::string hostname, socket_path;
+    split_location(location, hostname, socket_path);
+
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path))
+        throw std::runtime_error("Socket path " + socket_path + " too long");
+    strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    socket_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket_fd_ == -1)
+        throw std::runtime_error("Failed to create UNIX domain socket");
+
+    if (connect(
+            socket_fd_, reinterpret_cast<sockaddr*>(&addr),
+            sizeof(addr)) == -1)
+    {
+        ::close(socket_fd_);
+        socket_fd_ = -1;
+        throw std::runtime_error("Could not connect to server at " + location);
+    }
+}
+
+UdsTransportClient::~UdsTransportClient() {
+    if (socket_fd_ != -1)
+        close();
+}
+
+DataConstRef UdsTransportClient::call(
+        char const * req_buf, std::size_t req_len
+) const {
+    send_request(req_buf, req_len);
+    return get_response();
+}
+
+DataConstRef UdsTransportClient::call(
+        char const * req_buf, std::size_t req_len,
+        RecvBufferAllocator const & recv_buf
+) const {
+    send_request(req_buf, req_len);
+    return get_response(recv_buf);
+}
+
+void UdsTransportClient::send_request(
+        char const * req_buf, std::size_t req_len
+) const {
+    send_frame(socket_fd_, req_buf, req_len);
+}
+
+DataConstRef UdsTransportClient::get_response() const {
+    if (receive_timeout_.is_set() && !reader_.has_buffered_data())
+        wait_for_data(socket_fd_, receive_timeout_.get());
+    int64_t length = reader_.read_int64(socket_fd_);
+    auto result = Data::byte_array(length);
+    reader_.read_all(socket_fd_, result.as_byte_array(), result.size());
+    return result;
+}
+
+DataConstRef UdsTransportClient::get_response(
+        RecvBufferAllocator const & recv_buf
+) const {
+    if (receive_timeout_.is_set() && !reader_.has_buffered_data())
+        wait_for_data(socket_fd_, receive_timeout_.get());
+    int64_t length = reader_.read_int64(socket_fd_);
+    char * buf = recv_buf(length);
+    reader_.read_all(socket_fd_, buf, length);
+    return Data::byte_array(buf, length);
+}
+
+bool UdsTransportClient::response_started() const {
+    if (reader_.has_buffered_data())
+        return true;
+    pollfd pfd;
+    pfd.fd = socket_fd_;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1u, 0) > 0;
+}
+
+int UdsTransportClient::poll_fd() const {
+    return socket_fd_;
+}
+
+void UdsTransportClient::close() {
+    ::close(socket_fd_);
+    socket_fd_ = -1;
+}
+
+} } }
+
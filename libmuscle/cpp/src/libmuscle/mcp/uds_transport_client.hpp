@@ -0,0 +1,126 @@
+#pragma once
+
+#ifdef LIBMUSCLE_MOCK_MCP_UDS_TRANSPORT_CLIENT
+#include LIBMUSCLE_MOCK_MCP_UDS_TRANSPORT_CLIENT
+#else
+
+#include "libmuscle/mcp/frame_reader.hpp"
+#include "libmuscle/mcp/transport_client.hpp"
+#include "libmuscle/data.hpp"
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A client that connects to a UdsTransport server.
+ *
+ * This only works if the server is on the same host; can_connect_to()
+ * checks that. It uses the same wire format as the TCP transport, but
+ * over a UNIX domain socket, which has lower latency than loopback TCP.
+ */
+class UdsTransportClient : public TransportClient {
+    public:
+        /** Whether this client class can connect to the given location.
+         *
+         * @param location The location to potentially connect to.
+         *
+         * @return true iff this class can connect to this location.
+         */
+        static bool can_connect_to(std::string const & location);
+
+        /** Create an MCP Transport Client for a given location.
+         *
+         * The client will connect to this location and be able to send
+         * requests to it.
+         *
+         * @param location A location string to connect to.
+         */
+        UdsTransportClient(std::string const & location);
+
+        /** Destruct the UdsTransportClient.
+         */
+        virtual ~UdsTransportClient() override;
+
+        /** Send a request to the server and receive the response.
+         *
+         * This is a blocking call.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Send a request and receive the response into a given buffer.
+         *
+         * This is a blocking call. The response is received from the
+         * socket directly into the buffer provided by recv_buf, see
+         * TransportClient::call for the contract.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len,
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Send a request without waiting for the response.
+         *
+         * Requests may be pipelined; see TransportClient::send_request.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         */
+        virtual void send_request(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Receive the response to the oldest outstanding request.
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef get_response() const override;
+
+        /** Receive the oldest outstanding response into a given buffer.
+         *
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef get_response(
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Returns whether the oldest outstanding response has started
+         * to arrive, without blocking.
+         */
+        virtual bool response_started() const override;
+
+        /** Returns the connection's socket, which is pollable.
+         */
+        virtual int poll_fd() const override;
+
+        /** Closes this client.
+         *
+         * This closes any connections this client has and/or performs other
+         * shutdown activities.
+         */
+        virtual void close() override;
+
+    private:
+        int socket_fd_;
+        // read-ahead for responses; mutable because receiving doesn't
+        // change the client's observable state
+        mutable FrameReader reader_;
+};
+
+} } }
+
+#endif
+
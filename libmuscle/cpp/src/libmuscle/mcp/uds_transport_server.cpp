@@ -0,0 +1,134 @@
+#include "libmuscle/mcp/uds_transport_server.hpp"
+
+#include "libmuscle/mcp/socket_server_worker.hpp"
+#include "libmuscle/mcp/transport_server.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+
+using libmuscle::impl::mcp::RequestHandler;
+using libmuscle::impl::mcp::SocketWorkerPool;
+
+
+namespace {
+
+std::string get_hostname_() {
+    char buf[256];
+    if (gethostname(buf, sizeof(buf)) != 0)
+        throw std::runtime_error("Could not get hostname");
+    buf[sizeof(buf) - 1] = '\0';
+    return std::string(buf);
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+UdsTransportServer::UdsTransportServer(RequestHandler & handler)
+    : TransportServer(handler)
+{
+    // Unlike the TCP server, we can bind before starting the server
+    // thread, so the location is known as soon as we're constructed.
+    socket_fd_ = set_up_socket_();
+    location_ = "uds:" + get_hostname_() + socket_path_;
+
+    pipe(control_pipe_);
+    thread_ = std::thread(server_thread_, this);
+}
+
+UdsTransportServer::~UdsTransportServer() {
+    if (thread_.joinable())
+        close();
+}
+
+std::string UdsTransportServer::get_location() const {
+    return location_;
+}
+
+void UdsTransportServer::close() {
+    char dummy = 0;
+    ::write(control_pipe_[1], &dummy, 1);
+    thread_.join();
+    unlink(socket_path_.c_str());
+}
+
+int UdsTransportServer::set_up_socket_() {
+    const int backlog = 10;
+
+    // Unlike a TCP port number, socket paths are not handed out by the
+    // OS, so we pick a unique one ourselves from the pid and a sequence
+    // number for the servers within this process.
+    static std::atomic<int> next_seq(0);
+    socket_path_ = "/tmp/muscle3-" + std::to_string(getpid())
+            + "-" + std::to_string(next_seq++) + ".sock";
+
+    int sockfd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sockfd == -1)
+        throw std::runtime_error("Failed to create UNIX domain socket");
+
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path_.size() >= sizeof(addr.sun_path)) {
+        ::close(sockfd);
+        throw std::runtime_error("Socket path " + socket_path_ + " too long");
+    }
+    strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
+
+    if (bind(sockfd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1) {
+        ::close(sockfd);
+        throw std::runtime_error(
+                "Failed to bind UNIX domain socket to " + socket_path_);
+    }
+
+    if (listen(sockfd, backlog) == -1) {
+        ::close(sockfd);
+        throw std::runtime_error(
+                "Failed to listen on UNIX domain socket " + socket_path_);
+    }
+
+    return sockfd;
+}
+
+void UdsTransportServer::server_thread_(UdsTransportServer * self) {
+    SocketWorkerPool & pool = SocketWorkerPool::get();
+    pool.acquire();
+    int socket_fd = self->socket_fd_;
+
+    while (true) {
+        // poll on control pipe and socket
+        std::vector<pollfd> poll_fds(2u);
+        poll_fds[0].fd = self->control_pipe_[0];
+        poll_fds[0].events = POLLIN;
+        poll_fds[1].fd = socket_fd;
+        poll_fds[1].events = POLLIN;
+
+        poll(poll_fds.data(), poll_fds.size(), -1);
+
+        if (poll_fds[0].revents & POLLIN) {
+            char dummy;
+            read(poll_fds[0].fd, &dummy, 1);
+            break;
+        }
+
+        if (poll_fds[1].revents & POLLIN) {
+            int new_fd = accept(poll_fds[1].fd, nullptr, nullptr);
+            pool.add_connection(new_fd, self->handler_);
+        }
+    }
+
+    ::close(socket_fd);
+    pool.release();
+}
+
+} } }
+
@@ -0,0 +1,65 @@
+#pragma once
+
+#ifdef LIBMUSCLE_MOCK_MCP_UDS_TRANSPORT_SERVER
+#include LIBMUSCLE_MOCK_MCP_UDS_TRANSPORT_SERVER
+#else
+
+#include <libmuscle/mcp/transport_server.hpp>
+
+#include <string>
+#include <thread>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A server that accepts UNIX domain socket connections.
+ *
+ * UNIX domain sockets only reach clients on the same host, but for
+ * those they have noticeably lower per-message latency than loopback
+ * TCP. The wire format is the same as for the TCP transport; clients
+ * on other hosts fall back to TCP.
+ *
+ * Connections are served by the process-wide SocketWorkerPool, shared
+ * with the other transport servers in the process.
+ */
+class UdsTransportServer : public TransportServer {
+    public:
+        /** Create a UdsTransportServer.
+         *
+         * @param handler A handler to handle requests
+         */
+        UdsTransportServer(RequestHandler & handler);
+
+        /** Closes the server if it wasn't already closed.
+         */
+        ~UdsTransportServer();
+
+        /** Returns the location this server listens on.
+         *
+         * @return A string of the form uds:<hostname><socket path>.
+         */
+        virtual std::string get_location() const;
+
+        /** Closes this server.
+         *
+         * Stops the server listening, waits for existing clients to
+         * disconnect, then removes the socket file.
+         */
+        virtual void close();
+
+    private:
+        int set_up_socket_();
+
+        static void server_thread_(UdsTransportServer * self);
+
+        int control_pipe_[2];
+        int socket_fd_;
+        std::thread thread_;
+        std::string socket_path_;
+        std::string location_;
+};
+
+} } }
+
+#endif
+
@@ -0,0 +1,140 @@
+#include "libmuscle/mcp/virtual_transport_client.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+
+namespace {
+
+/* Splits a virtual:<latency_ns>:<bandwidth>:<pid>/<id> location.
+ *
+ * Throws a std::runtime_error if the location is not a virtual one.
+ */
+void split_location_(
+        std::string const & location, std::string & latency,
+        std::string & bandwidth, std::string & direct_location
+) {
+    if (location.compare(0u, 8u, "virtual:") != 0)
+        throw std::runtime_error("Not a virtual location: " + location);
+    std::size_t split1 = location.find(':', 8u);
+    std::size_t split2 = (split1 == std::string::npos)
+            ? std::string::npos : location.find(':', split1 + 1u);
+    if (split2 == std::string::npos)
+        throw std::runtime_error("Invalid virtual location: " + location);
+    latency = location.substr(8u, split1 - 8u);
+    bandwidth = location.substr(split1 + 1u, split2 - split1 - 1u);
+    direct_location = "direct:" + location.substr(split2 + 1u);
+}
+
+std::string direct_location_(std::string const & location) {
+    std::string latency, bandwidth, direct_location;
+    split_location_(location, latency, bandwidth, direct_location);
+    return direct_location;
+}
+
+std::uint64_t location_latency_ns_(std::string const & location) {
+    std::string latency, bandwidth, direct_location;
+    split_location_(location, latency, bandwidth, direct_location);
+    return std::stoull(latency);
+}
+
+std::uint64_t location_bandwidth_(std::string const & location) {
+    std::string latency, bandwidth, direct_location;
+    split_location_(location, latency, bandwidth, direct_location);
+    return std::stoull(bandwidth);
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+bool VirtualTransportClient::can_connect_to(std::string const & location) {
+    try {
+        return DirectTransportClient::can_connect_to(
+                direct_location_(location));
+    }
+    catch (std::exception const &) {
+        return false;
+    }
+}
+
+VirtualTransportClient::VirtualTransportClient(std::string const & location)
+    : inner_(direct_location_(location))
+    , latency_(location_latency_ns_(location))
+    , bandwidth_(location_bandwidth_(location))
+    , link_free_(Clock_::now())
+{}
+
+VirtualTransportClient::~VirtualTransportClient() {}
+
+bool VirtualTransportClient::returns_shared_buffers() const {
+    return true;
+}
+
+DataConstRef VirtualTransportClient::call(
+        char const * req_buf, std::size_t req_len
+) const {
+    send_request(req_buf, req_len);
+    return get_response();
+}
+
+void VirtualTransportClient::send_request(
+        char const * req_buf, std::size_t req_len
+) const {
+    // the request occupies the link for its transfer time, and its
+    // response starts to arrive one latency after it has gone out
+    auto start = std::max(Clock_::now(), link_free_);
+    link_free_ = start + transfer_time_(req_len);
+    response_starts_.push_back(link_free_ + latency_);
+    inner_.send_request(req_buf, req_len);
+}
+
+DataConstRef VirtualTransportClient::get_response() const {
+    DataConstRef response = inner_.get_response();
+    // the response occupies the link from when it starts to arrive;
+    // the handler may have taken longer than the link did, in which
+    // case the simulated times have already passed and we don't wait
+    auto start = std::max(response_starts_.front(), link_free_);
+    response_starts_.pop_front();
+    link_free_ = start + transfer_time_(response.size());
+    std::this_thread::sleep_until(link_free_);
+    return response;
+}
+
+DataConstRef VirtualTransportClient::get_response(
+        RecvBufferAllocator const & recv_buf
+) const {
+    DataConstRef response = get_response();
+    char * buf = recv_buf(response.size());
+    memcpy(buf, response.as_byte_array(), response.size());
+    return Data::byte_array(buf, response.size());
+}
+
+bool VirtualTransportClient::response_started() const {
+    if (response_starts_.empty())
+        return true;
+    if (Clock_::now() < response_starts_.front())
+        return false;
+    return inner_.response_started();
+}
+
+void VirtualTransportClient::close() {
+    inner_.close();
+}
+
+/* Returns how long the simulated link takes to move num_bytes.
+ *
+ * A bandwidth of zero means an infinitely fast link.
+ */
+VirtualTransportClient::Clock_::duration
+VirtualTransportClient::transfer_time_(std::size_t num_bytes) const {
+    if (bandwidth_ == 0u)
+        return Clock_::duration::zero();
+    return std::chrono::nanoseconds(
+            static_cast<std::uint64_t>(num_bytes) * 1000000000u / bandwidth_);
+}
+
+} } }
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "libmuscle/mcp/direct_transport_client.hpp"
+#include "libmuscle/mcp/transport_client.hpp"
+#include "libmuscle/data.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** A client that connects to a VirtualTransport server.
+ *
+ * This hands requests to the server's handler by function call, like
+ * DirectTransportClient does, but delays completion as a link with
+ * the latency and bandwidth from the location string would. A request
+ * occupies the simulated link while its bytes are "on the wire", so
+ * pipelined requests serialise on bandwidth but overlap their
+ * latencies, and a response only counts as started once the latency
+ * has passed. Since there are no kernel sockets involved, the timing
+ * is repeatable from run to run, and a link can be made fast enough
+ * that peer-scale tests finish in milliseconds.
+ *
+ * Receive timeouts are ignored, as on the other transports that
+ * cannot poll.
+ */
+class VirtualTransportClient : public TransportClient {
+    public:
+        /** Whether this client class can connect to the given location.
+         *
+         * @param location The location to potentially connect to.
+         *
+         * @return true iff this class can connect to this location.
+         */
+        static bool can_connect_to(std::string const & location);
+
+        /** Create an MCP Transport Client for a given location.
+         *
+         * Throws a std::runtime_error if the location does not refer to
+         * a live server in this process, in which case the caller
+         * should fall back to another transport.
+         *
+         * @param location A location string to connect to.
+         */
+        VirtualTransportClient(std::string const & location);
+
+        /** Destruct the VirtualTransportClient.
+         */
+        virtual ~VirtualTransportClient() override;
+
+        /** Whether responses are returned as shared buffers.
+         *
+         * They are; see TransportClient::returns_shared_buffers.
+         *
+         * @return true
+         */
+        virtual bool returns_shared_buffers() const override;
+
+        /** Send a request to the server and receive the response.
+         *
+         * This blocks until the simulated link would have delivered
+         * the response.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef call(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Send a request without waiting for the response.
+         *
+         * Requests may be pipelined; see TransportClient::send_request.
+         * Pipelined requests share the simulated link, but their
+         * latencies overlap, as they would on a real connection.
+         *
+         * @param req_buf Pointer to the request to send
+         * @param req_len Length of the request in bytes
+         */
+        virtual void send_request(
+                char const * req_buf, std::size_t req_len) const override;
+
+        /** Receive the response to the oldest outstanding request.
+         *
+         * @return A DataConstRef containing a byte array with the received
+         *         data.
+         */
+        virtual DataConstRef get_response() const override;
+
+        /** Receive the oldest outstanding response into a given buffer.
+         *
+         * The response is copied from the handler's buffer into the
+         * provided one, see TransportClient::call for the contract.
+         *
+         * @param recv_buf Callback that provides the receive buffer
+         *
+         * @return A DataConstRef containing a byte array that refers to
+         *         the provided buffer.
+         */
+        virtual DataConstRef get_response(
+                RecvBufferAllocator const & recv_buf) const override;
+
+        /** Returns whether the oldest outstanding response has started
+         * to arrive on the simulated link, without blocking.
+         */
+        virtual bool response_started() const override;
+
+        /** Closes this client.
+         *
+         * This detaches from the server, allowing it to close.
+         */
+        virtual void close() override;
+
+    private:
+        using Clock_ = std::chrono::steady_clock;
+
+        Clock_::duration transfer_time_(std::size_t num_bytes) const;
+
+        DirectTransportClient inner_;
+        std::chrono::nanoseconds latency_;
+        std::uint64_t bandwidth_;
+
+        // when the simulated link next falls idle, and for each
+        // outstanding request, when its response starts to arrive
+        mutable Clock_::time_point link_free_;
+        mutable std::deque<Clock_::time_point> response_starts_;
+};
+
+} } }
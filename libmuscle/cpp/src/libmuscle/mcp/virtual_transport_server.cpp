@@ -0,0 +1,27 @@
+#include "libmuscle/mcp/virtual_transport_server.hpp"
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+VirtualTransportServer::VirtualTransportServer(
+        RequestHandler & handler, std::uint64_t latency_ns,
+        std::uint64_t bandwidth)
+    : TransportServer(handler)
+    , inner_(handler)
+{
+    // the link parameters travel in the location string, so that the
+    // client needs no side channel to learn them
+    location_ = "virtual:" + std::to_string(latency_ns)
+            + ":" + std::to_string(bandwidth)
+            + ":" + inner_.get_location().substr(7u);
+}
+
+std::string VirtualTransportServer::get_location() const {
+    return location_;
+}
+
+void VirtualTransportServer::close() {
+    inner_.close();
+}
+
+} } }
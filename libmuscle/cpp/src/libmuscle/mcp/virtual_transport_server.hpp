@@ -0,0 +1,61 @@
+#pragma once
+
+#include <libmuscle/mcp/direct_transport_server.hpp>
+#include <libmuscle/mcp/transport_server.hpp>
+
+#include <cstdint>
+#include <string>
+
+
+namespace libmuscle { namespace impl { namespace mcp {
+
+/** An in-memory server that simulates a network link.
+ *
+ * This works like DirectTransportServer, handing requests to the
+ * handler by function call within the process, but the matching
+ * VirtualTransportClient delays each transfer as a link with a given
+ * latency and bandwidth would. That makes it possible to exercise
+ * peer-scale machinery (pipelining, prefetching, transfer scheduling)
+ * against repeatable, configurable link behaviour in a plain unit
+ * test, without kernel sockets and their timing noise.
+ *
+ * This is a test-time transport: production code never creates one,
+ * but the MPPClient can connect to it, so a test that publishes a
+ * virtual location gets the full client-side stack on top of the
+ * simulated link.
+ */
+class VirtualTransportServer : public TransportServer {
+    public:
+        /** Create a VirtualTransportServer.
+         *
+         * A bandwidth of zero means an infinitely fast link: only the
+         * latency is simulated.
+         *
+         * @param handler A handler to handle requests
+         * @param latency_ns Simulated one-way link latency in ns
+         * @param bandwidth Simulated link bandwidth in bytes per second,
+         *      or 0 for no bandwidth limit
+         */
+        VirtualTransportServer(
+                RequestHandler & handler, std::uint64_t latency_ns,
+                std::uint64_t bandwidth);
+
+        /** Returns the location this server listens on.
+         *
+         * @return A string of the form
+         *      virtual:<latency_ns>:<bandwidth>:<pid>/<id>.
+         */
+        virtual std::string get_location() const;
+
+        /** Closes this server.
+         *
+         * Waits for existing clients to disconnect.
+         */
+        virtual void close();
+
+    private:
+        DirectTransportServer inner_;
+        std::string location_;
+};
+
+} } }
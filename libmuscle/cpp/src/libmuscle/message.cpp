@@ -54,6 +54,46 @@ Message::Message(
     , settings_(settings)
 {}
 
+Message::Message(
+        double timestamp,
+        DataConstRef && data)
+    : timestamp_(timestamp)
+    , next_timestamp_()
+    , data_(std::move(data))
+    , settings_()
+{}
+
+Message::Message(
+        double timestamp,
+        double next_timestamp,
+        DataConstRef && data)
+    : timestamp_(timestamp)
+    , next_timestamp_(next_timestamp)
+    , data_(std::move(data))
+    , settings_()
+{}
+
+Message::Message(
+        double timestamp,
+        DataConstRef && data,
+        Settings const & settings)
+    : timestamp_(timestamp)
+    , next_timestamp_()
+    , data_(std::move(data))
+    , settings_(settings)
+{}
+
+Message::Message(
+        double timestamp,
+        double next_timestamp,
+        DataConstRef && data,
+        Settings const & settings)
+    : timestamp_(timestamp)
+    , next_timestamp_(next_timestamp)
+    , data_(std::move(data))
+    , settings_(settings)
+{}
+
 Message::Message(Message const & message)
     : timestamp_(message.timestamp_)
     , next_timestamp_(message.next_timestamp_)
@@ -114,10 +154,20 @@ DataConstRef const & Message::data() const {
     return data_;
 }
 
+DataConstRef Message::take_data() {
+    DataConstRef result(std::move(data_));
+    data_.reseat(DataConstRef());
+    return result;
+}
+
 void Message::set_data(DataConstRef const & data) {
     data_.reseat(data);
 }
 
+void Message::set_data(DataConstRef && data) {
+    data_.reseat(std::move(data));
+}
+
 bool Message::has_settings() const {
     return settings_.is_set();
 }
@@ -64,6 +64,63 @@ class Message {
                 DataConstRef const & data,
                 ymmsl::Settings const & settings);
 
+        /** Create a Message, taking over the data.
+         *
+         * As the corresponding constructor taking DataConstRef const &,
+         * but moving the data into the message rather than copying it,
+         * which is cheaper.
+         *
+         * @param timestamp Simulation time for which this data is valid.
+         * @param data An object to send or that was received.
+         */
+        Message(double timestamp, DataConstRef && data);
+
+        /** Create a Message, taking over the data.
+         *
+         * As the corresponding constructor taking DataConstRef const &,
+         * but moving the data into the message rather than copying it,
+         * which is cheaper.
+         *
+         * @param timestamp Simulation time for which this data is valid.
+         * @param next_timestamp Simulation time for the next message to be
+         *      transmitted through this port.
+         * @param data An object to send or that was received.
+         */
+        Message(double timestamp,
+                double next_timestamp,
+                DataConstRef && data);
+
+        /** Create a Message, taking over the data.
+         *
+         * As the corresponding constructor taking DataConstRef const &,
+         * but moving the data into the message rather than copying it,
+         * which is cheaper.
+         *
+         * @param timestamp Simulation time for which this data is valid.
+         * @param data An object to send or that was received.
+         * @param settings Overlay settings to send or that were received.
+         */
+        Message(double timestamp,
+                DataConstRef && data,
+                ymmsl::Settings const & settings);
+
+        /** Create a Message, taking over the data.
+         *
+         * As the corresponding constructor taking DataConstRef const &,
+         * but moving the data into the message rather than copying it,
+         * which is cheaper.
+         *
+         * @param timestamp Simulation time for which this data is valid.
+         * @param next_timestamp Simulation time for the next message to be
+         *      transmitted through this port.
+         * @param data An object to send or that was received.
+         * @param settings Overlay settings to send or that were received.
+         */
+        Message(double timestamp,
+                double next_timestamp,
+                DataConstRef && data,
+                ymmsl::Settings const & settings);
+
         /** Copy constructor.
          */
         Message(Message const & message);
@@ -116,12 +173,31 @@ class Message {
          */
         DataConstRef const & data() const;
 
+        /** Takes the data out of the message.
+         *
+         * This transfers ownership of the data to the caller, rather
+         * than copying shared pointer internals as data() does. After
+         * calling this, the message no longer contains any data.
+         *
+         * @return The data of the message.
+         */
+        DataConstRef take_data();
+
         /** Sets data to the given value.
          *
          * @param data The new data to set.
          */
         void set_data(DataConstRef const & data);
 
+        /** Sets data to the given value, taking it over.
+         *
+         * As set_data(), but moving the data into the message rather
+         * than copying it, which is cheaper.
+         *
+         * @param data The new data to set.
+         */
+        void set_data(DataConstRef && data);
+
         /** Returns whether the message carries settings.
          */
         bool has_settings() const;
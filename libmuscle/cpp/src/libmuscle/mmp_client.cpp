@@ -35,10 +35,15 @@ namespace {
     const int peer_interval_min = 5000;     // milliseconds
     const int peer_interval_max = 10000;    // milliseconds
 
-    std::chrono::milliseconds random_sleep_time() {
-        static std::default_random_engine engine;
-        static std::uniform_int_distribution<int> dist(
-                peer_interval_min, peer_interval_max);
+    /* Draws a random wait between min_ms and max_ms milliseconds.
+     *
+     * The engine is seeded from the system's entropy source, so that
+     * the many instances of a large ensemble don't all draw the same
+     * sequence and query the manager in lock-step.
+     */
+    std::chrono::milliseconds random_sleep_time(int min_ms, int max_ms) {
+        static std::default_random_engine engine(std::random_device{}());
+        std::uniform_int_distribution<int> dist(min_ms, max_ms);
 
         return std::chrono::milliseconds(dist(engine));
     }
@@ -64,15 +69,95 @@ namespace {
         return Data::list(std::string(port.name), encode_operator(port.oper));
     }
 
+    Data encode_log_message(libmuscle::impl::LogMessage const & message) {
+        return Data::list(
+                message.instance_id,
+                message.timestamp.seconds,
+                static_cast<int>(message.level),
+                message.text);
+    }
+
+    // Encodes an event for the wire; this must match the Python side's
+    // encode_profile_event().
+    Data encode_profile_event(
+            std::string const & instance_id,
+            libmuscle::impl::ProfileEvent const & event)
+    {
+        return Data::list(
+                instance_id,
+                event.start_time.nanoseconds * 1e-9,
+                event.stop_time.nanoseconds * 1e-9,
+                static_cast<int>(event.event_type),
+                event.port.is_set() ? encode_port(event.port.get()) : Data(),
+                event.port_length.is_set()
+                    ? Data(event.port_length.get()) : Data(),
+                event.slot.is_set() ? Data(event.slot.get()) : Data(),
+                event.message_size.is_set()
+                    ? Data(static_cast<int64_t>(event.message_size.get()))
+                    : Data());
+    }
+
+    // Checkpoint times may be sent as either integers or floats
+    double as_checkpoint_time(DataConstRef const & data) {
+        if (data.is_a<double>())
+            return data.as<double>();
+        return static_cast<double>(data.as<int64_t>());
+    }
+
+    // Decodes a checkpoint rule; this must match the Python side's
+    // encoding of CheckpointAtRule and CheckpointRangeRule.
+    libmuscle::impl::CheckpointRule decode_checkpoint_rule(
+            DataConstRef const & rule)
+    {
+        libmuscle::impl::CheckpointRule result;
+        for (std::size_t i = 0u; i < rule.size(); ++i) {
+            auto value = rule.value(i);
+            if (rule.key(i) == "at")
+                for (std::size_t j = 0u; j < value.size(); ++j)
+                    result.at.push_back(as_checkpoint_time(value[j]));
+            else if (value.is_nil())
+                continue;
+            else if (rule.key(i) == "start")
+                result.start = as_checkpoint_time(value);
+            else if (rule.key(i) == "stop")
+                result.stop = as_checkpoint_time(value);
+            else if (rule.key(i) == "every")
+                result.every = as_checkpoint_time(value);
+        }
+        return result;
+    }
+
+    std::vector<libmuscle::impl::CheckpointRule> decode_checkpoint_rules(
+            DataConstRef const & rules)
+    {
+        std::vector<libmuscle::impl::CheckpointRule> result;
+        for (std::size_t i = 0u; i < rules.size(); ++i) {
+            auto rule = decode_checkpoint_rule(rules[i]);
+            // an "at" rule without any moments never triggers, and would
+            // be mistaken for a range rule, so drop it here
+            if (!rule.at.empty() || rule.every > 0.0)
+                result.push_back(rule);
+        }
+        return result;
+    }
+
 }
 
 namespace libmuscle { namespace impl {
 
 MMPClient::MMPClient(std::string const & location)
-    : transport_client_(location)
+    : location_(location)
+    , transport_client_(location)
 {}
 
 void MMPClient::close() {
+    {
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        if (log_transport_client_) {
+            log_transport_client_->close();
+            log_transport_client_.reset();
+        }
+    }
     transport_client_.close();
 }
 
@@ -84,6 +169,35 @@ void MMPClient::submit_log_message(LogMessage const & message) {
             static_cast<int>(message.level),
             message.text);
 
+    call_manager_log_(request);
+}
+
+void MMPClient::submit_log_messages(
+        std::vector<LogMessage> const & messages)
+{
+    auto encoded_messages = Data::nils(messages.size());
+    for (std::size_t i = 0u; i < messages.size(); ++i)
+        encoded_messages[i] = encode_log_message(messages[i]);
+
+    auto request = Data::list(
+            static_cast<int>(RequestType::submit_log_messages),
+            encoded_messages);
+
+    call_manager_log_(request);
+}
+
+void MMPClient::submit_profile_events(
+        std::string const & instance_id,
+        std::vector<ProfileEvent> const & events)
+{
+    auto encoded_events = Data::nils(events.size());
+    for (std::size_t i = 0u; i < events.size(); ++i)
+        encoded_events[i] = encode_profile_event(instance_id, events[i]);
+
+    auto request = Data::list(
+            static_cast<int>(RequestType::submit_profile_events),
+            encoded_events);
+
     call_manager_(request);
 }
 
@@ -112,6 +226,40 @@ void MMPClient::register_instance(
                 "Error registering instance: " + response[1].as<std::string>());
 }
 
+void MMPClient::register_instances(
+        std::vector<Reference> const & names,
+        std::vector<std::vector<std::string>> const & locations,
+        std::vector<std::vector<::ymmsl::Port>> const & ports)
+{
+    // each entry matches the argument list of a register_instance
+    // request, so the manager handles them with the same code
+    auto encoded_instances = Data::nils(names.size());
+    for (std::size_t i = 0u; i < names.size(); ++i) {
+        auto encoded_locs = Data::nils(locations[i].size());
+        for (std::size_t j = 0u; j < locations[i].size(); ++j)
+            encoded_locs[j] = locations[i][j];
+
+        auto encoded_ports = Data::nils(ports[i].size());
+        for (std::size_t j = 0u; j < ports[i].size(); ++j)
+            encoded_ports[j] = encode_port(ports[i][j]);
+
+        encoded_instances[i] = Data::list(
+                std::string(names[i]), encoded_locs, encoded_ports,
+                MUSCLE3_VERSION);
+    }
+
+    auto request = Data::list(
+            static_cast<int>(RequestType::register_instances),
+            encoded_instances);
+
+    auto response = call_manager_(request);
+
+    if (response[0].as<int>() == static_cast<int>(ResponseType::error))
+        throw std::runtime_error(
+                "Error registering instances: "
+                + response[1].as<std::string>());
+}
+
 ymmsl::Settings MMPClient::get_settings() {
     auto request = Data::list(static_cast<int>(RequestType::get_settings));
     auto response = call_manager_(request);
@@ -126,6 +274,82 @@ ymmsl::Settings MMPClient::get_settings() {
     return settings;
 }
 
+auto MMPClient::get_checkpoint_info(Reference const & name) ->
+        std::tuple<
+            double,
+            Checkpoints,
+            Optional<std::string>,
+            Optional<std::string>
+        >
+{
+    auto request = Data::list(
+            static_cast<int>(RequestType::get_checkpoint_info),
+            std::string(name));
+    auto response = call_manager_(request);
+
+    if (response[0].as<int>() == static_cast<int>(ResponseType::error)) {
+        std::ostringstream oss;
+        oss << "Error getting checkpoint info from manager: ";
+        oss << response[1].as<std::string>();
+        throw std::runtime_error(oss.str());
+    }
+
+    double elapsed_time = response[1].as<double>();
+
+    auto checkpoints_dict = response[2];
+    Checkpoints checkpoints;
+    checkpoints.at_end = checkpoints_dict["at_end"].as<bool>();
+    checkpoints.wallclock_time = decode_checkpoint_rules(
+            checkpoints_dict["wallclock_time"]);
+    checkpoints.simulation_time = decode_checkpoint_rules(
+            checkpoints_dict["simulation_time"]);
+
+    Optional<std::string> resume_from_snapshot;
+    if (!response[3].is_nil())
+        resume_from_snapshot = response[3].as<std::string>();
+
+    Optional<std::string> snapshot_directory;
+    if (!response[4].is_nil())
+        snapshot_directory = response[4].as<std::string>();
+
+    return std::make_tuple(
+            elapsed_time, checkpoints, resume_from_snapshot,
+            snapshot_directory);
+}
+
+void MMPClient::submit_snapshot_metadata(
+        Reference const & name, SnapshotMetadata const & metadata)
+{
+    auto triggers = Data::nils(metadata.triggers.size());
+    for (std::size_t i = 0u; i < metadata.triggers.size(); ++i)
+        triggers[i] = metadata.triggers[i];
+
+    auto port_message_counts = Data::dict_reserve(
+            metadata.port_message_counts.size());
+    for (auto const & port_counts : metadata.port_message_counts) {
+        auto counts = Data::nils(port_counts.second.size());
+        for (std::size_t i = 0u; i < port_counts.second.size(); ++i)
+            counts[i] = port_counts.second[i];
+        port_message_counts[port_counts.first] = counts;
+    }
+
+    auto encoded_metadata = Data::dict(
+            "triggers", triggers,
+            "wallclock_time", metadata.wallclock_time,
+            "timestamp", metadata.timestamp,
+            "next_timestamp", metadata.next_timestamp.is_set()
+                ? Data(metadata.next_timestamp.get()) : Data(),
+            "port_message_counts", port_message_counts,
+            "is_final_snapshot", metadata.is_final_snapshot,
+            "snapshot_filename", metadata.snapshot_filename);
+
+    auto request = Data::list(
+            static_cast<int>(RequestType::submit_snapshot),
+            std::string(name), encoded_metadata);
+
+    call_manager_(request);
+}
+
 auto MMPClient::request_peers(Reference const & name) ->
         std::tuple<
             std::vector<::ymmsl::Conduit>,
@@ -144,14 +368,18 @@ auto MMPClient::request_peers(Reference const & name) ->
     while ((response[0].as<int>() == status_pending) &&
            (steady_clock::now() < start_time + peer_timeout) &&
            (sleep_time < peer_interval_min)) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleep_time));
+        // jitter the back-off so that instances that started together
+        // don't all retry at the same moments
+        std::this_thread::sleep_for(
+                random_sleep_time(sleep_time / 2, sleep_time));
         response.reseat(call_manager_(request));
         sleep_time += sleep_time / 2;
     }
 
     while ((response[0].as<int>() == status_pending) &&
            (steady_clock::now() < start_time + peer_timeout)) {
-        std::this_thread::sleep_for(random_sleep_time());
+        std::this_thread::sleep_for(
+                random_sleep_time(peer_interval_min, peer_interval_max));
         response.reseat(call_manager_(request));
     }
 
@@ -164,8 +392,14 @@ auto MMPClient::request_peers(Reference const & name) ->
         throw std::runtime_error(oss.str());
     }
 
+    // All counts are known up front, so the containers are sized once;
+    // a large model has tens of thousands of conduits, and building
+    // them is enough work without also reallocating as we go. The
+    // conduit list stays a single contiguous block, which PeerManager
+    // then walks linearly.
     auto const & recv_conduits = response[1];
     std::vector<Conduit> conduits;
+    conduits.reserve(recv_conduits.size());
     for (std::size_t i = 0u; i < recv_conduits.size(); ++i)
         conduits.emplace_back(
                 recv_conduits[i][0].as<std::string>(), recv_conduits[i][1].as<std::string>());
@@ -173,24 +407,26 @@ auto MMPClient::request_peers(Reference const & name) ->
 
     auto const & recv_dims = response[2];
     std::unordered_map<Reference, std::vector<int>> peer_dimensions;
+    peer_dimensions.reserve(recv_dims.size());
     for (std::size_t i = 0u; i < recv_dims.size(); ++i) {
         auto dim_list = recv_dims.value(i);
         std::vector<int> dims(dim_list.size());
         for (std::size_t j = 0u; j < dim_list.size(); ++j)
             dims[j] = dim_list[j].as<int>();
 
-        peer_dimensions[recv_dims.key(i)] = dims;
+        peer_dimensions[recv_dims.key(i)] = std::move(dims);
     }
 
     auto const & recv_locs = response[3];
     std::unordered_map<Reference, std::vector<std::string>> peer_locations;
+    peer_locations.reserve(recv_locs.size());
     for (std::size_t i = 0u; i < recv_locs.size(); ++i) {
         auto peer_locs = recv_locs.value(i);
         std::vector<std::string> locs(peer_locs.size());
         for (std::size_t j = 0u; j < peer_locs.size(); ++j)
             locs[j] = peer_locs[j].as<std::string>();
 
-        peer_locations[recv_locs.key(i)] = locs;
+        peer_locations[recv_locs.key(i)] = std::move(locs);
     }
 
     return std::make_tuple(
@@ -210,14 +446,50 @@ void MMPClient::deregister_instance(Reference const & name) {
     }
 }
 
+void MMPClient::deregister_instances(std::vector<Reference> const & names) {
+    auto encoded_names = Data::nils(names.size());
+    for (std::size_t i = 0u; i < names.size(); ++i)
+        encoded_names[i] = std::string(names[i]);
+
+    auto request = Data::list(
+            static_cast<int>(RequestType::deregister_instances),
+            encoded_names);
+    auto response = call_manager_(request);
+    if (response[0].as<int>() == static_cast<int>(ResponseType::error)) {
+        std::ostringstream oss;
+        oss << "Failed to deregister: " << response[1].as<std::string>();
+        throw std::runtime_error(oss.str());
+    }
+}
+
 DataConstRef MMPClient::call_manager_(DataConstRef const & request) {
     msgpack::sbuffer sbuf;
     msgpack::pack(sbuf, request);
 
+    // the Logger's writer thread submits concurrently with the main
+    // thread, so take turns on the connection
+    std::lock_guard<std::mutex> lock(mutex_);
     auto result = transport_client_.call(sbuf.data(), sbuf.size());
 
-    auto zone = std::make_shared<msgpack::zone>();
-    return unpack_data(zone, result.as_byte_array(), result.size());
+    return unpack_data(result.as_byte_array(), result.size());
+}
+
+DataConstRef MMPClient::call_manager_log_(DataConstRef const & request) {
+    msgpack::sbuffer sbuf;
+    msgpack::pack(sbuf, request);
+
+    // log submissions get a connection of their own, so that a burst
+    // of logging queues up here rather than in front of the settings
+    // and peer requests that the main thread blocks on; it's opened
+    // lazily, so instances that never log remotely don't add to the
+    // manager's connection count
+    std::lock_guard<std::mutex> lock(log_mutex_);
+    if (!log_transport_client_)
+        log_transport_client_ = std::make_unique<mcp::TcpTransportClient>(
+                location_);
+    auto result = log_transport_client_->call(sbuf.data(), sbuf.size());
+
+    return unpack_data(result.as_byte_array(), result.size());
 }
 
 
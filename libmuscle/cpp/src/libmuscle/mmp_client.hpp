@@ -6,14 +6,19 @@
 
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
 
+#include <libmuscle/checkpoint_triggers.hpp>
 #include <libmuscle/data.hpp>
 #include <libmuscle/logging.hpp>
 #include <libmuscle/mcp/tcp_transport_client.hpp>
+#include <libmuscle/profiling.hpp>
+#include <libmuscle/snapshot.hpp>
+#include <libmuscle/util.hpp>
 #include <ymmsl/ymmsl.hpp>
 
 
@@ -24,7 +29,9 @@ namespace libmuscle { namespace impl {
  * This class connects to the Manager and communicates with it on behalf of the
  * rest of libmuscle.
  *
- * It manages the connection, and encodes and decodes MsgPack.
+ * It manages the connection, and encodes and decodes MsgPack. Calls
+ * may be made from multiple threads, e.g. the Logger's writer thread
+ * next to the main thread; requests are serialised internally.
  */
 class MMPClient {
     public:
@@ -42,17 +49,66 @@ class MMPClient {
         void close();
 
         /** Send a log message to the manager.
+         *
+         * Log messages travel over their own connection to the manager,
+         * opened on the first submission, so that a burst of logging
+         * never delays a settings or peer request that the instance is
+         * blocked on.
          *
          * @param message The message to send.
          */
         void submit_log_message(LogMessage const & message);
 
+        /** Send a batch of log messages to the manager.
+         *
+         * This submits all the messages in a single request, saving a
+         * round trip per message. Like submit_log_message(), this uses
+         * the dedicated log connection.
+         *
+         * @param messages The messages to send.
+         */
+        void submit_log_messages(std::vector<LogMessage> const & messages);
+
+        /** Send profiling events to the manager.
+         *
+         * @param instance_id The id of the instance the events are for.
+         * @param events The events to send.
+         */
+        void submit_profile_events(
+                std::string const & instance_id,
+                std::vector<ProfileEvent> const & events);
+
         /** Get the global settings from the manager.
          *
          * @return A Settings object with the global settings.
          */
         ymmsl::Settings get_settings();
 
+        /** Get the checkpoint configuration from the manager.
+         *
+         * @param name Name of the instance in the simulation.
+         * @return A tuple containing the wallclock time that elapsed in
+         *      previous runs, the checkpoint configuration of the workflow,
+         *      the path of the snapshot to resume from, if any, and the
+         *      directory to store snapshots in, if any.
+         */
+        auto get_checkpoint_info(::ymmsl::Reference const & name) ->
+            std::tuple<
+                double,
+                Checkpoints,
+                Optional<std::string>,
+                Optional<std::string>
+            >;
+
+        /** Send snapshot metadata to the manager.
+         *
+         * @param name Name of the instance in the simulation.
+         * @param metadata Metadata describing a saved snapshot.
+         */
+        void submit_snapshot_metadata(
+                ::ymmsl::Reference const & name,
+                SnapshotMetadata const & metadata);
+
         /** Register a component instance with the manager.
          *
          * @param name Name of the instance in the simulation.
@@ -64,6 +120,28 @@ class MMPClient {
                 std::vector<std::string> const & locations,
                 std::vector<::ymmsl::Port> const & ports);
 
+        /** Register a batch of component instances with the manager.
+         *
+         * As register_instance(), but registering several instances
+         * hosted by this process in a single request. When a large
+         * ensemble starts all at once, registering its members one
+         * round trip at a time makes the manager's accept loop the
+         * bottleneck; a process that hosts many instances should
+         * register them together instead.
+         *
+         * The three lists run in parallel: locations[i] and ports[i]
+         * belong to names[i].
+         *
+         * @param names Names of the instances in the simulation.
+         * @param locations For each instance, a list of places where
+         *      it can be reached.
+         * @param ports For each instance, its list of ports.
+         */
+        void register_instances(
+                std::vector<::ymmsl::Reference> const & names,
+                std::vector<std::vector<std::string>> const & locations,
+                std::vector<std::vector<::ymmsl::Port>> const & ports);
+
         /** Request connection information about peers.
          *
          * This will repeat the request at an exponentially increasing query
@@ -89,12 +167,33 @@ class MMPClient {
 
         void deregister_instance(::ymmsl::Reference const & name);
 
+        /** Deregister a batch of component instances with the manager.
+         *
+         * As deregister_instance(), but deregistering all the given
+         * instances in a single request; the counterpart of
+         * register_instances() for shutdown.
+         *
+         * @param names Names of the instances in the simulation.
+         */
+        void deregister_instances(
+                std::vector<::ymmsl::Reference> const & names);
+
     private:
+        std::string location_;
         mcp::TcpTransportClient transport_client_;
+        std::mutex mutex_;
+        // a separate connection for log submissions, opened on first
+        // use; see submit_log_message()
+        std::unique_ptr<mcp::TcpTransportClient> log_transport_client_;
+        std::mutex log_mutex_;
 
         /* Helper function that encodes/decodes and calls the manager.
          */
         DataConstRef call_manager_(DataConstRef const & request);
+
+        /* As call_manager_(), but over the log connection.
+         */
+        DataConstRef call_manager_log_(DataConstRef const & request);
 };
 
 } }
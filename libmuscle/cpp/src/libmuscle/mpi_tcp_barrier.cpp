@@ -7,9 +7,12 @@
 
 #include <mpi.h>
 
+#include <chrono>
+#include <cstdlib>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 
 
 using libmuscle::impl::mcp::TcpTransportClient;
@@ -24,6 +27,14 @@ MPITcpBarrier::MPITcpBarrier(MPI_Comm const & communicator, int root)
 {
     MPI_Comm_dup(communicator, &mpi_comm_);
 
+    // The barrier is created before we connect to the manager, so the
+    // low-latency mode cannot be a setting and is selected via the
+    // environment instead.
+    char * barrier_mode = getenv("MUSCLE_MPI_BARRIER");
+    use_mpi_barrier_ = barrier_mode && std::string(barrier_mode) == "busy";
+    if (use_mpi_barrier_)
+        return;
+
     if (is_root()) {
         post_office_ = std::make_unique<PostOffice>();
         server_ = std::make_unique<TcpTransportServer>(*post_office_);
@@ -44,10 +55,12 @@ MPITcpBarrier::MPITcpBarrier(MPI_Comm const & communicator, int root)
 }
 
 void MPITcpBarrier::shutdown() {
-    if (is_root())
-        server_->close();
-    else
-        client_->close();
+    if (!use_mpi_barrier_) {
+        if (is_root())
+            server_->close();
+        else
+            client_->close();
+    }
     MPI_Comm_free(&mpi_comm_);
 }
 
@@ -58,6 +71,22 @@ bool MPITcpBarrier::is_root() const {
 }
 
 void MPITcpBarrier::wait() {
+    if (use_mpi_barrier_) {
+        MPI_Request request;
+        MPI_Ibarrier(mpi_comm_, &request);
+        // Spin for minimum latency first, then back off to yields and
+        // short sleeps so that a long wait doesn't burn a whole core.
+        int flag = 0;
+        for (int i = 0; !flag; ++i) {
+            MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
+            if (i > 100000)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            else if (i > 10000)
+                std::this_thread::yield();
+        }
+        return;
+    }
+
     int rank;
     MPI_Comm_rank(mpi_comm_, &rank);
     std::ostringstream oss;
@@ -66,6 +95,15 @@ void MPITcpBarrier::wait() {
 }
 
 void MPITcpBarrier::signal() {
+    if (use_mpi_barrier_) {
+        // The other ranks are in wait() by the time we get here, so this
+        // completes almost immediately.
+        MPI_Request request;
+        MPI_Ibarrier(mpi_comm_, &request);
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+        return;
+    }
+
     int num_ranks;
     MPI_Comm_size(mpi_comm_, &num_ranks);
     for (int i = 0; i < num_ranks; ++i)
@@ -19,6 +19,13 @@ namespace libmuscle { namespace impl {
  * MPI spinloops on barriers, so that a model would eat all CPU while waiting
  * to receive a MUSCLE message. This provides an alternative that allows
  * blocking the processes.
+ *
+ * For tightly coupled models that exchange messages every few milliseconds,
+ * the TCP wakeup latency can dominate. Setting the MUSCLE_MPI_BARRIER
+ * environment variable to "busy" selects an MPI_Ibarrier-based wait instead,
+ * which spins briefly and then backs off to yields and short sleeps. That
+ * shaves about a millisecond off every coupling step, at the cost of some
+ * CPU time while waiting.
  */
 class MPITcpBarrier {
     public:
@@ -54,6 +61,7 @@ class MPITcpBarrier {
     private:
         int root_;
         MPI_Comm mpi_comm_;
+        bool use_mpi_barrier_;
 
         std::unique_ptr<PostOffice> post_office_;
         std::unique_ptr<mcp::TcpTransportServer> server_;
@@ -3,57 +3,515 @@
 #include "libmuscle/data.hpp"
 #include "libmuscle/mcp/protocol.hpp"
 #include "libmuscle/mcp/data_pack.hpp"
+#include "libmuscle/mcp/direct_transport_client.hpp"
+#include "libmuscle/mcp/mpi_transport_client.hpp"
+#include "libmuscle/mcp/shm_transport_client.hpp"
 #include "libmuscle/mcp/tcp_transport_client.hpp"
+#include "libmuscle/mcp/uds_transport_client.hpp"
+#include "libmuscle/mcp/virtual_transport_client.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 
+#include "libmuscle/instrumentation.hpp"
+
 
 using libmuscle::impl::Data;
 using libmuscle::impl::DataConstRef;
+#ifdef MUSCLE_ENABLE_MPI
+using libmuscle::impl::mcp::MpiTransportClient;
+#endif
+using libmuscle::impl::mcp::DirectTransportClient;
+using libmuscle::impl::mcp::ShmTransportClient;
 using libmuscle::impl::mcp::TcpTransportClient;
+using libmuscle::impl::mcp::UdsTransportClient;
+using libmuscle::impl::mcp::VirtualTransportClient;
 using ymmsl::Reference;
 
 
-namespace libmuscle { namespace impl {
+namespace {
+
+// maximum number of receive buffers kept per port
+std::size_t const max_buffers_per_port_ = 4u;
 
-MPPClient::MPPClient(std::vector<std::string> const & locations) {
-    try_connect_<TcpTransportClient>(locations);
-    if (!transport_client_)
-        throw std::runtime_error("Could not connect to peer");
 }
 
+
+namespace libmuscle { namespace impl {
+
+/* A connection to a peer location, shared between MPPClients.
+ *
+ * The peer answers requests in the order in which they were sent, so
+ * the next response on the wire always belongs to the oldest pending
+ * receive that does not have one yet. When several clients interleave
+ * their requests on a shared connection, a client finishing a receive
+ * reads responses in that order, parking those belonging to other
+ * clients' receives into the buffers those clients chose when they
+ * started them, until it reaches its own.
+ *
+ * Operations are synchronised internally, so clients sharing a
+ * connection may use it from different threads. A thread waiting for
+ * a response holds the lock, so other threads' requests on the same
+ * connection wait until it has been read.
+ */
+class MPPClient::SharedConnection_ {
+    public:
+        explicit SharedConnection_(
+                std::unique_ptr<mcp::TransportClient> && transport_client)
+            : transport_client_(std::move(transport_client))
+        {}
+
+        ~SharedConnection_() {
+            transport_client_->close();
+        }
+
+        /** Send a request and wait for the response.
+         */
+        DataConstRef call(
+                void const * client, char const * req_buf, std::size_t req_len,
+                mcp::RecvBufferAllocator const & recv_buf)
+        {
+            instrumentation::TimedLockGuard lock(mutex_);
+            start_receive_(client, req_buf, req_len, recv_buf);
+            return finish_receive_(client, recv_buf);
+        }
+
+        /** Send a request, remembering whose it is and where the
+         * response is to go.
+         */
+        void start_receive(
+                void const * client, char const * req_buf, std::size_t req_len,
+                mcp::RecvBufferAllocator const & recv_buf)
+        {
+            instrumentation::TimedLockGuard lock(mutex_);
+            start_receive_(client, req_buf, req_len, recv_buf);
+        }
+
+        /** Finish the given client's oldest pending receive.
+         */
+        DataConstRef finish_receive(void const * client) {
+            instrumentation::TimedLockGuard lock(mutex_);
+            auto it = oldest_pending_(client);
+            return finish_receive_(client, it->recv_buf);
+        }
+
+        /** Finish the given client's oldest pending receive into a
+         * caller-supplied buffer, overriding the one chosen when the
+         * receive was started.
+         */
+        DataConstRef finish_receive(
+                void const * client, mcp::RecvBufferAllocator const & recv_buf)
+        {
+            instrumentation::TimedLockGuard lock(mutex_);
+            auto it = oldest_pending_(client);
+            if (it->response) {
+                // another client sharing this connection already read
+                // our response into the buffer chosen when the receive
+                // was started, so copy it over
+                std::size_t size = it->response->size();
+                char * buf = recv_buf(size);
+                memcpy(buf, it->response->as_byte_array(), size);
+                DataConstRef response = Data::byte_array(buf, size);
+                pending_.erase(it);
+                return response;
+            }
+            receive_until_(it, recv_buf);
+            auto response = *it->response;
+            pending_.erase(it);
+            return response;
+        }
+
+        /** Returns whether the given client's oldest pending receive
+         * can be finished without waiting.
+         *
+         * Responses that have started to arrive for requests ahead of
+         * it are read and parked into the buffers chosen when those
+         * receives were started, so polling in a loop makes progress
+         * even when other clients' responses arrive first.
+         */
+        bool poll_receive(void const * client) {
+            instrumentation::TimedLockGuard lock(mutex_);
+            auto it = oldest_pending_(client);
+            while (!it->response) {
+                if (!transport_client_->response_started())
+                    return false;
+                // an arriving response always belongs to the oldest
+                // pending receive without one; read it and park it
+                auto next = std::find_if(
+                        pending_.begin(), pending_.end(),
+                        [](PendingReceive_ const & pending) {
+                            return !pending.response;
+                        });
+                next->response = std::make_shared<DataConstRef>(
+                        next->recv_buf
+                            ? transport_client_->get_response(next->recv_buf)
+                            : transport_client_->get_response());
+            }
+            return true;
+        }
+
+        /** Returns the transport's pollable fd, or -1 if it has none.
+         */
+        int poll_fd() const {
+            return transport_client_->poll_fd();
+        }
+
+        /** Whether the transport returns shared buffers, see
+         * TransportClient::returns_shared_buffers.
+         */
+        bool returns_shared_buffers() const {
+            return transport_client_->returns_shared_buffers();
+        }
+
+        /** Sets a timeout on receiving responses.
+         */
+        void set_receive_timeout(Optional<double> const & timeout) {
+            instrumentation::TimedLockGuard lock(mutex_);
+            transport_client_->set_receive_timeout(timeout);
+        }
+
+    private:
+        struct PendingReceive_ {
+            void const * client;            // client that started it
+            mcp::RecvBufferAllocator recv_buf;  // chosen at start time
+            std::shared_ptr<DataConstRef> response;     // set once read
+        };
+
+        using Pending_ = std::deque<PendingReceive_>;
+
+        /* As start_receive(), with the lock already held. */
+        void start_receive_(
+                void const * client, char const * req_buf, std::size_t req_len,
+                mcp::RecvBufferAllocator const & recv_buf)
+        {
+            transport_client_->send_request(req_buf, req_len);
+            pending_.push_back(PendingReceive_{client, recv_buf, nullptr});
+        }
+
+        /* As finish_receive(), with the lock already held. */
+        DataConstRef finish_receive_(
+                void const * client, mcp::RecvBufferAllocator const & recv_buf)
+        {
+            auto it = oldest_pending_(client);
+            receive_until_(it, recv_buf);
+            auto response = *it->response;
+            pending_.erase(it);
+            return response;
+        }
+
+        Pending_::iterator oldest_pending_(void const * client) {
+            auto it = std::find_if(
+                    pending_.begin(), pending_.end(),
+                    [client](PendingReceive_ const & pending) {
+                        return pending.client == client;
+                    });
+            if (it == pending_.end())
+                throw std::runtime_error(
+                        "finish_receive() called without an outstanding"
+                        " receive. Bug in MUSCLE3?");
+            return it;
+        }
+
+        /* Read responses in request order until the given receive has
+         * one, receiving that one via recv_buf and the others into the
+         * buffers chosen when they were started.
+         */
+        void receive_until_(
+                Pending_::iterator it,
+                mcp::RecvBufferAllocator const & recv_buf)
+        {
+            while (!it->response) {
+                auto next = std::find_if(
+                        pending_.begin(), pending_.end(),
+                        [](PendingReceive_ const & pending) {
+                            return !pending.response;
+                        });
+                // an unset allocator means the transport returns shared
+                // buffers and no receive buffer is needed
+                auto const & alloc = (next == it) ? recv_buf : next->recv_buf;
+                next->response = std::make_shared<DataConstRef>(
+                        alloc ? transport_client_->get_response(alloc)
+                              : transport_client_->get_response());
+            }
+        }
+
+        std::unique_ptr<mcp::TransportClient> transport_client_;
+        Pending_ pending_;
+        mutable std::mutex mutex_;
+};
+
+
+MPPClient::MPPClient(std::vector<std::string> const & locations)
+    : connection_(connect_(locations))
+    , zero_copy_(connection_->returns_shared_buffers())
+{}
+
 DataConstRef MPPClient::receive(Reference const & receiver) {
+    // TODO: can we put in an 8-byte dummy value here, which we
+    // can then overwrite after encoding with the length?
+    auto sbuf = pack_request_(receiver);
+    if (zero_copy_)
+        return connection_->call(
+                this, sbuf.data(), sbuf.size(), mcp::RecvBufferAllocator());
+    auto buffer = get_recv_buffer_(receiver);
+    auto bytes = connection_->call(
+            this, sbuf.data(), sbuf.size(), allocator_for_(buffer));
+    return Data::byte_array(buffer->data(), bytes.size(), buffer);
+}
+
+DataConstRef MPPClient::receive(
+        Reference const & receiver, mcp::RecvBufferAllocator const & recv_buf
+) {
+    auto sbuf = pack_request_(receiver);
+    return connection_->call(this, sbuf.data(), sbuf.size(), recv_buf);
+}
+
+DataConstRef MPPClient::receive(
+        Reference const & receiver,
+        std::vector<std::size_t> const & slice_offsets,
+        std::vector<std::size_t> const & slice_extents
+) {
+    auto sbuf = pack_request_(receiver, slice_offsets, slice_extents);
+    if (zero_copy_)
+        return connection_->call(
+                this, sbuf.data(), sbuf.size(), mcp::RecvBufferAllocator());
+    auto buffer = get_recv_buffer_(receiver);
+    auto bytes = connection_->call(
+            this, sbuf.data(), sbuf.size(), allocator_for_(buffer));
+    return Data::byte_array(buffer->data(), bytes.size(), buffer);
+}
+
+void MPPClient::start_receive(Reference const & receiver) {
+    auto sbuf = pack_request_(receiver);
+    if (zero_copy_) {
+        connection_->start_receive(
+                this, sbuf.data(), sbuf.size(), mcp::RecvBufferAllocator());
+        outstanding_.push_back(nullptr);
+        return;
+    }
+    auto buffer = get_recv_buffer_(receiver);
+    connection_->start_receive(
+            this, sbuf.data(), sbuf.size(), allocator_for_(buffer));
+    outstanding_.push_back(buffer);
+}
+
+DataConstRef MPPClient::finish_receive() {
+    if (outstanding_.empty())
+        throw std::runtime_error(
+                "finish_receive() called without an outstanding receive."
+                " Bug in MUSCLE3?");
+    auto buffer = outstanding_.front();
+    outstanding_.pop_front();
+    auto bytes = connection_->finish_receive(this);
+    if (!buffer)
+        // zero-copy transport, the bytes refer to a shared buffer
+        return bytes;
+    return Data::byte_array(buffer->data(), bytes.size(), buffer);
+}
+
+bool MPPClient::poll_receive() {
+    if (outstanding_.empty())
+        throw std::runtime_error(
+                "poll_receive() called without an outstanding receive."
+                " Bug in MUSCLE3?");
+    return connection_->poll_receive(this);
+}
+
+int MPPClient::poll_fd() const {
+    return connection_->poll_fd();
+}
+
+void MPPClient::start_receive_batch(
+        Reference const & receiver, int max_messages)
+{
+    auto sbuf = pack_request_(receiver, max_messages);
+    if (zero_copy_) {
+        connection_->start_receive(
+                this, sbuf.data(), sbuf.size(), mcp::RecvBufferAllocator());
+        outstanding_.push_back(nullptr);
+        return;
+    }
+    auto buffer = get_recv_buffer_(receiver);
+    connection_->start_receive(
+            this, sbuf.data(), sbuf.size(), allocator_for_(buffer));
+    outstanding_.push_back(buffer);
+}
+
+std::vector<DataConstRef> MPPClient::finish_receive_batch() {
+    auto bytes = finish_receive();
+    // the response is a packed list of encoded messages; the views
+    // refer into the response buffer, which unpack_data_view keeps
+    // alive for as long as they are
+    DataConstRef batch = mcp::unpack_data_view(bytes);
+    std::vector<DataConstRef> messages;
+    messages.reserve(batch.size());
+    for (std::size_t i = 0u; i < batch.size(); ++i)
+        messages.push_back(batch[i]);
+    return messages;
+}
+
+DataConstRef MPPClient::finish_receive(
+        mcp::RecvBufferAllocator const & recv_buf
+) {
+    if (!outstanding_.empty())
+        outstanding_.pop_front();
+    return connection_->finish_receive(this, recv_buf);
+}
+
+void MPPClient::set_receive_timeout(Optional<double> const & timeout) {
+    connection_->set_receive_timeout(timeout);
+}
+
+void MPPClient::close() {
+    // the connection is closed when the last client sharing it has
+    // released it
+    connection_.reset();
+}
+
+
+msgpack::sbuffer MPPClient::pack_request_(Reference const & receiver) const {
     auto request = Data::list(
             static_cast<int>(RequestType::get_next_message),
             std::string(receiver));
 
     msgpack::sbuffer sbuf;
-    // TODO: can we put in an 8-byte dummy value here, which we
-    // can then overwrite after encoding with the length?
     msgpack::pack(sbuf, request);
+    return sbuf;
+}
 
-    return transport_client_->call(sbuf.data(), sbuf.size());
+msgpack::sbuffer MPPClient::pack_request_(
+        Reference const & receiver,
+        std::vector<std::size_t> const & slice_offsets,
+        std::vector<std::size_t> const & slice_extents) const
+{
+    Data offsets_list = Data::nils(slice_offsets.size());
+    for (std::size_t i = 0u; i < slice_offsets.size(); ++i)
+        offsets_list[i] = slice_offsets[i];
+
+    Data extents_list = Data::nils(slice_extents.size());
+    for (std::size_t i = 0u; i < slice_extents.size(); ++i)
+        extents_list[i] = slice_extents[i];
+
+    auto request = Data::list(
+            static_cast<int>(RequestType::get_next_message),
+            std::string(receiver), offsets_list, extents_list);
+
+    msgpack::sbuffer sbuf;
+    msgpack::pack(sbuf, request);
+    return sbuf;
 }
 
-void MPPClient::close() {
-    transport_client_->close();
+msgpack::sbuffer MPPClient::pack_request_(
+        Reference const & receiver, int max_messages) const
+{
+    auto request = Data::list(
+            static_cast<int>(RequestType::get_next_message),
+            std::string(receiver), max_messages);
+
+    msgpack::sbuffer sbuf;
+    msgpack::pack(sbuf, request);
+    return sbuf;
+}
+
+MPPClient::RecvBuffer_ MPPClient::get_recv_buffer_(Reference const & receiver) {
+    auto & buffers = recv_buffers_[receiver];
+    std::size_t expected_size = 0u;
+    for (auto & buffer : buffers) {
+        // if the pool holds the only reference, then no message refers
+        // to the buffer any more and it can be reused
+        if (buffer.use_count() == 1l)
+            return buffer;
+        expected_size = std::max(expected_size, buffer->size());
+    }
+
+    // Size new buffers like the largest one in the pool, so that their
+    // pages are faulted in here, on the thread that will read the
+    // message. With the kernel's first-touch policy that puts them on
+    // this thread's NUMA node, rather than on whichever node the
+    // receiving thread happened to run on.
+    auto buffer = std::make_shared<std::vector<char>>(expected_size);
+    if (buffers.size() < max_buffers_per_port_)
+        buffers.push_back(buffer);
+    return buffer;
 }
 
+mcp::RecvBufferAllocator MPPClient::allocator_for_(RecvBuffer_ const & buffer) {
+    return [buffer](std::size_t length) {
+        if (buffer->size() < length)
+            buffer->resize(length);
+        return buffer->data();
+    };
+}
 
-template <class ClientType> void MPPClient::try_connect_(
+std::shared_ptr<MPPClient::SharedConnection_> MPPClient::connect_(
         std::vector<std::string> const & locations
 ) {
+    // Pool of open connections, indexed by location, shared by all
+    // MPPClients in the process. Deliberately leaked, so that it
+    // outlives any MPPClient held in a static variable by user code.
+    static auto & pool = *new std::unordered_map<
+            std::string, std::weak_ptr<SharedConnection_>>();
+    static auto & pool_mutex = *new std::mutex();
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
     for (auto const & location : locations) {
-        if (ClientType::can_connect_to(location)) {
+        auto it = pool.find(location);
+        if (it != pool.end()) {
+            auto connection = it->second.lock();
+            if (connection)
+                return connection;
+        }
+    }
+
+    std::string location;
+    auto transport_client = try_connect_<DirectTransportClient>(
+            locations, location);
+    if (!transport_client)
+        // only tests publish virtual locations, see VirtualTransportServer
+        transport_client = try_connect_<VirtualTransportClient>(
+                locations, location);
+    if (!transport_client)
+        transport_client = try_connect_<ShmTransportClient>(
+                locations, location);
+    if (!transport_client)
+        transport_client = try_connect_<UdsTransportClient>(
+                locations, location);
+#ifdef MUSCLE_ENABLE_MPI
+    if (!transport_client)
+        transport_client = try_connect_<MpiTransportClient>(
+                locations, location);
+#endif
+    if (!transport_client)
+        transport_client = try_connect_<TcpTransportClient>(
+                locations, location);
+    if (!transport_client)
+        throw std::runtime_error("Could not connect to peer");
+
+    auto connection = std::make_shared<SharedConnection_>(
+            std::move(transport_client));
+    pool[location] = connection;
+    return connection;
+}
+
+template <class ClientType>
+std::unique_ptr<mcp::TransportClient> MPPClient::try_connect_(
+        std::vector<std::string> const & locations, std::string & location
+) {
+    for (auto const & loc : locations) {
+        if (ClientType::can_connect_to(loc)) {
             try {
-                transport_client_ = std::make_unique<ClientType>(location);
-                break;
+                auto client = std::make_unique<ClientType>(loc);
+                location = loc;
+                return std::move(client);
             }
             catch (std::runtime_error const & e) {}
         }
     }
+    return nullptr;
 }
 
 } }
-
@@ -6,11 +6,14 @@
 
 #include "libmuscle/data.hpp"
 #include "libmuscle/mcp/transport_client.hpp"
+#include "libmuscle/util.hpp"
 
 #include <ymmsl/ymmsl.hpp>
 
+#include <deque>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -20,6 +23,36 @@ namespace libmuscle { namespace impl {
  *
  * This client connects to a peer to retrieve messages. It uses an MCP
  * Transport to connect.
+ *
+ * Memory use during transfers is bounded to one encoded copy of the
+ * message on each side: the sender's post office holds the encoded
+ * message, the transports move it without further full-size copies (the
+ * shared memory transport streams it through a fixed-size ring, the
+ * socket transports use scatter-gather I/O), the receiving side reads
+ * it into a single buffer, optionally one supplied by the caller via a
+ * RecvBufferAllocator, and decoding produces views into that buffer
+ * rather than copies. Messages larger than available memory would
+ * additionally require a streaming encoder, which msgpack does not
+ * offer for our data model. When sender and receiver are in the same
+ * process, the direct transport hands over a reference to the sender's
+ * encoded buffer and no copy is made at all; the buffer pool is then
+ * not used.
+ *
+ * Clients in the same process whose peers are reachable at the same
+ * location share a single connection, multiplexing their requests over
+ * it, rather than each opening their own. This keeps the number of open
+ * sockets down in large simulations. The peer answers requests in the
+ * order in which they were sent, so when clients interleave their
+ * requests, a client finishing a receive reads and parks any earlier
+ * responses belonging to the other clients, which pick them up when
+ * they finish their own receives.
+ *
+ * The shared connection is synchronised internally, but an individual
+ * client is not: calls on the same MPPClient must not overlap, since
+ * its buffer pool and outstanding receives are unprotected, and the
+ * pairing of responses to outstanding receives relies on the calls
+ * being ordered. The Communicator serialises access per peer, see
+ * Communicator::fetch_message_().
  */
 class MPPClient {
     public:
@@ -54,12 +87,182 @@ class MPPClient {
          * This returns a DataConstRef holding a byte array with the received
          * data.
          *
+         * The message is received into a buffer from a small per-port
+         * pool. Message sizes on a given port are nearly constant, so
+         * after the first few receives, messages arrive into recycled
+         * buffers without touching the allocator. A buffer goes back
+         * into the pool when the returned object and all copies of it
+         * have been released.
+         *
          * @param The receiving (local) port.
          *
          * @return The received message.
          */
         DataConstRef receive(::ymmsl::Reference const & receiver);
 
+        /** Receive a message into a caller-supplied buffer.
+         *
+         * Like receive(), but the encoded message is received from the
+         * peer directly into the buffer provided by recv_buf, with no
+         * further copies made inside libmuscle. The callback is called
+         * with the length of the message in bytes, and must return a
+         * pointer to a buffer of at least that size. The caller must
+         * keep the buffer valid and unchanged for as long as the
+         * returned object or any copy of it is in use.
+         *
+         * @param receiver The receiving (local) port.
+         * @param recv_buf Callback that provides the receive buffer.
+         *
+         * @return A DataConstRef holding a byte array that refers to the
+         *         provided buffer.
+         */
+        DataConstRef receive(
+                ::ymmsl::Reference const & receiver,
+                mcp::RecvBufferAllocator const & recv_buf);
+
+        /** Receive a region of a grid message.
+         *
+         * Like receive(), but asks the peer to send only the given
+         * region of the message's grid payload, encoded as a grid
+         * block. For a receiver that needs only a small part of a
+         * large grid, e.g. a halo region, this avoids transferring
+         * the rest of it.
+         *
+         * The peer slices the payload if it is a grid that contains
+         * the region; otherwise it sends the message in full, so the
+         * caller must be prepared to receive either. The Python
+         * implementation does not understand slice requests, so use
+         * this only if the peer is known to run libmuscle C++.
+         *
+         * @param receiver The receiving (local) port.
+         * @param slice_offsets For each dimension of the payload grid,
+         *      the index at which the requested region starts.
+         * @param slice_extents For each dimension of the payload grid,
+         *      the size of the requested region.
+         *
+         * @return The received message.
+         */
+        DataConstRef receive(
+                ::ymmsl::Reference const & receiver,
+                std::vector<std::size_t> const & slice_offsets,
+                std::vector<std::size_t> const & slice_extents);
+
+        /** Start receiving a message, without waiting for it.
+         *
+         * This sends the request for the message and returns without
+         * waiting for the response. Several receives may be started
+         * back-to-back to overlap their round-trip latencies; the peer
+         * answers them in the order in which they were started, and
+         * each finish_receive() call completes the oldest outstanding
+         * one.
+         *
+         * @param receiver The receiving (local) port.
+         */
+        void start_receive(::ymmsl::Reference const & receiver);
+
+        /** Finish the oldest outstanding receive.
+         *
+         * This blocks until the message has been received, and returns
+         * it as receive() does, using the same per-port buffer pool.
+         * There must be an outstanding receive, started via
+         * start_receive().
+         *
+         * @return The received message.
+         */
+        DataConstRef finish_receive();
+
+        /** Finish the oldest outstanding receive into a given buffer.
+         *
+         * As finish_receive(), but the encoded message is received
+         * directly into the buffer provided by recv_buf, see the
+         * two-argument receive() for the contract. If another client
+         * sharing the connection already read and parked our response,
+         * then it is copied into the provided buffer instead.
+         *
+         * @param recv_buf Callback that provides the receive buffer.
+         *
+         * @return A DataConstRef holding a byte array that refers to the
+         *         provided buffer.
+         */
+        DataConstRef finish_receive(mcp::RecvBufferAllocator const & recv_buf);
+
+        /** Returns whether the oldest outstanding receive can be
+         * finished without waiting.
+         *
+         * If this returns true, then the response has (at least started
+         * to) arrive, and finish_receive() completes promptly. If it
+         * returns false, then finish_receive() would block until the
+         * peer sends the message. Responses that have arrived for other
+         * receives sharing the connection are read and parked in the
+         * process, so polling a set of clients in a loop makes progress
+         * regardless of the order in which their responses come in.
+         *
+         * Transports that cannot check for incoming data report true,
+         * so a caller polling several clients falls back to blocking on
+         * such a client in turn. There must be an outstanding receive,
+         * started via start_receive().
+         *
+         * @return Whether finish_receive() would complete without
+         *      waiting for the peer.
+         */
+        bool poll_receive();
+
+        /** Returns a file descriptor that signals incoming responses.
+         *
+         * See TransportClient::poll_fd(); a caller waiting for any of
+         * several clients can wait on all of their fds in one poll set
+         * instead of spinning on poll_receive().
+         *
+         * @return A pollable file descriptor, or -1 if the transport
+         *      has none.
+         */
+        int poll_fd() const;
+
+        /** Start receiving a batch of messages, without waiting.
+         *
+         * As start_receive(), but asking the peer for up to
+         * max_messages messages in a single response: the next message
+         * for the receiver, plus any further messages it already has
+         * queued, up to the maximum. The matching finish_receive_batch()
+         * call completes it. The Python implementation does not
+         * understand batch requests, so use this only if the peer is
+         * known to run libmuscle C++.
+         *
+         * @param receiver The receiving (local) port.
+         * @param max_messages Maximum number of messages to ask for.
+         */
+        void start_receive_batch(
+                ::ymmsl::Reference const & receiver, int max_messages);
+
+        /** Finish an outstanding batch receive.
+         *
+         * This blocks until the batch response has been received, and
+         * returns the messages in it, in the order in which they were
+         * sent. There is at least one; how many more depends on what
+         * the peer had queued. The oldest outstanding receive must be
+         * one started via start_receive_batch().
+         *
+         * @return The received messages.
+         */
+        std::vector<DataConstRef> finish_receive_batch();
+
+        /** Sets a timeout on receiving messages.
+         *
+         * If set, then receive() and finish_receive() throw a
+         * ReceiveTimeoutError if the response has not started arriving
+         * within the given number of seconds. The timeout applies to
+         * the underlying connection, which may be shared with other
+         * clients, so it should be set just before a receive and unset
+         * again right after; see Communicator::finish_receive_().
+         *
+         * The TCP and UNIX domain socket transports honour the
+         * timeout; the shared memory and MPI transports cannot poll
+         * for incoming data, so they ignore it and block as before.
+         *
+         * @param timeout Timeout in seconds, or unset for no timeout.
+         */
+        void set_receive_timeout(Optional<double> const & timeout);
+
         /** Closes this client.
          *
          * This closes any connections this client has and/or performs other
@@ -68,10 +271,51 @@ class MPPClient {
         void close();
 
     private:
-        std::unique_ptr<mcp::TransportClient> transport_client_;
+        // A connection to a peer location, shared between the clients
+        // that connect to it; defined in mpp_client.cpp.
+        class SharedConnection_;
+
+        // A recyclable receive buffer; the pool holds one reference, and
+        // messages referring to the buffer share in its ownership.
+        using RecvBuffer_ = std::shared_ptr<std::vector<char>>;
+
+        std::shared_ptr<SharedConnection_> connection_;
+
+        // whether the transport returns shared buffers, in which case
+        // the buffer pool is not used; see
+        // TransportClient::returns_shared_buffers
+        bool zero_copy_;
+
+        // pool of receive buffers per receiving port
+        std::unordered_map<::ymmsl::Reference, std::vector<RecvBuffer_>>
+                recv_buffers_;
 
-        template <class ClientType> void try_connect_(
+        // buffers of outstanding receives, in request order
+        std::deque<RecvBuffer_> outstanding_;
+
+        msgpack::sbuffer pack_request_(
+                ::ymmsl::Reference const & receiver) const;
+
+        msgpack::sbuffer pack_request_(
+                ::ymmsl::Reference const & receiver,
+                std::vector<std::size_t> const & slice_offsets,
+                std::vector<std::size_t> const & slice_extents) const;
+
+        msgpack::sbuffer pack_request_(
+                ::ymmsl::Reference const & receiver, int max_messages) const;
+
+        RecvBuffer_ get_recv_buffer_(::ymmsl::Reference const & receiver);
+
+        static mcp::RecvBufferAllocator allocator_for_(
+                RecvBuffer_ const & buffer);
+
+        static std::shared_ptr<SharedConnection_> connect_(
                 std::vector<std::string> const & locations);
+
+        template <class ClientType>
+        static std::unique_ptr<mcp::TransportClient> try_connect_(
+                std::vector<std::string> const & locations,
+                std::string & location);
 };
 
 } }
@@ -1,13 +1,104 @@
 #include <libmuscle/mpp_message.hpp>
+#include <libmuscle/block_pool.hpp>
 #include <libmuscle/mcp/data_pack.hpp>
 #include <ymmsl/identity.hpp>
 
 #include <msgpack.hpp>
 
 #include <cstring>
+#include <memory>
+#include <stdexcept>
 #include <utility>
 
 
+namespace {
+
+using libmuscle::impl::Codec;
+using libmuscle::impl::Data;
+using libmuscle::impl::DataConstRef;
+
+/* Makes a shared DataConstRef in a recycled block, see block_pool.hpp.
+ *
+ * Every message holds its payload and overlay this way, so these are
+ * made at the message rate and are worth keeping off the allocator.
+ */
+template <typename... Args>
+std::shared_ptr<DataConstRef> shared_data_(Args &&... args) {
+    return std::allocate_shared<DataConstRef>(
+            libmuscle::impl::BlockPoolAllocator<DataConstRef>(),
+            std::forward<Args>(args)...);
+}
+
+/* Packs a data payload and compresses the result.
+ */
+DataConstRef pack_compressed_(DataConstRef const & data, Codec codec) {
+    auto data_buf = libmuscle::impl::mcp::pack_data_exact(data);
+    return libmuscle::impl::compress(
+            data_buf.as_byte_array(), data_buf.size(), codec);
+}
+
+/* Decompresses a compressed data payload and unpacks the result.
+ */
+DataConstRef unpack_compressed_(DataConstRef const & payload, Codec codec) {
+    return libmuscle::impl::mcp::unpack_data_view(libmuscle::impl::decompress(
+            payload.as_byte_array(), payload.size(), codec));
+}
+
+/* Reads a msgpack string header at pos, advancing pos past it.
+ *
+ * On success, pos points at the string's bytes and len holds their
+ * number; false is returned if there's no string header at pos or the
+ * string would run past the end of the buffer.
+ */
+bool read_str_header_(
+        unsigned char const * buf, std::size_t size,
+        std::size_t & pos, std::size_t & len)
+{
+    if (pos >= size)
+        return false;
+    unsigned char c = buf[pos];
+    if ((c & 0xe0u) == 0xa0u) {
+        len = c & 0x1fu;
+        pos += 1u;
+    }
+    else if (c == 0xd9u) {
+        if (pos + 2u > size) return false;
+        len = buf[pos + 1u];
+        pos += 2u;
+    }
+    else if (c == 0xdau) {
+        if (pos + 3u > size) return false;
+        len = (static_cast<std::size_t>(buf[pos + 1u]) << 8u) | buf[pos + 2u];
+        pos += 3u;
+    }
+    else
+        return false;
+    return pos + len <= size;
+}
+
+/* Writes a msgpack string header for a string of the given length.
+ *
+ * Returns the number of header bytes written.
+ */
+std::size_t write_str_header_(unsigned char * buf, std::size_t len) {
+    if (len < 32u) {
+        buf[0] = 0xa0u | static_cast<unsigned char>(len);
+        return 1u;
+    }
+    if (len < 256u) {
+        buf[0] = 0xd9u;
+        buf[1] = static_cast<unsigned char>(len);
+        return 2u;
+    }
+    buf[0] = 0xdau;
+    buf[1] = static_cast<unsigned char>(len >> 8u);
+    buf[2] = static_cast<unsigned char>(len & 0xffu);
+    return 3u;
+}
+
+}
+
+
 namespace libmuscle { namespace impl {
 
 MPPMessage::MPPMessage(
@@ -19,72 +110,365 @@ MPPMessage::MPPMessage(
             int message_number, double saved_until,
             DataConstRef const & data
             )
-        : sender(sender)
-        , receiver(receiver)
-        , port_length(port_length)
-        , timestamp(timestamp)
-        , next_timestamp(next_timestamp)
-        , settings_overlay(settings_overlay)
-        , message_number(message_number)
-        , saved_until(saved_until)
-        , data(data)
+        : encoded_bytes_()
+        , decoded_(true)
+        , modified_(true)
+        , codec_(Codec::none)
+        , wire_codec_(Codec::none)
+        , delta_(Delta::none)
+        , sender_(sender)
+        , receiver_(receiver)
+        , port_length_(port_length)
+        , timestamp_(timestamp)
+        , next_timestamp_(next_timestamp)
+        , settings_overlay_(shared_data_(settings_overlay))
+        , message_number_(message_number)
+        , saved_until_(saved_until)
+        , data_(shared_data_(data))
+    {}
+
+MPPMessage::MPPMessage(
+            ::ymmsl::Reference const & sender,
+            ::ymmsl::Reference const & receiver,
+            ::libmuscle::impl::Optional<int> port_length,
+            double timestamp, ::libmuscle::impl::Optional<double> next_timestamp,
+            DataConstRef const & settings_overlay,
+            int message_number, double saved_until,
+            DataConstRef && data
+            )
+        : encoded_bytes_()
+        , decoded_(true)
+        , modified_(true)
+        , codec_(Codec::none)
+        , wire_codec_(Codec::none)
+        , delta_(Delta::none)
+        , sender_(sender)
+        , receiver_(receiver)
+        , port_length_(port_length)
+        , timestamp_(timestamp)
+        , next_timestamp_(next_timestamp)
+        , settings_overlay_(shared_data_(settings_overlay))
+        , message_number_(message_number)
+        , saved_until_(saved_until)
+        , data_(shared_data_(std::move(data)))
+    {}
+
+MPPMessage::MPPMessage(DataConstRef const & encoded_bytes)
+        : encoded_bytes_(encoded_bytes)
+        , decoded_(false)
+        , modified_(false)
+        , codec_(Codec::none)
+        , wire_codec_(Codec::none)
+        , delta_(Delta::none)
+        , timestamp_(0.0)
+        , message_number_(0)
+        , saved_until_(0.0)
     {}
 
 MPPMessage MPPMessage::from_bytes(DataConstRef const & data) {
-    // decode
-    auto zone = std::make_shared<msgpack::zone>();
-    DataConstRef dict = mcp::unpack_data(zone, data.as_byte_array(), data.size());
-
-    // create message
-    libmuscle::impl::Optional<int> port_length;
-    if (dict["port_length"].is_a<int>())
-        port_length = dict["port_length"].as<int>();
-
-    libmuscle::impl::Optional<double> next_timestamp;
-    if (dict["next_timestamp"].is_a<double>())
-        next_timestamp = dict["next_timestamp"].as<double>();
-
-    return MPPMessage(
-            dict["sender"].as<std::string>(),
-            dict["receiver"].as<std::string>(),
-            port_length,
-            dict["timestamp"].as<double>(),
-            next_timestamp,
-            dict["settings_overlay"],
-            dict["message_number"].as<int>(),
-            dict["saved_until"].as<double>(),
-            dict["data"]);
-}
-
-DataConstRef MPPMessage::encoded() const {
+    return MPPMessage(data);
+}
+
+::ymmsl::Reference const & MPPMessage::sender() const {
+    decode_();
+    return sender_.get();
+}
+
+void MPPMessage::set_sender(::ymmsl::Reference const & sender) {
+    decode_();
+    sender_ = sender;
+    modified_ = true;
+}
+
+::ymmsl::Reference const & MPPMessage::receiver() const {
+    decode_();
+    return receiver_.get();
+}
+
+void MPPMessage::set_receiver(::ymmsl::Reference const & receiver) {
+    decode_();
+    receiver_ = receiver;
+    modified_ = true;
+}
+
+::libmuscle::impl::Optional<int> const & MPPMessage::port_length() const {
+    decode_();
+    return port_length_;
+}
+
+void MPPMessage::set_port_length(
+        ::libmuscle::impl::Optional<int> const & port_length) {
+    decode_();
+    port_length_ = port_length;
+    modified_ = true;
+}
+
+double MPPMessage::timestamp() const {
+    decode_();
+    return timestamp_;
+}
+
+void MPPMessage::set_timestamp(double timestamp) {
+    decode_();
+    timestamp_ = timestamp;
+    modified_ = true;
+}
+
+::libmuscle::impl::Optional<double> const & MPPMessage::next_timestamp() const {
+    decode_();
+    return next_timestamp_;
+}
+
+void MPPMessage::set_next_timestamp(
+        ::libmuscle::impl::Optional<double> const & next_timestamp) {
+    decode_();
+    next_timestamp_ = next_timestamp;
+    modified_ = true;
+}
+
+DataConstRef const & MPPMessage::settings_overlay() const {
+    decode_();
+    return *settings_overlay_;
+}
+
+int MPPMessage::message_number() const {
+    decode_();
+    return message_number_;
+}
+
+void MPPMessage::set_message_number(int message_number) {
+    decode_();
+    message_number_ = message_number;
+    modified_ = true;
+}
+
+double MPPMessage::saved_until() const {
+    decode_();
+    return saved_until_;
+}
+
+Codec MPPMessage::codec() const {
+    decode_();
+    return wire_codec_;
+}
+
+Delta MPPMessage::delta() const {
+    decode_();
+    return delta_;
+}
+
+void MPPMessage::set_delta(Delta delta) {
+    decode_();
+    delta_ = delta;
+    modified_ = true;
+}
+
+bool MPPMessage::is_close_port() const {
+    decode_();
+    if (!close_port_.is_set())
+        close_port_ = ::libmuscle::impl::is_close_port(data());
+    return close_port_.get();
+}
+
+DataConstRef const & MPPMessage::data() const {
+    decode_();
+    if (codec_ != Codec::none) {
+        compressed_data_ = data_;
+        data_ = shared_data_(unpack_compressed_(*data_, codec_));
+        codec_ = Codec::none;
+    }
+    return *data_;
+}
+
+DataConstRef MPPMessage::take_data() {
+    data();     // ensure it's decompressed
+    modified_ = true;
+    return std::move(*data_);
+}
+
+/* Decodes the envelope, filling in the header fields.
+ *
+ * The fields are decoded as views: the settings overlay and data refer
+ * into the encoded buffer, which unpack_data_view keeps alive for us.
+ * This saves copying the payload, which matters for large grids. A
+ * compressed data payload is left compressed here, it is decompressed
+ * if and when data() is called.
+ */
+void MPPMessage::decode_() const {
+    if (decoded_)
+        return;
+
+    DataConstRef dict = mcp::unpack_data_view(encoded_bytes_);
+
+    // The fields are read in a single pass over the map's entries.
+    // Looking each one up by key instead would scan the keys linearly
+    // every time, which at eleven fields per message adds up on the
+    // receive path. The sender may write the keys in any order, and
+    // keys we don't know are skipped, so messages from senders that
+    // predate the codec and delta keys, and from the Python
+    // implementation, which has neither, decode as before.
+    for (std::size_t i = 0u; i < dict.size(); ++i) {
+        std::string key(dict.key(i));
+        DataConstRef value(dict.value(i));
+        if (key == "sender")
+            sender_ = ::ymmsl::Reference(value.as<std::string>());
+        else if (key == "receiver")
+            receiver_ = ::ymmsl::Reference(value.as<std::string>());
+        else if (key == "port_length") {
+            if (value.is_a<int>())
+                port_length_ = value.as<int>();
+        }
+        else if (key == "timestamp")
+            timestamp_ = value.as<double>();
+        else if (key == "next_timestamp") {
+            if (value.is_a<double>())
+                next_timestamp_ = value.as<double>();
+        }
+        else if (key == "settings_overlay")
+            settings_overlay_ = shared_data_(value);
+        else if (key == "message_number")
+            message_number_ = value.as<int>();
+        else if (key == "saved_until")
+            saved_until_ = value.as<double>();
+        else if (key == "codec") {
+            if (value.is_a<int>())
+                codec_ = static_cast<Codec>(value.as<int>());
+        }
+        else if (key == "delta") {
+            if (value.is_a<int>())
+                delta_ = static_cast<Delta>(value.as<int>());
+        }
+        else if (key == "close") {
+            if (value.is_a<bool>())
+                close_port_ = value.as<bool>();
+        }
+        else if (key == "data")
+            data_ = shared_data_(value);
+    }
+    wire_codec_ = codec_;
+
+    decoded_ = true;
+}
+
+DataConstRef MPPMessage::encoded(Codec codec) const {
+    // A message we received and didn't change encodes to the bytes it
+    // came from, so forwarding is free.
+    if (!modified_ && !encoded_bytes_.is_nil()) {
+        decode_();      // to know which codec the bytes use
+        if (codec == wire_codec_)
+            return encoded_bytes_;
+    }
+    decode_();
+
     Data port_length_data;
-    if (port_length.is_set())
-        port_length_data = port_length.get();
+    if (port_length_.is_set())
+        port_length_data = port_length_.get();
 
     Data next_timestamp_data;
-    if (next_timestamp.is_set())
-        next_timestamp_data = next_timestamp.get();
+    if (next_timestamp_.is_set())
+        next_timestamp_data = next_timestamp_.get();
+
+    // If the payload is still in the requested form, reuse it as is;
+    // for a forwarded message with a modified header this avoids
+    // decompressing and recompressing the payload.
+    DataConstRef data_payload([&]() -> DataConstRef {
+            if (codec == codec_)
+                return *data_;
+            if (compressed_data_ && codec == wire_codec_)
+                return *compressed_data_;
+            if (codec == Codec::none)
+                return data();
+            return pack_compressed_(data(), codec);
+            }());
+
+    // The close flag lets the receiver detect a ClosePort without
+    // inspecting the payload. If we don't know whether this is one and
+    // finding out would mean decompressing the payload, we write nil
+    // and the receiver inspects the payload as before.
+    if (!close_port_.is_set() && codec_ == Codec::none)
+        close_port_ = ::libmuscle::impl::is_close_port(*data_);
+    Data close_data;
+    if (close_port_.is_set())
+        close_data = close_port_.get();
 
     Data msg_dict = Data::dict(
-            "sender", std::string(sender),
-            "receiver", std::string(receiver),
+            "sender", std::string(sender_.get()),
+            "receiver", std::string(receiver_.get()),
             "port_length", port_length_data,
-            "timestamp", timestamp,
+            "timestamp", timestamp_,
             "next_timestamp", next_timestamp_data,
-            "settings_overlay", settings_overlay,
-            "message_number", message_number,
-            "saved_until", saved_until,
-            "data", data
+            "settings_overlay", *settings_overlay_,
+            "message_number", message_number_,
+            "saved_until", saved_until_,
+            "codec", static_cast<int>(codec),
+            "delta", static_cast<int>(delta_),
+            "close", close_data,
+            "data", data_payload
             );
 
-    msgpack::sbuffer sbuf;
-    msgpack::pack(sbuf, msg_dict);
+    // Packs into an exactly-sized buffer, with one allocation and one
+    // pass over the bulk data; see pack_data_exact.
+    return mcp::pack_data_exact(msg_dict);
+}
+
+std::size_t MPPMessage::encoded_size() const {
+    if (encoded_bytes_.is_nil())
+        return 0u;
+    return encoded_bytes_.size();
+}
+
+::libmuscle::impl::Optional<DataConstRef> MPPMessage::encoded_with_receiver(
+        DataConstRef const & encoded,
+        ::ymmsl::Reference const & receiver)
+{
+    // The layout checked here is what encoded() above produces: a
+    // fixmap with "sender" as the first key and "receiver" as the
+    // second, both with string values. Anything else is declined and
+    // the caller encodes in full.
+    auto const * buf = reinterpret_cast<unsigned char const *>(
+            encoded.as_byte_array());
+    std::size_t size = encoded.size();
+
+    if (size == 0u || (buf[0] & 0xf0u) != 0x80u)
+        return {};
+    std::size_t pos = 1u;
+
+    std::size_t len;
+    if (!read_str_header_(buf, size, pos, len))
+        return {};
+    if (len != 6u || memcmp(buf + pos, "sender", 6u) != 0)
+        return {};
+    pos += len;
+    if (!read_str_header_(buf, size, pos, len))
+        return {};
+    pos += len;
+    if (!read_str_header_(buf, size, pos, len))
+        return {};
+    if (len != 8u || memcmp(buf + pos, "receiver", 8u) != 0)
+        return {};
+    pos += len;
 
-    auto bytes = Data::byte_array(sbuf.size());
-    memcpy(bytes.as_byte_array(), sbuf.data(), sbuf.size());
+    std::size_t val_pos = pos;
+    if (!read_str_header_(buf, size, pos, len))
+        return {};
+    std::size_t val_end = pos + len;
 
-    return bytes;
+    std::string recv_str(receiver);
+    if (recv_str.size() >= 65536u)
+        return {};
+    std::size_t hdr_size =
+        (recv_str.size() < 32u) ? 1u : (recv_str.size() < 256u) ? 2u : 3u;
+
+    std::size_t new_size =
+        size - (val_end - val_pos) + hdr_size + recv_str.size();
+    Data result = Data::byte_array(new_size);
+    auto * out = reinterpret_cast<unsigned char *>(result.as_byte_array());
+    memcpy(out, buf, val_pos);
+    write_str_header_(out + val_pos, recv_str.size());
+    memcpy(out + val_pos + hdr_size, recv_str.data(), recv_str.size());
+    memcpy(out + val_pos + hdr_size + recv_str.size(),
+            buf + val_end, size - val_end);
+    return Optional<DataConstRef>(result);
 }
 
 } }
-
@@ -1,62 +1,260 @@
 #pragma once
 
+#include <libmuscle/compression.hpp>
 #include <libmuscle/data.hpp>
 #include <libmuscle/util.hpp>
 #include <ymmsl/ymmsl.hpp>
 
+#include <memory>
+
 
 namespace libmuscle { namespace impl {
 
+/** Delta state of a message's data payload.
+ *
+ * On a conduit with delta sending enabled (see Communicator), grid
+ * payloads are XORed against the previously sent state, so that only
+ * the changed bits are non-zero and the compression stage can shrink
+ * slowly evolving fields dramatically. The receiver reconstructs the
+ * state by XORing against its retained copy. Keyframes carry the
+ * complete state, so that the stream can start and periodically
+ * refresh.
+ *
+ * The numerical values are carried inside encoded messages, so they
+ * must never be changed or reused.
+ */
+enum class Delta {
+    none = 0,       // complete payload, not part of a delta stream
+    keyframe = 1,   // complete payload, retain it to apply deltas to
+    delta = 2       // payload is XORed against the previous payload
+};
+
+
 /** A MUSCLE Peer Protocol message.
  *
  * Messages carry the identity of their sender and receiver, so that they can
  * be routed by a MUSCLE Transport Overlay when we get to multi-site running in
  * the future.
+ *
+ * Messages created by from_bytes() are decoded lazily: the encoded buffer is
+ * held on to, and the envelope is only unpacked when a field is first
+ * accessed, with a compressed data payload staying compressed until data()
+ * is called. A message that is only re-encoded, or of which only the header
+ * is read, thus skips most of the decode cost. Lazy decoding is not
+ * synchronised, so don't share a message between threads.
+ *
+ * This is the on-the-wire object, the user-facing one is in
+ * libmuscle/communicator.hpp.
  */
-struct MPPMessage {
-    /** Create an MPP Message.
-     *
-     * Senders and receivers are referred to by a Reference, which
-     * contains Instance[InstanceNumber].Port[Slot].
-     *
-     * The port_length field is only used if two vector ports are connected
-     * together. In that case the number of slots is not determined by the
-     * number of instances, and must be set by the sender and then
-     * communicated to the receiver in this additional field in all
-     * messages sent on the port.
-     *
-     * This is the on-the-wire object, the user-facing one is in
-     * libmuscle/communicator.hpp.
-     */
-    MPPMessage(
-            ::ymmsl::Reference const & sender, ::ymmsl::Reference const & receiver,
-            ::libmuscle::impl::Optional<int> port_length,
-            double timestamp, ::libmuscle::impl::Optional<double> next_timestamp,
-            DataConstRef const & settings_overlay, int message_number,
-            double saved_until, DataConstRef const & data);
-
-    /** Create an MCP Message from an encoded buffer.
-     *
-     * @param data A DataConstRef containing a byte array with encoded data.
-     */
-    static MPPMessage from_bytes(DataConstRef const & data);
-
-    /** Encode the message and return as a byte buffer.
-     *
-     * Returns a byte_array in a DataConstRef.
-     */
-    DataConstRef encoded() const;
-
-    ::ymmsl::Reference sender;
-    ::ymmsl::Reference receiver;
-    ::libmuscle::impl::Optional<int> port_length;
-    double timestamp;
-    ::libmuscle::impl::Optional<double> next_timestamp;
-    DataConstRef settings_overlay;
-    int message_number;
-    double saved_until;
-    DataConstRef data;
+class MPPMessage {
+    public:
+        /** Create an MPP Message.
+         *
+         * Senders and receivers are referred to by a Reference, which
+         * contains Instance[InstanceNumber].Port[Slot].
+         *
+         * The port_length field is only used if two vector ports are connected
+         * together. In that case the number of slots is not determined by the
+         * number of instances, and must be set by the sender and then
+         * communicated to the receiver in this additional field in all
+         * messages sent on the port.
+         */
+        MPPMessage(
+                ::ymmsl::Reference const & sender, ::ymmsl::Reference const & receiver,
+                ::libmuscle::impl::Optional<int> port_length,
+                double timestamp, ::libmuscle::impl::Optional<double> next_timestamp,
+                DataConstRef const & settings_overlay, int message_number,
+                double saved_until, DataConstRef const & data);
+
+        /** Create an MPP Message, taking over the data payload.
+         *
+         * As the constructor above, but moving the data in rather than
+         * copying it, which is cheaper.
+         */
+        MPPMessage(
+                ::ymmsl::Reference const & sender, ::ymmsl::Reference const & receiver,
+                ::libmuscle::impl::Optional<int> port_length,
+                double timestamp, ::libmuscle::impl::Optional<double> next_timestamp,
+                DataConstRef const & settings_overlay, int message_number,
+                double saved_until, DataConstRef && data);
+
+        /** Create an MCP Message from an encoded buffer.
+         *
+         * This only stores the buffer; fields are decoded when they are
+         * first accessed. If the message's data payload was compressed
+         * when it was encoded, then it is transparently decompressed
+         * when data() is first called; the codec used is carried inside
+         * the encoded message.
+         *
+         * @param data A DataConstRef containing a byte array with encoded data.
+         */
+        static MPPMessage from_bytes(DataConstRef const & data);
+
+        /** Returns the sender of this message. */
+        ::ymmsl::Reference const & sender() const;
+
+        /** Sets the sender of this message. */
+        void set_sender(::ymmsl::Reference const & sender);
+
+        /** Returns the intended receiver of this message. */
+        ::ymmsl::Reference const & receiver() const;
+
+        /** Sets the intended receiver of this message. */
+        void set_receiver(::ymmsl::Reference const & receiver);
+
+        /** Returns the sender's port length, if set. */
+        ::libmuscle::impl::Optional<int> const & port_length() const;
+
+        /** Sets the sender's port length. */
+        void set_port_length(::libmuscle::impl::Optional<int> const & port_length);
+
+        /** Returns the simulation timestamp of this message. */
+        double timestamp() const;
+
+        /** Sets the simulation timestamp of this message. */
+        void set_timestamp(double timestamp);
+
+        /** Returns the timestamp of the next message, if set. */
+        ::libmuscle::impl::Optional<double> const & next_timestamp() const;
+
+        /** Sets the timestamp of the next message. */
+        void set_next_timestamp(
+                ::libmuscle::impl::Optional<double> const & next_timestamp);
+
+        /** Returns the settings overlay carried by this message. */
+        DataConstRef const & settings_overlay() const;
+
+        /** Returns the sequence number of this message on its conduit. */
+        int message_number() const;
+
+        /** Sets the sequence number of this message on its conduit. */
+        void set_message_number(int message_number);
+
+        /** Returns the wallclock time until which the sender must keep
+         * the message available for resends. */
+        double saved_until() const;
+
+        /** Returns the codec the data payload was compressed with on
+         * the wire, or Codec::none for a message created from parts. */
+        Codec codec() const;
+
+        /** Returns the delta state of the data payload, see Delta. */
+        Delta delta() const;
+
+        /** Sets the delta state of the data payload. */
+        void set_delta(Delta delta);
+
+        /** Returns whether the data payload is a ClosePort signal.
+         *
+         * For a message created by from_bytes() whose sender wrote
+         * this into the envelope, this reads a flag and leaves the
+         * payload untouched, so a compressed payload stays compressed.
+         * Senders that predate the flag, and the Python implementation,
+         * don't write it; their messages have their payload inspected
+         * as before.
+         */
+        bool is_close_port() const;
+
+        /** Returns the data payload of this message.
+         *
+         * If the payload was compressed on the wire, the first call
+         * decompresses it.
+         */
+        DataConstRef const & data() const;
+
+        /** Returns the data payload, moving it out of this message.
+         *
+         * This is cheaper than copying the payload out via data(); the
+         * message must not be used afterwards.
+         */
+        DataConstRef take_data();
+
+        /** Encode the message and return as a byte buffer.
+         *
+         * If a codec other than Codec::none is given, then the data payload
+         * (but not the settings overlay) is compressed with it, and the
+         * codec id is included in the encoded message so that the receiver
+         * can decompress it. The receiver must support the codec; note that
+         * the Python implementation does not support compression at all.
+         *
+         * A message created by from_bytes() that has not been modified is
+         * passed through as the original encoded bytes, so forwarding a
+         * message does not re-encode it.
+         *
+         * Returns a byte_array in a DataConstRef.
+         *
+         * @param codec Codec to compress the data payload with.
+         */
+        DataConstRef encoded(Codec codec = Codec::none) const;
+
+        /** Returns the size of the encoded form this message came from.
+         *
+         * For a message created by from_bytes(), this is the size of
+         * those bytes, without decoding anything. For a message created
+         * from parts, which doesn't have an encoded form yet, it
+         * returns 0. Used for memory accounting, see instrumentation.
+         */
+        std::size_t encoded_size() const;
+
+        /** Re-targets an encoded message to a different receiver.
+         *
+         * Given the encoded form of a message, this produces the encoded
+         * form of the same message addressed to the given receiver,
+         * without decoding and re-encoding anything. Used on the fan-out
+         * send path, where the messages for the receivers of a
+         * multi-receiver send differ only in this field; see
+         * Communicator.
+         *
+         * This only works on bytes produced by encoded(), which writes
+         * the envelope fields in a known order. If the bytes are not in
+         * that form (e.g. a forwarded message encoded by someone else),
+         * then nothing is returned and the caller must encode the
+         * message in full.
+         *
+         * @param encoded An encoded message, see encoded().
+         * @param receiver The receiver to substitute.
+         * @return The re-targeted encoded message, if possible.
+         */
+        static ::libmuscle::impl::Optional<DataConstRef> encoded_with_receiver(
+                DataConstRef const & encoded,
+                ::ymmsl::Reference const & receiver);
+
+    private:
+        explicit MPPMessage(DataConstRef const & encoded_bytes);
+
+        void decode_() const;
+
+        // the buffer this message was created from, nil if it was
+        // created from parts
+        DataConstRef encoded_bytes_;
+        // whether the envelope fields below have been filled in
+        mutable bool decoded_;
+        // whether a field has been changed since decoding, which
+        // invalidates encoded_bytes_ as the encoded form
+        mutable bool modified_;
+        // codec the payload in data_ is (still) compressed with
+        mutable Codec codec_;
+        // codec the payload in encoded_bytes_ was compressed with
+        mutable Codec wire_codec_;
+        // delta state of the payload, see Delta
+        mutable Delta delta_;
+        // whether the payload is a ClosePort signal, unset until known
+        mutable ::libmuscle::impl::Optional<bool> close_port_;
+
+        mutable ::libmuscle::impl::Optional<::ymmsl::Reference> sender_;
+        mutable ::libmuscle::impl::Optional<::ymmsl::Reference> receiver_;
+        mutable ::libmuscle::impl::Optional<int> port_length_;
+        mutable double timestamp_;
+        mutable ::libmuscle::impl::Optional<double> next_timestamp_;
+        // DataConstRef isn't assignable, so the lazily filled members
+        // below are held by pointer, which is
+        mutable std::shared_ptr<DataConstRef> settings_overlay_;
+        mutable int message_number_;
+        mutable double saved_until_;
+        mutable std::shared_ptr<DataConstRef> data_;
+        // the still-compressed payload, kept when data() decompresses
+        // it so that re-encoding with the wire codec need not recompress
+        mutable std::shared_ptr<DataConstRef> compressed_data_;
 };
 
 } }
-
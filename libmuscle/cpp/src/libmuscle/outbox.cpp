@@ -1,50 +1,255 @@
 #include <libmuscle/outbox.hpp>
+#include <libmuscle/instrumentation.hpp>
+#include <libmuscle/mpp_message.hpp>
 #include <libmuscle/util.hpp>
 
-#include <mutex>
+#include <cstdint>
+#include <stdexcept>
 
+#include <sys/eventfd.h>
 #include <unistd.h>
 
 
 namespace libmuscle { namespace impl {
 
-Outbox::Outbox()
-    : notification_fd_(-1)
-{}
+Outbox::Outbox(std::size_t limit_bytes, bool spill, std::size_t retain_bytes)
+    : depth_(0u)
+    , queued_bytes_(0u)
+    , limit_bytes_(limit_bytes)
+    , spill_(spill)
+    , spill_file_(nullptr)
+    , spill_write_offset_(0u)
+    , spilled_in_flight_(0u)
+    , event_fd_(eventfd(0u, 0))
+    , notification_fd_(-1)
+    , retain_bytes_(retain_bytes)
+    , retained_bytes_(0u)
+{
+    if (event_fd_ == -1)
+        throw std::runtime_error("Error creating eventfd");
 
-std::unique_lock<std::mutex> Outbox::lock() {
-    return std::unique_lock<std::mutex>(mutex_);
+    // start with a consumed stub node, so producers always have a
+    // previous node to link to
+    Node_ * stub = new Node_;
+    stub->next.store(nullptr);
+    head_.store(stub);
+    tail_.store(stub);
+}
+
+Outbox::~Outbox() {
+    if (spill_file_ != nullptr)
+        fclose(spill_file_);
+    close(event_fd_);
+    Node_ * node = tail_.load();
+    while (node) {
+        Node_ * next = node->next.load();
+        delete node;
+        node = next;
+    }
 }
 
 bool Outbox::is_empty() const {
-    return queue_.empty();
+    return tail_.load()->next.load() == nullptr;
 }
 
 void Outbox::deposit(std::unique_ptr<DataConstRef> message) {
-    queue_.insert(queue_.begin(), std::move(message));
-    if (queue_.size() == 1u && notification_fd_ != -1) {
-        char dummy = '\0';
-        write(notification_fd_, &dummy, 1);
+    Node_ * node = new Node_;
+    node->next.store(nullptr);
+
+    if (limit_bytes_ > 0u) {
+        std::size_t message_bytes = message->size();
+        std::size_t queued = queued_bytes_.load(std::memory_order_relaxed);
+        if ((queued > 0u) && (queued + message_bytes > limit_bytes_)) {
+            if (spill_) {
+                spill_message_(*node, *message);
+                message.reset();
+            }
+            else {
+                // block until there's room; an oversized message is let
+                // through once the outbox drains completely, since it
+                // would otherwise never fit
+                std::unique_lock<std::mutex> lock(budget_mutex_);
+                space_available_.wait(lock, [this, message_bytes]() {
+                        std::size_t queued = queued_bytes_.load(
+                                std::memory_order_relaxed);
+                        return (queued == 0u) ||
+                               (queued + message_bytes <= limit_bytes_);
+                        });
+            }
+        }
+        if (message) {
+            node->message_bytes = message_bytes;
+            queued_bytes_.fetch_add(message_bytes, std::memory_order_relaxed);
+        }
+    }
+
+    // live gauge of in-memory backlog across all outboxes; spilled
+    // messages are on disk and don't count
+    if (message)
+        instrumentation::count(
+                instrumentation::counters().outbox_bytes, message->size());
+
+    node->message = std::move(message);
+
+    Node_ * prev = head_.exchange(node);
+    prev->next.store(node);
+
+    instrumentation::record_high_water(
+            instrumentation::counters().outbox_depth_high_water,
+            depth_.fetch_add(1u, std::memory_order_relaxed) + 1u);
+
+    // If the consumer armed an fd because it found us empty, notify it.
+    // The exchange makes this exactly-once, and sequential consistency
+    // of it and the linking store above rules out the case where we
+    // miss a concurrent arming while the consumer's re-check of
+    // is_empty() misses our deposit.
+    int fd = notification_fd_.exchange(-1);
+    if (fd != -1) {
+        uint64_t one = 1u;
+        write(fd, &one, sizeof(one));
     }
 }
 
 std::unique_ptr<DataConstRef> Outbox::retrieve() {
-    if (queue_.empty())
+    Node_ * stub = tail_.load();
+    Node_ * front = stub->next.load();
+    if (!front)
         throw std::runtime_error("Trying to retrieve from an empty outbox");
 
-    auto result = std::move(queue_.back());
-    queue_.pop_back();
+    std::unique_ptr<DataConstRef> result;
+    if (front->message) {
+        result = std::move(front->message);
+        instrumentation::uncount(
+                instrumentation::counters().outbox_bytes, result->size());
+        if (limit_bytes_ > 0u) {
+            queued_bytes_.fetch_sub(
+                    front->message_bytes, std::memory_order_relaxed);
+            // a producer may be blocked waiting for this space
+            { std::lock_guard<std::mutex> lock(budget_mutex_); }
+            space_available_.notify_all();
+        }
+    }
+    else
+        result = unspill_(front->spill_offset, front->spill_size);
+
+    if (retain_bytes_ > 0u)
+        retain_(*result);
+
+    tail_.store(front);
+    delete stub;
+    depth_.fetch_sub(1u, std::memory_order_relaxed);
+    return result;
+}
+
+std::vector<DataConstRef> Outbox::retained_for_retransmit() const {
+    std::lock_guard<std::mutex> lock(retained_mutex_);
+    std::vector<DataConstRef> result;
+    result.reserve(retained_.size());
+    for (auto const & retained : retained_)
+        result.push_back(retained.message);
     return result;
 }
 
+void Outbox::discard_retained_until(double saved_until) {
+    std::lock_guard<std::mutex> lock(retained_mutex_);
+    while (!retained_.empty() &&
+            (retained_.front().timestamp <= saved_until)) {
+        retained_bytes_ -= retained_.front().num_bytes;
+        retained_.pop_front();
+    }
+}
+
+/* Puts a copy of a retrieved message in the retransmission window.
+ *
+ * The copy shares the encoded buffer with the message just handed out,
+ * so the window adds bookkeeping, not payload memory. The timestamp
+ * comes from the message header; the payload is not decoded.
+ */
+void Outbox::retain_(DataConstRef const & message) {
+    double timestamp;
+    try {
+        timestamp = MPPMessage::from_bytes(message).timestamp();
+    }
+    catch (std::exception const &) {
+        // not an encoded MPP message; there's nothing we could resend
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(retained_mutex_);
+    retained_.push_back(Retained_{timestamp, message.size(), message});
+    retained_bytes_ += message.size();
+    // over the byte bound the oldest go first, but the newest always
+    // stays, like an oversized message in the main queue
+    while ((retained_bytes_ > retain_bytes_) && (retained_.size() > 1u)) {
+        retained_bytes_ -= retained_.front().num_bytes;
+        retained_.pop_front();
+    }
+}
+
+void Outbox::spill_message_(Node_ & node, DataConstRef const & message) {
+    std::lock_guard<std::mutex> lock(budget_mutex_);
+    if (spill_file_ == nullptr) {
+        spill_file_ = std::tmpfile();
+        if (spill_file_ == nullptr)
+            throw std::runtime_error("Error creating an outbox spill file");
+    }
+
+    std::size_t size = message.size();
+    char const * buf = message.as_byte_array();
+    int fd = fileno(spill_file_);
+    std::size_t num_written = 0u;
+    while (num_written < size) {
+        ssize_t res = pwrite(
+                fd, buf + num_written, size - num_written,
+                spill_write_offset_ + num_written);
+        if (res < 0)
+            throw std::runtime_error("Error spilling a message to disk");
+        num_written += res;
+    }
+
+    node.spill_offset = spill_write_offset_;
+    node.spill_size = size;
+    spill_write_offset_ += size;
+    spilled_in_flight_.fetch_add(1u);
+}
+
+std::unique_ptr<DataConstRef> Outbox::unspill_(
+        std::size_t offset, std::size_t size)
+{
+    auto bytes = std::make_unique<Data>(Data::byte_array(size));
+    char * buf = bytes->as_byte_array();
+    int fd = fileno(spill_file_);
+    std::size_t num_read = 0u;
+    while (num_read < size) {
+        ssize_t res = pread(
+                fd, buf + num_read, size - num_read, offset + num_read);
+        if (res <= 0)
+            throw std::runtime_error("Error reading back a spilled message");
+        num_read += res;
+    }
+
+    if (spilled_in_flight_.fetch_sub(1u) == 1u) {
+        // that was the last spilled message, reclaim the disk space
+        std::lock_guard<std::mutex> lock(budget_mutex_);
+        if (spilled_in_flight_.load() == 0u) {
+            ftruncate(fd, 0);
+            spill_write_offset_ = 0u;
+        }
+    }
+
+    return std::move(bytes);
+}
+
+int Outbox::event_fd() const {
+    return event_fd_;
+}
+
 void Outbox::set_notification_fd(int fd) {
-    notification_fd_ = fd;
+    notification_fd_.store(fd);
 }
 
 int Outbox::return_notification_fd() {
-    int old_fd = notification_fd_;
-    notification_fd_ = -1;
-    return old_fd;
+    return notification_fd_.exchange(-1);
 }
 
 } }
@@ -4,7 +4,10 @@
 
 #include <ymmsl/ymmsl.hpp>
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdio>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -17,32 +20,80 @@ namespace libmuscle { namespace impl {
  * An Outbox is a queue of messages, which may be deposited and then retrieved
  * in the same order.
  *
- * Outbox is thread-safe, so you can deposit and retrieve from different
- * threads without any additional locking.
+ * The queue is a lock-free multi-producer single-consumer linked list,
+ * so any number of threads may deposit concurrently without taking a
+ * lock, while a single thread (per outbox) retrieves. This keeps
+ * high-rate senders from stalling on a mutex held by the transport
+ * worker that is draining the box.
+ *
+ * The atomics use the default sequentially consistent ordering; the
+ * notification handshake between deposit() and set_notification_fd()
+ * needs it, see the comments in the implementation.
+ *
+ * Optionally, the amount of memory held by the queue can be bounded,
+ * so that a stalled receiver doesn't make the sending instance run out
+ * of memory. Once the budget is exceeded, deposits either block until
+ * the receiver catches up, or spill to a temporary file on disk, see
+ * the constructor.
  */
 class Outbox {
     public:
         /** Create an empty Outbox.
-         */
-        Outbox();
-
-        /** Lock this Outbox so other threads can't access it.
          *
-         * If multiple threads may access this object, then it must be locked
-         * while calling any member function.
+         * If limit_bytes is zero (the default), deposits are accepted
+         * without bound. If it is non-zero, then at most that many bytes
+         * of messages are held in memory. A deposit that would exceed
+         * the budget then blocks until enough messages have been
+         * retrieved, unless spill is true, in which case the overflowing
+         * message is written to an anonymous temporary file instead and
+         * read back on retrieve(), keeping memory use bounded without
+         * stalling the sender. A message larger than the whole budget is
+         * accepted once the outbox is empty, since it would otherwise
+         * never fit.
          *
-         * @return A unique_lock holding an internal mutex.
+         * The byte budget assumes that the deposited messages are byte
+         * arrays holding encoded messages, as deposited by the
+         * PostOffice; see deposit().
+         *
+         * If retain_bytes is non-zero, then retrieved messages are kept
+         * in a retransmission window of up to that many bytes, so that
+         * they can be sent again if the receiver restarts from a
+         * checkpoint. The retained copies share the encoded buffers
+         * with the messages handed out by retrieve(), so the window
+         * costs bookkeeping but no extra payload memory. Messages
+         * leave the window when a saved_until watermark covers them,
+         * see discard_retained_until(), or oldest-first when it would
+         * exceed its byte bound.
+         *
+         * @param limit_bytes Maximum bytes held in memory, 0 for no limit.
+         * @param spill Whether to spill to disk rather than block.
+         * @param retain_bytes Size of the retransmission window, 0 to
+         *      not retain retrieved messages.
+         */
+        explicit Outbox(
+                std::size_t limit_bytes = 0u, bool spill = false,
+                std::size_t retain_bytes = 0u);
+
+        /** Destruct an Outbox, freeing any remaining messages.
          */
-        std::unique_lock<std::mutex> lock();
+        ~Outbox();
 
         /** Returns true iff the outbox is empty.
+         *
+         * May be called from any thread, but note that a concurrent
+         * deposit() may not be visible yet.
          */
         bool is_empty() const;
 
         /** Put a message in the Outbox.
          *
          * The message will be placed at the back of a queue, and may be
-         * retrieved later via retrieve().
+         * retrieved later via retrieve(). If a notification fd is armed,
+         * it is disarmed and a byte is written to it.
+         *
+         * May be called from any thread. If a byte budget is set, then
+         * the message must be a byte array, and this may block or write
+         * the message to disk, see the constructor.
          *
          * @param message The message to store.
          */
@@ -54,28 +105,129 @@ class Outbox {
          * returned to the caller. It is an error if no message is present
          * in the queue.
          *
+         * Must only be called from the single consuming thread.
+         *
          * @return The next message.
          *
          * @throws std::runtime_error If no message is available.
          */
         std::unique_ptr<DataConstRef> retrieve();
 
-        /** Sets fd to notify deposition on.
+        /** Returns the contents of the retransmission window.
+         *
+         * These are the retrieved messages that no saved_until
+         * watermark has covered yet, oldest first; a recovery path can
+         * resend them to a receiver that restarted from a checkpoint.
+         * The returned copies share the encoded buffers with the
+         * retained ones. Empty unless a window was configured, see the
+         * constructor.
          *
-         * @param fd The fd to send a byte to when a message is deposited.
+         * May be called from any thread.
+         *
+         * @return Copies of the retained messages, in retrieval order.
+         */
+        std::vector<DataConstRef> retained_for_retransmit() const;
+
+        /** Drops retained messages covered by a checkpoint watermark.
+         *
+         * A receiver that told us it has saved its state up to
+         * saved_until will never need messages timestamped at or
+         * before that again, so they leave the retransmission window.
+         *
+         * May be called from any thread.
+         *
+         * @param saved_until The watermark received from the peer.
+         */
+        void discard_retained_until(double saved_until);
+
+        /** Returns this outbox's eventfd.
+         *
+         * A reader that finds the outbox empty can arm this fd via
+         * set_notification_fd() and then wait for it to become readable.
+         * Reading it yields an 8-byte count and resets it, per eventfd
+         * semantics.
+         *
+         * @return The eventfd, owned by this outbox.
+         */
+        int event_fd() const;
+
+        /** Arms an fd to notify the next deposit on.
+         *
+         * The next deposit will increment this eventfd and disarm it,
+         * so each armed fd is notified exactly once. After arming, the
+         * caller must re-check is_empty() and disarm again via
+         * return_notification_fd() if a deposit raced with the arming,
+         * see PostOffice::handle_request.
+         *
+         * @param fd The eventfd to notify when a message is deposited.
          */
         void set_notification_fd(int fd);
 
-        /** Resets notification fd and returns original value.
+        /** Disarms the notification fd and returns it.
          *
-         * @return The current notification fd.
+         * @return The armed fd, or -1 if there was none or a deposit
+         *         already notified it.
          */
         int return_notification_fd();
 
     private:
-        mutable std::mutex mutex_;
-        std::vector<std::unique_ptr<DataConstRef>> queue_;
-        int notification_fd_;
+        struct Node_ {
+            std::atomic<Node_ *> next;
+            // the message, or nullptr if it was spilled to disk
+            std::unique_ptr<DataConstRef> message;
+            // size of an in-memory message, for the byte budget
+            std::size_t message_bytes = 0u;
+            // where to find a spilled message in the spill file
+            std::size_t spill_offset = 0u;
+            std::size_t spill_size = 0u;
+        };
+
+        // a retrieved message in the retransmission window
+        struct Retained_ {
+            double timestamp;
+            std::size_t num_bytes;
+            DataConstRef message;
+        };
+
+        // puts a copy of a retrieved message in the window
+        void retain_(DataConstRef const & message);
+
+        // writes the message to the spill file and records its location
+        void spill_message_(Node_ & node, DataConstRef const & message);
+
+        // reads a spilled message back from the spill file
+        std::unique_ptr<DataConstRef> unspill_(
+                std::size_t offset, std::size_t size);
+
+        // Producers push onto head_; the consumer pops from tail_, which
+        // points at an already consumed stub node whose next is the
+        // front of the queue.
+        std::atomic<Node_ *> head_;
+        std::atomic<Node_ *> tail_;
+        // current queue depth, for the instrumentation high-water mark
+        std::atomic<std::size_t> depth_;
+        // bytes of in-memory messages currently queued
+        std::atomic<std::size_t> queued_bytes_;
+        std::size_t limit_bytes_;
+        bool spill_;
+        // protects the spill file and the blocking wait; only taken
+        // once the budget is exceeded, so not on the fast path
+        std::mutex budget_mutex_;
+        std::condition_variable space_available_;
+        std::FILE * spill_file_;
+        std::size_t spill_write_offset_;
+        // number of spilled messages not yet retrieved; when it drops
+        // to zero the spill file is truncated to reclaim disk space
+        std::atomic<std::size_t> spilled_in_flight_;
+        int event_fd_;
+        std::atomic<int> notification_fd_;
+        // the retransmission window, bounded by retain_bytes_; not on
+        // the fast path, the mutex is only taken when a window is
+        // configured
+        std::size_t retain_bytes_;
+        std::size_t retained_bytes_;
+        std::deque<Retained_> retained_;
+        mutable std::mutex retained_mutex_;
 };
 
 } }
@@ -1,5 +1,6 @@
 #include <libmuscle/peer_manager.hpp>
 
+#include <atomic>
 #include <sstream>
 
 using ymmsl::Conduit;
@@ -7,6 +8,21 @@ using ymmsl::Identifier;
 using ymmsl::Reference;
 
 
+namespace {
+
+/* Returns a process-wide unique id for a new PeerManager snapshot.
+ *
+ * Ids start at 1, so that a default-constructed cache entry, whose id
+ * is 0, never matches a snapshot.
+ */
+std::uint64_t next_id_() {
+    static std::atomic<std::uint64_t> next_id(1u);
+    return next_id++;
+}
+
+}
+
+
 namespace libmuscle { namespace impl {
 
 PeerManager::PeerManager(
@@ -21,7 +37,11 @@ PeerManager::PeerManager(
     , peers_()                          // peer port ids, indexed by local kernel.port
     , peer_dims_(peer_dims)             // indexed by peer kernel id
     , peer_locations_(peer_locations)   // indexed by peer instance id
+    , id_(next_id_())
 {
+    // at most two entries per conduit, and large models have tens of
+    // thousands of them; size the table once rather than rehashing
+    peers_.reserve(conduits.size());
     for (auto const & conduit : conduits) {
         if (conduit.sending_component() == kernel_) {
             // we send on the port this conduit attaches to
@@ -65,15 +85,42 @@ std::vector<std::string> PeerManager::get_peer_locations(
     return peer_locations_.at(peer_instance);
 }
 
-std::vector<Endpoint> PeerManager::get_peer_endpoints(
+std::vector<Endpoint> const & PeerManager::get_peer_endpoints(
         Identifier const & port,
         std::vector<int> const & slot
         ) const
 {
-    auto peers = peers_.at(kernel_ + port);
+    // The conduit topology is fixed after construction, so repeated
+    // requests for the same port and slot are served from a cache.
+    // Each thread memoises the results it has seen in its own cache,
+    // keeping this a plain read without synchronisation between
+    // threads, like the other queries on this immutable snapshot. The
+    // id check empties the cache when a new snapshot reuses the
+    // address of an old one.
+    using PortCache_ = std::unordered_map<
+            Identifier, std::map<std::vector<int>, std::vector<Endpoint>>>;
+    struct ThreadCache_ {
+        std::uint64_t id = 0u;
+        PortCache_ ports;
+    };
+    static thread_local std::unordered_map<
+            PeerManager const *, ThreadCache_> cache;
+
+    auto & entry = cache[this];
+    if (entry.id != id_) {
+        entry.id = id_;
+        entry.ports.clear();
+    }
+
+    auto & by_slot = entry.ports[port];
+    auto cached = by_slot.find(slot);
+    if (cached != by_slot.end())
+        return cached->second;
+
+    auto const & peers = peers_.at(kernel_ + port);
     std::vector<Endpoint> endpoints;
 
-    for (auto peer : peers) {
+    for (auto const & peer : peers) {
         Reference peer_kernel(peer.cbegin(), std::prev(peer.cend()));
         Identifier peer_port = std::prev(peer.cend())->identifier();
 
@@ -88,7 +135,7 @@ std::vector<Endpoint> PeerManager::get_peer_endpoints(
         endpoints.emplace_back(peer_kernel, peer_index, peer_port, peer_slot);
     }
 
-    return endpoints;
+    return by_slot.emplace(slot, std::move(endpoints)).first->second;
 }
 
 } }
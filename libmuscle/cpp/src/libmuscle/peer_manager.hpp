@@ -8,6 +8,8 @@
 
 #include <libmuscle/endpoint.hpp>
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -21,6 +23,13 @@ using PeerLocations = std::unordered_map<
 
 
 /** Manages information about peers for a Communicator.
+ *
+ * A PeerManager is an immutable snapshot: it is filled at construction
+ * and never modified after that. The Communicator publishes a fresh
+ * snapshot when it (re)connects, rather than updating the old one, so
+ * the queries here, which are made on every send and receive, are
+ * plain reads that any number of threads can do concurrently without
+ * synchronisation.
  */
 class PeerManager {
     public:
@@ -78,12 +87,19 @@ class PeerManager {
                 ymmsl::Reference const & peer_instance) const;
 
         /** Determine the peer endpoints for the given port and slot.
+         *
+         * The conduit topology is fixed after construction, so results
+         * are computed once per port and slot and served from a cache
+         * after that. The cache is kept per thread, so that this stays
+         * a synchronisation-free plain read like the other queries;
+         * the returned reference is valid for as long as this
+         * PeerManager exists, on the thread that made the call.
          *
          * @param port The port on our side to send or receive on.
          * @param slot The slot to send or receive on.
          * @return The peer endpoints.
          */
-        std::vector<Endpoint> get_peer_endpoints(
+        std::vector<Endpoint> const & get_peer_endpoints(
                 ymmsl::Identifier const & port,
                 std::vector<int> const & slot) const;
 
@@ -93,6 +109,10 @@ class PeerManager {
         std::unordered_map<ymmsl::Reference, std::vector<ymmsl::Reference>> peers_;
         PeerDims peer_dims_;
         PeerLocations peer_locations_;
+
+        // distinguishes snapshots in the per-thread endpoint caches; a
+        // new object at a reused address must not see stale entries
+        std::uint64_t id_;
 };
 
 } }
@@ -17,6 +17,12 @@ template< typename T>
 inline void extend_vector_to_size(
         std::vector<T> &vec, const int minsize, const T &val) {
     if(static_cast<int>(vec.size()) < minsize) {
+        // grow capacity geometrically, so that a port that is resized
+        // repeatedly pays amortised O(1) per slot rather than a
+        // reallocation per resize
+        if (static_cast<std::size_t>(minsize) > vec.capacity())
+            vec.reserve(std::max(
+                    vec.capacity() * 2u, static_cast<std::size_t>(minsize)));
         vec.resize(minsize, val);
     }
 }
@@ -48,7 +54,7 @@ Port::Port(
             throw std::runtime_error("Port '"s + name + "' is connected to an"
                     + " instance set with more than one dimension more than"
                     + " its own, which is not possible.");
-        is_open_ = std::vector<bool>(length_, true);
+        is_open_ = std::vector<char>(length_, 1);
     }
     else {
         if (our_ndims < static_cast<int>(peer_dims.size()))
@@ -62,12 +68,12 @@ Port::Port(
                     + " to an instance set with at least two fewer dimensions,"
                     + " which is not possible.");
         length_ = -1;
-        is_open_.push_back(true);
+        is_open_.push_back(1);
     }
 
     is_resizable_ = is_vector && (our_ndims == static_cast<int>(peer_dims.size()));
     num_messages_.resize(std::max(1, length_), 0);
-    is_resuming_.resize(std::max(1, length_), false);
+    is_resuming_.resize(std::max(1, length_), 0);
 }
 
 bool Port::is_connected() const {
@@ -108,12 +114,20 @@ void Port::set_length(int length) {
                 + " not resizable");
     if (length != length_) {
         length_ = length;
-        is_open_ = std::vector<bool>(length_, true);
+        // assign() reuses the existing allocation where it can, and we
+        // grow capacity geometrically and never shrink it, so that an
+        // ensemble that resizes back and forth reallocates these
+        // tables only O(log n) times rather than on every resize
+        if (static_cast<std::size_t>(length_) > is_open_.capacity())
+            is_open_.reserve(std::max(
+                    is_open_.capacity() * 2u,
+                    static_cast<std::size_t>(length_)));
+        is_open_.assign(length_, 1);
         // Using extend here to not discard any information about message
         // numbers between resizes. Note that _num_messages and _is_resuming
         // may be longer than self._length!
         extend_vector_to_size(num_messages_, std::max(1, length_), 0);
-        extend_vector_to_size(is_resuming_, std::max(1, length_), false);
+        extend_vector_to_size(is_resuming_, std::max(1, length_), char(0));
     }
 }
 
@@ -128,9 +142,9 @@ void Port::set_closed(int slot) {
 void Port::restore_message_counts(const std::vector<int> &num_messages) {
     num_messages_ = std::vector<int>(num_messages);
     is_resuming_.clear();
-    is_resuming_.resize(num_messages_.size(), true);
+    is_resuming_.resize(num_messages_.size(), 1);
     extend_vector_to_size(num_messages_, std::max(1, length_), 0);
-    extend_vector_to_size(is_resuming_, std::max(1, length_), false);
+    extend_vector_to_size(is_resuming_, std::max(1, length_), char(0));
 }
 
 const std::vector<int> & Port::get_message_counts() const {
@@ -15,6 +15,13 @@ namespace libmuscle { namespace impl {
  * Ports keep track of the amount of messages sent or received on the port.
  * However, the actual incrementing and validation is done in
  * Communicator.
+ *
+ * Per-slot state (message counters and open/resuming flags) is kept in
+ * flat arrays indexed directly by slot, so maintaining it is a single
+ * array access on every message. Each slot's state is a distinct memory
+ * location, so different threads may drive different slots concurrently
+ * without synchronisation, see Instance; operations on the port as a
+ * whole (resizing, restoring counts) are not thread-safe.
  */
 class Port : public ::ymmsl::Port {
     public:
@@ -149,9 +156,12 @@ class Port : public ::ymmsl::Port {
         bool is_connected_;
         int length_;
         bool is_resizable_;
-        std::vector<bool> is_open_;
+        // one char per slot rather than vector<bool>'s packed bits, so
+        // that closing or resuming different slots from different
+        // threads touches distinct memory locations
+        std::vector<char> is_open_;
         std::vector<int> num_messages_;
-        std::vector<bool> is_resuming_;
+        std::vector<char> is_resuming_;
 };
 
 } }
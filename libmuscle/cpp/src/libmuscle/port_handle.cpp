@@ -0,0 +1,14 @@
+#include <libmuscle/port_handle.hpp>
+
+
+namespace libmuscle { namespace impl {
+
+std::string const & PortHandle::name() const {
+    return state_->name;
+}
+
+PortHandle::PortHandle(std::shared_ptr<State_> state)
+    : state_(state)
+{}
+
+} }
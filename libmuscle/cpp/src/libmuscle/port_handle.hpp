@@ -0,0 +1,74 @@
+#pragma once
+
+#include <libmuscle/compression.hpp>
+#include <libmuscle/endpoint.hpp>
+#include <libmuscle/port.hpp>
+#include <libmuscle/util.hpp>
+
+#include <ymmsl/ymmsl.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace libmuscle { namespace impl {
+
+/** A pre-resolved reference to a port of this instance.
+ *
+ * Sending or receiving by name looks the port up in a string-keyed map,
+ * validates the name, and resolves the peer endpoints on every call. For
+ * tightly coupled models that exchange many small messages, that
+ * bookkeeping is measurable. A PortHandle does it once, up front, so that
+ * the send() and receive() overloads on Instance that take a handle can
+ * skip it on every message.
+ *
+ * Obtain a handle from Instance::port(). It remains valid until the
+ * Instance it was obtained from is destroyed.
+ */
+class PortHandle {
+    public:
+        /** Return the name of the port this handle refers to.
+         */
+        std::string const & name() const;
+
+    private:
+#ifdef LIBMUSCLE_MOCK_COMMUNICATOR
+        friend class MockCommunicator;
+#else
+        friend class Communicator;
+#endif
+        friend class Instance;
+
+        /* Everything the per-message path would otherwise look up by
+         * name. The Port lives in the Communicator's port map, which does
+         * not change once the instance is connected, so the pointer is
+         * stable. The cached endpoints are for slotless operation; slots
+         * vary per call, so slotted endpoints are still built on the fly.
+         */
+        struct State_ {
+            State_(
+                    std::string const & name,
+                    ymmsl::Identifier const & port_id, Port * port)
+                : name(name), port_id(port_id), port(port)
+                , codec(Codec::none), delta_interval(0), prefetch_depth(1)
+                , connected(false)
+            {}
+
+            std::string name;
+            ymmsl::Identifier port_id;
+            Port * port;
+            Codec codec;
+            int delta_interval;
+            int prefetch_depth;
+            bool connected;
+            Optional<Endpoint> self_endpoint;
+            std::vector<Endpoint> peer_endpoints;
+        };
+
+        explicit PortHandle(std::shared_ptr<State_> state);
+
+        std::shared_ptr<State_> state_;
+};
+
+} }
@@ -1,3 +1,6 @@
+#pragma once
+
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -32,5 +35,47 @@ namespace libmuscle { namespace impl {
  */
 using PortsDescription = std::unordered_map<ymmsl::Operator, std::vector<std::string>>;
 
+
+/** A port declaration that can be a compile-time constant.
+ *
+ * See ports_description() below.
+ */
+struct PortDecl {
+    ::ymmsl::Operator oper;     ///< The operator the port belongs to.
+    char const * name;          ///< The name of the port, without suffix.
+    bool is_vector;             ///< Whether this is a vector port.
+};
+
+/** Builds a PortsDescription from a static table of declarations.
+ *
+ * For a component whose coupling topology is fixed, the ports can be
+ * declared once as a table of compile-time constants:
+ *
+ * \code{.cpp}
+ * constexpr PortDecl port_decls[] = {
+ *         {Operator::F_INIT, "port1", false},
+ *         {Operator::F_INIT, "port2", false},
+ *         {Operator::O_F, "port3", true}};
+ *
+ * Instance instance(argc, argv, ports_description(port_decls));
+ * \endcode
+ *
+ * This is equivalent to spelling out the PortsDescription above with
+ * "[]" appended to the vector ports' names, but whether a port is a
+ * vector is an explicit constant rather than a suffix to be parsed,
+ * so a typo in it cannot survive to run time.
+ *
+ * @param decls The port declarations.
+ * @return The corresponding PortsDescription.
+ */
+template <std::size_t N>
+PortsDescription ports_description(PortDecl const (& decls)[N]) {
+    PortsDescription ports;
+    for (PortDecl const & decl : decls)
+        ports[decl.oper].emplace_back(
+                decl.is_vector ? std::string(decl.name) + "[]" : decl.name);
+    return ports;
+}
+
 } }
 
@@ -3,9 +3,12 @@
 #include <libmuscle/data.hpp>
 #include <libmuscle/mcp/data_pack.hpp>
 #include <libmuscle/mcp/protocol.hpp>
+#include <libmuscle/mpp_message.hpp>
 
 #include <chrono>
+#include <cstdlib>
 #include <memory>
+#include <stdexcept>
 #include <thread>
 #include <unistd.h>
 
@@ -15,130 +18,334 @@
 using ymmsl::Reference;
 
 
-namespace libmuscle { namespace impl {
+namespace {
 
-Pipe::Pipe() {
-    int pipe_fds[2];
-    int err = pipe(pipe_fds);
-    if (err != 0)
-        throw std::runtime_error("Error creating pipe");
+using libmuscle::impl::DataConstRef;
+using libmuscle::impl::MPPMessage;
 
-    sending_fd = pipe_fds[1];
-    receiving_fd = pipe_fds[0];
+/* Re-encodes a message with only the requested region of its payload.
+ *
+ * If the payload is not a grid, or the region does not fit inside it,
+ * then the message is returned unchanged and the receiver gets the
+ * full payload; it can tell the difference by inspecting the data it
+ * receives.
+ */
+std::unique_ptr<DataConstRef> apply_slice_(
+        std::unique_ptr<DataConstRef> message,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & extents)
+{
+    auto msg = MPPMessage::from_bytes(*message);
+    try {
+        MPPMessage sliced(
+                msg.sender(), msg.receiver(), msg.port_length(),
+                msg.timestamp(), msg.next_timestamp(),
+                msg.settings_overlay(), msg.message_number(),
+                msg.saved_until(), msg.data().sub_grid(offsets, extents));
+        return std::make_unique<DataConstRef>(sliced.encoded(msg.codec()));
+    }
+    catch (std::out_of_range const &) {
+        // the region does not fit the payload, send the message in full
+    }
+    catch (std::runtime_error const &) {
+        // the payload is not a grid, send the message in full
+    }
+    return message;
 }
 
-Pipe::Pipe(int sending_fd, int receiving_fd)
-    : sending_fd(sending_fd)
-    , receiving_fd(receiving_fd)
-{}
+/* Tells the CPU we're in a spin-wait loop.
+ *
+ * This backs off speculative execution and yields pipeline resources
+ * to the sibling hyperthread, which may well be the depositing one.
+ * On other architectures it's a plain busy-wait, which still works.
+ */
+inline void cpu_relax_() {
+#if defined(__x86_64__) || defined(__i386__)
+    asm volatile("pause");
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
 
-void Pipe::close() {
-    ::close(sending_fd);
-    ::close(receiving_fd);
 }
 
 
-PostOffice::~PostOffice() {
-    for (auto & pipe : pipes_)
-        pipe.close();
+namespace libmuscle { namespace impl {
+
+PostOffice::PostOffice()
+    : outbox_limit_bytes_(0u)
+    , retain_bytes_(0u)
+    , outbox_spill_(getenv("MUSCLE_OUTBOX_SPILL") != nullptr)
+    , spin_us_(10)
+{
+    char const * limit_str = getenv("MUSCLE_OUTBOX_LIMIT");
+    if (limit_str != nullptr)
+        outbox_limit_bytes_ = strtoull(limit_str, nullptr, 10);
+
+    char const * retain_str = getenv("MUSCLE_RETRANSMIT_WINDOW");
+    if (retain_str != nullptr)
+        retain_bytes_ = strtoull(retain_str, nullptr, 10);
+
+    char const * spin_str = getenv("MUSCLE_OUTBOX_SPIN_US");
+    if (spin_str != nullptr)
+        spin_us_ = atoi(spin_str);
 }
 
 int PostOffice::handle_request(
         char const * req_buf, std::size_t req_len,
         std::unique_ptr<DataConstRef> & res_buf
 ) {
-    auto zone = std::make_shared<msgpack::zone>();
-    auto request = mcp::unpack_data(zone, req_buf, req_len);
-    if (
-            !request.is_a_list() || request.size() != 2 ||
-            (request[0].as<int>() != static_cast<int>(RequestType::get_next_message)))
-        throw std::runtime_error(
-                "Invalid request type. Did the streams get crossed?");
-
-    Reference receiver(request[1].as<std::string>());
-    auto & outbox = get_outbox_(receiver);
-
-    auto lock = outbox.lock();
+    // Requests for a given receiver are byte-identical, so the raw
+    // request bytes identify the outbox; a memo of them skips the
+    // msgpack decode and the Reference construction on all but the
+    // first request for each receiver. Sliced requests embed the
+    // requested region, so they take the slow path below.
+    std::string request_bytes(req_buf, req_len);
+    Shard_ & request_shard = shards_[
+            std::hash<std::string>()(request_bytes) % num_shards_];
+    Outbox * outbox_ptr;
+    {
+        std::lock_guard<std::mutex> lock(request_shard.mutex);
+        auto it = request_shard.requests.find(request_bytes);
+        outbox_ptr = (it != request_shard.requests.end())
+            ? it->second : nullptr;
+    }
+
+    bool sliced = false;
+    int batch_max = 0;
+    std::vector<std::size_t> slice_offsets, slice_extents;
+    if (!outbox_ptr) {
+        auto request = mcp::unpack_data(req_buf, req_len);
+        if (
+                !request.is_a_list() ||
+                (request.size() < 2 || request.size() > 4) ||
+                (request[0].as<int>() != static_cast<int>(RequestType::get_next_message)))
+            throw std::runtime_error(
+                    "Invalid request type. Did the streams get crossed?");
+
+        Reference receiver(request[1].as<std::string>());
+
+        // a four-element request also gives a region of a grid payload
+        // that the receiver wants to restrict the response to, see
+        // apply_slice_()
+        sliced = request.size() == 4;
+        if (sliced) {
+            for (std::size_t i = 0u; i < request[2].size(); ++i)
+                slice_offsets.push_back(request[2][i].as<std::size_t>());
+            for (std::size_t i = 0u; i < request[3].size(); ++i)
+                slice_extents.push_back(request[3][i].as<std::size_t>());
+        }
+
+        // a three-element request asks for a batch: up to that many
+        // messages in one response, see make_response_()
+        if (request.size() == 3)
+            batch_max = request[2].as<int>();
+
+        outbox_ptr = &get_outbox_(receiver);
+
+        // outboxes live until the PostOffice is destructed, so the
+        // cached pointer stays valid
+        if (!sliced && batch_max == 0) {
+            std::lock_guard<std::mutex> lock(request_shard.mutex);
+            request_shard.requests.emplace(
+                    std::move(request_bytes), outbox_ptr);
+        }
+    }
+
+    auto & outbox = *outbox_ptr;
+
+    // During a bursty exchange phase the next message is usually
+    // already on its way, so spin briefly before setting up the
+    // deferred-response machinery; answering within the deposit's own
+    // microsecond beats the eventfd write and epoll wakeup that a
+    // deferral costs. The window is bounded, so a genuinely idle
+    // connection still ends up blocking as before.
+    if (outbox.is_empty())
+        spin_for_deposit_(outbox);
+
     if (!outbox.is_empty()) {
-        auto msg = outbox.retrieve();
-        res_buf = std::move(msg);
-        retrieved_.notify_one();
+        res_buf = make_response_(
+                outbox, sliced, slice_offsets, slice_extents, batch_max);
         return -1;
     }
-    else {
-        auto pipe = get_pipe_();
-        outbox.set_notification_fd(pipe.sending_fd);
-        pending_outboxes_[pipe.receiving_fd] = &outbox;
-        return pipe.receiving_fd;
-    }
-}
 
-std::unique_ptr<DataConstRef> PostOffice::get_response(int fd) {
-    Outbox * outbox = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(outboxes_mutex_);
-        auto outbox_it = pending_outboxes_.find(fd);
-        outbox = outbox_it->second;
-        pending_outboxes_.erase(outbox_it);
+    // each outbox has its own eventfd, so there's no pipe to allocate,
+    // and depositing is a single write to it
+    outbox.set_notification_fd(outbox.event_fd());
+
+    // a deposit may have raced with the emptiness check and the arming
+    // above; re-check, and if we can disarm then no one was notified
+    // and we can answer right away after all
+    if (!outbox.is_empty() && outbox.return_notification_fd() != -1) {
+        res_buf = make_response_(
+                outbox, sliced, slice_offsets, slice_extents, batch_max);
+        return -1;
     }
 
-    int sending_fd;
-    std::unique_ptr<DataConstRef> result;
     {
-        auto lock = outbox->lock();
-        sending_fd = outbox->return_notification_fd();
-        result = outbox->retrieve();
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        pending_outboxes_[outbox.event_fd()] = PendingRequest_{
+                &outbox, sliced,
+                std::move(slice_offsets), std::move(slice_extents),
+                batch_max};
     }
+    return outbox.event_fd();
+}
 
-    return_pipe_(Pipe(sending_fd, fd));
+/* Builds a response from a non-empty outbox.
+ *
+ * For a plain request this retrieves one message; for a slice request
+ * it then cuts the requested region out, see apply_slice_(). For a
+ * batch request, any further messages already in the outbox ride
+ * along, up to the requested maximum, and the response is a packed
+ * list of encoded messages instead of a single one. A batch response
+ * holds at least one message; the requester blocks for the first one
+ * as usual, the rest come along for free.
+ */
+std::unique_ptr<DataConstRef> PostOffice::make_response_(
+        Outbox & outbox, bool sliced,
+        std::vector<std::size_t> const & slice_offsets,
+        std::vector<std::size_t> const & slice_extents,
+        int batch_max)
+{
+    auto result = outbox.retrieve();
+    if (sliced)
+        result = apply_slice_(
+                std::move(result), slice_offsets, slice_extents);
+    if (batch_max > 0) {
+        std::vector<std::unique_ptr<DataConstRef>> messages;
+        messages.push_back(std::move(result));
+        while (
+                messages.size() < static_cast<std::size_t>(batch_max) &&
+                !outbox.is_empty())
+            messages.push_back(outbox.retrieve());
+
+        // non-owning views suffice here, pack_data_exact copies the
+        // bytes into the response and messages outlives the packing
+        Data batch = Data::nils(messages.size());
+        for (std::size_t i = 0u; i < messages.size(); ++i)
+            batch[i] = Data::byte_array(
+                    messages[i]->as_byte_array(), messages[i]->size());
+        result = std::make_unique<DataConstRef>(mcp::pack_data_exact(batch));
+    }
     retrieved_.notify_one();
     return result;
 }
 
+/* Spins until the outbox has a message or the spin window closes.
+ *
+ * The clock is only checked once every few iterations, since reading
+ * it costs more than the pause instructions it meters.
+ */
+void PostOffice::spin_for_deposit_(Outbox const & outbox) const {
+    if (spin_us_ <= 0)
+        return;
+    auto deadline = std::chrono::steady_clock::now()
+            + std::chrono::microseconds(spin_us_);
+    while (outbox.is_empty()) {
+        for (int i = 0; i < 16; ++i)
+            cpu_relax_();
+        if (std::chrono::steady_clock::now() >= deadline)
+            break;
+    }
+}
+
+std::unique_ptr<DataConstRef> PostOffice::get_response(int fd) {
+    Outbox * outbox;
+    bool sliced;
+    int batch_max;
+    std::vector<std::size_t> slice_offsets, slice_extents;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        auto pending_it = pending_outboxes_.find(fd);
+        outbox = pending_it->second.outbox;
+        sliced = pending_it->second.sliced;
+        batch_max = pending_it->second.batch_max;
+        slice_offsets = std::move(pending_it->second.slice_offsets);
+        slice_extents = std::move(pending_it->second.slice_extents);
+        pending_outboxes_.erase(pending_it);
+    }
+
+    return make_response_(
+            *outbox, sliced, slice_offsets, slice_extents, batch_max);
+}
+
 void PostOffice::deposit(
         Reference const & receiver, std::unique_ptr<DataConstRef> message) {
     Outbox & outbox = get_outbox_(receiver);
-    auto lock = outbox.lock();
     outbox.deposit(std::move(message));
 }
 
+void PostOffice::deposit_batch(
+        std::vector<std::pair<Reference, std::unique_ptr<DataConstRef>>>
+        messages)
+{
+    // look up (and if needed create) all outboxes shard by shard, so
+    // we take each shard's lock at most once rather than once per
+    // receiver
+    std::vector<Outbox *> boxes(messages.size());
+    for (auto & shard : shards_) {
+        std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+        for (std::size_t i = 0u; i < messages.size(); ++i) {
+            auto const & receiver = messages[i].first;
+            if (&shard_(receiver) != &shard)
+                continue;
+            if (!lock.owns_lock())
+                lock.lock();
+            auto & outbox = shard.outboxes[receiver];
+            if (!outbox)
+                outbox = std::make_unique<Outbox>(
+                        outbox_limit_bytes_, outbox_spill_, retain_bytes_);
+            boxes[i] = outbox.get();
+        }
+    }
+
+    for (std::size_t i = 0u; i < messages.size(); ++i)
+        boxes[i]->deposit(std::move(messages[i].second));
+}
+
 void PostOffice::wait_for_receivers() const {
-    std::unique_lock<std::mutex> lock(outboxes_mutex_);
+    std::unique_lock<std::mutex> lock(pending_mutex_);
     while (true) {
         bool done = true;
-        for (auto const & ref_outbox : outboxes_) {
-            auto & outbox = ref_outbox.second;
-            {
-                auto outbox_lock = outbox->lock();
-                done &= outbox->is_empty();
-            }
+        for (auto const & shard : shards_) {
+            std::lock_guard<std::mutex> shard_lock(shard.mutex);
+            for (auto const & ref_outbox : shard.outboxes)
+                done &= ref_outbox.second->is_empty();
         }
         if (done) break;
         retrieved_.wait(lock);
     }
 }
 
-Outbox & PostOffice::get_outbox_(Reference const & receiver) {
-    std::unique_lock<std::mutex> lock(outboxes_mutex_);
-    if (outboxes_.count(receiver) == 0)
-        outboxes_.emplace(receiver, std::make_unique<Outbox>());
-    return *outboxes_[receiver].get();
+void PostOffice::discard_retransmits_until(double saved_until) {
+    if (retain_bytes_ == 0u)
+        return;
+    for (auto & shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto & ref_outbox : shard.outboxes)
+            ref_outbox.second->discard_retained_until(saved_until);
+    }
 }
 
-Pipe PostOffice::get_pipe_() {
-    std::lock_guard<std::mutex> lock(pipes_mutex_);
-    if (pipes_.empty())
-        return Pipe();
-    else {
-        Pipe result(pipes_.back());
-        pipes_.pop_back();
-        return result;
-    }
+std::vector<DataConstRef> PostOffice::retained_for_retransmit(
+        Reference const & receiver)
+{
+    return get_outbox_(receiver).retained_for_retransmit();
+}
+
+Outbox & PostOffice::get_outbox_(Reference const & receiver) {
+    Shard_ & shard = shard_(receiver);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto & outbox = shard.outboxes[receiver];
+    if (!outbox)
+        outbox = std::make_unique<Outbox>(
+                outbox_limit_bytes_, outbox_spill_, retain_bytes_);
+    return *outbox;
 }
 
-void PostOffice::return_pipe_(Pipe const & pipe) {
-    std::lock_guard<std::mutex> lock(pipes_mutex_);
-    pipes_.push_back(pipe);
+PostOffice::Shard_ & PostOffice::shard_(Reference const & receiver) {
+    return shards_[std::hash<Reference>()(receiver) % num_shards_];
 }
 
 } }
@@ -12,33 +12,18 @@
 #include <msgpack.hpp>
 #include <ymmsl/ymmsl.hpp>
 
+#include <array>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 
 namespace libmuscle { namespace impl {
 
-/** Helper class for managing pipes.
- *
- * Contains a connected pair of open file descriptors, which can be used for
- * one-way communication.
- */
-struct Pipe {
-    /** Sending and receiving fds. */
-    int sending_fd, receiving_fd;
-
-    /** Create a Pipe with freshly allocated fds. */
-    Pipe();
-
-    /** Create a Pipe from the given fds. */
-    Pipe(int sending_fd, int receiving_fd);
-
-    /** Close file descriptors. */
-    void close();
-};
-
-
 /** Holds messages to be retrieved.
  *
  * A PostOffice holds outboxes with messages for receivers.
@@ -46,14 +31,49 @@ struct Pipe {
 class PostOffice : public mcp::RequestHandler {
     public:
         /** Create a PostOffice.
+         *
+         * The outboxes' memory budget is read from the environment: if
+         * MUSCLE_OUTBOX_LIMIT is set, then each outbox holds at most
+         * that many bytes of messages in memory, and deposits beyond
+         * that block until the receiver catches up, or spill to a
+         * temporary file if MUSCLE_OUTBOX_SPILL is also set. See Outbox.
+         *
+         * MUSCLE_OUTBOX_SPIN_US sets how long handle_request() spins
+         * waiting for a deposit on an empty outbox before deferring the
+         * response, in microseconds; 0 disables spinning. The default
+         * is 10.
+         *
+         * If MUSCLE_RETRANSMIT_WINDOW is set, then each outbox keeps
+         * up to that many bytes of retrieved messages in a
+         * retransmission window, for resending to a receiver that
+         * restarts from a checkpoint; see Outbox and
+         * discard_retransmits_until().
          */
-        PostOffice() = default;
+        PostOffice();
 
         /** Destruct a PostOffice.
          */
-        virtual ~PostOffice();
+        virtual ~PostOffice() = default;
 
         /** Handle a request
+         *
+         * A request is a list [RequestType::get_next_message, receiver],
+         * optionally extended with two lists of integers giving the
+         * offsets and extents of a region of a grid payload. For such a
+         * slice request, if the message's payload is a grid that
+         * contains the region, the response is the message re-encoded
+         * with just that region as a grid block; otherwise the message
+         * is sent in full. This lets a receiver that needs only a small
+         * part of a large grid, e.g. a halo region, avoid transferring
+         * the rest.
+         *
+         * Alternatively, the list may be extended with a single integer
+         * giving a maximum number of messages. For such a batch
+         * request, the response is a packed list of encoded messages:
+         * the next message for the receiver, plus any further messages
+         * already queued for it, up to the given maximum. A consumer
+         * that has fallen behind a fast producer drains the queue in
+         * one round trip this way, rather than one per message.
          *
          * Requests may be handled immediately, or they may be deferred if a
          * response is not available yet. In the first case, this will place
@@ -61,9 +81,10 @@ class PostOffice : public mcp::RequestHandler {
          * and return -1.
          *
          * In the second case, res_buf is unmodified, and a file descriptor is
-         * returned. When the response is available, a single byte can and must
-         * be read from this file descriptor, and get_response must be called to
-         * pick up the response.
+         * returned. When the response is available, the file descriptor
+         * becomes readable; it is an eventfd, so an 8-byte count can and
+         * must be read from it, and get_response must be called to pick
+         * up the response.
          *
          * @param req_buf Pointer to request bytes
          * @param req_len Number of bytes in request
@@ -77,8 +98,9 @@ class PostOffice : public mcp::RequestHandler {
          *
          * This function must be called only when a previous call to
          * handle_request returned a file descriptor. When this file descriptor
-         * becomes ready, read a byte from it and call this function, passing the
-         * file descriptor. The response will then be written into res_buf.
+         * becomes ready, read the 8-byte eventfd count from it and call this
+         * function, passing the file descriptor. The response will then be
+         * written into res_buf.
          *
          * @param fd File descriptor to return
          * @return A byte array wrapped in a DataConstRef with the response
@@ -96,28 +118,114 @@ class PostOffice : public mcp::RequestHandler {
                 ymmsl::Reference const & receiver,
                 std::unique_ptr<DataConstRef> message);
 
+        /** Deposit a batch of messages into their outboxes.
+         *
+         * Equivalent to calling deposit() for each (receiver, message)
+         * pair, but all outboxes are looked up with a single pass under
+         * the outboxes lock. This helps when fanning out to many
+         * receivers at once, e.g. when sending on a vector port with
+         * many slots.
+         *
+         * @param messages The receivers and messages to deposit.
+         */
+        void deposit_batch(
+                std::vector<std::pair<
+                        ymmsl::Reference, std::unique_ptr<DataConstRef>
+                >> messages);
+
         /** Waits until all outboxes are empty.
          */
         void wait_for_receivers() const;
 
-    private:
-        Outbox & get_outbox_(ymmsl::Reference const & receiver);
-
-        Pipe get_pipe_();
-        void return_pipe_(Pipe const & pipe);
+        /** Drops retransmission window entries covered by a watermark.
+         *
+         * Our peers never need messages from before their last
+         * checkpoint again, so when a received saved_until watermark
+         * advances, the messages it covers can leave the windows. Does
+         * nothing unless MUSCLE_RETRANSMIT_WINDOW is set.
+         *
+         * @param saved_until The watermark received from a peer.
+         */
+        void discard_retransmits_until(double saved_until);
 
-        // A mutex that protects outboxes_ and pending_outboxes_, but not any
-        // individual outbox.
-        mutable std::mutex outboxes_mutex_;
-        mutable std::condition_variable retrieved_;
-        std::unordered_map<ymmsl::Reference, std::unique_ptr<Outbox>> outboxes_;
-        // Lookup table of outboxes that have a pending read
-        std::unordered_map<int, Outbox*> pending_outboxes_;
+        /** Returns the retransmission window for a receiver.
+         *
+         * See Outbox::retained_for_retransmit(); these are the
+         * messages that a recovery path can resend to the given
+         * receiver after it restarted from a checkpoint.
+         *
+         * @param receiver The receiver to get retained messages for.
+         *
+         * @return Copies of the retained messages, in retrieval order.
+         */
+        std::vector<DataConstRef> retained_for_retransmit(
+                ymmsl::Reference const & receiver);
 
+    private:
+        // A pending read of an outbox, with the requested region of the
+        // grid payload if the request asked for one, and the maximum
+        // number of messages if it was a batch request (0 if not)
+        struct PendingRequest_ {
+            Outbox * outbox;
+            bool sliced;
+            std::vector<std::size_t> slice_offsets;
+            std::vector<std::size_t> slice_extents;
+            int batch_max;
+        };
+
+        // The outboxes, sharded by a hash of the receiver with a lock
+        // per shard. Outboxes are created on first use and live until
+        // the PostOffice is destructed, so a returned reference stays
+        // valid with no lock held. With many clients resolving their
+        // receivers on different worker threads, a single map lock is
+        // measurably contended; shards keep it off the hot path. The
+        // locks protect only the maps, not any individual outbox;
+        // outboxes synchronise internally.
+        struct Shard_ {
+            mutable std::mutex mutex;
+            std::unordered_map<ymmsl::Reference, std::unique_ptr<Outbox>>
+                    outboxes;
+            // memo from raw request bytes to the outbox they address,
+            // see handle_request()
+            std::unordered_map<std::string, Outbox *> requests;
+        };
 
-        // Cache for notification pipes
-        mutable std::mutex pipes_mutex_;
-        std::vector<Pipe> pipes_;
+        Outbox & get_outbox_(ymmsl::Reference const & receiver);
+        Shard_ & shard_(ymmsl::Reference const & receiver);
+
+        // builds a response from a non-empty outbox, draining further
+        // queued messages into it for a batch request; see
+        // handle_request()
+        std::unique_ptr<DataConstRef> make_response_(
+                Outbox & outbox, bool sliced,
+                std::vector<std::size_t> const & slice_offsets,
+                std::vector<std::size_t> const & slice_extents,
+                int batch_max);
+
+        // spins briefly waiting for a deposit on an empty outbox, see
+        // handle_request()
+        void spin_for_deposit_(Outbox const & outbox) const;
+
+        // byte budget for each outbox, 0 for unlimited
+        std::size_t outbox_limit_bytes_;
+        // retransmission window size for each outbox, 0 for none
+        std::size_t retain_bytes_;
+        // whether outboxes spill to disk rather than block
+        bool outbox_spill_;
+        // how long to spin before blocking on an empty outbox, in
+        // microseconds; 0 disables spinning
+        int spin_us_;
+
+        static std::size_t const num_shards_ = 16u;
+        mutable std::array<Shard_, num_shards_> shards_;
+
+        // A mutex that protects pending_outboxes_, and that pairs with
+        // retrieved_ for wait_for_receivers()
+        mutable std::mutex pending_mutex_;
+        mutable std::condition_variable retrieved_;
+        // Lookup table of outboxes that have a pending read, by their
+        // eventfds
+        std::unordered_map<int, PendingRequest_> pending_outboxes_;
 };
 
 } }
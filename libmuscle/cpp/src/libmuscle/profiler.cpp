@@ -0,0 +1,170 @@
+#include <libmuscle/profiler.hpp>
+
+#include <libmuscle/trace.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <utility>
+
+
+namespace {
+    // number of events to collect before submitting them to the manager
+    std::size_t const batch_size_ = 1000u;
+
+    /* Returns the name of a per-message event type, for the histogram
+     * file.
+     */
+    char const * event_type_name_(libmuscle::impl::ProfileEventType type) {
+        switch (type) {
+            case libmuscle::impl::ProfileEventType::send:
+                return "send";
+            case libmuscle::impl::ProfileEventType::receive:
+                return "receive";
+            case libmuscle::impl::ProfileEventType::receive_wait:
+                return "receive_wait";
+            default:
+                return "unknown";
+        }
+    }
+}
+
+
+namespace libmuscle { namespace impl {
+
+Profiler::Profiler(std::string const & instance_id, MMPClient & manager)
+    : manager_(manager)
+    , instance_id_(instance_id)
+    , wait_sample_interval_(1u)
+    , waits_seen_(0u)
+{
+    char const * sample = std::getenv("MUSCLE_PROFILE_WAIT_SAMPLE");
+    if (sample != nullptr) {
+        int interval = std::atoi(sample);
+        if (interval > 1)
+            wait_sample_interval_ = static_cast<std::size_t>(interval);
+    }
+    char const * histogram_dir = std::getenv("MUSCLE_PROFILE_HISTOGRAM");
+    if (histogram_dir != nullptr)
+        histogram_dir_ = (*histogram_dir != '\0') ? histogram_dir : ".";
+    events_.reserve(batch_size_);
+}
+
+void Profiler::shutdown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flush_();
+    write_histograms_();
+}
+
+void Profiler::record_event(ProfileEvent && event) {
+    // the flight recorder sees every event, including the waits that
+    // sampling may drop below; its ring is lock-free, so this is done
+    // outside the lock
+    if (instrumentation::tracing_enabled())
+        instrumentation::trace_event(event);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!histogram_dir_.empty()) {
+        switch (event.event_type) {
+            case ProfileEventType::send:
+            case ProfileEventType::receive:
+            case ProfileEventType::receive_wait:
+                add_to_histogram_(event);
+                return;
+            default:
+                break;
+        }
+    }
+    if (
+            event.event_type == ProfileEventType::receive_wait &&
+            waits_seen_++ % wait_sample_interval_ != 0u)
+        return;
+    events_.push_back(std::move(event));
+    if (events_.size() >= batch_size_)
+        flush_();
+}
+
+void Profiler::flush_() {
+    if (!events_.empty()) {
+        manager_.submit_profile_events(instance_id_, events_);
+        events_.clear();
+    }
+}
+
+/* Folds a per-message event into its duration histogram.
+ *
+ * Called with mutex_ held. The bucket is the bit width of the
+ * duration in nanoseconds, computed without branching, so at high
+ * message rates this stays a map lookup and two additions per event.
+ */
+void Profiler::add_to_histogram_(ProfileEvent const & event) {
+    std::string port_name;
+    if (event.port.is_set())
+        port_name = event.port.get().name;
+
+    auto & histogram = histograms_[
+            std::make_pair(event.event_type, std::move(port_name))];
+
+    std::int64_t duration =
+            event.stop_time.nanoseconds - event.start_time.nanoseconds;
+    std::uint64_t ns = (duration > 0) ? duration : 0u;
+    std::size_t bucket = 63u - __builtin_clzll(ns | 1u);
+    ++histogram.buckets[bucket];
+    histogram.total_ns += ns;
+}
+
+/* Writes the aggregated duration histograms to a JSON file.
+ *
+ * Called at shutdown with mutex_ held. Failing to write only costs
+ * the summaries, so errors are ignored rather than raised; there is
+ * no logger here to complain to, as the logger logs remotely through
+ * the same manager connection.
+ */
+void Profiler::write_histograms_() const {
+    if (histogram_dir_.empty() || histograms_.empty())
+        return;
+
+    // square brackets are awkward in shells and file managers
+    std::string safe_id = instance_id_;
+    std::size_t pos;
+    while ((pos = safe_id.find('[')) != std::string::npos)
+        safe_id[pos] = '-';
+    while ((pos = safe_id.find(']')) != std::string::npos)
+        safe_id.erase(pos, 1u);
+    std::string path = histogram_dir_ + "/" + safe_id + ".profile.json";
+
+    std::ofstream out(path, std::ios::trunc);
+    out << "{\"instance\":\"" << instance_id_ << "\",\"histograms\":[";
+    bool first = true;
+    for (auto const & entry : histograms_) {
+        if (!first)
+            out << ",";
+        first = false;
+
+        auto const & histogram = entry.second;
+        std::uint64_t count = 0u;
+        std::size_t num_buckets = 0u;
+        for (std::size_t i = 0u; i < DurationHistogram_::num_buckets; ++i)
+            if (histogram.buckets[i] != 0u) {
+                count += histogram.buckets[i];
+                num_buckets = i + 1u;
+            }
+
+        out << "{\"event_type\":\"" << event_type_name_(entry.first.first);
+        out << "\",\"port\":\"" << entry.first.second;
+        out << "\",\"count\":" << count;
+        out << ",\"total_ns\":" << histogram.total_ns;
+        // bucket i counts durations in [2^i, 2^(i+1)) ns; trailing
+        // empty buckets are omitted
+        out << ",\"buckets\":[";
+        for (std::size_t i = 0u; i < num_buckets; ++i) {
+            if (i != 0u)
+                out << ",";
+            out << histogram.buckets[i];
+        }
+        out << "]}";
+    }
+    out << "]}" << std::endl;
+}
+
+} }
@@ -0,0 +1,98 @@
+#pragma once
+
+#ifdef LIBMUSCLE_MOCK_PROFILER
+#include LIBMUSCLE_MOCK_PROFILER
+#else
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <libmuscle/mmp_client.hpp>
+#include <libmuscle/profiling.hpp>
+
+
+namespace libmuscle { namespace impl {
+
+/** Collects profiling events and submits them to the manager.
+ *
+ * Events are buffered in a preallocated batch and sent off whenever the
+ * batch fills up, so that recording an event costs a few stores in the
+ * common case and the manager round-trip amortises over many events.
+ *
+ * Recording is synchronised internally, so events may be recorded from
+ * multiple threads.
+ *
+ * On a chatty coupling the receive_wait events dominate the stream of
+ * events sent to the manager. Setting MUSCLE_PROFILE_WAIT_SAMPLE to an
+ * integer N forwards only every Nth of them, bounding that traffic;
+ * the local per-port wait histograms (see instrumentation.hpp) still
+ * see every wait, so percentiles remain exact.
+ *
+ * Setting MUSCLE_PROFILE_HISTOGRAM to a directory path goes further:
+ * the per-message events (send, receive and receive_wait) are then not
+ * sent to the manager at all, but folded into log-scale duration
+ * histograms per port and event type, which are written to a JSON file
+ * in that directory at shutdown. At tens of thousands of messages per
+ * second the raw stream would swamp the manager; the histograms keep
+ * full-fidelity percentiles in constant memory for a few increments
+ * per event. The low-rate lifecycle events (register, connect,
+ * deregister) are still submitted as usual.
+ */
+class Profiler {
+    public:
+        /** Create a Profiler.
+         *
+         * @param instance_id The id of the instance we are profiling.
+         * @param manager The client to submit events through.
+         */
+        Profiler(std::string const & instance_id, MMPClient & manager);
+
+        /** Shut down the profiler.
+         *
+         * This submits any remaining events to the manager. Call before
+         * closing the manager connection.
+         */
+        void shutdown();
+
+        /** Record a profiling event.
+         *
+         * Call stop() on the event before recording it.
+         *
+         * @param event The event to record.
+         */
+        void record_event(ProfileEvent && event);
+
+    private:
+        // histogram of event durations for one port and event type;
+        // bucket i counts durations of at least 2^i and less than
+        // 2^(i+1) nanoseconds, as in instrumentation.hpp
+        struct DurationHistogram_ {
+            static std::size_t const num_buckets = 64u;
+            std::uint64_t buckets[num_buckets] = {};
+            std::uint64_t total_ns = 0u;
+        };
+
+        void flush_();
+        void add_to_histogram_(ProfileEvent const & event);
+        void write_histograms_() const;
+
+        MMPClient & manager_;
+        std::string instance_id_;
+        std::mutex mutex_;
+        std::vector<ProfileEvent> events_;
+        std::size_t wait_sample_interval_;
+        std::size_t waits_seen_;
+        // directory for the histogram file, empty if aggregation is off
+        std::string histogram_dir_;
+        std::map<
+                std::pair<ProfileEventType, std::string>,
+                DurationHistogram_> histograms_;
+};
+
+} }
+
+#endif
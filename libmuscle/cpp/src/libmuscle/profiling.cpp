@@ -0,0 +1,63 @@
+#include <libmuscle/profiling.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <time.h>
+
+
+using wallclock = std::chrono::high_resolution_clock;
+
+
+namespace libmuscle { namespace impl {
+
+namespace {
+
+/* Whether to take profile timestamps from the coarse system clock.
+ *
+ * Set with MUSCLE_PROFILE_COARSE_CLOCK, see ProfileTimestamp.
+ */
+bool use_coarse_clock_() {
+    static bool const result =
+            std::getenv("MUSCLE_PROFILE_COARSE_CLOCK") != nullptr;
+    return result;
+}
+
+}
+
+ProfileTimestamp::ProfileTimestamp() {
+#ifdef CLOCK_REALTIME_COARSE
+    if (use_coarse_clock_()) {
+        // this reads a timestamp the kernel keeps up to date, without
+        // querying the hardware clock; resolution is a scheduler tick
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+        nanoseconds =
+                static_cast<int64_t>(ts.tv_sec) * 1000000000l + ts.tv_nsec;
+        return;
+    }
+#endif
+    auto since_epoch = wallclock::now().time_since_epoch();
+    nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            since_epoch).count();
+}
+
+ProfileEvent::ProfileEvent(
+        ProfileEventType event_type,
+        Optional<ymmsl::Port> const & port,
+        Optional<int> slot)
+    : event_type(event_type)
+    , start_time()
+    , stop_time()
+    , port(port)
+    , slot(slot)
+{}
+
+void ProfileEvent::start() {
+    start_time = ProfileTimestamp();
+}
+
+void ProfileEvent::stop() {
+    stop_time = ProfileTimestamp();
+}
+
+} }
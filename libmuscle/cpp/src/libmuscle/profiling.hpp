@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <libmuscle/util.hpp>
+
+#include <ymmsl/ymmsl.hpp>
+
+
+namespace libmuscle { namespace impl {
+
+/** The type of an event recorded by the profiler.
+ *
+ * These match the types in the MUSCLE Manager Protocol, as defined on
+ * the Python side, and must be kept identical to those.
+ */
+enum class ProfileEventType {
+    register_ = 0,
+    deregister = 1,
+    send = 2,
+    receive = 3,
+    connect = 4,
+    receive_wait = 5
+};
+
+
+/** A timestamp for profiling, in nanoseconds since the UNIX epoch.
+ *
+ * Unlike Timestamp, this counts integer nanoseconds, so that taking one
+ * is cheap enough to do per message and short intervals don't drown in
+ * floating point noise.
+ *
+ * If the environment variable MUSCLE_PROFILE_COARSE_CLOCK is set, then
+ * timestamps are taken from the kernel's coarse clock where available.
+ * That trades resolution (a scheduler tick, typically 1-4 ms) for not
+ * querying the hardware clock at all, which keeps very high event
+ * rates from showing up as clock reads in the profile. Use it when
+ * profiling components that exchange far more messages per second than
+ * the tick rate and the aggregate times are what matters.
+ */
+class ProfileTimestamp {
+    public:
+        /** Create a timestamp representing the current time.
+         */
+        ProfileTimestamp();
+
+        /** Number of nanoseconds since the UNIX epoch.
+         */
+        int64_t nanoseconds;
+};
+
+
+/** A profiled event.
+ *
+ * Represents a single measured interval, annotated with what was being
+ * done during it.
+ */
+class ProfileEvent {
+    public:
+        /** Create a ProfileEvent.
+         *
+         * This records the current time as the event's start time; call
+         * stop() when the event is done.
+         *
+         * @param event_type The type of the event.
+         * @param port The port the event relates to, if any.
+         * @param slot The slot the event relates to, if any.
+         */
+        ProfileEvent(
+                ProfileEventType event_type,
+                Optional<ymmsl::Port> const & port = Optional<ymmsl::Port>(),
+                Optional<int> slot = Optional<int>());
+
+        /** Record the current time as the start of the event.
+         */
+        void start();
+
+        /** Record the current time as the end of the event.
+         */
+        void stop();
+
+        ProfileEventType event_type;
+        ProfileTimestamp start_time, stop_time;
+        Optional<ymmsl::Port> port;
+        Optional<int> port_length;
+        Optional<int> slot;
+        Optional<std::size_t> message_size;
+        Optional<int> message_number;
+};
+
+} }
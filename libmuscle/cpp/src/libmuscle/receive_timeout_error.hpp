@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdexcept>
+
+
+namespace libmuscle { namespace impl {
+
+/** Thrown when a receive did not complete within the given timeout.
+ *
+ * See Instance::receive_with_timeout(). When this is thrown, the
+ * request for the message is still outstanding on the connection to
+ * the peer, so further receives from the same peer would get confused;
+ * the expected response is to log the failure, conclude that the peer
+ * is hung or gone, and shut down so that the simulation can be
+ * resubmitted.
+ */
+class ReceiveTimeoutError : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+};
+
+} }
@@ -12,21 +12,44 @@ using ymmsl::Settings;
 
 namespace libmuscle { namespace impl {
 
+void SettingsManager::prefetch(Reference const & instance) const {
+    prefetch_instance_ = instance;
+    clear_caches_();
+    cache_base_generation_ = base.generation();
+    cache_overlay_generation_ = overlay.generation();
+    resolve_all_(instance);
+}
+
 SettingValue const & SettingsManager::get_setting(
         Reference const & instance,
         Reference const & setting_name
         ) const
 {
+    refresh_caches_();
+
+    auto cached = cache_.find(setting_name);
+    if (cached != cache_.end()) {
+        if (cached->second.instance == instance)
+            return *cached->second.value;
+        cache_.erase(cached);
+    }
+
     auto it = instance.cend();
     do {
         Reference name = (it == instance.cbegin())
             ? setting_name
             : Reference(instance.cbegin(), it) + setting_name;
 
-        if (overlay.contains(name))
-            return overlay.at(name);
-        if (base.contains(name))
-            return base.at(name);
+        if (overlay.contains(name)) {
+            SettingValue const & value = overlay.at(name);
+            cache_.emplace(setting_name, CacheEntry_{instance, &value});
+            return value;
+        }
+        if (base.contains(name)) {
+            SettingValue const & value = base.at(name);
+            cache_.emplace(setting_name, CacheEntry_{instance, &value});
+            return value;
+        }
 
         if (it == instance.cbegin())
             break;
@@ -38,20 +61,174 @@ SettingValue const & SettingsManager::get_setting(
                             + " was not set");
 }
 
+template <>
+std::unordered_map<Reference, SettingsManager::TypedEntry_<std::string>> &
+SettingsManager::typed_cache_<std::string>() const {
+    return string_cache_;
+}
+
+template <>
+std::unordered_map<Reference, SettingsManager::TypedEntry_<int64_t>> &
+SettingsManager::typed_cache_<int64_t>() const {
+    return int_cache_;
+}
+
+template <>
+std::unordered_map<Reference, SettingsManager::TypedEntry_<double>> &
+SettingsManager::typed_cache_<double>() const {
+    return float_cache_;
+}
+
+template <>
+std::unordered_map<Reference, SettingsManager::TypedEntry_<bool>> &
+SettingsManager::typed_cache_<bool>() const {
+    return bool_cache_;
+}
+
+template <>
+std::unordered_map<Reference, SettingsManager::TypedEntry_<std::vector<double>>> &
+SettingsManager::typed_cache_<std::vector<double>>() const {
+    return list_cache_;
+}
+
+template <>
+std::unordered_map<
+        Reference, SettingsManager::TypedEntry_<std::vector<std::vector<double>>>> &
+SettingsManager::typed_cache_<std::vector<std::vector<double>>>() const {
+    return list_list_cache_;
+}
+
 template <typename T>
 T const & SettingsManager::get_setting_as(
         Reference const & instance,
         Reference const & setting_name
         ) const
 {
-    SettingValue value(get_setting(instance, setting_name));
+    refresh_caches_();
+
+    auto & tcache = typed_cache_<T>();
+    auto cached = tcache.find(setting_name);
+    if (cached != tcache.end()) {
+        if (cached->second.instance == instance)
+            return cached->second.value;
+        tcache.erase(cached);
+    }
 
+    SettingValue const & value = get_setting(instance, setting_name);
     if (!value.is_a<T>())
         throw std::runtime_error("Value for Setting "
                                  + static_cast<std::string>(setting_name)
                                  + " is the wrong type.");
-    return value.as<T>();
+    return tcache.emplace(
+            setting_name, TypedEntry_<T>{instance, value.as<T>()}
+            ).first->second.value;
 }
 
-} }
+Settings SettingsManager::snapshot(Reference const & instance) const {
+    Settings result;
+    // from the least to the most specific prefix, base before overlay,
+    // so that later writes win; the same order as resolve_all_()
+    for (std::size_t plen = 0u; plen <= instance.length(); ++plen) {
+        for (Settings const * settings : {&base, &overlay}) {
+            for (auto const & setting : *settings) {
+                Reference const & key = setting.first;
+                if (key.length() <= plen)
+                    continue;
+
+                bool matches = true;
+                auto kit = key.cbegin();
+                auto iit = instance.cbegin();
+                for (std::size_t i = 0u; i < plen; ++i, ++kit, ++iit)
+                    if (!(*kit == *iit)) {
+                        matches = false;
+                        break;
+                    }
+                if (!matches || kit->is_index())
+                    continue;
+
+                result[Reference(kit, key.cend())] = setting.second;
+            }
+        }
+    }
+    return result;
+}
+
+void SettingsManager::refresh_caches_() const {
+    if (
+            base.generation() == cache_base_generation_ &&
+            overlay.generation() == cache_overlay_generation_)
+        return;
+
+    // the settings changed, so cached pointers may be stale
+    clear_caches_();
+    cache_base_generation_ = base.generation();
+    cache_overlay_generation_ = overlay.generation();
+
+    if (prefetch_instance_.is_set())
+        resolve_all_(prefetch_instance_.get());
+}
 
+void SettingsManager::clear_caches_() const {
+    cache_.clear();
+    string_cache_.clear();
+    int_cache_.clear();
+    float_cache_.clear();
+    bool_cache_.clear();
+    list_cache_.clear();
+    list_list_cache_.clear();
+}
+
+/* Fills cache_ with the resolved value of every applicable setting.
+ *
+ * This iterates from the least to the most specific prefix of the
+ * instance name, and at each level over base before overlay, letting
+ * later entries overwrite earlier ones. The surviving entry for each
+ * name is then the one that get_setting() would resolve.
+ */
+void SettingsManager::resolve_all_(Reference const & instance) const {
+    for (std::size_t plen = 0u; plen <= instance.length(); ++plen) {
+        for (Settings const * settings : {&base, &overlay}) {
+            for (auto const & setting : *settings) {
+                Reference const & key = setting.first;
+                if (key.length() <= plen)
+                    continue;
+
+                bool matches = true;
+                auto kit = key.cbegin();
+                auto iit = instance.cbegin();
+                for (std::size_t i = 0u; i < plen; ++i, ++kit, ++iit)
+                    if (!(*kit == *iit)) {
+                        matches = false;
+                        break;
+                    }
+                if (!matches || kit->is_index())
+                    continue;
+
+                Reference name(kit, key.cend());
+                auto cached = cache_.find(name);
+                if (cached == cache_.end())
+                    cache_.emplace(
+                            name, CacheEntry_{instance, &setting.second});
+                else
+                    cached->second = CacheEntry_{instance, &setting.second};
+            }
+        }
+    }
+}
+
+template std::string const & SettingsManager::get_setting_as<std::string>(
+        Reference const & instance, Reference const & setting_name) const;
+template int64_t const & SettingsManager::get_setting_as<int64_t>(
+        Reference const & instance, Reference const & setting_name) const;
+template double const & SettingsManager::get_setting_as<double>(
+        Reference const & instance, Reference const & setting_name) const;
+template bool const & SettingsManager::get_setting_as<bool>(
+        Reference const & instance, Reference const & setting_name) const;
+template std::vector<double> const &
+SettingsManager::get_setting_as<std::vector<double>>(
+        Reference const & instance, Reference const & setting_name) const;
+template std::vector<std::vector<double>> const &
+SettingsManager::get_setting_as<std::vector<std::vector<double>>>(
+        Reference const & instance, Reference const & setting_name) const;
+
+} }
@@ -1,5 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <libmuscle/util.hpp>
+
 #include <ymmsl/ymmsl.hpp>
 
 
@@ -11,7 +19,29 @@ class SettingsManager {
     public:
         ymmsl::Settings base, overlay;
 
+        /** Resolve all settings for the given instance into the cache.
+         *
+         * This walks every setting in base and overlay once and stores the
+         * value that get_setting() would resolve for the given instance,
+         * so that subsequent reads are single hash lookups rather than
+         * walks up the instance's prefixes. Models tend to read many
+         * settings in a burst at the start of the reuse loop, and this
+         * makes that a lot faster.
+         *
+         * The prefetch is repeated automatically whenever base or overlay
+         * changes.
+         *
+         * @param instance The name of the instance to resolve settings for.
+         */
+        void prefetch(ymmsl::Reference const & instance) const;
+
         /** Get a setting's value.
+         *
+         * Resolving a setting walks up the instance's prefixes, which
+         * takes a while, so results are memoised; repeated reads of the
+         * same setting, as models tend to do from inner loops, are a
+         * single hash lookup. The memo is discarded whenever base or
+         * overlay changes.
          *
          * @param instance The name of the instance to get the setting for.
          * @param setting_name The name of the setting to get.
@@ -24,6 +54,10 @@ class SettingsManager {
                 ymmsl::Reference const & setting_name) const;
 
         /** Get a setting's value, checking the type.
+         *
+         * Converting a SettingValue to e.g. a vector takes a copy, so
+         * converted values are memoised as well, and repeated typed reads
+         * return a reference to the same object.
          *
          * @param T The expected type, one of std::string, int64_t, double,
          *          bool, std::vector<double>, std::vector<std::vector<double>>.
@@ -37,7 +71,64 @@ class SettingsManager {
         T const & get_setting_as(
                 ymmsl::Reference const & instance,
                 ymmsl::Reference const & setting_name) const;
+
+        /** Returns all settings resolved for the given instance.
+         *
+         * The result holds, for every applicable setting, the value
+         * that get_setting() would return for it, under its bare name
+         * with any instance prefix stripped. It is a snapshot; it does
+         * not change along if base or overlay change afterwards.
+         *
+         * This mainly serves the Fortran and C bindings, which can
+         * hand the whole set across the language boundary in one call
+         * instead of resolving settings one by one.
+         *
+         * @param instance The name of the instance to resolve for.
+         * @return A flat Settings object with every resolved setting.
+         */
+        ymmsl::Settings snapshot(ymmsl::Reference const & instance) const;
+
+    private:
+        struct CacheEntry_ {
+            ymmsl::Reference instance;
+            ymmsl::SettingValue const * value;
+        };
+
+        template <typename T>
+        struct TypedEntry_ {
+            ymmsl::Reference instance;
+            T value;
+        };
+
+        template <typename T>
+        std::unordered_map<ymmsl::Reference, TypedEntry_<T>> &
+        typed_cache_() const;
+
+        void refresh_caches_() const;
+        void clear_caches_() const;
+        void resolve_all_(ymmsl::Reference const & instance) const;
+
+        // memoised get_setting() results, valid for the generations
+        // of base and overlay recorded below
+        mutable std::unordered_map<ymmsl::Reference, CacheEntry_> cache_;
+        // memoised get_setting_as() conversions, one map per type
+        mutable std::unordered_map<
+                ymmsl::Reference, TypedEntry_<std::string>> string_cache_;
+        mutable std::unordered_map<
+                ymmsl::Reference, TypedEntry_<int64_t>> int_cache_;
+        mutable std::unordered_map<
+                ymmsl::Reference, TypedEntry_<double>> float_cache_;
+        mutable std::unordered_map<
+                ymmsl::Reference, TypedEntry_<bool>> bool_cache_;
+        mutable std::unordered_map<
+                ymmsl::Reference, TypedEntry_<std::vector<double>>
+                > list_cache_;
+        mutable std::unordered_map<
+                ymmsl::Reference, TypedEntry_<std::vector<std::vector<double>>>
+                > list_list_cache_;
+        mutable Optional<ymmsl::Reference> prefetch_instance_;
+        mutable std::size_t cache_base_generation_ = 0u;
+        mutable std::size_t cache_overlay_generation_ = 0u;
 };
 
 } }
-
@@ -0,0 +1,192 @@
+#include <libmuscle/snapshot.hpp>
+
+#include <libmuscle/mcp/data_pack.hpp>
+#include <libmuscle/mpp_message.hpp>
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <msgpack.hpp>
+
+
+using ymmsl::Reference;
+using ymmsl::SettingValue;
+using ymmsl::Settings;
+
+
+namespace {
+
+using libmuscle::impl::Data;
+using libmuscle::impl::DataConstRef;
+using libmuscle::impl::MPPMessage;
+using libmuscle::impl::Message;
+using libmuscle::impl::Optional;
+
+/* Serialises the message, reusing the MPP wire format.
+ *
+ * An unset message (as in an implicit snapshot) becomes an empty byte
+ * array, which from_bytes() recognises.
+ */
+DataConstRef message_to_bytes_(Optional<Message> const & message) {
+    if (!message.is_set())
+        return Data::byte_array(0u);
+
+    Message const & msg = message.get();
+    Optional<double> next_timestamp;
+    if (msg.has_next_timestamp())
+        next_timestamp = msg.next_timestamp();
+    Data settings_overlay;
+    if (msg.has_settings())
+        settings_overlay = Data(msg.settings());
+
+    MPPMessage mpp_message(
+            Reference("_"), Reference("_"), {},
+            msg.timestamp(), next_timestamp,
+            settings_overlay, 0, -1.0, msg.data());
+    return mpp_message.encoded();
+}
+
+Optional<Message> message_from_bytes_(DataConstRef const & data) {
+    if (data.size() == 0u)
+        return {};
+
+    auto mpp_message = MPPMessage::from_bytes(data);
+    Message message(
+            mpp_message.timestamp(), mpp_message.take_data(),
+            mpp_message.settings_overlay().as<Settings>());
+    if (mpp_message.next_timestamp().is_set())
+        message.set_next_timestamp(mpp_message.next_timestamp().get());
+    return message;
+}
+
+}
+
+
+namespace libmuscle { namespace impl {
+
+char const Snapshot::version_byte;
+char const Snapshot::mmap_version_byte;
+
+Snapshot::Snapshot(
+        std::vector<std::string> const & triggers,
+        double wallclock_time,
+        std::unordered_map<std::string, std::vector<int>> const &
+            port_message_counts,
+        bool is_final_snapshot,
+        Optional<Message> const & message,
+        ::ymmsl::Settings const & settings_overlay)
+    : triggers(triggers)
+    , wallclock_time(wallclock_time)
+    , port_message_counts(port_message_counts)
+    , is_final_snapshot(is_final_snapshot)
+    , message(message)
+    , settings_overlay(settings_overlay)
+{}
+
+Snapshot Snapshot::from_bytes(std::vector<char> const & data) {
+    DataConstRef dict = mcp::unpack_data(data.data(), data.size());
+
+    std::vector<std::string> triggers;
+    DataConstRef triggers_data = dict["triggers"];
+    for (std::size_t i = 0u; i < triggers_data.size(); ++i)
+        triggers.push_back(triggers_data[i].as<std::string>());
+
+    std::unordered_map<std::string, std::vector<int>> port_message_counts;
+    DataConstRef counts_data = dict["port_message_counts"];
+    for (std::size_t i = 0u; i < counts_data.size(); ++i) {
+        std::vector<int> counts;
+        DataConstRef counts_list = counts_data.value(i);
+        for (std::size_t j = 0u; j < counts_list.size(); ++j)
+            counts.push_back(counts_list[j].as<int>());
+        port_message_counts[counts_data.key(i)] = counts;
+    }
+
+    Settings settings_overlay;
+    DataConstRef overlay_data = dict["settings_overlay"];
+    for (std::size_t i = 0u; i < overlay_data.size(); ++i)
+        settings_overlay[overlay_data.key(i)] =
+            overlay_data.value(i).as<SettingValue>();
+
+    return Snapshot(
+            triggers,
+            dict["wallclock_time"].as<double>(),
+            port_message_counts,
+            dict["is_final_snapshot"].as<bool>(),
+            message_from_bytes_(dict["message"]),
+            settings_overlay);
+}
+
+Snapshot Snapshot::from_parts(
+        std::vector<char> const & header, DataConstRef const & message_data)
+{
+    Snapshot snapshot = from_bytes(header);
+    snapshot.message = message_from_bytes_(message_data);
+    return snapshot;
+}
+
+DataConstRef Snapshot::to_bytes() const {
+    return pack_(message_to_bytes_(message));
+}
+
+DataConstRef Snapshot::header_bytes() const {
+    return pack_(Data::byte_array(0u));
+}
+
+DataConstRef Snapshot::message_bytes() const {
+    return message_to_bytes_(message);
+}
+
+DataConstRef Snapshot::pack_(DataConstRef const & message_data) const {
+    Data triggers_data = Data::nils(triggers.size());
+    for (std::size_t i = 0u; i < triggers.size(); ++i)
+        triggers_data[i] = triggers[i];
+
+    Data counts_data = Data::dict_reserve(port_message_counts.size());
+    for (auto const & port_counts : port_message_counts) {
+        Data counts_list = Data::nils(port_counts.second.size());
+        for (std::size_t i = 0u; i < port_counts.second.size(); ++i)
+            counts_list[i] = port_counts.second[i];
+        counts_data[port_counts.first] = counts_list;
+    }
+
+    // note: the overlay is stored as a plain dict, like the Python side
+    // does, not in the Settings wire format used by MPP messages
+    Data overlay_data = Data::dict_reserve(settings_overlay.size());
+    for (auto const & setting : settings_overlay)
+        overlay_data[static_cast<std::string>(setting.first)] = setting.second;
+
+    Data dict = Data::dict(
+            "triggers", triggers_data,
+            "wallclock_time", wallclock_time,
+            "port_message_counts", counts_data,
+            "is_final_snapshot", is_final_snapshot,
+            "message", message_data,
+            "settings_overlay", overlay_data);
+
+    // pack_data_exact pre-sizes the buffer, so a snapshot holding a
+    // large message is written out once, without staging reallocations
+    return mcp::pack_data_exact(dict);
+}
+
+SnapshotMetadata SnapshotMetadata::from_snapshot(
+        Snapshot const & snapshot, std::string const & snapshot_filename)
+{
+    SnapshotMetadata metadata;
+    metadata.triggers = snapshot.triggers;
+    metadata.wallclock_time = snapshot.wallclock_time;
+    metadata.timestamp = -std::numeric_limits<double>::infinity();
+    if (snapshot.message.is_set()) {
+        metadata.timestamp = snapshot.message.get().timestamp();
+        if (snapshot.message.get().has_next_timestamp())
+            metadata.next_timestamp = snapshot.message.get().next_timestamp();
+    }
+    metadata.port_message_counts = snapshot.port_message_counts;
+    metadata.is_final_snapshot = snapshot.is_final_snapshot;
+    metadata.snapshot_filename = snapshot_filename;
+    return metadata;
+}
+
+} }
+
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <libmuscle/data.hpp>
+#include <libmuscle/message.hpp>
+#include <libmuscle/util.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ymmsl/ymmsl.hpp>
+
+
+namespace libmuscle { namespace impl {
+
+/** Snapshot of an instance.
+ *
+ * This holds the state of an instance as stored in a snapshot file. The
+ * binary format is the same as that of the Python implementation, so a
+ * workflow may be resumed with components implemented in either language.
+ */
+class Snapshot {
+    public:
+        /** Version byte at the start of a snapshot file.
+         *
+         * This is updated whenever the snapshot format changes in an
+         * incompatible way.
+         */
+        static char const version_byte = '1';
+
+        /** Version byte of the memory-mappable snapshot format.
+         *
+         * In this format, the message payload is stored page-aligned and
+         * separate from the rest of the snapshot, so that resuming can map
+         * it into memory instead of reading it. Files in this format cannot
+         * be read by the Python implementation.
+         */
+        static char const mmap_version_byte = '2';
+
+        /** Create a Snapshot.
+         *
+         * @param triggers Description of the triggers that caused this
+         *      snapshot to be taken.
+         * @param wallclock_time Elapsed wallclock time when this snapshot
+         *      was taken.
+         * @param port_message_counts Number of messages sent or received on
+         *      each port, per slot.
+         * @param is_final_snapshot Whether this is a final snapshot.
+         * @param message The state of the instance, or nothing for an
+         *      implicit snapshot.
+         * @param settings_overlay The settings overlay of the instance.
+         */
+        Snapshot(
+                std::vector<std::string> const & triggers,
+                double wallclock_time,
+                std::unordered_map<std::string, std::vector<int>> const &
+                    port_message_counts,
+                bool is_final_snapshot,
+                Optional<Message> const & message,
+                ::ymmsl::Settings const & settings_overlay);
+
+        /** Create a Snapshot from binary data.
+         *
+         * @param data The binary data to load, excluding the version byte.
+         * @return The corresponding Snapshot.
+         */
+        static Snapshot from_bytes(std::vector<char> const & data);
+
+        /** Create a Snapshot from separate header and message data.
+         *
+         * This is used by the memory-mappable snapshot format, which stores
+         * the encoded message separately from the rest of the snapshot.
+         *
+         * @param header The header, as produced by header_bytes().
+         * @param message_data The encoded message, as produced by
+         *      message_bytes(). This may reference a memory-mapped buffer,
+         *      in which case the message will share ownership of it and no
+         *      copy is made.
+         * @return The corresponding Snapshot.
+         */
+        static Snapshot from_parts(
+                std::vector<char> const & header,
+                DataConstRef const & message_data);
+
+        /** Convert this Snapshot to binary data.
+         *
+         * @return A byte array object holding the binary data, excluding
+         *      the version byte.
+         */
+        DataConstRef to_bytes() const;
+
+        /** Convert this Snapshot to binary data, without the message.
+         *
+         * This produces the header of the memory-mappable snapshot format,
+         * which is the same as to_bytes() but with an empty message. Pair
+         * with message_bytes() and from_parts().
+         */
+        DataConstRef header_bytes() const;
+
+        /** Return the encoded message of this Snapshot.
+         *
+         * @return The message in MPP wire format, or an empty byte array
+         *      if no message is set.
+         */
+        DataConstRef message_bytes() const;
+
+        std::vector<std::string> triggers;
+        double wallclock_time;
+        std::unordered_map<std::string, std::vector<int>> port_message_counts;
+        bool is_final_snapshot;
+        Optional<Message> message;
+        ::ymmsl::Settings settings_overlay;
+
+    private:
+        DataConstRef pack_(DataConstRef const & message_data) const;
+};
+
+
+/** Metadata of a snapshot, for sending to the manager.
+ */
+struct SnapshotMetadata {
+    /** Create metadata describing a snapshot.
+     *
+     * @param snapshot The snapshot to describe.
+     * @param snapshot_filename Path of the file the snapshot was saved to.
+     */
+    static SnapshotMetadata from_snapshot(
+            Snapshot const & snapshot, std::string const & snapshot_filename);
+
+    std::vector<std::string> triggers;
+    double wallclock_time;
+    double timestamp;
+    Optional<double> next_timestamp;
+    std::unordered_map<std::string, std::vector<int>> port_message_counts;
+    bool is_final_snapshot;
+    std::string snapshot_filename;
+};
+
+} }
+
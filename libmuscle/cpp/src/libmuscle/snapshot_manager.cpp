@@ -0,0 +1,359 @@
+#include <libmuscle/snapshot_manager.hpp>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+using ymmsl::Operator;
+using ymmsl::Reference;
+
+
+namespace {
+
+// Layout of the preamble of a memory-mappable ('2') format snapshot file:
+// the version byte, then three little-endian uint64 fields giving the
+// header size, the offset of the message payload, and its size.
+std::size_t const header_size_pos_ = 1u;
+std::size_t const payload_offset_pos_ = 9u;
+std::size_t const payload_size_pos_ = 17u;
+std::size_t const preamble_size_ = 25u;
+
+void put_uint64_le_(char * buf, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i)
+        buf[i] = static_cast<char>(value >> (8 * i));
+}
+
+std::uint64_t get_uint64_le_(char const * buf) {
+    std::uint64_t value = 0u;
+    for (int i = 0; i < 8; ++i)
+        value |= static_cast<std::uint64_t>(
+                static_cast<unsigned char>(buf[i])) << (8 * i);
+    return value;
+}
+
+}
+
+
+namespace libmuscle { namespace impl {
+
+SnapshotManager::SnapshotManager(
+        Reference const & instance_id,
+        MMPClient & manager,
+        Communicator & communicator,
+        Logger & logger)
+    : instance_id_(instance_id)
+    , manager_(manager)
+    , communicator_(communicator)
+    , logger_(logger)
+    , next_snapshot_num_(1)
+    , use_mmap_format_(getenv("MUSCLE_SNAPSHOT_MMAP") != nullptr)
+{
+    safe_id_ = static_cast<std::string>(instance_id);
+    std::size_t pos;
+    while ((pos = safe_id_.find('[')) != std::string::npos)
+        safe_id_[pos] = '-';
+    while ((pos = safe_id_.find(']')) != std::string::npos)
+        safe_id_.erase(pos, 1u);
+}
+
+SnapshotManager::~SnapshotManager() {
+    try {
+        wait_for_store_();
+    }
+    catch (std::exception const & e) {
+        logger_.error("Failed to store snapshot: ", e.what());
+    }
+}
+
+Optional<double> SnapshotManager::prepare_resume(
+        Optional<std::string> const & resume_snapshot,
+        Optional<std::string> const & snapshot_directory)
+{
+    Optional<double> result;
+
+    if (snapshot_directory.is_set())
+        snapshot_directory_ = snapshot_directory.get();
+
+    if (resume_snapshot.is_set()) {
+        Snapshot snapshot = load_snapshot_from_file_(resume_snapshot.get());
+
+        if (snapshot.message.is_set()) {
+            // snapshot.message is not set for implicit snapshots
+            resume_from_snapshot_.reset(new Snapshot(snapshot));
+            result = snapshot.message.get().timestamp();
+        }
+        resume_overlay_ = snapshot.settings_overlay;
+
+        communicator_.restore_message_counts(snapshot.port_message_counts);
+
+        // Store a copy of the snapshot in the current run directory
+        std::string path = reserve_snapshot_file_();
+        if (use_mmap_format_ && snapshot.message.is_set())
+            write_mmap_snapshot_file_(
+                    path, snapshot.header_bytes(), snapshot.message_bytes());
+        else
+            write_snapshot_file_(path, snapshot.to_bytes());
+        manager_.submit_snapshot_metadata(
+                instance_id_, SnapshotMetadata::from_snapshot(snapshot, path));
+    }
+
+    return result;
+}
+
+bool SnapshotManager::resuming_from_intermediate() const {
+    return resume_from_snapshot_ && !resume_from_snapshot_->is_final_snapshot;
+}
+
+bool SnapshotManager::resuming_from_final() const {
+    return resume_from_snapshot_ && resume_from_snapshot_->is_final_snapshot;
+}
+
+Message SnapshotManager::load_snapshot() {
+    if (!resume_from_snapshot_)
+        throw std::runtime_error(
+                "Tried to load a snapshot, but we are not resuming from a"
+                " snapshot. Use Instance::resuming() to check.");
+    return resume_from_snapshot_->message.get();
+}
+
+::ymmsl::Settings const & SnapshotManager::resume_overlay() const {
+    return resume_overlay_;
+}
+
+double SnapshotManager::save_snapshot(
+        Optional<Message> const & message, bool final,
+        std::vector<std::string> const & triggers,
+        double wallclock_time,
+        Optional<double> f_init_max_timestamp,
+        ::ymmsl::Settings const & settings_overlay)
+{
+    auto port_message_counts = communicator_.get_message_counts();
+
+    if (final) {
+        // Decrease F_INIT port counts by one: F_INIT messages are
+        // already pre-received, but not yet processed by the user code,
+        // so they are not part of this snapshot.
+        auto ports = communicator_.list_ports();
+        if (ports.count(Operator::F_INIT) != 0)
+            for (auto const & port_name : ports.at(Operator::F_INIT))
+                for (int & count : port_message_counts.at(port_name))
+                    --count;
+        if (communicator_.settings_in_connected())
+            for (int & count : port_message_counts.at("muscle_settings_in"))
+                --count;
+    }
+
+    Snapshot snapshot(
+            triggers, wallclock_time, port_message_counts, final, message,
+            settings_overlay);
+
+    // Serialise now, so that a model that goes on to modify its state
+    // does not affect the snapshot; the actual file write and the call
+    // to the manager happen on a background thread.
+    std::string path = reserve_snapshot_file_();
+    SnapshotMetadata metadata = SnapshotMetadata::from_snapshot(snapshot, path);
+
+    wait_for_store_();
+    if (use_mmap_format_ && message.is_set()) {
+        DataConstRef header(snapshot.header_bytes());
+        DataConstRef payload(snapshot.message_bytes());
+        store_future_ = std::async(std::launch::async,
+                [this, header, payload, path, metadata]() {
+                    write_mmap_snapshot_file_(path, header, payload);
+                    manager_.submit_snapshot_metadata(instance_id_, metadata);
+                });
+    }
+    else {
+        DataConstRef data(snapshot.to_bytes());
+        store_future_ = std::async(std::launch::async,
+                [this, data, path, metadata]() {
+                    write_snapshot_file_(path, data);
+                    manager_.submit_snapshot_metadata(instance_id_, metadata);
+                });
+    }
+
+    if (final && f_init_max_timestamp.is_set())
+        // Decisions about final snapshots are made based on the timestamps
+        // of pre-received F_INIT messages
+        return f_init_max_timestamp.get();
+    if (message.is_set())
+        return message.get().timestamp();
+    return -std::numeric_limits<double>::infinity();
+}
+
+Snapshot SnapshotManager::load_snapshot_from_file_(
+        std::string const & snapshot_location)
+{
+    logger_.debug("Loading snapshot from ", snapshot_location);
+
+    std::ifstream snapshot_file(snapshot_location, std::ios::binary);
+    if (!snapshot_file)
+        throw std::runtime_error(
+                "Unable to load snapshot: " + snapshot_location +
+                " cannot be opened. Please ensure this path exists and can"
+                " be read.");
+
+    int version = snapshot_file.get();
+    if (version == Snapshot::mmap_version_byte) {
+        snapshot_file.close();
+        return load_mmap_snapshot_file_(snapshot_location);
+    }
+    if (version != Snapshot::version_byte)
+        throw std::runtime_error(
+                "Unable to load snapshot from " + snapshot_location +
+                ": unknown format. Was the file saved with a different"
+                " version of MUSCLE3?");
+
+    std::vector<char> data(
+            (std::istreambuf_iterator<char>(snapshot_file)),
+            std::istreambuf_iterator<char>());
+
+    return Snapshot::from_bytes(data);
+}
+
+/* Loads a snapshot in the memory-mappable ('2') format.
+ *
+ * Rather than reading the message payload, this maps it into memory and
+ * has the message share ownership of the mapping. Pages are then faulted
+ * in from the file as the model accesses its state, so resuming costs
+ * time proportional to the state actually touched, not to the file size.
+ */
+Snapshot SnapshotManager::load_mmap_snapshot_file_(
+        std::string const & snapshot_location)
+{
+    int fd = ::open(snapshot_location.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error(
+                "Unable to load snapshot: " + snapshot_location +
+                " cannot be opened. Please ensure this path exists and can"
+                " be read.");
+
+    struct stat statbuf;
+    if (::fstat(fd, &statbuf) != 0) {
+        ::close(fd);
+        throw std::runtime_error(
+                "Unable to load snapshot: could not stat " +
+                snapshot_location + ": " + std::string(strerror(errno)));
+    }
+    std::size_t file_size = static_cast<std::size_t>(statbuf.st_size);
+
+    void * addr = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED)
+        throw std::runtime_error(
+                "Unable to load snapshot: could not map " +
+                snapshot_location + " into memory: " +
+                std::string(strerror(errno)));
+
+    std::shared_ptr<const void> mapping(
+            addr, [file_size](void const * ptr) {
+                ::munmap(const_cast<void *>(ptr), file_size);
+            });
+    char const * base = static_cast<char const *>(addr);
+
+    std::uint64_t header_size = 0u, payload_offset = 0u, payload_size = 0u;
+    if (file_size >= preamble_size_) {
+        header_size = get_uint64_le_(base + header_size_pos_);
+        payload_offset = get_uint64_le_(base + payload_offset_pos_);
+        payload_size = get_uint64_le_(base + payload_size_pos_);
+    }
+    if (
+            file_size < preamble_size_ ||
+            preamble_size_ + header_size > payload_offset ||
+            payload_offset + payload_size > file_size)
+        throw std::runtime_error(
+                "Unable to load snapshot from " + snapshot_location +
+                ": the file is corrupt or truncated.");
+
+    std::vector<char> header(
+            base + preamble_size_, base + preamble_size_ + header_size);
+    return Snapshot::from_parts(header, Data::byte_array(
+            base + payload_offset, payload_size, mapping));
+}
+
+std::string SnapshotManager::reserve_snapshot_file_() {
+    // Create the file with O_EXCL so that concurrent instances in the
+    // same directory cannot claim the same file.
+    for (int i = 0; i < 10000; ++i) {
+        int num = next_snapshot_num_ + i;
+        std::ostringstream oss;
+        if (!snapshot_directory_.empty())
+            oss << snapshot_directory_ << "/";
+        oss << safe_id_ << "_" << num << ".pack";
+        std::string path = oss.str();
+
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+        if (fd >= 0) {
+            ::close(fd);
+            next_snapshot_num_ = num + 1;
+            return path;
+        }
+        if (errno != EEXIST)
+            throw std::runtime_error(
+                    "Could not create snapshot file " + path + ": " +
+                    std::string(strerror(errno)));
+    }
+    throw std::runtime_error(
+            "Could not find an available snapshot file name for instance " +
+            safe_id_ + ".");
+}
+
+void SnapshotManager::write_snapshot_file_(
+        std::string const & path, DataConstRef const & data)
+{
+    std::ofstream snapshot_file(path, std::ios::binary | std::ios::trunc);
+    snapshot_file.put(Snapshot::version_byte);
+    snapshot_file.write(data.as_byte_array(), data.size());
+    snapshot_file.close();
+    if (!snapshot_file)
+        throw std::runtime_error("Could not write snapshot file " + path);
+}
+
+void SnapshotManager::write_mmap_snapshot_file_(
+        std::string const & path, DataConstRef const & header,
+        DataConstRef const & message_data)
+{
+    // Pad so that the message payload starts on a page boundary; the
+    // loader can then map the file and hand out pointers into the mapping.
+    std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::size_t header_end = preamble_size_ + header.size();
+    std::size_t payload_offset =
+            (header_end + page_size - 1u) / page_size * page_size;
+
+    char preamble[preamble_size_];
+    preamble[0] = Snapshot::mmap_version_byte;
+    put_uint64_le_(preamble + header_size_pos_, header.size());
+    put_uint64_le_(preamble + payload_offset_pos_, payload_offset);
+    put_uint64_le_(preamble + payload_size_pos_, message_data.size());
+
+    std::vector<char> padding(payload_offset - header_end, '\0');
+
+    std::ofstream snapshot_file(path, std::ios::binary | std::ios::trunc);
+    snapshot_file.write(preamble, preamble_size_);
+    snapshot_file.write(header.as_byte_array(), header.size());
+    snapshot_file.write(padding.data(), padding.size());
+    snapshot_file.write(message_data.as_byte_array(), message_data.size());
+    snapshot_file.close();
+    if (!snapshot_file)
+        throw std::runtime_error("Could not write snapshot file " + path);
+}
+
+void SnapshotManager::wait_for_store_() {
+    if (store_future_.valid())
+        store_future_.get();
+}
+
+} }
+
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <libmuscle/communicator.hpp>
+#include <libmuscle/logger.hpp>
+#include <libmuscle/mmp_client.hpp>
+#include <libmuscle/snapshot.hpp>
+#include <libmuscle/util.hpp>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ymmsl/ymmsl.hpp>
+
+
+namespace libmuscle { namespace impl {
+
+/** Manages snapshots and resuming for an instance.
+ *
+ * This stores snapshots on disk and registers them with the manager, and
+ * loads the snapshot to resume from, if any.
+ *
+ * Snapshot files are written on a background thread, so that the model can
+ * continue computing while the state drains to disk. The snapshot's buffers
+ * are immutable and reference counted, so this is safe without copying the
+ * state. Any pending write is finished before the next snapshot is taken,
+ * and when this object is destructed.
+ *
+ * If MUSCLE_SNAPSHOT_MMAP is set in the environment, snapshots are written
+ * in an alternative format in which the message payload is page-aligned.
+ * Resuming from such a snapshot maps the payload into memory rather than
+ * reading it, so that large state is paged in from the file on demand and
+ * resuming costs time proportional to the state actually accessed. These
+ * snapshot files cannot be read by the Python implementation, which is why
+ * this format is opt-in.
+ */
+class SnapshotManager {
+    public:
+        /** Create a SnapshotManager.
+         *
+         * @param instance_id The id of this instance.
+         * @param manager The client used to talk to the manager.
+         * @param communicator The communicator of this instance.
+         * @param logger The logger of this instance.
+         */
+        SnapshotManager(
+                ::ymmsl::Reference const & instance_id,
+                MMPClient & manager,
+                Communicator & communicator,
+                Logger & logger);
+
+        ~SnapshotManager();
+
+        /** Apply the resume snapshot, if we are resuming.
+         *
+         * This loads the snapshot to resume from, restores the message
+         * counts of our ports, and stores a copy of the snapshot in the
+         * current run directory.
+         *
+         * @param resume_snapshot Path to the snapshot file to resume from,
+         *      if any.
+         * @param snapshot_directory Directory to store new snapshots in.
+         * @return Simulation time at which the snapshot was saved, if we
+         *      are resuming from a snapshot with a message.
+         */
+        Optional<double> prepare_resume(
+                Optional<std::string> const & resume_snapshot,
+                Optional<std::string> const & snapshot_directory);
+
+        /** Return whether we are resuming from an intermediate snapshot.
+         */
+        bool resuming_from_intermediate() const;
+
+        /** Return whether we are resuming from a final snapshot.
+         */
+        bool resuming_from_final() const;
+
+        /** Return the message of the snapshot we are resuming from.
+         *
+         * @throws std::runtime_error if we are not resuming from a snapshot.
+         */
+        Message load_snapshot();
+
+        /** Return the settings overlay of the snapshot we resumed from.
+         */
+        ::ymmsl::Settings const & resume_overlay() const;
+
+        /** Save a snapshot to disk and register it with the manager.
+         *
+         * @param message The state of the instance, or nothing for an
+         *      implicit snapshot.
+         * @param final Whether this is a final snapshot.
+         * @param triggers Description of the triggers that caused this
+         *      snapshot.
+         * @param wallclock_time Elapsed wallclock time.
+         * @param f_init_max_timestamp Maximum timestamp of pre-received
+         *      F_INIT messages, used instead of the message timestamp for
+         *      final snapshots.
+         * @param settings_overlay The current settings overlay.
+         * @return Simulation time at which the snapshot was taken.
+         */
+        double save_snapshot(
+                Optional<Message> const & message, bool final,
+                std::vector<std::string> const & triggers,
+                double wallclock_time,
+                Optional<double> f_init_max_timestamp,
+                ::ymmsl::Settings const & settings_overlay);
+
+    private:
+        Snapshot load_snapshot_from_file_(std::string const & snapshot_location);
+        Snapshot load_mmap_snapshot_file_(
+                std::string const & snapshot_location);
+        std::string reserve_snapshot_file_();
+        void write_snapshot_file_(
+                std::string const & path, DataConstRef const & data);
+        void write_mmap_snapshot_file_(
+                std::string const & path, DataConstRef const & header,
+                DataConstRef const & message_data);
+        void wait_for_store_();
+
+        ::ymmsl::Reference instance_id_;
+        MMPClient & manager_;
+        Communicator & communicator_;
+        Logger & logger_;
+        std::string safe_id_;
+        std::unique_ptr<Snapshot> resume_from_snapshot_;
+        ::ymmsl::Settings resume_overlay_;
+        std::string snapshot_directory_;
+        int next_snapshot_num_;
+        bool use_mmap_format_;
+        std::future<void> store_future_;
+};
+
+} }
+
@@ -0,0 +1,109 @@
+/* This is a part of the integration test suite, and is run from a Python
+ * test in /integration_test. It is not a unit test.
+ *
+ * This is the ping side of the coupled-model latency benchmark; see
+ * /integration_test/benchmark_latency.py for the driver. Each iteration
+ * it sends a message with a payload of configurable size on each slot of
+ * its vector port and waits for the echo, optionally throttled to a
+ * configurable rate. When done, it prints round-trip latency percentiles
+ * and throughput to standard output as key: value lines.
+ */
+#include <libmuscle/libmuscle.hpp>
+#include <ymmsl/ymmsl.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+
+using libmuscle::Data;
+using libmuscle::Instance;
+using libmuscle::Message;
+using ymmsl::Operator;
+
+using Clock = std::chrono::steady_clock;
+
+
+namespace {
+
+/* Returns the given percentile of a sorted list of samples. */
+double percentile(std::vector<double> const & sorted, double pct) {
+    double rank = pct / 100.0 * (sorted.size() - 1u);
+    std::size_t i = static_cast<std::size_t>(rank);
+    if (i + 1u < sorted.size()) {
+        double frac = rank - double(i);
+        return sorted[i] * (1.0 - frac) + sorted[i + 1u] * frac;
+    }
+    return sorted.back();
+}
+
+}
+
+
+int main(int argc, char *argv[]) {
+    Instance instance(argc, argv, {
+            {Operator::O_I, {"out[]"}},
+            {Operator::S, {"in[]"}}});
+
+    while (instance.reuse_instance()) {
+        // F_INIT
+        int64_t num_messages = instance.get_setting_as<int64_t>(
+                "num_messages");
+        int64_t payload_bytes = instance.get_setting_as<int64_t>(
+                "payload_bytes");
+        double message_rate = instance.get_setting_as<double>(
+                "message_rate");
+
+        int num_slots = instance.get_port_length("out");
+
+        Data payload = Data::byte_array(payload_bytes);
+        std::memset(payload.as_byte_array(), 42, payload_bytes);
+
+        std::vector<double> latencies;
+        latencies.reserve(static_cast<std::size_t>(num_messages * num_slots));
+
+        auto interval = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(
+                    (message_rate > 0.0) ? 1.0 / message_rate : 0.0));
+
+        auto begin = Clock::now();
+        auto next_send = begin;
+        for (int64_t i = 0; i < num_messages; ++i) {
+            if (message_rate > 0.0) {
+                std::this_thread::sleep_until(next_send);
+                next_send += interval;
+            }
+
+            for (int slot = 0; slot < num_slots; ++slot) {
+                // O_I
+                auto start = Clock::now();
+                instance.send("out", Message(double(i), payload), slot);
+
+                // S
+                instance.receive("in", slot);
+                latencies.push_back(std::chrono::duration<double>(
+                            Clock::now() - start).count());
+            }
+        }
+        double duration = std::chrono::duration<double>(
+                Clock::now() - begin).count();
+
+        std::sort(latencies.begin(), latencies.end());
+        std::printf("num_messages: %ld\n", static_cast<long>(num_messages));
+        std::printf("payload_bytes: %ld\n", static_cast<long>(payload_bytes));
+        std::printf("num_slots: %d\n", num_slots);
+        std::printf("messages_per_sec: %.1f\n", latencies.size() / duration);
+        std::printf("payload_mb_per_sec: %.3f\n",
+                double(payload_bytes) * latencies.size() / duration * 1e-6);
+        std::printf("latency_us_min: %.1f\n", latencies.front() * 1e6);
+        std::printf("latency_us_p50: %.1f\n", percentile(latencies, 50.0) * 1e6);
+        std::printf("latency_us_p90: %.1f\n", percentile(latencies, 90.0) * 1e6);
+        std::printf("latency_us_p99: %.1f\n", percentile(latencies, 99.0) * 1e6);
+        std::printf("latency_us_max: %.1f\n", latencies.back() * 1e6);
+    }
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+/* This is a part of the integration test suite, and is run from a Python
+ * test in /integration_test. It is not a unit test.
+ *
+ * This is the pong side of the coupled-model latency benchmark; see
+ * /integration_test/benchmark_latency.py for the driver. It echoes every
+ * message it receives straight back.
+ */
+#include <libmuscle/libmuscle.hpp>
+#include <ymmsl/ymmsl.hpp>
+
+
+using libmuscle::Instance;
+using ymmsl::Operator;
+
+
+int main(int argc, char *argv[]) {
+    Instance instance(argc, argv, {
+            {Operator::F_INIT, {"in"}},
+            {Operator::O_F, {"out"}}});
+
+    while (instance.reuse_instance()) {
+        // F_INIT
+        auto msg = instance.receive("in");
+
+        // O_F
+        instance.send("out", msg);
+    }
+
+    return 0;
+}
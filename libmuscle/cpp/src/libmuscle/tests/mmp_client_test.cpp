@@ -46,6 +46,21 @@ void test_register_instance(MMPClient & client) {
             {Port("out", Operator::O_F), Port("in", Operator::F_INIT)});
 }
 
+void test_register_instances(MMPClient & client) {
+    client.register_instances(
+            {Reference("micro[4]"), Reference("micro[5]")},
+            {{"tcp:test5"}, {"tcp:test6"}},
+            {
+                {Port("out", Operator::O_F), Port("in", Operator::F_INIT)},
+                {Port("out", Operator::O_F), Port("in", Operator::F_INIT)}
+            });
+}
+
+void test_deregister_instances(MMPClient & client) {
+    client.deregister_instances(
+            {Reference("micro[4]"), Reference("micro[5]")});
+}
+
 void test_request_peers(MMPClient & client) {
     auto result = client.request_peers("micro[3]");
     assert(std::get<0>(result).size() == 2);
@@ -74,6 +89,8 @@ int main(int argc, char *argv[]) {
     test_get_settings(client);
     test_submit_log_message(client);
     test_register_instance(client);
+    test_register_instances(client);
+    test_deregister_instances(client);
     test_deregister_instance(client);
 
     return 0;
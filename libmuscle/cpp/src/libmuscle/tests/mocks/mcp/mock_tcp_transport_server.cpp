@@ -6,7 +6,8 @@ namespace libmuscle { namespace impl {
 
 namespace mcp {
 
-MockTcpTransportServer::MockTcpTransportServer(RequestHandler & handler)
+MockTcpTransportServer::MockTcpTransportServer(
+        RequestHandler & handler, int preferred_port)
     : TransportServer(handler)
 {
     ++num_constructed;
@@ -9,7 +9,8 @@ namespace libmuscle { namespace impl { namespace mcp {
 
 class MockTcpTransportServer : public TransportServer {
     public:
-        MockTcpTransportServer(RequestHandler & handler);
+        MockTcpTransportServer(
+                RequestHandler & handler, int preferred_port = 0);
 
         ~MockTcpTransportServer();
 
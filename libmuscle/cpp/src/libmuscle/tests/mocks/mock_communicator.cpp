@@ -4,6 +4,7 @@
 #include <ymmsl/ymmsl.hpp>
 
 #include <cassert>
+#include <limits>
 
 using libmuscle::impl::Data;
 using libmuscle::impl::DataConstRef;
@@ -22,7 +23,8 @@ MockCommunicator::MockCommunicator(
         ymmsl::Reference const & kernel,
         std::vector<int> const & index,
         Optional<PortsDescription> const & declared_ports,
-        Logger & logger, int profiler)
+        Logger & logger, Profiler & profiler,
+        int preferred_tcp_port)
 {
     ++num_constructed;
 }
@@ -38,6 +40,14 @@ void MockCommunicator::connect(
 {
 }
 
+bool MockCommunicator::try_connect_cached(
+        std::vector<Conduit> const & conduits,
+        PeerDims const & peer_dims,
+        PeerLocations const & peer_locations)
+{
+    return false;
+}
+
 bool MockCommunicator::settings_in_connected() const {
     return settings_in_connected_return_value;
 }
@@ -58,21 +68,60 @@ Port & MockCommunicator::get_port(std::string const & port_name) {
     return get_port_return_value.at(port_name);
 }
 
+PortHandle MockCommunicator::get_port_handle(std::string const & port_name) {
+    auto state = std::make_shared<PortHandle::State_>(
+            port_name, Identifier(port_name),
+            &get_port_return_value.at(port_name));
+    state->connected = true;
+    return PortHandle(state);
+}
+
 void MockCommunicator::send_message(
         std::string const & port_name,
         Message const & message,
-        Optional<int> slot)
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
 {
     last_sent_port = port_name;
     last_sent_message = message;
     last_sent_slot = slot;
+    last_sent_codec = codec;
+    last_sent_delta_interval = delta_interval;
+}
+
+void MockCommunicator::send_range(
+        std::string const & port_name,
+        int first_slot, int last_slot,
+        std::function<Message(int)> const & make_message,
+        Codec codec,
+        int delta_interval)
+{
+    for (int slot = first_slot; slot < last_slot; ++slot)
+        send_message(port_name, make_message(slot), slot, codec, delta_interval);
+}
+
+std::future<void> MockCommunicator::send_message_async(
+        std::string const & port_name,
+        Message const & message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    send_message(port_name, message, slot, codec, delta_interval);
+    std::promise<void> done;
+    done.set_value();
+    return done.get_future();
 }
 
 Message MockCommunicator::receive_message(
         std::string const & port_name,
         Optional<int> slot,
-        Optional<Message> const & default_msg)
+        Optional<Message> const & default_msg,
+        Optional<double> timeout,
+        int prefetch_depth)
 {
+    last_receive_timeout = timeout;
     Reference key(port_name);
     if (slot.is_set())
         key += slot.get();
@@ -90,11 +139,124 @@ Message MockCommunicator::receive_message(
     return *next_received_message.at(key);
 }
 
+void MockCommunicator::send_message(
+        PortHandle const & port_handle,
+        Message const & message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    send_message(port_handle.name(), message, slot, codec, delta_interval);
+}
+
+std::future<void> MockCommunicator::send_message_async(
+        PortHandle const & port_handle,
+        Message const & message,
+        Optional<int> slot,
+        Codec codec,
+        int delta_interval)
+{
+    return send_message_async(
+            port_handle.name(), message, slot, codec, delta_interval);
+}
+
+Message MockCommunicator::receive_message(
+        PortHandle const & port_handle,
+        Optional<int> slot,
+        Optional<Message> const & default_msg,
+        int prefetch_depth)
+{
+    return receive_message(port_handle.name(), slot, default_msg);
+}
+
+void MockCommunicator::start_receive(
+        std::string const & port_name, Optional<int> slot)
+{}
+
+std::vector<Message> MockCommunicator::receive_all(
+        std::string const & port_name)
+{
+    std::vector<Message> result;
+    int length = get_port_return_value.at(port_name).get_length();
+    for (int slot = 0; slot < length; ++slot)
+        result.push_back(receive_message(port_name, slot));
+    return result;
+}
+
+std::vector<Message> MockCommunicator::receive_batch(
+        std::string const & port_name, int max_messages)
+{
+    std::vector<Message> result;
+    result.push_back(receive_message(port_name));
+    return result;
+}
+
+std::string MockCommunicator::wait_any(
+        std::vector<std::string> const & port_names)
+{
+    last_waited_ports = port_names;
+    for (auto const & port_name : port_names)
+        if (next_received_message.count(Reference(port_name)) != 0)
+            return port_name;
+    return port_names.at(0);
+}
+
+double MockCommunicator::forward_message(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        Optional<int> slot)
+{
+    last_forwarded_from = receiving_port_name;
+    last_forwarded_to = sending_port_name;
+    last_forwarded_slot = slot;
+    Reference key(receiving_port_name);
+    if (slot.is_set())
+        key += slot.get();
+    if (next_received_message.count(key) == 0)
+        return -1.0;
+    return next_received_message.at(key)->timestamp();
+}
+
+std::vector<double> MockCommunicator::forward_batch(
+        std::string const & receiving_port_name,
+        std::string const & sending_port_name,
+        int max_messages)
+{
+    std::vector<double> result;
+    result.push_back(forward_message(receiving_port_name, sending_port_name));
+    return result;
+}
+
+std::unordered_map<std::string, std::vector<int>>
+MockCommunicator::get_message_counts() const {
+    return get_message_counts_return_value;
+}
+
+void MockCommunicator::restore_message_counts(
+        std::unordered_map<std::string, std::vector<int>> const &
+            port_message_counts)
+{
+    last_restored_message_counts = port_message_counts;
+}
+
+void MockCommunicator::set_checkpoints_considered_until(
+        double checkpoints_considered_until)
+{
+    last_checkpoints_considered_until = checkpoints_considered_until;
+}
+
+double MockCommunicator::received_saved_until() const {
+    return received_saved_until_return_value;
+}
+
 void MockCommunicator::close_port(
         std::string const & port_name, Optional<int> slot)
 {
 }
 
+void MockCommunicator::close_vector_port(std::string const & port_name) {
+}
+
 void MockCommunicator::shutdown() {
 }
 
@@ -109,6 +271,19 @@ void MockCommunicator::reset() {
     last_sent_port = "";
     last_sent_message = Message(0.0);
     last_sent_slot = {};
+    last_sent_codec = Codec::none;
+    last_sent_delta_interval = 0;
+    last_receive_timeout = {};
+    last_waited_ports.clear();
+    last_forwarded_from = "";
+    last_forwarded_to = "";
+    last_forwarded_slot = {};
+    get_message_counts_return_value.clear();
+    last_restored_message_counts.clear();
+    last_checkpoints_considered_until =
+        -std::numeric_limits<double>::infinity();
+    received_saved_until_return_value =
+        -std::numeric_limits<double>::infinity();
 }
 
 int MockCommunicator::num_constructed = 0;
@@ -130,5 +305,30 @@ Message MockCommunicator::last_sent_message(0.0);
 
 Optional<int> MockCommunicator::last_sent_slot;
 
+Codec MockCommunicator::last_sent_codec = Codec::none;
+int MockCommunicator::last_sent_delta_interval = 0;
+
+Optional<double> MockCommunicator::last_receive_timeout;
+
+std::vector<std::string> MockCommunicator::last_waited_ports;
+
+std::string MockCommunicator::last_forwarded_from;
+
+std::string MockCommunicator::last_forwarded_to;
+
+Optional<int> MockCommunicator::last_forwarded_slot;
+
+std::unordered_map<std::string, std::vector<int>>
+    MockCommunicator::get_message_counts_return_value;
+
+std::unordered_map<std::string, std::vector<int>>
+    MockCommunicator::last_restored_message_counts;
+
+double MockCommunicator::last_checkpoints_considered_until =
+    -std::numeric_limits<double>::infinity();
+
+double MockCommunicator::received_saved_until_return_value =
+    -std::numeric_limits<double>::infinity();
+
 } }
 
@@ -1,14 +1,20 @@
 #pragma once
 
+#include <libmuscle/compression.hpp>
 #include <libmuscle/data.hpp>
 #include <libmuscle/logger.hpp>
 #include <libmuscle/message.hpp>
 #include <libmuscle/peer_manager.hpp>
 #include <libmuscle/port.hpp>
+#include <libmuscle/port_handle.hpp>
+#include <libmuscle/profiler.hpp>
 #include <libmuscle/util.hpp>
 
 #include <ymmsl/ymmsl.hpp>
 
+#include <functional>
+
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -26,7 +32,8 @@ class MockCommunicator {
                 ymmsl::Reference const & kernel,
                 std::vector<int> const & index,
                 Optional<PortsDescription> const & declared_ports,
-                Logger & logger, int profiler);
+                Logger & logger, Profiler & profiler,
+                int preferred_tcp_port = 0);
 
         std::vector<std::string> get_locations() const;
 
@@ -35,6 +42,11 @@ class MockCommunicator {
                 PeerDims const & peer_dims,
                 PeerLocations const & peer_locations);
 
+        bool try_connect_cached(
+                std::vector<ymmsl::Conduit> const & conduits,
+                PeerDims const & peer_dims,
+                PeerLocations const & peer_locations);
+
         bool settings_in_connected() const;
 
         PortsDescription list_ports() const;
@@ -45,19 +57,94 @@ class MockCommunicator {
 
         Port & get_port(std::string const & port_name);
 
+        PortHandle get_port_handle(std::string const & port_name);
+
         void send_message(
                 std::string const & port_name,
                 Message const & message,
-                Optional<int> slot = {});
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        std::future<void> send_message_async(
+                std::string const & port_name,
+                Message const & message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        void send_range(
+                std::string const & port_name,
+                int first_slot, int last_slot,
+                std::function<Message(int)> const & make_message,
+                Codec codec = Codec::none,
+                int delta_interval = 0);
 
         Message receive_message(
                 std::string const & port_name,
                 Optional<int> slot = {},
-                Optional<Message> const & default_msg = {}
+                Optional<Message> const & default_msg = {},
+                Optional<double> timeout = {},
+                int prefetch_depth = 1
                 );
 
+        void send_message(
+                PortHandle const & port_handle,
+                Message const & message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        std::future<void> send_message_async(
+                PortHandle const & port_handle,
+                Message const & message,
+                Optional<int> slot = {},
+                Codec codec = Codec::none,
+                int delta_interval = 0);
+
+        Message receive_message(
+                PortHandle const & port_handle,
+                Optional<int> slot = {},
+                Optional<Message> const & default_msg = {},
+                int prefetch_depth = 1
+                );
+
+        void start_receive(
+                std::string const & port_name, Optional<int> slot = {});
+
+        std::vector<Message> receive_all(std::string const & port_name);
+
+        std::vector<Message> receive_batch(
+                std::string const & port_name, int max_messages);
+
+        std::string wait_any(std::vector<std::string> const & port_names);
+
+        double forward_message(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                Optional<int> slot = {});
+
+        std::vector<double> forward_batch(
+                std::string const & receiving_port_name,
+                std::string const & sending_port_name,
+                int max_messages);
+
+        std::unordered_map<std::string, std::vector<int>>
+        get_message_counts() const;
+
+        void restore_message_counts(
+                std::unordered_map<std::string, std::vector<int>> const &
+                    port_message_counts);
+
+        void set_checkpoints_considered_until(
+                double checkpoints_considered_until);
+
+        double received_saved_until() const;
+
         void close_port(std::string const & port_name, Optional<int> slot = {});
 
+        void close_vector_port(std::string const & port_name);
+
         void shutdown();
 
         static void reset();
@@ -71,6 +158,19 @@ class MockCommunicator {
         static std::string last_sent_port;
         static Message last_sent_message;
         static Optional<int> last_sent_slot;
+        static Codec last_sent_codec;
+        static int last_sent_delta_interval;
+        static Optional<double> last_receive_timeout;
+        static std::vector<std::string> last_waited_ports;
+        static std::string last_forwarded_from;
+        static std::string last_forwarded_to;
+        static Optional<int> last_forwarded_slot;
+        static std::unordered_map<std::string, std::vector<int>>
+            get_message_counts_return_value;
+        static std::unordered_map<std::string, std::vector<int>>
+            last_restored_message_counts;
+        static double last_checkpoints_considered_until;
+        static double received_saved_until_return_value;
 
     private:
         friend class TestCommunicator;
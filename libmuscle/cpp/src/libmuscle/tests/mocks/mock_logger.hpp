@@ -17,6 +17,8 @@ class MockLogger {
 
         void set_local_level(LogLevel level) {}
 
+        void flush() {}
+
         template <typename... Args>
         void log(LogLevel level, Args... args) {}
 
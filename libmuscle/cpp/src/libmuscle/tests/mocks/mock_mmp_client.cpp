@@ -18,6 +18,15 @@ void MockMMPClient::close() {}
 
 void MockMMPClient::submit_log_message(LogMessage const & message) {
     last_submitted_log_message = message;
+    ++num_submitted_log_messages;
+}
+
+void MockMMPClient::submit_log_messages(
+        std::vector<LogMessage> const & messages)
+{
+    if (!messages.empty())
+        last_submitted_log_message = messages.back();
+    num_submitted_log_messages += messages.size();
 }
 
 void MockMMPClient::register_instance(
@@ -37,6 +46,25 @@ ymmsl::Settings MockMMPClient::get_settings() {
     return settings;
 }
 
+auto MockMMPClient::get_checkpoint_info(Reference const & name) ->
+        std::tuple<
+            double,
+            Checkpoints,
+            Optional<std::string>,
+            Optional<std::string>
+        >
+{
+    return std::make_tuple(
+            checkpoint_info_elapsed, checkpoint_info_checkpoints,
+            checkpoint_info_resume, checkpoint_info_snapshot_directory);
+}
+
+void MockMMPClient::submit_snapshot_metadata(
+        Reference const & name, SnapshotMetadata const & metadata)
+{
+    submitted_snapshot_metadata.push_back(metadata);
+}
+
 auto MockMMPClient::request_peers(Reference const & name) ->
         std::tuple<
             std::vector<::ymmsl::Conduit>,
@@ -68,6 +96,12 @@ void MockMMPClient::reset() {
     last_submitted_log_message.timestamp = Timestamp(-1.0);
     last_submitted_log_message.level = LogLevel::DEBUG;
     last_submitted_log_message.text = "";
+    num_submitted_log_messages = 0;
+    checkpoint_info_elapsed = 0.0;
+    checkpoint_info_checkpoints = Checkpoints();
+    checkpoint_info_resume = {};
+    checkpoint_info_snapshot_directory = {};
+    submitted_snapshot_metadata.clear();
 }
 
 int MockMMPClient::num_constructed = 0;
@@ -83,5 +117,17 @@ std::vector<::ymmsl::Port> MockMMPClient::last_registered_ports({});
 LogMessage MockMMPClient::last_submitted_log_message(
         "", Timestamp(-1.0), LogLevel::DEBUG, "");
 
+int MockMMPClient::num_submitted_log_messages = 0;
+
+double MockMMPClient::checkpoint_info_elapsed = 0.0;
+
+Checkpoints MockMMPClient::checkpoint_info_checkpoints;
+
+Optional<std::string> MockMMPClient::checkpoint_info_resume;
+
+Optional<std::string> MockMMPClient::checkpoint_info_snapshot_directory;
+
+std::vector<SnapshotMetadata> MockMMPClient::submitted_snapshot_metadata;
+
 } }
 
@@ -5,8 +5,11 @@
 #include <unordered_map>
 #include <vector>
 
+#include <libmuscle/checkpoint_triggers.hpp>
 #include <libmuscle/logging.hpp>
+#include <libmuscle/snapshot.hpp>
 #include <libmuscle/timestamp.hpp>
+#include <libmuscle/util.hpp>
 
 #include <ymmsl/ymmsl.hpp>
 
@@ -21,8 +24,22 @@ class MockMMPClient {
 
         void submit_log_message(LogMessage const & message);
 
+        void submit_log_messages(std::vector<LogMessage> const & messages);
+
         ymmsl::Settings get_settings();
 
+        auto get_checkpoint_info(::ymmsl::Reference const & name) ->
+            std::tuple<
+                double,
+                Checkpoints,
+                Optional<std::string>,
+                Optional<std::string>
+            >;
+
+        void submit_snapshot_metadata(
+                ::ymmsl::Reference const & name,
+                SnapshotMetadata const & metadata);
+
         void register_instance(
                 ::ymmsl::Reference const & name,
                 std::vector<std::string> const & locations,
@@ -45,6 +62,12 @@ class MockMMPClient {
         static std::vector<std::string> last_registered_locations;
         static std::vector<::ymmsl::Port> last_registered_ports;
         static LogMessage last_submitted_log_message;
+        static int num_submitted_log_messages;
+        static double checkpoint_info_elapsed;
+        static Checkpoints checkpoint_info_checkpoints;
+        static Optional<std::string> checkpoint_info_resume;
+        static Optional<std::string> checkpoint_info_snapshot_directory;
+        static std::vector<SnapshotMetadata> submitted_snapshot_metadata;
 };
 
 using MMPClient = MockMMPClient;
@@ -18,25 +18,70 @@ MockMPPClient::~MockMPPClient() {}
 
 DataConstRef MockMPPClient::receive(::ymmsl::Reference const & receiver) {
     last_receiver = receiver;
+    last_receive_timeout = receive_timeout;
 
     return next_receive_message.encoded();
 }
 
+void MockMPPClient::start_receive(::ymmsl::Reference const & receiver) {
+    last_receiver = receiver;
+    ++num_outstanding;
+}
+
+DataConstRef MockMPPClient::finish_receive() {
+    --num_outstanding;
+    last_receive_timeout = receive_timeout;
+    return next_receive_message.encoded();
+}
+
+bool MockMPPClient::poll_receive() {
+    return true;
+}
+
+int MockMPPClient::poll_fd() const {
+    return -1;
+}
+
+void MockMPPClient::start_receive_batch(
+        ::ymmsl::Reference const & receiver, int max_messages)
+{
+    last_receiver = receiver;
+    ++num_outstanding;
+}
+
+std::vector<DataConstRef> MockMPPClient::finish_receive_batch() {
+    --num_outstanding;
+    last_receive_timeout = receive_timeout;
+    std::vector<DataConstRef> messages;
+    messages.push_back(next_receive_message.encoded());
+    return messages;
+}
+
+void MockMPPClient::set_receive_timeout(Optional<double> const & timeout) {
+    receive_timeout = timeout;
+}
+
 void MockMPPClient::close() {}
 
 
 void MockMPPClient::reset() {
     num_constructed = 0;
-    next_receive_message.sender = "test.out";
-    next_receive_message.receiver = "test2.in";
-    next_receive_message.port_length = 0;
-    next_receive_message.timestamp = 0.0;
-    next_receive_message.next_timestamp = 1.0;
+    num_outstanding = 0;
+    next_receive_message.set_sender("test.out");
+    next_receive_message.set_receiver("test2.in");
+    next_receive_message.set_port_length(0);
+    next_receive_message.set_timestamp(0.0);
+    next_receive_message.set_next_timestamp(1.0);
+    next_receive_message.set_message_number(0);
     last_receiver = "_none";
+    receive_timeout = {};
+    last_receive_timeout = {};
 }
 
 int MockMPPClient::num_constructed = 0;
 
+int MockMPPClient::num_outstanding = 0;
+
 Settings MockMPPClient::make_overlay_() {
     Settings s;
     s["test2"] = 3.1;
@@ -49,5 +94,9 @@ MPPMessage MockMPPClient::next_receive_message(
 
 Reference MockMPPClient::last_receiver("_none");
 
+Optional<double> MockMPPClient::receive_timeout;
+
+Optional<double> MockMPPClient::last_receive_timeout;
+
 } }
 
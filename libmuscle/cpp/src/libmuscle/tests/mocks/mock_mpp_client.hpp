@@ -1,6 +1,7 @@
 #pragma once
 
 #include <libmuscle/mpp_message.hpp>
+#include <libmuscle/util.hpp>
 
 #include <ymmsl/ymmsl.hpp>
 
@@ -21,14 +22,34 @@ class MockMPPClient {
 
         DataConstRef receive(::ymmsl::Reference const & receiver);
 
+        void start_receive(::ymmsl::Reference const & receiver);
+
+        DataConstRef finish_receive();
+
+        bool poll_receive();
+
+        int poll_fd() const;
+
+        void start_receive_batch(
+                ::ymmsl::Reference const & receiver, int max_messages);
+
+        std::vector<DataConstRef> finish_receive_batch();
+
+        void set_receive_timeout(Optional<double> const & timeout);
+
         void close();
 
         // Mock control variables
         static void reset();
 
         static int num_constructed;
+        static int num_outstanding;
         static MPPMessage next_receive_message;
         static ::ymmsl::Reference last_receiver;
+        // the currently set timeout, as per set_receive_timeout()
+        static Optional<double> receive_timeout;
+        // the timeout that was in effect during the last receive
+        static Optional<double> last_receive_timeout;
 
     private:
         static ::ymmsl::Settings make_overlay_();
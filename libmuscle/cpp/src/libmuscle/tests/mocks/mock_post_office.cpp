@@ -22,10 +22,21 @@ void MockPostOffice::deposit(
     last_message = std::make_unique<MPPMessage>(MPPMessage::from_bytes(*message));
 }
 
+void MockPostOffice::deposit_batch(
+        std::vector<std::pair<
+                ymmsl::Reference, std::unique_ptr<DataConstRef>>> messages) {
+    for (auto & msg : messages)
+        deposit(msg.first, std::move(msg.second));
+}
+
 void MockPostOffice::wait_for_receivers() const {
 
 }
 
+void MockPostOffice::discard_retransmits_until(double saved_until) {
+
+}
+
 void MockPostOffice::reset() {
     last_receiver = "_none";
     last_message.reset();
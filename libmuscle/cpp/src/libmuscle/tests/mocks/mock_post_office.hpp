@@ -2,6 +2,9 @@
 
 #include <ymmsl/ymmsl.hpp>
 
+#include <utility>
+#include <vector>
+
 #include <libmuscle/data.hpp>
 #include <libmuscle/mpp_message.hpp>
 #include <libmuscle/mcp/transport_server.hpp>
@@ -25,8 +28,15 @@ class MockPostOffice : public mcp::RequestHandler {
                 ymmsl::Reference const & receiver,
                 std::unique_ptr<DataConstRef> message);
 
+        void deposit_batch(
+                std::vector<std::pair<
+                        ymmsl::Reference, std::unique_ptr<DataConstRef>
+                >> messages);
+
         void wait_for_receivers() const;
 
+        void discard_retransmits_until(double saved_until);
+
         // Mock control variables
         static void reset();
 
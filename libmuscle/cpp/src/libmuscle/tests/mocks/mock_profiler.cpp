@@ -0,0 +1,11 @@
+#include "mocks/mock_profiler.hpp"
+
+
+namespace libmuscle { namespace impl {
+
+MockProfiler::MockProfiler() {}
+
+MockProfiler::MockProfiler(
+        std::string const & instance_id, MMPClient & manager) {}
+
+} }
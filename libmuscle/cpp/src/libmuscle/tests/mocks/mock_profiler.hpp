@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include <libmuscle/mmp_client.hpp>
+#include <libmuscle/profiling.hpp>
+
+
+namespace libmuscle { namespace impl {
+
+class MockProfiler {
+    public:
+        MockProfiler();
+        MockProfiler(std::string const & instance_id, MMPClient & manager);
+
+        void shutdown() {}
+
+        void record_event(ProfileEvent && event) {}
+};
+
+using Profiler = MockProfiler;
+
+} }
@@ -36,23 +36,23 @@ int main(int argc, char *argv[]) {
     MPPMessage message = MPPMessage::from_bytes(bytes);
 
     // check message
-    assert(message.sender == Reference("test_sender.test_port"));
-    assert(message.receiver == receiver);
-    assert(message.port_length == 10);
-    assert(message.timestamp == 1.0);
-    assert(message.next_timestamp == 2.0);
+    assert(message.sender() == Reference("test_sender.test_port"));
+    assert(message.receiver() == receiver);
+    assert(message.port_length() == 10);
+    assert(message.timestamp() == 1.0);
+    assert(message.next_timestamp() == 2.0);
 
-    auto overlay = message.settings_overlay.as<Settings>();
+    auto overlay = message.settings_overlay().as<Settings>();
     assert(overlay["test_setting"].is_a<int64_t>());
     assert(overlay["test_setting"].as<int64_t>() == 42);
 
-    assert(message.data.is_a_dict());
-    assert(message.data["test1"].is_a<int>());
-    assert(message.data["test1"].as<int>() == 10);
-    assert(message.data["test2"].is_a_list());
-    assert(message.data["test2"][0].is_nil());
-    assert(message.data["test2"][1].as<bool>() == true);
-    assert(message.data["test2"][2].as<std::string>() == "testing");
+    assert(message.data().is_a_dict());
+    assert(message.data()["test1"].is_a<int>());
+    assert(message.data()["test1"].as<int>() == 10);
+    assert(message.data()["test2"].is_a_list());
+    assert(message.data()["test2"][0].is_nil());
+    assert(message.data()["test2"][1].as<bool>() == true);
+    assert(message.data()["test2"][2].as<std::string>() == "testing");
 
     return 0;
 }
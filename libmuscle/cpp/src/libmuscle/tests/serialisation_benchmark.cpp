@@ -0,0 +1,200 @@
+/* Benchmarks for the serialisation layer.
+ *
+ * This is not a test, and it is not built or run by default; use the
+ * benchmark target in libmuscle/cpp to do so:
+ *
+ *     make benchmark
+ *
+ * Each benchmark builds or decodes objects of sizes from 1 kB up to a
+ * maximum, and reports throughput in MB/s and the number of memory
+ * allocations done per operation. Results are printed to standard output;
+ * compare them between commits to quantify regressions before they reach
+ * a production coupling.
+ *
+ * The default maximum size is 64 MB, so that the suite runs quickly. Pass
+ * a maximum size in MB as the first argument to go bigger, e.g. 4096 to
+ * measure all the way up to 4 GB messages (make sure you have the RAM).
+ *
+ * Allocations are counted by intercepting operator new. Note that the
+ * memory for msgpack zone chunks is obtained via malloc, so those are not
+ * included in the count.
+ */
+#include <libmuscle/data.hpp>
+#include <libmuscle/mcp/data_pack.hpp>
+#include <libmuscle/mpp_message.hpp>
+
+#include <ymmsl/ymmsl.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+
+using libmuscle::impl::Data;
+using libmuscle::impl::DataConstRef;
+using libmuscle::impl::MPPMessage;
+using libmuscle::impl::Optional;
+using libmuscle::impl::mcp::unpack_data;
+using ymmsl::Reference;
+
+using Clock = std::chrono::steady_clock;
+
+
+namespace {
+
+// number of calls to operator new since the program started
+std::size_t num_allocations = 0u;
+
+}
+
+void * operator new(std::size_t size) {
+    ++num_allocations;
+    void * ptr = std::malloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void * operator new[](std::size_t size) {
+    ++num_allocations;
+    void * ptr = std::malloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void * ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+
+namespace {
+
+struct Measurement {
+    double seconds;
+    std::size_t allocations;
+    int reps;
+};
+
+/* Runs the given operation repeatedly and measures it.
+ *
+ * The number of repetitions is doubled until the total run time is long
+ * enough to measure reliably.
+ */
+template <typename Op>
+Measurement measure(Op const & op) {
+    // warm up the caches and the zone pool
+    op();
+
+    int reps = 1;
+    for (;;) {
+        std::size_t allocations_before = num_allocations;
+        auto start = Clock::now();
+        for (int i = 0; i < reps; ++i)
+            op();
+        auto stop = Clock::now();
+        double seconds = std::chrono::duration<double>(stop - start).count();
+        if (seconds >= 0.2 || reps >= 65536)
+            return Measurement{
+                    seconds, num_allocations - allocations_before, reps};
+        reps *= 2;
+    }
+}
+
+void report(
+        char const * name, std::size_t num_bytes, Measurement const & meas
+) {
+    double bytes_per_sec = double(num_bytes) * meas.reps / meas.seconds;
+    double allocs_per_op = double(meas.allocations) / meas.reps;
+    std::printf("%-24s %14zu B %12.1f MB/s %12.1f allocs/op\n",
+            name, num_bytes, bytes_per_sec * 1e-6, allocs_per_op);
+}
+
+/* Makes an on-the-wire message with a payload of the given size. */
+MPPMessage make_message(std::size_t num_bytes) {
+    Data payload = Data::byte_array(num_bytes);
+    std::memset(payload.as_byte_array(), 42, num_bytes);
+    return MPPMessage(
+            "sender.out", "receiver.in", Optional<int>(),
+            0.0, 1.0, Data::dict(), 0, 0.1, std::move(payload));
+}
+
+void benchmark_grid(std::size_t num_bytes) {
+    std::vector<double> buf(num_bytes / sizeof(double), 1.0);
+    auto meas = measure([&buf]() {
+            Data grid = Data::grid(buf.data(), {buf.size()}, {"x"});
+            (void)grid;
+            });
+    report("Data::grid()", buf.size() * sizeof(double), meas);
+}
+
+void benchmark_encode(std::size_t num_bytes) {
+    MPPMessage message = make_message(num_bytes);
+    auto meas = measure([&message]() {
+            DataConstRef wire_data = message.encoded();
+            (void)wire_data;
+            });
+    report("MPPMessage::encoded()", num_bytes, meas);
+}
+
+void benchmark_unpack(std::size_t num_bytes) {
+    DataConstRef wire_data = make_message(num_bytes).encoded();
+    auto meas = measure([&wire_data]() {
+            auto zone = std::make_shared<msgpack::zone>();
+            Data data = unpack_data(
+                    zone, wire_data.as_byte_array(), wire_data.size());
+            (void)data;
+            });
+    report("mcp::unpack_data()", wire_data.size(), meas);
+}
+
+void benchmark_reference(std::size_t num_bytes) {
+    // build a reference string of roughly the given size
+    std::string text("instance");
+    while (text.size() < num_bytes)
+        text += "[42].port0";
+
+    auto meas = measure([&text]() {
+            Reference ref(text);
+            (void)ref;
+            });
+    report("Reference()", text.size(), meas);
+}
+
+}
+
+
+int main(int argc, char * argv[]) {
+    std::size_t max_size = 64u * 1024u * 1024u;
+    if (argc > 1)
+        max_size = std::strtoull(argv[1], nullptr, 10) * 1024u * 1024u;
+
+    for (std::size_t size = 1024u; size <= max_size; size *= 8u) {
+        benchmark_grid(size);
+        benchmark_encode(size);
+        benchmark_unpack(size);
+    }
+
+    // references are never anywhere near this big, so cap at 64 kB
+    std::size_t max_ref_size = std::min<std::size_t>(max_size, 64u * 1024u);
+    for (std::size_t size = 1024u; size <= max_ref_size; size *= 8u)
+        benchmark_reference(size);
+
+    return EXIT_SUCCESS;
+}
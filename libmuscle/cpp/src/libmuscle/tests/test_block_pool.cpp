@@ -0,0 +1,59 @@
+#include "libmuscle/block_pool.hpp"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+
+using libmuscle::impl::BlockPoolAllocator;
+using libmuscle::impl::pooled_block_alloc;
+using libmuscle::impl::pooled_block_free;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST(libmuscle_block_pool, reuses_blocks) {
+    void * block = pooled_block_alloc(48u);
+    pooled_block_free(block, 48u);
+
+    // the freed block is recycled rather than a new one made
+    void * block2 = pooled_block_alloc(48u);
+    ASSERT_EQ(block2, block);
+    pooled_block_free(block2, 48u);
+}
+
+TEST(libmuscle_block_pool, separate_sizes) {
+    void * small_block = pooled_block_alloc(16u);
+    pooled_block_free(small_block, 16u);
+
+    // a different size gets its own freelist, not the 16-byte block
+    void * large_block = pooled_block_alloc(4096u);
+    ASSERT_NE(large_block, small_block);
+    pooled_block_free(large_block, 4096u);
+}
+
+TEST(libmuscle_block_pool, allocate_shared) {
+    struct Envelope_ {
+        double timestamp = 0.0;
+        int message_number = 0;
+    };
+
+    void * block = nullptr;
+    {
+        auto envelope = std::allocate_shared<Envelope_>(
+                BlockPoolAllocator<Envelope_>());
+        envelope->message_number = 13;
+        block = envelope.get();
+    }
+
+    // releasing the last reference returned the combined block, so the
+    // next one is made in place in it
+    auto envelope = std::allocate_shared<Envelope_>(
+            BlockPoolAllocator<Envelope_>());
+    ASSERT_EQ(static_cast<void *>(envelope.get()), block);
+    ASSERT_EQ(envelope->message_number, 0);
+}
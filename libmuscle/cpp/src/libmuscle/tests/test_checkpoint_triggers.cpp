@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <libmuscle/checkpoint_triggers.hpp>
+#include <libmuscle/util.hpp>
+
+
+using libmuscle::impl::AtCheckpointTrigger;
+using libmuscle::impl::CheckpointRule;
+using libmuscle::impl::Checkpoints;
+using libmuscle::impl::CombinedCheckpointTriggers;
+using libmuscle::impl::RangeCheckpointTrigger;
+using libmuscle::impl::TriggerManager;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(libmuscle_checkpoint_triggers, test_at_checkpoint_trigger) {
+    AtCheckpointTrigger trigger({1.0, 3.0, 4.0, 4.5, 9.0});
+
+    ASSERT_EQ(trigger.next_checkpoint(0.0).get(), 1.0);
+    ASSERT_EQ(trigger.previous_checkpoint(0.0).is_set(), false);
+
+    ASSERT_EQ(trigger.next_checkpoint(1.0).get(), 3.0);
+    ASSERT_EQ(trigger.previous_checkpoint(1.0).get(), 1.0);
+
+    ASSERT_EQ(trigger.next_checkpoint(4.2).get(), 4.5);
+    ASSERT_EQ(trigger.previous_checkpoint(4.2).get(), 4.0);
+
+    ASSERT_EQ(trigger.next_checkpoint(9.0).is_set(), false);
+    ASSERT_EQ(trigger.previous_checkpoint(11.0).get(), 9.0);
+}
+
+TEST(libmuscle_checkpoint_triggers, test_range_checkpoint_trigger) {
+    CheckpointRule rule;
+    rule.start = 0.0;
+    rule.stop = 20.0;
+    rule.every = 1.2;
+    RangeCheckpointTrigger trigger(rule);
+
+    ASSERT_EQ(trigger.next_checkpoint(-1.0).get(), 0.0);
+    ASSERT_EQ(trigger.previous_checkpoint(-1.0).is_set(), false);
+
+    ASSERT_EQ(trigger.next_checkpoint(0.0).get(), 1.2);
+    ASSERT_EQ(trigger.previous_checkpoint(0.0).get(), 0.0);
+
+    ASSERT_EQ(trigger.next_checkpoint(8.0).get(), 8.4);
+    ASSERT_EQ(trigger.previous_checkpoint(8.0).get(), 7.2);
+
+    // the last checkpoint in this range is at 19.2
+    ASSERT_EQ(trigger.next_checkpoint(19.3).is_set(), false);
+    ASSERT_EQ(trigger.previous_checkpoint(22.0).get(), 19.2);
+}
+
+TEST(libmuscle_checkpoint_triggers, test_range_checkpoint_trigger_no_stop) {
+    CheckpointRule rule;
+    rule.start = 1.0;
+    rule.every = 1.0;
+    RangeCheckpointTrigger trigger(rule);
+
+    ASSERT_EQ(trigger.next_checkpoint(148.0).get(), 149.0);
+    ASSERT_EQ(trigger.previous_checkpoint(148.0).get(), 148.0);
+}
+
+TEST(libmuscle_checkpoint_triggers, test_combined_checkpoint_triggers) {
+    CheckpointRule at_rule;
+    at_rule.at = {3.0, 7.0};
+    CheckpointRule range_rule;
+    range_rule.start = 0.0;
+    range_rule.stop = 20.0;
+    range_rule.every = 5.0;
+    CombinedCheckpointTriggers triggers({at_rule, range_rule});
+
+    ASSERT_EQ(triggers.next_checkpoint(2.0).get(), 3.0);
+    ASSERT_EQ(triggers.previous_checkpoint(2.0).get(), 0.0);
+
+    ASSERT_EQ(triggers.next_checkpoint(6.0).get(), 7.0);
+    ASSERT_EQ(triggers.previous_checkpoint(6.0).get(), 5.0);
+
+    ASSERT_EQ(triggers.next_checkpoint(18.0).get(), 20.0);
+    ASSERT_EQ(triggers.previous_checkpoint(18.0).get(), 15.0);
+
+    ASSERT_EQ(triggers.next_checkpoint(20.0).is_set(), false);
+    ASSERT_EQ(triggers.previous_checkpoint(25.0).get(), 20.0);
+}
+
+TEST(libmuscle_checkpoint_triggers, test_trigger_manager_simulation_time) {
+    CheckpointRule rule;
+    rule.every = 10.0;
+    Checkpoints checkpoints;
+    checkpoints.simulation_time.push_back(rule);
+
+    TriggerManager manager;
+    manager.set_checkpoint_info(0.0, checkpoints);
+
+    ASSERT_FALSE(manager.should_save_snapshot(4.0));
+    ASSERT_TRUE(manager.get_triggers().empty());
+
+    ASSERT_TRUE(manager.should_save_snapshot(11.0));
+    auto triggers = manager.get_triggers();
+    ASSERT_EQ(triggers.size(), 1u);
+    ASSERT_NE(triggers[0].find("simulation_time"), std::string::npos);
+    manager.update_checkpoints(11.0);
+
+    ASSERT_FALSE(manager.should_save_snapshot(13.0));
+    ASSERT_TRUE(manager.should_save_snapshot(22.5));
+    manager.update_checkpoints(22.5);
+}
+
+TEST(libmuscle_checkpoint_triggers, test_trigger_manager_at_end) {
+    Checkpoints checkpoints;
+    checkpoints.at_end = true;
+
+    TriggerManager manager;
+    manager.set_checkpoint_info(0.0, checkpoints);
+
+    ASSERT_FALSE(manager.should_save_snapshot(1.0));
+    ASSERT_TRUE(manager.should_save_final_snapshot(false, {}));
+    auto triggers = manager.get_triggers();
+    ASSERT_EQ(triggers.size(), 1u);
+    ASSERT_EQ(triggers[0], "at_end");
+}
+
+TEST(libmuscle_checkpoint_triggers, test_trigger_manager_no_checkpoints) {
+    TriggerManager manager;
+    manager.set_checkpoint_info(0.0, Checkpoints());
+
+    ASSERT_FALSE(manager.should_save_snapshot(1.0));
+    ASSERT_FALSE(manager.should_save_final_snapshot(false, {}));
+}
+
+TEST(libmuscle_checkpoint_triggers, test_trigger_manager_walltime) {
+    TriggerManager manager;
+    ASSERT_GE(manager.elapsed_walltime(), 0.0);
+
+    manager.set_checkpoint_info(15.0, Checkpoints());
+    double elapsed = manager.elapsed_walltime();
+    ASSERT_GE(elapsed, 15.0);
+
+    manager.harmonise_wall_time(25.0);
+    ASSERT_GE(manager.elapsed_walltime(), 25.0);
+}
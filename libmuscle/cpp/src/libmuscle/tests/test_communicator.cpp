@@ -1,5 +1,6 @@
 // Inject mocks
 #define LIBMUSCLE_MOCK_LOGGER <mocks/mock_logger.hpp>
+#define LIBMUSCLE_MOCK_PROFILER <mocks/mock_profiler.hpp>
 #define LIBMUSCLE_MOCK_MPP_CLIENT <mocks/mock_mpp_client.hpp>
 #define LIBMUSCLE_MOCK_MCP_TCP_TRANSPORT_SERVER <mocks/mcp/mock_tcp_transport_server.hpp>
 #define LIBMUSCLE_MOCK_PEER_MANAGER <mocks/mock_peer_manager.hpp>
@@ -12,6 +13,7 @@
 #include <libmuscle/communicator.cpp>
 #include <libmuscle/data.cpp>
 #include <libmuscle/endpoint.cpp>
+#include <libmuscle/instrumentation.cpp>
 #include <libmuscle/mcp/data_pack.cpp>
 #include <libmuscle/mpp_message.cpp>
 #include <libmuscle/mcp/tcp_transport_client.cpp>
@@ -20,9 +22,12 @@
 #include <libmuscle/mcp/transport_server.cpp>
 #include <libmuscle/message.cpp>
 #include <libmuscle/port.cpp>
+#include <libmuscle/port_handle.cpp>
+#include <libmuscle/profiling.cpp>
 
 // then add mock implementations as needed.
 #include <mocks/mock_logger.cpp>
+#include <mocks/mock_profiler.cpp>
 #include <mocks/mock_peer_manager.cpp>
 #include <mocks/mock_post_office.cpp>
 #include <mocks/mock_mpp_client.cpp>
@@ -38,6 +43,7 @@
 #include <mocks/mcp/mock_tcp_transport_server.hpp>
 #include <mocks/mock_logger.hpp>
 #include <mocks/mock_peer_manager.hpp>
+#include <mocks/mock_profiler.hpp>
 
 using libmuscle::impl::Communicator;
 using libmuscle::impl::Data;
@@ -48,7 +54,9 @@ using libmuscle::impl::PeerLocations;
 using libmuscle::impl::MockLogger;
 using libmuscle::impl::MockPeerManager;
 using libmuscle::impl::MockPostOffice;
+using libmuscle::impl::MockProfiler;
 using libmuscle::impl::Port;
+using libmuscle::impl::PortHandle;
 using libmuscle::impl::PortsDescription;
 using libmuscle::impl::Message;
 using libmuscle::impl::MockMPPClient;
@@ -95,9 +103,14 @@ MockLogger & mock_logger() {
     return logger;
 }
 
+MockProfiler & mock_profiler() {
+    static MockProfiler profiler;
+    return profiler;
+}
+
 std::unique_ptr<Communicator> connected_communicator() {
     std::unique_ptr<Communicator> comm(new Communicator(
-            Reference("kernel"), {13}, {}, mock_logger(), 0));
+            Reference("kernel"), {13}, {}, mock_logger(), mock_profiler()));
 
     std::vector<Conduit> conduits({
         Conduit("kernel.out", "other.in"),
@@ -120,7 +133,7 @@ std::unique_ptr<Communicator> connected_communicator() {
 
 std::unique_ptr<Communicator> connected_communicator2() {
     std::unique_ptr<Communicator> comm(new Communicator(
-            Reference("other"), {}, {}, mock_logger(), 0));
+            Reference("other"), {}, {}, mock_logger(), mock_profiler()));
 
     std::vector<Conduit> conduits({
         Conduit("kernel.out", "other.in"),
@@ -148,7 +161,7 @@ std::unique_ptr<Communicator> connected_communicator3() {
             });
 
     std::unique_ptr<Communicator> comm(new Communicator(
-            Reference("kernel"), {}, desc, mock_logger(), 0));
+            Reference("kernel"), {}, desc, mock_logger(), mock_profiler()));
 
     std::vector<Conduit> conduits({
         Conduit("kernel.out", "other.in"),
@@ -177,7 +190,7 @@ std::unique_ptr<Communicator> connected_communicator3() {
 TEST(libmuscle_communicator, create_communicator) {
     reset_mocks();
     Communicator comm(
-            Reference("kernel"), {13}, {}, mock_logger(), 0);
+            Reference("kernel"), {13}, {}, mock_logger(), mock_profiler());
     ASSERT_EQ(MockTcpTransportServer::num_constructed, 1);
     ASSERT_EQ(MockMPPClient::num_constructed, 0);
 }
@@ -185,7 +198,7 @@ TEST(libmuscle_communicator, create_communicator) {
 TEST(libmuscle_communicator, get_locations) {
     reset_mocks();
     Communicator comm(
-            Reference("kernel"), {13}, {}, mock_logger(), 0);
+            Reference("kernel"), {13}, {}, mock_logger(), mock_profiler());
     ASSERT_EQ(comm.get_locations().size(), 1);
     ASSERT_EQ(comm.get_locations()[0], "tcp:test_location");
 }
@@ -193,7 +206,7 @@ TEST(libmuscle_communicator, get_locations) {
 TEST(libmuscle_communicator, test_connect) {
     reset_mocks();
     Communicator comm(
-            Reference("kernel"), {13}, {}, mock_logger(), 0);
+            Reference("kernel"), {13}, {}, mock_logger(), mock_profiler());
 
     std::vector<Conduit> conduits({
         Conduit("kernel.out", "other.in"),
@@ -229,7 +242,7 @@ TEST(libmuscle_communicator, test_connect_vector_ports) {
             });
 
     Communicator comm(
-            Reference("kernel"), {13}, desc, mock_logger(), 0);
+            Reference("kernel"), {13}, desc, mock_logger(), mock_profiler());
 
     std::vector<Conduit> conduits({
         Conduit("other1.out", "kernel.in"),
@@ -291,7 +304,7 @@ TEST(libmuscle_communicator, test_connect_multidimensional_ports) {
             });
 
     Communicator comm(
-            Reference("kernel"), {13}, desc, mock_logger(), 0);
+            Reference("kernel"), {13}, desc, mock_logger(), mock_profiler());
 
     std::vector<Conduit> conduits({
         Conduit("other.out", "kernel.in")
@@ -322,7 +335,7 @@ TEST(libmuscle_communicator, test_connect_inferred_ports) {
     reset_mocks();
 
     Communicator comm(
-            Reference("kernel"), {13}, {}, mock_logger(), 0);
+            Reference("kernel"), {13}, {}, mock_logger(), mock_profiler());
 
     std::vector<Conduit> conduits({
         Conduit("other1.out", "kernel.in"),
@@ -384,12 +397,52 @@ TEST(libmuscle_communicator, send_message) {
     comm->send_message("out", message);
 
     ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->sender, "kernel[13].out");
-    ASSERT_EQ(MockPostOffice::last_message->receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->timestamp, 0.0);
-    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp.is_set());
-    ASSERT_EQ(MockPostOffice::last_message->data.as<std::string>(), "test");
-    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay.is_a<Settings>());
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp().is_set());
+    ASSERT_EQ(MockPostOffice::last_message->data().as<std::string>(), "test");
+    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay().is_a<Settings>());
+}
+
+TEST(libmuscle_communicator, send_message_async) {
+    reset_mocks();
+    auto comm = connected_communicator();
+
+    Message message(0.0, "test", Settings());
+    auto done = comm->send_message_async("out", message);
+    done.get();
+
+    ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_EQ(MockPostOffice::last_message->data().as<std::string>(), "test");
+}
+
+TEST(libmuscle_communicator, send_receive_message_by_handle) {
+    reset_mocks();
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
+
+    auto comm = connected_communicator();
+
+    PortHandle out_handle = comm->get_port_handle("out");
+    ASSERT_EQ(out_handle.name(), "out");
+
+    Message message(0.0, "test", Settings());
+    comm->send_message(out_handle, message);
+
+    ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_EQ(MockPostOffice::last_message->data().as<std::string>(), "test");
+
+    PortHandle in_handle = comm->get_port_handle("in");
+    Message msg = comm->receive_message(in_handle);
+
+    ASSERT_EQ(MockMPPClient::last_receiver, "kernel[13].in");
+    ASSERT_TRUE(msg.data().is_a_dict());
+    ASSERT_EQ(msg.data()["test1"].as<int>(), 12);
 }
 
 TEST(libmuscle_communicator, send_on_disconnected_port) {
@@ -419,12 +472,12 @@ TEST(libmuscle_communicator, send_msgpack) {
     comm->send_message("out", message);
 
     ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->sender, "kernel[13].out");
-    ASSERT_EQ(MockPostOffice::last_message->receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->timestamp, 0.0);
-    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp.is_set());
-    ASSERT_EQ(MockPostOffice::last_message->data["test"].as<int>(), 17);
-    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay.is_a<Settings>());
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp().is_set());
+    ASSERT_EQ(MockPostOffice::last_message->data()["test"].as<int>(), 17);
+    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay().is_a<Settings>());
 }
 
 TEST(libmuscle_communicator, send_message_with_slot) {
@@ -435,12 +488,12 @@ TEST(libmuscle_communicator, send_message_with_slot) {
     comm->send_message("out", message, 13);
 
     ASSERT_EQ(MockPostOffice::last_receiver, "kernel[13].in");
-    ASSERT_EQ(MockPostOffice::last_message->sender, "other.out[13]");
-    ASSERT_EQ(MockPostOffice::last_message->receiver, "kernel[13].in");
-    ASSERT_EQ(MockPostOffice::last_message->timestamp, 0.0);
-    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp.is_set());
-    ASSERT_EQ(MockPostOffice::last_message->data.as<std::string>(), "test");
-    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay.is_a<Settings>());
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "other.out[13]");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "kernel[13].in");
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp().is_set());
+    ASSERT_EQ(MockPostOffice::last_message->data().as<std::string>(), "test");
+    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay().is_a<Settings>());
 }
 
 TEST(libmuscle_communicator, send_message_resizable) {
@@ -454,13 +507,13 @@ TEST(libmuscle_communicator, send_message_resizable) {
     comm->send_message("out", message, 13);
 
     ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->sender, "kernel.out[13]");
-    ASSERT_EQ(MockPostOffice::last_message->receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->port_length.get(), 20);
-    ASSERT_EQ(MockPostOffice::last_message->timestamp, 0.0);
-    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp.is_set());
-    ASSERT_EQ(MockPostOffice::last_message->data.as<std::string>(), "test");
-    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay.is_a<Settings>());
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel.out[13]");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->port_length().get(), 20);
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp().is_set());
+    ASSERT_EQ(MockPostOffice::last_message->data().as<std::string>(), "test");
+    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay().is_a<Settings>());
 }
 
 TEST(libmuscle_communicator, send_with_settings) {
@@ -473,13 +526,13 @@ TEST(libmuscle_communicator, send_with_settings) {
     comm->send_message("out", message);
 
     ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->sender, "kernel[13].out");
-    ASSERT_EQ(MockPostOffice::last_message->receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->timestamp, 0.0);
-    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp.is_set());
-    ASSERT_EQ(MockPostOffice::last_message->data.as<std::string>(), "test");
-    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay.is_a<Settings>());
-    ASSERT_EQ(MockPostOffice::last_message->settings_overlay.as<Settings>()["test2"], "testing");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp().is_set());
+    ASSERT_EQ(MockPostOffice::last_message->data().as<std::string>(), "test");
+    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay().is_a<Settings>());
+    ASSERT_EQ(MockPostOffice::last_message->settings_overlay().as<Settings>()["test2"], "testing");
 }
 
 TEST(libmuscle_communicator, send_settings) {
@@ -492,13 +545,13 @@ TEST(libmuscle_communicator, send_settings) {
     comm->send_message("out", message);
 
     ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->sender, "kernel[13].out");
-    ASSERT_EQ(MockPostOffice::last_message->receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->timestamp, 0.0);
-    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp.is_set());
-    ASSERT_TRUE(MockPostOffice::last_message->data.is_a<Settings>());
-    ASSERT_EQ(MockPostOffice::last_message->data.as<Settings>()["test1"], "testing");
-    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay.is_a<Settings>());
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->timestamp(), 0.0);
+    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp().is_set());
+    ASSERT_TRUE(MockPostOffice::last_message->data().is_a<Settings>());
+    ASSERT_EQ(MockPostOffice::last_message->data().as<Settings>()["test1"], "testing");
+    ASSERT_TRUE(MockPostOffice::last_message->settings_overlay().is_a<Settings>());
 }
 
 TEST(libmuscle_communicator, close_port) {
@@ -508,19 +561,41 @@ TEST(libmuscle_communicator, close_port) {
     comm->close_port("out");
 
     ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
-    ASSERT_EQ(MockPostOffice::last_message->sender, "kernel[13].out");
-    ASSERT_EQ(MockPostOffice::last_message->receiver, "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
     ASSERT_EQ(
-            MockPostOffice::last_message->timestamp,
+            MockPostOffice::last_message->timestamp(),
             std::numeric_limits<double>::infinity());
-    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp.is_set());
-    ASSERT_TRUE(libmuscle::impl::is_close_port(MockPostOffice::last_message->data));
+    ASSERT_FALSE(MockPostOffice::last_message->next_timestamp().is_set());
+    ASSERT_TRUE(libmuscle::impl::is_close_port(MockPostOffice::last_message->data()));
+}
+
+TEST(libmuscle_communicator, close_vector_port) {
+    reset_mocks();
+    auto comm = connected_communicator3();
+    comm->get_port("out").set_length(3);
+
+    for (int slot = 0; slot < 3; ++slot)
+        MockPeerManager::get_peer_endpoint_table.emplace(
+                "out[" + std::to_string(slot) + "]",
+                std::vector<Endpoint>({Endpoint("other", {}, "in", {slot})}));
+
+    comm->close_vector_port("out");
+
+    // the closes go out as one batch, in slot order
+    ASSERT_EQ(MockPostOffice::last_receiver, "other.in[2]");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel.out[2]");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[2]");
+    ASSERT_EQ(
+            MockPostOffice::last_message->timestamp(),
+            std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(libmuscle::impl::is_close_port(MockPostOffice::last_message->data()));
 }
 
 TEST(libmuscle_communicator, receive_message) {
     reset_mocks();
-    MockMPPClient::next_receive_message.sender = "other.out[13]";
-    MockMPPClient::next_receive_message.receiver = "kernel[13].in";
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
 
     auto comm = connected_communicator();
     Message msg = comm->receive_message("in");
@@ -530,6 +605,127 @@ TEST(libmuscle_communicator, receive_message) {
     ASSERT_EQ(msg.data()["test1"].as<int>(), 12);
 }
 
+TEST(libmuscle_communicator, forward_message) {
+    reset_mocks();
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
+
+    auto comm = connected_communicator();
+    double timestamp = comm->forward_message("in", "out");
+
+    ASSERT_EQ(MockMPPClient::last_receiver, "kernel[13].in");
+    ASSERT_EQ(timestamp, 0.0);
+    // the message went out with a rewritten header and the payload and
+    // overlay it came in with
+    ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->message_number(), 0);
+    ASSERT_EQ(MockPostOffice::last_message->data()["test1"].as<int>(), 12);
+}
+
+TEST(libmuscle_communicator, forward_batch) {
+    reset_mocks();
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
+
+    auto comm = connected_communicator();
+    auto timestamps = comm->forward_batch("in", "out", 10);
+
+    ASSERT_EQ(MockMPPClient::last_receiver, "kernel[13].in");
+    ASSERT_EQ(timestamps.size(), 1u);
+    ASSERT_EQ(timestamps.at(0), 0.0);
+    // the message went out with a rewritten header and the payload and
+    // overlay it came in with
+    ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel[13].out");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->message_number(), 0);
+    ASSERT_EQ(MockPostOffice::last_message->data()["test1"].as<int>(), 12);
+    // and the next message was requested
+    ASSERT_EQ(MockMPPClient::num_outstanding, 1);
+}
+
+TEST(libmuscle_communicator, receive_message_with_timeout) {
+    reset_mocks();
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
+
+    auto comm = connected_communicator();
+    Message msg = comm->receive_message("in", {}, {}, 10.0);
+
+    // the timeout was in effect while receiving, and was cleared again
+    // afterwards, since the connection may be shared with other ports
+    ASSERT_TRUE(MockMPPClient::last_receive_timeout.is_set());
+    ASSERT_EQ(MockMPPClient::last_receive_timeout.get(), 10.0);
+    ASSERT_FALSE(MockMPPClient::receive_timeout.is_set());
+    ASSERT_EQ(msg.data()["test1"].as<int>(), 12);
+}
+
+TEST(libmuscle_communicator, receive_message_prefetched) {
+    reset_mocks();
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
+
+    auto comm = connected_communicator();
+    comm->receive_message("in");
+
+    // the next message should have been requested already
+    ASSERT_EQ(MockMPPClient::num_outstanding, 1);
+
+    MockMPPClient::next_receive_message.set_message_number(1);
+    Message msg = comm->receive_message("in");
+
+    // which gets picked up here, and the one after that requested
+    ASSERT_EQ(MockMPPClient::num_outstanding, 1);
+    ASSERT_TRUE(msg.data().is_a_dict());
+    ASSERT_EQ(msg.data()["test1"].as<int>(), 12);
+}
+
+TEST(libmuscle_communicator, wait_any) {
+    reset_mocks();
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
+
+    auto comm = connected_communicator();
+    std::string port_name = comm->wait_any({"in"});
+
+    ASSERT_EQ(port_name, "in");
+    // the message was read and parked, so the receive below picks it
+    // up without a request of its own
+    ASSERT_EQ(MockMPPClient::num_outstanding, 0);
+
+    Message msg = comm->receive_message("in");
+
+    ASSERT_TRUE(msg.data().is_a_dict());
+    ASSERT_EQ(msg.data()["test1"].as<int>(), 12);
+    // and the prefetch for the next message went out as usual
+    ASSERT_EQ(MockMPPClient::num_outstanding, 1);
+}
+
+TEST(libmuscle_communicator, receive_all) {
+    reset_mocks();
+    MockMPPClient::next_receive_message.set_sender("kernel[13].out");
+    MockMPPClient::next_receive_message.set_receiver("other.in[13]");
+
+    auto comm = connected_communicator2();
+    for (int slot = 0; slot < 20; ++slot) {
+        Reference port_slot("in");
+        port_slot += slot;
+        MockPeerManager::get_peer_endpoint_table.emplace(port_slot,
+                std::vector<Endpoint>({Endpoint("kernel", {slot}, "out", {})}));
+    }
+
+    auto msgs = comm->receive_all("in");
+
+    ASSERT_EQ(msgs.size(), 20u);
+    ASSERT_TRUE(msgs.at(7).data().is_a_dict());
+    ASSERT_EQ(msgs.at(7).data()["test1"].as<int>(), 12);
+    // each slot's receive picked up a prefetched message and started
+    // the next prefetch
+    ASSERT_EQ(MockMPPClient::num_outstanding, 20);
+}
+
 TEST(libmuscle_communicator, receive_message_default) {
     reset_mocks();
     MockPeerManager::is_connected_return_value = false;
@@ -561,8 +757,8 @@ TEST(libmuscle_communicator, receive_on_invalid_port) {
 
 TEST(libmuscle_communicator, receive_message_with_slot) {
     reset_mocks();
-    MockMPPClient::next_receive_message.sender = "kernel[13].out";
-    MockMPPClient::next_receive_message.receiver = "other.in[13]";
+    MockMPPClient::next_receive_message.set_sender("kernel[13].out");
+    MockMPPClient::next_receive_message.set_receiver("other.in[13]");
 
     auto comm = connected_communicator2();
     Message msg = comm->receive_message("in", 13);
@@ -574,9 +770,9 @@ TEST(libmuscle_communicator, receive_message_with_slot) {
 
 TEST(libmuscle_communicator, receive_message_resizable) {
     reset_mocks();
-    MockMPPClient::next_receive_message.sender = "other.out[13]";
-    MockMPPClient::next_receive_message.receiver = "kernel.in[13]";
-    MockMPPClient::next_receive_message.port_length = 20;
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel.in[13]");
+    MockMPPClient::next_receive_message.set_port_length(20);
 
     auto comm = connected_communicator3();
     Message msg = comm->receive_message("in", 13);
@@ -589,8 +785,8 @@ TEST(libmuscle_communicator, receive_message_resizable) {
 
 TEST(libmuscle_communicator, receive_with_settings) {
     reset_mocks();
-    MockMPPClient::next_receive_message.sender = "other.out[13]";
-    MockMPPClient::next_receive_message.receiver = "kernel[13].in";
+    MockMPPClient::next_receive_message.set_sender("other.out[13]");
+    MockMPPClient::next_receive_message.set_receiver("kernel[13].in");
 
     auto comm = connected_communicator();
     Message msg = comm->receive_message("in");
@@ -603,8 +799,8 @@ TEST(libmuscle_communicator, receive_with_settings) {
 
 TEST(libmuscle_communicator, receive_message_with_slot_and_settings) {
     reset_mocks();
-    MockMPPClient::next_receive_message.sender = "kernel[13].out";
-    MockMPPClient::next_receive_message.receiver = "other.in[13]";
+    MockMPPClient::next_receive_message.set_sender("kernel[13].out");
+    MockMPPClient::next_receive_message.set_receiver("other.in[13]");
 
     auto comm = connected_communicator2();
     Message msg = comm->receive_message("in", 13);
@@ -615,3 +811,39 @@ TEST(libmuscle_communicator, receive_message_with_slot_and_settings) {
     ASSERT_EQ(msg.settings().at("test2"), 3.1);
 }
 
+
+TEST(libmuscle_communicator, ports_description_from_table) {
+    constexpr libmuscle::impl::PortDecl decls[] = {
+            {Operator::F_INIT, "in", false},
+            {Operator::O_F, "out", true}};
+
+    PortsDescription ports = libmuscle::impl::ports_description(decls);
+
+    ASSERT_EQ(ports.at(Operator::F_INIT),
+            std::vector<std::string>({"in"}));
+    ASSERT_EQ(ports.at(Operator::O_F),
+            std::vector<std::string>({"out[]"}));
+}
+
+TEST(libmuscle_communicator, send_range) {
+    reset_mocks();
+    auto comm = connected_communicator3();
+    comm->get_port("out").set_length(20);
+
+    for (int slot = 10; slot < 13; ++slot)
+        MockPeerManager::get_peer_endpoint_table.emplace(
+                "out[" + std::to_string(slot) + "]",
+                std::vector<Endpoint>({Endpoint("other", {}, "in", {slot})}));
+
+    comm->send_range("out", 10, 14,
+            [](int slot) {
+                return Message(0.0, std::to_string(slot), Settings());
+            });
+
+    // the range is deposited in slot order, so the last one is slot 13
+    ASSERT_EQ(MockPostOffice::last_receiver, "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->sender(), "kernel.out[13]");
+    ASSERT_EQ(MockPostOffice::last_message->receiver(), "other.in[13]");
+    ASSERT_EQ(MockPostOffice::last_message->data().as<std::string>(), "13");
+    ASSERT_EQ(MockPostOffice::last_message->message_number(), 0);
+}
@@ -0,0 +1,59 @@
+#include <libmuscle/grid_view.hpp>
+
+#include <libmuscle/data.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+
+using libmuscle::impl::Data;
+using libmuscle::impl::GridView;
+using libmuscle::impl::StorageOrder;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(libmuscle_grid_view, grid_view) {
+    std::vector<double> x({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    Data d = Data::grid(x.data(), {2, 3});
+
+    GridView<double, 2> view(d);
+
+    ASSERT_EQ(view.shape(0), 2u);
+    ASSERT_EQ(view.shape(1), 3u);
+    ASSERT_EQ(view.size(), 6u);
+    ASSERT_EQ(view.data(), d.elements<double>());
+
+    ASSERT_EQ(view(0, 0), 1.0);
+    ASSERT_EQ(view(0, 2), 3.0);
+    ASSERT_EQ(view(1, 0), 4.0);
+    ASSERT_EQ(view(1, 2), 6.0);
+}
+
+TEST(libmuscle_grid_view, grid_view_first_adjacent) {
+    std::vector<std::int32_t> x({1, 2, 3, 4, 5, 6});
+    Data d = Data::grid(
+            x.data(), {2, 3}, {"x", "y"}, StorageOrder::first_adjacent);
+
+    GridView<std::int32_t, 2> view(d);
+
+    ASSERT_EQ(view(0, 0), 1);
+    ASSERT_EQ(view(1, 0), 2);
+    ASSERT_EQ(view(0, 1), 3);
+    ASSERT_EQ(view(1, 2), 6);
+}
+
+TEST(libmuscle_grid_view, grid_view_invalid) {
+    std::vector<double> x({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    Data d = Data::grid(x.data(), {2, 3});
+
+    ASSERT_THROW((GridView<float, 2>(d)), std::runtime_error);
+    ASSERT_THROW((GridView<double, 3>(d)), std::runtime_error);
+    ASSERT_THROW((GridView<double, 2>(Data::dict())), std::runtime_error);
+}
@@ -2,24 +2,33 @@
 #define LIBMUSCLE_MOCK_COMMUNICATOR <mocks/mock_communicator.hpp>
 #define LIBMUSCLE_MOCK_LOGGER <mocks/mock_logger.hpp>
 #define LIBMUSCLE_MOCK_MMP_CLIENT <mocks/mock_mmp_client.hpp>
+#define LIBMUSCLE_MOCK_PROFILER <mocks/mock_profiler.hpp>
 
 // into the real implementation,
 #include <ymmsl/ymmsl.hpp>
 
+#include <libmuscle/checkpoint_triggers.cpp>
 #include <libmuscle/close_port.cpp>
 #include <libmuscle/data.cpp>
 #include <libmuscle/instance.cpp>
+#include <libmuscle/instrumentation.cpp>
 #include <libmuscle/logging.cpp>
 #include <libmuscle/mcp/data_pack.cpp>
 #include <libmuscle/message.cpp>
+#include <libmuscle/mpp_message.cpp>
 #include <libmuscle/port.cpp>
+#include <libmuscle/port_handle.cpp>
+#include <libmuscle/profiling.cpp>
 #include <libmuscle/settings_manager.cpp>
+#include <libmuscle/snapshot.cpp>
+#include <libmuscle/snapshot_manager.cpp>
 #include <libmuscle/timestamp.cpp>
 
 // then add mock implementations as needed.
 #include <mocks/mock_communicator.cpp>
 #include <mocks/mock_logger.cpp>
 #include <mocks/mock_mmp_client.cpp>
+#include <mocks/mock_profiler.cpp>
 
 
 // Test code dependencies
@@ -34,10 +43,12 @@
 #include <mocks/mock_communicator.hpp>
 
 using libmuscle::impl::ClosePort;
+using libmuscle::impl::Data;
 using libmuscle::impl::Instance;
 using libmuscle::impl::Message;
 using libmuscle::impl::MockCommunicator;
 using libmuscle::impl::MockMMPClient;
+using libmuscle::impl::PortHandle;
 using libmuscle::impl::PortsDescription;
 
 using ymmsl::Reference;
@@ -132,6 +143,251 @@ TEST(libmuscle_instance, send) {
     ASSERT_EQ(MockCommunicator::last_sent_message.data().as<std::string>(), "Testing");
 }
 
+TEST(libmuscle_instance, send_moved_message) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::O_F, {"out"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::O_F, {"out"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "out", Port("out", Operator::O_F, false, true, 0, {}));
+
+    Message msg(3.0, 4.0, "Testing");
+    instance.send("out", std::move(msg));
+
+    ASSERT_EQ(MockCommunicator::last_sent_port, "out");
+    ASSERT_EQ(MockCommunicator::last_sent_message.timestamp(), 3.0);
+    ASSERT_EQ(MockCommunicator::last_sent_message.data().as<std::string>(), "Testing");
+}
+
+TEST(libmuscle_instance, send_async) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::O_F, {"out"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::O_F, {"out"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "out", Port("out", Operator::O_F, false, true, 0, {}));
+
+    Message msg(3.0, 4.0, "Testing");
+    auto done = instance.send_async("out", msg);
+    done.get();
+
+    ASSERT_EQ(MockCommunicator::last_sent_port, "out");
+    ASSERT_FALSE(MockCommunicator::last_sent_slot.is_set());
+    ASSERT_EQ(MockCommunicator::last_sent_message.timestamp(), 3.0);
+    ASSERT_EQ(MockCommunicator::last_sent_message.data().as<std::string>(), "Testing");
+}
+
+TEST(libmuscle_instance, send_samples) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::O_F, {"out"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::O_F, {"out"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "out", Port("out", Operator::O_F, false, true, 0, {}));
+
+    TestInstance::settings_manager_(instance).base["muscle_stream_window"] = 3;
+
+    instance.send_sample("out", 0.1, 1.0);
+    instance.send_sample("out", 0.2, 2.0);
+    // nothing goes out until the window is full
+    ASSERT_NE(MockCommunicator::last_sent_port, "out");
+
+    instance.send_sample("out", 0.3, 3.0);
+
+    ASSERT_EQ(MockCommunicator::last_sent_port, "out");
+    ASSERT_EQ(MockCommunicator::last_sent_message.timestamp(), 0.1);
+    auto data = MockCommunicator::last_sent_message.data();
+    ASSERT_EQ(data["timestamps"].shape().at(0), 3u);
+    ASSERT_EQ(data["values"].elements<double>()[2], 3.0);
+
+    // a partial window goes out on request
+    instance.send_sample("out", 0.4, 4.0);
+    instance.flush_samples("out");
+
+    ASSERT_EQ(MockCommunicator::last_sent_message.timestamp(), 0.4);
+    ASSERT_EQ(
+            MockCommunicator::last_sent_message.data()["timestamps"].shape().at(0),
+            1u);
+}
+
+TEST(libmuscle_instance, receive_samples) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in", Port("in", Operator::S, false, true, 0, {}));
+
+    std::vector<double> timestamps({0.1, 0.2, 0.3});
+    std::vector<double> values({1.0, 2.0, 3.0});
+    Data window = Data::dict(
+            "timestamps", Data::grid(timestamps.data(), {3u}, {"sample"}),
+            "values", Data::grid(values.data(), {3u}, {"sample"}));
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(0.1, window, Settings());
+
+    auto received = instance.receive_samples("in");
+
+    ASSERT_EQ(received.timestamps, timestamps);
+    ASSERT_EQ(received.values, values);
+
+    // a non-window message on the port is an error
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(1.0, "Testing", Settings());
+    ASSERT_THROW(instance.receive_samples("in"), std::runtime_error);
+
+    // make sure Instance shuts down cleanly
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(0.0, ClosePort(), Settings());
+}
+
+TEST(libmuscle_instance, receive_into_target) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in", Port("in", Operator::S, false, true, 0, {}));
+
+    std::vector<double> field({1.0, 2.0, 3.0, 4.0});
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(
+                1.0, Data::grid(field.data(), {2u, 2u}), Settings());
+
+    std::vector<double> target(4u, 0.0);
+    instance.register_receive_target(
+            "in", target.data(), target.size() * sizeof(double));
+
+    Message msg(instance.receive("in"));
+
+    ASSERT_EQ(msg.timestamp(), 1.0);
+    ASSERT_EQ(target, field);
+
+    // a payload of the wrong size is rejected
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(
+                2.0, Data::grid(field.data(), {2u}), Settings());
+    ASSERT_THROW(instance.receive("in"), std::runtime_error);
+}
+
+TEST(libmuscle_instance, receive_into_callback) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in", Port("in", Operator::S, false, true, 0, {}));
+
+    std::vector<double> field({1.0, 2.0, 3.0, 4.0});
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(
+                1.0, Data::grid(field.data(), {2u, 2u}), Settings());
+
+    // convert to single precision while the payload is still hot
+    std::vector<float> target;
+    instance.register_receive_callback(
+            "in", [&target](char const * data, std::size_t num_bytes) {
+                auto elems = reinterpret_cast<double const *>(data);
+                target.assign(elems, elems + num_bytes / sizeof(double));
+            });
+
+    Message msg(instance.receive("in"));
+
+    ASSERT_EQ(msg.timestamp(), 1.0);
+    ASSERT_EQ(target, std::vector<float>({1.0f, 2.0f, 3.0f, 4.0f}));
+
+    // re-registering with a buffer replaces the callback
+    std::vector<double> buffer(4u, 0.0);
+    instance.register_receive_target(
+            "in", buffer.data(), buffer.size() * sizeof(double));
+    target.clear();
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(
+                2.0, Data::grid(field.data(), {2u, 2u}), Settings());
+    instance.receive("in");
+
+    ASSERT_EQ(buffer, field);
+    ASSERT_TRUE(target.empty());
+}
+
+TEST(libmuscle_instance, send_receive_by_handle) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in"}},
+                {Operator::O_I, {"out"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in"}},
+                {Operator::O_I, {"out"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in", Port("in", Operator::S, false, true, 0, {}));
+    MockCommunicator::get_port_return_value.emplace(
+            "out", Port("out", Operator::O_I, false, true, 0, {}));
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(1.0, 2.0, "Testing receive", Settings());
+
+    PortHandle out_port(instance.port("out"));
+    ASSERT_EQ(out_port.name(), "out");
+
+    Message msg(3.0, 4.0, "Testing");
+    instance.send(out_port, msg);
+
+    ASSERT_EQ(MockCommunicator::last_sent_port, "out");
+    ASSERT_FALSE(MockCommunicator::last_sent_slot.is_set());
+    ASSERT_EQ(MockCommunicator::last_sent_message.timestamp(), 3.0);
+    ASSERT_EQ(MockCommunicator::last_sent_message.data().as<std::string>(), "Testing");
+
+    PortHandle in_port(instance.port("in"));
+    Message received(instance.receive(in_port));
+
+    ASSERT_EQ(received.timestamp(), 1.0);
+    ASSERT_EQ(received.data().as<std::string>(), "Testing receive");
+
+    // make sure Instance shuts down cleanly
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(0.0, ClosePort(), Settings());
+}
+
 TEST(libmuscle_instance, send_invalid_port) {
     reset_mocks();
     auto argv = test_argv();
@@ -208,6 +464,134 @@ TEST(libmuscle_instance, receive) {
         std::make_unique<Message>(0.0, ClosePort(), Settings());
 }
 
+TEST(libmuscle_instance, receive_with_timeout) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in", Port("in", Operator::S, false, true, 0, {}));
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(1.0, 2.0, "Testing receive", Settings());
+
+    Message msg(instance.receive_with_timeout("in", 30.0));
+
+    ASSERT_TRUE(MockCommunicator::last_receive_timeout.is_set());
+    ASSERT_EQ(MockCommunicator::last_receive_timeout.get(), 30.0);
+    ASSERT_EQ(msg.timestamp(), 1.0);
+    ASSERT_EQ(msg.data().as<std::string>(), "Testing receive");
+
+    // make sure Instance shuts down cleanly
+    MockCommunicator::next_received_message["in"] =
+        std::make_unique<Message>(0.0, ClosePort(), Settings());
+}
+
+TEST(libmuscle_instance, receive_all) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in[]"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in", Port("in", Operator::S, true, true, 0, {10}));
+    for (int i = 0; i < 10; ++i) {
+        Reference port_slot("in");
+        port_slot += i;
+        std::ostringstream oss;
+        oss << "test " << i;
+        MockCommunicator::next_received_message[port_slot] =
+            std::make_unique<Message>(0.0, oss.str(), Settings());
+    }
+
+    auto msgs = instance.receive_all("in");
+
+    ASSERT_EQ(msgs.size(), 10u);
+    ASSERT_TRUE(msgs.at(5).data().is_a<std::string>());
+    ASSERT_EQ(msgs.at(5).data().as<std::string>(), "test 5");
+
+    // make sure Instance shuts down cleanly
+    for (int i = 0; i < 10; ++i) {
+        Reference port_slot("in");
+        port_slot += i;
+        MockCommunicator::next_received_message[port_slot] =
+            std::make_unique<Message>(0.0, ClosePort(), Settings());
+    }
+}
+
+TEST(libmuscle_instance, wait_any) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in1", "in2"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in1", "in2"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in1", Port("in1", Operator::S, false, true, 0, {}));
+    MockCommunicator::get_port_return_value.emplace(
+            "in2", Port("in2", Operator::S, false, true, 0, {}));
+    MockCommunicator::next_received_message["in2"] =
+        std::make_unique<Message>(1.0, 2.0, "Testing wait_any", Settings());
+
+    std::string port_name(instance.wait_any({"in1", "in2"}));
+
+    ASSERT_EQ(port_name, "in2");
+    ASSERT_EQ(MockCommunicator::last_waited_ports.size(), 2u);
+    ASSERT_EQ(MockCommunicator::last_waited_ports.at(0), "in1");
+
+    Message msg(instance.receive(port_name));
+    ASSERT_EQ(msg.timestamp(), 1.0);
+    ASSERT_EQ(msg.data().as<std::string>(), "Testing wait_any");
+
+    // make sure Instance shuts down cleanly
+    MockCommunicator::next_received_message["in1"] =
+        std::make_unique<Message>(0.0, ClosePort(), Settings());
+    MockCommunicator::next_received_message["in2"] =
+        std::make_unique<Message>(0.0, ClosePort(), Settings());
+}
+
+TEST(libmuscle_instance, wait_any_invalid_port) {
+    reset_mocks();
+    auto argv = test_argv();
+    Instance instance(argv.size(), argv.data(),
+            PortsDescription({
+                {Operator::S, {"in"}},
+                {Operator::F_INIT, {"init_in"}}
+                }));
+
+    MockCommunicator::list_ports_return_value = PortsDescription({
+                {Operator::S, {"in"}},
+                {Operator::F_INIT, {"init_in"}}
+                });
+    MockCommunicator::get_port_return_value.emplace(
+            "in", Port("in", Operator::S, true, true, 0, {10}));
+    MockCommunicator::get_port_return_value.emplace(
+            "init_in", Port("init_in", Operator::F_INIT, false, true, 0, {}));
+    MockCommunicator::get_port_return_value.emplace(
+            "not_connected", Port(
+                "not_connected", Operator::S, false, false, 0, {}));
+
+    // vector ports and F_INIT ports cannot be waited on
+    ASSERT_THROW(instance.wait_any({"in"}), std::logic_error);
+    ASSERT_THROW(instance.wait_any({"init_in"}), std::logic_error);
+    // and a message will never arrive on a disconnected port
+    ASSERT_THROW(instance.wait_any({"not_connected"}), std::runtime_error);
+}
+
 TEST(libmuscle_instance, receive_f_init) {
     reset_mocks();
     auto argv = test_argv();
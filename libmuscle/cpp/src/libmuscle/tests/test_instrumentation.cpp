@@ -0,0 +1,121 @@
+#include "libmuscle/instrumentation.hpp"
+
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+
+using namespace libmuscle::impl::instrumentation;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(libmuscle_instrumentation, count) {
+    auto before = counters().messages_sent.load();
+    count(counters().messages_sent);
+    count(counters().messages_sent, 10u);
+    ASSERT_EQ(counters().messages_sent.load(), before + 11u);
+}
+
+TEST(libmuscle_instrumentation, record_high_water) {
+    record_high_water(counters().outbox_depth_high_water, 10u);
+    ASSERT_EQ(counters().outbox_depth_high_water.load(), 10u);
+
+    record_high_water(counters().outbox_depth_high_water, 3u);
+    ASSERT_EQ(counters().outbox_depth_high_water.load(), 10u);
+
+    record_high_water(counters().outbox_depth_high_water, 12u);
+    ASSERT_EQ(counters().outbox_depth_high_water.load(), 12u);
+}
+
+TEST(libmuscle_instrumentation, port_counters) {
+    auto & port = port_counters("test_port");
+    count(port.messages_sent);
+    count(port.messages_received, 2u);
+
+    auto & port_again = port_counters("test_port");
+    ASSERT_EQ(&port_again, &port);
+    ASSERT_EQ(port_again.messages_sent.load(), 1u);
+    ASSERT_EQ(port_again.messages_received.load(), 2u);
+
+    auto & other_port = port_counters("other_port");
+    ASSERT_NE(&other_port, &port);
+    ASSERT_EQ(other_port.messages_sent.load(), 0u);
+}
+
+TEST(libmuscle_instrumentation, timed_lock_guard) {
+    std::mutex mutex;
+    {
+        TimedLockGuard lock(mutex);
+        ASSERT_FALSE(mutex.try_lock());
+    }
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+TEST(libmuscle_instrumentation, write_report) {
+    count(counters().bytes_sent, 12345u);
+    port_counters("report_port");
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    write_report(fds[1]);
+    close(fds[1]);
+
+    std::string report;
+    char buf[1024];
+    ssize_t num_read;
+    while ((num_read = read(fds[0], buf, sizeof(buf))) > 0)
+        report.append(buf, num_read);
+    close(fds[0]);
+
+    ASSERT_NE(report.find("bytes_sent: 12345"), std::string::npos);
+    ASSERT_NE(report.find("port report_port sent: 0"), std::string::npos);
+    ASSERT_NE(report.find("outbox_depth_high_water"), std::string::npos);
+}
+
+TEST(libmuscle_instrumentation, uncount) {
+    count(counters().mapped_buffer_bytes, 1000u);
+    uncount(counters().mapped_buffer_bytes, 400u);
+    std::uint64_t live = counters().mapped_buffer_bytes.load();
+    ASSERT_GE(live, 600u);
+    uncount(counters().mapped_buffer_bytes, 600u);
+}
+
+TEST(libmuscle_instrumentation, memory_report) {
+    count(counters().outbox_bytes, 54321u);
+    port_counters("memory_port");
+
+    std::string report = memory_report();
+
+    ASSERT_NE(report.find("VmRSS:"), std::string::npos);
+    ASSERT_NE(report.find("mapped_buffer_bytes: "), std::string::npos);
+    ASSERT_NE(report.find("zone_bytes"), std::string::npos);
+    ASSERT_NE(report.find("outbox_bytes: 54321"), std::string::npos);
+    ASSERT_NE(report.find("port memory_port bytes_sent: 0"), std::string::npos);
+
+    uncount(counters().outbox_bytes, 54321u);
+}
+
+TEST(libmuscle_instrumentation, wait_histogram) {
+    PortCounters & ctrs = port_counters("wait_port");
+
+    ASSERT_EQ(wait_percentile(ctrs, 50), 0u);
+
+    // 90 quick hand-offs and 10 stalls of about a second
+    for (int i = 0; i < 90; ++i)
+        record_wait(ctrs, 1500u);
+    for (int i = 0; i < 10; ++i)
+        record_wait(ctrs, 1200000000u);
+
+    // estimates are bucket upper bounds, so powers of two
+    ASSERT_EQ(wait_percentile(ctrs, 50), 2048u);
+    ASSERT_EQ(wait_percentile(ctrs, 90), 2048u);
+    ASSERT_EQ(wait_percentile(ctrs, 99), 2147483648u);
+    ASSERT_EQ(ctrs.wait_ns.load(), 90u * 1500u + 10u * 1200000000u);
+}
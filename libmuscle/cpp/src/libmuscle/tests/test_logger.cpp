@@ -16,6 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
 
 using libmuscle::impl::Logger;
 using libmuscle::impl::LogLevel;
@@ -41,6 +46,7 @@ TEST(libmuscle_logging, test_logger) {
     Logger logger("test_instance[10]", "", manager);
 
     logger.log(LogLevel::CRITICAL, "Testing: ", 10, " == ", 10.0);
+    logger.flush();
 
     auto const & msg = MockMMPClient::last_submitted_log_message;
     ASSERT_EQ(msg.instance_id, "test_instance[10]");
@@ -56,34 +62,120 @@ TEST(libmuscle_logging, test_set_level) {
 
     // default is WARNING
     logger.log(LogLevel::WARNING, "WARNING");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "WARNING");
 
     logger.log(LogLevel::INFO, "INFO");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "WARNING");
 
     logger.log(LogLevel::WARNING, "WARNING2");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "WARNING2");
 
     logger.log(LogLevel::DEBUG, "DEBUG");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "WARNING2");
 
     logger.log(LogLevel::CRITICAL, "CRITICAL");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "CRITICAL");
 
     logger.set_remote_level(LogLevel::DEBUG);
 
     logger.log(LogLevel::DEBUG, "DEBUG");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "DEBUG");
 
     logger.log(LogLevel::CRITICAL, "CRITICAL");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "CRITICAL");
 
     logger.set_remote_level(LogLevel::CRITICAL);
 
     logger.log(LogLevel::ERROR, "ERROR");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "CRITICAL");
 
     logger.log(LogLevel::CRITICAL, "CRITICAL2");
+    logger.flush();
     ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "CRITICAL2");
 }
 
+
+TEST(libmuscle_logging, test_batched_submission) {
+    reset_mocks();
+    MockMMPClient manager("");
+    Logger logger("test_instance", "", manager);
+
+    // messages logged in quick succession get batched, but all arrive
+    // and in order
+    for (int i = 0; i < 100; ++i)
+        logger.log(LogLevel::WARNING, "message ", i);
+    logger.flush();
+
+    ASSERT_EQ(MockMMPClient::last_submitted_log_message.text, "message 99");
+}
+
+TEST(libmuscle_logging, test_rate_limit) {
+    reset_mocks();
+    MockMMPClient manager("");
+
+    std::string log_file = "/tmp/muscle3_test_rate_limit.log";
+    std::remove(log_file.c_str());
+
+    setenv("MUSCLE_LOG_RATE_LIMIT", "5", 1);
+    {
+        Logger logger("test_instance", log_file, manager);
+        // a burst well over the limit; the first few go through on
+        // the initial token budget, the rest stay local
+        for (int i = 0; i < 50; ++i)
+            logger.log(LogLevel::WARNING, "message ", i);
+        logger.flush();
+    }
+    unsetenv("MUSCLE_LOG_RATE_LIMIT");
+
+    ASSERT_GE(MockMMPClient::num_submitted_log_messages, 1);
+    ASSERT_LT(MockMMPClient::num_submitted_log_messages, 50);
+
+    // the held-back messages did make it to the local log
+    std::ifstream in(log_file);
+    std::stringstream local_log;
+    local_log << in.rdbuf();
+    ASSERT_NE(local_log.str().find("message 49"), std::string::npos);
+
+    std::remove(log_file.c_str());
+}
+
+TEST(libmuscle_logging, test_binary_local_log) {
+    reset_mocks();
+    MockMMPClient manager("");
+
+    std::string log_file = "/tmp/muscle3_test_binary.log";
+    std::remove(log_file.c_str());
+
+    setenv("MUSCLE_LOG_BINARY", "1", 1);
+    {
+        Logger logger("test_instance", log_file, manager);
+        logger.log(LogLevel::WARNING, "Testing: ", 42);
+        logger.log(LogLevel::ERROR, "And another");
+        logger.flush();
+    }
+    unsetenv("MUSCLE_LOG_BINARY");
+
+    std::ifstream in(log_file, std::ios_base::binary);
+    std::ostringstream out;
+    Logger::convert_binary_log(in, out);
+
+    std::string text = out.str();
+    ASSERT_NE(text.find("test_instance"), std::string::npos);
+    ASSERT_NE(text.find("WARNING: Testing: 42"), std::string::npos);
+    ASSERT_NE(text.find("ERROR: And another"), std::string::npos);
+
+    // a text log is recognised as not being a binary one
+    std::istringstream not_binary("test_instance 2026 WARNING: hello");
+    ASSERT_THROW(
+            Logger::convert_binary_log(not_binary, out), std::runtime_error);
+
+    std::remove(log_file.c_str());
+}
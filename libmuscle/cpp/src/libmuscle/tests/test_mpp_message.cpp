@@ -3,15 +3,19 @@
 
 #include <libmuscle/mpp_message.hpp>
 
+#include <libmuscle/close_port.hpp>
 #include <libmuscle/data.hpp>
 #include <libmuscle/mcp/data_pack.hpp>
 #include <libmuscle/util.hpp>
 #include <ymmsl/ymmsl.hpp>
 
+#include <stdexcept>
 #include <utility>
 
 
+using libmuscle::impl::Codec;
 using libmuscle::impl::Data;
+using libmuscle::impl::Delta;
 using libmuscle::impl::MPPMessage;
 using ymmsl::Reference;
 
@@ -32,15 +36,15 @@ TEST(test_mcp_message, create_mcp_message) {
             test, 0, 1.0, abc
             );
 
-    ASSERT_EQ(m.sender, "sender.port");
-    ASSERT_EQ(m.receiver, "receiver.port");
-    ASSERT_EQ(m.port_length, 10);
-    ASSERT_EQ(m.timestamp, 100.1);
-    ASSERT_EQ(m.next_timestamp, 101.0);
-    ASSERT_EQ(m.settings_overlay.as<std::string>(), "test");
-    ASSERT_EQ(m.message_number, 0);
-    ASSERT_EQ(m.saved_until, 1.0);
-    ASSERT_EQ(m.data.as<std::string>(), "abc");
+    ASSERT_EQ(m.sender(), "sender.port");
+    ASSERT_EQ(m.receiver(), "receiver.port");
+    ASSERT_EQ(m.port_length(), 10);
+    ASSERT_EQ(m.timestamp(), 100.1);
+    ASSERT_EQ(m.next_timestamp(), 101.0);
+    ASSERT_EQ(m.settings_overlay().as<std::string>(), "test");
+    ASSERT_EQ(m.message_number(), 0);
+    ASSERT_EQ(m.saved_until(), 1.0);
+    ASSERT_EQ(m.data().as<std::string>(), "abc");
 }
 
 TEST(test_mcp_message, create_mcp_message_minimal) {
@@ -53,15 +57,15 @@ TEST(test_mcp_message, create_mcp_message_minimal) {
             test, 0, 2.0, abc
             );
 
-    ASSERT_EQ(m.sender, "sender.port");
-    ASSERT_EQ(m.receiver, "receiver.port");
-    ASSERT_FALSE(m.port_length.is_set());
-    ASSERT_EQ(m.timestamp, 100.1);
-    ASSERT_FALSE(m.next_timestamp.is_set());
-    ASSERT_TRUE(m.settings_overlay.is_nil());
-    ASSERT_EQ(m.message_number, 0);
-    ASSERT_EQ(m.saved_until, 2.0);
-    ASSERT_TRUE(m.data.is_nil());
+    ASSERT_EQ(m.sender(), "sender.port");
+    ASSERT_EQ(m.receiver(), "receiver.port");
+    ASSERT_FALSE(m.port_length().is_set());
+    ASSERT_EQ(m.timestamp(), 100.1);
+    ASSERT_FALSE(m.next_timestamp().is_set());
+    ASSERT_TRUE(m.settings_overlay().is_nil());
+    ASSERT_EQ(m.message_number(), 0);
+    ASSERT_EQ(m.saved_until(), 2.0);
+    ASSERT_TRUE(m.data().is_nil());
 }
 
 TEST(test_mcp_message, from_bytes) {
@@ -84,14 +88,192 @@ TEST(test_mcp_message, from_bytes) {
 
     auto m = MPPMessage::from_bytes(msg_bytes);
 
-    ASSERT_EQ(m.sender, "sender.port");
-    ASSERT_EQ(m.receiver, "receiver.port");
-    ASSERT_FALSE(m.port_length.is_set());
-    ASSERT_EQ(m.timestamp, 100.1);
-    ASSERT_FALSE(m.next_timestamp.is_set());
-    ASSERT_TRUE(m.settings_overlay.is_nil());
-    ASSERT_EQ(m.message_number, 0);
-    ASSERT_EQ(m.saved_until, 3.0);
-    ASSERT_TRUE(m.data.is_nil());
+    ASSERT_EQ(m.sender(), "sender.port");
+    ASSERT_EQ(m.receiver(), "receiver.port");
+    ASSERT_FALSE(m.port_length().is_set());
+    ASSERT_EQ(m.timestamp(), 100.1);
+    ASSERT_FALSE(m.next_timestamp().is_set());
+    ASSERT_TRUE(m.settings_overlay().is_nil());
+    ASSERT_EQ(m.message_number(), 0);
+    ASSERT_EQ(m.saved_until(), 3.0);
+    ASSERT_TRUE(m.data().is_nil());
 }
 
+
+TEST(test_mcp_message, encoded_roundtrip) {
+    Data test("overlay");
+
+    MPPMessage m(
+            Reference("sender.port"), Reference("receiver.port"),
+            {},
+            100.1, {},
+            test, 7, 1.0, Data("abc")
+            );
+
+    auto m2 = MPPMessage::from_bytes(m.encoded());
+
+    ASSERT_EQ(m2.sender(), "sender.port");
+    ASSERT_EQ(m2.receiver(), "receiver.port");
+    ASSERT_EQ(m2.timestamp(), 100.1);
+    ASSERT_EQ(m2.message_number(), 7);
+    ASSERT_EQ(m2.data().as<std::string>(), "abc");
+}
+
+TEST(test_mcp_message, forward_without_reencoding) {
+    MPPMessage m(
+            Reference("sender.port"), Reference("receiver.port"),
+            {},
+            100.1, {},
+            Data("overlay"), 7, 1.0, Data("abc")
+            );
+
+    auto wire_bytes = m.encoded();
+    auto m2 = MPPMessage::from_bytes(wire_bytes);
+
+    // an unmodified received message passes through as the original
+    // bytes, without being decoded and re-encoded
+    auto forwarded = m2.encoded();
+    ASSERT_EQ(forwarded.as_byte_array(), wire_bytes.as_byte_array());
+
+    // a modified one is re-encoded
+    m2.set_receiver("elsewhere.port");
+    auto reencoded = m2.encoded();
+    ASSERT_NE(reencoded.as_byte_array(), wire_bytes.as_byte_array());
+    auto m3 = MPPMessage::from_bytes(reencoded);
+    ASSERT_EQ(m3.receiver(), "elsewhere.port");
+    ASSERT_EQ(m3.data().as<std::string>(), "abc");
+}
+
+TEST(test_mcp_message, encoded_roundtrip_large) {
+    // too big for the small-message stack buffer, so this exercises the
+    // two-pass encoding path
+    std::string big(4096u, 'x');
+
+    MPPMessage m(
+            Reference("sender.port"), Reference("receiver.port"),
+            {},
+            100.1, {},
+            Data(), 0, 1.0, Data(big)
+            );
+
+    auto m2 = MPPMessage::from_bytes(m.encoded());
+
+    ASSERT_EQ(m2.sender(), "sender.port");
+    ASSERT_EQ(m2.data().as<std::string>(), big);
+}
+
+TEST(test_mcp_message, delta_flag_roundtrip) {
+    MPPMessage m(
+            Reference("sender.port"), Reference("receiver.port"),
+            {},
+            100.1, {},
+            Data(), 0, 1.0, Data("abc")
+            );
+
+    // messages default to not being part of a delta stream
+    ASSERT_EQ(m.delta(), Delta::none);
+    m.set_delta(Delta::keyframe);
+
+    auto m2 = MPPMessage::from_bytes(m.encoded());
+    ASSERT_EQ(m2.delta(), Delta::keyframe);
+    ASSERT_EQ(m2.data().as<std::string>(), "abc");
+}
+
+TEST(test_mcp_message, close_port_flag) {
+    MPPMessage m(
+            Reference("sender.port"), Reference("receiver.port"),
+            {},
+            100.1, {},
+            Data(), 0, 1.0, libmuscle::impl::ClosePort()
+            );
+
+    ASSERT_TRUE(m.is_close_port());
+
+    auto m2 = MPPMessage::from_bytes(m.encoded());
+    ASSERT_TRUE(m2.is_close_port());
+
+    MPPMessage m3(
+            Reference("sender.port"), Reference("receiver.port"),
+            {},
+            100.1, {},
+            Data(), 0, 1.0, Data("abc")
+            );
+    ASSERT_FALSE(m3.is_close_port());
+    ASSERT_FALSE(MPPMessage::from_bytes(m3.encoded()).is_close_port());
+}
+
+TEST(test_mcp_message, close_port_without_flag) {
+    // a sender that doesn't write the close flag, like the Python
+    // implementation, still gets its ClosePort messages detected, by
+    // inspecting the payload
+    Data msg_dict = Data::dict(
+            "sender", "sender.port",
+            "receiver", "receiver.port",
+            "port_length", Data(),
+            "timestamp", 100.1,
+            "next_timestamp", Data(),
+            "settings_overlay", Data(),
+            "message_number", 0,
+            "saved_until", 3.0,
+            "data", libmuscle::impl::ClosePort()
+            );
+
+    msgpack::sbuffer sbuf;
+    msgpack::pack(sbuf, msg_dict);
+    Data msg_bytes = Data::byte_array(sbuf.data(), sbuf.size());
+
+    ASSERT_TRUE(MPPMessage::from_bytes(msg_bytes).is_close_port());
+}
+
+TEST(test_mcp_message, encoded_zstd) {
+    MPPMessage m(
+            Reference("sender.port"), Reference("receiver.port"),
+            {},
+            100.1, {},
+            Data(), 0, 1.0, Data("abc")
+            );
+
+#ifdef MUSCLE_ENABLE_ZSTD
+    auto m2 = MPPMessage::from_bytes(m.encoded(Codec::zstd));
+    ASSERT_EQ(m2.data().as<std::string>(), "abc");
+#else
+    // without Zstd in the build, asking for it reports a clear error
+    ASSERT_THROW(m.encoded(Codec::zstd), std::runtime_error);
+#endif
+}
+
+TEST(test_mcp_message, encoded_with_receiver) {
+    MPPMessage m(
+            Reference("sender.port"), Reference("receiver.port"),
+            10,
+            100.1, 101.0,
+            Data("overlay"), 7, 1.0, Data("abc")
+            );
+
+    // splice in a receiver that is longer than the original
+    auto spliced = MPPMessage::encoded_with_receiver(
+            m.encoded(), Reference("another_receiver.another_port"));
+    ASSERT_TRUE(spliced.is_set());
+
+    auto m2 = MPPMessage::from_bytes(spliced.get());
+    ASSERT_EQ(m2.sender(), "sender.port");
+    ASSERT_EQ(m2.receiver(), "another_receiver.another_port");
+    ASSERT_EQ(m2.port_length(), 10);
+    ASSERT_EQ(m2.timestamp(), 100.1);
+    ASSERT_EQ(m2.next_timestamp(), 101.0);
+    ASSERT_EQ(m2.settings_overlay().as<std::string>(), "overlay");
+    ASSERT_EQ(m2.message_number(), 7);
+    ASSERT_EQ(m2.saved_until(), 1.0);
+    ASSERT_EQ(m2.data().as<std::string>(), "abc");
+
+    // and one that is shorter
+    auto spliced2 = MPPMessage::encoded_with_receiver(
+            m.encoded(), Reference("r.p"));
+    ASSERT_TRUE(spliced2.is_set());
+    ASSERT_EQ(MPPMessage::from_bytes(spliced2.get()).receiver(), "r.p");
+
+    // bytes not produced by encoded() are declined
+    auto not_a_message = libmuscle::impl::mcp::pack_data_exact(Data("abc"));
+    ASSERT_FALSE(MPPMessage::encoded_with_receiver(
+            not_a_message, Reference("r.p")).is_set());
+}
@@ -1,6 +1,11 @@
 #include "libmuscle/outbox.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -10,6 +15,7 @@
 #include <ymmsl/ymmsl.hpp>
 
 
+using libmuscle::impl::Data;
 using libmuscle::impl::DataConstRef;
 using libmuscle::impl::Optional;
 using libmuscle::impl::Outbox;
@@ -51,3 +57,140 @@ TEST(libmuscle_outbox, test_deposit_retrieve_message) {
     ASSERT_EQ(message2.get(), msg_ptr);
 }
 
+
+TEST(libmuscle_outbox, test_byte_limit_blocks) {
+    Outbox box(100u);
+
+    auto make_message = []() {
+            return std::make_unique<DataConstRef>(
+                    Data::byte_array("0123456789012345678901234567890123456789"
+                        "0123456789012345678901234567890123456789", 80u));
+            };
+
+    box.deposit(make_message());
+
+    // the second message exceeds the budget, so this deposit blocks
+    // until we retrieve the first one
+    std::atomic<bool> deposited(false);
+    std::thread producer([&]() {
+            box.deposit(make_message());
+            deposited.store(true);
+            });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_FALSE(deposited.load());
+
+    box.retrieve();
+    producer.join();
+    ASSERT_TRUE(deposited.load());
+    ASSERT_FALSE(box.is_empty());
+    box.retrieve();
+    ASSERT_TRUE(box.is_empty());
+}
+
+TEST(libmuscle_outbox, test_byte_limit_spills) {
+    Outbox box(100u, true);
+
+    // byte_array() refers to the buffer rather than copying, so keep
+    // the payloads alive until the messages have been retrieved
+    const int num_messages = 10;
+    std::vector<std::string> payloads;
+    for (int i = 0; i < num_messages; ++i)
+        payloads.push_back(std::string(80u, '0' + i));
+
+    for (int i = 0; i < num_messages; ++i)
+        box.deposit(std::make_unique<DataConstRef>(
+                    Data::byte_array(payloads[i].data(), payloads[i].size())));
+
+    // everything after the first message went to disk; check that it
+    // all comes back intact and in order
+    for (int i = 0; i < num_messages; ++i) {
+        ASSERT_FALSE(box.is_empty());
+        auto message = box.retrieve();
+        ASSERT_EQ(message->size(), 80u);
+        ASSERT_EQ(message->as_byte_array()[0], '0' + i);
+    }
+    ASSERT_TRUE(box.is_empty());
+}
+
+TEST(libmuscle_outbox, test_retransmit_window) {
+    Outbox box(0u, false, 10000u);
+
+    auto make_message = [](double timestamp) {
+            MPPMessage message(
+                    Reference("sender.out"), Reference("receiver.in"),
+                    Optional<int>(),
+                    timestamp, timestamp + 1.0,
+                    DataConstRef(),
+                    0, timestamp,
+                    DataConstRef("testing"));
+            return std::make_unique<DataConstRef>(message.encoded());
+            };
+
+    for (int i = 0; i < 3; ++i)
+        box.deposit(make_message(static_cast<double>(i)));
+    for (int i = 0; i < 3; ++i)
+        box.retrieve();
+
+    // everything retrieved is retained, sharing the encoded buffers
+    auto retained = box.retained_for_retransmit();
+    ASSERT_EQ(retained.size(), 3u);
+    ASSERT_EQ(MPPMessage::from_bytes(retained[0]).timestamp(), 0.0);
+    ASSERT_EQ(MPPMessage::from_bytes(retained[2]).timestamp(), 2.0);
+
+    // the peer says it has saved its state up to t=1.0, so the first
+    // two messages will never be needed again
+    box.discard_retained_until(1.0);
+    retained = box.retained_for_retransmit();
+    ASSERT_EQ(retained.size(), 1u);
+    ASSERT_EQ(MPPMessage::from_bytes(retained[0]).timestamp(), 2.0);
+}
+
+TEST(libmuscle_outbox, test_retransmit_window_bound) {
+    // a window smaller than one message keeps only the newest
+    Outbox box(0u, false, 1u);
+
+    MPPMessage message(
+            Reference("sender.out"), Reference("receiver.in"),
+            Optional<int>(),
+            0.0, 1.0,
+            DataConstRef(),
+            0, 0.0,
+            DataConstRef("testing"));
+
+    for (int i = 0; i < 3; ++i) {
+        box.deposit(std::make_unique<DataConstRef>(message.encoded()));
+        box.retrieve();
+    }
+
+    ASSERT_EQ(box.retained_for_retransmit().size(), 1u);
+}
+
+TEST(libmuscle_outbox, test_concurrent_deposits) {
+    Outbox box;
+    const int num_producers = 4;
+    const int num_messages = 250;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; ++p)
+        producers.emplace_back([&box]() {
+                for (int i = 0; i < num_messages; ++i)
+                    box.deposit(std::make_unique<DataConstRef>(i));
+                });
+
+    int sum = 0;
+    for (int received = 0; received < num_producers * num_messages; ) {
+        if (box.is_empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+        sum += box.retrieve()->as<int>();
+        ++received;
+    }
+
+    for (auto & producer : producers)
+        producer.join();
+
+    ASSERT_TRUE(box.is_empty());
+    ASSERT_EQ(sum, num_producers * (num_messages - 1) * num_messages / 2);
+}
@@ -134,3 +134,29 @@ TEST(libmuscle_peer_manager, get_peer_endpoint) {
 
 }
 
+TEST(libmuscle_peer_manager, get_peer_endpoint_cached) {
+    auto pm = peer_manager2();
+
+    // repeated lookups are served from the cache, and different slots
+    // get different entries
+    auto const & eps1 = pm.get_peer_endpoints("out", {11});
+    auto const & eps2 = pm.get_peer_endpoints("out", {11});
+    ASSERT_EQ(&eps1, &eps2);
+
+    auto const & eps3 = pm.get_peer_endpoints("out", {12});
+    ASSERT_NE(&eps1, &eps3);
+    ASSERT_EQ(std::string(eps3[0]), "kernel[12].in");
+}
+
+TEST(libmuscle_peer_manager, get_peer_endpoint_cached_per_snapshot) {
+    // a new snapshot gets fresh cache entries, even if it happens to
+    // be allocated at the address of a previous one
+    auto pm = std::make_unique<PeerManager>(peer_manager2());
+    ASSERT_EQ(std::string(pm->get_peer_endpoints("out", {11})[0]),
+            "kernel[11].in");
+
+    pm = std::make_unique<PeerManager>(peer_manager3());
+    ASSERT_EQ(std::string(pm->get_peer_endpoints("out", {11})[0]),
+            "other.in[11]");
+}
+
@@ -66,3 +66,24 @@ TEST(libmuscle_port, test_port_properties) {
     ASSERT_EQ(port.get_length(), 27);
 }
 
+TEST(libmuscle_port, test_repeated_resize) {
+    auto port = Port("out", Operator::O_F, true, true, 1, {13});
+
+    // message counts survive shrinking and regrowing, and all slots
+    // are open again after a resize
+    port.set_length(200);
+    port.increment_num_messages(150);
+    port.set_closed(100);
+    ASSERT_FALSE(port.is_open(100));
+
+    port.set_length(50);
+    ASSERT_EQ(port.get_length(), 50);
+
+    port.set_length(1000);
+    ASSERT_EQ(port.get_length(), 1000);
+    ASSERT_TRUE(port.is_open(100));
+    ASSERT_TRUE(port.is_open(999));
+    ASSERT_EQ(port.get_num_messages(150), 1);
+    ASSERT_EQ(port.get_num_messages(999), 0);
+}
+
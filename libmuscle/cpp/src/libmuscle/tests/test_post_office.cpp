@@ -49,6 +49,37 @@ std::unique_ptr<msgpack::sbuffer> make_request(std::string const & receiver) {
     return sbuf;
 }
 
+std::unique_ptr<msgpack::sbuffer> make_slice_request(
+        std::string const & receiver,
+        std::vector<std::size_t> const & offsets,
+        std::vector<std::size_t> const & extents)
+{
+    Data offsets_list = Data::nils(offsets.size());
+    for (std::size_t i = 0u; i < offsets.size(); ++i)
+        offsets_list[i] = offsets[i];
+    Data extents_list = Data::nils(extents.size());
+    for (std::size_t i = 0u; i < extents.size(); ++i)
+        extents_list[i] = extents[i];
+
+    auto request = Data::list(
+            static_cast<int>(RequestType::get_next_message),
+            receiver, offsets_list, extents_list);
+    auto sbuf = std::make_unique<msgpack::sbuffer>();
+    msgpack::pack(*sbuf, request);
+    return sbuf;
+}
+
+std::unique_ptr<msgpack::sbuffer> make_batch_request(
+        std::string const & receiver, int max_messages)
+{
+    auto request = Data::list(
+            static_cast<int>(RequestType::get_next_message),
+            receiver, max_messages);
+    auto sbuf = std::make_unique<msgpack::sbuffer>();
+    msgpack::pack(*sbuf, request);
+    return sbuf;
+}
+
 TEST(libmuscle_post_office, test_deposit_get_message) {
     PostOffice po;
     auto msg = make_message();
@@ -81,6 +112,83 @@ TEST(libmuscle_post_office, test_individual_slots) {
 }
 
 
+TEST(libmuscle_post_office, test_slice_request) {
+    PostOffice po;
+    std::vector<double> x(16);
+    for (std::size_t i = 0u; i < 16u; ++i)
+        x[i] = static_cast<double>(i);
+    MPPMessage msg(
+            "test_sender.port", "test_receiver.port", Optional<int>(),
+            0.0, 1.0, DataConstRef(), 0, 5.0,
+            Data::grid(x.data(), {4, 4}));
+    po.deposit(
+            "test_receiver.port",
+            std::make_unique<DataConstRef>(msg.encoded()));
+
+    auto request = make_slice_request("test_receiver.port", {1, 1}, {2, 2});
+    std::unique_ptr<DataConstRef> res;
+    int fd = po.handle_request(request->data(), request->size(), res);
+    ASSERT_EQ(fd, -1);
+
+    auto msg2 = MPPMessage::from_bytes(*res);
+    ASSERT_TRUE(msg2.data().is_a_grid_block_of<double>());
+    ASSERT_EQ(msg2.data().shape()[0], 2u);
+    ASSERT_EQ(msg2.data().offsets()[0], 1u);
+    ASSERT_EQ(msg2.data().elements<double>()[0], 5.0);
+    ASSERT_EQ(msg2.data().elements<double>()[3], 10.0);
+    ASSERT_EQ(msg2.timestamp(), 0.0);
+
+    // a message without a grid payload is sent in full
+    auto msg3 = make_message();
+    auto msg3_addr = msg3.get();
+    po.deposit("test_receiver.port", std::move(msg3));
+    int fd2 = po.handle_request(request->data(), request->size(), res);
+    ASSERT_EQ(fd2, -1);
+    ASSERT_EQ(res.get(), msg3_addr);
+}
+
+
+TEST(libmuscle_post_office, test_batch_request) {
+    PostOffice po;
+    for (int i = 0; i < 3; ++i) {
+        MPPMessage msg(
+                "test_sender.port", "test_receiver.port", Optional<int>(),
+                static_cast<double>(i), 1.0, DataConstRef(), i, 5.0,
+                DataConstRef());
+        po.deposit(
+                "test_receiver.port",
+                std::make_unique<DataConstRef>(msg.encoded()));
+    }
+
+    auto request = make_batch_request("test_receiver.port", 5);
+    std::unique_ptr<DataConstRef> res;
+    int fd = po.handle_request(request->data(), request->size(), res);
+    ASSERT_EQ(fd, -1);
+
+    auto batch = libmuscle::impl::mcp::unpack_data_view(*res);
+    ASSERT_TRUE(batch.is_a_list());
+    ASSERT_EQ(batch.size(), 3u);
+    for (std::size_t i = 0u; i < 3u; ++i) {
+        auto msg = MPPMessage::from_bytes(batch[i]);
+        ASSERT_EQ(msg.timestamp(), static_cast<double>(i));
+        ASSERT_EQ(msg.message_number(), static_cast<int>(i));
+    }
+
+    // no more than the requested maximum comes along, the rest stays
+    for (int i = 0; i < 3; ++i)
+        po.deposit("test_receiver.port", make_message());
+    auto request2 = make_batch_request("test_receiver.port", 2);
+    int fd2 = po.handle_request(request2->data(), request2->size(), res);
+    ASSERT_EQ(fd2, -1);
+    auto batch2 = libmuscle::impl::mcp::unpack_data_view(*res);
+    ASSERT_EQ(batch2.size(), 2u);
+
+    auto request3 = make_request("test_receiver.port");
+    int fd3 = po.handle_request(request3->data(), request3->size(), res);
+    ASSERT_EQ(fd3, -1);
+}
+
+
 TEST(libmuscle_post_office, test_get_before_deposit) {
     PostOffice po;
 
@@ -96,10 +204,11 @@ TEST(libmuscle_post_office, test_get_before_deposit) {
 
     int flags = fcntl(fd, F_GETFL, 0);
     fcntl(fd, F_SETFL, flags | O_NONBLOCK);
-    std::vector<char> buf(10);
-    ssize_t num_read = read(fd, buf.data(), buf.size());
+    uint64_t count = 0u;
+    ssize_t num_read = read(fd, &count, sizeof(count));
     perror("Read error");
-    ASSERT_EQ(num_read, 1);
+    ASSERT_EQ(num_read, 8);
+    ASSERT_EQ(count, 1u);
 
     auto response = po.get_response(fd);
     ASSERT_EQ(response.get(), msg_addr);
@@ -141,3 +250,26 @@ TEST(libmuscle_post_office, test_wait_for_receivers) {
     thread2.join();
 }
 
+
+TEST(libmuscle_post_office, test_deposit_batch) {
+    PostOffice po;
+    std::vector<std::pair<Reference, std::unique_ptr<DataConstRef>>> batch;
+    std::vector<DataConstRef const *> msg_addrs;
+    for (int i = 0; i < 10; ++i) {
+        auto msg = make_message();
+        msg_addrs.push_back(msg.get());
+        batch.emplace_back(
+                Reference("test_receiver" + std::to_string(i) + ".port"),
+                std::move(msg));
+    }
+    po.deposit_batch(std::move(batch));
+
+    for (int i = 0; i < 10; ++i) {
+        auto request = make_request(
+                "test_receiver" + std::to_string(i) + ".port");
+        std::unique_ptr<DataConstRef> msg;
+        int fd = po.handle_request(request->data(), request->size(), msg);
+        ASSERT_EQ(fd, -1);
+        ASSERT_EQ(msg.get(), msg_addrs[i]);
+    }
+}
@@ -63,3 +63,78 @@ TEST(libmuscle_settings_manager, test_get_setting) {
     ASSERT_EQ(s.get_setting("instance[11]"s, "test5"s), "overlay_test5");
 }
 
+TEST(libmuscle_settings_manager, test_prefetch) {
+    SettingsManager s;
+
+    s.base["test"] = 13;
+    s.base["test2"] = "base_test2";
+    s.base["instance.test2"] = "base_instance_test2";
+    s.overlay["instance.test3"] = 3.0;
+    s.overlay["other.test4"] = true;
+
+    s.prefetch("instance"s);
+
+    ASSERT_EQ(s.get_setting("instance"s, "test"s), 13);
+    ASSERT_EQ(s.get_setting("instance"s, "test2"s), "base_instance_test2");
+    ASSERT_EQ(s.get_setting("instance"s, "test3"s), 3.0);
+    ASSERT_THROW(s.get_setting("instance"s, "test4"s), std::out_of_range);
+
+    // the prefetch is redone when the settings change
+    s.overlay["instance.test2"] = "overlay_instance_test2";
+    ASSERT_EQ(s.get_setting("instance"s, "test2"s), "overlay_instance_test2");
+}
+
+TEST(libmuscle_settings_manager, test_get_setting_as_cached) {
+    SettingsManager s;
+
+    s.base["test"] = std::vector<double>({1.0, 2.0});
+
+    // repeated typed reads return the same converted object
+    auto const & val1 = s.get_setting_as<std::vector<double>>(
+            "instance"s, "test"s);
+    auto const & val2 = s.get_setting_as<std::vector<double>>(
+            "instance"s, "test"s);
+    ASSERT_EQ(val1, std::vector<double>({1.0, 2.0}));
+    ASSERT_EQ(&val1, &val2);
+
+    ASSERT_THROW(
+            s.get_setting_as<std::string>("instance"s, "test"s),
+            std::runtime_error);
+}
+
+TEST(libmuscle_settings_manager, test_get_setting_cached) {
+    SettingsManager s;
+
+    s.base["instance.test"] = 13;
+
+    // repeated reads are served from the memo
+    auto const & val1 = s.get_setting("instance"s, "test"s);
+    auto const & val2 = s.get_setting("instance"s, "test"s);
+    ASSERT_EQ(&val1, &val2);
+
+    // and the memo is discarded when the settings change
+    s.overlay["instance.test"] = 14;
+    ASSERT_EQ(s.get_setting("instance"s, "test"s), 14);
+
+    s.overlay.erase("instance.test");
+    ASSERT_EQ(s.get_setting("instance"s, "test"s), 13);
+}
+
+
+TEST(libmuscle_settings_manager, test_snapshot) {
+    SettingsManager s;
+
+    s.base["test1"] = 13;
+    s.base["test2"] = "base";
+    s.base["instance.test2"] = "specific";
+    s.base["other.test3"] = 3.5;
+    s.overlay["test1"] = 14;
+
+    auto snapshot = s.snapshot("instance"s);
+
+    ASSERT_EQ(snapshot.at("test1"), 14);
+    ASSERT_EQ(snapshot.at("test2"), "specific");
+    ASSERT_EQ(snapshot.at("other.test3"), 3.5);
+    // prefixed names resolve too, just as with get_setting()
+    ASSERT_EQ(snapshot.at("instance.test2"), "specific");
+}
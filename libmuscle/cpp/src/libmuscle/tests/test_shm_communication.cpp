@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <msgpack.hpp>
+
+#include <libmuscle/mpp_message.hpp>
+#include <libmuscle/mcp/shm_transport_server.hpp>
+#include <libmuscle/mcp/shm_util.hpp>
+#include <libmuscle/mpp_client.hpp>
+
+#include <libmuscle/data.hpp>
+#include <libmuscle/post_office.hpp>
+#include <libmuscle/util.hpp>
+#include <ymmsl/ymmsl.hpp>
+
+#include <string>
+#include <utility>
+
+
+using libmuscle::impl::Data;
+using libmuscle::impl::DataConstRef;
+using libmuscle::impl::MPPMessage;
+using libmuscle::impl::MPPClient;
+using libmuscle::impl::mcp::ShmTransportServer;
+using libmuscle::impl::PostOffice;
+
+using ymmsl::Reference;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(test_shm_communication, send_receive) {
+    PostOffice post_office;
+    Reference receiver("test_receiver.port");
+
+    MPPMessage msg(
+            "test_sender.port", receiver, 10,
+            0.0, 1.0,
+            Data::dict("par1", 13), 1, 4.0,
+            Data::dict("var1", 1, "var2", 2.0, "var3", "3"));
+    auto msg_data = std::make_unique<DataConstRef>(msg.encoded());
+    post_office.deposit(receiver, std::move(msg_data));
+
+    ShmTransportServer server(post_office);
+    std::string location = server.get_location();
+    ASSERT_EQ(location.compare(0u, 4u, "shm:"), 0);
+
+    std::vector<std::string> locations = {location};
+    MPPClient client(locations);
+    DataConstRef bytes = client.receive(receiver);
+    MPPMessage m = MPPMessage::from_bytes(bytes);
+
+    ASSERT_EQ(m.sender(), "test_sender.port");
+    ASSERT_EQ(m.receiver(), "test_receiver.port");
+    ASSERT_EQ(m.port_length(), 10);
+    ASSERT_EQ(m.timestamp(), 0.0);
+    ASSERT_EQ(m.next_timestamp(), 1.0);
+    ASSERT_EQ(m.settings_overlay()["par1"].as<int>(), 13);
+    ASSERT_EQ(m.message_number(), 1);
+    ASSERT_EQ(m.saved_until(), 4.0);
+    ASSERT_EQ(m.data()["var1"].as<int>(), 1);
+    ASSERT_EQ(m.data()["var2"].as<double>(), 2.0);
+    ASSERT_EQ(m.data()["var3"].as<std::string>(), "3");
+
+    client.close();
+    server.close();
+}
+
+TEST(test_shm_communication, send_receive_large) {
+    PostOffice post_office;
+    Reference receiver("test_receiver.port");
+
+    // larger than a ring, so the message gets streamed through in chunks
+    std::size_t data_size = 4u * libmuscle::impl::mcp::shm::ring_size;
+    auto data = Data::byte_array(data_size);
+    for (std::size_t i = 0u; i < data_size; ++i)
+        data.as_byte_array()[i] = static_cast<char>(i % 256);
+
+    MPPMessage msg(
+            "test_sender.port", receiver, 10,
+            0.0, 1.0,
+            Data::dict(), 1, 4.0, data);
+    auto msg_data = std::make_unique<DataConstRef>(msg.encoded());
+    post_office.deposit(receiver, std::move(msg_data));
+
+    ShmTransportServer server(post_office);
+    std::vector<std::string> locations = {server.get_location()};
+    MPPClient client(locations);
+    DataConstRef bytes = client.receive(receiver);
+    MPPMessage m = MPPMessage::from_bytes(bytes);
+
+    ASSERT_TRUE(m.data().is_a_byte_array());
+    ASSERT_EQ(m.data().size(), data_size);
+    for (std::size_t i = 0u; i < data_size; i += 1024u)
+        ASSERT_EQ(m.data().as_byte_array()[i], static_cast<char>(i % 256));
+
+    client.close();
+    server.close();
+}
+
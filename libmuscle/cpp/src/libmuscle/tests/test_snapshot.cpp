@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <libmuscle/snapshot.hpp>
+
+#include <libmuscle/data.hpp>
+#include <libmuscle/message.hpp>
+#include <libmuscle/util.hpp>
+#include <ymmsl/ymmsl.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+using libmuscle::impl::Data;
+using libmuscle::impl::DataConstRef;
+using libmuscle::impl::Message;
+using libmuscle::impl::Optional;
+using libmuscle::impl::Snapshot;
+using libmuscle::impl::SnapshotMetadata;
+using ymmsl::Settings;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+Snapshot create_snapshot() {
+    Message message(0.2, Data("test_data"));
+    message.set_next_timestamp(1.2);
+
+    Settings settings_overlay;
+    settings_overlay["test"] = 1;
+
+    return Snapshot(
+            {"test at 0.2"}, 13.4, {{"in", {1}}, {"out", {4}}}, false,
+            message, settings_overlay);
+}
+
+}
+
+TEST(libmuscle_snapshot, test_snapshot) {
+    auto snapshot = create_snapshot();
+
+    ASSERT_EQ(snapshot.triggers, std::vector<std::string>({"test at 0.2"}));
+    ASSERT_EQ(snapshot.wallclock_time, 13.4);
+    ASSERT_EQ(snapshot.port_message_counts.size(), 2u);
+    ASSERT_FALSE(snapshot.is_final_snapshot);
+    ASSERT_TRUE(snapshot.message.is_set());
+    ASSERT_EQ(snapshot.message.get().timestamp(), 0.2);
+    ASSERT_EQ(snapshot.message.get().next_timestamp(), 1.2);
+    ASSERT_EQ(snapshot.message.get().data().as<std::string>(), "test_data");
+    ASSERT_EQ(snapshot.settings_overlay.at("test"), 1);
+}
+
+TEST(libmuscle_snapshot, test_snapshot_roundtrip) {
+    auto snapshot = create_snapshot();
+
+    DataConstRef bytes = snapshot.to_bytes();
+    std::vector<char> buf(
+            bytes.as_byte_array(), bytes.as_byte_array() + bytes.size());
+    auto snapshot2 = Snapshot::from_bytes(buf);
+
+    ASSERT_EQ(snapshot2.triggers, snapshot.triggers);
+    ASSERT_EQ(snapshot2.wallclock_time, snapshot.wallclock_time);
+    ASSERT_EQ(snapshot2.port_message_counts, snapshot.port_message_counts);
+    ASSERT_EQ(snapshot2.is_final_snapshot, snapshot.is_final_snapshot);
+    ASSERT_EQ(
+            snapshot2.message.get().timestamp(),
+            snapshot.message.get().timestamp());
+    ASSERT_EQ(
+            snapshot2.message.get().next_timestamp(),
+            snapshot.message.get().next_timestamp());
+    ASSERT_EQ(
+            snapshot2.message.get().data().as<std::string>(),
+            snapshot.message.get().data().as<std::string>());
+    ASSERT_EQ(snapshot2.settings_overlay.at("test"), 1);
+}
+
+TEST(libmuscle_snapshot, test_snapshot_parts_roundtrip) {
+    auto snapshot = create_snapshot();
+
+    DataConstRef header = snapshot.header_bytes();
+    DataConstRef payload = snapshot.message_bytes();
+    std::vector<char> buf(
+            header.as_byte_array(), header.as_byte_array() + header.size());
+    auto snapshot2 = Snapshot::from_parts(buf, payload);
+
+    ASSERT_EQ(snapshot2.triggers, snapshot.triggers);
+    ASSERT_EQ(snapshot2.wallclock_time, snapshot.wallclock_time);
+    ASSERT_EQ(snapshot2.port_message_counts, snapshot.port_message_counts);
+    ASSERT_EQ(snapshot2.is_final_snapshot, snapshot.is_final_snapshot);
+    ASSERT_EQ(
+            snapshot2.message.get().timestamp(),
+            snapshot.message.get().timestamp());
+    ASSERT_EQ(
+            snapshot2.message.get().data().as<std::string>(),
+            snapshot.message.get().data().as<std::string>());
+    ASSERT_EQ(snapshot2.settings_overlay.at("test"), 1);
+}
+
+TEST(libmuscle_snapshot, test_snapshot_without_message) {
+    Snapshot snapshot({"implicit"}, 1.0, {}, true, {}, Settings());
+
+    DataConstRef bytes = snapshot.to_bytes();
+    std::vector<char> buf(
+            bytes.as_byte_array(), bytes.as_byte_array() + bytes.size());
+    auto snapshot2 = Snapshot::from_bytes(buf);
+
+    ASSERT_EQ(snapshot2.triggers, snapshot.triggers);
+    ASSERT_TRUE(snapshot2.is_final_snapshot);
+    ASSERT_FALSE(snapshot2.message.is_set());
+}
+
+TEST(libmuscle_snapshot, test_snapshot_metadata) {
+    auto snapshot = create_snapshot();
+    auto metadata = SnapshotMetadata::from_snapshot(snapshot, "test");
+
+    ASSERT_EQ(metadata.triggers, snapshot.triggers);
+    ASSERT_EQ(metadata.wallclock_time, snapshot.wallclock_time);
+    ASSERT_EQ(metadata.port_message_counts, snapshot.port_message_counts);
+    ASSERT_EQ(metadata.is_final_snapshot, snapshot.is_final_snapshot);
+    ASSERT_EQ(metadata.timestamp, 0.2);
+    ASSERT_EQ(metadata.next_timestamp.get(), 1.2);
+    ASSERT_EQ(metadata.snapshot_filename, "test");
+}
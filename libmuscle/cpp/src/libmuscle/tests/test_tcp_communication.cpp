@@ -47,19 +47,137 @@ TEST(test_tcp_communication, send_receive) {
     DataConstRef bytes = client.receive(receiver);
     MPPMessage m = MPPMessage::from_bytes(bytes);
 
-    ASSERT_EQ(m.sender, "test_sender.port");
-    ASSERT_EQ(m.receiver, "test_receiver.port");
-    ASSERT_EQ(m.port_length, 10);
-    ASSERT_EQ(m.timestamp, 0.0);
-    ASSERT_EQ(m.next_timestamp, 1.0);
-    ASSERT_EQ(m.settings_overlay["par1"].as<int>(), 13);
-    ASSERT_EQ(m.message_number, 1);
-    ASSERT_EQ(m.saved_until, 4.0);
-    ASSERT_EQ(m.data["var1"].as<int>(), 1);
-    ASSERT_EQ(m.data["var2"].as<double>(), 2.0);
-    ASSERT_EQ(m.data["var3"].as<std::string>(), "3");
+    ASSERT_EQ(m.sender(), "test_sender.port");
+    ASSERT_EQ(m.receiver(), "test_receiver.port");
+    ASSERT_EQ(m.port_length(), 10);
+    ASSERT_EQ(m.timestamp(), 0.0);
+    ASSERT_EQ(m.next_timestamp(), 1.0);
+    ASSERT_EQ(m.settings_overlay()["par1"].as<int>(), 13);
+    ASSERT_EQ(m.message_number(), 1);
+    ASSERT_EQ(m.saved_until(), 4.0);
+    ASSERT_EQ(m.data()["var1"].as<int>(), 1);
+    ASSERT_EQ(m.data()["var2"].as<double>(), 2.0);
+    ASSERT_EQ(m.data()["var3"].as<std::string>(), "3");
 
     client.close();
     server.close();
 }
 
+TEST(test_tcp_communication, receive_into_buffer) {
+    PostOffice post_office;
+    Reference receiver("test_receiver.port");
+
+    MPPMessage msg(
+            "test_sender.port", receiver, 10,
+            0.0, 1.0,
+            Data::dict(), 1, 4.0,
+            Data::dict("var1", 1, "var2", 2.0));
+    auto msg_data = std::make_unique<DataConstRef>(msg.encoded());
+    post_office.deposit(receiver, std::move(msg_data));
+
+    TcpTransportServer server(post_office);
+    std::vector<std::string> locations = {server.get_location()};
+    MPPClient client(locations);
+
+    std::vector<char> buffer;
+    DataConstRef bytes = client.receive(
+            receiver,
+            [&buffer](std::size_t length) -> char * {
+                buffer.resize(length);
+                return buffer.data();
+            });
+
+    // the message landed in our buffer, and bytes refers to it
+    ASSERT_EQ(bytes.size(), buffer.size());
+    ASSERT_EQ(bytes.as_byte_array(), buffer.data());
+
+    MPPMessage m = MPPMessage::from_bytes(bytes);
+
+    ASSERT_EQ(m.sender(), "test_sender.port");
+    ASSERT_EQ(m.receiver(), "test_receiver.port");
+    ASSERT_EQ(m.timestamp(), 0.0);
+    ASSERT_EQ(m.data()["var1"].as<int>(), 1);
+    ASSERT_EQ(m.data()["var2"].as<double>(), 2.0);
+
+    client.close();
+    server.close();
+}
+
+
+TEST(test_tcp_communication, pipelined_receive) {
+    PostOffice post_office;
+    Reference receiver1("test_receiver.port1");
+    Reference receiver2("test_receiver.port2");
+
+    MPPMessage msg1(
+            "test_sender.port", receiver1, 10,
+            0.0, 1.0,
+            Data::dict(), 1, 4.0, Data::dict("var1", 1));
+    post_office.deposit(
+            receiver1, std::make_unique<DataConstRef>(msg1.encoded()));
+
+    MPPMessage msg2(
+            "test_sender.port", receiver2, 10,
+            1.0, 2.0,
+            Data::dict(), 1, 4.0, Data::dict("var2", 2));
+    post_office.deposit(
+            receiver2, std::make_unique<DataConstRef>(msg2.encoded()));
+
+    TcpTransportServer server(post_office);
+    std::vector<std::string> locations = {server.get_location()};
+    MPPClient client(locations);
+
+    // both requests go out before either response is read
+    client.start_receive(receiver1);
+    client.start_receive(receiver2);
+
+    MPPMessage m1 = MPPMessage::from_bytes(client.finish_receive());
+    MPPMessage m2 = MPPMessage::from_bytes(client.finish_receive());
+
+    ASSERT_EQ(m1.receiver(), "test_receiver.port1");
+    ASSERT_EQ(m1.data()["var1"].as<int>(), 1);
+    ASSERT_EQ(m2.receiver(), "test_receiver.port2");
+    ASSERT_EQ(m2.data()["var2"].as<int>(), 2);
+
+    client.close();
+    server.close();
+}
+
+TEST(test_tcp_communication, pipelined_receive_deferred) {
+    PostOffice post_office;
+    Reference receiver1("test_receiver.port1");
+    Reference receiver2("test_receiver.port2");
+
+    TcpTransportServer server(post_office);
+    std::vector<std::string> locations = {server.get_location()};
+    MPPClient client(locations);
+
+    // requests go out before the messages have been deposited
+    client.start_receive(receiver1);
+    client.start_receive(receiver2);
+
+    MPPMessage msg1(
+            "test_sender.port", receiver1, 10,
+            0.0, 1.0,
+            Data::dict(), 1, 4.0, Data::dict("var1", 1));
+    post_office.deposit(
+            receiver1, std::make_unique<DataConstRef>(msg1.encoded()));
+
+    MPPMessage msg2(
+            "test_sender.port", receiver2, 10,
+            1.0, 2.0,
+            Data::dict(), 1, 4.0, Data::dict("var2", 2));
+    post_office.deposit(
+            receiver2, std::make_unique<DataConstRef>(msg2.encoded()));
+
+    MPPMessage m1 = MPPMessage::from_bytes(client.finish_receive());
+    MPPMessage m2 = MPPMessage::from_bytes(client.finish_receive());
+
+    ASSERT_EQ(m1.receiver(), "test_receiver.port1");
+    ASSERT_EQ(m1.data()["var1"].as<int>(), 1);
+    ASSERT_EQ(m2.receiver(), "test_receiver.port2");
+    ASSERT_EQ(m2.data()["var2"].as<int>(), 2);
+
+    client.close();
+    server.close();
+}
@@ -0,0 +1,81 @@
+#include "libmuscle/trace.hpp"
+
+#include "libmuscle/profiling.hpp"
+
+#include <ymmsl/ymmsl.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+
+using namespace libmuscle::impl::instrumentation;
+
+using libmuscle::impl::ProfileEvent;
+using libmuscle::impl::ProfileEventType;
+
+
+int main(int argc, char *argv[]) {
+    // must be set before the first tracing_enabled() call memoises it;
+    // a tiny ring lets us test wrapping
+    setenv("MUSCLE_TRACE", "4", 1);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+std::string dump_trace_() {
+    char path[] = "/tmp/muscle3_test_trace_XXXXXX";
+    int fd = mkstemp(path);
+    write_trace(fd);
+    close(fd);
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    unlink(path);
+    return contents.str();
+}
+
+}
+
+
+TEST(libmuscle_trace, record_event) {
+    ASSERT_TRUE(tracing_enabled());
+
+    ProfileEvent event(
+            ProfileEventType::send,
+            ymmsl::Port(ymmsl::Identifier("out"), ymmsl::Operator::O_I));
+    event.message_number = 13;
+    event.stop();
+    trace_event(event);
+
+    std::string trace = dump_trace_();
+    ASSERT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(trace.find("\"name\":\"send\""), std::string::npos);
+    ASSERT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(trace.find("\"port\":\"out\""), std::string::npos);
+    ASSERT_NE(trace.find("\"message_number\":13"), std::string::npos);
+}
+
+TEST(libmuscle_trace, ring_wraps) {
+    for (int i = 0; i < 6; ++i) {
+        ProfileEvent event(
+                ProfileEventType::receive,
+                ymmsl::Port(ymmsl::Identifier("in"), ymmsl::Operator::S));
+        event.message_number = 100 + i;
+        event.stop();
+        trace_event(event);
+    }
+
+    // the ring holds four events, so the oldest were overwritten
+    std::string trace = dump_trace_();
+    ASSERT_EQ(trace.find("\"message_number\":101"), std::string::npos);
+    ASSERT_NE(trace.find("\"message_number\":104"), std::string::npos);
+    ASSERT_NE(trace.find("\"message_number\":105"), std::string::npos);
+}
@@ -0,0 +1,66 @@
+#include "libmuscle/mcp/transfer_scheduler.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+
+using libmuscle::impl::mcp::TransferScheduler;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(libmuscle_transfer_scheduler, test_disabled) {
+    auto & scheduler = TransferScheduler::get();
+    scheduler.configure(0.0, 0.0, 0.0);
+
+    auto before = std::chrono::steady_clock::now();
+    ASSERT_TRUE(scheduler.try_acquire(1024u * 1024u * 1024u));
+    ASSERT_TRUE(scheduler.try_acquire(1024u * 1024u * 1024u));
+    ASSERT_LE(scheduler.bulk_start_time(), std::chrono::steady_clock::now());
+    ASSERT_GE(scheduler.bulk_start_time(), before);
+}
+
+TEST(libmuscle_transfer_scheduler, test_token_bucket) {
+    auto & scheduler = TransferScheduler::get();
+    // 1 MB/s, so the initial burst allowance is 100 kB
+    scheduler.configure(1e6, 0.0, 0.0);
+
+    ASSERT_TRUE(scheduler.try_acquire(100000u));
+    ASSERT_FALSE(scheduler.try_acquire(100000u));
+
+    // at 1 MB/s the bucket holds 100 kB again after 100 ms
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    ASSERT_TRUE(scheduler.try_acquire(100000u));
+
+    // a chunk larger than the burst allowance must still get through
+    // eventually
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    ASSERT_TRUE(scheduler.try_acquire(200000u));
+
+    scheduler.configure(0.0, 0.0, 0.0);
+}
+
+TEST(libmuscle_transfer_scheduler, test_stagger) {
+    auto & scheduler = TransferScheduler::get();
+    scheduler.configure(0.0, 10.0, 0.5);
+
+    // the first transfer of a burst waits for our offset into the
+    // window
+    auto now = std::chrono::steady_clock::now();
+    auto start = scheduler.bulk_start_time();
+    double delay = std::chrono::duration<double>(start - now).count();
+    ASSERT_GT(delay, 4.9);
+    ASSERT_LT(delay, 5.1);
+
+    // a follow-on transfer goes out immediately
+    scheduler.bulk_done();
+    start = scheduler.bulk_start_time();
+    ASSERT_LE(start, std::chrono::steady_clock::now());
+
+    scheduler.configure(0.0, 0.0, 0.0);
+}
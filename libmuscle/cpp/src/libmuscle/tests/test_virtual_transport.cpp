@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <libmuscle/data.hpp>
+#include <libmuscle/mcp/transport_server.hpp>
+#include <libmuscle/mcp/virtual_transport_client.hpp>
+#include <libmuscle/mcp/virtual_transport_server.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+
+using libmuscle::impl::Data;
+using libmuscle::impl::DataConstRef;
+using libmuscle::impl::mcp::RequestHandler;
+using libmuscle::impl::mcp::VirtualTransportClient;
+using libmuscle::impl::mcp::VirtualTransportServer;
+
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+class MockHandler : public RequestHandler {
+public:
+    virtual int handle_request(
+            char const * req_buf, std::size_t req_len,
+            std::unique_ptr<DataConstRef> & res_buf
+    ) override {
+        std::string request(req_buf, req_len);
+        if (request != "TestRequest")
+            throw std::runtime_error("Unexpected request " + request);
+
+        std::string response("TestResponse");
+        auto response_data = std::make_unique<Data>(
+                Data::byte_array(response.size()));
+        memcpy(response_data->as_byte_array(), response.data(),
+                response_data->size());
+        res_buf = std::move(response_data);
+        return -1;
+    };
+
+    virtual std::unique_ptr<DataConstRef> get_response(int fd) override {
+        throw std::runtime_error("Should not be called");
+    };
+};
+
+
+TEST(test_virtual_transport, send_receive) {
+    MockHandler handler;
+    VirtualTransportServer server(handler, 0u, 0u);
+    std::string location = server.get_location();
+    ASSERT_EQ(location.compare(0u, 12u, "virtual:0:0:"), 0);
+    ASSERT_TRUE(VirtualTransportClient::can_connect_to(location));
+    ASSERT_FALSE(VirtualTransportClient::can_connect_to("tcp:localhost:80"));
+    VirtualTransportClient client(location);
+
+    auto result = client.call("TestRequest", strlen("TestRequest"));
+
+    std::string response(result.size(), ' ');
+    std::copy(
+            result.as_byte_array(),
+            result.as_byte_array() + result.size(), response.begin());
+    ASSERT_EQ(response, "TestResponse");
+
+    client.close();
+    server.close();
+}
+
+
+TEST(test_virtual_transport, pipelined_latency) {
+    // a 5 ms link; pipelined requests overlap their latencies, so four
+    // of them take well under the 40 ms that four serial round trips
+    // would, while a single call does pay the full round trip
+    MockHandler handler;
+    VirtualTransportServer server(handler, 5000000u, 0u);
+    VirtualTransportClient client(server.get_location());
+
+    auto start = steady_clock::now();
+    client.call("TestRequest", strlen("TestRequest"));
+    auto serial = duration_cast<milliseconds>(
+            steady_clock::now() - start).count();
+    ASSERT_GE(serial, 5);
+
+    const int num_requests = 4;
+    start = steady_clock::now();
+    for (int i = 0; i < num_requests; ++i)
+        client.send_request("TestRequest", strlen("TestRequest"));
+
+    // the handler has already answered, but the simulated link hasn't
+    // delivered anything yet
+    ASSERT_FALSE(client.response_started());
+
+    for (int i = 0; i < num_requests; ++i)
+        client.get_response();
+    auto pipelined = duration_cast<milliseconds>(
+            steady_clock::now() - start).count();
+    ASSERT_GE(pipelined, 5);
+    ASSERT_LT(pipelined, 20);
+
+    client.close();
+    server.close();
+}
+
+
+TEST(test_virtual_transport, bandwidth) {
+    // 1 GB/s with a 1 MB response is a millisecond on the wire per
+    // request; ten requests must take at least ten of them
+    class BulkHandler : public RequestHandler {
+    public:
+        virtual int handle_request(
+                char const * req_buf, std::size_t req_len,
+                std::unique_ptr<DataConstRef> & res_buf
+        ) override {
+            res_buf = std::make_unique<Data>(Data::byte_array(1000000u));
+            return -1;
+        };
+
+        virtual std::unique_ptr<DataConstRef> get_response(int fd) override {
+            throw std::runtime_error("Should not be called");
+        };
+    };
+
+    BulkHandler handler;
+    VirtualTransportServer server(handler, 0u, 1000000000u);
+    VirtualTransportClient client(server.get_location());
+
+    auto start = steady_clock::now();
+    for (int i = 0; i < 10; ++i) {
+        auto result = client.call("TestRequest", strlen("TestRequest"));
+        ASSERT_EQ(result.size(), 1000000u);
+    }
+    auto elapsed = duration_cast<milliseconds>(
+            steady_clock::now() - start).count();
+    ASSERT_GE(elapsed, 10);
+
+    client.close();
+    server.close();
+}
@@ -12,9 +12,7 @@ namespace libmuscle { namespace impl {
 
 Timestamp::Timestamp(double seconds)
     : seconds(seconds)
-{
-    tzset();
-}
+{}
 
 Timestamp Timestamp::now() {
     auto since_epoch = wallclock::now().time_since_epoch();
@@ -24,11 +22,23 @@ Timestamp Timestamp::now() {
 }
 
 std::ostream & operator<<(std::ostream & os, Timestamp ts) {
+    // Formatting a time through localtime_r and strftime is expensive,
+    // and the whole-second part of the result only changes once a
+    // second. At high log rates most records fall within the same
+    // second as the previous one, so memoise the formatted prefix.
+    // The cache is per thread, so no locking is needed.
+    thread_local time_t cached_time = 0;
+    thread_local char buf[30] = "";
+
     time_t time = static_cast<time_t>(ts.seconds);
-    struct tm time_tm;
-    localtime_r(&time, &time_tm);
-    char buf[30];
-    strftime(buf, 30u, "%Y-%m-%d %H:%M:%S", &time_tm);
+    if (time != cached_time || buf[0] == '\0') {
+        static bool const tz_initialised = []() { tzset(); return true; }();
+        (void) tz_initialised;
+        struct tm time_tm;
+        localtime_r(&time, &time_tm);
+        strftime(buf, 30u, "%Y-%m-%d %H:%M:%S", &time_tm);
+        cached_time = time;
+    }
     os << buf << "." << round((ts.seconds - floor(ts.seconds)) * 1000.0);
     return os;
 }
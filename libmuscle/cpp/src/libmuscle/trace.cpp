@@ -0,0 +1,207 @@
+#include <libmuscle/trace.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+
+
+namespace {
+
+using libmuscle::impl::ProfileEvent;
+using libmuscle::impl::ProfileEventType;
+
+/* One recorded span. Fixed size, so that the ring can be preallocated
+ * and recording an event doesn't allocate. */
+struct TraceRecord_ {
+    std::int64_t start_ns;          // UNIX epoch, see ProfileTimestamp
+    std::int64_t stop_ns;
+    std::uint32_t tid;              // hashed id of the recording thread
+    std::int32_t slot;              // -1 if the event has no slot
+    std::int32_t message_number;    // -1 if not known
+    ProfileEventType type;
+    char port[44];                  // truncated if it is very long
+};
+
+// the ring; allocated once when tracing is enabled and deliberately
+// leaked, so that it stays readable from the signal handler until the
+// process exits
+TraceRecord_ * ring_ = nullptr;
+std::size_t ring_size_ = 0u;
+// total number of events recorded; event n lives in slot
+// n % ring_size_, so the ring keeps the most recent ring_size_ events
+std::atomic<std::uint64_t> num_records_(0u);
+
+
+char const * event_type_name_(ProfileEventType type) {
+    switch (type) {
+        case ProfileEventType::register_: return "register";
+        case ProfileEventType::deregister: return "deregister";
+        case ProfileEventType::send: return "send";
+        case ProfileEventType::receive: return "receive";
+        case ProfileEventType::connect: return "connect";
+        case ProfileEventType::receive_wait: return "receive_wait";
+    }
+    return "unknown";
+}
+
+// signal-safe output helpers, as in instrumentation.cpp
+
+void write_str_(int fd, char const * str) {
+    std::size_t length = 0u;
+    while (str[length] != '\0')
+        ++length;
+    ::write(fd, str, length);
+}
+
+void write_uint_(int fd, std::uint64_t value) {
+    char buf[20];
+    int i = 20;
+    do {
+        buf[--i] = '0' + static_cast<char>(value % 10u);
+        value /= 10u;
+    } while (value > 0u);
+    ::write(fd, buf + i, 20 - i);
+}
+
+/* Writes nanoseconds as fractional microseconds, which is the unit the
+ * trace format uses for timestamps and durations. */
+void write_us_(int fd, std::int64_t ns) {
+    write_uint_(fd, static_cast<std::uint64_t>(ns / 1000));
+    char frac[4] = {
+            '.',
+            static_cast<char>('0' + ns / 100 % 10),
+            static_cast<char>('0' + ns / 10 % 10),
+            static_cast<char>('0' + ns % 10)};
+    ::write(fd, frac, 4);
+}
+
+void handle_signal_(int) {
+    // assemble muscle3_trace.<pid>.json by hand, snprintf is not
+    // async-signal-safe
+    char path[48];
+    std::size_t pos = 0u;
+    char const prefix[] = "muscle3_trace.";
+    for (std::size_t i = 0u; prefix[i] != '\0'; ++i)
+        path[pos++] = prefix[i];
+    std::uint64_t pid = static_cast<std::uint64_t>(::getpid());
+    char digits[20];
+    int i = 20;
+    do {
+        digits[--i] = '0' + static_cast<char>(pid % 10u);
+        pid /= 10u;
+    } while (pid > 0u);
+    for (; i < 20; ++i)
+        path[pos++] = digits[i];
+    char const suffix[] = ".json";
+    for (std::size_t j = 0u; suffix[j] != '\0'; ++j)
+        path[pos++] = suffix[j];
+    path[pos] = '\0';
+
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd != -1) {
+        libmuscle::impl::instrumentation::write_trace(fd);
+        ::close(fd);
+    }
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace instrumentation {
+
+bool tracing_enabled() {
+    static bool enabled = []() {
+        char const * trace = std::getenv("MUSCLE_TRACE");
+        if (trace == nullptr)
+            return false;
+        std::size_t size = 65536u;
+        int requested = std::atoi(trace);
+        if (requested > 0)
+            size = static_cast<std::size_t>(requested);
+        // deliberately leaked, see above
+        ring_ = new TraceRecord_[size]();
+        ring_size_ = size;
+        return true;
+    }();
+    return enabled;
+}
+
+void trace_event(ProfileEvent const & event) {
+    std::uint64_t n = num_records_.fetch_add(1u, std::memory_order_relaxed);
+    TraceRecord_ & rec = ring_[n % ring_size_];
+    rec.start_ns = event.start_time.nanoseconds;
+    rec.stop_ns = event.stop_time.nanoseconds;
+    rec.tid = static_cast<std::uint32_t>(
+            std::hash<std::thread::id>()(std::this_thread::get_id()));
+    rec.slot = event.slot.is_set() ? event.slot.get() : -1;
+    rec.message_number =
+        event.message_number.is_set() ? event.message_number.get() : -1;
+    rec.type = event.event_type;
+    if (event.port.is_set()) {
+        std::string name(static_cast<std::string>(event.port.get().name));
+        std::strncpy(rec.port, name.c_str(), sizeof(rec.port) - 1u);
+        rec.port[sizeof(rec.port) - 1u] = '\0';
+    }
+    else
+        rec.port[0] = '\0';
+}
+
+void write_trace(int fd) {
+    write_str_(fd, "{\"traceEvents\":[\n");
+
+    // if the ring wrapped, the oldest surviving event is the one the
+    // next record would overwrite
+    std::uint64_t total = num_records_.load(std::memory_order_acquire);
+    std::uint64_t count = (total < ring_size_) ? total : ring_size_;
+    for (std::uint64_t n = total - count; n < total; ++n) {
+        TraceRecord_ const & rec = ring_[n % ring_size_];
+        if (n != total - count)
+            write_str_(fd, ",\n");
+        write_str_(fd, "{\"name\":\"");
+        write_str_(fd, event_type_name_(rec.type));
+        write_str_(fd, "\",\"cat\":\"muscle3\",\"ph\":\"X\",\"ts\":");
+        write_us_(fd, rec.start_ns);
+        write_str_(fd, ",\"dur\":");
+        write_us_(fd, rec.stop_ns - rec.start_ns);
+        write_str_(fd, ",\"pid\":");
+        write_uint_(fd, static_cast<std::uint64_t>(::getpid()));
+        write_str_(fd, ",\"tid\":");
+        write_uint_(fd, rec.tid);
+        write_str_(fd, ",\"args\":{\"port\":\"");
+        write_str_(fd, rec.port);
+        write_str_(fd, "\"");
+        if (rec.slot >= 0) {
+            write_str_(fd, ",\"slot\":");
+            write_uint_(fd, static_cast<std::uint64_t>(rec.slot));
+        }
+        if (rec.message_number >= 0) {
+            write_str_(fd, ",\"message_number\":");
+            write_uint_(fd, static_cast<std::uint64_t>(rec.message_number));
+        }
+        write_str_(fd, "}}");
+    }
+
+    write_str_(fd, "\n]}\n");
+}
+
+void enable_trace_dump() {
+    if (!tracing_enabled())
+        return;
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = handle_signal_;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGUSR2, &action, nullptr);
+}
+
+} } }   // namespace libmuscle::impl::instrumentation
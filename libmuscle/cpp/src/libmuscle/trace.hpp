@@ -0,0 +1,56 @@
+#pragma once
+
+#include <libmuscle/profiling.hpp>
+
+
+namespace libmuscle { namespace impl { namespace instrumentation {
+
+/** Returns whether the flight recorder is enabled.
+ *
+ * The flight recorder keeps the most recent profiling events in a
+ * preallocated in-memory ring, and writes them out in the Chrome
+ * trace event format on demand, so that a run's coupling timeline can
+ * be loaded into chrome://tracing or Perfetto when chasing a latency
+ * spike. Unlike the profiler's reports to the manager, this is local
+ * to the process and event-complete: wait events are never sampled
+ * out.
+ *
+ * It is off by default; set MUSCLE_TRACE in the environment to enable
+ * it. A numeric value sets the capacity of the ring in events, which
+ * is 65536 otherwise.
+ */
+bool tracing_enabled();
+
+/** Records an event in the flight recorder's ring.
+ *
+ * Call only if tracing_enabled() returns true, and stop() the event
+ * first. Recording is lock-free and may be done from several threads
+ * at once; if the ring wraps, the oldest events are overwritten.
+ *
+ * @param event The event to record.
+ */
+void trace_event(ProfileEvent const & event);
+
+/** Writes the recorded events to the given file descriptor.
+ *
+ * The output is JSON in the Chrome trace event format, with one
+ * complete ("X") event per recorded span, oldest first. The port,
+ * slot and message number are attached as event arguments, so spans
+ * belonging to one message can be matched up across components.
+ *
+ * This is async-signal-safe: it uses only write() and does not
+ * allocate, so it may be called from a signal handler.
+ *
+ * @param fd The file descriptor to write to.
+ */
+void write_trace(int fd);
+
+/** Installs a SIGUSR2 handler that dumps the trace.
+ *
+ * On SIGUSR2, the recorded events are written to a file named
+ * muscle3_trace.<pid>.json in the working directory, overwriting any
+ * previous dump. Does nothing if tracing is not enabled.
+ */
+void enable_trace_dump();
+
+} } }   // namespace libmuscle::impl::instrumentation
@@ -0,0 +1,319 @@
+#include <libmuscle/tuning.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using std::chrono::steady_clock;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+
+
+namespace {
+
+// format version of the tuning cache file
+int const tuning_cache_version_ = 1;
+
+/* Results of the micro-probes, all in base units (ns, bytes/s).
+ */
+struct Probe_ {
+    std::uint64_t rtt_ns;
+    std::uint64_t memcpy_bw;
+    std::uint64_t stream_bw;
+};
+
+/* Returns the path of this host's tuning cache file.
+ */
+std::string cache_path_() {
+    char const * cache_dir = getenv("MUSCLE_AUTOTUNE");
+    if (cache_dir == nullptr)
+        return std::string();
+
+    char hostname[256];
+    if (gethostname(hostname, sizeof(hostname)) != 0)
+        return std::string();
+    hostname[sizeof(hostname) - 1u] = '\0';
+
+    std::string dir = (*cache_dir != '\0') ? cache_dir : ".";
+    return dir + "/muscle3_tuning." + hostname;
+}
+
+/* Reads the tuning cache file, if there is a usable one.
+ *
+ * @return true iff probe was filled from the cache.
+ */
+bool read_cache_(std::string const & path, Probe_ & probe) {
+    std::ifstream cache_file(path);
+    if (!cache_file)
+        return false;
+
+    std::string magic;
+    int version = 0;
+    cache_file >> magic >> version;
+    cache_file >> probe.rtt_ns >> probe.memcpy_bw >> probe.stream_bw;
+    if (!cache_file || magic != "muscle3_tuning" ||
+            version != tuning_cache_version_)
+        return false;
+    return (probe.rtt_ns > 0u) && (probe.memcpy_bw > 0u) &&
+            (probe.stream_bw > 0u);
+}
+
+/* Writes the tuning cache file, for other instances on this host.
+ */
+void write_cache_(std::string const & path, Probe_ const & probe) {
+    // write-then-rename, so a concurrent reader never sees a partial file;
+    // the pid keeps instances probing simultaneously out of each other's way
+    std::string tmp_path = path + "." + std::to_string(getpid()) + ".tmp";
+    std::ofstream cache_file(tmp_path, std::ios::trunc);
+    cache_file << "muscle3_tuning " << tuning_cache_version_ << "\n";
+    cache_file << probe.rtt_ns << " " << probe.memcpy_bw << " ";
+    cache_file << probe.stream_bw << "\n";
+    cache_file.close();
+    if (!cache_file) {
+        std::remove(tmp_path.c_str());
+        return;
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        std::remove(tmp_path.c_str());
+}
+
+/* Measures large-copy memory bandwidth, in bytes per second.
+ */
+std::uint64_t probe_memcpy_() {
+    std::size_t const size = 8u * 1024u * 1024u;
+    int const num_copies = 16;
+    std::vector<char> src(size, 1), dst(size);
+
+    memcpy(dst.data(), src.data(), size);   // warm up pages and caches
+    auto start = steady_clock::now();
+    for (int i = 0; i < num_copies; ++i) {
+        memcpy(dst.data(), src.data(), size);
+        // a data dependence between iterations, so that the copies
+        // cannot be coalesced away
+        src[0] = dst[size - 1u] + 1;
+    }
+    auto elapsed = duration_cast<nanoseconds>(
+            steady_clock::now() - start).count();
+    if (elapsed <= 0)
+        return 0u;
+    return static_cast<std::uint64_t>(size) * num_copies * 1000000000u
+            / elapsed;
+}
+
+/* Creates a pair of connected TCP sockets over loopback.
+ *
+ * @return true iff both fds were filled with open sockets.
+ */
+bool make_loopback_pair_(int & fd_a, int & fd_b) {
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener == -1)
+        return false;
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t addr_len = sizeof(addr);
+    if ((bind(listener, reinterpret_cast<sockaddr *>(&addr), addr_len) != 0)
+            || (listen(listener, 1) != 0)
+            || (getsockname(
+                    listener, reinterpret_cast<sockaddr *>(&addr),
+                    &addr_len) != 0)) {
+        ::close(listener);
+        return false;
+    }
+
+    fd_a = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd_a == -1) {
+        ::close(listener);
+        return false;
+    }
+    if (connect(fd_a, reinterpret_cast<sockaddr *>(&addr), addr_len) != 0) {
+        ::close(fd_a);
+        ::close(listener);
+        return false;
+    }
+    fd_b = accept(listener, nullptr, nullptr);
+    ::close(listener);
+    if (fd_b == -1) {
+        ::close(fd_a);
+        return false;
+    }
+
+    int flags = 1;
+    setsockopt(fd_a, SOL_TCP, TCP_NODELAY, &flags, sizeof(flags));
+    setsockopt(fd_b, SOL_TCP, TCP_NODELAY, &flags, sizeof(flags));
+    return true;
+}
+
+/* Measures loopback round-trip time and stream bandwidth.
+ *
+ * The round trip is a one-byte ping-pong, so it includes two sends and
+ * two receives like a real request does. The bandwidth is a bulk
+ * transfer with a concurrent reader, as when sending a large message.
+ *
+ * @return true iff both measurements succeeded.
+ */
+bool probe_loopback_(std::uint64_t & rtt_ns, std::uint64_t & stream_bw) {
+    int fd_a, fd_b;
+    if (!make_loopback_pair_(fd_a, fd_b))
+        return false;
+
+    bool ok = true;
+    char byte = 'x';
+    int const num_pings = 200;
+    auto start = steady_clock::now();
+    for (int i = 0; ok && (i < num_pings); ++i) {
+        ok = ok && (send(fd_a, &byte, 1u, 0) == 1);
+        ok = ok && (recv(fd_b, &byte, 1u, 0) == 1);
+        ok = ok && (send(fd_b, &byte, 1u, 0) == 1);
+        ok = ok && (recv(fd_a, &byte, 1u, 0) == 1);
+    }
+    auto elapsed = duration_cast<nanoseconds>(
+            steady_clock::now() - start).count();
+    if (ok && (elapsed > 0))
+        rtt_ns = elapsed / num_pings;
+    else
+        ok = false;
+
+    std::size_t const total = 64u * 1024u * 1024u;
+    std::size_t const chunk = 1024u * 1024u;
+    if (ok) {
+        std::thread reader([fd_b, total, chunk]() {
+                std::vector<char> buf(chunk);
+                std::size_t received = 0u;
+                while (received < total) {
+                    ssize_t result = recv(
+                            fd_b, buf.data(),
+                            std::min(chunk, total - received), 0);
+                    if (result <= 0)
+                        break;
+                    received += result;
+                }
+                });
+
+        std::vector<char> buf(chunk, 1);
+        start = steady_clock::now();
+        std::size_t sent = 0u;
+        while (ok && (sent < total)) {
+            ssize_t result = send(
+                    fd_a, buf.data(), std::min(chunk, total - sent), 0);
+            if (result <= 0)
+                ok = false;
+            else
+                sent += result;
+        }
+        reader.join();
+        elapsed = duration_cast<nanoseconds>(
+                steady_clock::now() - start).count();
+        if (ok && (elapsed > 0))
+            stream_bw = total * 1000000000u / elapsed;
+        else
+            ok = false;
+    }
+
+    ::close(fd_a);
+    ::close(fd_b);
+    return ok;
+}
+
+/* Sets an environment variable, unless the user already set it.
+ */
+void default_env_(char const * name, std::uint64_t value) {
+    if (getenv(name) == nullptr)
+        setenv(name, std::to_string(value).c_str(), 0);
+}
+
+}
+
+
+namespace libmuscle { namespace impl { namespace tuning {
+
+bool autotune_enabled() {
+    return getenv("MUSCLE_AUTOTUNE") != nullptr;
+}
+
+void apply_tuned_defaults(Logger & logger) {
+    if (!autotune_enabled())
+        return;
+
+    std::string path = cache_path_();
+    if (path.empty())
+        return;
+
+    Probe_ probe;
+    if (!read_cache_(path, probe)) {
+        if (!probe_loopback_(probe.rtt_ns, probe.stream_bw)) {
+            logger.warning(
+                    "Could not probe the host for transport tuning,"
+                    " using untuned defaults");
+            return;
+        }
+        probe.memcpy_bw = probe_memcpy_();
+        if (probe.memcpy_bw == 0u) {
+            logger.warning(
+                    "Could not probe the host for transport tuning,"
+                    " using untuned defaults");
+            return;
+        }
+        write_cache_(path, probe);
+    }
+
+    // The derivations below only apply when the user has not set the
+    // variable; an explicit setting always wins.
+
+    // spinning longer than a couple of round trips just burns the core
+    std::uint64_t spin_us = std::min(
+            std::max(2u * probe.rtt_ns / 1000u, std::uint64_t(1u)),
+            std::uint64_t(50u));
+    default_env_("MUSCLE_OUTBOX_SPIN_US", spin_us);
+
+    // a socket buffer of about two bandwidth-delay products keeps the
+    // stream busy without hoarding memory
+    std::uint64_t bufsize = std::min(
+            std::max(
+                2u * probe.stream_bw * probe.rtt_ns / 1000000000u,
+                std::uint64_t(64u) * 1024u),
+            std::uint64_t(16u) * 1024u * 1024u);
+    default_env_("MUSCLE_TCP_BUFSIZE", bufsize);
+
+    // if one stream moves data much slower than memory can, then
+    // per-stream overheads dominate and extra stripes recover the
+    // difference; loopback stands in for the fabric here, which is
+    // the best single-node proxy we have
+    std::uint64_t stripes = std::min(
+            probe.memcpy_bw / std::max(probe.stream_bw, std::uint64_t(1u)),
+            std::uint64_t(8u));
+    if (stripes > 1u)
+        default_env_("MUSCLE_TCP_STRIPES", stripes);
+
+    // striping pays off once a transfer is long enough for the stripe
+    // coordination not to matter; a couple of milliseconds of stream
+    // time, within the range the protocol supports
+    std::uint64_t threshold = std::min(
+            std::max(
+                probe.stream_bw / 500u,
+                std::uint64_t(1u) * 1024u * 1024u),
+            std::uint64_t(16u) * 1024u * 1024u);
+    default_env_("MUSCLE_TCP_STRIPE_THRESHOLD", threshold);
+
+    logger.info(
+            "Transport tuning: rtt ", probe.rtt_ns, " ns, memcpy ",
+            probe.memcpy_bw / 1000000u, " MB/s, stream ",
+            probe.stream_bw / 1000000u, " MB/s");
+}
+
+} } }
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <libmuscle/logger.hpp>
+
+
+namespace libmuscle { namespace impl { namespace tuning {
+
+/** Returns whether transport auto-tuning is enabled.
+ *
+ * Auto-tuning is enabled by setting MUSCLE_AUTOTUNE to a directory to
+ * keep the per-host probe results in. See apply_tuned_defaults().
+ */
+bool autotune_enabled();
+
+/** Measures the host and derives defaults for the transport tunables.
+ *
+ * The transport and PostOffice layers have several tunables whose best
+ * values depend on the machine: the TCP buffer size, the number of
+ * stripe connections and the size above which striping pays off, and
+ * the outbox spin window. They can each be set by hand through their
+ * environment variables, but the right values change with every
+ * hardware refresh.
+ *
+ * This runs a few micro-probes — loopback round-trip time, loopback
+ * stream bandwidth, and memcpy bandwidth — and sets the tunables that
+ * the user has not set themselves to values derived from the results.
+ * It must therefore run before the Communicator is created, which is
+ * when the tunables are first read. Probing takes on the order of a
+ * hundred milliseconds and is done once per host: results are kept in
+ * a file named after the host in the MUSCLE_AUTOTUNE directory, which
+ * instances on the same node share.
+ *
+ * Probing failures only cost the tuned defaults, so they are logged
+ * rather than raised.
+ *
+ * @param logger The logger to report what was applied to.
+ */
+void apply_tuned_defaults(Logger & logger);
+
+} } }
@@ -62,6 +62,15 @@ class Optional {
          */
         Optional(T const & t);
 
+        /** Create a non-nil optional, taking over the given value.
+         *
+         * As above, but moving the value in rather than copying it,
+         * which also works for types that can't be copied.
+         *
+         * @param t An object to move from
+         */
+        Optional(T && t);
+
         /** Copy an Optional.
          *
          * @param rhs The object to copy.
@@ -27,6 +27,13 @@ Optional<T>::Optional(T const & t)
     new (&t_) T(t);
 }
 
+template <typename T>
+Optional<T>::Optional(T && t)
+    : is_set_(true)
+{
+    new (&t_) T(std::move(t));
+}
+
 template <typename T>
 Optional<T>::Optional(Optional<T> const & rhs)
     : is_set_(rhs.is_set_)
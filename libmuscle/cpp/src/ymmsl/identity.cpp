@@ -1,8 +1,11 @@
 #include <algorithm>
 #include <iterator>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "ymmsl/identity.hpp"
 
@@ -130,31 +133,38 @@ bool ReferencePart::operator==(ReferencePart const & rhs) const {
 
 
 Reference::Reference(char const * content)
-    : parts_(string_to_parts_(content))
+    : Reference(std::string(content))
 {}
 
-Reference::Reference(std::string const & content)
-    : parts_(string_to_parts_(content))
-{}
+Reference::Reference(std::string const & content) {
+    intern_(content, parts_, hash_);
+}
 
 Reference::operator std::string() const {
-    return Reference::parts_to_string_(parts_);
+    return Reference::parts_to_string_(*parts_);
 }
 
 std::size_t Reference::length() const {
-    return parts_.size();
+    return parts_->size();
 }
 
 bool Reference::operator==(Reference const & rhs) const {
-    return std::equal(parts_.cbegin(), parts_.cend(), rhs.cbegin(), rhs.cend());
+    // interned references share their parts, so equal references made
+    // from the same string compare equal by pointer
+    if (parts_ == rhs.parts_)
+        return true;
+    if (hash_ != rhs.hash_)
+        return false;
+    return std::equal(
+            parts_->cbegin(), parts_->cend(), rhs.cbegin(), rhs.cend());
 }
 
 bool Reference::operator==(std::string const & rhs) const {
-    return parts_to_string_(parts_) == rhs;
+    return parts_to_string_(*parts_) == rhs;
 }
 
 bool Reference::operator==(char const * rhs) const {
-    return parts_to_string_(parts_) == std::string(rhs);
+    return parts_to_string_(*parts_) == std::string(rhs);
 }
 
 bool Reference::operator!=(Reference const & rhs) const {
@@ -170,62 +180,79 @@ bool Reference::operator!=(char const * rhs) const {
 }
 
 Reference::const_iterator Reference::cbegin() const {
-    return parts_.cbegin();
+    return parts_->cbegin();
 }
 
 Reference::const_iterator Reference::cend() const {
-    return parts_.cend();
+    return parts_->cend();
 }
 
 Reference::const_iterator Reference::begin() const {
-    return parts_.cbegin();
+    return parts_->cbegin();
 }
 
 Reference::const_iterator Reference::end() const {
-    return parts_.cend();
+    return parts_->cend();
 }
 
 ReferencePart const & Reference::operator[](int i) const {
-    return parts_[i];
+    return (*parts_)[i];
 }
 
 Reference const & Reference::operator+=(ReferencePart const & rhs) {
-    parts_.push_back(rhs);
+    // the parts may be shared with other references, so copy on write
+    std::vector<ReferencePart> new_parts;
+    new_parts.reserve(parts_->size() + 1u);
+    new_parts.assign(parts_->cbegin(), parts_->cend());
+    new_parts.push_back(rhs);
+    parts_ = std::make_shared<std::vector<ReferencePart>>(
+            std::move(new_parts));
+    hash_ = hash_parts_(*parts_);
     return *this;
 }
 
 Reference const & Reference::operator+=(std::vector<int> const & rhs) {
-    std::copy(rhs.cbegin(), rhs.cend(), std::back_inserter(parts_));
+    std::vector<ReferencePart> new_parts;
+    new_parts.reserve(parts_->size() + rhs.size());
+    new_parts.assign(parts_->cbegin(), parts_->cend());
+    std::copy(rhs.cbegin(), rhs.cend(), std::back_inserter(new_parts));
+    parts_ = std::make_shared<std::vector<ReferencePart>>(
+            std::move(new_parts));
+    hash_ = hash_parts_(*parts_);
     return *this;
 }
 
 Reference Reference::operator+(Reference const & rhs) const {
-    std::vector<ReferencePart> new_parts(parts_);
+    std::vector<ReferencePart> new_parts(*parts_);
     std::copy(rhs.cbegin(), rhs.cend(), std::back_inserter(new_parts));
     return Reference(std::move(new_parts));
 }
 
 Reference Reference::operator+(ReferencePart const & rhs) const {
-    std::vector<ReferencePart> new_parts(parts_);
+    std::vector<ReferencePart> new_parts(*parts_);
     new_parts.push_back(rhs);
     return Reference(std::move(new_parts));
 }
 
 Reference Reference::operator+(std::vector<int> const & rhs) const {
-    std::vector<ReferencePart> new_parts(parts_);
+    std::vector<ReferencePart> new_parts(*parts_);
     std::copy(rhs.cbegin(), rhs.cend(), std::back_inserter(new_parts));
     return Reference(std::move(new_parts));
 }
 
 std::ostream & operator<<(std::ostream & os, Reference const & r) {
-    return os << Reference::parts_to_string_(r.parts_);
+    return os << Reference::parts_to_string_(*r.parts_);
 }
 
 Reference::Reference(std::vector<ReferencePart> && parts)
-    : parts_(parts)
+    : parts_(std::make_shared<std::vector<ReferencePart>>(std::move(parts)))
+    , hash_(hash_parts_(*parts_))
 {}
 
 namespace {
+    // how many distinct reference strings we intern at most
+    std::size_t const max_interned_refs_ = 10000u;
+
     std::size_t find_next_op(std::string const & text, std::size_t start) {
         auto next_bracket = text.find('[', start);
         if (next_bracket == std::string::npos)
@@ -237,6 +264,54 @@ namespace {
     }
 }
 
+/* Looks up the parsed form of a reference string, parsing it if needed.
+ *
+ * The same reference strings come by again and again, so the parse
+ * results are kept in an interning table and shared between all
+ * References made from the same string. The hash is stored along with
+ * them, so it too is computed only once per distinct string.
+ *
+ * References get created from several threads, so the table is
+ * protected by a mutex; it is deliberately leaked so that it is still
+ * there if a Reference gets made during static destruction.
+ */
+void Reference::intern_(
+        std::string const & text, Parts_ & parts, std::size_t & hash) {
+    using Table_ = std::unordered_map<
+            std::string, std::pair<Parts_, std::size_t>>;
+    static std::mutex * mutex = new std::mutex();
+    static Table_ * table = new Table_();
+
+    {
+        std::lock_guard<std::mutex> lock(*mutex);
+        auto it = table->find(text);
+        if (it != table->end()) {
+            parts = it->second.first;
+            hash = it->second.second;
+            return;
+        }
+    }
+
+    parts = std::make_shared<std::vector<ReferencePart>>(
+            string_to_parts_(text));
+    hash = hash_parts_(*parts);
+
+    std::lock_guard<std::mutex> lock(*mutex);
+    if (table->size() < max_interned_refs_) {
+        // if another thread interned this string meanwhile, share its copy
+        auto res = table->emplace(text, std::make_pair(parts, hash));
+        parts = res.first->second.first;
+    }
+}
+
+std::size_t Reference::hash_parts_(std::vector<ReferencePart> const & parts) {
+    std::size_t res = 0ul;
+    for (auto const & part : parts)
+        res ^= std::hash<ReferencePart>()(part) + 0x9e3779b9
+                + (res << 6) + (res >> 2);
+    return res;
+}
+
 std::vector<ReferencePart> Reference::string_to_parts_(std::string const & text) {
     auto parts = std::vector<ReferencePart>();
     auto end = text.length();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -8,6 +9,7 @@
 
 namespace ymmsl { namespace impl {
     class Identifier;
+    class Reference;
 } }
 
 namespace std {
@@ -17,6 +19,8 @@ namespace std {
 
         std::size_t operator()(::ymmsl::impl::Identifier const &) const noexcept;
     };
+
+    template<> struct hash<::ymmsl::impl::Reference>;
 }
 
 
@@ -221,6 +225,12 @@ class ReferencePart {
  * try to change any of the elements. Instead, make a new Reference.
  * Especially References that are used as dictionary keys must not be
  * modified, this will get your dictionary in a very confused state.
+ *
+ * Since the same reference strings are parsed over and over on the
+ * communication path, parse results are interned: References made from
+ * equal strings share their parsed parts, and usually compare equal by
+ * pointer. The hash is computed once on construction, so using a
+ * Reference as a dictionary key is cheap.
  */
 class Reference {
     public:
@@ -260,6 +270,16 @@ class Reference {
         template <class ForwardIt>
         Reference(ForwardIt begin, ForwardIt end);
 
+        /** Create a Reference from a list of parts.
+         *
+         * The first part must be an Identifier. This takes ownership of
+         * the given list, so it is the cheapest way to build a
+         * Reference part by part.
+         *
+         * @param parts The parts of the Reference.
+         */
+        Reference(std::vector<ReferencePart> && parts);
+
         /** Conversion to std::string.
          *
          * @return The string representation of this Identifier.
@@ -390,10 +410,18 @@ class Reference {
 
     private:
         friend std::ostream & operator<<(std::ostream & os, Reference const & r);
+        friend struct ::std::hash<::ymmsl::impl::Reference>;
 
-        std::vector<ReferencePart> parts_;
+        // parsed parts, shared between interned copies; copied on write
+        using Parts_ = std::shared_ptr<std::vector<ReferencePart> const>;
 
-        Reference(std::vector<ReferencePart> && parts);
+        Parts_ parts_;
+        std::size_t hash_;
+
+        static void intern_(
+                std::string const & text, Parts_ & parts, std::size_t & hash);
+        static std::size_t hash_parts_(
+                std::vector<ReferencePart> const & parts);
         static std::vector<ReferencePart> string_to_parts_(
                 std::string const & text);
         static std::string parts_to_string_(
@@ -437,10 +465,7 @@ namespace std {
         typedef size_t result_type;
 
         result_type operator()(argument_type const & ref) const noexcept {
-            result_type res = 0ul;
-            for (auto const & part : ref)
-                res ^= hash<::ymmsl::impl::ReferencePart>()(part) + 0x9e3779b9 + (res << 6) + (res >> 2);
-            return res;
+            return ref.hash_;
         }
     };
 }
@@ -449,7 +474,8 @@ namespace ymmsl { namespace impl {
 
 template <class ForwardIt>
 Reference::Reference(ForwardIt begin, ForwardIt end)
-    : parts_(begin, end)
+    : parts_(std::make_shared<std::vector<ReferencePart>>(begin, end))
+    , hash_(hash_parts_(*parts_))
 {}
 
 } }
@@ -1,5 +1,7 @@
 #include <ymmsl/settings.hpp>
 
+#include <atomic>
+#include <memory>
 #include <typeinfo>
 #include <utility>
 
@@ -74,7 +76,7 @@ SettingValue::SettingValue(SettingValue const & other)
     copy_value_from_(other);
 }
 
-SettingValue::SettingValue(SettingValue && other)
+SettingValue::SettingValue(SettingValue && other) noexcept
     : type_(other.type_)
 {
     move_value_from_(std::move(other));
@@ -82,13 +84,56 @@ SettingValue::SettingValue(SettingValue && other)
 }
 
 SettingValue & SettingValue::operator=(SettingValue const & other) {
+    if (this == &other)
+        return *this;
+
+    if (type_ == other.type_) {
+        // assign into the active member, so that strings and lists can
+        // reuse any memory they already have allocated
+        switch (type_) {
+            case Type_::STRING:
+                string_value_ = other.string_value_;
+                return *this;
+            case Type_::LIST_FLOAT:
+                list_value_ = other.list_value_;
+                return *this;
+            case Type_::LIST_LIST_FLOAT:
+                list_list_value_ = other.list_list_value_;
+                return *this;
+            default:
+                break;
+        }
+    }
+
     deactivate_();
     copy_value_from_(other);
     type_ = other.type_;
     return *this;
 }
 
-SettingValue & SettingValue::operator=(SettingValue && other) {
+SettingValue & SettingValue::operator=(SettingValue && other) noexcept {
+    if (this == &other)
+        return *this;
+
+    if (type_ == other.type_) {
+        switch (type_) {
+            case Type_::STRING:
+                string_value_ = std::move(other.string_value_);
+                other.deactivate_();
+                return *this;
+            case Type_::LIST_FLOAT:
+                list_value_ = std::move(other.list_value_);
+                other.deactivate_();
+                return *this;
+            case Type_::LIST_LIST_FLOAT:
+                list_list_value_ = std::move(other.list_list_value_);
+                other.deactivate_();
+                return *this;
+            default:
+                break;
+        }
+    }
+
     deactivate_();
     move_value_from_(std::move(other));
     type_ = other.type_;
@@ -233,48 +278,73 @@ std::ostream & operator<<(std::ostream & os, ymmsl::impl::SettingValue const & v
 }
 
 
+namespace {
+
+// source of unique Settings generations, see Settings::generation()
+std::atomic<std::size_t> next_generation_(0u);
+
+}
+
+Settings::Settings()
+    : store_(std::make_shared<MapType_>())
+    , generation_(next_generation_++)
+{}
+
 bool Settings::operator==(Settings const & rhs) const {
-    return store_ == rhs.store_;
+    if (store_ == rhs.store_)
+        return true;
+    return *store_ == *rhs.store_;
 }
 
 bool Settings::operator!=(Settings const & rhs) const {
-    return store_ != rhs.store_;
+    return !(*this == rhs);
 }
 
 std::size_t Settings::size() const {
-    return store_.size();
+    return store_->size();
 }
 
 bool Settings::empty() const {
-    return store_.empty();
+    return store_->empty();
 }
 
 bool Settings::contains(Reference const & setting) const {
-    return store_.count(setting) != 0u;
+    return store_->count(setting) != 0u;
 }
 
 SettingValue const & Settings::at(Reference const & setting) const {
-    return store_.at(setting);
+    return store_->at(setting);
 }
 
 SettingValue & Settings::operator[](Reference const & setting) {
-    return store_[setting];
+    return rw_store_()[setting];
 }
 
 std::size_t Settings::erase(std::string const & setting) {
-    return store_.erase(Reference(setting));
+    return rw_store_().erase(Reference(setting));
 }
 
 void Settings::clear() {
-    store_.clear();
+    rw_store_().clear();
 }
 
 Settings::const_iterator Settings::begin() const {
-    return store_.cbegin();
+    return store_->cbegin();
 }
 
 Settings::const_iterator Settings::end() const {
-    return store_.cend();
+    return store_->cend();
+}
+
+std::size_t Settings::generation() const {
+    return generation_;
+}
+
+Settings::MapType_ & Settings::rw_store_() {
+    if (!store_.unique())
+        store_ = std::make_shared<MapType_>(*store_);
+    generation_ = next_generation_++;
+    return *store_;
 }
 
 std::ostream & operator<<(std::ostream & os, ymmsl::impl::Settings const & settings) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cinttypes>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -97,7 +98,7 @@ class SettingValue {
 
         /** Move-constructs a SettingValue.
          */
-        SettingValue(SettingValue && other);
+        SettingValue(SettingValue && other) noexcept;
 
         /** Copy-assigns a SettingValue.
          */
@@ -105,7 +106,7 @@ class SettingValue {
 
         /** Move-assigns a SettingValue.
          */
-        SettingValue & operator=(SettingValue && other);
+        SettingValue & operator=(SettingValue && other) noexcept;
 
         /** Destructs a SettingValue.
          */
@@ -196,6 +197,10 @@ class Settings {
         // No, not going to type-erase this.
         using const_iterator = MapType_::const_iterator;
 
+        /** Create an empty Settings object.
+         */
+        Settings();
+
         /** Compare Settings objects for equality.
          *
          * @return True iff the Settings are equal.
@@ -261,8 +266,28 @@ class Settings {
          */
         const_iterator end() const;
 
+        /** Return a number identifying the current contents.
+         *
+         * Generations are unique: if two Settings objects have the same
+         * generation, then they have equal contents, because one was
+         * copied from the other and neither was modified since. The
+         * converse does not hold, objects with equal contents may have
+         * different generations.
+         *
+         * Use this to cheaply detect modifications, e.g. to cache an
+         * expensive transformation of a Settings object that rarely
+         * changes.
+         */
+        std::size_t generation() const;
+
     private:
-        MapType_ store_;
+        // contents are shared between copies and detached when written
+        // to, so that copying Settings objects around is cheap
+        std::shared_ptr<MapType_> store_;
+        std::size_t generation_;
+
+        // get the store for writing, detaching it and marking it modified
+        MapType_ & rw_store_();
 };
 
 
@@ -138,6 +138,25 @@ TEST(ymmsl_identity, test_reference_equivalence) {
     ASSERT_NE("test1.test[3]", Reference("test.test[3]"));
 }
 
+TEST(ymmsl_identity, test_reference_interning) {
+    // references made from equal strings compare equal and hash equally
+    Reference ref1("macro.out[13]");
+    Reference ref2("macro.out[13]");
+    ASSERT_EQ(ref1, ref2);
+    ASSERT_EQ(
+            std::hash<Reference>()(ref1), std::hash<Reference>()(ref2));
+
+    // modifying a reference must not affect others made from the same
+    // string, and must keep the hash in sync
+    Reference ref3("macro.out");
+    Reference ref4("macro.out");
+    ref3 += 13;
+    ASSERT_EQ(ref3, ref1);
+    ASSERT_EQ(ref4, "macro.out");
+    ASSERT_EQ(
+            std::hash<Reference>()(ref3), std::hash<Reference>()(ref1));
+}
+
 TEST(ymmsl_identity, test_reference_concatenation) {
     ASSERT_EQ(Reference("test") + Reference("test2"), "test.test2");
     ASSERT_EQ(Reference("test") + Identifier("test2"), "test.test2");
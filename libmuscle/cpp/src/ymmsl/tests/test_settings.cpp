@@ -298,3 +298,31 @@ TEST(ymmsl_settings, test_iterate) {
     }
 }
 
+TEST(ymmsl_settings, test_copy_on_write) {
+    Settings s1;
+    s1["test"] = 13;
+
+    Settings s2(s1);
+    ASSERT_EQ(s2.at("test"), 13);
+
+    s2["test"] = 14;
+    ASSERT_EQ(s1.at("test"), 13);
+    ASSERT_EQ(s2.at("test"), 14);
+
+    s1.erase("test");
+    ASSERT_FALSE(s1.contains("test"));
+    ASSERT_EQ(s2.at("test"), 14);
+}
+
+TEST(ymmsl_settings, test_generation) {
+    Settings s1;
+    s1["test"] = 13;
+
+    Settings s2(s1);
+    ASSERT_EQ(s1.generation(), s2.generation());
+    ASSERT_EQ(s1, s2);
+
+    s2["test"] = 14;
+    ASSERT_NE(s1.generation(), s2.generation());
+}
+
@@ -112,6 +112,77 @@ module libmuscle_mpi
     public :: LIBMUSCLE_DataConstRef_create_grid_6_real8_n
     public :: LIBMUSCLE_DataConstRef_create_grid_7_real8_n
     public :: LIBMUSCLE_DataConstRef_create_grid
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_logical_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_logical_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_logical_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_logical_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_logical_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_logical_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_logical_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_int4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_int4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_int4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_int4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_int4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_int4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_int4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_int8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_int8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_int8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_int8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_int8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_int8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_int8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_real4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_real4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_real4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_real4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_real4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_real4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_real4_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_real8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_real8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_real8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_real8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_real8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_real8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_real8_a
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_logical_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_logical_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_logical_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_logical_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_logical_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_logical_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_logical_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_int4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_int4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_int4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_int4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_int4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_int4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_int4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_int8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_int8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_int8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_int8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_int8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_int8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_int8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_real4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_real4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_real4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_real4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_real4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_real4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_real4_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_1_real8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_2_real8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_3_real8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_4_real8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_5_real8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_6_real8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view_7_real8_n
+    public :: LIBMUSCLE_DataConstRef_create_grid_view
     public :: LIBMUSCLE_DataConstRef_free
     public :: LIBMUSCLE_DataConstRef_is_a_logical
     public :: LIBMUSCLE_DataConstRef_is_a_character
@@ -275,6 +346,77 @@ module libmuscle_mpi
     public :: LIBMUSCLE_Data_create_grid_6_real8_n
     public :: LIBMUSCLE_Data_create_grid_7_real8_n
     public :: LIBMUSCLE_Data_create_grid
+    public :: LIBMUSCLE_Data_create_grid_view_1_logical_a
+    public :: LIBMUSCLE_Data_create_grid_view_2_logical_a
+    public :: LIBMUSCLE_Data_create_grid_view_3_logical_a
+    public :: LIBMUSCLE_Data_create_grid_view_4_logical_a
+    public :: LIBMUSCLE_Data_create_grid_view_5_logical_a
+    public :: LIBMUSCLE_Data_create_grid_view_6_logical_a
+    public :: LIBMUSCLE_Data_create_grid_view_7_logical_a
+    public :: LIBMUSCLE_Data_create_grid_view_1_int4_a
+    public :: LIBMUSCLE_Data_create_grid_view_2_int4_a
+    public :: LIBMUSCLE_Data_create_grid_view_3_int4_a
+    public :: LIBMUSCLE_Data_create_grid_view_4_int4_a
+    public :: LIBMUSCLE_Data_create_grid_view_5_int4_a
+    public :: LIBMUSCLE_Data_create_grid_view_6_int4_a
+    public :: LIBMUSCLE_Data_create_grid_view_7_int4_a
+    public :: LIBMUSCLE_Data_create_grid_view_1_int8_a
+    public :: LIBMUSCLE_Data_create_grid_view_2_int8_a
+    public :: LIBMUSCLE_Data_create_grid_view_3_int8_a
+    public :: LIBMUSCLE_Data_create_grid_view_4_int8_a
+    public :: LIBMUSCLE_Data_create_grid_view_5_int8_a
+    public :: LIBMUSCLE_Data_create_grid_view_6_int8_a
+    public :: LIBMUSCLE_Data_create_grid_view_7_int8_a
+    public :: LIBMUSCLE_Data_create_grid_view_1_real4_a
+    public :: LIBMUSCLE_Data_create_grid_view_2_real4_a
+    public :: LIBMUSCLE_Data_create_grid_view_3_real4_a
+    public :: LIBMUSCLE_Data_create_grid_view_4_real4_a
+    public :: LIBMUSCLE_Data_create_grid_view_5_real4_a
+    public :: LIBMUSCLE_Data_create_grid_view_6_real4_a
+    public :: LIBMUSCLE_Data_create_grid_view_7_real4_a
+    public :: LIBMUSCLE_Data_create_grid_view_1_real8_a
+    public :: LIBMUSCLE_Data_create_grid_view_2_real8_a
+    public :: LIBMUSCLE_Data_create_grid_view_3_real8_a
+    public :: LIBMUSCLE_Data_create_grid_view_4_real8_a
+    public :: LIBMUSCLE_Data_create_grid_view_5_real8_a
+    public :: LIBMUSCLE_Data_create_grid_view_6_real8_a
+    public :: LIBMUSCLE_Data_create_grid_view_7_real8_a
+    public :: LIBMUSCLE_Data_create_grid_view_1_logical_n
+    public :: LIBMUSCLE_Data_create_grid_view_2_logical_n
+    public :: LIBMUSCLE_Data_create_grid_view_3_logical_n
+    public :: LIBMUSCLE_Data_create_grid_view_4_logical_n
+    public :: LIBMUSCLE_Data_create_grid_view_5_logical_n
+    public :: LIBMUSCLE_Data_create_grid_view_6_logical_n
+    public :: LIBMUSCLE_Data_create_grid_view_7_logical_n
+    public :: LIBMUSCLE_Data_create_grid_view_1_int4_n
+    public :: LIBMUSCLE_Data_create_grid_view_2_int4_n
+    public :: LIBMUSCLE_Data_create_grid_view_3_int4_n
+    public :: LIBMUSCLE_Data_create_grid_view_4_int4_n
+    public :: LIBMUSCLE_Data_create_grid_view_5_int4_n
+    public :: LIBMUSCLE_Data_create_grid_view_6_int4_n
+    public :: LIBMUSCLE_Data_create_grid_view_7_int4_n
+    public :: LIBMUSCLE_Data_create_grid_view_1_int8_n
+    public :: LIBMUSCLE_Data_create_grid_view_2_int8_n
+    public :: LIBMUSCLE_Data_create_grid_view_3_int8_n
+    public :: LIBMUSCLE_Data_create_grid_view_4_int8_n
+    public :: LIBMUSCLE_Data_create_grid_view_5_int8_n
+    public :: LIBMUSCLE_Data_create_grid_view_6_int8_n
+    public :: LIBMUSCLE_Data_create_grid_view_7_int8_n
+    public :: LIBMUSCLE_Data_create_grid_view_1_real4_n
+    public :: LIBMUSCLE_Data_create_grid_view_2_real4_n
+    public :: LIBMUSCLE_Data_create_grid_view_3_real4_n
+    public :: LIBMUSCLE_Data_create_grid_view_4_real4_n
+    public :: LIBMUSCLE_Data_create_grid_view_5_real4_n
+    public :: LIBMUSCLE_Data_create_grid_view_6_real4_n
+    public :: LIBMUSCLE_Data_create_grid_view_7_real4_n
+    public :: LIBMUSCLE_Data_create_grid_view_1_real8_n
+    public :: LIBMUSCLE_Data_create_grid_view_2_real8_n
+    public :: LIBMUSCLE_Data_create_grid_view_3_real8_n
+    public :: LIBMUSCLE_Data_create_grid_view_4_real8_n
+    public :: LIBMUSCLE_Data_create_grid_view_5_real8_n
+    public :: LIBMUSCLE_Data_create_grid_view_6_real8_n
+    public :: LIBMUSCLE_Data_create_grid_view_7_real8_n
+    public :: LIBMUSCLE_Data_create_grid_view
     public :: LIBMUSCLE_Data_free
     public :: LIBMUSCLE_Data_is_a_logical
     public :: LIBMUSCLE_Data_is_a_character
@@ -447,6 +589,7 @@ module libmuscle_mpi
     public :: LIBMUSCLE_Instance_is_setting_a_logical
     public :: LIBMUSCLE_Instance_is_setting_a_real8array
     public :: LIBMUSCLE_Instance_is_setting_a_real8array2
+    public :: LIBMUSCLE_Instance_get_settings
     public :: LIBMUSCLE_Instance_get_setting_as_character
     public :: LIBMUSCLE_Instance_get_setting_as_int8
     public :: LIBMUSCLE_Instance_get_setting_as_real8
@@ -459,14 +602,21 @@ module libmuscle_mpi
     public :: LIBMUSCLE_Instance_is_resizable
     public :: LIBMUSCLE_Instance_get_port_length
     public :: LIBMUSCLE_Instance_set_port_length
+    public :: LIBMUSCLE_Instance_port_handle
     public :: LIBMUSCLE_Instance_send_pm
     public :: LIBMUSCLE_Instance_send_pms
+    public :: LIBMUSCLE_Instance_send_hm
+    public :: LIBMUSCLE_Instance_send_hms
     public :: LIBMUSCLE_Instance_send
     public :: LIBMUSCLE_Instance_receive_p
     public :: LIBMUSCLE_Instance_receive_pd
+    public :: LIBMUSCLE_Instance_receive_h
+    public :: LIBMUSCLE_Instance_receive_hd
     public :: LIBMUSCLE_Instance_receive
     public :: LIBMUSCLE_Instance_receive_ps
     public :: LIBMUSCLE_Instance_receive_psd
+    public :: LIBMUSCLE_Instance_receive_hs
+    public :: LIBMUSCLE_Instance_receive_hsd
     public :: LIBMUSCLE_Instance_receive_on_slot
     public :: LIBMUSCLE_Instance_receive_with_settings_p
     public :: LIBMUSCLE_Instance_receive_with_settings_pd
@@ -837,6 +987,266 @@ module libmuscle_mpi
             integer (c_size_t), value, intent(in) :: index_name_7_size
         end function LIBMUSCLE_DataConstRef_create_grid_real8_n_
 
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_logical_a_")
+
+            use iso_c_binding
+            logical (c_bool), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_DataConstRef_create_grid_view_logical_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_int4_a_")
+
+            use iso_c_binding
+            integer (c_int32_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_DataConstRef_create_grid_view_int4_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_int8_a_")
+
+            use iso_c_binding
+            integer (c_int64_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_DataConstRef_create_grid_view_int8_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_real4_a_")
+
+            use iso_c_binding
+            real (c_float), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_DataConstRef_create_grid_view_real4_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_real8_a_")
+
+            use iso_c_binding
+            real (c_double), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_DataConstRef_create_grid_view_real8_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_logical_n_")
+
+            use iso_c_binding
+            logical (c_bool), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_DataConstRef_create_grid_view_logical_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_int4_n_")
+
+            use iso_c_binding
+            integer (c_int32_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_DataConstRef_create_grid_view_int4_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_int8_n_")
+
+            use iso_c_binding
+            integer (c_int64_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_DataConstRef_create_grid_view_int8_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_real4_n_")
+
+            use iso_c_binding
+            real (c_float), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_DataConstRef_create_grid_view_real4_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_DataConstRef_create_grid_view_real8_n_")
+
+            use iso_c_binding
+            real (c_double), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_DataConstRef_create_grid_view_real8_n_
+
         subroutine LIBMUSCLE_DataConstRef_free_(self) &
                 bind(C, name="LIBMUSCLE_DataConstRef_free_")
 
@@ -1214,10 +1624,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_DataConstRef_elements_logical_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -1225,10 +1634,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            logical (c_bool), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -1236,10 +1644,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_DataConstRef_elements_int4_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -1247,10 +1654,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            integer (c_int32_t), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -1258,10 +1664,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_DataConstRef_elements_int8_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -1269,10 +1674,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            integer (c_int64_t), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -1280,10 +1684,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_DataConstRef_elements_real4_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -1291,10 +1694,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            real (c_float), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -1302,10 +1704,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_DataConstRef_elements_real8_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -1313,10 +1714,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            real (c_double), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -1695,14 +2095,274 @@ module libmuscle_mpi
             integer (c_size_t), value, intent(in) :: index_name_7_size
         end function LIBMUSCLE_Data_create_grid_real8_n_
 
-        subroutine LIBMUSCLE_Data_free_(self) &
-                bind(C, name="LIBMUSCLE_Data_free_")
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_logical_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_logical_a_")
 
             use iso_c_binding
-            integer (c_intptr_t), value, intent(in) :: self
-        end subroutine LIBMUSCLE_Data_free_
+            logical (c_bool), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_Data_create_grid_view_logical_a_
 
-        logical (c_bool) function LIBMUSCLE_Data_is_a_logical_(self) &
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_int4_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_int4_a_")
+
+            use iso_c_binding
+            integer (c_int32_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_Data_create_grid_view_int4_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_int8_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_int8_a_")
+
+            use iso_c_binding
+            integer (c_int64_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_Data_create_grid_view_int8_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_real4_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_real4_a_")
+
+            use iso_c_binding
+            real (c_float), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_Data_create_grid_view_real4_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_real8_a_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_real8_a_")
+
+            use iso_c_binding
+            real (c_double), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+        end function LIBMUSCLE_Data_create_grid_view_real8_a_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_logical_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_logical_n_")
+
+            use iso_c_binding
+            logical (c_bool), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_Data_create_grid_view_logical_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_int4_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_int4_n_")
+
+            use iso_c_binding
+            integer (c_int32_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_Data_create_grid_view_int4_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_int8_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_int8_n_")
+
+            use iso_c_binding
+            integer (c_int64_t), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_Data_create_grid_view_int8_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_real4_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_real4_n_")
+
+            use iso_c_binding
+            real (c_float), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_Data_create_grid_view_real4_n_
+
+        integer (c_intptr_t) function LIBMUSCLE_Data_create_grid_view_real8_n_( &
+                data_array, &
+                data_array_shape, &
+                data_array_ndims, &
+                index_name_1, &
+                index_name_1_size, &
+                index_name_2, &
+                index_name_2_size, &
+                index_name_3, &
+                index_name_3_size, &
+                index_name_4, &
+                index_name_4_size, &
+                index_name_5, &
+                index_name_5_size, &
+                index_name_6, &
+                index_name_6_size, &
+                index_name_7, &
+                index_name_7_size) &
+                bind(C, name="LIBMUSCLE_Data_create_grid_view_real8_n_")
+
+            use iso_c_binding
+            real (c_double), dimension(*), intent(in) :: data_array
+            integer (c_size_t), dimension(1), intent(in) :: data_array_shape
+            integer (c_size_t), value, intent(in) :: data_array_ndims
+            character, intent(in) :: index_name_1
+            integer (c_size_t), value, intent(in) :: index_name_1_size
+            character, intent(in) :: index_name_2
+            integer (c_size_t), value, intent(in) :: index_name_2_size
+            character, intent(in) :: index_name_3
+            integer (c_size_t), value, intent(in) :: index_name_3_size
+            character, intent(in) :: index_name_4
+            integer (c_size_t), value, intent(in) :: index_name_4_size
+            character, intent(in) :: index_name_5
+            integer (c_size_t), value, intent(in) :: index_name_5_size
+            character, intent(in) :: index_name_6
+            integer (c_size_t), value, intent(in) :: index_name_6_size
+            character, intent(in) :: index_name_7
+            integer (c_size_t), value, intent(in) :: index_name_7_size
+        end function LIBMUSCLE_Data_create_grid_view_real8_n_
+
+        subroutine LIBMUSCLE_Data_free_(self) &
+                bind(C, name="LIBMUSCLE_Data_free_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+        end subroutine LIBMUSCLE_Data_free_
+
+        logical (c_bool) function LIBMUSCLE_Data_is_a_logical_(self) &
                 bind(C, name="LIBMUSCLE_Data_is_a_logical_")
 
             use iso_c_binding
@@ -2072,10 +2732,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_Data_elements_logical_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -2083,10 +2742,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            logical (c_bool), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -2094,10 +2752,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_Data_elements_int4_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -2105,10 +2762,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            integer (c_int32_t), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -2116,10 +2772,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_Data_elements_int8_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -2127,10 +2782,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            integer (c_int64_t), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -2138,10 +2792,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_Data_elements_real4_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -2149,10 +2802,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            real (c_float), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -2160,10 +2812,9 @@ module libmuscle_mpi
 
         subroutine LIBMUSCLE_Data_elements_real8_( &
                 self, &
-                ndims, &
-                ret_val, &
-                ret_val_shape, &
-                ret_val_format, &
+                target, &
+                target_shape, &
+                target_ndims, &
                 err_code, &
                 err_msg, &
                 err_msg_len) &
@@ -2171,10 +2822,9 @@ module libmuscle_mpi
 
             use iso_c_binding
             integer (c_intptr_t), value, intent(in) :: self
-            integer (c_size_t), value, intent(in) :: ndims
-            type (c_ptr), intent(out) :: ret_val
-            integer (c_size_t), dimension(1), intent(out) :: ret_val_shape
-            integer (c_int), intent(out) :: ret_val_format
+            real (c_double), dimension(*), intent(inout) :: target
+            integer (c_size_t), dimension(1), intent(in) :: target_shape
+            integer (c_size_t), value, intent(in) :: target_ndims
             integer (c_int), intent(out) :: err_code
             type (c_ptr), intent(out) :: err_msg
             integer (c_size_t), intent(out) :: err_msg_len
@@ -3128,6 +3778,13 @@ module libmuscle_mpi
             integer (c_size_t), intent(out) :: err_msg_len
         end function LIBMUSCLE_Instance_is_setting_a_real8array2_
 
+        integer (c_intptr_t) function LIBMUSCLE_Instance_get_settings_(self) &
+                bind(C, name="LIBMUSCLE_Instance_get_settings_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+        end function LIBMUSCLE_Instance_get_settings_
+
         subroutine LIBMUSCLE_Instance_get_setting_as_character_( &
                 self, &
                 name, &
@@ -3317,6 +3974,18 @@ module libmuscle_mpi
             integer (c_int), value, intent(in) :: length
         end subroutine LIBMUSCLE_Instance_set_port_length_
 
+        integer (c_int) function LIBMUSCLE_Instance_port_handle_( &
+                self, &
+                port_name, &
+                port_name_size) &
+                bind(C, name="LIBMUSCLE_Instance_port_handle_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+            character, intent(in) :: port_name
+            integer (c_size_t), value, intent(in) :: port_name_size
+        end function LIBMUSCLE_Instance_port_handle_
+
         subroutine LIBMUSCLE_Instance_send_pm_( &
                 self, &
                 port_name, &
@@ -3347,6 +4016,32 @@ module libmuscle_mpi
             integer (c_int), value, intent(in) :: slot
         end subroutine LIBMUSCLE_Instance_send_pms_
 
+        subroutine LIBMUSCLE_Instance_send_hm_( &
+                self, &
+                port_handle, &
+                message) &
+                bind(C, name="LIBMUSCLE_Instance_send_hm_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+            integer (c_int), value, intent(in) :: port_handle
+            integer (c_intptr_t), value, intent(in) :: message
+        end subroutine LIBMUSCLE_Instance_send_hm_
+
+        subroutine LIBMUSCLE_Instance_send_hms_( &
+                self, &
+                port_handle, &
+                message, &
+                slot) &
+                bind(C, name="LIBMUSCLE_Instance_send_hms_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+            integer (c_int), value, intent(in) :: port_handle
+            integer (c_intptr_t), value, intent(in) :: message
+            integer (c_int), value, intent(in) :: slot
+        end subroutine LIBMUSCLE_Instance_send_hms_
+
         integer (c_intptr_t) function LIBMUSCLE_Instance_receive_p_( &
                 self, &
                 port_name, &
@@ -3385,6 +4080,40 @@ module libmuscle_mpi
             integer (c_size_t), intent(out) :: err_msg_len
         end function LIBMUSCLE_Instance_receive_pd_
 
+        integer (c_intptr_t) function LIBMUSCLE_Instance_receive_h_( &
+                self, &
+                port_handle, &
+                err_code, &
+                err_msg, &
+                err_msg_len) &
+                bind(C, name="LIBMUSCLE_Instance_receive_h_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+            integer (c_int), value, intent(in) :: port_handle
+            integer (c_int), intent(out) :: err_code
+            type (c_ptr), intent(out) :: err_msg
+            integer (c_size_t), intent(out) :: err_msg_len
+        end function LIBMUSCLE_Instance_receive_h_
+
+        integer (c_intptr_t) function LIBMUSCLE_Instance_receive_hd_( &
+                self, &
+                port_handle, &
+                default_msg, &
+                err_code, &
+                err_msg, &
+                err_msg_len) &
+                bind(C, name="LIBMUSCLE_Instance_receive_hd_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+            integer (c_int), value, intent(in) :: port_handle
+            integer (c_intptr_t), value, intent(in) :: default_msg
+            integer (c_int), intent(out) :: err_code
+            type (c_ptr), intent(out) :: err_msg
+            integer (c_size_t), intent(out) :: err_msg_len
+        end function LIBMUSCLE_Instance_receive_hd_
+
         integer (c_intptr_t) function LIBMUSCLE_Instance_receive_ps_( &
                 self, &
                 port_name, &
@@ -3427,6 +4156,44 @@ module libmuscle_mpi
             integer (c_size_t), intent(out) :: err_msg_len
         end function LIBMUSCLE_Instance_receive_psd_
 
+        integer (c_intptr_t) function LIBMUSCLE_Instance_receive_hs_( &
+                self, &
+                port_handle, &
+                slot, &
+                err_code, &
+                err_msg, &
+                err_msg_len) &
+                bind(C, name="LIBMUSCLE_Instance_receive_hs_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+            integer (c_int), value, intent(in) :: port_handle
+            integer (c_int), value, intent(in) :: slot
+            integer (c_int), intent(out) :: err_code
+            type (c_ptr), intent(out) :: err_msg
+            integer (c_size_t), intent(out) :: err_msg_len
+        end function LIBMUSCLE_Instance_receive_hs_
+
+        integer (c_intptr_t) function LIBMUSCLE_Instance_receive_hsd_( &
+                self, &
+                port_handle, &
+                slot, &
+                default_message, &
+                err_code, &
+                err_msg, &
+                err_msg_len) &
+                bind(C, name="LIBMUSCLE_Instance_receive_hsd_")
+
+            use iso_c_binding
+            integer (c_intptr_t), value, intent(in) :: self
+            integer (c_int), value, intent(in) :: port_handle
+            integer (c_int), value, intent(in) :: slot
+            integer (c_intptr_t), value, intent(in) :: default_message
+            integer (c_int), intent(out) :: err_code
+            type (c_ptr), intent(out) :: err_msg
+            integer (c_size_t), intent(out) :: err_msg_len
+        end function LIBMUSCLE_Instance_receive_hsd_
+
         integer (c_intptr_t) function LIBMUSCLE_Instance_receive_with_settings_p_( &
                 self, &
                 port_name, &
@@ -3598,6 +4365,80 @@ module libmuscle_mpi
             LIBMUSCLE_DataConstRef_create_grid_7_real8_a
     end interface
 
+    interface LIBMUSCLE_DataConstRef_create_grid_view
+        module procedure &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_logical_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_logical_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_int4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_int4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_int8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_int8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_real4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_real4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_real8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_1_real8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_logical_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_logical_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_int4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_int4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_int8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_int8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_real4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_real4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_real8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_2_real8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_logical_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_logical_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_int4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_int4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_int8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_int8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_real4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_real4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_real8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_3_real8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_logical_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_logical_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_int4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_int4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_int8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_int8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_real4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_real4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_real8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_4_real8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_logical_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_logical_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_int4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_int4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_int8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_int8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_real4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_real4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_real8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_5_real8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_logical_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_logical_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_int4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_int4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_int8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_int8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_real4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_real4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_real8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_6_real8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_logical_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_logical_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_int4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_int4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_int8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_int8_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_real4_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_real4_a, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_real8_n, &
+            LIBMUSCLE_DataConstRef_create_grid_view_7_real8_a
+    end interface
+
     interface LIBMUSCLE_DataConstRef_get_item
         module procedure &
             LIBMUSCLE_DataConstRef_get_item_by_key, &
@@ -3732,6 +4573,80 @@ module libmuscle_mpi
             LIBMUSCLE_Data_create_grid_7_real8_a
     end interface
 
+    interface LIBMUSCLE_Data_create_grid_view
+        module procedure &
+            LIBMUSCLE_Data_create_grid_view_1_logical_n, &
+            LIBMUSCLE_Data_create_grid_view_1_logical_a, &
+            LIBMUSCLE_Data_create_grid_view_1_int4_n, &
+            LIBMUSCLE_Data_create_grid_view_1_int4_a, &
+            LIBMUSCLE_Data_create_grid_view_1_int8_n, &
+            LIBMUSCLE_Data_create_grid_view_1_int8_a, &
+            LIBMUSCLE_Data_create_grid_view_1_real4_n, &
+            LIBMUSCLE_Data_create_grid_view_1_real4_a, &
+            LIBMUSCLE_Data_create_grid_view_1_real8_n, &
+            LIBMUSCLE_Data_create_grid_view_1_real8_a, &
+            LIBMUSCLE_Data_create_grid_view_2_logical_n, &
+            LIBMUSCLE_Data_create_grid_view_2_logical_a, &
+            LIBMUSCLE_Data_create_grid_view_2_int4_n, &
+            LIBMUSCLE_Data_create_grid_view_2_int4_a, &
+            LIBMUSCLE_Data_create_grid_view_2_int8_n, &
+            LIBMUSCLE_Data_create_grid_view_2_int8_a, &
+            LIBMUSCLE_Data_create_grid_view_2_real4_n, &
+            LIBMUSCLE_Data_create_grid_view_2_real4_a, &
+            LIBMUSCLE_Data_create_grid_view_2_real8_n, &
+            LIBMUSCLE_Data_create_grid_view_2_real8_a, &
+            LIBMUSCLE_Data_create_grid_view_3_logical_n, &
+            LIBMUSCLE_Data_create_grid_view_3_logical_a, &
+            LIBMUSCLE_Data_create_grid_view_3_int4_n, &
+            LIBMUSCLE_Data_create_grid_view_3_int4_a, &
+            LIBMUSCLE_Data_create_grid_view_3_int8_n, &
+            LIBMUSCLE_Data_create_grid_view_3_int8_a, &
+            LIBMUSCLE_Data_create_grid_view_3_real4_n, &
+            LIBMUSCLE_Data_create_grid_view_3_real4_a, &
+            LIBMUSCLE_Data_create_grid_view_3_real8_n, &
+            LIBMUSCLE_Data_create_grid_view_3_real8_a, &
+            LIBMUSCLE_Data_create_grid_view_4_logical_n, &
+            LIBMUSCLE_Data_create_grid_view_4_logical_a, &
+            LIBMUSCLE_Data_create_grid_view_4_int4_n, &
+            LIBMUSCLE_Data_create_grid_view_4_int4_a, &
+            LIBMUSCLE_Data_create_grid_view_4_int8_n, &
+            LIBMUSCLE_Data_create_grid_view_4_int8_a, &
+            LIBMUSCLE_Data_create_grid_view_4_real4_n, &
+            LIBMUSCLE_Data_create_grid_view_4_real4_a, &
+            LIBMUSCLE_Data_create_grid_view_4_real8_n, &
+            LIBMUSCLE_Data_create_grid_view_4_real8_a, &
+            LIBMUSCLE_Data_create_grid_view_5_logical_n, &
+            LIBMUSCLE_Data_create_grid_view_5_logical_a, &
+            LIBMUSCLE_Data_create_grid_view_5_int4_n, &
+            LIBMUSCLE_Data_create_grid_view_5_int4_a, &
+            LIBMUSCLE_Data_create_grid_view_5_int8_n, &
+            LIBMUSCLE_Data_create_grid_view_5_int8_a, &
+            LIBMUSCLE_Data_create_grid_view_5_real4_n, &
+            LIBMUSCLE_Data_create_grid_view_5_real4_a, &
+            LIBMUSCLE_Data_create_grid_view_5_real8_n, &
+            LIBMUSCLE_Data_create_grid_view_5_real8_a, &
+            LIBMUSCLE_Data_create_grid_view_6_logical_n, &
+            LIBMUSCLE_Data_create_grid_view_6_logical_a, &
+            LIBMUSCLE_Data_create_grid_view_6_int4_n, &
+            LIBMUSCLE_Data_create_grid_view_6_int4_a, &
+            LIBMUSCLE_Data_create_grid_view_6_int8_n, &
+            LIBMUSCLE_Data_create_grid_view_6_int8_a, &
+            LIBMUSCLE_Data_create_grid_view_6_real4_n, &
+            LIBMUSCLE_Data_create_grid_view_6_real4_a, &
+            LIBMUSCLE_Data_create_grid_view_6_real8_n, &
+            LIBMUSCLE_Data_create_grid_view_6_real8_a, &
+            LIBMUSCLE_Data_create_grid_view_7_logical_n, &
+            LIBMUSCLE_Data_create_grid_view_7_logical_a, &
+            LIBMUSCLE_Data_create_grid_view_7_int4_n, &
+            LIBMUSCLE_Data_create_grid_view_7_int4_a, &
+            LIBMUSCLE_Data_create_grid_view_7_int8_n, &
+            LIBMUSCLE_Data_create_grid_view_7_int8_a, &
+            LIBMUSCLE_Data_create_grid_view_7_real4_n, &
+            LIBMUSCLE_Data_create_grid_view_7_real4_a, &
+            LIBMUSCLE_Data_create_grid_view_7_real8_n, &
+            LIBMUSCLE_Data_create_grid_view_7_real8_a
+    end interface
+
     interface LIBMUSCLE_Data_get_item
         module procedure &
             LIBMUSCLE_Data_get_item_by_key, &
@@ -3852,19 +4767,25 @@ module libmuscle_mpi
     interface LIBMUSCLE_Instance_send
         module procedure &
             LIBMUSCLE_Instance_send_pm, &
-            LIBMUSCLE_Instance_send_pms
+            LIBMUSCLE_Instance_send_pms, &
+            LIBMUSCLE_Instance_send_hm, &
+            LIBMUSCLE_Instance_send_hms
     end interface
 
     interface LIBMUSCLE_Instance_receive
         module procedure &
             LIBMUSCLE_Instance_receive_p, &
-            LIBMUSCLE_Instance_receive_pd
+            LIBMUSCLE_Instance_receive_pd, &
+            LIBMUSCLE_Instance_receive_h, &
+            LIBMUSCLE_Instance_receive_hd
     end interface
 
     interface LIBMUSCLE_Instance_receive_on_slot
         module procedure &
             LIBMUSCLE_Instance_receive_ps, &
-            LIBMUSCLE_Instance_receive_psd
+            LIBMUSCLE_Instance_receive_psd, &
+            LIBMUSCLE_Instance_receive_hs, &
+            LIBMUSCLE_Instance_receive_hsd
     end interface
 
     interface LIBMUSCLE_Instance_receive_with_settings
@@ -5714,3247 +6635,4864 @@ contains
         LIBMUSCLE_DataConstRef_create_grid_7_real8_n%ptr = ret_val
     end function LIBMUSCLE_DataConstRef_create_grid_7_real8_n
 
-    subroutine LIBMUSCLE_DataConstRef_free( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_logical_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_logical_a
 
-        call LIBMUSCLE_DataConstRef_free_( &
-            self%ptr)
-    end subroutine LIBMUSCLE_DataConstRef_free
+        integer (c_intptr_t) :: ret_val
 
-    function LIBMUSCLE_DataConstRef_is_a_logical( &
-            self)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 1_LIBMUSCLE_size)
+
+        LIBMUSCLE_DataConstRef_create_grid_view_1_logical_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_logical_a
+
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_logical_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_logical
+        logical, dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_logical_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_logical_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_logical = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_logical
+        LIBMUSCLE_DataConstRef_create_grid_view_2_logical_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_logical_a
 
-    function LIBMUSCLE_DataConstRef_is_a_character( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_logical_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_character
+        logical, dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_logical_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_character_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_character = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_character
+        LIBMUSCLE_DataConstRef_create_grid_view_3_logical_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_logical_a
 
-    function LIBMUSCLE_DataConstRef_is_a_int( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_logical_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_int
+        logical, dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_logical_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_int_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_int = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_int
+        LIBMUSCLE_DataConstRef_create_grid_view_4_logical_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_logical_a
 
-    function LIBMUSCLE_DataConstRef_is_a_int1( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_logical_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_int1
+        logical, dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_logical_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_int1_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_int1 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_int1
+        LIBMUSCLE_DataConstRef_create_grid_view_5_logical_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_logical_a
 
-    function LIBMUSCLE_DataConstRef_is_a_int2( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_logical_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_int2
+        logical, dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_logical_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_int2_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_int2 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_int2
+        LIBMUSCLE_DataConstRef_create_grid_view_6_logical_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_logical_a
 
-    function LIBMUSCLE_DataConstRef_is_a_int4( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_logical_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_int4
+        logical, dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_logical_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_int4_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_int4 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_7_logical_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_logical_a
 
-    function LIBMUSCLE_DataConstRef_is_a_int8( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_int4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_int8
+        integer (LIBMUSCLE_int4), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_int4_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_int8_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_int8 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_1_int4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_int4_a
 
-    function LIBMUSCLE_DataConstRef_is_a_real4( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_int4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_real4
+        integer (LIBMUSCLE_int4), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_int4_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_real4_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_real4 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_2_int4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_int4_a
 
-    function LIBMUSCLE_DataConstRef_is_a_real8( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_int4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_real8
+        integer (LIBMUSCLE_int4), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_int4_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_real8_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_real8 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_real8
+        LIBMUSCLE_DataConstRef_create_grid_view_3_int4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_int4_a
 
-    function LIBMUSCLE_DataConstRef_is_a_dict( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_int4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_dict
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_int4_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_dict_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_dict = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_dict
+        LIBMUSCLE_DataConstRef_create_grid_view_4_int4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_int4_a
 
-    function LIBMUSCLE_DataConstRef_is_a_list( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_int4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_list
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_int4_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_list_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_list = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_list
+        LIBMUSCLE_DataConstRef_create_grid_view_5_int4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_int4_a
 
-    function LIBMUSCLE_DataConstRef_is_a_grid_of_logical( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_int4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_logical
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_int4_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_logical_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_grid_of_logical = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_grid_of_logical
+        LIBMUSCLE_DataConstRef_create_grid_view_6_int4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_int4_a
 
-    function LIBMUSCLE_DataConstRef_is_a_grid_of_real4( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_int4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_real4
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_int4_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_real4_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_grid_of_real4 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_grid_of_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_7_int4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_int4_a
 
-    function LIBMUSCLE_DataConstRef_is_a_grid_of_real8( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_int8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_real8
+        integer (selected_int_kind(18)), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_int8_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_real8_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_grid_of_real8 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_grid_of_real8
+        LIBMUSCLE_DataConstRef_create_grid_view_1_int8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_int8_a
 
-    function LIBMUSCLE_DataConstRef_is_a_grid_of_int4( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_int8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_int4
+        integer (selected_int_kind(18)), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_int8_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_int4_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_grid_of_int4 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_grid_of_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_2_int8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_int8_a
 
-    function LIBMUSCLE_DataConstRef_is_a_grid_of_int8( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_int8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_int8
+        integer (selected_int_kind(18)), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_int8_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_int8_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_grid_of_int8 = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_grid_of_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_3_int8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_int8_a
 
-    function LIBMUSCLE_DataConstRef_is_a_byte_array( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_int8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_byte_array
+        integer (selected_int_kind(18)), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_int8_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_byte_array_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_byte_array = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_byte_array
+        LIBMUSCLE_DataConstRef_create_grid_view_4_int8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_int8_a
 
-    function LIBMUSCLE_DataConstRef_is_nil( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_int8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_nil
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_int8_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_nil_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_nil = ret_val
-    end function LIBMUSCLE_DataConstRef_is_nil
+        LIBMUSCLE_DataConstRef_create_grid_view_5_int8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_int8_a
 
-    function LIBMUSCLE_DataConstRef_is_a_settings( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_int8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical :: LIBMUSCLE_DataConstRef_is_a_settings
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_int8_a
 
-        logical (c_bool) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_is_a_settings_( &
-            self%ptr)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_is_a_settings = ret_val
-    end function LIBMUSCLE_DataConstRef_is_a_settings
+        LIBMUSCLE_DataConstRef_create_grid_view_6_int8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_int8_a
 
-    function LIBMUSCLE_DataConstRef_size( &
-            self)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_int8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_size) :: LIBMUSCLE_DataConstRef_size
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_int8_a
 
-        integer (c_size_t) :: ret_val
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_size_( &
-            self%ptr)
-        LIBMUSCLE_DataConstRef_size = ret_val
-    end function LIBMUSCLE_DataConstRef_size
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-    function LIBMUSCLE_DataConstRef_as_logical( &
-            self, &
-            err_code, &
-            err_msg)
+        LIBMUSCLE_DataConstRef_create_grid_view_7_int8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_int8_a
+
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_real4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        logical :: LIBMUSCLE_DataConstRef_as_logical
+        real (LIBMUSCLE_real4), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_real4_a
 
-        logical (c_bool) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_as_logical_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        LIBMUSCLE_DataConstRef_create_grid_view_1_real4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_real4_a
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_real4_a
 
-        LIBMUSCLE_DataConstRef_as_logical = ret_val
-    end function LIBMUSCLE_DataConstRef_as_logical
+        integer (c_intptr_t) :: ret_val
 
-    function LIBMUSCLE_DataConstRef_as_character( &
-            self, &
-            err_code, &
-            err_msg)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
+
+        LIBMUSCLE_DataConstRef_create_grid_view_2_real4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_real4_a
+
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_real4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        character(:), allocatable :: LIBMUSCLE_DataConstRef_as_character
+        real (LIBMUSCLE_real4), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_real4_a
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t) :: ret_val_size
-        character (c_char), dimension(:), pointer :: f_ret_ptr
-        integer :: i_loop
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_as_character_( &
-            self%ptr, &
-            ret_val, &
-            ret_val_size, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                allocate (character(0) :: LIBMUSCLE_DataConstRef_as_character)
+        LIBMUSCLE_DataConstRef_create_grid_view_3_real4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_real4_a
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_real4_a
 
-        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
-        allocate (character(ret_val_size) :: LIBMUSCLE_DataConstRef_as_character)
-        do i_loop = 1, ret_val_size
-            LIBMUSCLE_DataConstRef_as_character(i_loop:i_loop) = f_ret_ptr(i_loop)
-        end do
-    end function LIBMUSCLE_DataConstRef_as_character
+        integer (c_intptr_t) :: ret_val
 
-    function LIBMUSCLE_DataConstRef_as_int( &
-            self, &
-            err_code, &
-            err_msg)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
+
+        LIBMUSCLE_DataConstRef_create_grid_view_4_real4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_real4_a
+
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_real4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        integer :: LIBMUSCLE_DataConstRef_as_int
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_real4_a
 
-        integer (c_int) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_as_int_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
-
-        LIBMUSCLE_DataConstRef_as_int = ret_val
-    end function LIBMUSCLE_DataConstRef_as_int
+        LIBMUSCLE_DataConstRef_create_grid_view_5_real4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_real4_a
 
-    function LIBMUSCLE_DataConstRef_as_int1( &
-            self, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_real4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        integer (LIBMUSCLE_int1) :: LIBMUSCLE_DataConstRef_as_int1
-
-        integer (c_int8_t) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_real4_a
 
-        ret_val = LIBMUSCLE_DataConstRef_as_int1_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        integer (c_intptr_t) :: ret_val
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_as_int1 = ret_val
-    end function LIBMUSCLE_DataConstRef_as_int1
+        LIBMUSCLE_DataConstRef_create_grid_view_6_real4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_real4_a
 
-    function LIBMUSCLE_DataConstRef_as_int2( &
-            self, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_real4_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        integer (selected_int_kind(4)) :: LIBMUSCLE_DataConstRef_as_int2
-
-        integer (c_short) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_real4_a
 
-        ret_val = LIBMUSCLE_DataConstRef_as_int2_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        integer (c_intptr_t) :: ret_val
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_as_int2 = ret_val
-    end function LIBMUSCLE_DataConstRef_as_int2
+        LIBMUSCLE_DataConstRef_create_grid_view_7_real4_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_real4_a
 
-    function LIBMUSCLE_DataConstRef_as_int4( &
-            self, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_real8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        integer (LIBMUSCLE_int4) :: LIBMUSCLE_DataConstRef_as_int4
+        real (LIBMUSCLE_real8), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_real8_a
 
-        integer (c_int32_t) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_as_int4_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_1_real8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_real8_a
 
-        LIBMUSCLE_DataConstRef_as_int4 = ret_val
-    end function LIBMUSCLE_DataConstRef_as_int4
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_real8_a
 
-    function LIBMUSCLE_DataConstRef_as_int8( &
-            self, &
-            err_code, &
-            err_msg)
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
+
+        LIBMUSCLE_DataConstRef_create_grid_view_2_real8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_real8_a
+
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_real8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        integer (selected_int_kind(18)) :: LIBMUSCLE_DataConstRef_as_int8
+        real (LIBMUSCLE_real8), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_real8_a
 
-        integer (c_int64_t) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_as_int8_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_3_real8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_real8_a
 
-        LIBMUSCLE_DataConstRef_as_int8 = ret_val
-    end function LIBMUSCLE_DataConstRef_as_int8
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_real8_a
 
-    function LIBMUSCLE_DataConstRef_as_real4( &
-            self, &
-            err_code, &
-            err_msg)
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
+
+        LIBMUSCLE_DataConstRef_create_grid_view_4_real8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_real8_a
+
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_real8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        real (LIBMUSCLE_real4) :: LIBMUSCLE_DataConstRef_as_real4
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_real8_a
 
-        real (c_float) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_as_real4_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_as_real4 = ret_val
-    end function LIBMUSCLE_DataConstRef_as_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_5_real8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_real8_a
 
-    function LIBMUSCLE_DataConstRef_as_real8( &
-            self, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_real8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        real (LIBMUSCLE_real8) :: LIBMUSCLE_DataConstRef_as_real8
-
-        real (c_double) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_real8_a
 
-        ret_val = LIBMUSCLE_DataConstRef_as_real8_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        integer (c_intptr_t) :: ret_val
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_DataConstRef_as_real8 = ret_val
-    end function LIBMUSCLE_DataConstRef_as_real8
+        LIBMUSCLE_DataConstRef_create_grid_view_6_real8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_real8_a
 
-    function LIBMUSCLE_DataConstRef_as_settings( &
-            self, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_real8_a( &
+            data_array)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        type(YMMSL_Settings) :: LIBMUSCLE_DataConstRef_as_settings
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_real8_a
 
         integer (c_intptr_t) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
-
-        ret_val = LIBMUSCLE_DataConstRef_as_settings_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_7_real8_a%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_real8_a
 
-        LIBMUSCLE_DataConstRef_as_settings%ptr = ret_val
-    end function LIBMUSCLE_DataConstRef_as_settings
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_logical_n( &
+            data_array, &
+            index_name_1)
 
-    subroutine LIBMUSCLE_DataConstRef_as_byte_array( &
-            self, &
-            data, &
-            err_code, &
-            err_msg)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        character(len=1), dimension(:), intent(out) :: data
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t) :: ret_val_size
-        character(len=1), pointer, dimension(:) :: f_ret_ptr
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        logical, dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_logical_n
 
-        call LIBMUSCLE_DataConstRef_as_byte_array_( &
-            self%ptr, &
-            ret_val, &
-            ret_val_size, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_1_logical_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_logical_n
 
-        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
-        data = f_ret_ptr
-    end subroutine LIBMUSCLE_DataConstRef_as_byte_array
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
 
-    function LIBMUSCLE_DataConstRef_get_item_by_key( &
-            self, &
-            key, &
-            err_code, &
-            err_msg)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        character (len=*), intent(in) :: key
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_get_item_by_key
+        logical, dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_logical_n
 
         integer (c_intptr_t) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
 
-        ret_val = LIBMUSCLE_DataConstRef_get_item_by_key_( &
-            self%ptr, &
-            key, int(len(key), c_size_t), &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        LIBMUSCLE_DataConstRef_create_grid_view_2_logical_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_logical_n
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
-
-        LIBMUSCLE_DataConstRef_get_item_by_key%ptr = ret_val
-    end function LIBMUSCLE_DataConstRef_get_item_by_key
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
 
-    function LIBMUSCLE_DataConstRef_get_item_by_index( &
-            self, &
-            i, &
-            err_code, &
-            err_msg)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_size), intent(in) :: i
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_get_item_by_index
+        logical, dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_logical_n
 
         integer (c_intptr_t) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
-
-        ret_val = LIBMUSCLE_DataConstRef_get_item_by_index_( &
-            self%ptr, &
-            i, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_3_logical_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_logical_n
 
-        LIBMUSCLE_DataConstRef_get_item_by_index%ptr = ret_val
-    end function LIBMUSCLE_DataConstRef_get_item_by_index
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
-    function LIBMUSCLE_DataConstRef_num_dims( &
-            self, &
-            err_code, &
-            err_msg)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        integer (LIBMUSCLE_size) :: LIBMUSCLE_DataConstRef_num_dims
+        logical, dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_logical_n
 
-        integer (c_size_t) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_DataConstRef_num_dims_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_4_logical_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_logical_n
 
-        LIBMUSCLE_DataConstRef_num_dims = ret_val
-    end function LIBMUSCLE_DataConstRef_num_dims
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
-    subroutine LIBMUSCLE_DataConstRef_shape( &
-            self, &
-            shp, &
-            err_code, &
-            err_msg)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_size), dimension(:), intent(out) :: shp
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t) :: ret_val_size
-        integer (LIBMUSCLE_size), pointer, dimension(:) :: f_ret_ptr
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
-
-        call LIBMUSCLE_DataConstRef_shape_( &
-            self%ptr, &
-            ret_val, &
-            ret_val_size, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        logical, dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_logical_n
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        integer (c_intptr_t) :: ret_val
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
-        shp(1:ret_val_size) = f_ret_ptr
-    end subroutine LIBMUSCLE_DataConstRef_shape
+        LIBMUSCLE_DataConstRef_create_grid_view_5_logical_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_logical_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_1_logical( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical, dimension(:), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        logical, dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_logical_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
-
-        call LIBMUSCLE_DataConstRef_elements_logical_( &
-            self%ptr, &
-            1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_1_logical
+        LIBMUSCLE_DataConstRef_create_grid_view_6_logical_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_logical_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_2_logical( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical, dimension(:, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        logical, dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_logical_n
 
-        call LIBMUSCLE_DataConstRef_elements_logical_( &
-            self%ptr, &
-            2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_2_logical
+        LIBMUSCLE_DataConstRef_create_grid_view_7_logical_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_logical_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_3_logical( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_int4_n( &
+            data_array, &
+            index_name_1)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical, dimension(:, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (LIBMUSCLE_int4), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_int4_n
 
-        call LIBMUSCLE_DataConstRef_elements_logical_( &
-            self%ptr, &
-            3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_3_logical
+        LIBMUSCLE_DataConstRef_create_grid_view_1_int4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_int4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_4_logical( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical, dimension(:, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (LIBMUSCLE_int4), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_int4_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_logical_( &
-            self%ptr, &
-            4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_2_int4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_int4_n
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_4_logical
-
-    subroutine LIBMUSCLE_DataConstRef_elements_5_logical( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical, dimension(:, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (LIBMUSCLE_int4), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_int4_n
 
-        call LIBMUSCLE_DataConstRef_elements_logical_( &
-            self%ptr, &
-            5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_5_logical
+        LIBMUSCLE_DataConstRef_create_grid_view_3_int4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_int4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_6_logical( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical, dimension(:, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_int4_n
 
-        call LIBMUSCLE_DataConstRef_elements_logical_( &
-            self%ptr, &
-            6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_6_logical
+        LIBMUSCLE_DataConstRef_create_grid_view_4_int4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_int4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_7_logical( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        logical, dimension(:, :, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_int4_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_logical_( &
-            self%ptr, &
-            7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_5_int4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_int4_n
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_7_logical
-
-    subroutine LIBMUSCLE_DataConstRef_elements_1_int4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_int4), dimension(:), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_int4_n
 
-        call LIBMUSCLE_DataConstRef_elements_int4_( &
-            self%ptr, &
-            1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_1_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_6_int4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_int4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_2_int4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_int4), dimension(:, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_int4_n
 
-        call LIBMUSCLE_DataConstRef_elements_int4_( &
-            self%ptr, &
-            2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_2_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_7_int4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_int4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_3_int4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_int8_n( &
+            data_array, &
+            index_name_1)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_int4), dimension(:, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_int4_( &
-            self%ptr, &
-            3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_3_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_1_int8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_4_int4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_int4), dimension(:, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_int4_( &
-            self%ptr, &
-            4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_4_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_2_int8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_5_int4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_int4_( &
-            self%ptr, &
-            5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_5_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_3_int8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_6_int4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_int4_( &
-            self%ptr, &
-            6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_6_int4
+        LIBMUSCLE_DataConstRef_create_grid_view_4_int8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_7_int4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_int8_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_int4_( &
-            self%ptr, &
-            7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_5_int8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_int8_n
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_7_int4
-
-    subroutine LIBMUSCLE_DataConstRef_elements_1_int8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (selected_int_kind(18)), dimension(:), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_int8_( &
-            self%ptr, &
-            1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_1_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_6_int8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_2_int8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (selected_int_kind(18)), dimension(:, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_int8_( &
-            self%ptr, &
-            2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_2_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_7_int8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_3_int8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_real4_n( &
+            data_array, &
+            index_name_1)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (selected_int_kind(18)), dimension(:, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_real4_n
 
-        call LIBMUSCLE_DataConstRef_elements_int8_( &
-            self%ptr, &
-            3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_3_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_1_real4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_real4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_4_int8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (selected_int_kind(18)), dimension(:, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        real (LIBMUSCLE_real4), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_real4_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_int8_( &
-            self%ptr, &
-            4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
-
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_4_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_2_real4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_real4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_5_int8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (selected_int_kind(18)), dimension(:, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_real4_n
 
-        call LIBMUSCLE_DataConstRef_elements_int8_( &
-            self%ptr, &
-            5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_5_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_3_real4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_real4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_6_int8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_real4_n
 
-        call LIBMUSCLE_DataConstRef_elements_int8_( &
-            self%ptr, &
-            6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_6_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_4_real4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_real4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_7_int8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_real4_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_int8_( &
-            self%ptr, &
-            7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_7_int8
+        LIBMUSCLE_DataConstRef_create_grid_view_5_real4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_real4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_1_real4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real4), dimension(:), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_real4_n
 
-        call LIBMUSCLE_DataConstRef_elements_real4_( &
-            self%ptr, &
-            1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_1_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_6_real4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_real4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_2_real4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real4), dimension(:, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_real4_n
 
-        call LIBMUSCLE_DataConstRef_elements_real4_( &
-            self%ptr, &
-            2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_2_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_7_real4_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_real4_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_3_real4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_1_real8_n( &
+            data_array, &
+            index_name_1)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real4), dimension(:, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real8), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_1_real8_n
 
-        call LIBMUSCLE_DataConstRef_elements_real4_( &
-            self%ptr, &
-            3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_3_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_1_real8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_1_real8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_4_real4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_2_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real4), dimension(:, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real8), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_2_real8_n
 
-        call LIBMUSCLE_DataConstRef_elements_real4_( &
-            self%ptr, &
-            4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_4_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_2_real8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_2_real8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_5_real4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_3_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real4), dimension(:, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real8), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_3_real8_n
 
-        call LIBMUSCLE_DataConstRef_elements_real4_( &
-            self%ptr, &
-            5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_5_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_3_real8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_3_real8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_6_real4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_4_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real8), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_4_real8_n
 
-        call LIBMUSCLE_DataConstRef_elements_real4_( &
-            self%ptr, &
-            6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_6_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_4_real8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_4_real8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_7_real4( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_5_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_5_real8_n
 
-        call LIBMUSCLE_DataConstRef_elements_real4_( &
-            self%ptr, &
-            7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_7_real4
+        LIBMUSCLE_DataConstRef_create_grid_view_5_real8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_5_real8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_1_real8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_DataConstRef_create_grid_view_6_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real8), dimension(:), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_6_real8_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_real8_( &
-            self%ptr, &
-            1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_DataConstRef_create_grid_view_6_real8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_6_real8_n
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_1_real8
+    function LIBMUSCLE_DataConstRef_create_grid_view_7_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
-    subroutine LIBMUSCLE_DataConstRef_elements_2_real8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_create_grid_view_7_real8_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_create_grid_view_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
+
+        LIBMUSCLE_DataConstRef_create_grid_view_7_real8_n%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_create_grid_view_7_real8_n
 
+    subroutine LIBMUSCLE_DataConstRef_free( &
+            self)
         implicit none
         type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real8), dimension(:, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        call LIBMUSCLE_DataConstRef_free_( &
+            self%ptr)
+    end subroutine LIBMUSCLE_DataConstRef_free
 
-        call LIBMUSCLE_DataConstRef_elements_real8_( &
-            self%ptr, &
-            2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+    function LIBMUSCLE_DataConstRef_is_a_logical( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_logical
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        logical (c_bool) :: ret_val
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_2_real8
+        ret_val = LIBMUSCLE_DataConstRef_is_a_logical_( &
+            self%ptr)
 
-    subroutine LIBMUSCLE_DataConstRef_elements_3_real8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+        LIBMUSCLE_DataConstRef_is_a_logical = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_logical
 
+    function LIBMUSCLE_DataConstRef_is_a_character( &
+            self)
         implicit none
         type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real8), dimension(:, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        logical :: LIBMUSCLE_DataConstRef_is_a_character
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        logical (c_bool) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_real8_( &
-            self%ptr, &
-            3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_DataConstRef_is_a_character_( &
+            self%ptr)
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
+        LIBMUSCLE_DataConstRef_is_a_character = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_character
+
+    function LIBMUSCLE_DataConstRef_is_a_int( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_int
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_int_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_int = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_int
+
+    function LIBMUSCLE_DataConstRef_is_a_int1( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_int1
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_int1_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_int1 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_int1
+
+    function LIBMUSCLE_DataConstRef_is_a_int2( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_int2
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_int2_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_int2 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_int2
+
+    function LIBMUSCLE_DataConstRef_is_a_int4( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_int4
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_int4_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_int4 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_int4
+
+    function LIBMUSCLE_DataConstRef_is_a_int8( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_int8
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_int8_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_int8 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_int8
+
+    function LIBMUSCLE_DataConstRef_is_a_real4( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_real4
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_real4_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_real4 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_real4
+
+    function LIBMUSCLE_DataConstRef_is_a_real8( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_real8
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_real8_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_real8 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_real8
+
+    function LIBMUSCLE_DataConstRef_is_a_dict( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_dict
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_dict_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_dict = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_dict
+
+    function LIBMUSCLE_DataConstRef_is_a_list( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_list
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_list_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_list = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_list
+
+    function LIBMUSCLE_DataConstRef_is_a_grid_of_logical( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_logical
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_logical_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_grid_of_logical = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_grid_of_logical
+
+    function LIBMUSCLE_DataConstRef_is_a_grid_of_real4( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_real4
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_real4_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_grid_of_real4 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_grid_of_real4
+
+    function LIBMUSCLE_DataConstRef_is_a_grid_of_real8( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_real8
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_real8_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_grid_of_real8 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_grid_of_real8
+
+    function LIBMUSCLE_DataConstRef_is_a_grid_of_int4( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_int4
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_int4_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_grid_of_int4 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_grid_of_int4
+
+    function LIBMUSCLE_DataConstRef_is_a_grid_of_int8( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_grid_of_int8
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_grid_of_int8_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_grid_of_int8 = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_grid_of_int8
+
+    function LIBMUSCLE_DataConstRef_is_a_byte_array( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_byte_array
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_byte_array_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_byte_array = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_byte_array
+
+    function LIBMUSCLE_DataConstRef_is_nil( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_nil
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_nil_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_nil = ret_val
+    end function LIBMUSCLE_DataConstRef_is_nil
+
+    function LIBMUSCLE_DataConstRef_is_a_settings( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical :: LIBMUSCLE_DataConstRef_is_a_settings
+
+        logical (c_bool) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_is_a_settings_( &
+            self%ptr)
+
+        LIBMUSCLE_DataConstRef_is_a_settings = ret_val
+    end function LIBMUSCLE_DataConstRef_is_a_settings
+
+    function LIBMUSCLE_DataConstRef_size( &
+            self)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_size) :: LIBMUSCLE_DataConstRef_size
+
+        integer (c_size_t) :: ret_val
+
+        ret_val = LIBMUSCLE_DataConstRef_size_( &
+            self%ptr)
+        LIBMUSCLE_DataConstRef_size = ret_val
+    end function LIBMUSCLE_DataConstRef_size
+
+    function LIBMUSCLE_DataConstRef_as_logical( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        logical :: LIBMUSCLE_DataConstRef_as_logical
+
+        logical (c_bool) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_logical_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_logical = ret_val
+    end function LIBMUSCLE_DataConstRef_as_logical
+
+    function LIBMUSCLE_DataConstRef_as_character( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        character(:), allocatable :: LIBMUSCLE_DataConstRef_as_character
+
+        type (c_ptr) :: ret_val
+        integer (c_size_t) :: ret_val_size
+        character (c_char), dimension(:), pointer :: f_ret_ptr
+        integer :: i_loop
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_as_character_( &
+            self%ptr, &
+            ret_val, &
+            ret_val_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                allocate (character(0) :: LIBMUSCLE_DataConstRef_as_character)
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
+        allocate (character(ret_val_size) :: LIBMUSCLE_DataConstRef_as_character)
+        do i_loop = 1, ret_val_size
+            LIBMUSCLE_DataConstRef_as_character(i_loop:i_loop) = f_ret_ptr(i_loop)
+        end do
+    end function LIBMUSCLE_DataConstRef_as_character
+
+    function LIBMUSCLE_DataConstRef_as_int( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        integer :: LIBMUSCLE_DataConstRef_as_int
+
+        integer (c_int) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_int_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_int = ret_val
+    end function LIBMUSCLE_DataConstRef_as_int
+
+    function LIBMUSCLE_DataConstRef_as_int1( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (LIBMUSCLE_int1) :: LIBMUSCLE_DataConstRef_as_int1
+
+        integer (c_int8_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_int1_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_int1 = ret_val
+    end function LIBMUSCLE_DataConstRef_as_int1
+
+    function LIBMUSCLE_DataConstRef_as_int2( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (selected_int_kind(4)) :: LIBMUSCLE_DataConstRef_as_int2
+
+        integer (c_short) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_int2_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_int2 = ret_val
+    end function LIBMUSCLE_DataConstRef_as_int2
+
+    function LIBMUSCLE_DataConstRef_as_int4( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (LIBMUSCLE_int4) :: LIBMUSCLE_DataConstRef_as_int4
+
+        integer (c_int32_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_int4_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_int4 = ret_val
+    end function LIBMUSCLE_DataConstRef_as_int4
+
+    function LIBMUSCLE_DataConstRef_as_int8( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (selected_int_kind(18)) :: LIBMUSCLE_DataConstRef_as_int8
+
+        integer (c_int64_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_int8_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_int8 = ret_val
+    end function LIBMUSCLE_DataConstRef_as_int8
+
+    function LIBMUSCLE_DataConstRef_as_real4( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        real (LIBMUSCLE_real4) :: LIBMUSCLE_DataConstRef_as_real4
+
+        real (c_float) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_real4_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_real4 = ret_val
+    end function LIBMUSCLE_DataConstRef_as_real4
+
+    function LIBMUSCLE_DataConstRef_as_real8( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        real (LIBMUSCLE_real8) :: LIBMUSCLE_DataConstRef_as_real8
+
+        real (c_double) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_real8_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_real8 = ret_val
+    end function LIBMUSCLE_DataConstRef_as_real8
+
+    function LIBMUSCLE_DataConstRef_as_settings( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        type(YMMSL_Settings) :: LIBMUSCLE_DataConstRef_as_settings
+
+        integer (c_intptr_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_as_settings_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_as_settings%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_as_settings
+
+    subroutine LIBMUSCLE_DataConstRef_as_byte_array( &
+            self, &
+            data, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        character(len=1), dimension(:), intent(out) :: data
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        type (c_ptr) :: ret_val
+        integer (c_size_t) :: ret_val_size
+        character(len=1), pointer, dimension(:) :: f_ret_ptr
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_as_byte_array_( &
+            self%ptr, &
+            ret_val, &
+            ret_val_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
+        data = f_ret_ptr
+    end subroutine LIBMUSCLE_DataConstRef_as_byte_array
+
+    function LIBMUSCLE_DataConstRef_get_item_by_key( &
+            self, &
+            key, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        character (len=*), intent(in) :: key
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_get_item_by_key
+
+        integer (c_intptr_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_get_item_by_key_( &
+            self%ptr, &
+            key, int(len(key), c_size_t), &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_get_item_by_key%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_get_item_by_key
+
+    function LIBMUSCLE_DataConstRef_get_item_by_index( &
+            self, &
+            i, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_size), intent(in) :: i
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        type(LIBMUSCLE_DataConstRef) :: LIBMUSCLE_DataConstRef_get_item_by_index
+
+        integer (c_intptr_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_get_item_by_index_( &
+            self%ptr, &
+            i, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_get_item_by_index%ptr = ret_val
+    end function LIBMUSCLE_DataConstRef_get_item_by_index
+
+    function LIBMUSCLE_DataConstRef_num_dims( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (LIBMUSCLE_size) :: LIBMUSCLE_DataConstRef_num_dims
+
+        integer (c_size_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_num_dims_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_num_dims = ret_val
+    end function LIBMUSCLE_DataConstRef_num_dims
+
+    subroutine LIBMUSCLE_DataConstRef_shape( &
+            self, &
+            shp, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_size), dimension(:), intent(out) :: shp
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        type (c_ptr) :: ret_val
+        integer (c_size_t) :: ret_val_size
+        integer (LIBMUSCLE_size), pointer, dimension(:) :: f_ret_ptr
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_shape_( &
+            self%ptr, &
+            ret_val, &
+            ret_val_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
+        shp(1:ret_val_size) = f_ret_ptr
+    end subroutine LIBMUSCLE_DataConstRef_shape
+
+    subroutine LIBMUSCLE_DataConstRef_elements_1_logical( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        logical (c_bool), allocatable, dimension(:) :: buf_elements
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        allocate (buf_elements( &
+                size(elements, 1)))
+
+        call LIBMUSCLE_DataConstRef_elements_logical_( &
+            self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
+            1_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        elements = buf_elements
+    end subroutine LIBMUSCLE_DataConstRef_elements_1_logical
+
+    subroutine LIBMUSCLE_DataConstRef_elements_2_logical( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        logical (c_bool), allocatable, dimension(:, :) :: buf_elements
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2)))
+
+        call LIBMUSCLE_DataConstRef_elements_logical_( &
+            self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
+            2_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        elements = buf_elements
+    end subroutine LIBMUSCLE_DataConstRef_elements_2_logical
+
+    subroutine LIBMUSCLE_DataConstRef_elements_3_logical( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        logical (c_bool), allocatable, dimension(:, :, :) :: buf_elements
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3)))
+
+        call LIBMUSCLE_DataConstRef_elements_logical_( &
+            self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
+            3_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        elements = buf_elements
+    end subroutine LIBMUSCLE_DataConstRef_elements_3_logical
+
+    subroutine LIBMUSCLE_DataConstRef_elements_4_logical( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        logical (c_bool), allocatable, dimension(:, :, :, :) :: buf_elements
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4)))
+
+        call LIBMUSCLE_DataConstRef_elements_logical_( &
+            self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
+            4_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        elements = buf_elements
+    end subroutine LIBMUSCLE_DataConstRef_elements_4_logical
+
+    subroutine LIBMUSCLE_DataConstRef_elements_5_logical( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        logical (c_bool), allocatable, dimension(:, :, :, :, :) :: buf_elements
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4), &
+                size(elements, 5)))
+
+        call LIBMUSCLE_DataConstRef_elements_logical_( &
+            self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
+            5_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        elements = buf_elements
+    end subroutine LIBMUSCLE_DataConstRef_elements_5_logical
+
+    subroutine LIBMUSCLE_DataConstRef_elements_6_logical( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        logical (c_bool), allocatable, dimension(:, :, :, :, :, :) :: buf_elements
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4), &
+                size(elements, 5), &
+                size(elements, 6)))
+
+        call LIBMUSCLE_DataConstRef_elements_logical_( &
+            self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
+            6_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        elements = buf_elements
+    end subroutine LIBMUSCLE_DataConstRef_elements_6_logical
+
+    subroutine LIBMUSCLE_DataConstRef_elements_7_logical( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        logical, dimension(:, :, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        logical (c_bool), allocatable, dimension(:, :, :, :, :, :, :) :: buf_elements
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4), &
+                size(elements, 5), &
+                size(elements, 6), &
+                size(elements, 7)))
+
+        call LIBMUSCLE_DataConstRef_elements_logical_( &
+            self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
+            7_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        elements = buf_elements
+    end subroutine LIBMUSCLE_DataConstRef_elements_7_logical
+
+    subroutine LIBMUSCLE_DataConstRef_elements_1_int4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_int4), dimension(:), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            1_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_1_int4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_2_int4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_int4), dimension(:, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            2_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_2_int4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_3_int4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_int4), dimension(:, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            3_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_3_int4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_4_int4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            4_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_4_int4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_5_int4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            5_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_5_int4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_6_int4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            6_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_6_int4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_7_int4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            7_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_7_int4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_1_int8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (selected_int_kind(18)), dimension(:), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            1_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_1_int8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_2_int8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (selected_int_kind(18)), dimension(:, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            2_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_2_int8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_3_int8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (selected_int_kind(18)), dimension(:, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            3_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_3_int8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_4_int8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (selected_int_kind(18)), dimension(:, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            4_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_4_int8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_5_int8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            5_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_5_int8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_6_int8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            6_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_6_int8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_7_int8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_int8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            7_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_7_int8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_1_real4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real4), dimension(:), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            1_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_1_real4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_2_real4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real4), dimension(:, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            2_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_2_real4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_3_real4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real4), dimension(:, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            3_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_3_real4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_4_real4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real4), dimension(:, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            4_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_4_real4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_5_real4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            5_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_5_real4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_6_real4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            6_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_6_real4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_7_real4( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real4_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            7_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_7_real4
+
+    subroutine LIBMUSCLE_DataConstRef_elements_1_real8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real8), dimension(:), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            1_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_1_real8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_2_real8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real8), dimension(:, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            2_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_2_real8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_3_real8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real8), dimension(:, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            3_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_3_real8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_4_real8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real8), dimension(:, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            4_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_4_real8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_5_real8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            5_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_5_real8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_6_real8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            6_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_6_real8
+
+    subroutine LIBMUSCLE_DataConstRef_elements_7_real8( &
+            self, &
+            elements, &
+            err_code, &
+            err_msg)
+
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :, :), intent(out) :: elements
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_elements_real8_( &
+            self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
+            7_LIBMUSCLE_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+    end subroutine LIBMUSCLE_DataConstRef_elements_7_real8
+
+    function LIBMUSCLE_DataConstRef_has_indexes( &
+            self, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        logical :: LIBMUSCLE_DataConstRef_has_indexes
+
+        logical (c_bool) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_DataConstRef_has_indexes_( &
+            self%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_DataConstRef_has_indexes = ret_val
+    end function LIBMUSCLE_DataConstRef_has_indexes
+
+    function LIBMUSCLE_DataConstRef_index( &
+            self, &
+            i, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_DataConstRef), intent(in) :: self
+        integer (LIBMUSCLE_size), intent(in) :: i
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        character(:), allocatable :: LIBMUSCLE_DataConstRef_index
+
+        type (c_ptr) :: ret_val
+        integer (c_size_t) :: ret_val_size
+        character (c_char), dimension(:), pointer :: f_ret_ptr
+        integer :: i_loop
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        call LIBMUSCLE_DataConstRef_index_( &
+            self%ptr, &
+            i, &
+            ret_val, &
+            ret_val_size, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+                allocate (character(0) :: LIBMUSCLE_DataConstRef_index)
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
             end if
         else
             if (present(err_code)) then
@@ -8962,1067 +11500,2313 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_3_real8
+        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
+        allocate (character(ret_val_size) :: LIBMUSCLE_DataConstRef_index)
+        do i_loop = 1, ret_val_size
+            LIBMUSCLE_DataConstRef_index(i_loop:i_loop) = f_ret_ptr(i_loop)
+        end do
+    end function LIBMUSCLE_DataConstRef_index
+
+    function LIBMUSCLE_Data_create_nil( &
+    )
+        implicit none
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_nil
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_nil_( &
+    )
+
+        LIBMUSCLE_Data_create_nil%ptr = ret_val
+    end function LIBMUSCLE_Data_create_nil
+
+    function LIBMUSCLE_Data_create_logical( &
+            value)
+        implicit none
+        logical, intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_logical
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_logical_( &
+            logical(value, c_bool))
+
+        LIBMUSCLE_Data_create_logical%ptr = ret_val
+    end function LIBMUSCLE_Data_create_logical
+
+    function LIBMUSCLE_Data_create_character( &
+            value)
+        implicit none
+        character (len=*), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_character
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_character_( &
+            value, int(len(value), c_size_t))
+
+        LIBMUSCLE_Data_create_character%ptr = ret_val
+    end function LIBMUSCLE_Data_create_character
+
+    function LIBMUSCLE_Data_create_int1( &
+            value)
+        implicit none
+        integer (LIBMUSCLE_int1), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int1
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_int1_( &
+            value)
+
+        LIBMUSCLE_Data_create_int1%ptr = ret_val
+    end function LIBMUSCLE_Data_create_int1
+
+    function LIBMUSCLE_Data_create_int2( &
+            value)
+        implicit none
+        integer (selected_int_kind(4)), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int2
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_int2_( &
+            value)
+
+        LIBMUSCLE_Data_create_int2%ptr = ret_val
+    end function LIBMUSCLE_Data_create_int2
+
+    function LIBMUSCLE_Data_create_int4( &
+            value)
+        implicit none
+        integer (LIBMUSCLE_int4), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int4
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_int4_( &
+            value)
+
+        LIBMUSCLE_Data_create_int4%ptr = ret_val
+    end function LIBMUSCLE_Data_create_int4
+
+    function LIBMUSCLE_Data_create_int8( &
+            value)
+        implicit none
+        integer (selected_int_kind(18)), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int8
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_int8_( &
+            value)
+
+        LIBMUSCLE_Data_create_int8%ptr = ret_val
+    end function LIBMUSCLE_Data_create_int8
+
+    function LIBMUSCLE_Data_create_real4( &
+            value)
+        implicit none
+        real (LIBMUSCLE_real4), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_real4
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_real4_( &
+            value)
+
+        LIBMUSCLE_Data_create_real4%ptr = ret_val
+    end function LIBMUSCLE_Data_create_real4
+
+    function LIBMUSCLE_Data_create_real8( &
+            value)
+        implicit none
+        real (LIBMUSCLE_real8), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_real8
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_real8_( &
+            value)
+
+        LIBMUSCLE_Data_create_real8%ptr = ret_val
+    end function LIBMUSCLE_Data_create_real8
+
+    function LIBMUSCLE_Data_create_settings( &
+            value)
+        implicit none
+        type(YMMSL_Settings), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_settings
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_settings_( &
+            value%ptr)
+
+        LIBMUSCLE_Data_create_settings%ptr = ret_val
+    end function LIBMUSCLE_Data_create_settings
+
+    function LIBMUSCLE_Data_create_copy( &
+            value)
+        implicit none
+        type(LIBMUSCLE_Data), intent(in) :: value
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_copy
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_copy_( &
+            value%ptr)
+
+        LIBMUSCLE_Data_create_copy%ptr = ret_val
+    end function LIBMUSCLE_Data_create_copy
+
+    function LIBMUSCLE_Data_create_grid_1_logical_a( &
+            data_array)
+        implicit none
+        logical, dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_logical_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 1_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_1_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_logical_a
+
+    function LIBMUSCLE_Data_create_grid_2_logical_a( &
+            data_array)
+        implicit none
+        logical, dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_logical_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 2_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_2_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_logical_a
+
+    function LIBMUSCLE_Data_create_grid_3_logical_a( &
+            data_array)
+        implicit none
+        logical, dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_logical_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 3_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_3_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_logical_a
+
+    function LIBMUSCLE_Data_create_grid_4_logical_a( &
+            data_array)
+        implicit none
+        logical, dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_logical_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 4_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_4_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_logical_a
+
+    function LIBMUSCLE_Data_create_grid_5_logical_a( &
+            data_array)
+        implicit none
+        logical, dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_logical_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 5_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_5_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_logical_a
+
+    function LIBMUSCLE_Data_create_grid_6_logical_a( &
+            data_array)
+        implicit none
+        logical, dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_logical_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 6_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_6_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_logical_a
+
+    function LIBMUSCLE_Data_create_grid_7_logical_a( &
+            data_array)
+        implicit none
+        logical, dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_logical_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+            logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 7_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_7_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_logical_a
+
+    function LIBMUSCLE_Data_create_grid_1_int4_a( &
+            data_array)
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_1_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_int4_a
+
+    function LIBMUSCLE_Data_create_grid_2_int4_a( &
+            data_array)
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_2_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_int4_a
+
+    function LIBMUSCLE_Data_create_grid_3_int4_a( &
+            data_array)
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_3_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_int4_a
+
+    function LIBMUSCLE_Data_create_grid_4_int4_a( &
+            data_array)
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_4_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_int4_a
+
+    function LIBMUSCLE_Data_create_grid_5_int4_a( &
+            data_array)
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_5_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_int4_a
+
+    function LIBMUSCLE_Data_create_grid_6_int4_a( &
+            data_array)
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_6_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_int4_a
+
+    function LIBMUSCLE_Data_create_grid_7_int4_a( &
+            data_array)
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_7_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_int4_a
+
+    function LIBMUSCLE_Data_create_grid_1_int8_a( &
+            data_array)
+        implicit none
+        integer (selected_int_kind(18)), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_1_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_int8_a
+
+    function LIBMUSCLE_Data_create_grid_2_int8_a( &
+            data_array)
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_2_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_int8_a
+
+    function LIBMUSCLE_Data_create_grid_3_int8_a( &
+            data_array)
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_3_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_int8_a
+
+    function LIBMUSCLE_Data_create_grid_4_int8_a( &
+            data_array)
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_4_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_int8_a
+
+    function LIBMUSCLE_Data_create_grid_5_int8_a( &
+            data_array)
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_5_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_int8_a
+
+    function LIBMUSCLE_Data_create_grid_6_int8_a( &
+            data_array)
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_6_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_int8_a
+
+    function LIBMUSCLE_Data_create_grid_7_int8_a( &
+            data_array)
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_7_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_int8_a
+
+    function LIBMUSCLE_Data_create_grid_1_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_1_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_real4_a
+
+    function LIBMUSCLE_Data_create_grid_2_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_2_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_real4_a
+
+    function LIBMUSCLE_Data_create_grid_3_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_3_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_real4_a
+
+    function LIBMUSCLE_Data_create_grid_4_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_4_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_real4_a
+
+    function LIBMUSCLE_Data_create_grid_5_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_5_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_real4_a
+
+    function LIBMUSCLE_Data_create_grid_6_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_6_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_real4_a
+
+    function LIBMUSCLE_Data_create_grid_7_real4_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real4_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_7_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_real4_a
+
+    function LIBMUSCLE_Data_create_grid_1_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_1_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_real8_a
+
+    function LIBMUSCLE_Data_create_grid_2_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_2_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_real8_a
+
+    function LIBMUSCLE_Data_create_grid_3_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_3_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_real8_a
+
+    function LIBMUSCLE_Data_create_grid_4_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_4_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_real8_a
+
+    function LIBMUSCLE_Data_create_grid_5_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_5_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_real8_a
+
+    function LIBMUSCLE_Data_create_grid_6_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_6_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_real8_a
+
+    function LIBMUSCLE_Data_create_grid_7_real8_a( &
+            data_array)
+        implicit none
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real8_a
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+            data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
+
+        LIBMUSCLE_Data_create_grid_7_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_real8_a
+
+    function LIBMUSCLE_Data_create_grid_1_logical_n( &
+            data_array, &
+            index_name_1)
+
+        implicit none
+        logical, dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_logical_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_1_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_logical_n
+
+    function LIBMUSCLE_Data_create_grid_2_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
+
+        implicit none
+        logical, dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_logical_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_2_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_logical_n
+
+    function LIBMUSCLE_Data_create_grid_3_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
+
+        implicit none
+        logical, dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_logical_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_3_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_logical_n
+
+    function LIBMUSCLE_Data_create_grid_4_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
+
+        implicit none
+        logical, dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_logical_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_4_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_logical_n
+
+    function LIBMUSCLE_Data_create_grid_5_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
+
+        implicit none
+        logical, dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_logical_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_5_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_logical_n
+
+    function LIBMUSCLE_Data_create_grid_6_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
+
+        implicit none
+        logical, dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_logical_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_6_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_logical_n
+
+    function LIBMUSCLE_Data_create_grid_7_logical_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
+
+        implicit none
+        logical, dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_logical_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+                logical(data_array, c_bool), &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_7_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_logical_n
+
+    function LIBMUSCLE_Data_create_grid_1_int4_n( &
+            data_array, &
+            index_name_1)
+
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int4_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_1_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_int4_n
+
+    function LIBMUSCLE_Data_create_grid_2_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
+
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int4_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_2_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_int4_n
+
+    function LIBMUSCLE_Data_create_grid_3_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
+
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int4_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_3_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_int4_n
+
+    function LIBMUSCLE_Data_create_grid_4_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
+
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int4_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_4_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_int4_n
+
+    function LIBMUSCLE_Data_create_grid_5_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
+
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int4_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_5_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_int4_n
+
+    function LIBMUSCLE_Data_create_grid_6_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
+
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int4_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_6_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_int4_n
+
+    function LIBMUSCLE_Data_create_grid_7_int4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
+
+        implicit none
+        integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int4_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_7_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_int4_n
+
+    function LIBMUSCLE_Data_create_grid_1_int8_n( &
+            data_array, &
+            index_name_1)
+
+        implicit none
+        integer (selected_int_kind(18)), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int8_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_1_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_int8_n
+
+    function LIBMUSCLE_Data_create_grid_2_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
+
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int8_n
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_2_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_4_real8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_Data_create_grid_3_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real8), dimension(:, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_real8_( &
-            self%ptr, &
-            4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_4_real8
+        LIBMUSCLE_Data_create_grid_3_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_5_real8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_Data_create_grid_4_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real8), dimension(:, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (selected_int_kind(18)), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int8_n
 
-        call LIBMUSCLE_DataConstRef_elements_real8_( &
-            self%ptr, &
-            5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_5_real8
+        LIBMUSCLE_Data_create_grid_4_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_6_real8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+    function LIBMUSCLE_Data_create_grid_5_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int8_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_real8_( &
-            self%ptr, &
-            6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_Data_create_grid_5_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_int8_n
+
+    function LIBMUSCLE_Data_create_grid_6_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_6_real8
+        implicit none
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int8_n
 
-    subroutine LIBMUSCLE_DataConstRef_elements_7_real8( &
-            self, &
-            elements, &
-            err_code, &
-            err_msg)
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_6_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_int8_n
+
+    function LIBMUSCLE_Data_create_grid_7_int8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :, :), intent(out) :: elements
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
+        integer (selected_int_kind(18)), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int8_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_elements_real8_( &
-            self%ptr, &
-            7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_Data_create_grid_7_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_int8_n
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
-    end subroutine LIBMUSCLE_DataConstRef_elements_7_real8
+    function LIBMUSCLE_Data_create_grid_1_real4_n( &
+            data_array, &
+            index_name_1)
 
-    function LIBMUSCLE_DataConstRef_has_indexes( &
-            self, &
-            err_code, &
-            err_msg)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        logical :: LIBMUSCLE_DataConstRef_has_indexes
-
-        logical (c_bool) :: ret_val
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        real (LIBMUSCLE_real4), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real4_n
 
-        ret_val = LIBMUSCLE_DataConstRef_has_indexes_( &
-            self%ptr, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        integer (c_intptr_t) :: ret_val
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
+        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        LIBMUSCLE_Data_create_grid_1_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_real4_n
 
-        LIBMUSCLE_DataConstRef_has_indexes = ret_val
-    end function LIBMUSCLE_DataConstRef_has_indexes
+    function LIBMUSCLE_Data_create_grid_2_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
 
-    function LIBMUSCLE_DataConstRef_index( &
-            self, &
-            i, &
-            err_code, &
-            err_msg)
         implicit none
-        type(LIBMUSCLE_DataConstRef), intent(in) :: self
-        integer (LIBMUSCLE_size), intent(in) :: i
-        integer, optional, intent(out) :: err_code
-        character(:), allocatable, optional, intent(out) :: err_msg
-        character(:), allocatable :: LIBMUSCLE_DataConstRef_index
+        real (LIBMUSCLE_real4), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real4_n
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t) :: ret_val_size
-        character (c_char), dimension(:), pointer :: f_ret_ptr
-        integer :: i_loop
-        integer (c_int) :: err_code_v
-        type (c_ptr) :: err_msg_v
-        integer (c_size_t) :: err_msg_len_v
-        character (c_char), dimension(:), pointer :: err_msg_f
-        character(:), allocatable :: err_msg_p
-        integer (c_size_t) :: err_msg_i
+        integer (c_intptr_t) :: ret_val
 
-        call LIBMUSCLE_DataConstRef_index_( &
-            self%ptr, &
-            i, &
-            ret_val, &
-            ret_val_size, &
-            err_code_v, &
-            err_msg_v, &
-            err_msg_len_v)
+        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        if (err_code_v .ne. 0) then
-            if (present(err_code)) then
-                err_code = err_code_v
-                if (present(err_msg)) then
-                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                    allocate (character(err_msg_len_v) :: err_msg)
-                    do err_msg_i = 1, err_msg_len_v
-                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                    end do
-                end if
-                allocate (character(0) :: LIBMUSCLE_DataConstRef_index)
+        LIBMUSCLE_Data_create_grid_2_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_real4_n
+
+    function LIBMUSCLE_Data_create_grid_3_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
+
+        implicit none
+        real (LIBMUSCLE_real4), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real4_n
 
-                return
-            else
-                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
-                allocate (character(err_msg_len_v) :: err_msg_p)
-                do err_msg_i = 1, err_msg_len_v
-                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
-                end do
-                print *, err_msg_p
-                stop
-            end if
-        else
-            if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
+        integer (c_intptr_t) :: ret_val
 
-        call c_f_pointer(ret_val, f_ret_ptr, (/ret_val_size/))
-        allocate (character(ret_val_size) :: LIBMUSCLE_DataConstRef_index)
-        do i_loop = 1, ret_val_size
-            LIBMUSCLE_DataConstRef_index(i_loop:i_loop) = f_ret_ptr(i_loop)
-        end do
-    end function LIBMUSCLE_DataConstRef_index
+        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
+
+        LIBMUSCLE_Data_create_grid_3_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_real4_n
+
+    function LIBMUSCLE_Data_create_grid_4_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
-    function LIBMUSCLE_Data_create_nil( &
-    )
         implicit none
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_nil
+        real (LIBMUSCLE_real4), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_nil_( &
-    )
+        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_nil%ptr = ret_val
-    end function LIBMUSCLE_Data_create_nil
+        LIBMUSCLE_Data_create_grid_4_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_real4_n
+
+    function LIBMUSCLE_Data_create_grid_5_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
-    function LIBMUSCLE_Data_create_logical( &
-            value)
         implicit none
-        logical, intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_logical
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_logical_( &
-            logical(value, c_bool))
+        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_logical%ptr = ret_val
-    end function LIBMUSCLE_Data_create_logical
+        LIBMUSCLE_Data_create_grid_5_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_real4_n
+
+    function LIBMUSCLE_Data_create_grid_6_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
-    function LIBMUSCLE_Data_create_character( &
-            value)
         implicit none
-        character (len=*), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_character
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_character_( &
-            value, int(len(value), c_size_t))
+        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_character%ptr = ret_val
-    end function LIBMUSCLE_Data_create_character
+        LIBMUSCLE_Data_create_grid_6_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_real4_n
+
+    function LIBMUSCLE_Data_create_grid_7_real4_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
-    function LIBMUSCLE_Data_create_int1( &
-            value)
         implicit none
-        integer (LIBMUSCLE_int1), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int1
+        real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_int1_( &
-            value)
+        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_int1%ptr = ret_val
-    end function LIBMUSCLE_Data_create_int1
+        LIBMUSCLE_Data_create_grid_7_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_real4_n
+
+    function LIBMUSCLE_Data_create_grid_1_real8_n( &
+            data_array, &
+            index_name_1)
 
-    function LIBMUSCLE_Data_create_int2( &
-            value)
         implicit none
-        integer (selected_int_kind(4)), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int2
+        real (LIBMUSCLE_real8), dimension(:), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_int2_( &
-            value)
+        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                1_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_int2%ptr = ret_val
-    end function LIBMUSCLE_Data_create_int2
+        LIBMUSCLE_Data_create_grid_1_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_1_real8_n
+
+    function LIBMUSCLE_Data_create_grid_2_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2)
 
-    function LIBMUSCLE_Data_create_int4( &
-            value)
         implicit none
-        integer (LIBMUSCLE_int4), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int4
+        real (LIBMUSCLE_real8), dimension(:, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_int4_( &
-            value)
+        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                2_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_int4%ptr = ret_val
-    end function LIBMUSCLE_Data_create_int4
+        LIBMUSCLE_Data_create_grid_2_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_2_real8_n
+
+    function LIBMUSCLE_Data_create_grid_3_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3)
 
-    function LIBMUSCLE_Data_create_int8( &
-            value)
         implicit none
-        integer (selected_int_kind(18)), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_int8
+        real (LIBMUSCLE_real8), dimension(:, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_int8_( &
-            value)
+        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                3_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_int8%ptr = ret_val
-    end function LIBMUSCLE_Data_create_int8
+        LIBMUSCLE_Data_create_grid_3_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_3_real8_n
+
+    function LIBMUSCLE_Data_create_grid_4_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4)
 
-    function LIBMUSCLE_Data_create_real4( &
-            value)
         implicit none
-        real (LIBMUSCLE_real4), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_real4
+        real (LIBMUSCLE_real8), dimension(:, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_real4_( &
-            value)
+        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                4_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_real4%ptr = ret_val
-    end function LIBMUSCLE_Data_create_real4
+        LIBMUSCLE_Data_create_grid_4_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_4_real8_n
+
+    function LIBMUSCLE_Data_create_grid_5_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5)
 
-    function LIBMUSCLE_Data_create_real8( &
-            value)
         implicit none
-        real (LIBMUSCLE_real8), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_real8
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_real8_( &
-            value)
+        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                5_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_real8%ptr = ret_val
-    end function LIBMUSCLE_Data_create_real8
+        LIBMUSCLE_Data_create_grid_5_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_5_real8_n
+
+    function LIBMUSCLE_Data_create_grid_6_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6)
 
-    function LIBMUSCLE_Data_create_settings( &
-            value)
         implicit none
-        type(YMMSL_Settings), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_settings
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_settings_( &
-            value%ptr)
+        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                6_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_1, int(len(index_name_1), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_settings%ptr = ret_val
-    end function LIBMUSCLE_Data_create_settings
+        LIBMUSCLE_Data_create_grid_6_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_6_real8_n
+
+    function LIBMUSCLE_Data_create_grid_7_real8_n( &
+            data_array, &
+            index_name_1, &
+            index_name_2, &
+            index_name_3, &
+            index_name_4, &
+            index_name_5, &
+            index_name_6, &
+            index_name_7)
 
-    function LIBMUSCLE_Data_create_copy( &
-            value)
         implicit none
-        type(LIBMUSCLE_Data), intent(in) :: value
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_copy
+        real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
+        character (len=*), intent(in) :: index_name_1
+        character (len=*), intent(in) :: index_name_2
+        character (len=*), intent(in) :: index_name_3
+        character (len=*), intent(in) :: index_name_4
+        character (len=*), intent(in) :: index_name_5
+        character (len=*), intent(in) :: index_name_6
+        character (len=*), intent(in) :: index_name_7
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_copy_( &
-            value%ptr)
+        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+                data_array, &
+                int(shape(data_array), c_size_t), &
+                7_LIBMUSCLE_size, &
+                index_name_1, int(len(index_name_1), c_size_t), &
+                index_name_2, int(len(index_name_2), c_size_t), &
+                index_name_3, int(len(index_name_3), c_size_t), &
+                index_name_4, int(len(index_name_4), c_size_t), &
+                index_name_5, int(len(index_name_5), c_size_t), &
+                index_name_6, int(len(index_name_6), c_size_t), &
+                index_name_7, int(len(index_name_7), c_size_t) &
+            )
 
-        LIBMUSCLE_Data_create_copy%ptr = ret_val
-    end function LIBMUSCLE_Data_create_copy
+        LIBMUSCLE_Data_create_grid_7_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_7_real8_n
 
-    function LIBMUSCLE_Data_create_grid_1_logical_a( &
+    function LIBMUSCLE_Data_create_grid_view_1_logical_a( &
             data_array)
         implicit none
         logical, dimension(:), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_logical_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_logical_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_a_( &
             logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 1_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_1_logical_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_logical_a
+        LIBMUSCLE_Data_create_grid_view_1_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_logical_a
 
-    function LIBMUSCLE_Data_create_grid_2_logical_a( &
+    function LIBMUSCLE_Data_create_grid_view_2_logical_a( &
             data_array)
         implicit none
         logical, dimension(:, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_logical_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_logical_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_a_( &
             logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_2_logical_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_logical_a
+        LIBMUSCLE_Data_create_grid_view_2_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_logical_a
 
-    function LIBMUSCLE_Data_create_grid_3_logical_a( &
+    function LIBMUSCLE_Data_create_grid_view_3_logical_a( &
             data_array)
         implicit none
         logical, dimension(:, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_logical_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_logical_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_a_( &
             logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_3_logical_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_logical_a
+        LIBMUSCLE_Data_create_grid_view_3_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_logical_a
 
-    function LIBMUSCLE_Data_create_grid_4_logical_a( &
+    function LIBMUSCLE_Data_create_grid_view_4_logical_a( &
             data_array)
         implicit none
         logical, dimension(:, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_logical_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_logical_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_a_( &
             logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_4_logical_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_logical_a
+        LIBMUSCLE_Data_create_grid_view_4_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_logical_a
 
-    function LIBMUSCLE_Data_create_grid_5_logical_a( &
+    function LIBMUSCLE_Data_create_grid_view_5_logical_a( &
             data_array)
         implicit none
         logical, dimension(:, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_logical_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_logical_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_a_( &
             logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_5_logical_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_logical_a
+        LIBMUSCLE_Data_create_grid_view_5_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_logical_a
 
-    function LIBMUSCLE_Data_create_grid_6_logical_a( &
+    function LIBMUSCLE_Data_create_grid_view_6_logical_a( &
             data_array)
         implicit none
         logical, dimension(:, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_logical_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_logical_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_a_( &
             logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_6_logical_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_logical_a
+        LIBMUSCLE_Data_create_grid_view_6_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_logical_a
 
-    function LIBMUSCLE_Data_create_grid_7_logical_a( &
+    function LIBMUSCLE_Data_create_grid_view_7_logical_a( &
             data_array)
         implicit none
         logical, dimension(:, :, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_logical_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_logical_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_a_( &
             logical(data_array, c_bool), int(shape(logical(data_array, c_bool)), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_7_logical_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_logical_a
+        LIBMUSCLE_Data_create_grid_view_7_logical_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_logical_a
 
-    function LIBMUSCLE_Data_create_grid_1_int4_a( &
+    function LIBMUSCLE_Data_create_grid_view_1_int4_a( &
             data_array)
         implicit none
         integer (LIBMUSCLE_int4), dimension(:), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_int4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_a_( &
             data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_1_int4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_int4_a
+        LIBMUSCLE_Data_create_grid_view_1_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_int4_a
 
-    function LIBMUSCLE_Data_create_grid_2_int4_a( &
+    function LIBMUSCLE_Data_create_grid_view_2_int4_a( &
             data_array)
         implicit none
         integer (LIBMUSCLE_int4), dimension(:, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_int4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_a_( &
             data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_2_int4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_int4_a
+        LIBMUSCLE_Data_create_grid_view_2_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_int4_a
 
-    function LIBMUSCLE_Data_create_grid_3_int4_a( &
+    function LIBMUSCLE_Data_create_grid_view_3_int4_a( &
             data_array)
         implicit none
         integer (LIBMUSCLE_int4), dimension(:, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_int4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_a_( &
             data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_3_int4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_int4_a
+        LIBMUSCLE_Data_create_grid_view_3_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_int4_a
 
-    function LIBMUSCLE_Data_create_grid_4_int4_a( &
+    function LIBMUSCLE_Data_create_grid_view_4_int4_a( &
             data_array)
         implicit none
         integer (LIBMUSCLE_int4), dimension(:, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_int4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_a_( &
             data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_4_int4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_int4_a
+        LIBMUSCLE_Data_create_grid_view_4_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_int4_a
 
-    function LIBMUSCLE_Data_create_grid_5_int4_a( &
+    function LIBMUSCLE_Data_create_grid_view_5_int4_a( &
             data_array)
         implicit none
         integer (LIBMUSCLE_int4), dimension(:, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_int4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_a_( &
             data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_5_int4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_int4_a
+        LIBMUSCLE_Data_create_grid_view_5_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_int4_a
 
-    function LIBMUSCLE_Data_create_grid_6_int4_a( &
+    function LIBMUSCLE_Data_create_grid_view_6_int4_a( &
             data_array)
         implicit none
         integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_int4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_a_( &
             data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_6_int4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_int4_a
+        LIBMUSCLE_Data_create_grid_view_6_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_int4_a
 
-    function LIBMUSCLE_Data_create_grid_7_int4_a( &
+    function LIBMUSCLE_Data_create_grid_view_7_int4_a( &
             data_array)
         implicit none
         integer (LIBMUSCLE_int4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_int4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_a_( &
             data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_7_int4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_int4_a
+        LIBMUSCLE_Data_create_grid_view_7_int4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_int4_a
 
-    function LIBMUSCLE_Data_create_grid_1_int8_a( &
+    function LIBMUSCLE_Data_create_grid_view_1_int8_a( &
             data_array)
         implicit none
         integer (selected_int_kind(18)), dimension(:), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_int8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_a_( &
             data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_1_int8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_int8_a
+        LIBMUSCLE_Data_create_grid_view_1_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_int8_a
 
-    function LIBMUSCLE_Data_create_grid_2_int8_a( &
+    function LIBMUSCLE_Data_create_grid_view_2_int8_a( &
             data_array)
         implicit none
         integer (selected_int_kind(18)), dimension(:, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_int8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_a_( &
             data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_2_int8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_int8_a
+        LIBMUSCLE_Data_create_grid_view_2_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_int8_a
 
-    function LIBMUSCLE_Data_create_grid_3_int8_a( &
+    function LIBMUSCLE_Data_create_grid_view_3_int8_a( &
             data_array)
         implicit none
         integer (selected_int_kind(18)), dimension(:, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_int8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_a_( &
             data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_3_int8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_int8_a
+        LIBMUSCLE_Data_create_grid_view_3_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_int8_a
 
-    function LIBMUSCLE_Data_create_grid_4_int8_a( &
+    function LIBMUSCLE_Data_create_grid_view_4_int8_a( &
             data_array)
         implicit none
         integer (selected_int_kind(18)), dimension(:, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_int8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_a_( &
             data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_4_int8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_int8_a
+        LIBMUSCLE_Data_create_grid_view_4_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_int8_a
 
-    function LIBMUSCLE_Data_create_grid_5_int8_a( &
+    function LIBMUSCLE_Data_create_grid_view_5_int8_a( &
             data_array)
         implicit none
         integer (selected_int_kind(18)), dimension(:, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_int8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_a_( &
             data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_5_int8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_int8_a
+        LIBMUSCLE_Data_create_grid_view_5_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_int8_a
 
-    function LIBMUSCLE_Data_create_grid_6_int8_a( &
+    function LIBMUSCLE_Data_create_grid_view_6_int8_a( &
             data_array)
         implicit none
         integer (selected_int_kind(18)), dimension(:, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_int8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_a_( &
             data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_6_int8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_int8_a
+        LIBMUSCLE_Data_create_grid_view_6_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_int8_a
 
-    function LIBMUSCLE_Data_create_grid_7_int8_a( &
+    function LIBMUSCLE_Data_create_grid_view_7_int8_a( &
             data_array)
         implicit none
         integer (selected_int_kind(18)), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_int8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_a_( &
             data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_7_int8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_int8_a
+        LIBMUSCLE_Data_create_grid_view_7_int8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_int8_a
 
-    function LIBMUSCLE_Data_create_grid_1_real4_a( &
+    function LIBMUSCLE_Data_create_grid_view_1_real4_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real4), dimension(:), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_real4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_a_( &
             data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_1_real4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_real4_a
+        LIBMUSCLE_Data_create_grid_view_1_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_real4_a
 
-    function LIBMUSCLE_Data_create_grid_2_real4_a( &
+    function LIBMUSCLE_Data_create_grid_view_2_real4_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real4), dimension(:, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_real4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_a_( &
             data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_2_real4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_real4_a
+        LIBMUSCLE_Data_create_grid_view_2_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_real4_a
 
-    function LIBMUSCLE_Data_create_grid_3_real4_a( &
+    function LIBMUSCLE_Data_create_grid_view_3_real4_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real4), dimension(:, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_real4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_a_( &
             data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_3_real4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_real4_a
+        LIBMUSCLE_Data_create_grid_view_3_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_real4_a
 
-    function LIBMUSCLE_Data_create_grid_4_real4_a( &
+    function LIBMUSCLE_Data_create_grid_view_4_real4_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real4), dimension(:, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_real4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_a_( &
             data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_4_real4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_real4_a
+        LIBMUSCLE_Data_create_grid_view_4_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_real4_a
 
-    function LIBMUSCLE_Data_create_grid_5_real4_a( &
+    function LIBMUSCLE_Data_create_grid_view_5_real4_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real4), dimension(:, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_real4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_a_( &
             data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_5_real4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_real4_a
+        LIBMUSCLE_Data_create_grid_view_5_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_real4_a
 
-    function LIBMUSCLE_Data_create_grid_6_real4_a( &
+    function LIBMUSCLE_Data_create_grid_view_6_real4_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_real4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_a_( &
             data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_6_real4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_real4_a
+        LIBMUSCLE_Data_create_grid_view_6_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_real4_a
 
-    function LIBMUSCLE_Data_create_grid_7_real4_a( &
+    function LIBMUSCLE_Data_create_grid_view_7_real4_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real4), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real4_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_real4_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_a_( &
             data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_7_real4_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_real4_a
+        LIBMUSCLE_Data_create_grid_view_7_real4_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_real4_a
 
-    function LIBMUSCLE_Data_create_grid_1_real8_a( &
+    function LIBMUSCLE_Data_create_grid_view_1_real8_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real8), dimension(:), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_real8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_a_( &
             data_array, int(shape(data_array), c_size_t), 1_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_1_real8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_real8_a
+        LIBMUSCLE_Data_create_grid_view_1_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_real8_a
 
-    function LIBMUSCLE_Data_create_grid_2_real8_a( &
+    function LIBMUSCLE_Data_create_grid_view_2_real8_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real8), dimension(:, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_real8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_a_( &
             data_array, int(shape(data_array), c_size_t), 2_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_2_real8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_real8_a
+        LIBMUSCLE_Data_create_grid_view_2_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_real8_a
 
-    function LIBMUSCLE_Data_create_grid_3_real8_a( &
+    function LIBMUSCLE_Data_create_grid_view_3_real8_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real8), dimension(:, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_real8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_a_( &
             data_array, int(shape(data_array), c_size_t), 3_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_3_real8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_real8_a
+        LIBMUSCLE_Data_create_grid_view_3_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_real8_a
 
-    function LIBMUSCLE_Data_create_grid_4_real8_a( &
+    function LIBMUSCLE_Data_create_grid_view_4_real8_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real8), dimension(:, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_real8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_a_( &
             data_array, int(shape(data_array), c_size_t), 4_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_4_real8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_real8_a
+        LIBMUSCLE_Data_create_grid_view_4_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_real8_a
 
-    function LIBMUSCLE_Data_create_grid_5_real8_a( &
+    function LIBMUSCLE_Data_create_grid_view_5_real8_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real8), dimension(:, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_real8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_a_( &
             data_array, int(shape(data_array), c_size_t), 5_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_5_real8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_real8_a
+        LIBMUSCLE_Data_create_grid_view_5_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_real8_a
 
-    function LIBMUSCLE_Data_create_grid_6_real8_a( &
+    function LIBMUSCLE_Data_create_grid_view_6_real8_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_real8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_a_( &
             data_array, int(shape(data_array), c_size_t), 6_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_6_real8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_real8_a
+        LIBMUSCLE_Data_create_grid_view_6_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_real8_a
 
-    function LIBMUSCLE_Data_create_grid_7_real8_a( &
+    function LIBMUSCLE_Data_create_grid_view_7_real8_a( &
             data_array)
         implicit none
         real (LIBMUSCLE_real8), dimension(:, :, :, :, :, :, :), intent(in) :: data_array
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real8_a
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_real8_a
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_a_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_a_( &
             data_array, int(shape(data_array), c_size_t), 7_LIBMUSCLE_size)
 
-        LIBMUSCLE_Data_create_grid_7_real8_a%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_real8_a
+        LIBMUSCLE_Data_create_grid_view_7_real8_a%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_real8_a
 
-    function LIBMUSCLE_Data_create_grid_1_logical_n( &
+    function LIBMUSCLE_Data_create_grid_view_1_logical_n( &
             data_array, &
             index_name_1)
 
         implicit none
         logical, dimension(:), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_logical_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_logical_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_n_( &
                 logical(data_array, c_bool), &
                 int(shape(data_array), c_size_t), &
                 1_LIBMUSCLE_size, &
@@ -10035,10 +13819,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_1_logical_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_logical_n
+        LIBMUSCLE_Data_create_grid_view_1_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_logical_n
 
-    function LIBMUSCLE_Data_create_grid_2_logical_n( &
+    function LIBMUSCLE_Data_create_grid_view_2_logical_n( &
             data_array, &
             index_name_1, &
             index_name_2)
@@ -10047,11 +13831,11 @@ contains
         logical, dimension(:, :), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_logical_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_logical_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_n_( &
                 logical(data_array, c_bool), &
                 int(shape(data_array), c_size_t), &
                 2_LIBMUSCLE_size, &
@@ -10064,10 +13848,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_2_logical_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_logical_n
+        LIBMUSCLE_Data_create_grid_view_2_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_logical_n
 
-    function LIBMUSCLE_Data_create_grid_3_logical_n( &
+    function LIBMUSCLE_Data_create_grid_view_3_logical_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10078,11 +13862,11 @@ contains
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_logical_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_logical_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_n_( &
                 logical(data_array, c_bool), &
                 int(shape(data_array), c_size_t), &
                 3_LIBMUSCLE_size, &
@@ -10095,10 +13879,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_3_logical_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_logical_n
+        LIBMUSCLE_Data_create_grid_view_3_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_logical_n
 
-    function LIBMUSCLE_Data_create_grid_4_logical_n( &
+    function LIBMUSCLE_Data_create_grid_view_4_logical_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10111,11 +13895,11 @@ contains
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_logical_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_logical_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_n_( &
                 logical(data_array, c_bool), &
                 int(shape(data_array), c_size_t), &
                 4_LIBMUSCLE_size, &
@@ -10128,10 +13912,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_4_logical_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_logical_n
+        LIBMUSCLE_Data_create_grid_view_4_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_logical_n
 
-    function LIBMUSCLE_Data_create_grid_5_logical_n( &
+    function LIBMUSCLE_Data_create_grid_view_5_logical_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10146,11 +13930,11 @@ contains
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_logical_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_logical_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_n_( &
                 logical(data_array, c_bool), &
                 int(shape(data_array), c_size_t), &
                 5_LIBMUSCLE_size, &
@@ -10163,10 +13947,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_5_logical_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_logical_n
+        LIBMUSCLE_Data_create_grid_view_5_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_logical_n
 
-    function LIBMUSCLE_Data_create_grid_6_logical_n( &
+    function LIBMUSCLE_Data_create_grid_view_6_logical_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10183,11 +13967,11 @@ contains
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_logical_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_logical_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_n_( &
                 logical(data_array, c_bool), &
                 int(shape(data_array), c_size_t), &
                 6_LIBMUSCLE_size, &
@@ -10200,10 +13984,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_6_logical_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_logical_n
+        LIBMUSCLE_Data_create_grid_view_6_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_logical_n
 
-    function LIBMUSCLE_Data_create_grid_7_logical_n( &
+    function LIBMUSCLE_Data_create_grid_view_7_logical_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10222,11 +14006,11 @@ contains
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
         character (len=*), intent(in) :: index_name_7
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_logical_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_logical_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_logical_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_logical_n_( &
                 logical(data_array, c_bool), &
                 int(shape(data_array), c_size_t), &
                 7_LIBMUSCLE_size, &
@@ -10239,21 +14023,21 @@ contains
                 index_name_7, int(len(index_name_7), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_7_logical_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_logical_n
+        LIBMUSCLE_Data_create_grid_view_7_logical_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_logical_n
 
-    function LIBMUSCLE_Data_create_grid_1_int4_n( &
+    function LIBMUSCLE_Data_create_grid_view_1_int4_n( &
             data_array, &
             index_name_1)
 
         implicit none
         integer (LIBMUSCLE_int4), dimension(:), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_int4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 1_LIBMUSCLE_size, &
@@ -10266,10 +14050,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_1_int4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_int4_n
+        LIBMUSCLE_Data_create_grid_view_1_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_int4_n
 
-    function LIBMUSCLE_Data_create_grid_2_int4_n( &
+    function LIBMUSCLE_Data_create_grid_view_2_int4_n( &
             data_array, &
             index_name_1, &
             index_name_2)
@@ -10278,11 +14062,11 @@ contains
         integer (LIBMUSCLE_int4), dimension(:, :), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_int4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 2_LIBMUSCLE_size, &
@@ -10295,10 +14079,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_2_int4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_int4_n
+        LIBMUSCLE_Data_create_grid_view_2_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_int4_n
 
-    function LIBMUSCLE_Data_create_grid_3_int4_n( &
+    function LIBMUSCLE_Data_create_grid_view_3_int4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10309,11 +14093,11 @@ contains
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_int4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 3_LIBMUSCLE_size, &
@@ -10326,10 +14110,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_3_int4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_int4_n
+        LIBMUSCLE_Data_create_grid_view_3_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_int4_n
 
-    function LIBMUSCLE_Data_create_grid_4_int4_n( &
+    function LIBMUSCLE_Data_create_grid_view_4_int4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10342,11 +14126,11 @@ contains
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_int4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 4_LIBMUSCLE_size, &
@@ -10359,10 +14143,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_4_int4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_int4_n
+        LIBMUSCLE_Data_create_grid_view_4_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_int4_n
 
-    function LIBMUSCLE_Data_create_grid_5_int4_n( &
+    function LIBMUSCLE_Data_create_grid_view_5_int4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10377,11 +14161,11 @@ contains
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_int4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 5_LIBMUSCLE_size, &
@@ -10394,10 +14178,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_5_int4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_int4_n
+        LIBMUSCLE_Data_create_grid_view_5_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_int4_n
 
-    function LIBMUSCLE_Data_create_grid_6_int4_n( &
+    function LIBMUSCLE_Data_create_grid_view_6_int4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10414,11 +14198,11 @@ contains
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_int4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 6_LIBMUSCLE_size, &
@@ -10431,10 +14215,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_6_int4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_int4_n
+        LIBMUSCLE_Data_create_grid_view_6_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_int4_n
 
-    function LIBMUSCLE_Data_create_grid_7_int4_n( &
+    function LIBMUSCLE_Data_create_grid_view_7_int4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10453,11 +14237,11 @@ contains
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
         character (len=*), intent(in) :: index_name_7
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_int4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 7_LIBMUSCLE_size, &
@@ -10470,21 +14254,21 @@ contains
                 index_name_7, int(len(index_name_7), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_7_int4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_int4_n
+        LIBMUSCLE_Data_create_grid_view_7_int4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_int4_n
 
-    function LIBMUSCLE_Data_create_grid_1_int8_n( &
+    function LIBMUSCLE_Data_create_grid_view_1_int8_n( &
             data_array, &
             index_name_1)
 
         implicit none
         integer (selected_int_kind(18)), dimension(:), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_int8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_int8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 1_LIBMUSCLE_size, &
@@ -10497,10 +14281,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_1_int8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_int8_n
+        LIBMUSCLE_Data_create_grid_view_1_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_int8_n
 
-    function LIBMUSCLE_Data_create_grid_2_int8_n( &
+    function LIBMUSCLE_Data_create_grid_view_2_int8_n( &
             data_array, &
             index_name_1, &
             index_name_2)
@@ -10509,11 +14293,11 @@ contains
         integer (selected_int_kind(18)), dimension(:, :), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_int8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_int8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 2_LIBMUSCLE_size, &
@@ -10526,10 +14310,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_2_int8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_int8_n
+        LIBMUSCLE_Data_create_grid_view_2_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_int8_n
 
-    function LIBMUSCLE_Data_create_grid_3_int8_n( &
+    function LIBMUSCLE_Data_create_grid_view_3_int8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10540,11 +14324,11 @@ contains
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_int8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_int8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 3_LIBMUSCLE_size, &
@@ -10557,10 +14341,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_3_int8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_int8_n
+        LIBMUSCLE_Data_create_grid_view_3_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_int8_n
 
-    function LIBMUSCLE_Data_create_grid_4_int8_n( &
+    function LIBMUSCLE_Data_create_grid_view_4_int8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10573,11 +14357,11 @@ contains
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_int8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_int8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 4_LIBMUSCLE_size, &
@@ -10590,10 +14374,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_4_int8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_int8_n
+        LIBMUSCLE_Data_create_grid_view_4_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_int8_n
 
-    function LIBMUSCLE_Data_create_grid_5_int8_n( &
+    function LIBMUSCLE_Data_create_grid_view_5_int8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10608,11 +14392,11 @@ contains
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_int8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_int8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 5_LIBMUSCLE_size, &
@@ -10625,10 +14409,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_5_int8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_int8_n
+        LIBMUSCLE_Data_create_grid_view_5_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_int8_n
 
-    function LIBMUSCLE_Data_create_grid_6_int8_n( &
+    function LIBMUSCLE_Data_create_grid_view_6_int8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10645,11 +14429,11 @@ contains
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_int8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_int8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 6_LIBMUSCLE_size, &
@@ -10662,10 +14446,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_6_int8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_int8_n
+        LIBMUSCLE_Data_create_grid_view_6_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_int8_n
 
-    function LIBMUSCLE_Data_create_grid_7_int8_n( &
+    function LIBMUSCLE_Data_create_grid_view_7_int8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10684,11 +14468,11 @@ contains
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
         character (len=*), intent(in) :: index_name_7
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_int8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_int8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_int8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_int8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 7_LIBMUSCLE_size, &
@@ -10701,21 +14485,21 @@ contains
                 index_name_7, int(len(index_name_7), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_7_int8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_int8_n
+        LIBMUSCLE_Data_create_grid_view_7_int8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_int8_n
 
-    function LIBMUSCLE_Data_create_grid_1_real4_n( &
+    function LIBMUSCLE_Data_create_grid_view_1_real4_n( &
             data_array, &
             index_name_1)
 
         implicit none
         real (LIBMUSCLE_real4), dimension(:), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 1_LIBMUSCLE_size, &
@@ -10728,10 +14512,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_1_real4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_real4_n
+        LIBMUSCLE_Data_create_grid_view_1_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_real4_n
 
-    function LIBMUSCLE_Data_create_grid_2_real4_n( &
+    function LIBMUSCLE_Data_create_grid_view_2_real4_n( &
             data_array, &
             index_name_1, &
             index_name_2)
@@ -10740,11 +14524,11 @@ contains
         real (LIBMUSCLE_real4), dimension(:, :), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 2_LIBMUSCLE_size, &
@@ -10757,10 +14541,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_2_real4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_real4_n
+        LIBMUSCLE_Data_create_grid_view_2_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_real4_n
 
-    function LIBMUSCLE_Data_create_grid_3_real4_n( &
+    function LIBMUSCLE_Data_create_grid_view_3_real4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10771,11 +14555,11 @@ contains
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 3_LIBMUSCLE_size, &
@@ -10788,10 +14572,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_3_real4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_real4_n
+        LIBMUSCLE_Data_create_grid_view_3_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_real4_n
 
-    function LIBMUSCLE_Data_create_grid_4_real4_n( &
+    function LIBMUSCLE_Data_create_grid_view_4_real4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10804,11 +14588,11 @@ contains
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 4_LIBMUSCLE_size, &
@@ -10821,10 +14605,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_4_real4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_real4_n
+        LIBMUSCLE_Data_create_grid_view_4_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_real4_n
 
-    function LIBMUSCLE_Data_create_grid_5_real4_n( &
+    function LIBMUSCLE_Data_create_grid_view_5_real4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10839,11 +14623,11 @@ contains
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 5_LIBMUSCLE_size, &
@@ -10856,10 +14640,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_5_real4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_real4_n
+        LIBMUSCLE_Data_create_grid_view_5_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_real4_n
 
-    function LIBMUSCLE_Data_create_grid_6_real4_n( &
+    function LIBMUSCLE_Data_create_grid_view_6_real4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10876,11 +14660,11 @@ contains
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 6_LIBMUSCLE_size, &
@@ -10893,10 +14677,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_6_real4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_real4_n
+        LIBMUSCLE_Data_create_grid_view_6_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_real4_n
 
-    function LIBMUSCLE_Data_create_grid_7_real4_n( &
+    function LIBMUSCLE_Data_create_grid_view_7_real4_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -10915,11 +14699,11 @@ contains
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
         character (len=*), intent(in) :: index_name_7
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real4_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_real4_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real4_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real4_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 7_LIBMUSCLE_size, &
@@ -10932,21 +14716,21 @@ contains
                 index_name_7, int(len(index_name_7), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_7_real4_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_real4_n
+        LIBMUSCLE_Data_create_grid_view_7_real4_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_real4_n
 
-    function LIBMUSCLE_Data_create_grid_1_real8_n( &
+    function LIBMUSCLE_Data_create_grid_view_1_real8_n( &
             data_array, &
             index_name_1)
 
         implicit none
         real (LIBMUSCLE_real8), dimension(:), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_1_real8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_1_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 1_LIBMUSCLE_size, &
@@ -10959,10 +14743,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_1_real8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_1_real8_n
+        LIBMUSCLE_Data_create_grid_view_1_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_1_real8_n
 
-    function LIBMUSCLE_Data_create_grid_2_real8_n( &
+    function LIBMUSCLE_Data_create_grid_view_2_real8_n( &
             data_array, &
             index_name_1, &
             index_name_2)
@@ -10971,11 +14755,11 @@ contains
         real (LIBMUSCLE_real8), dimension(:, :), intent(in) :: data_array
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_2_real8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_2_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 2_LIBMUSCLE_size, &
@@ -10988,10 +14772,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_2_real8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_2_real8_n
+        LIBMUSCLE_Data_create_grid_view_2_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_2_real8_n
 
-    function LIBMUSCLE_Data_create_grid_3_real8_n( &
+    function LIBMUSCLE_Data_create_grid_view_3_real8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -11002,11 +14786,11 @@ contains
         character (len=*), intent(in) :: index_name_1
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_3_real8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_3_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 3_LIBMUSCLE_size, &
@@ -11019,10 +14803,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_3_real8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_3_real8_n
+        LIBMUSCLE_Data_create_grid_view_3_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_3_real8_n
 
-    function LIBMUSCLE_Data_create_grid_4_real8_n( &
+    function LIBMUSCLE_Data_create_grid_view_4_real8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -11035,11 +14819,11 @@ contains
         character (len=*), intent(in) :: index_name_2
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_4_real8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_4_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 4_LIBMUSCLE_size, &
@@ -11052,10 +14836,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_4_real8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_4_real8_n
+        LIBMUSCLE_Data_create_grid_view_4_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_4_real8_n
 
-    function LIBMUSCLE_Data_create_grid_5_real8_n( &
+    function LIBMUSCLE_Data_create_grid_view_5_real8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -11070,11 +14854,11 @@ contains
         character (len=*), intent(in) :: index_name_3
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_5_real8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_5_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 5_LIBMUSCLE_size, &
@@ -11087,10 +14871,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_5_real8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_5_real8_n
+        LIBMUSCLE_Data_create_grid_view_5_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_5_real8_n
 
-    function LIBMUSCLE_Data_create_grid_6_real8_n( &
+    function LIBMUSCLE_Data_create_grid_view_6_real8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -11107,11 +14891,11 @@ contains
         character (len=*), intent(in) :: index_name_4
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_6_real8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_6_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 6_LIBMUSCLE_size, &
@@ -11124,10 +14908,10 @@ contains
                 index_name_1, int(len(index_name_1), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_6_real8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_6_real8_n
+        LIBMUSCLE_Data_create_grid_view_6_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_6_real8_n
 
-    function LIBMUSCLE_Data_create_grid_7_real8_n( &
+    function LIBMUSCLE_Data_create_grid_view_7_real8_n( &
             data_array, &
             index_name_1, &
             index_name_2, &
@@ -11146,11 +14930,11 @@ contains
         character (len=*), intent(in) :: index_name_5
         character (len=*), intent(in) :: index_name_6
         character (len=*), intent(in) :: index_name_7
-        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_7_real8_n
+        type(LIBMUSCLE_Data) :: LIBMUSCLE_Data_create_grid_view_7_real8_n
 
         integer (c_intptr_t) :: ret_val
 
-        ret_val = LIBMUSCLE_Data_create_grid_real8_n_( &
+        ret_val = LIBMUSCLE_Data_create_grid_view_real8_n_( &
                 data_array, &
                 int(shape(data_array), c_size_t), &
                 7_LIBMUSCLE_size, &
@@ -11163,8 +14947,8 @@ contains
                 index_name_7, int(len(index_name_7), c_size_t) &
             )
 
-        LIBMUSCLE_Data_create_grid_7_real8_n%ptr = ret_val
-    end function LIBMUSCLE_Data_create_grid_7_real8_n
+        LIBMUSCLE_Data_create_grid_view_7_real8_n%ptr = ret_val
+    end function LIBMUSCLE_Data_create_grid_view_7_real8_n
 
     subroutine LIBMUSCLE_Data_free( &
             self)
@@ -12296,11 +16080,7 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
+        logical (c_bool), allocatable, dimension(:) :: buf_elements
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12308,12 +16088,14 @@ contains
         character(:), allocatable :: err_msg_p
         integer (c_size_t) :: err_msg_i
 
+        allocate (buf_elements( &
+                size(elements, 1)))
+
         call LIBMUSCLE_Data_elements_logical_( &
             self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
             1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12344,13 +16126,7 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/1/))
-        end if
+        elements = buf_elements
     end subroutine LIBMUSCLE_Data_elements_1_logical
 
     subroutine LIBMUSCLE_Data_elements_2_logical( &
@@ -12365,11 +16141,7 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
+        logical (c_bool), allocatable, dimension(:, :) :: buf_elements
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12377,12 +16149,15 @@ contains
         character(:), allocatable :: err_msg_p
         integer (c_size_t) :: err_msg_i
 
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2)))
+
         call LIBMUSCLE_Data_elements_logical_( &
             self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
             2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12413,13 +16188,7 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/2, 1/))
-        end if
+        elements = buf_elements
     end subroutine LIBMUSCLE_Data_elements_2_logical
 
     subroutine LIBMUSCLE_Data_elements_3_logical( &
@@ -12434,11 +16203,7 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
+        logical (c_bool), allocatable, dimension(:, :, :) :: buf_elements
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12446,12 +16211,16 @@ contains
         character(:), allocatable :: err_msg_p
         integer (c_size_t) :: err_msg_i
 
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3)))
+
         call LIBMUSCLE_Data_elements_logical_( &
             self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
             3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12482,13 +16251,7 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/3, 2, 1/))
-        end if
+        elements = buf_elements
     end subroutine LIBMUSCLE_Data_elements_3_logical
 
     subroutine LIBMUSCLE_Data_elements_4_logical( &
@@ -12503,11 +16266,7 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
+        logical (c_bool), allocatable, dimension(:, :, :, :) :: buf_elements
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12515,12 +16274,17 @@ contains
         character(:), allocatable :: err_msg_p
         integer (c_size_t) :: err_msg_i
 
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4)))
+
         call LIBMUSCLE_Data_elements_logical_( &
             self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
             4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12551,13 +16315,7 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/4, 3, 2, 1/))
-        end if
+        elements = buf_elements
     end subroutine LIBMUSCLE_Data_elements_4_logical
 
     subroutine LIBMUSCLE_Data_elements_5_logical( &
@@ -12572,11 +16330,7 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
+        logical (c_bool), allocatable, dimension(:, :, :, :, :) :: buf_elements
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12584,12 +16338,18 @@ contains
         character(:), allocatable :: err_msg_p
         integer (c_size_t) :: err_msg_i
 
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4), &
+                size(elements, 5)))
+
         call LIBMUSCLE_Data_elements_logical_( &
             self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
             5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12620,13 +16380,7 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/5, 4, 3, 2, 1/))
-        end if
+        elements = buf_elements
     end subroutine LIBMUSCLE_Data_elements_5_logical
 
     subroutine LIBMUSCLE_Data_elements_6_logical( &
@@ -12641,11 +16395,7 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
+        logical (c_bool), allocatable, dimension(:, :, :, :, :, :) :: buf_elements
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12653,12 +16403,19 @@ contains
         character(:), allocatable :: err_msg_p
         integer (c_size_t) :: err_msg_i
 
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4), &
+                size(elements, 5), &
+                size(elements, 6)))
+
         call LIBMUSCLE_Data_elements_logical_( &
             self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
             6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12689,13 +16446,7 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
+        elements = buf_elements
     end subroutine LIBMUSCLE_Data_elements_6_logical
 
     subroutine LIBMUSCLE_Data_elements_7_logical( &
@@ -12710,11 +16461,7 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        logical (c_bool), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        logical (c_bool), pointer, dimension(:) :: f_ret_ptr_linear
+        logical (c_bool), allocatable, dimension(:, :, :, :, :, :, :) :: buf_elements
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12722,12 +16469,20 @@ contains
         character(:), allocatable :: err_msg_p
         integer (c_size_t) :: err_msg_i
 
+        allocate (buf_elements( &
+                size(elements, 1), &
+                size(elements, 2), &
+                size(elements, 3), &
+                size(elements, 4), &
+                size(elements, 5), &
+                size(elements, 6), &
+                size(elements, 7)))
+
         call LIBMUSCLE_Data_elements_logical_( &
             self%ptr, &
+            buf_elements, &
+            int(shape(elements), c_size_t), &
             7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12758,13 +16513,7 @@ contains
             end if
         end if
 
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ logical (c_bool):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
+        elements = buf_elements
     end subroutine LIBMUSCLE_Data_elements_7_logical
 
     subroutine LIBMUSCLE_Data_elements_1_int4( &
@@ -12779,11 +16528,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12793,10 +16537,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12826,14 +16569,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_1_int4
 
     subroutine LIBMUSCLE_Data_elements_2_int4( &
@@ -12848,11 +16583,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12862,10 +16592,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12895,14 +16624,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_2_int4
 
     subroutine LIBMUSCLE_Data_elements_3_int4( &
@@ -12917,11 +16638,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -12931,10 +16647,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -12964,14 +16679,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_3_int4
 
     subroutine LIBMUSCLE_Data_elements_4_int4( &
@@ -12986,11 +16693,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13000,10 +16702,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13033,14 +16734,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_4_int4
 
     subroutine LIBMUSCLE_Data_elements_5_int4( &
@@ -13055,11 +16748,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13069,10 +16757,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13102,14 +16789,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_5_int4
 
     subroutine LIBMUSCLE_Data_elements_6_int4( &
@@ -13124,11 +16803,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13138,10 +16812,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13171,14 +16844,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_6_int4
 
     subroutine LIBMUSCLE_Data_elements_7_int4( &
@@ -13193,11 +16858,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int32_t), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int32_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13207,10 +16867,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13240,14 +16899,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int32_t):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_7_int4
 
     subroutine LIBMUSCLE_Data_elements_1_int8( &
@@ -13262,11 +16913,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13276,10 +16922,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13309,14 +16954,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_1_int8
 
     subroutine LIBMUSCLE_Data_elements_2_int8( &
@@ -13331,11 +16968,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13345,10 +16977,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13378,14 +17009,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_2_int8
 
     subroutine LIBMUSCLE_Data_elements_3_int8( &
@@ -13400,11 +17023,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13414,10 +17032,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13447,14 +17064,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_3_int8
 
     subroutine LIBMUSCLE_Data_elements_4_int8( &
@@ -13469,11 +17078,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13483,10 +17087,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13516,14 +17119,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_4_int8
 
     subroutine LIBMUSCLE_Data_elements_5_int8( &
@@ -13538,11 +17133,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13552,10 +17142,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13585,14 +17174,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_5_int8
 
     subroutine LIBMUSCLE_Data_elements_6_int8( &
@@ -13607,11 +17188,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13621,10 +17197,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13654,14 +17229,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_6_int8
 
     subroutine LIBMUSCLE_Data_elements_7_int8( &
@@ -13676,11 +17243,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        integer (c_int64_t), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        integer (c_int64_t), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13690,10 +17252,9 @@ contains
 
         call LIBMUSCLE_Data_elements_int8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13723,14 +17284,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ integer (c_int64_t):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_7_int8
 
     subroutine LIBMUSCLE_Data_elements_1_real4( &
@@ -13745,11 +17298,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13759,10 +17307,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13792,14 +17339,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_1_real4
 
     subroutine LIBMUSCLE_Data_elements_2_real4( &
@@ -13814,11 +17353,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13828,10 +17362,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13861,14 +17394,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_2_real4
 
     subroutine LIBMUSCLE_Data_elements_3_real4( &
@@ -13883,11 +17408,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13897,10 +17417,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13930,14 +17449,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_3_real4
 
     subroutine LIBMUSCLE_Data_elements_4_real4( &
@@ -13952,11 +17463,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -13966,10 +17472,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -13999,14 +17504,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_4_real4
 
     subroutine LIBMUSCLE_Data_elements_5_real4( &
@@ -14021,11 +17518,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14035,10 +17527,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14068,14 +17559,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_5_real4
 
     subroutine LIBMUSCLE_Data_elements_6_real4( &
@@ -14090,11 +17573,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14104,10 +17582,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14137,14 +17614,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/6, 5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_6_real4
 
     subroutine LIBMUSCLE_Data_elements_7_real4( &
@@ -14159,11 +17628,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_float), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        real (c_float), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14173,10 +17637,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real4_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14206,14 +17669,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_float):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_7_real4
 
     subroutine LIBMUSCLE_Data_elements_1_real8( &
@@ -14228,11 +17683,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(1) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14242,10 +17692,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             1_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14275,14 +17724,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_1_real8
 
     subroutine LIBMUSCLE_Data_elements_2_real8( &
@@ -14297,11 +17738,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(2) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14311,10 +17747,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             2_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14344,14 +17779,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_2_real8
 
     subroutine LIBMUSCLE_Data_elements_3_real8( &
@@ -14366,11 +17793,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(3) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14380,10 +17802,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             3_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14413,14 +17834,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_3_real8
 
     subroutine LIBMUSCLE_Data_elements_4_real8( &
@@ -14435,11 +17848,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(4) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14449,10 +17857,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             4_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14482,14 +17889,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_4_real8
 
     subroutine LIBMUSCLE_Data_elements_5_real8( &
@@ -14504,11 +17903,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(5) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14518,10 +17912,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             5_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14551,14 +17944,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_5_real8
 
     subroutine LIBMUSCLE_Data_elements_6_real8( &
@@ -14573,11 +17958,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(6) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14587,10 +17967,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             6_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14617,16 +17996,8 @@ contains
             end if
         else
             if (present(err_code)) then
-                err_code = 0
-            end if
-        end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/6, 5, 4, 3, 2, 1/))
+                err_code = 0
+            end if
         end if
     end subroutine LIBMUSCLE_Data_elements_6_real8
 
@@ -14642,11 +18013,6 @@ contains
         integer, optional, intent(out) :: err_code
         character(:), allocatable, optional, intent(out) :: err_msg
 
-        type (c_ptr) :: ret_val
-        integer (c_size_t), dimension(7) :: ret_val_shape
-        integer (c_int) :: ret_val_format
-        real (c_double), pointer, dimension(:, :, :, :, :, :, :) :: f_ret_ptr
-        real (c_double), pointer, dimension(:) :: f_ret_ptr_linear
         integer (c_int) :: err_code_v
         type (c_ptr) :: err_msg_v
         integer (c_size_t) :: err_msg_len_v
@@ -14656,10 +18022,9 @@ contains
 
         call LIBMUSCLE_Data_elements_real8_( &
             self%ptr, &
+            elements, &
+            int(shape(elements), c_size_t), &
             7_LIBMUSCLE_size, &
-            ret_val, &
-            ret_val_shape, &
-            ret_val_format, &
             err_code_v, &
             err_msg_v, &
             err_msg_len_v)
@@ -14689,14 +18054,6 @@ contains
                 err_code = 0
             end if
         end if
-
-        if (ret_val_format .eq. 0) then
-            call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)
-            elements = f_ret_ptr
-        else
-            call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))
-            elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ real (c_double):: /), (/7, 6, 5, 4, 3, 2, 1/))
-        end if
     end subroutine LIBMUSCLE_Data_elements_7_real8
 
     function LIBMUSCLE_Data_has_indexes( &
@@ -17070,6 +20427,20 @@ contains
         LIBMUSCLE_Instance_is_setting_a_real8array2 = ret_val
     end function LIBMUSCLE_Instance_is_setting_a_real8array2
 
+    function LIBMUSCLE_Instance_get_settings( &
+            self)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        type(YMMSL_Settings) :: LIBMUSCLE_Instance_get_settings
+
+        integer (c_intptr_t) :: ret_val
+
+        ret_val = LIBMUSCLE_Instance_get_settings_( &
+            self%ptr)
+
+        LIBMUSCLE_Instance_get_settings%ptr = ret_val
+    end function LIBMUSCLE_Instance_get_settings
+
     function LIBMUSCLE_Instance_get_setting_as_character( &
             self, &
             name, &
@@ -17528,6 +20899,22 @@ contains
             length)
     end subroutine LIBMUSCLE_Instance_set_port_length
 
+    function LIBMUSCLE_Instance_port_handle( &
+            self, &
+            port_name)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        character (len=*), intent(in) :: port_name
+        integer :: LIBMUSCLE_Instance_port_handle
+
+        integer (c_int) :: ret_val
+
+        ret_val = LIBMUSCLE_Instance_port_handle_( &
+            self%ptr, &
+            port_name, int(len(port_name), c_size_t))
+        LIBMUSCLE_Instance_port_handle = ret_val
+    end function LIBMUSCLE_Instance_port_handle
+
     subroutine LIBMUSCLE_Instance_send_pm( &
             self, &
             port_name, &
@@ -17561,6 +20948,39 @@ contains
             slot)
     end subroutine LIBMUSCLE_Instance_send_pms
 
+    subroutine LIBMUSCLE_Instance_send_hm( &
+            self, &
+            port_handle, &
+            message)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        integer, intent(in) :: port_handle
+        type(LIBMUSCLE_Message), intent(in) :: message
+
+        call LIBMUSCLE_Instance_send_hm_( &
+            self%ptr, &
+            port_handle, &
+            message%ptr)
+    end subroutine LIBMUSCLE_Instance_send_hm
+
+    subroutine LIBMUSCLE_Instance_send_hms( &
+            self, &
+            port_handle, &
+            message, &
+            slot)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        integer, intent(in) :: port_handle
+        type(LIBMUSCLE_Message), intent(in) :: message
+        integer, intent(in) :: slot
+
+        call LIBMUSCLE_Instance_send_hms_( &
+            self%ptr, &
+            port_handle, &
+            message%ptr, &
+            slot)
+    end subroutine LIBMUSCLE_Instance_send_hms
+
     function LIBMUSCLE_Instance_receive_p( &
             self, &
             port_name, &
@@ -17678,6 +21098,123 @@ contains
         LIBMUSCLE_Instance_receive_pd%ptr = ret_val
     end function LIBMUSCLE_Instance_receive_pd
 
+    function LIBMUSCLE_Instance_receive_h( &
+            self, &
+            port_handle, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        integer, intent(in) :: port_handle
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        type(LIBMUSCLE_Message) :: LIBMUSCLE_Instance_receive_h
+
+        integer (c_intptr_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_Instance_receive_h_( &
+            self%ptr, &
+            port_handle, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_Instance_receive_h%ptr = ret_val
+    end function LIBMUSCLE_Instance_receive_h
+
+    function LIBMUSCLE_Instance_receive_hd( &
+            self, &
+            port_handle, &
+            default_msg, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        integer, intent(in) :: port_handle
+        type(LIBMUSCLE_Message), intent(in) :: default_msg
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        type(LIBMUSCLE_Message) :: LIBMUSCLE_Instance_receive_hd
+
+        integer (c_intptr_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_Instance_receive_hd_( &
+            self%ptr, &
+            port_handle, &
+            default_msg%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_Instance_receive_hd%ptr = ret_val
+    end function LIBMUSCLE_Instance_receive_hd
+
     function LIBMUSCLE_Instance_receive_ps( &
             self, &
             port_name, &
@@ -17801,6 +21338,129 @@ contains
         LIBMUSCLE_Instance_receive_psd%ptr = ret_val
     end function LIBMUSCLE_Instance_receive_psd
 
+    function LIBMUSCLE_Instance_receive_hs( &
+            self, &
+            port_handle, &
+            slot, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        integer, intent(in) :: port_handle
+        integer, intent(in) :: slot
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        type(LIBMUSCLE_Message) :: LIBMUSCLE_Instance_receive_hs
+
+        integer (c_intptr_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_Instance_receive_hs_( &
+            self%ptr, &
+            port_handle, &
+            slot, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_Instance_receive_hs%ptr = ret_val
+    end function LIBMUSCLE_Instance_receive_hs
+
+    function LIBMUSCLE_Instance_receive_hsd( &
+            self, &
+            port_handle, &
+            slot, &
+            default_message, &
+            err_code, &
+            err_msg)
+        implicit none
+        type(LIBMUSCLE_Instance), intent(in) :: self
+        integer, intent(in) :: port_handle
+        integer, intent(in) :: slot
+        type(LIBMUSCLE_Message), intent(in) :: default_message
+        integer, optional, intent(out) :: err_code
+        character(:), allocatable, optional, intent(out) :: err_msg
+        type(LIBMUSCLE_Message) :: LIBMUSCLE_Instance_receive_hsd
+
+        integer (c_intptr_t) :: ret_val
+        integer (c_int) :: err_code_v
+        type (c_ptr) :: err_msg_v
+        integer (c_size_t) :: err_msg_len_v
+        character (c_char), dimension(:), pointer :: err_msg_f
+        character(:), allocatable :: err_msg_p
+        integer (c_size_t) :: err_msg_i
+
+        ret_val = LIBMUSCLE_Instance_receive_hsd_( &
+            self%ptr, &
+            port_handle, &
+            slot, &
+            default_message%ptr, &
+            err_code_v, &
+            err_msg_v, &
+            err_msg_len_v)
+
+        if (err_code_v .ne. 0) then
+            if (present(err_code)) then
+                err_code = err_code_v
+                if (present(err_msg)) then
+                    call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                    allocate (character(err_msg_len_v) :: err_msg)
+                    do err_msg_i = 1, err_msg_len_v
+                        err_msg(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                    end do
+                end if
+
+                return
+            else
+                call c_f_pointer(err_msg_v, err_msg_f, (/err_msg_len_v/))
+                allocate (character(err_msg_len_v) :: err_msg_p)
+                do err_msg_i = 1, err_msg_len_v
+                    err_msg_p(err_msg_i:err_msg_i) = err_msg_f(err_msg_i)
+                end do
+                print *, err_msg_p
+                stop
+            end if
+        else
+            if (present(err_code)) then
+                err_code = 0
+            end if
+        end if
+
+        LIBMUSCLE_Instance_receive_hsd%ptr = ret_val
+    end function LIBMUSCLE_Instance_receive_hsd
+
     function LIBMUSCLE_Instance_receive_with_settings_p( &
             self, &
             port_name, &
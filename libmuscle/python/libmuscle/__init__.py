@@ -1,5 +1,5 @@
 from libmuscle.communicator import Message
-from libmuscle.grid import Grid
+from libmuscle.grid import Grid, GridBlock
 from libmuscle.instance import Instance, InstanceFlags
 from libmuscle.version import __version__
 from libmuscle import runner
@@ -9,7 +9,8 @@ from libmuscle import runner
 # that it's not present.
 
 __all__ = [
-        '__version__', 'Grid', 'Instance', 'InstanceFlags', 'Message', 'runner']
+        '__version__', 'Grid', 'GridBlock', 'Instance', 'InstanceFlags', 'Message',
+        'runner']
 
 
 # export InstanceFlag members to the module namespace
@@ -51,3 +51,48 @@ class Grid:
 
         self.array = array
         self.indexes = indexes
+
+
+class GridBlock(Grid):
+    """Represents a block of a decomposed grid.
+
+    A grid block is a rectangular piece of a larger grid, as produced
+    by a domain decomposition. It carries its own array of data, like a
+    Grid, plus the shape of the global grid it is part of and the
+    offsets at which it starts within it. A decomposed grid can then be
+    sent as a list of blocks, one per rank, without ever assembling the
+    global array in one process's memory.
+
+    Attributes:
+        array (np.ndarray): An array of data
+        indexes (Optional[List[str]]): The names of the array's indexes.
+        offsets (List[int]): Position of the block within the global
+                grid.
+        global_shape (List[int]): The shape of the global grid.
+    """
+    def __init__(
+            self, array: np.ndarray, offsets: List[int],
+            global_shape: List[int], indexes: Optional[List[str]] = None
+            ) -> None:
+        """Creates a GridBlock object.
+
+        Types, data and indexes are as for Grid, see there. The offsets
+        give, for each dimension, the index in the global grid at which
+        this block starts, and global_shape gives the shape of the
+        global grid.
+
+        Args:
+            array: An array of data, of a supported type (see Grid).
+            offsets: Position of the block within the global grid.
+            global_shape: The shape of the global grid.
+            indexes: Names of the indexes (see Grid).
+        """
+        super().__init__(array, indexes)
+
+        if len(offsets) != array.ndim or len(global_shape) != array.ndim:
+            raise ValueError(
+                    'Number of offsets and global shape dimensions must'
+                    ' match number of array dimensions')
+
+        self.offsets = list(offsets)
+        self.global_shape = list(global_shape)
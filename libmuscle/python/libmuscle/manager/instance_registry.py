@@ -1,4 +1,5 @@
-from threading import Condition
+from threading import Condition, Lock
+from time import monotonic
 from typing import Dict  # noqa
 from typing import List
 
@@ -17,7 +18,9 @@ class InstanceRegistry:
     """
     def __init__(self) -> None:
         """Construct an empty InstanceRegistry"""
-        self._deregistered_one = Condition()    # doubles as lock
+        self._lock = Lock()
+        self._deregistered_one = Condition(self._lock)  # doubles as lock
+        self._registered_one = Condition(self._lock)
         self._locations = dict()  # type: Dict[Reference, List[str]]
         self._ports = dict()  # type: Dict[Reference, List[Port]]
         self._startup = True
@@ -43,6 +46,7 @@ class InstanceRegistry:
             self._locations[name] = locations
             self._ports[name] = ports
             self._startup = False
+            self._registered_one.notify_all()
 
     def get_locations(self, name: Reference) -> List[str]:
         """Retrieves the locations of a registered instance.
@@ -68,6 +72,28 @@ class InstanceRegistry:
         with self._deregistered_one:
             return self._ports[name]
 
+    def wait_for(self, name: Reference, timeout: float) -> bool:
+        """Waits until the named instance is registered.
+
+        This blocks until the instance registers, or until timeout
+        seconds have passed, whichever comes first.
+
+        Args:
+            name: Name of the instance to wait for.
+            timeout: Maximum time to wait, in seconds.
+
+        Returns:
+            True iff the instance is registered.
+        """
+        deadline = monotonic() + timeout
+        with self._registered_one:
+            while name not in self._locations:
+                remaining = deadline - monotonic()
+                if remaining <= 0.0:
+                    return False
+                self._registered_one.wait(remaining)
+            return True
+
     def remove(self, name: Reference) -> None:
         """Remove an instance from the registry.
 
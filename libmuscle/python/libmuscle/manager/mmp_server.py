@@ -26,6 +26,11 @@ from libmuscle.timestamp import Timestamp
 _logger = logging.getLogger(__name__)
 
 
+# Maximum time in seconds to hold a get_peers request while waiting for
+# peers to register, before telling the client to try again.
+_PEER_WAIT_TIMEOUT = 10.0
+
+
 def decode_operator(data: str) -> Operator:
     """Create an Operator from a MsgPack-compatible value."""
     return Operator[data]
@@ -91,14 +96,20 @@ class MMPRequestHandler(RequestHandler):
         req_args = req_list[1:]
         if req_type == RequestType.REGISTER_INSTANCE.value:
             response = self._register_instance(*req_args)
+        elif req_type == RequestType.REGISTER_INSTANCES.value:
+            response = self._register_instances(*req_args)
         elif req_type == RequestType.GET_PEERS.value:
             response = self._get_peers(*req_args)
         elif req_type == RequestType.DEREGISTER_INSTANCE.value:
             response = self._deregister_instance(*req_args)
+        elif req_type == RequestType.DEREGISTER_INSTANCES.value:
+            response = self._deregister_instances(*req_args)
         elif req_type == RequestType.GET_SETTINGS.value:
             response = self._get_settings(*req_args)
         elif req_type == RequestType.SUBMIT_LOG_MESSAGE.value:
             response = self._submit_log_message(*req_args)
+        elif req_type == RequestType.SUBMIT_LOG_MESSAGES.value:
+            response = self._submit_log_messages(*req_args)
         elif req_type == RequestType.SUBMIT_PROFILE_EVENTS.value:
             response = self._submit_profile_events(*req_args)
         elif req_type == RequestType.SUBMIT_SNAPSHOT.value:
@@ -148,6 +159,35 @@ class MMPRequestHandler(RequestHandler):
                     ' registered. Did you start a non-MPI component using'
                     ' mpirun?']
 
+    def _register_instances(self, instances: List[List[Any]]) -> Any:
+        """Handle a register instances request.
+
+        This registers a batch of instances hosted by a single process
+        in one request, see _register_instance(). When a large ensemble
+        is released all at once, this collapses the per-instance
+        registration round trips into a few batched ones.
+
+        Args:
+            instances: A list of instances to register, each a list
+                    with the arguments of a register instance request.
+
+        Returns:
+            A list containing the following values:
+
+            status (ResponseType): SUCCESS or ERROR
+            error_msg (str): An error message, only present if status
+                equals ERROR. It covers every instance that failed to
+                register; the remaining instances were registered.
+        """
+        errors = []
+        for instance in instances:
+            response = self._register_instance(*instance)
+            if response[0] == ResponseType.ERROR.value:
+                errors.append(response[1])
+        if errors:
+            return [ResponseType.ERROR.value, ' '.join(errors)]
+        return [ResponseType.SUCCESS.value]
+
     def _get_peers(self, instance_id: str) -> Any:
         """Handle a get peers request.
 
@@ -187,15 +227,25 @@ class MMPRequestHandler(RequestHandler):
         mmp_dimensions = {str(name): dims for name, dims in peer_dims.items()}
 
         # generate instances
-        try:
-            peers = self._topology_store.get_peer_instances(instance)
-            instance_locations = {
-                    str(peer): self._instance_registry.get_locations(peer)
-                    for peer in peers}
-        except KeyError as e:
-            return [
-                    ResponseType.PENDING.value,
-                    f'Waiting for component {e.args[0]}']
+        # Long poll: each connection is served by its own thread, so we
+        # can hold it while we wait for peers to register, rather than
+        # have thousands of instances poll us. If a peer still hasn't
+        # registered when the deadline passes, we return PENDING and
+        # the client retries as before.
+        deadline = time.monotonic() + _PEER_WAIT_TIMEOUT
+        while True:
+            try:
+                peers = self._topology_store.get_peer_instances(instance)
+                instance_locations = {
+                        str(peer): self._instance_registry.get_locations(peer)
+                        for peer in peers}
+                break
+            except KeyError as e:
+                if not self._instance_registry.wait_for(
+                        e.args[0], deadline - time.monotonic()):
+                    return [
+                            ResponseType.PENDING.value,
+                            f'Waiting for component {e.args[0]}']
 
         _logger.debug(f'Sent peers to {instance_id}')
         return [
@@ -227,6 +277,34 @@ class MMPRequestHandler(RequestHandler):
                     ResponseType.ERROR.value,
                     f'No instance with name {instance_id} was registered']
 
+    def _deregister_instances(self, instance_ids: List[str]) -> Any:
+        """Handle a deregister instances request.
+
+        This deregisters a batch of instances in one request, see
+        _deregister_instance(); the counterpart of
+        _register_instances() for shutdown.
+
+        Args:
+            instance_ids: IDs of the instances to deregister.
+
+        Returns:
+            A list containing the following values:
+
+            status (ResponseType): SUCCESS or ERROR
+            error_msg (str): An error message, only present if status
+                equals ERROR. It covers every instance that could not
+                be deregistered; the remaining instances were
+                deregistered.
+        """
+        errors = []
+        for instance_id in instance_ids:
+            response = self._deregister_instance(instance_id)
+            if response[0] == ResponseType.ERROR.value:
+                errors.append(response[1])
+        if errors:
+            return [ResponseType.ERROR.value, ' '.join(errors)]
+        return [ResponseType.SUCCESS.value]
+
     def _get_settings(self) -> Any:
         """Handle a get settings request.
 
@@ -260,6 +338,22 @@ class MMPRequestHandler(RequestHandler):
                 instance_id, Timestamp(timestamp), LogLevel(level), text)
         return [ResponseType.SUCCESS.value]
 
+    def _submit_log_messages(self, messages: List[List[Any]]) -> Any:
+        """Handle a submit log messages request.
+
+        Args:
+            messages: A list of log messages, each a list with the
+                    arguments of a submit log message request.
+
+        Returns:
+            A list containing the following values on success:
+
+            status (ResponseType): SUCCESS
+        """
+        for message in messages:
+            self._submit_log_message(*message)
+        return [ResponseType.SUCCESS.value]
+
     def _submit_profile_events(self, events: List[List[Any]]) -> Any:
         """Handle a submit profile events request.
 
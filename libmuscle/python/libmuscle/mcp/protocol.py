@@ -22,6 +22,9 @@ class RequestType(Enum):
     SUBMIT_PROFILE_EVENTS = 6
     SUBMIT_SNAPSHOT = 7
     GET_CHECKPOINT_INFO = 8
+    SUBMIT_LOG_MESSAGES = 9
+    REGISTER_INSTANCES = 10
+    DEREGISTER_INSTANCES = 11
 
     # MUSCLE Peer Protocol
     GET_NEXT_MESSAGE = 21
@@ -233,7 +233,9 @@ class MMPClient():
         while (response[0] == ResponseType.PENDING.value and
                perf_counter() < start_time + PEER_TIMEOUT and
                sleep_time < PEER_INTERVAL_MIN):
-            sleep(sleep_time)
+            # jitter the back-off so that instances that started
+            # together don't all retry at the same moments
+            sleep(uniform(0.5 * sleep_time, sleep_time))
             response = self._call_manager(request)
             sleep_time *= 1.5
 
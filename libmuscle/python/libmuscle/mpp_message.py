@@ -6,7 +6,7 @@ import numpy as np
 
 from ymmsl import Reference, Settings
 
-from libmuscle.grid import Grid
+from libmuscle.grid import Grid, GridBlock
 
 
 class ExtTypeId(IntEnum):
@@ -23,6 +23,11 @@ class ExtTypeId(IntEnum):
     GRID_FLOAT32 = 4
     GRID_FLOAT64 = 5
     GRID_BOOL = 6
+    GRID_BLOCK_INT32 = 7
+    GRID_BLOCK_INT64 = 8
+    GRID_BLOCK_FLOAT32 = 9
+    GRID_BLOCK_FLOAT64 = 10
+    GRID_BLOCK_BOOL = 11
 
 
 _grid_types = {
@@ -33,6 +38,14 @@ _grid_types = {
         ExtTypeId.GRID_BOOL}
 
 
+_grid_block_types = {
+        ExtTypeId.GRID_BLOCK_INT32,
+        ExtTypeId.GRID_BLOCK_INT64,
+        ExtTypeId.GRID_BLOCK_FLOAT32,
+        ExtTypeId.GRID_BLOCK_FLOAT64,
+        ExtTypeId.GRID_BLOCK_BOOL}
+
+
 class ClosePort:
     """Sentinel value to send when closing a port.
 
@@ -46,14 +59,22 @@ class ClosePort:
 
 
 def _encode_grid(grid: Grid) -> msgpack.ExtType:
-    """Encodes a Grid object into the wire format.
+    """Encodes a Grid or GridBlock object into the wire format.
     """
-    ext_type_map = {
-            'int32': ExtTypeId.GRID_INT32,
-            'int64': ExtTypeId.GRID_INT64,
-            'float32': ExtTypeId.GRID_FLOAT32,
-            'float64': ExtTypeId.GRID_FLOAT64,
-            'bool': ExtTypeId.GRID_BOOL}
+    if isinstance(grid, GridBlock):
+        ext_type_map = {
+                'int32': ExtTypeId.GRID_BLOCK_INT32,
+                'int64': ExtTypeId.GRID_BLOCK_INT64,
+                'float32': ExtTypeId.GRID_BLOCK_FLOAT32,
+                'float64': ExtTypeId.GRID_BLOCK_FLOAT64,
+                'bool': ExtTypeId.GRID_BLOCK_BOOL}
+    else:
+        ext_type_map = {
+                'int32': ExtTypeId.GRID_INT32,
+                'int64': ExtTypeId.GRID_INT64,
+                'float32': ExtTypeId.GRID_FLOAT32,
+                'float64': ExtTypeId.GRID_FLOAT64,
+                'bool': ExtTypeId.GRID_BOOL}
 
     array = grid.array
     if array.flags.f_contiguous:
@@ -81,19 +102,29 @@ def _encode_grid(grid: Grid) -> msgpack.ExtType:
             'order': order,
             'data': buf,
             'indexes': grid.indexes}
+
+    if isinstance(grid, GridBlock):
+        grid_dict['offsets'] = grid.offsets
+        grid_dict['global_shape'] = grid.global_shape
+
     packed_data = msgpack.packb(grid_dict, use_bin_type=True)
     return msgpack.ExtType(ext_type_map[array_type], packed_data)
 
 
 def _decode_grid(code: int, data: bytes) -> Grid:
-    """Creates a Grid from serialised data.
+    """Creates a Grid or GridBlock from serialised data.
     """
     type_map = {
             ExtTypeId.GRID_INT32: np.int32,
             ExtTypeId.GRID_INT64: np.int64,
             ExtTypeId.GRID_FLOAT32: np.float32,
             ExtTypeId.GRID_FLOAT64: np.float64,
-            ExtTypeId.GRID_BOOL: np.bool_}
+            ExtTypeId.GRID_BOOL: np.bool_,
+            ExtTypeId.GRID_BLOCK_INT32: np.int32,
+            ExtTypeId.GRID_BLOCK_INT64: np.int64,
+            ExtTypeId.GRID_BLOCK_FLOAT32: np.float32,
+            ExtTypeId.GRID_BLOCK_FLOAT64: np.float64,
+            ExtTypeId.GRID_BLOCK_BOOL: np.bool_}
 
     order_map = {
             'fa': 'F',
@@ -108,6 +139,11 @@ def _decode_grid(code: int, data: bytes) -> Grid:
     indexes = grid_dict['indexes']
     if indexes == []:
         indexes = None
+
+    if ExtTypeId(code) in _grid_block_types:
+        return GridBlock(
+                array, grid_dict['offsets'], grid_dict['global_shape'],
+                indexes)
     return Grid(array, indexes)
 
 
@@ -136,7 +172,7 @@ def _ext_decoder(code: int, data: bytes) -> msgpack.ExtType:
     elif code == ExtTypeId.SETTINGS:
         plain_dict = msgpack.unpackb(data, raw=False)
         return Settings(plain_dict)
-    elif code in _grid_types:
+    elif code in _grid_types or code in _grid_block_types:
         return _decode_grid(code, data)
     return msgpack.ExtType(code, data)
 
@@ -18,6 +18,7 @@ class ProfileEventType(Enum):
     DEREGISTER = 1
     SEND = 2
     RECEIVE = 3
+    RECEIVE_WAIT = 5
 
 
 class ProfileEvent:
@@ -1189,6 +1189,7 @@ class MemFun(Member):
             cpp_chain_call: Function that produces the C++ chain call.
             fc_override: Custom Fortran-C wrapper function.
             fc_chain_call: Function that produces the C ABI call.
+            fi_override: Custom Fortran interface declaration.
             f_override: Custom Fortran function.
         """
         self.ns_prefix = None       # type: Optional[str]
@@ -1203,6 +1204,7 @@ class MemFun(Member):
         self.fc_override = args.get('fc_override')
         self.fc_chain_call = args.get(
                 'fc_chain_call', self._default_fc_chain_call)
+        self.fi_override = args.get('fi_override')
         self.f_override = args.get('f_override')
         self.cpp_func_name = args.get('cpp_func_name', name)
 
@@ -1215,6 +1217,7 @@ class MemFun(Member):
         result.cpp_chain_call = self.cpp_chain_call
         result.fc_override = self.fc_override
         result.fc_chain_call = self.fc_chain_call
+        result.fi_override = self.fi_override
         result.f_override = self.f_override
         result.cpp_func_name = self.cpp_func_name
         return result
@@ -1301,6 +1304,11 @@ class MemFun(Member):
         if self.fc_override == '':
             return result
 
+        if self.fi_override is not None:
+            return textwrap.indent(
+                    self.fi_override.replace('$CLASSNAME$', self.class_name),
+                    8*' ')
+
         func_name = '{}_{}_{}_'.format(
                 self.ns_prefix, self.class_name, self.name)
 
@@ -26,7 +26,7 @@ class GridConstructor(MultiMemFun):
     very dangerous, just ugly.
     """
 
-    def __init__(self, with_names: bool) -> None:
+    def __init__(self, with_names: bool, view: bool = False) -> None:
         """Create a grid constructor.
 
         This creates a set of named constructors, one for each
@@ -35,15 +35,24 @@ class GridConstructor(MultiMemFun):
         arguments for index names, where n is the number of dimensions
         of the array it accepts.
 
+        If view is True, the constructors chain to grid_view() rather
+        than grid(), so the created object borrows the Fortran array
+        instead of copying it. The logical constructors are the
+        exception: converting to c_bool makes a temporary anyway, so
+        they chain to grid() to avoid borrowing a buffer that is gone
+        by the time we serialise.
+
         Args:
             with_names: Whether to add index name arguments.
+            view: Whether to borrow the array rather than copy it.
         """
         self.ns_prefix = None       # type: Optional[str]
         self.public = None          # type: Optional[bool]
         self.class_name = None      # type: Optional[str]
         self.with_names = with_names
+        self.view = view
         self.types = [Bool(), Int32t(), Int64t(), Float(), Double()]
-        self.name = 'grid'
+        self.name = 'grid_view' if view else 'grid'
         self.instances = list()     # type: List[NamedConstructor]
 
         # generate flexible C functions
@@ -53,23 +62,31 @@ class GridConstructor(MultiMemFun):
             typ.name = 'data_array'
             typ.set_ns_prefix({}, 'LIBMUSCLE')
 
+            # Converting logical arrays to c_bool makes a temporary, which
+            # we cannot borrow, so those always copy.
+            if view and not isinstance(typ, Bool):
+                cpp_func = 'grid_view'
+            else:
+                cpp_func = 'grid'
+
             instance_params = [Array(1, copy(typ), 'data_array')]
             if not with_names:
-                instance_name = 'grid_{}_a'.format(typ.tname())
-                chain_call = lambda **kwargs: ('{}::grid(data_array_p,'
+                instance_name = '{}_{}_a'.format(self.name, typ.tname())
+                chain_call = lambda cpp_func=cpp_func, **kwargs: (
+                        '{}::{}(data_array_p,'
                         ' data_array_shape_v, {{}},'
                         ' libmuscle::StorageOrder::first_adjacent'
-                        ')').format(kwargs['class_name'])
+                        ')').format(kwargs['class_name'], cpp_func)
                 self.instances.append(NamedConstructor(
-                    instance_params, instance_name, cpp_func_name='grid',
+                    instance_params, instance_name, cpp_func_name=cpp_func,
                     cpp_chain_call=chain_call, f_override=''))
             else:
                 for i in range(1, 8):
                     arg_name = 'index_name_{}'.format(i)
                     instance_params.append(String(arg_name))
-                instance_name = 'grid_{}_n'.format(typ.tname())
+                instance_name = '{}_{}_n'.format(self.name, typ.tname())
                 fc_override=(
-                        'std::intptr_t LIBMUSCLE_$CLASSNAME$_create_grid_{0}_n_(\n'
+                        'std::intptr_t LIBMUSCLE_$CLASSNAME$_create_{2}_{0}_n_(\n'
                         '        {1} * data_array,\n'
                         '        std::size_t * data_array_shape,\n'
                         '        std::size_t data_array_ndims,\n'
@@ -100,17 +117,24 @@ class GridConstructor(MultiMemFun):
                         '    if (data_array_ndims >= 7u)\n'
                         '        names_v.push_back(std::string(index_name_7, index_name_7_size));\n'
                         '\n'
-                        '    Data * result = new Data(Data::grid(\n'
+                        '    Data * result = new Data(Data::{3}(\n'
                         '            data_array_p, data_array_shape_v,\n'
                         '            names_v, libmuscle::StorageOrder::first_adjacent));\n'
                         '    return reinterpret_cast<std::intptr_t>(result);\n'
-                        '}}\n\n').format(typ.tname(), typ.fc_cpp_type())
+                        '}}\n\n').format(
+                                typ.tname(), typ.fc_cpp_type(), self.name,
+                                cpp_func)
                 self.instances.append(NamedConstructor(
                     instance_params, instance_name, fc_override=fc_override,
                     f_override=''))
 
         # generate instances
         for typ in self.types:
+            if view and not isinstance(typ, Bool):
+                cpp_func = 'grid_view'
+            else:
+                cpp_func = 'grid'
+
             for ndims in range(1, 8):
                 instance_params = [Array(ndims, copy(typ), 'data_array')]
                 if with_names:
@@ -118,8 +142,9 @@ class GridConstructor(MultiMemFun):
                         arg_name = 'index_name_{}'.format(i)
                         instance_params.append(String(arg_name))
 
-                instance_name = 'grid_{}_{}_{}'.format(
-                        ndims, typ.tname(), 'n' if with_names else 'a')
+                instance_name = '{}_{}_{}_{}'.format(
+                        self.name, ndims, typ.tname(),
+                        'n' if with_names else 'a')
 
                 if with_names:
                     arg_list = [
@@ -143,18 +168,18 @@ class GridConstructor(MultiMemFun):
                     dim_list = ', '.join([':'] * ndims)
 
                     f_override=(
-                            'function LIBMUSCLE_$CLASSNAME$_create_grid_{0}_{1}_n( &\n'
+                            'function LIBMUSCLE_$CLASSNAME$_create_{9}_{0}_{1}_n( &\n'
                             '        data_array, &\n'
                             '        {2})\n'
                             '\n'
                             '    implicit none\n'
                             '    {6}, dimension({8}), intent(in) :: data_array\n'
                             '{3}'
-                            '    type(LIBMUSCLE_$CLASSNAME$) :: LIBMUSCLE_$CLASSNAME$_create_grid_{0}_{1}_n\n'
+                            '    type(LIBMUSCLE_$CLASSNAME$) :: LIBMUSCLE_$CLASSNAME$_create_{9}_{0}_{1}_n\n'
                             '\n'
                             '    integer (c_intptr_t) :: ret_val\n'
                             '\n'
-                            '    ret_val = LIBMUSCLE_$CLASSNAME$_create_grid_{1}_n_( &\n'
+                            '    ret_val = LIBMUSCLE_$CLASSNAME$_create_{9}_{1}_n_( &\n'
                             '            {7}, &\n'
                             '            int(shape(data_array), c_size_t), &\n'
                             '            {0}_LIBMUSCLE_size, &\n'
@@ -162,29 +187,29 @@ class GridConstructor(MultiMemFun):
                             '{5} &\n'
                             '        )\n'
                             '\n'
-                            '    LIBMUSCLE_$CLASSNAME$_create_grid_{0}_{1}_n%ptr = ret_val\n'
-                            'end function LIBMUSCLE_$CLASSNAME$_create_grid_{0}_{1}_n\n'
+                            '    LIBMUSCLE_$CLASSNAME$_create_{9}_{0}_{1}_n%ptr = ret_val\n'
+                            'end function LIBMUSCLE_$CLASSNAME$_create_{9}_{0}_{1}_n\n'
                             '\n').format(
                                     ndims, typ.tname(), name_args, name_types,
                                     name_params, filler_params,
                                     typ.f_type()[0][0], typ.f_chain_arg(),
-                                    dim_list)
+                                    dim_list, self.name)
 
                     self.instances.append(NamedConstructor(
                         instance_params, instance_name,
                         f_override=f_override, fc_override=''))
                 else:
-                    chain_call = lambda tname=typ.tname(), **a: (
-                            '{}_{}_create_grid_{}_a_( &\n{})'.format(
-                                a['ns_prefix'], a['class_name'], tname,
+                    chain_call = lambda tname=typ.tname(), name=self.name, **a: (
+                            '{}_{}_create_{}_{}_a_( &\n{})'.format(
+                                a['ns_prefix'], a['class_name'], name, tname,
                                 a['fc_args']))
 
                     self.instances.append(NamedConstructor(
-                        instance_params, instance_name, cpp_func_name='grid',
+                        instance_params, instance_name, cpp_func_name=cpp_func,
                         fc_chain_call=chain_call, fc_override=''))
 
     def __copy__(self) -> 'GridConstructor':
-        result = GridConstructor(self.with_names)
+        result = GridConstructor(self.with_names, self.view)
         result.ns_prefix = self.ns_prefix
         result.public = self.public
         if self.class_name is None:
@@ -221,24 +246,50 @@ class Elements(MultiMemFun):
             fc_override = (
                     'void LIBMUSCLE_$CLASSNAME$_elements_{0}_(\n'
                     '        std::intptr_t self,\n'
-                    '        std::size_t ndims,\n'
-                    '        {1} ** elements,\n'
-                    '        std::size_t * elements_shape,\n'
-                    '        int * elements_format,\n'
+                    '        {1} * target,\n'
+                    '        std::size_t * target_shape,\n'
+                    '        std::size_t target_ndims,\n'
                     '        int * err_code, char ** err_msg, std::size_t * err_msg_len\n'
                     ') {{\n'
                     '    $CLASSNAME$ * self_p = reinterpret_cast<$CLASSNAME$ *>(self);\n'
                     '    try {{\n'
                     '        *err_code = 0;\n'
-                    '        if (self_p->shape().size() != ndims)\n'
+                    '        std::vector<std::size_t> shape = self_p->shape();\n'
+                    '        if (shape.size() != target_ndims)\n'
                     '            throw std::runtime_error("Grid does not have a matching number of dimensions.");\n'
-                    '        {1} const * result = self_p->elements<{1}>();\n'
-                    '        *elements = const_cast<{1} *>(result);\n'
-                    '\n'
-                    '        for (std::size_t i = 0u; i < ndims; ++i)\n'
-                    '            elements_shape[i] = self_p->shape()[i];\n'
+                    '        for (std::size_t i = 0u; i < target_ndims; ++i)\n'
+                    '            if (shape[i] != target_shape[i])\n'
+                    '                throw std::runtime_error("Grid does not have a matching shape.");\n'
+                    '        {1} const * source = self_p->elements<{1}>();\n'
+                    '        std::size_t num_elems = 1u;\n'
+                    '        for (std::size_t i = 0u; i < target_ndims; ++i)\n'
+                    '            num_elems *= shape[i];\n'
                     '\n'
-                    '        *elements_format = (self_p->storage_order() == libmuscle::StorageOrder::last_adjacent);\n'
+                    '        if (self_p->storage_order() == libmuscle::StorageOrder::first_adjacent) {{\n'
+                    '            memcpy(target, source, num_elems * sizeof({1}));\n'
+                    '        }}\n'
+                    '        else {{\n'
+                    '            // Transpose the row-major source into the column-major\n'
+                    '            // target, writing each element straight into place.\n'
+                    '            std::vector<std::size_t> strides(target_ndims);\n'
+                    '            std::size_t stride = 1u;\n'
+                    '            for (std::size_t i = 0u; i < target_ndims; ++i) {{\n'
+                    '                strides[i] = stride;\n'
+                    '                stride *= shape[i];\n'
+                    '            }}\n'
+                    '            std::vector<std::size_t> idx(target_ndims, 0u);\n'
+                    '            std::size_t offset = 0u;\n'
+                    '            for (std::size_t i = 0u; i < num_elems; ++i) {{\n'
+                    '                target[offset] = source[i];\n'
+                    '                for (std::size_t d = target_ndims; d-- > 0u; ) {{\n'
+                    '                    offset += strides[d];\n'
+                    '                    if (++idx[d] < shape[d])\n'
+                    '                        break;\n'
+                    '                    offset -= strides[d] * shape[d];\n'
+                    '                    idx[d] = 0u;\n'
+                    '                }}\n'
+                    '            }}\n'
+                    '        }}\n'
                     '        return;\n'
                     '    }}\n'
                     '    catch (std::runtime_error const & e) {{\n'
@@ -251,17 +302,59 @@ class Elements(MultiMemFun):
                     '}}\n\n'
                     ).format(typ.tname(), typ.fc_cpp_type())
 
+            fi_override = (
+                    'subroutine LIBMUSCLE_$CLASSNAME$_elements_{0}_( &\n'
+                    '        self, &\n'
+                    '        target, &\n'
+                    '        target_shape, &\n'
+                    '        target_ndims, &\n'
+                    '        err_code, &\n'
+                    '        err_msg, &\n'
+                    '        err_msg_len) &\n'
+                    '        bind(C, name="LIBMUSCLE_$CLASSNAME$_elements_{0}_")\n'
+                    '\n'
+                    '    use iso_c_binding\n'
+                    '    integer (c_intptr_t), value, intent(in) :: self\n'
+                    '    {1}, dimension(*), intent(inout) :: target\n'
+                    '    integer (c_size_t), dimension(1), intent(in) :: target_shape\n'
+                    '    integer (c_size_t), value, intent(in) :: target_ndims\n'
+                    '    integer (c_int), intent(out) :: err_code\n'
+                    '    type (c_ptr), intent(out) :: err_msg\n'
+                    '    integer (c_size_t), intent(out) :: err_msg_len\n'
+                    'end subroutine LIBMUSCLE_$CLASSNAME$_elements_{0}_\n\n'
+                    ).format(typ.tname(), typ.fi_ret_type()[0][0])
+
             self.instances.append(
                     MemFun(
-                        Array(1, copy(typ), 'elements'), func_name, [Sizet('ndims')], True,
-                        f_override='', fc_override=fc_override))
+                        Void(), func_name, [], True,
+                        f_override='', fc_override=fc_override,
+                        fi_override=fi_override))
 
         # Generate API
         for typ in self.types:
             for ndims in range(1, 8):
                 func_name = 'elements_{}_{}'.format(ndims, typ.tname())
                 dims_list = ', '.join([':']*ndims)
-                rev_dims = ', '.join(map(str, reversed(range(1, ndims+1))))
+                if isinstance(typ, Bool):
+                    # Logicals get converted between the default kind and
+                    # c_bool, so they go through a buffer.
+                    sizes = ', &\n            '.join([
+                            'size(elements, {})'.format(dim)
+                            for dim in range(1, ndims+1)])
+                    buf_decl = (
+                            '    logical (c_bool), allocatable,'
+                            ' dimension({}) :: buf_elements\n').format(
+                                    dims_list)
+                    pre_call = (
+                            '    allocate (buf_elements( &\n'
+                            '            {}))\n\n').format(sizes)
+                    call_arg = 'buf_elements'
+                    post_call = '\n    elements = buf_elements\n'
+                else:
+                    buf_decl = ''
+                    pre_call = ''
+                    call_arg = 'elements'
+                    post_call = ''
                 f_override = (
                         'subroutine LIBMUSCLE_$CLASSNAME$_elements_{0}_{1}( &\n'
                         '        self, &\n'
@@ -275,11 +368,7 @@ class Elements(MultiMemFun):
                         '    integer, optional, intent(out) :: err_code\n'
                         '    character(:), allocatable, optional, intent(out) :: err_msg\n'
                         '\n'
-                        '    type (c_ptr) :: ret_val\n'
-                        '    integer (c_size_t), dimension({0}) :: ret_val_shape\n'
-                        '    integer (c_int) :: ret_val_format\n'
-                        '    {4}, pointer, dimension({3}) :: f_ret_ptr\n'
-                        '    {4}, pointer, dimension(:) :: f_ret_ptr_linear\n'
+                        '{4}'
                         '    integer (c_int) :: err_code_v\n'
                         '    type (c_ptr) :: err_msg_v\n'
                         '    integer (c_size_t) :: err_msg_len_v\n'
@@ -287,12 +376,12 @@ class Elements(MultiMemFun):
                         '    character(:), allocatable :: err_msg_p\n'
                         '    integer (c_size_t) :: err_msg_i\n'
                         '\n'
+                        '{5}'
                         '    call LIBMUSCLE_$CLASSNAME$_elements_{1}_( &\n'
                         '        self%ptr, &\n'
+                        '        {6}, &\n'
+                        '        int(shape(elements), c_size_t), &\n'
                         '        {0}_LIBMUSCLE_size, &\n'
-                        '        ret_val, &\n'
-                        '        ret_val_shape, &\n'
-                        '        ret_val_format, &\n'
                         '        err_code_v, &\n'
                         '        err_msg_v, &\n'
                         '        err_msg_len_v)\n'
@@ -322,18 +411,12 @@ class Elements(MultiMemFun):
                         '            err_code = 0\n'
                         '        end if\n'
                         '    end if\n'
-                        '\n'
-                        '    if (ret_val_format .eq. 0) then\n'
-                        '        call c_f_pointer(ret_val, f_ret_ptr, ret_val_shape)\n'
-                        '        elements = f_ret_ptr\n'
-                        '    else\n'
-                        '        call c_f_pointer(ret_val, f_ret_ptr_linear, (/product(ret_val_shape)/))\n'
-                        '        elements = reshape(f_ret_ptr_linear, ret_val_shape, (/ {4}:: /), (/{5}/))\n'
-                        '    end if\n'
+                        '{7}'
                         'end subroutine LIBMUSCLE_$CLASSNAME$_elements_{0}_{1}\n\n'
                         ).format(
                                 ndims, typ.tname(), typ.f_ret_type()[1][0][0],
-                                dims_list, typ.fi_ret_type()[0][0], rev_dims)
+                                dims_list, buf_decl, pre_call, call_arg,
+                                post_call)
 
                 self.instances.append(
                         MemFun(
@@ -360,6 +443,13 @@ create_grid_overloads = [
         for with_names_tag in ['n', 'a']]
 
 
+create_grid_view_overloads = [
+        'create_grid_view_{}_{}_{}'.format(ndims, typ, with_names_tag)
+        for ndims in range(1, 8)
+        for typ in ['logical', 'int4', 'int8', 'real4', 'real8']
+        for with_names_tag in ['n', 'a']]
+
+
 dataconstref_desc = Class('DataConstRef', None, [
     Constructor([], 'create_nil'),
     Constructor([Bool('value')], 'create_logical'),
@@ -379,6 +469,9 @@ dataconstref_desc = Class('DataConstRef', None, [
     GridConstructor(False),
     GridConstructor(True),
     OverloadSet('create_grid', create_grid_overloads),
+    GridConstructor(False, view=True),
+    GridConstructor(True, view=True),
+    OverloadSet('create_grid_view', create_grid_view_overloads),
     Destructor(),
     MemFunTmpl(
         [Bool(), String(), Int(), Char(), Int16t(), Int32t(), Int64t(),
@@ -900,7 +993,9 @@ instance_mpi_constructors = [
             ') {\n'
             '    CmdLineArgs * cla_p = reinterpret_cast<CmdLineArgs *>(cla);\n'
             '    MPI_Comm communicator_m = MPI_Comm_f2c(communicator);\n'
-            '    Instance * result = new Instance(cla_p->argc(), cla_p->argv(), communicator_m, root);\n'
+            '    Instance * result = new Instance(\n'
+            '        cla_p->argc(), cla_p->argv(),\n'
+            '        libmuscle::impl::InstanceFlags::none, communicator_m, root);\n'
             '    return reinterpret_cast<std::intptr_t>(result);\n'
             '}\n\n'),
         f_override=(
@@ -1003,7 +1098,8 @@ instance_mpi_constructors = [
             '            ports);\n'
             '    MPI_Comm communicator_m = MPI_Comm_f2c(communicator);\n'
             '    Instance * result = new Instance(\n'
-            '        cla_p->argc(), cla_p->argv(), *ports_p, communicator_m, root);\n'
+            '        cla_p->argc(), cla_p->argv(), *ports_p,\n'
+            '        libmuscle::impl::InstanceFlags::none, communicator_m, root);\n'
             '    return reinterpret_cast<std::intptr_t>(result);\n'
             '}\n\n'),
         f_override=(
@@ -1128,6 +1224,10 @@ instance_members = [
                     kwargs['cpp_args'], kwargs['tpl_type'])
         ),
 
+    # A snapshot of all resolved settings, so that a model reading many
+    # of them does one boundary crossing rather than one per setting.
+    MemFun(Obj('Settings'), 'get_settings'),
+
     MemFunTmpl(
         [String(), Int64t(), Double(), Bool(), VecDbl('value'),
             Vec2Dbl('value')],
@@ -1139,6 +1239,15 @@ instance_members = [
     MemFun(Int(), 'get_port_length', [String('port')]),
     MemFun(Void(), 'set_port_length', [String('port'), Int('length')]),
 
+    # Port handles let the Fortran side resolve a port name once and
+    # then send and receive without converting a string on every call.
+    # The cast keeps self_p used; the intern table is process-wide.
+    MemFun(Int(), 'port_handle', [String('port_name')],
+           cpp_chain_call=lambda **kwargs: (
+               '(static_cast<void>(self_p),'
+               ' libmuscle::impl::bindings::intern_port_name({}))'.format(
+                   kwargs['cpp_args']))),
+
     MemFun(Void(), 'send_pm',
            [String('port_name'), Obj('Message', 'message')],
            cpp_chain_call=lambda **kwargs: 'self_p->send({})'.format(
@@ -1147,7 +1256,17 @@ instance_members = [
            [String('port_name'), Obj('Message', 'message'), Int('slot')],
            cpp_chain_call=lambda **kwargs: 'self_p->send({})'.format(
                kwargs['cpp_args'])),
-    OverloadSet('send', ['send_pm', 'send_pms']),
+    MemFun(Void(), 'send_hm',
+           [Int('port_handle'), Obj('Message', 'message')],
+           cpp_chain_call=lambda **kwargs: (
+               'self_p->send(libmuscle::impl::bindings::'
+               'port_name_for_handle(port_handle), *message_p)')),
+    MemFun(Void(), 'send_hms',
+           [Int('port_handle'), Obj('Message', 'message'), Int('slot')],
+           cpp_chain_call=lambda **kwargs: (
+               'self_p->send(libmuscle::impl::bindings::'
+               'port_name_for_handle(port_handle), *message_p, slot)')),
+    OverloadSet('send', ['send_pm', 'send_pms', 'send_hm', 'send_hms']),
 
     MemFun(Obj('Message'), 'receive_p', [String('port_name')], True,
            cpp_chain_call=lambda **kwargs: 'self_p->receive({})'.format(
@@ -1156,7 +1275,17 @@ instance_members = [
            [String('port_name'), Obj('Message', 'default_msg')], True,
            cpp_chain_call=lambda **kwargs: 'self_p->receive({})'.format(
                kwargs['cpp_args'])),
-    OverloadSet('receive', ['receive_p', 'receive_pd']),
+    MemFun(Obj('Message'), 'receive_h', [Int('port_handle')], True,
+           cpp_chain_call=lambda **kwargs: (
+               'self_p->receive(libmuscle::impl::bindings::'
+               'port_name_for_handle(port_handle))')),
+    MemFun(Obj('Message'), 'receive_hd',
+           [Int('port_handle'), Obj('Message', 'default_msg')], True,
+           cpp_chain_call=lambda **kwargs: (
+               'self_p->receive(libmuscle::impl::bindings::'
+               'port_name_for_handle(port_handle), *default_msg_p)')),
+    OverloadSet('receive', [
+        'receive_p', 'receive_pd', 'receive_h', 'receive_hd']),
 
     MemFun(Obj('Message'), 'receive_ps', [String('port_name'), Int('slot')],
            True,
@@ -1167,7 +1296,20 @@ instance_members = [
            True,
            cpp_chain_call=lambda **kwargs: 'self_p->receive({})'.format(
                kwargs['cpp_args'])),
-    OverloadSet('receive_on_slot', ['receive_ps', 'receive_psd']),
+    MemFun(Obj('Message'), 'receive_hs', [Int('port_handle'), Int('slot')],
+           True,
+           cpp_chain_call=lambda **kwargs: (
+               'self_p->receive(libmuscle::impl::bindings::'
+               'port_name_for_handle(port_handle), slot)')),
+    MemFun(Obj('Message'), 'receive_hsd',
+           [Int('port_handle'), Int('slot'), Obj('Message', 'default_message')],
+           True,
+           cpp_chain_call=lambda **kwargs: (
+               'self_p->receive(libmuscle::impl::bindings::'
+               'port_name_for_handle(port_handle), slot,'
+               ' *default_message_p)')),
+    OverloadSet('receive_on_slot', [
+        'receive_ps', 'receive_psd', 'receive_hs', 'receive_hsd']),
 
     MemFun(Obj('Message'), 'receive_with_settings_p',
            [String('port_name')], True,
@@ -1226,7 +1368,9 @@ libmuscle_api_description = API(
         [
             'libmuscle/libmuscle.hpp',
             'libmuscle/bindings/cmdlineargs.hpp',
+            'libmuscle/bindings/port_names.hpp',
             'ymmsl/ymmsl.hpp',
+            'cstring',
             'stdexcept',
             'typeinfo'],
         [
@@ -1248,7 +1392,9 @@ libmuscle_mpi_api_description = API(
         [
             'libmuscle/libmuscle.hpp',
             'libmuscle/bindings/cmdlineargs.hpp',
+            'libmuscle/bindings/port_names.hpp',
             'ymmsl/ymmsl.hpp',
+            'cstring',
             'stdexcept',
             'typeinfo'],
         [